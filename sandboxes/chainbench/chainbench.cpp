@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+
+#include <libslic3r/libslic3r.h>
+#include <libslic3r/ShortestPath.hpp>
+#include <libnest2d/tools/benchmark.h>
+
+const std::string USAGE_STR = {
+    "Usage: chainbench [num_segments]\n"
+    "Chains random short segments (gap fill like, 100000 segments by default) spread over a 200x200mm bed "
+    "by the former linear search, by the KD tree greedy chaining and by the greedy chaining improved with 2-opt, "
+    "and reports the runtime and the travel length."
+};
+
+using namespace Slic3r;
+
+// The linear search over the remaining segments, as PolylineCollection used to chain the polylines.
+static ChainOrder chain_segments_linear(const std::vector<ChainSegment> &segments, Point start_near)
+{
+    std::vector<size_t> remaining(segments.size());
+    for (size_t i = 0; i < segments.size(); ++ i)
+        remaining[i] = i;
+    ChainOrder out;
+    while (! remaining.empty()) {
+        double dmin = std::numeric_limits<double>::max();
+        size_t idx  = 0;
+        for (size_t i = 0; i < remaining.size(); ++ i) {
+            const ChainSegment &s = segments[remaining[i]];
+            double d = sqr<double>(start_near(0) - s.first(0)) + sqr<double>(start_near(1) - s.first(1));
+            if (d < dmin) {
+                dmin = d;
+                idx  = 2 * i;
+            }
+            if (s.can_reverse) {
+                d = sqr<double>(start_near(0) - s.last(0)) + sqr<double>(start_near(1) - s.last(1));
+                if (d < dmin) {
+                    dmin = d;
+                    idx  = 2 * i + 1;
+                }
+            }
+        }
+        const ChainSegment &s = segments[remaining[idx / 2]];
+        out.emplace_back(remaining[idx / 2], (idx & 1) != 0);
+        start_near = (idx & 1) ? s.first : s.last;
+        remaining.erase(remaining.begin() + idx / 2);
+    }
+    return out;
+}
+
+static inline double chain_distance(const Point &a, const Point &b)
+{
+    return (b - a).cast<double>().norm();
+}
+
+// Shortens the travel moves of a chain by the 2-opt heuristics: A sub-chain is reversed (and its segments are traversed
+// in the opposite direction) if it shortens the travel. Only the sub-chains of reversible segments up to a limited length
+// are considered. The travel from start_near to the first segment is taken into account.
+// An experiment, which is not used by the slicer, as it changes the order of the extrusions.
+static void improve_chain_2opt(const std::vector<ChainSegment> &segments, const Point &start_near, ChainOrder &order)
+{
+    // Maximum number of segments of a reversed sub-chain, bounding the time complexity to O(n * max_reversed).
+    static const size_t max_reversed = 64;
+    static const size_t max_passes   = 8;
+    auto seg_start = [&segments, &order](size_t i) -> const Point& { const ChainSegment &s = segments[order[i].first]; return order[i].second ? s.last : s.first; };
+    auto seg_end   = [&segments, &order](size_t i) -> const Point& { const ChainSegment &s = segments[order[i].first]; return order[i].second ? s.first : s.last; };
+    for (size_t pass = 0; pass < max_passes; ++ pass) {
+        bool improved = false;
+        for (size_t i = 0; i < order.size(); ++ i) {
+            const Point &prev_end = (i == 0) ? start_near : seg_end(i - 1);
+            double       old_in   = chain_distance(prev_end, seg_start(i));
+            for (size_t j = i; j < order.size() && j < i + max_reversed && segments[order[j].first].can_reverse; ++ j) {
+                // Reversing order[i..j] connects prev_end to the end of j and the start of i to the start of j + 1.
+                double gain = old_in - chain_distance(prev_end, seg_end(j));
+                if (j + 1 < order.size())
+                    gain += chain_distance(seg_end(j), seg_start(j + 1)) - chain_distance(seg_start(i), seg_start(j + 1));
+                if (gain > EPSILON) {
+                    std::reverse(order.begin() + i, order.begin() + j + 1);
+                    for (size_t k = i; k <= j; ++ k)
+                        order[k].second = ! order[k].second;
+                    improved = true;
+                    break;
+                }
+            }
+        }
+        if (! improved)
+            break;
+    }
+}
+
+// Length of the travel moves connecting the chained segments, starting at start_near.
+static double chain_travel_length(const std::vector<ChainSegment> &segments, const Point &start_near, const ChainOrder &order)
+{
+    double length = 0.;
+    Point  pt     = start_near;
+    for (const std::pair<size_t, bool> &o : order) {
+        const ChainSegment &s = segments[o.first];
+        length += chain_distance(pt, o.second ? s.last : s.first);
+        pt = o.second ? s.first : s.last;
+    }
+    return length;
+}
+
+static void report(const char *name, double t, const std::vector<ChainSegment> &segments, const ChainOrder &order)
+{
+    std::cout << std::setw(12) << name
+              << ", time: " << std::setprecision(4) << t << " s"
+              << ", travel: " << std::setprecision(6) << unscale<double>(chain_travel_length(segments, Point(0, 0), order)) << " mm" << std::endl;
+}
+
+int main(const int argc, const char *argv[]) {
+    using std::cout; using std::endl;
+
+    if (argc > 1 && (std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help")) {
+        cout << USAGE_STR << endl;
+        return EXIT_SUCCESS;
+    }
+
+    size_t num_segments = (argc > 1) ? size_t(atol(argv[1])) : 100000;
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<coord_t> pos(0, coord_t(scale_(200.)));
+    std::uniform_int_distribution<coord_t> dir(- coord_t(scale_(1.)), coord_t(scale_(1.)));
+    std::vector<ChainSegment> segments;
+    segments.reserve(num_segments);
+    for (size_t i = 0; i < num_segments; ++ i) {
+        Point first(pos(rng), pos(rng));
+        segments.push_back({ first, first + Point(dir(rng), dir(rng)), true });
+    }
+    cout << "Segments: " << num_segments << endl;
+
+    Benchmark bench;
+    ChainOrder order;
+
+    bench.start();
+    order = chain_segments_linear(segments, Point(0, 0));
+    bench.stop();
+    report("linear", bench.getElapsedSec(), segments, order);
+
+    bench.start();
+    order = chain_segments_greedy(segments, Point(0, 0));
+    bench.stop();
+    report("kd-tree", bench.getElapsedSec(), segments, order);
+
+    bench.start();
+    order = chain_segments_greedy(segments, Point(0, 0));
+    improve_chain_2opt(segments, Point(0, 0), order);
+    bench.stop();
+    report("kd-tree+2opt", bench.getElapsedSec(), segments, order);
+
+    return EXIT_SUCCESS;
+}
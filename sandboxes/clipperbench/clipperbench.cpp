@@ -0,0 +1,147 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <functional>
+
+#include <libslic3r/libslic3r.h>
+#include <libslic3r/TriangleMesh.hpp>
+#include <libslic3r/ClipperUtils.hpp>
+#include <libnest2d/tools/benchmark.h>
+
+const std::string USAGE_STR = {
+    "Usage: clipperbench [stlfilename.stl] [layer_height_mm]\n"
+    "Slices the mesh (a sphere with a ring of cylinders around it if no file is given) and times the Clipper "
+    "operations of the slicing pipeline over the layers: The offsets and booleans reading the Slic3r polygons in place "
+    "against the former conversion to ClipperLib::Paths, and the fused operations union_offset() and union_offset_ex() "
+    "against the sequences of operations they replace, checking that the results are the same."
+};
+
+using namespace Slic3r;
+
+// The former implementation of diff() and offset(Polygons), which converted the input to ClipperLib::Paths first.
+static Polygons diff_converted(const Polygons &subject, const Polygons &clip)
+{
+    ClipperLib::Paths input_subject = Slic3rMultiPoints_to_ClipperPaths(subject);
+    ClipperLib::Paths input_clip    = Slic3rMultiPoints_to_ClipperPaths(clip);
+    ClipperLib::Clipper clipper;
+    clipper.AddPaths(input_subject, ClipperLib::ptSubject, true);
+    clipper.AddPaths(input_clip,    ClipperLib::ptClip,    true);
+    ClipperLib::Paths out;
+    clipper.Execute(ClipperLib::ctDifference, out, ClipperLib::pftNonZero, ClipperLib::pftNonZero);
+    return ClipperPaths_to_Slic3rPolygons(out);
+}
+
+static Polygons offset_converted(const Polygons &polygons, const float delta)
+{
+    return ClipperPaths_to_Slic3rPolygons(_offset(Slic3rMultiPoints_to_ClipperPaths(polygons), ClipperLib::etClosedPolygon, delta, ClipperLib::jtMiter, 3.));
+}
+
+static bool same(const Polygons &a, const Polygons &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++ i)
+        if (a[i].points != b[i].points)
+            return false;
+    return true;
+}
+
+int main(const int argc, const char *argv[]) {
+    using std::cout; using std::endl;
+
+    if (argc > 1 && (std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help")) {
+        cout << USAGE_STR << endl;
+        return EXIT_SUCCESS;
+    }
+
+    TriangleMesh mesh;
+    if (argc > 1 && std::string(argv[1]) != "-") {
+        if (! mesh.ReadSTLFile(argv[1])) {
+            std::cerr << "Failed to read " << argv[1] << endl;
+            return EXIT_FAILURE;
+        }
+    } else {
+        mesh = make_sphere(20., PI / 180.);
+        for (int i = 0; i < 12; ++ i) {
+            TriangleMesh cylinder = make_cylinder(4., 30., PI / 90.);
+            cylinder.translate(float(22. * cos(i * PI / 6.)), float(22. * sin(i * PI / 6.)), -15.f + float(i));
+            mesh.merge(cylinder);
+        }
+    }
+    mesh.repair();
+    mesh.align_to_origin();
+    mesh.require_shared_vertices();
+
+    float layer_height = (argc > 2) ? float(atof(argv[2])) : 0.2f;
+    std::vector<float> z;
+    for (float zz = 0.5f * layer_height; zz < float(mesh.stl.stats.max(2)); zz += layer_height)
+        z.emplace_back(zz);
+
+    std::vector<ExPolygons> layers;
+    TriangleMeshSlicer(&mesh).slice(z, 0.049f, &layers, [](){});
+    std::vector<Polygons> layers_polygons;
+    size_t points = 0;
+    for (const ExPolygons &layer : layers) {
+        layers_polygons.emplace_back(to_polygons(layer));
+        for (const Polygon &polygon : layers_polygons.back())
+            points += polygon.points.size();
+    }
+    cout << "Layers: " << layers.size() << ", points: " << points << endl;
+
+    const float width = float(scale_(0.45));
+    Benchmark bench;
+    bool ok = true;
+
+    // Runs both variants over all the layers, reports the times and checks that the results are the same.
+    auto compare = [&bench, &ok, &layers](const char *name, 
+        const std::function<Polygons(size_t)> &former, const std::function<Polygons(size_t)> &current)
+    {
+        std::vector<Polygons> out_former, out_current;
+        bench.start();
+        for (size_t i = 1; i < layers.size(); ++ i)
+            out_former.emplace_back(former(i));
+        bench.stop();
+        double t_former = bench.getElapsedSec();
+        bench.start();
+        for (size_t i = 1; i < layers.size(); ++ i)
+            out_current.emplace_back(current(i));
+        bench.stop();
+        double t_current = bench.getElapsedSec();
+        size_t mismatches = 0;
+        for (size_t i = 0; i < out_former.size(); ++ i)
+            if (! same(out_former[i], out_current[i]))
+                ++ mismatches;
+        ok &= mismatches == 0;
+        cout << std::left << std::setw(20) << name << std::right << std::setprecision(4)
+             << " former: " << std::setw(8) << t_former * 1000. << " ms"
+             << ", current: " << std::setw(8) << t_current * 1000. << " ms"
+             << ", mismatching layers: " << mismatches << endl;
+    };
+
+    compare("diff",
+        [&](size_t i) { return diff_converted(layers_polygons[i], layers_polygons[i - 1]); },
+        [&](size_t i) { return diff(layers_polygons[i], layers_polygons[i - 1]); });
+    compare("offset",
+        [&](size_t i) { return offset_converted(layers_polygons[i], - width); },
+        [&](size_t i) { return offset(layers_polygons[i], - width); });
+    compare("diff_ex(ExPolygons)",
+        [&](size_t i) { return to_polygons(diff_ex(layers_polygons[i], layers_polygons[i - 1])); },
+        [&](size_t i) { return to_polygons(diff_ex(layers[i], layers[i - 1])); });
+    compare("union_offset",
+        [&](size_t i) { Polygons pp = layers_polygons[i]; append(pp, layers_polygons[i - 1]); return offset(union_ex(pp), width); },
+        [&](size_t i) { Polygons pp = layers_polygons[i]; append(pp, layers_polygons[i - 1]); return union_offset(pp, width); });
+    compare("union_offset_ex",
+        [&](size_t i) { Polygons pp = layers_polygons[i]; append(pp, layers_polygons[i - 1]); return to_polygons(offset_ex(union_ex(pp), - width)); },
+        [&](size_t i) { Polygons pp = layers_polygons[i]; append(pp, layers_polygons[i - 1]); return to_polygons(union_offset_ex(pp, - width)); });
+
+    // offset2_ex(ExPolygons) keeps its intermediate results in the Clipper form, it is timed on its own.
+    bench.start();
+    size_t offset2_cnt = 0;
+    for (const ExPolygons &layer : layers)
+        offset2_cnt += offset2_ex(layer, - width, width).size();
+    bench.stop();
+    cout << std::left << std::setw(20) << "offset2_ex" << std::right << std::setprecision(4)
+         << " current: " << bench.getElapsedSec() * 1000. << " ms, " << offset2_cnt << " expolygons" << endl;
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,58 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+
+#include <tbb/task_scheduler_init.h>
+
+#include <libslic3r/libslic3r.h>
+#include <libslic3r/TriangleMesh.hpp>
+#include <libnest2d/tools/benchmark.h>
+
+const std::string USAGE_STR = {
+    "Usage: connectbench [stlfilename.stl | angle_step_deg]\n"
+    "Builds the facet connectivity of the mesh (a sphere tesselated with the given angular step, 0.15 degree by default, "
+    "which is about 5.8M facets) with an increasing number of threads and reports the throughput in facets per second."
+};
+
+int main(const int argc, const char *argv[]) {
+    using namespace Slic3r;
+    using std::cout; using std::endl;
+
+    if (argc > 1 && (std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help")) {
+        cout << USAGE_STR << endl;
+        return EXIT_SUCCESS;
+    }
+
+    TriangleMesh mesh;
+    std::string arg = (argc > 1) ? argv[1] : "";
+    if (arg.size() > 4 && arg.substr(arg.size() - 4) == ".stl") {
+        if (! mesh.ReadSTLFile(arg.c_str())) {
+            std::cerr << "Failed to read " << arg << endl;
+            return EXIT_FAILURE;
+        }
+    } else
+        mesh = make_sphere(50., PI / 180. * (arg.empty() ? 0.15 : atof(arg.c_str())));
+
+    cout << "Facets: " << mesh.facets_count() << endl;
+
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int threads = 1;; threads = std::min(threads * 2, max_threads)) {
+        tbb::task_scheduler_init scheduler((int)threads);
+        Benchmark bench;
+
+        bench.start();
+        stl_check_facets_exact(&mesh.stl);
+        bench.stop();
+
+        double t = bench.getElapsedSec();
+        cout << "Threads: " << std::setw(3) << threads 
+             << ", time: " << std::setprecision(4) << t << " s"
+             << ", facets/s: " << std::setprecision(6) << double(mesh.facets_count()) / t
+             << ", connected edges: " << mesh.stl.stats.connected_edges << endl;
+        if (threads == max_threads)
+            break;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/filesystem.hpp>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <libslic3r/libslic3r.h>
+#include <libslic3r/Model.hpp>
+#include <libslic3r/PrintConfig.hpp>
+#include <libslic3r/TriangleMesh.hpp>
+#include <libslic3r/Format/3mf.hpp>
+#include <libslic3r/Format/AMF.hpp>
+#include <libnest2d/tools/benchmark.h>
+
+const std::string USAGE_STR = {
+    "Usage: loadbench [file.3mf | file.amf]...\n"
+    "Loads each of the given 3MF and AMF archives (a sphere of about 2M facets saved as 3MF and as AMF into "
+    "the temporary directory if no file is given) and reports the load time, the number of facets and the peak "
+    "memory of the load. On Linux the peak is reset before each load, elsewhere it is the peak of the process."
+};
+
+using namespace Slic3r;
+
+// Peak resident memory of the process in bytes, 0 if unknown.
+static size_t peak_memory()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc;
+    return GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)) ? size_t(pmc.PeakWorkingSetSize) : 0;
+#elif defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);)
+        if (boost::starts_with(line, "VmHWM:"))
+            return size_t(std::stoull(line.substr(6))) * 1024;
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return size_t(usage.ru_maxrss);
+#else
+    return size_t(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+static void reset_peak_memory()
+{
+#ifdef __linux__
+    // Resets VmHWM to the current resident size (Linux 4.0 and newer).
+    std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+static bool load(const std::string &path, Model &model)
+{
+    DynamicPrintConfig config;
+    return boost::iends_with(path, ".3mf") ? load_3mf(path.c_str(), &config, &model) :
+                                              load_amf(path.c_str(), &config, &model);
+}
+
+int main(const int argc, const char *argv[]) {
+    using std::cout; using std::endl;
+
+    if (argc > 1 && (std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help")) {
+        cout << USAGE_STR << endl;
+        return EXIT_SUCCESS;
+    }
+
+    std::vector<std::string> paths(argv + 1, argv + argc);
+    std::vector<std::string> temporaries;
+    if (paths.empty()) {
+        Model model;
+        ModelObject *object = model.add_object();
+        TriangleMesh mesh = make_sphere(50., PI / 700.);
+        mesh.repair();
+        object->add_volume(mesh);
+        object->add_instance();
+
+        boost::filesystem::path tmp = boost::filesystem::temp_directory_path() /
+                                      boost::filesystem::unique_path("loadbench-%%%%-%%%%");
+        temporaries = { tmp.string() + ".3mf", tmp.string() + ".zip.amf" };
+        if (! store_3mf(temporaries[0].c_str(), &model, nullptr) || ! store_amf(temporaries[1].c_str(), &model, nullptr)) {
+            std::cerr << "Failed to save the test model into " << tmp.parent_path().string() << endl;
+            return EXIT_FAILURE;
+        }
+        paths = temporaries;
+    }
+
+    bool ok = true;
+    Benchmark bench;
+    for (const std::string &path : paths) {
+        Model model;
+        reset_peak_memory();
+        size_t memory_before = peak_memory();
+        bench.start();
+        bool loaded = load(path, model);
+        bench.stop();
+        size_t memory_peak = peak_memory();
+        if (! loaded) {
+            std::cerr << "Failed to load " << path << endl;
+            ok = false;
+            continue;
+        }
+
+        size_t facets = 0;
+        for (const ModelObject *object : model.objects)
+            for (const ModelVolume *volume : object->volumes)
+                facets += volume->mesh().stl.stats.number_of_facets;
+
+        cout << path << ": " << boost::filesystem::file_size(path) / 1024 << " kB, " << facets << " facets, load "
+             << std::setprecision(4) << bench.getElapsedSec() << " s, peak memory " << memory_peak / (1024 * 1024)
+             << " MB (" << memory_before / (1024 * 1024) << " MB at the start)" << endl;
+    }
+
+    for (const std::string &path : temporaries)
+        boost::filesystem::remove(path);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
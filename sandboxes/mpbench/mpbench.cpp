@@ -0,0 +1,108 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+
+#include <libslic3r/libslic3r.h>
+#include <libslic3r/MotionPlanner.hpp>
+#include <libnest2d/tools/benchmark.h>
+
+const std::string USAGE_STR = {
+    "Usage: mpbench [grid_size [vertices_per_side]]\n"
+    "Scaled up geometry of t/avoid_crossing_perimeters.t: A grid of grid_size x grid_size (4 by default) 20mm squares "
+    "with a square hole, the sides of the squares being zig-zag lines of vertices_per_side (500 by default) vertices. "
+    "Plans travel moves around the holes and between the squares, and reports the time spent building the motion planner "
+    "graphs and the throughput of the point in island test of the graph construction compared to ExPolygon::contains_b()."
+};
+
+using namespace Slic3r;
+
+static Polygon zigzag_square(coordf_t x0, coordf_t y0, coordf_t size, size_t vertices_per_side, bool ccw)
+{
+    Polygon out;
+    const Vec2d corners[4] = { Vec2d(x0, y0), Vec2d(x0 + size, y0), Vec2d(x0 + size, y0 + size), Vec2d(x0, y0 + size) };
+    for (size_t side = 0; side < 4; ++ side) {
+        const Vec2d &a = corners[side];
+        const Vec2d &b = corners[(side + 1) % 4];
+        Vec2d normal = Vec2d(b.y() - a.y(), a.x() - b.x()).normalized();
+        for (size_t i = 0; i < vertices_per_side; ++ i) {
+            Vec2d p = a + (b - a) * (double(i) / double(vertices_per_side)) + normal * ((i & 1) ? 0.05 : 0.);
+            out.points.emplace_back(Point::new_scale(p.x(), p.y()));
+        }
+    }
+    if (! ccw)
+        out.reverse();
+    return out;
+}
+
+int main(const int argc, const char *argv[]) {
+    using std::cout; using std::endl;
+
+    if (argc > 1 && (std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help")) {
+        cout << USAGE_STR << endl;
+        return EXIT_SUCCESS;
+    }
+
+    size_t grid_size         = (argc > 1) ? size_t(atoi(argv[1])) : 4;
+    size_t vertices_per_side = (argc > 2) ? size_t(atoi(argv[2])) : 500;
+
+    ExPolygons islands;
+    for (size_t row = 0; row < grid_size; ++ row)
+        for (size_t col = 0; col < grid_size; ++ col) {
+            ExPolygon island;
+            island.contour = zigzag_square(30. * col, 30. * row, 20., vertices_per_side, true);
+            island.holes.emplace_back(zigzag_square(30. * col + 5., 30. * row + 5., 10., vertices_per_side / 2, false));
+            islands.emplace_back(std::move(island));
+        }
+    cout << "Islands: " << islands.size() << ", vertices per island: " << 6 * vertices_per_side << endl;
+
+    // Travel around the hole of each island, then travel between the islands.
+    std::vector<std::pair<Point, Point>> travels;
+    for (size_t row = 0; row < grid_size; ++ row)
+        for (size_t col = 0; col < grid_size; ++ col)
+            travels.emplace_back(Point::new_scale(30. * col + 2.5, 30. * row + 2.5), Point::new_scale(30. * col + 17.5, 30. * row + 17.5));
+    for (size_t i = 0; i + 1 < grid_size * grid_size; ++ i)
+        travels.emplace_back(Point(travels[i].second), Point(travels[i + 1].first));
+
+    Benchmark bench;
+    MotionPlanner mp(islands);
+    double length = 0.;
+    bench.start();
+    for (const std::pair<Point, Point> &travel : travels)
+        length += mp.shortest_path(travel.first, travel.second).length();
+    bench.stop();
+    cout << "Travels: " << travels.size() << ", length: " << unscale<double>(length) << " mm" << endl;
+    cout << "Planning including the graph construction: " << std::setprecision(4) << bench.getElapsedSec() << " s" << endl;
+
+    bench.start();
+    for (const std::pair<Point, Point> &travel : travels)
+        mp.shortest_path(travel.first, travel.second);
+    bench.stop();
+    cout << "Planning with the graphs constructed: " << std::setprecision(4) << bench.getElapsedSec() << " s" << endl;
+
+    // The point in island test, which filters the Voronoi vertices during the graph construction.
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<coord_t> pos(coord_t(scale_(-1.)), coord_t(scale_(21.)));
+    Points points;
+    for (size_t i = 0; i < 100000; ++ i)
+        points.emplace_back(pos(rng), pos(rng));
+    MotionPlannerIslandIndex index;
+    index.create(islands.front());
+    size_t inside_index = 0, inside_expolygon = 0;
+    bench.start();
+    for (const Point &pt : points)
+        inside_index += index.contains_b(pt);
+    bench.stop();
+    double t_index = bench.getElapsedSec();
+    bench.start();
+    for (const Point &pt : points)
+        inside_expolygon += islands.front().contains_b(pt);
+    bench.stop();
+    double t_expolygon = bench.getElapsedSec();
+    cout << "Point in island tests: " << points.size()
+         << ", MotionPlannerIslandIndex: " << std::setprecision(4) << t_index << " s"
+         << ", ExPolygon::contains_b(): " << t_expolygon << " s"
+         << ", results " << ((inside_index == inside_expolygon) ? "match" : "DIFFER") << endl;
+
+    return (inside_index == inside_expolygon) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
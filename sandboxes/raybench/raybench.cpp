@@ -0,0 +1,139 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+
+#include <libslic3r/libslic3r.h>
+#include <libslic3r/TriangleMesh.hpp>
+#include <libslic3r/SLA/SLACommon.hpp>
+#include <libslic3r/SLA/SLASupportTree.hpp>
+#include <libnest2d/tools/benchmark.h>
+
+#include <igl/AABB.h>
+
+const std::string USAGE_STR = {
+    "Usage: raybench [stlfilename.stl] [num_packets]\n"
+    "Casts num_packets (20000 by default) packets of 8 rays onto the mesh (a sphere of about 500k facets with a cube "
+    "sticking out of it if no file is given), the rays of a packet starting on a small circle and sharing a direction "
+    "like the rays of the pinhead and bridge collision tests of the SLA support tree. Reports the runtime of the former "
+    "igl::AABB ray casting, of EigenMesh3D::query_ray_hit() and of the batched EigenMesh3D::query_ray_hits(), "
+    "and checks that the hits match. Then generates the support tree for up to 500 support points on the facets facing "
+    "downwards and reports its runtime."
+};
+
+using namespace Slic3r;
+
+int main(const int argc, const char *argv[]) {
+    using std::cout; using std::endl;
+
+    if (argc > 1 && (std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help")) {
+        cout << USAGE_STR << endl;
+        return EXIT_SUCCESS;
+    }
+
+    TriangleMesh mesh;
+    if (argc > 1 && std::string(argv[1]) != "-") {
+        if (! mesh.ReadSTLFile(argv[1])) {
+            std::cerr << "Failed to read " << argv[1] << endl;
+            return EXIT_FAILURE;
+        }
+    } else {
+        mesh = make_sphere(20., PI / 360.);
+        TriangleMesh cube = make_cube(30., 10., 10.);
+        cube.translate(-5.f, -5.f, -5.f);
+        mesh.merge(cube);
+    }
+    mesh.repair();
+    size_t num_packets = (argc > 2) ? size_t(atol(argv[2])) : 20000;
+
+    Benchmark bench;
+    bench.start();
+    sla::EigenMesh3D emesh(mesh);
+    bench.stop();
+    cout << "Facets: " << emesh.F().rows() << ", EigenMesh3D construction: " << std::setprecision(4) << bench.getElapsedSec() << " s" << endl;
+
+    bench.start();
+    igl::AABB<Eigen::MatrixXd, 3> aabb;
+    aabb.init(emesh.V(), emesh.F());
+    bench.stop();
+    cout << "igl::AABB construction: " << std::setprecision(4) << bench.getElapsedSec() << " s" << endl;
+
+    // Packets of rays starting on a circle around a random point of the bounding box.
+    BoundingBoxf3 bb = mesh.bounding_box();
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> ux(bb.min(0), bb.max(0)), uy(bb.min(1), bb.max(1)), uz(bb.min(2), bb.max(2));
+    std::normal_distribution<double> normal;
+    const size_t packet_size = 8;
+    std::vector<Vec3d> sources, dirs;
+    for (size_t i = 0; i < num_packets; ++ i) {
+        Vec3d c(ux(rng), uy(rng), uz(rng));
+        Vec3d d = Vec3d(normal(rng), normal(rng), normal(rng)).normalized();
+        Vec3d a = d.cross(std::abs(d(0)) < 0.9 ? Vec3d(1., 0., 0.) : Vec3d(0., 1., 0.)).normalized();
+        Vec3d b = d.cross(a);
+        for (size_t k = 0; k < packet_size; ++ k) {
+            double phi = 2. * PI * double(k) / double(packet_size);
+            sources.emplace_back(c + 0.5 * (std::cos(phi) * a + std::sin(phi) * b));
+            dirs.emplace_back(d);
+        }
+    }
+    size_t num_rays = sources.size();
+    cout << "Rays: " << num_rays << endl;
+
+    std::vector<double> t_igl(num_rays), t_single(num_rays);
+    bench.start();
+    for (size_t i = 0; i < num_rays; ++ i) {
+        igl::Hit hit;
+        hit.t = std::numeric_limits<float>::infinity();
+        aabb.intersect_ray(emesh.V(), emesh.F(), sources[i].transpose(), dirs[i].transpose(), hit);
+        t_igl[i] = double(hit.t);
+    }
+    bench.stop();
+    double time_igl = bench.getElapsedSec();
+
+    bench.start();
+    for (size_t i = 0; i < num_rays; ++ i)
+        t_single[i] = emesh.query_ray_hit(sources[i], dirs[i]).distance();
+    bench.stop();
+    double time_single = bench.getElapsedSec();
+
+    std::vector<sla::EigenMesh3D::hit_result> hits(num_rays);
+    bench.start();
+    emesh.query_ray_hits(num_rays, sources.data(), dirs.data(), hits.data());
+    bench.stop();
+    double time_batch = bench.getElapsedSec();
+
+    // igl stores the hit distance as a float.
+    size_t mismatches = 0;
+    for (size_t i = 0; i < num_rays; ++ i) {
+        double t = hits[i].distance();
+        bool   same = (std::isinf(t) && std::isinf(t_igl[i])) || std::abs(t - t_igl[i]) <= 1e-5 * std::max(1., t);
+        if (! same || t != t_single[i])
+            ++ mismatches;
+    }
+
+    cout << std::setprecision(4)
+         << "igl::AABB: " << time_igl << " s, "
+         << "query_ray_hit(): " << time_single << " s, "
+         << "query_ray_hits(): " << time_batch << " s" << endl;
+    cout << "Mismatching hits: " << mismatches << endl;
+
+    // The whole support tree generation, which casts its rays in batches of 8.
+    std::vector<sla::SupportPoint> support_points;
+    const std::vector<stl_triangle_vertex_indices> &indices = mesh.its.indices;
+    size_t step = std::max<size_t>(1, indices.size() / 2000);
+    for (size_t i = 0; i < indices.size() && support_points.size() < 500; i += step) {
+        const stl_triangle_vertex_indices &f = indices[i];
+        Vec3f a = mesh.its.vertices[f(0)], b = mesh.its.vertices[f(1)], c = mesh.its.vertices[f(2)];
+        if ((b - a).cross(c - a).normalized()(2) < -0.5f) {
+            Vec3f p = (a + b + c) / 3.f;
+            support_points.emplace_back(p(0), p(1), p(2), 0.4f, false);
+        }
+    }
+    bench.start();
+    sla::SLASupportTree tree(support_points, emesh);
+    bench.stop();
+    cout << "Support points: " << support_points.size() << ", support tree generation: " << std::setprecision(4)
+         << bench.getElapsedSec() << " s, " << tree.merged_mesh().its.indices.size() << " facets" << endl;
+
+    return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
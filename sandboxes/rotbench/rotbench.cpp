@@ -0,0 +1,119 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+
+#include <libslic3r/libslic3r.h>
+#include <libslic3r/Model.hpp>
+#include <libslic3r/TriangleMesh.hpp>
+#include <libslic3r/SLA/SLARotfinder.hpp>
+#include <libnest2d/tools/benchmark.h>
+
+const std::string USAGE_STR = {
+    "Usage: rotbench [stlfilename.stl] [accuracy]\n"
+    "Evaluates the score of sla::find_best_rotation() for 200 random rotations of the mesh (a sphere of about 500k facets "
+    "with a cube sticking out of it if no file is given) by the former loop over the facets and by sla::RotationScore, "
+    "reporting the evaluations per second and checking that the scores match. Then runs sla::find_best_rotation() twice "
+    "with the given accuracy (0.005 by default, as the \"Optimize orientation\" command) and checks that the results "
+    "are the same."
+};
+
+using namespace Slic3r;
+
+// The objective of sla::find_best_rotation() before the normal table.
+static double facet_score(const TriangleMesh &mesh, double rx, double ry, double rz)
+{
+    Transform3d rt = Transform3d::Identity();
+    rt.rotate(Eigen::AngleAxisd(rz, Vec3d::UnitZ()));
+    rt.rotate(Eigen::AngleAxisd(ry, Vec3d::UnitY()));
+    rt.rotate(Eigen::AngleAxisd(rx, Vec3d::UnitX()));
+
+    double score = 0;
+    for (const stl_facet &facet : mesh.stl.facet_start) {
+        Vec3d p1 = facet.vertex[0].cast<double>();
+        Vec3d p2 = facet.vertex[1].cast<double>();
+        Vec3d p3 = facet.vertex[2].cast<double>();
+        Vec3d n  = rt * Vec3d((p2 - p1).cross(p3 - p1).normalized());
+        score += std::abs(n.dot(Vec3d::UnitX())) + std::abs(n.dot(Vec3d::UnitY())) + std::abs(n.dot(Vec3d::UnitZ()));
+    }
+    return score;
+}
+
+int main(const int argc, const char *argv[]) {
+    using std::cout; using std::endl;
+
+    if (argc > 1 && (std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help")) {
+        cout << USAGE_STR << endl;
+        return EXIT_SUCCESS;
+    }
+
+    TriangleMesh mesh;
+    if (argc > 1 && std::string(argv[1]) != "-") {
+        if (! mesh.ReadSTLFile(argv[1])) {
+            std::cerr << "Failed to read " << argv[1] << endl;
+            return EXIT_FAILURE;
+        }
+    } else {
+        mesh = make_sphere(20., PI / 360.);
+        TriangleMesh cube = make_cube(30., 10., 10.);
+        cube.translate(-5.f, -5.f, -5.f);
+        mesh.merge(cube);
+    }
+    mesh.repair();
+    float accuracy = (argc > 2) ? float(atof(argv[2])) : 0.005f;
+
+    Benchmark bench;
+    bench.start();
+    sla::RotationScore score(mesh);
+    bench.stop();
+    cout << "Facets: " << mesh.stl.stats.number_of_facets << ", distinct normals: " << score.size()
+         << ", normal table construction: " << std::setprecision(4) << bench.getElapsedSec() << " s" << endl;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> angle(-PI / 2, PI / 2);
+    std::vector<Vec3d> rotations;
+    for (size_t i = 0; i < 200; ++ i)
+        rotations.emplace_back(angle(rng), angle(rng), angle(rng));
+
+    std::vector<double> scores_facets, scores_table;
+    bench.start();
+    for (const Vec3d &r : rotations)
+        scores_facets.emplace_back(facet_score(mesh, r(0), r(1), r(2)));
+    bench.stop();
+    double time_facets = bench.getElapsedSec();
+
+    bench.start();
+    for (const Vec3d &r : rotations)
+        scores_table.emplace_back(score(r(0), r(1), r(2)));
+    bench.stop();
+    double time_table = bench.getElapsedSec();
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < rotations.size(); ++ i)
+        if (std::abs(scores_facets[i] - scores_table[i]) > 1e-9 * scores_facets[i])
+            ++ mismatches;
+
+    cout << std::setprecision(4)
+         << "Evaluations/s, loop over the facets: " << double(rotations.size()) / time_facets
+         << ", normal table: " << double(rotations.size()) / time_table << endl;
+    cout << "Mismatching scores: " << mismatches << endl;
+
+    Model model;
+    ModelObject *object = model.add_object();
+    object->add_volume(mesh);
+    object->add_instance();
+
+    std::array<std::array<double, 3>, 2> results;
+    for (size_t i = 0; i < results.size(); ++ i) {
+        bench.start();
+        results[i] = sla::find_best_rotation(*object, accuracy);
+        bench.stop();
+        const std::array<double, 3> &r = results[i];
+        cout << "find_best_rotation(): " << std::setprecision(4) << bench.getElapsedSec() << " s, rotation "
+             << r[0] << " " << r[1] << " " << r[2] << ", score " << score(r[0], r[1], r[2]) << endl;
+    }
+    bool deterministic = results[0] == results[1];
+    cout << "Results " << (deterministic ? "match" : "DIFFER") << endl;
+
+    return (mismatches == 0 && deterministic) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
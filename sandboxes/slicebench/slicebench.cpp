@@ -0,0 +1,66 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+
+#include <tbb/task_scheduler_init.h>
+
+#include <libslic3r/libslic3r.h>
+#include <libslic3r/TriangleMesh.hpp>
+#include <libnest2d/tools/benchmark.h>
+
+const std::string USAGE_STR = {
+    "Usage: slicebench [stlfilename.stl] [layer_height_mm]\n"
+    "Slices the mesh (a sphere of about 2M facets if no file is given) with an increasing number of threads "
+    "and reports the slicing throughput in facets per second."
+};
+
+int main(const int argc, const char *argv[]) {
+    using namespace Slic3r;
+    using std::cout; using std::endl;
+
+    if (argc > 1 && (std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help")) {
+        cout << USAGE_STR << endl;
+        return EXIT_SUCCESS;
+    }
+
+    TriangleMesh mesh;
+    if (argc > 1) {
+        if (! mesh.ReadSTLFile(argv[1])) {
+            std::cerr << "Failed to read " << argv[1] << endl;
+            return EXIT_FAILURE;
+        }
+    } else
+        mesh = make_sphere(50., PI / 720.);
+    mesh.repair();
+    mesh.align_to_origin();
+    mesh.require_shared_vertices();
+
+    float layer_height = (argc > 2) ? float(atof(argv[2])) : 0.05f;
+    std::vector<float> z;
+    for (float zz = 0.5f * layer_height; zz < float(mesh.stl.stats.max(2)); zz += layer_height)
+        z.emplace_back(zz);
+
+    cout << "Facets: " << mesh.facets_count() << ", layers: " << z.size() << endl;
+
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int threads = 1;; threads = std::min(threads * 2, max_threads)) {
+        tbb::task_scheduler_init scheduler((int)threads);
+        Benchmark bench;
+
+        bench.start();
+        TriangleMeshSlicer slicer(&mesh);
+        std::vector<ExPolygons> layers;
+        slicer.slice(z, 0.049f, &layers, [](){});
+        bench.stop();
+
+        double t = bench.getElapsedSec();
+        cout << "Threads: " << std::setw(3) << threads 
+             << ", time: " << std::setprecision(4) << t << " s"
+             << ", facets/s: " << std::setprecision(6) << double(mesh.facets_count()) / t << endl;
+        if (threads == max_threads)
+            break;
+    }
+
+    return EXIT_SUCCESS;
+}
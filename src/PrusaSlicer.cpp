@@ -34,7 +34,9 @@
 #include "libslic3r/Geometry.hpp"
 #include "libslic3r/Model.hpp"
 #include "libslic3r/Print.hpp"
+#include "libslic3r/Profiler.hpp"
 #include "libslic3r/SLAPrint.hpp"
+#include "libslic3r/SliceCache.hpp"
 #include "libslic3r/TriangleMesh.hpp"
 #include "libslic3r/Format/AMF.hpp"
 #include "libslic3r/Format/3mf.hpp"
@@ -62,6 +64,13 @@ int CLI::run(int argc, char **argv)
 	if (! this->setup(argc, argv))
 		return 1;
 
+    // Write out the profile on any exit path of the command line slicer or of the GUI.
+    ScopeGuard write_profile([this]() {
+        const std::string &path = m_config.opt_string("profile");
+        if (! path.empty() && ! Profiler::write(path))
+            boost::nowide::cerr << "Failed to write the profile into " << path << std::endl;
+    });
+
     m_extra_config.apply(m_config, true);
     m_extra_config.normalize();
 
@@ -369,6 +378,8 @@ int CLI::run(int argc, char **argv)
                 std::string outfile = m_config.opt_string("output");
                 Print       fff_print;
                 SLAPrint    sla_print;
+                // No region of the print is changed after it has been processed.
+                fff_print.set_region_invalidation(false);
 
                 sla_print.set_status_callback(
                             [](const PrintBase::SlicingStatus& s)
@@ -564,6 +575,10 @@ bool CLI::setup(int argc, char **argv)
             m_config.optptr(optdef.first, true);
 
 	set_data_dir(m_config.opt_string("datadir"));
+	SliceCache::instance().set_directory(m_config.opt_string("slice_cache_dir"));
+	SliceCache::instance().set_disk_limit(size_t(std::max(0, m_config.opt_int("slice_cache_dir_size"))) * 1024 * 1024);
+	SliceCache::instance().set_memory_limit(size_t(std::max(0, m_config.opt_int("slice_cache_memory"))) * 1024 * 1024);
+	Profiler::enable(! m_config.opt_string("profile").empty());
 
 	return true;
 }
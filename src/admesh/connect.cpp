@@ -34,6 +34,8 @@
 #define BOOST_POOL_NO_MT
 #include <boost/pool/object_pool.hpp>
 
+#include <tbb/parallel_sort.h>
+
 #include "stl.h"
 
 struct HashEdge {
@@ -120,6 +122,40 @@ private:
 	}
 };
 
+static void record_neighbors(stl_file *stl, const HashEdge &edge_a, const HashEdge &edge_b)
+{
+	// Facet a's neighbor is facet b
+	stl->neighbors_start[edge_a.facet_number].neighbor[edge_a.which_edge % 3] = edge_b.facet_number;	/* sets the .neighbor part */
+	stl->neighbors_start[edge_a.facet_number].which_vertex_not[edge_a.which_edge % 3] = (edge_b.which_edge + 2) % 3; /* sets the .which_vertex_not part */
+
+	// Facet b's neighbor is facet a
+	stl->neighbors_start[edge_b.facet_number].neighbor[edge_b.which_edge % 3] = edge_a.facet_number;	/* sets the .neighbor part */
+	stl->neighbors_start[edge_b.facet_number].which_vertex_not[edge_b.which_edge % 3] = (edge_a.which_edge + 2) % 3; /* sets the .which_vertex_not part */
+
+	if (((edge_a.which_edge < 3) && (edge_b.which_edge < 3)) || ((edge_a.which_edge > 2) && (edge_b.which_edge > 2))) {
+		// These facets are oriented in opposite directions, their normals are probably messed up.
+		stl->neighbors_start[edge_a.facet_number].which_vertex_not[edge_a.which_edge % 3] += 3;
+		stl->neighbors_start[edge_b.facet_number].which_vertex_not[edge_b.which_edge % 3] += 3;
+	}
+
+	// Count successful connects:
+	// Total connects:
+	stl->stats.connected_edges += 2;
+	// Count individual connects:
+	switch (stl->neighbors_start[edge_a.facet_number].num_neighbors()) {
+	case 1:	++ stl->stats.connected_facets_1_edge; break;
+	case 2: ++ stl->stats.connected_facets_2_edge; break;
+	case 3: ++ stl->stats.connected_facets_3_edge; break;
+	default: assert(false);
+	}
+	switch (stl->neighbors_start[edge_b.facet_number].num_neighbors()) {
+	case 1:	++ stl->stats.connected_facets_1_edge; break;
+	case 2: ++ stl->stats.connected_facets_2_edge; break;
+	case 3: ++ stl->stats.connected_facets_3_edge; break;
+	default: assert(false);
+	}
+}
+
 struct HashTableEdges {
 	HashTableEdges(size_t number_of_faces) {
 		this->M = (int)hash_size_from_nr_faces(number_of_faces);
@@ -239,40 +275,6 @@ private:
 	    return edge_a.facet_number != edge_b.facet_number && edge_a == edge_b;
 	}
 
-	static void record_neighbors(stl_file *stl, const HashEdge &edge_a, const HashEdge &edge_b)
-	{
-		// Facet a's neighbor is facet b
-		stl->neighbors_start[edge_a.facet_number].neighbor[edge_a.which_edge % 3] = edge_b.facet_number;	/* sets the .neighbor part */
-		stl->neighbors_start[edge_a.facet_number].which_vertex_not[edge_a.which_edge % 3] = (edge_b.which_edge + 2) % 3; /* sets the .which_vertex_not part */
-
-		// Facet b's neighbor is facet a
-		stl->neighbors_start[edge_b.facet_number].neighbor[edge_b.which_edge % 3] = edge_a.facet_number;	/* sets the .neighbor part */
-		stl->neighbors_start[edge_b.facet_number].which_vertex_not[edge_b.which_edge % 3] = (edge_a.which_edge + 2) % 3; /* sets the .which_vertex_not part */
-
-		if (((edge_a.which_edge < 3) && (edge_b.which_edge < 3)) || ((edge_a.which_edge > 2) && (edge_b.which_edge > 2))) {
-			// These facets are oriented in opposite directions, their normals are probably messed up.
-			stl->neighbors_start[edge_a.facet_number].which_vertex_not[edge_a.which_edge % 3] += 3;
-			stl->neighbors_start[edge_b.facet_number].which_vertex_not[edge_b.which_edge % 3] += 3;
-		}
-
-		// Count successful connects:
-		// Total connects:
-		stl->stats.connected_edges += 2;
-		// Count individual connects:
-		switch (stl->neighbors_start[edge_a.facet_number].num_neighbors()) {
-		case 1:	++ stl->stats.connected_facets_1_edge; break;
-		case 2: ++ stl->stats.connected_facets_2_edge; break;
-		case 3: ++ stl->stats.connected_facets_3_edge; break;
-		default: assert(false);
-		}
-		switch (stl->neighbors_start[edge_b.facet_number].num_neighbors()) {
-		case 1:	++ stl->stats.connected_facets_1_edge; break;
-		case 2: ++ stl->stats.connected_facets_2_edge; break;
-		case 3: ++ stl->stats.connected_facets_3_edge; break;
-		default: assert(false);
-		}
-	}
-
 	static void match_neighbors_nearby(stl_file *stl, const HashEdge &edge_a, const HashEdge &edge_b)
 	{
 		record_neighbors(stl, edge_a, edge_b);
@@ -451,23 +453,57 @@ void stl_check_facets_exact(stl_file *stl)
 		  	++ i;
   	}
 
-  	// Initialize hash table.
-  	HashTableEdges hash_table(stl->stats.number_of_facets);
 	for (auto &neighbor : stl->neighbors_start)
 		neighbor.reset();
 
-  	// Connect neighbor edges.
+	// Collect the edges of all facets with their keys.
+	std::vector<HashEdge> edges(size_t(stl->stats.number_of_facets) * 3);
 	for (uint32_t i = 0; i < stl->stats.number_of_facets; ++ i) {
 		const stl_facet &facet = stl->facet_start[i];
 		for (int j = 0; j < 3; ++ j) {
-			HashEdge edge;
+			HashEdge &edge = edges[size_t(i) * 3 + j];
 			edge.facet_number = i;
 			edge.which_edge = j;
+			edge.next = nullptr;
 			edge.load_exact(stl, &facet.vertex[j], &facet.vertex[(j + 1) % 3]);
-			hash_table.insert_edge_exact(stl, edge);
 		}
 	}
 
+	// Sort the edges by their keys, so that the equal edges become adjacent. The edges with equal keys are ordered by the index
+	// of the edge in the mesh, which is the order in which the edges used to be inserted into the chained hash table.
+	tbb::parallel_sort(edges.begin(), edges.end(), [](const HashEdge &edge_a, const HashEdge &edge_b) {
+		int cmp = memcmp(edge_a.key, edge_b.key, sizeof(edge_a.key));
+		return (cmp != 0) ? (cmp < 0) :
+			((edge_a.facet_number != edge_b.facet_number) ? (edge_a.facet_number < edge_b.facet_number) : (edge_a.which_edge % 3 < edge_b.which_edge % 3));
+	});
+
+	// Connect neighbor edges. Each edge is matched with the first preceding unmatched edge of the same key belonging to another facet,
+	// as the chained hash table used to do, therefore the neighbors are the same. Each edge fills in its own slot of stl_neighbors,
+	// and the facet statistics only count the facets with at least 1, 2 or 3 neighbors, so the order of the matches does not matter.
+	std::vector<const HashEdge*> unmatched;
+	for (size_t i = 0; i < edges.size();) {
+		size_t j = i + 1;
+		for (; j < edges.size() && edges[j] == edges[i]; ++ j) ;
+		if (j - i == 2) {
+			// The most common case: Two facets sharing an edge.
+			if (edges[i].facet_number != edges[i + 1].facet_number)
+				record_neighbors(stl, edges[i + 1], edges[i]);
+		} else if (j - i > 2) {
+			unmatched.clear();
+			for (size_t k = i; k < j; ++ k) {
+				const HashEdge &edge = edges[k];
+				auto it = std::find_if(unmatched.begin(), unmatched.end(), [&edge](const HashEdge *other) { return other->facet_number != edge.facet_number; });
+				if (it == unmatched.end())
+					unmatched.emplace_back(&edge);
+				else {
+					record_neighbors(stl, edge, **it);
+					unmatched.erase(it);
+				}
+			}
+		}
+		i = j;
+	}
+
 #if 0
 	printf("Number of faces: %d, number of manifold edges: %d, number of connected edges: %d, number of unconnected edges: %d\r\n", 
     	stl->stats.number_of_facets, stl->stats.number_of_facets * 3, 
@@ -26,9 +26,17 @@
 #include <math.h>
 #include <assert.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/cstdio.hpp>
 #include <boost/detail/endian.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
 
 #include "stl.h"
 
@@ -219,9 +227,230 @@ static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first)
   	return true;
 }
 
+// Update the bounding box of the facets and the shortest edge the way stl_facet_stats() does for all the facets.
+static void stl_facets_stats_parallel(stl_file *stl)
+{
+	if (stl->stats.number_of_facets == 0)
+		return;
+	typedef std::pair<stl_vertex, stl_vertex> BBox;
+	const stl_vertex &v0 = stl->facet_start.front().vertex[0];
+	BBox bbox = tbb::parallel_reduce(tbb::blocked_range<size_t>(0, stl->stats.number_of_facets), BBox(v0, v0),
+		[stl](const tbb::blocked_range<size_t> &range, BBox bbox) {
+			for (size_t i = range.begin(); i < range.end(); ++ i)
+				for (const stl_vertex &v : stl->facet_start[i].vertex) {
+					bbox.first  = bbox.first.cwiseMin(v);
+					bbox.second = bbox.second.cwiseMax(v);
+				}
+			return bbox;
+		},
+		[](const BBox &a, const BBox &b) { return BBox(a.first.cwiseMin(b.first), a.second.cwiseMax(b.second)); });
+	stl->stats.min = bbox.first;
+	stl->stats.max = bbox.second;
+	stl_vertex diff = (stl->facet_start.front().vertex[1] - v0).cwiseAbs();
+	stl->stats.shortest_edge = std::max(diff(0), std::max(diff(1), diff(2)));
+	stl->stats.size = stl->stats.max - stl->stats.min;
+	stl->stats.bounding_diameter = stl->stats.size.norm();
+}
+
+// Read a single facet from an ASCII STL between [ptr, end). Returns false at the end of data, sets error on a syntax error.
+static bool stl_read_ascii_facet(const char *&ptr, const char *end, stl_facet &facet, bool &error)
+{
+	auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f'; };
+	auto next_token = [&ptr, end, is_space](const char *&token, size_t &len) {
+		for (; ptr < end && is_space(*ptr); ++ ptr) ;
+		token = ptr;
+		for (; ptr < end && ! is_space(*ptr); ++ ptr) ;
+		len = ptr - token;
+		return len > 0;
+	};
+	auto expect = [&next_token](const char *keyword) {
+		const char *token;
+		size_t      len;
+		return next_token(token, len) && len == strlen(keyword) && strncmp(token, keyword, len) == 0;
+	};
+	// Parse the token as a float. The token is copied, as the mapped file is not zero terminated.
+	auto next_float = [&next_token](float &value) {
+		const char *token;
+		size_t      len;
+		char        buf[64];
+		if (! next_token(token, len) || len >= sizeof(buf))
+			return false;
+		memcpy(buf, token, len);
+		buf[len] = 0;
+		char *endptr = nullptr;
+		value = strtof(buf, &endptr);
+		return endptr == buf + len;
+	};
+
+	for (;;) {
+		const char *token;
+		size_t      len;
+		if (! next_token(token, len))
+			return false;
+		if ((len >= 5 && strncmp(token, "solid", 5) == 0) || (len >= 8 && strncmp(token, "endsolid", 8) == 0)) {
+			// Skip the solid / endsolid lines including the name, which may contain spaces or may be empty.
+			for (; ptr < end && *ptr != '\n'; ++ ptr) ;
+			continue;
+		}
+		if (len != 5 || strncmp(token, "facet", 5) != 0 || ! expect("normal")) {
+			error = true;
+			return false;
+		}
+		break;
+	}
+	// The facet normal may contain not a numbers, the normal is then reset and silently ignored.
+	bool normal_valid = true;
+	for (size_t i = 0; i < 3; ++ i)
+		if (! next_float(facet.normal(i)))
+			normal_valid = false;
+	if (! normal_valid)
+		facet.normal = stl_normal::Zero();
+	error = ! expect("outer") || ! expect("loop");
+	for (size_t i = 0; i < 3 && ! error; ++ i)
+		error = ! expect("vertex") || ! next_float(facet.vertex[i](0)) || ! next_float(facet.vertex[i](1)) || ! next_float(facet.vertex[i](2));
+	error = error || ! expect("endloop") || ! expect("endfacet");
+	return ! error;
+}
+
+// Split an ASCII STL into chunks at facet boundaries and parse them in parallel.
+static bool stl_read_ascii_mapped(stl_file *stl, const char *data, size_t size)
+{
+	// Find the end of a facet at or after ptr, which is followed by another facet, a solid / endsolid or the end of the file.
+	auto facet_boundary = [data, size](const char *ptr) {
+		const char *end = data + size;
+		static const char endfacet[] = "endfacet";
+		for (;;) {
+			ptr = std::search(ptr, end, endfacet, endfacet + 8);
+			if (ptr == end)
+				return end;
+			ptr += 8;
+			const char *next = ptr;
+			for (; next < end && (*next == ' ' || *next == '\t' || *next == '\n' || *next == '\r'); ++ next) ;
+			if (next != ptr || next == end)
+				if (next == end || *next == 'f' || *next == 's' || *next == 'e')
+					return ptr;
+		}
+	};
+
+	// Chunks of roughly 4MB.
+	const size_t chunk_size = 4 * 1024 * 1024;
+	std::vector<const char*> boundaries(1, data);
+	while (boundaries.back() < data + size)
+		boundaries.emplace_back(facet_boundary(data + std::min(size, size_t(boundaries.back() - data) + chunk_size)));
+
+	std::vector<std::vector<stl_facet>> chunks(boundaries.size() - 1);
+	std::vector<char>                   chunk_errors(chunks.size(), false);
+	tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks.size(), 1),
+		[&boundaries, &chunks, &chunk_errors](const tbb::blocked_range<size_t> &range) {
+			for (size_t i = range.begin(); i < range.end(); ++ i) {
+				const char *ptr = boundaries[i];
+				stl_facet   facet = stl_facet();
+				bool        error = false;
+				chunks[i].reserve((boundaries[i + 1] - ptr) / 256);
+				while (stl_read_ascii_facet(ptr, boundaries[i + 1], facet, error))
+					chunks[i].emplace_back(facet);
+				chunk_errors[i] = error;
+			}
+		});
+	if (std::find(chunk_errors.begin(), chunk_errors.end(), true) != chunk_errors.end()) {
+		BOOST_LOG_TRIVIAL(error) << "Something is syntactically very wrong with this ASCII STL! ";
+		return false;
+	}
+
+	size_t num_facets = 0;
+	for (const std::vector<stl_facet> &chunk : chunks)
+		num_facets += chunk.size();
+	stl->stats.number_of_facets += (uint32_t)num_facets;
+	stl->stats.original_num_facets = stl->stats.number_of_facets;
+	stl_allocate(stl);
+	auto it = stl->facet_start.begin();
+	for (const std::vector<stl_facet> &chunk : chunks)
+		it = std::copy(chunk.begin(), chunk.end(), it);
+	return true;
+}
+
+// Load the STL from a memory mapped file, parsing the facets in parallel.
+// Returns false with mapped set to false if the file could not be mapped or is not a valid binary STL file,
+// the caller shall then fall back to reading the file with stdio, which also reports the errors.
+static bool stl_open_mapped(stl_file *stl, const char *file, bool &mapped)
+{
+	mapped = false;
+	boost::interprocess::file_mapping  mapping;
+	boost::interprocess::mapped_region region;
+	try {
+		mapping = boost::interprocess::file_mapping(file, boost::interprocess::read_only);
+		region  = boost::interprocess::mapped_region(mapping, boost::interprocess::read_only);
+	} catch (const std::exception &) {
+		return false;
+	}
+	const char *data = static_cast<const char*>(region.get_address());
+	size_t      size = region.get_size();
+	if (size < HEADER_SIZE + 128)
+		return false;
+
+	// Check for binary or ASCII file.
+	stl->stats.type = ascii;
+	for (size_t s = HEADER_SIZE; s < HEADER_SIZE + 128; ++ s)
+		if ((unsigned char)data[s] > 127) {
+			stl->stats.type = binary;
+			break;
+		}
+
+	if (stl->stats.type == binary) {
+		if ((size - HEADER_SIZE) % SIZEOF_STL_FACET != 0 || size < STL_MIN_FILE_SIZE)
+			return false;
+		mapped = true;
+		uint32_t num_facets = uint32_t((size - HEADER_SIZE) / SIZEOF_STL_FACET);
+		memcpy(stl->stats.header, data, LABEL_SIZE);
+		uint32_t header_num_facets;
+		memcpy(&header_num_facets, data + LABEL_SIZE, sizeof(uint32_t));
+#ifndef BOOST_LITTLE_ENDIAN
+		// Convert from little endian to big endian.
+		stl_internal_reverse_quads((char*)&header_num_facets, 4);
+#endif /* BOOST_LITTLE_ENDIAN */
+		if (num_facets != header_num_facets)
+			BOOST_LOG_TRIVIAL(info) << "stl_open_mapped: Warning: File size doesn't match number of facets in the header: " << file;
+		stl->stats.number_of_facets += num_facets;
+		stl->stats.original_num_facets = stl->stats.number_of_facets;
+		stl_allocate(stl);
+		// Copy the facets straight from the mapped file.
+		tbb::parallel_for(tbb::blocked_range<size_t>(0, num_facets),
+			[stl, data](const tbb::blocked_range<size_t> &range) {
+				for (size_t i = range.begin(); i < range.end(); ++ i) {
+					stl_facet &facet = stl->facet_start[i];
+					// stl_facet is laid out as the 50 bytes of a binary STL facet (see the static asserts in stl.h).
+					memcpy((void*)&facet, data + HEADER_SIZE + i * SIZEOF_STL_FACET, SIZEOF_STL_FACET);
+#ifndef BOOST_LITTLE_ENDIAN
+					// Convert the loaded little endian data to big endian.
+					stl_internal_reverse_quads((char*)&facet, 48);
+#endif /* BOOST_LITTLE_ENDIAN */
+				}
+			});
+	} else {
+		mapped = true;
+		// Get the header.
+		size_t i = 0;
+		for (; i < 80 && data[i] != '\n'; ++ i)
+			stl->stats.header[i] = data[i];
+		stl->stats.header[i] = '\0';
+		stl->stats.header[80] = '\0';
+		if (! stl_read_ascii_mapped(stl, data, size))
+			return false;
+	}
+
+	stl_facets_stats_parallel(stl);
+	return true;
+}
+
 bool stl_open(stl_file *stl, const char *file)
 {
 	stl->clear();
+	// Try the memory mapped file first, fall back to stdio if the file cannot be mapped.
+	bool mapped = false;
+	bool loaded = stl_open_mapped(stl, file, mapped);
+	if (mapped)
+		return loaded;
+	stl->clear();
 	FILE *fp = stl_open_count_facets(stl, file);
 	if (fp == nullptr)
 		return false;
@@ -286,8 +286,13 @@ class ClipperBase
 public:
   ClipperBase() : m_UseFullRange(false), m_HasOpenPaths(false) {}
   ~ClipperBase() { Clear(); }
-  bool AddPath(const Path &pg, PolyType PolyTyp, bool Closed);
-  bool AddPaths(const Paths &ppg, PolyType PolyTyp, bool Closed);
+  // The input paths are either Path / Paths or any containers providing size() and operator[] returning points
+  // convertible to IntPoint, for example views over the points of the application polygons, which are then read
+  // in place instead of being copied into Paths first.
+  template<typename PathInput>
+  bool AddPath(const PathInput &pg, PolyType PolyTyp, bool Closed);
+  template<typename PathsInput>
+  bool AddPaths(const PathsInput &ppg, PolyType PolyTyp, bool Closed);
   void Clear();
   IntRect GetBounds();
   // By default, when three or more vertices are collinear in input polygons (subject or clip), the Clipper object removes the 'inner' vertices before clipping.
@@ -295,7 +300,14 @@ public:
   bool PreserveCollinear() const {return m_PreserveCollinear;};
   void PreserveCollinear(bool value) {m_PreserveCollinear = value;};
 protected:
-  bool AddPathInternal(const Path &pg, int highI, PolyType PolyTyp, bool Closed, TEdge* edges);
+  // Index of the last point of an input path after removing the duplicate end points, -1 for a degenerate path.
+  template<typename PathInput>
+  static int HighIndex(const PathInput &pg, bool Closed);
+  // Copy the points of an input path into the Curr fields of its edges.
+  template<typename PathInput>
+  static void InitEdgePoints(const PathInput &pg, int highI, TEdge* edges);
+  // Initialize the edges with their Curr points filled in by InitEdgePoints().
+  bool AddPathInternal(int highI, PolyType PolyTyp, bool Closed, TEdge* edges);
   TEdge* AddBoundsToLML(TEdge *e, bool IsClosed);
   void Reset();
   TEdge* ProcessBound(TEdge* E, bool IsClockwise);
@@ -442,8 +454,11 @@ public:
   ClipperOffset(double miterLimit = 2.0, double roundPrecision = 0.25, double shortestEdgeLength = 0.) :
     MiterLimit(miterLimit), ArcTolerance(roundPrecision), ShortestEdgeLength(shortestEdgeLength), m_lowest(-1, 0) {}
   ~ClipperOffset() { Clear(); }
-  void AddPath(const Path& path, JoinType joinType, EndType endType);
-  void AddPaths(const Paths& paths, JoinType joinType, EndType endType);
+  // The input paths may be any containers accepted by ClipperBase::AddPath() / AddPaths().
+  template<typename PathInput>
+  void AddPath(const PathInput& path, JoinType joinType, EndType endType);
+  template<typename PathsInput>
+  void AddPaths(const PathsInput& paths, JoinType joinType, EndType endType);
   void Execute(Paths& solution, double delta);
   void Execute(PolyTree& solution, double delta);
   void Clear();
@@ -480,6 +495,159 @@ class clipperException : public std::exception
 };
 //------------------------------------------------------------------------------
 
+template<typename PathInput>
+inline int ClipperBase::HighIndex(const PathInput &pg, bool Closed)
+{
+  // Remove duplicate end point from a closed input path.
+  // Remove duplicate points from the end of the input path.
+  int highI = (int)pg.size() -1;
+  if (Closed) 
+    while (highI > 0 && (IntPoint(pg[highI]) == IntPoint(pg[0]))) 
+      --highI;
+  while (highI > 0 && (IntPoint(pg[highI]) == IntPoint(pg[highI -1]))) 
+    --highI;
+  if ((Closed && highI < 2) || (!Closed && highI < 1))
+    highI = -1;
+  return highI;
+}
+//------------------------------------------------------------------------------
+
+template<typename PathInput>
+inline void ClipperBase::InitEdgePoints(const PathInput &pg, int highI, TEdge* edges)
+{
+  for (int i = 0; i <= highI; ++ i)
+    edges[i].Curr = pg[i];
+}
+//------------------------------------------------------------------------------
+
+template<typename PathInput>
+bool ClipperBase::AddPath(const PathInput &pg, PolyType PolyTyp, bool Closed)
+{
+  int highI = HighIndex(pg, Closed);
+  if (highI < 0)
+    return false;
+
+  // Allocate a new edge array.
+  std::vector<TEdge> edges(highI + 1);
+  // Fill in the edge array.
+  InitEdgePoints(pg, highI, edges.data());
+  bool result = AddPathInternal(highI, PolyTyp, Closed, edges.data());
+  if (result)
+    // Success, remember the edge array.
+    m_edges.emplace_back(std::move(edges));
+  return result;
+}
+//------------------------------------------------------------------------------
+
+template<typename PathsInput>
+bool ClipperBase::AddPaths(const PathsInput &ppg, PolyType PolyTyp, bool Closed)
+{
+  std::vector<int> num_edges(ppg.size(), 0);
+  int num_edges_total = 0;
+  for (size_t i = 0; i < ppg.size(); ++ i) {
+    num_edges[i] = HighIndex(ppg[i], Closed) + 1;
+    num_edges_total += num_edges[i];
+  }
+  if (num_edges_total == 0)
+    return false;
+
+  // Allocate a new edge array.
+  std::vector<TEdge> edges(num_edges_total);
+  // Fill in the edge array.
+  bool result = false;
+  TEdge *p_edge = edges.data();
+  for (size_t i = 0; i < ppg.size(); ++i)
+    if (num_edges[i]) {
+      InitEdgePoints(ppg[i], num_edges[i] - 1, p_edge);
+      bool res = AddPathInternal(num_edges[i] - 1, PolyTyp, Closed, p_edge);
+      if (res) {
+        p_edge += num_edges[i];
+        result = true;
+      }
+    }
+  if (result)
+    // At least some edges were generated. Remember the edge array.
+    m_edges.emplace_back(std::move(edges));
+  return result;
+}
+//------------------------------------------------------------------------------
+
+template<typename PathInput>
+void ClipperOffset::AddPath(const PathInput& path, JoinType joinType, EndType endType)
+{
+  int highI = (int)path.size() - 1;
+  if (highI < 0) return;
+  PolyNode* newNode = new PolyNode();
+  newNode->m_jointype = joinType;
+  newNode->m_endtype = endType;
+
+  //strip duplicate points from path and also get index to the lowest point ...
+  bool   has_shortest_edge_length = ShortestEdgeLength > 0.;
+  double shortest_edge_length2 = has_shortest_edge_length ? ShortestEdgeLength * ShortestEdgeLength : 0.;
+  const IntPoint pt0 = path[0];
+  if (endType == etClosedLine || endType == etClosedPolygon)
+    for (; highI > 0; -- highI) {
+      const IntPoint pt = path[highI];
+      bool same = false;
+      if (has_shortest_edge_length) {
+        double dx = double(pt.X - pt0.X);
+        double dy = double(pt.Y - pt0.Y);
+        same = dx*dx + dy*dy < shortest_edge_length2;
+      } else
+        same = pt0 == pt;
+      if (! same)
+        break;
+    }
+  newNode->Contour.reserve(highI + 1);
+  newNode->Contour.push_back(pt0);
+  int j = 0, k = 0;
+  for (int i = 1; i <= highI; i++) {
+    const IntPoint pt = path[i];
+    bool same = false;
+    if (has_shortest_edge_length) {
+      double dx = double(pt.X - newNode->Contour[j].X);
+      double dy = double(pt.Y - newNode->Contour[j].Y);
+      same = dx*dx + dy*dy < shortest_edge_length2;
+    } else
+      same = newNode->Contour[j] == pt;
+    if (same)
+      continue;
+    j++;
+    newNode->Contour.push_back(pt);
+    if (pt.Y > newNode->Contour[k].Y ||
+      (pt.Y == newNode->Contour[k].Y &&
+      pt.X < newNode->Contour[k].X)) k = j;
+  }
+  if (endType == etClosedPolygon && j < 2)
+  {
+    delete newNode;
+    return;
+  }
+  m_polyNodes.AddChild(*newNode);
+
+  //if this path's lowest pt is lower than all the others then update m_lowest
+  if (endType != etClosedPolygon) return;
+  if (m_lowest.X < 0)
+    m_lowest = IntPoint(m_polyNodes.ChildCount() - 1, k);
+  else
+  {
+    IntPoint ip = m_polyNodes.Childs[(int)m_lowest.X]->Contour[(int)m_lowest.Y];
+    if (newNode->Contour[k].Y > ip.Y ||
+      (newNode->Contour[k].Y == ip.Y &&
+      newNode->Contour[k].X < ip.X))
+      m_lowest = IntPoint(m_polyNodes.ChildCount() - 1, k);
+  }
+}
+//------------------------------------------------------------------------------
+
+template<typename PathsInput>
+void ClipperOffset::AddPaths(const PathsInput& paths, JoinType joinType, EndType endType)
+{
+  for (size_t i = 0; i < paths.size(); ++ i)
+    AddPath(paths[i], joinType, endType);
+}
+//------------------------------------------------------------------------------
+
 } //ClipperLib namespace
 
 #endif //clipper_hpp
@@ -201,11 +201,26 @@ ClipperLib::Paths Slic3rMultiPoints_to_ClipperPaths(const Polylines &input)
     return retval;
 }
 
-ClipperLib::Paths _offset(ClipperLib::Paths &&input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+// Copy the paths read through a view into ClipperLib::Paths, for the operations modifying their input.
+template<typename PathsInput>
+static ClipperLib::Paths to_clipper_paths(const PathsInput &input)
+{
+    ClipperLib::Paths out;
+    out.reserve(input.size());
+    for (size_t i = 0; i < input.size(); ++ i) {
+        const auto &path = input[i];
+        out.emplace_back();
+        out.back().reserve(path.size());
+        for (size_t j = 0; j < path.size(); ++ j)
+            out.back().emplace_back(path[j]);
+    }
+    return out;
+}
+
+// Offset of paths already scaled by CLIPPER_OFFSET_SCALE, either ClipperLib::Paths or a view over the Slic3r polygons.
+template<typename PathsInput>
+static ClipperLib::Paths _offset_scaled(const PathsInput &input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit)
 {
-    // scale input
-    scaleClipperPolygons(input);
-    
     // perform offset
     ClipperLib::ClipperOffset co;
     if (joinType == jtRound)
@@ -223,6 +238,13 @@ ClipperLib::Paths _offset(ClipperLib::Paths &&input, ClipperLib::EndType endType
     return retval;
 }
 
+ClipperLib::Paths _offset(ClipperLib::Paths &&input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+{
+    // scale input
+    scaleClipperPolygons(input);
+    return _offset_scaled(input, endType, delta, joinType, miterLimit);
+}
+
 ClipperLib::Paths _offset(ClipperLib::Path &&input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit)
 {
     ClipperLib::Paths paths;
@@ -230,6 +252,30 @@ ClipperLib::Paths _offset(ClipperLib::Path &&input, ClipperLib::EndType endType,
 	return _offset(std::move(paths), endType, delta, joinType, miterLimit);
 }
 
+// A single polygon or polyline, read in place and scaled on the fly.
+struct SingleMultiPointView
+{
+    SingleMultiPointView(const MultiPoint &src) : path(src.points, CLIPPER_OFFSET_SCALE) {}
+    size_t                            size() const { return 1; }
+    const ClipperUtils::PointsView&   operator[](size_t) const { return path; }
+    ClipperUtils::PointsView          path;
+};
+
+ClipperLib::Paths _offset(const Slic3r::MultiPoint &input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+{
+    return _offset_scaled(SingleMultiPointView(input), endType, delta, joinType, miterLimit);
+}
+
+ClipperLib::Paths _offset(const Slic3r::Polygons &input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+{
+    return _offset_scaled(ClipperUtils::PolygonsView(input, CLIPPER_OFFSET_SCALE), endType, delta, joinType, miterLimit);
+}
+
+ClipperLib::Paths _offset(const Slic3r::Polylines &input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+{
+    return _offset_scaled(ClipperUtils::PolylinesView(input, CLIPPER_OFFSET_SCALE), endType, delta, joinType, miterLimit);
+}
+
 // This is a safe variant of the polygon offset, tailored for a single ExPolygon:
 // a single polygon with multiple non-overlapping holes.
 // Each contour and hole is offsetted separately, then the holes are subtracted from the outer contours.
@@ -241,15 +287,13 @@ ClipperLib::Paths _offset(const Slic3r::ExPolygon &expolygon, const float delta,
     const float delta_scaled = delta * float(CLIPPER_OFFSET_SCALE);
     ClipperLib::Paths contours;
     {
-        ClipperLib::Path input = Slic3rMultiPoint_to_ClipperPath(expolygon.contour);
-        scaleClipperPolygon(input);
         ClipperLib::ClipperOffset co;
         if (joinType == jtRound)
             co.ArcTolerance = miterLimit * double(CLIPPER_OFFSET_SCALE);
         else
             co.MiterLimit = miterLimit;
         co.ShortestEdgeLength = double(std::abs(delta_scaled * CLIPPER_OFFSET_SHORTEST_EDGE_FACTOR));
-        co.AddPath(input, joinType, ClipperLib::etClosedPolygon);
+        co.AddPath(ClipperUtils::PointsView(expolygon.contour.points, CLIPPER_OFFSET_SCALE), joinType, ClipperLib::etClosedPolygon);
         co.Execute(contours, delta_scaled);
     }
 
@@ -258,8 +302,8 @@ ClipperLib::Paths _offset(const Slic3r::ExPolygon &expolygon, const float delta,
     {
         holes.reserve(expolygon.holes.size());
         for (Polygons::const_iterator it_hole = expolygon.holes.begin(); it_hole != expolygon.holes.end(); ++ it_hole) {
-            ClipperLib::Path input = Slic3rMultiPoint_to_ClipperPath_reversed(*it_hole);
-            scaleClipperPolygon(input);
+            // The hole is read reversed.
+            ClipperUtils::PointsView input(it_hole->points, CLIPPER_OFFSET_SCALE, true);
             ClipperLib::ClipperOffset co;
             if (joinType == jtRound)
                 co.ArcTolerance = miterLimit * double(CLIPPER_OFFSET_SCALE);
@@ -290,10 +334,41 @@ ClipperLib::Paths _offset(const Slic3r::ExPolygon &expolygon, const float delta,
     return output;
 }
 
+// Contour and holes of an ExPolygon to be offsetted by _offset_expolygons(): Either the points of a Slic3r::ExPolygon,
+// or the paths of an outer ClipperLib::PolyNode and of its holes, which are not converted to a Slic3r::ExPolygon.
+template<typename PointType>
+struct ExPolygonPoints
+{
+    const std::vector<PointType>               *contour;
+    std::vector<const std::vector<PointType>*>  holes;
+};
+
+// Collect the ExPolygons of a PolyTree in the order of PolyTreeToExPolygons().
+static void polytree_to_expolygon_points(const ClipperLib::PolyNode &polynode, std::vector<ExPolygonPoints<ClipperLib::IntPoint>> &out)
+{
+    size_t idx = out.size();
+    out.push_back({ &polynode.Contour, {} });
+    out[idx].holes.reserve(polynode.ChildCount());
+    for (const ClipperLib::PolyNode *hole : polynode.Childs) {
+        out[idx].holes.emplace_back(&hole->Contour);
+        for (const ClipperLib::PolyNode *child : hole->Childs)
+            polytree_to_expolygon_points(*child, out);
+    }
+}
+
+static std::vector<ExPolygonPoints<ClipperLib::IntPoint>> polytree_to_expolygon_points(const ClipperLib::PolyTree &polytree)
+{
+    std::vector<ExPolygonPoints<ClipperLib::IntPoint>> out;
+    for (const ClipperLib::PolyNode *polynode : polytree.Childs)
+        polytree_to_expolygon_points(*polynode, out);
+    return out;
+}
+
 // This is a safe variant of the polygons offset, tailored for multiple ExPolygons.
 // It is required, that the input expolygons do not overlap and that the holes of each ExPolygon don't intersect with their respective outer contours.
 // Each ExPolygon is offsetted separately, then the offsetted ExPolygons are united.
-ClipperLib::Paths _offset(const Slic3r::ExPolygons &expolygons, const float delta,
+template<typename PointType>
+static ClipperLib::Paths _offset_expolygons(const std::vector<ExPolygonPoints<PointType>> &expolygons, const float delta,
     ClipperLib::JoinType joinType, double miterLimit)
 {
     const float delta_scaled = delta * float(CLIPPER_OFFSET_SCALE);
@@ -303,19 +378,17 @@ ClipperLib::Paths _offset(const Slic3r::ExPolygons &expolygons, const float delt
     // How many non-empty offsetted expolygons were actually collected into contours_cummulative?
     // If only one, then there is no need to do a final union.
     size_t expolygons_collected = 0;
-    for (Slic3r::ExPolygons::const_iterator it_expoly = expolygons.begin(); it_expoly != expolygons.end(); ++ it_expoly) {
+    for (auto it_expoly = expolygons.begin(); it_expoly != expolygons.end(); ++ it_expoly) {
         // 1) Offset the outer contour.
         ClipperLib::Paths contours;
         {
-            ClipperLib::Path input = Slic3rMultiPoint_to_ClipperPath(it_expoly->contour);
-            scaleClipperPolygon(input);
             ClipperLib::ClipperOffset co;
             if (joinType == jtRound)
                 co.ArcTolerance = miterLimit * double(CLIPPER_OFFSET_SCALE);
             else
                 co.MiterLimit = miterLimit;
             co.ShortestEdgeLength = double(std::abs(delta_scaled * CLIPPER_OFFSET_SHORTEST_EDGE_FACTOR));
-            co.AddPath(input, joinType, ClipperLib::etClosedPolygon);
+            co.AddPath(ClipperUtils::PathView<PointType>(*it_expoly->contour, CLIPPER_OFFSET_SCALE), joinType, ClipperLib::etClosedPolygon);
             co.Execute(contours, delta_scaled);
         }
         if (contours.empty())
@@ -330,9 +403,9 @@ ClipperLib::Paths _offset(const Slic3r::ExPolygons &expolygons, const float delt
             // 2) Offset the holes one by one, collect the offsetted holes.
             ClipperLib::Paths holes;
             {
-                for (Polygons::const_iterator it_hole = it_expoly->holes.begin(); it_hole != it_expoly->holes.end(); ++ it_hole) {
-                    ClipperLib::Path input = Slic3rMultiPoint_to_ClipperPath_reversed(*it_hole);
-                    scaleClipperPolygon(input);
+                for (const std::vector<PointType> *hole : it_expoly->holes) {
+                    // The hole is read reversed.
+                    ClipperUtils::PathView<PointType> input(*hole, CLIPPER_OFFSET_SCALE, true);
                     ClipperLib::ClipperOffset co;
                     if (joinType == jtRound)
                         co.ArcTolerance = miterLimit * double(CLIPPER_OFFSET_SCALE);
@@ -399,15 +472,26 @@ ClipperLib::Paths _offset(const Slic3r::ExPolygons &expolygons, const float delt
     return output;
 }
 
+ClipperLib::Paths _offset(const Slic3r::ExPolygons &expolygons, const float delta,
+    ClipperLib::JoinType joinType, double miterLimit)
+{
+    std::vector<ExPolygonPoints<Point>> input;
+    input.reserve(expolygons.size());
+    for (const ExPolygon &expoly : expolygons) {
+        input.push_back({ &expoly.contour.points, {} });
+        input.back().holes.reserve(expoly.holes.size());
+        for (const Polygon &hole : expoly.holes)
+            input.back().holes.emplace_back(&hole.points);
+    }
+    return _offset_expolygons(input, delta, joinType, miterLimit);
+}
+
 ClipperLib::Paths
 _offset2(const Polygons &polygons, const float delta1, const float delta2,
     const ClipperLib::JoinType joinType, const double miterLimit)
 {
-    // read input
-    ClipperLib::Paths input = Slic3rMultiPoints_to_ClipperPaths(polygons);
-    
-    // scale input
-    scaleClipperPolygons(input);
+    // read the input in place, scaled
+    ClipperUtils::PolygonsView input(polygons, CLIPPER_OFFSET_SCALE);
     
     // prepare ClipperOffset object
     ClipperLib::ClipperOffset co;
@@ -458,44 +542,30 @@ offset2_ex(const Polygons &polygons, const float delta1, const float delta2,
     return ClipperPaths_to_Slic3rExPolygons(output);
 }
 
-//FIXME Vojtech: This functon may likely be optimized to avoid some of the Slic3r to Clipper 
-// conversions and unnecessary Clipper calls.
-ExPolygons offset2_ex(const ExPolygons &expolygons, const float delta1,
-    const float delta2, ClipperLib::JoinType joinType, double miterLimit)
-{
-    Polygons polys;
-    for (const ExPolygon &expoly : expolygons)
-        append(polys, 
-               offset(offset_ex(expoly, delta1, joinType, miterLimit), 
-                      delta2, joinType, miterLimit));
-    return union_ex(polys);
-}
-
-template <class T>
+template <class T, typename SubjectInput, typename ClipInput>
 T
-_clipper_do(const ClipperLib::ClipType clipType, const Polygons &subject, 
-    const Polygons &clip, const ClipperLib::PolyFillType fillType, const bool safety_offset_)
+_clipper_do(const ClipperLib::ClipType clipType, const SubjectInput &subject, 
+    const ClipInput &clip, const ClipperLib::PolyFillType fillType, const bool safety_offset_)
 {
-    // read input
-    ClipperLib::Paths input_subject = Slic3rMultiPoints_to_ClipperPaths(subject);
-    ClipperLib::Paths input_clip    = Slic3rMultiPoints_to_ClipperPaths(clip);
-    
-    // perform safety offset
-    if (safety_offset_) {
-        if (clipType == ClipperLib::ctUnion) {
-            safety_offset(&input_subject);
-        } else {
-            safety_offset(&input_clip);
-        }
-    }
-    
     // init Clipper
     ClipperLib::Clipper clipper;
     clipper.Clear();
     
-    // add polygons
-    clipper.AddPaths(input_subject, ClipperLib::ptSubject, true);
-    clipper.AddPaths(input_clip,    ClipperLib::ptClip,    true);
+    // add polygons, read in place unless the safety offset is applied to them
+    if (safety_offset_ && clipType == ClipperLib::ctUnion) {
+        ClipperLib::Paths input_subject = to_clipper_paths(subject);
+        safety_offset(&input_subject);
+        clipper.AddPaths(input_subject, ClipperLib::ptSubject, true);
+        clipper.AddPaths(clip,          ClipperLib::ptClip,    true);
+    } else if (safety_offset_) {
+        ClipperLib::Paths input_clip = to_clipper_paths(clip);
+        safety_offset(&input_clip);
+        clipper.AddPaths(subject,    ClipperLib::ptSubject, true);
+        clipper.AddPaths(input_clip, ClipperLib::ptClip,    true);
+    } else {
+        clipper.AddPaths(subject, ClipperLib::ptSubject, true);
+        clipper.AddPaths(clip,    ClipperLib::ptClip,    true);
+    }
     
     // perform operation
     T retval;
@@ -510,50 +580,74 @@ _clipper_do(const ClipperLib::ClipType clipType, const Polygons &subject,
 // This function implmenets a following workaround:
 // 1) Peform the Clipper operation with the output to Paths. This method handles overlaps in a reasonable time.
 // 2) Run Clipper Union once again to extract the PolyTree from the result of 1).
-inline ClipperLib::PolyTree _clipper_do_polytree2(const ClipperLib::ClipType clipType, const Polygons &subject, 
-    const Polygons &clip, const ClipperLib::PolyFillType fillType, const bool safety_offset_)
+template<typename SubjectInput, typename ClipInput>
+inline ClipperLib::PolyTree _clipper_do_polytree2(const ClipperLib::ClipType clipType, const SubjectInput &subject, 
+    const ClipInput &clip, const ClipperLib::PolyFillType fillType, const bool safety_offset_)
 {
-    // read input
-    ClipperLib::Paths input_subject = Slic3rMultiPoints_to_ClipperPaths(subject);
-    ClipperLib::Paths input_clip    = Slic3rMultiPoints_to_ClipperPaths(clip);
-    
-    // perform safety offset
-    if (safety_offset_)
-        safety_offset((clipType == ClipperLib::ctUnion) ? &input_subject : &input_clip);
-    
-    ClipperLib::Clipper clipper;
-    clipper.AddPaths(input_subject, ClipperLib::ptSubject, true);
-    clipper.AddPaths(input_clip,    ClipperLib::ptClip,    true);
-    // Perform the operation with the output to input_subject.
+    // Perform the operation with the output to Paths.
     // This pass does not generate a PolyTree, which is a very expensive operation with the current Clipper library
     // if there are overapping edges.
-    clipper.Execute(clipType, input_subject, fillType, fillType);
+    ClipperLib::Paths output = _clipper_do<ClipperLib::Paths>(clipType, subject, clip, fillType, safety_offset_);
     // Perform an additional Union operation to generate the PolyTree ordering.
-    clipper.Clear();
-    clipper.AddPaths(input_subject, ClipperLib::ptSubject, true);
+    ClipperLib::Clipper clipper;
+    clipper.AddPaths(output, ClipperLib::ptSubject, true);
     ClipperLib::PolyTree retval;
     clipper.Execute(ClipperLib::ctUnion, retval, fillType, fillType);
     return retval;
 }
 
+// The intermediate ExPolygons are kept in the Clipper form, see _offset_expolygons().
+ExPolygons offset2_ex(const ExPolygons &expolygons, const float delta1,
+    const float delta2, ClipperLib::JoinType joinType, double miterLimit)
+{
+    ClipperLib::Paths polys;
+    for (const ExPolygon &expoly : expolygons) {
+        // offset_ex(expoly, delta1)
+        ClipperLib::Clipper clipper;
+        clipper.AddPaths(_offset(expoly, delta1, joinType, miterLimit), ClipperLib::ptSubject, true);
+        ClipperLib::PolyTree polytree;
+        clipper.Execute(ClipperLib::ctUnion, polytree, ClipperLib::pftEvenOdd, ClipperLib::pftEvenOdd);
+        // offset(..., delta2)
+        ClipperLib::Paths out = _offset_expolygons(polytree_to_expolygon_points(polytree), delta2, joinType, miterLimit);
+        std::move(std::begin(out), std::end(out), std::back_inserter(polys));
+    }
+    // union_ex(polys)
+    ClipperLib::PolyTree polytree = _clipper_do_polytree2(ClipperLib::ctUnion, polys, ClipperLib::Paths(), ClipperLib::pftNonZero, false);
+    return PolyTreeToExPolygons(polytree);
+}
+
+static ClipperLib::Paths _union_offset(const Polygons &subject, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+{
+    ClipperLib::PolyTree polytree = _clipper_do_polytree2(ClipperLib::ctUnion, ClipperUtils::PolygonsView(subject), ClipperLib::Paths(), ClipperLib::pftNonZero, false);
+    return _offset_expolygons(polytree_to_expolygon_points(polytree), delta, joinType, miterLimit);
+}
+
+Polygons union_offset(const Polygons &subject, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+{
+    return ClipperPaths_to_Slic3rPolygons(_union_offset(subject, delta, joinType, miterLimit));
+}
+
+ExPolygons union_offset_ex(const Polygons &subject, const float delta, ClipperLib::JoinType joinType, double miterLimit)
+{
+    return ClipperPaths_to_Slic3rExPolygons(_union_offset(subject, delta, joinType, miterLimit));
+}
+
 ClipperLib::PolyTree _clipper_do_pl(const ClipperLib::ClipType clipType, const Polylines &subject, 
     const Polygons &clip, const ClipperLib::PolyFillType fillType,
     const bool safety_offset_)
 {
-    // read input
-    ClipperLib::Paths input_subject = Slic3rMultiPoints_to_ClipperPaths(subject);
-    ClipperLib::Paths input_clip    = Slic3rMultiPoints_to_ClipperPaths(clip);
-    
-    // perform safety offset
-    if (safety_offset_) safety_offset(&input_clip);
-    
     // init Clipper
     ClipperLib::Clipper clipper;
     clipper.Clear();
     
-    // add polygons
-    clipper.AddPaths(input_subject, ClipperLib::ptSubject, false);
-    clipper.AddPaths(input_clip,    ClipperLib::ptClip,    true);
+    // add polygons, read in place unless the safety offset is applied to them
+    clipper.AddPaths(ClipperUtils::PolylinesView(subject), ClipperLib::ptSubject, false);
+    if (safety_offset_) {
+        ClipperLib::Paths input_clip = Slic3rMultiPoints_to_ClipperPaths(clip);
+        safety_offset(&input_clip);
+        clipper.AddPaths(input_clip, ClipperLib::ptClip, true);
+    } else
+        clipper.AddPaths(ClipperUtils::PolygonsView(clip), ClipperLib::ptClip, true);
     
     // perform operation
     ClipperLib::PolyTree retval;
@@ -563,12 +657,34 @@ ClipperLib::PolyTree _clipper_do_pl(const ClipperLib::ClipType clipType, const P
 
 Polygons _clipper(ClipperLib::ClipType clipType, const Polygons &subject, const Polygons &clip, bool safety_offset_)
 {
-    return ClipperPaths_to_Slic3rPolygons(_clipper_do<ClipperLib::Paths>(clipType, subject, clip, ClipperLib::pftNonZero, safety_offset_));
+    return ClipperPaths_to_Slic3rPolygons(_clipper_do<ClipperLib::Paths>(clipType, 
+        ClipperUtils::PolygonsView(subject), ClipperUtils::PolygonsView(clip), ClipperLib::pftNonZero, safety_offset_));
+}
+
+Polygons _clipper(ClipperLib::ClipType clipType, const ExPolygons &subject, const ExPolygons &clip, bool safety_offset_)
+{
+    return ClipperPaths_to_Slic3rPolygons(_clipper_do<ClipperLib::Paths>(clipType, 
+        ClipperUtils::ExPolygonsView(subject), ClipperUtils::ExPolygonsView(clip), ClipperLib::pftNonZero, safety_offset_));
 }
 
 ExPolygons _clipper_ex(ClipperLib::ClipType clipType, const Polygons &subject, const Polygons &clip, bool safety_offset_)
 {
-    ClipperLib::PolyTree polytree = _clipper_do_polytree2(clipType, subject, clip, ClipperLib::pftNonZero, safety_offset_);
+    ClipperLib::PolyTree polytree = _clipper_do_polytree2(clipType, 
+        ClipperUtils::PolygonsView(subject), ClipperUtils::PolygonsView(clip), ClipperLib::pftNonZero, safety_offset_);
+    return PolyTreeToExPolygons(polytree);
+}
+
+ExPolygons _clipper_ex(ClipperLib::ClipType clipType, const ExPolygons &subject, const ExPolygons &clip, bool safety_offset_)
+{
+    ClipperLib::PolyTree polytree = _clipper_do_polytree2(clipType, 
+        ClipperUtils::ExPolygonsView(subject), ClipperUtils::ExPolygonsView(clip), ClipperLib::pftNonZero, safety_offset_);
+    return PolyTreeToExPolygons(polytree);
+}
+
+ExPolygons _clipper_ex(ClipperLib::ClipType clipType, const Surfaces &subject, bool safety_offset_)
+{
+    ClipperLib::PolyTree polytree = _clipper_do_polytree2(clipType, 
+        ClipperUtils::ExPolygonsView(subject), ClipperLib::Paths(), ClipperLib::pftNonZero, safety_offset_);
     return PolyTreeToExPolygons(polytree);
 }
 
@@ -650,7 +766,7 @@ _clipper_ln(ClipperLib::ClipType clipType, const Lines &subject, const Polygons
 ClipperLib::PolyTree
 union_pt(const Polygons &subject, bool safety_offset_)
 {
-    return _clipper_do<ClipperLib::PolyTree>(ClipperLib::ctUnion, subject, Polygons(), ClipperLib::pftEvenOdd, safety_offset_);
+    return _clipper_do<ClipperLib::PolyTree>(ClipperLib::ctUnion, ClipperUtils::PolygonsView(subject), ClipperLib::Paths(), ClipperLib::pftEvenOdd, safety_offset_);
 }
 
 Polygons
@@ -691,18 +807,15 @@ void traverse_pt(ClipperLib::PolyNodes &nodes, Polygons* retval)
 
 Polygons simplify_polygons(const Polygons &subject, bool preserve_collinear)
 {
-    // convert into Clipper polygons
-    ClipperLib::Paths input_subject = Slic3rMultiPoints_to_ClipperPaths(subject);
-    
     ClipperLib::Paths output;
     if (preserve_collinear) {
         ClipperLib::Clipper c;
         c.PreserveCollinear(true);
         c.StrictlySimple(true);
-        c.AddPaths(input_subject, ClipperLib::ptSubject, true);
+        c.AddPaths(ClipperUtils::PolygonsView(subject), ClipperLib::ptSubject, true);
         c.Execute(ClipperLib::ctUnion, output, ClipperLib::pftNonZero, ClipperLib::pftNonZero);
     } else {
-        ClipperLib::SimplifyPolygons(input_subject, output, ClipperLib::pftNonZero);
+        ClipperLib::SimplifyPolygons(Slic3rMultiPoints_to_ClipperPaths(subject), output, ClipperLib::pftNonZero);
     }
     
     // convert into Slic3r polygons
@@ -714,15 +827,12 @@ ExPolygons simplify_polygons_ex(const Polygons &subject, bool preserve_collinear
     if (! preserve_collinear)
         return union_ex(simplify_polygons(subject, false));
 
-    // convert into Clipper polygons
-    ClipperLib::Paths input_subject = Slic3rMultiPoints_to_ClipperPaths(subject);
-    
     ClipperLib::PolyTree polytree;
     
     ClipperLib::Clipper c;
     c.PreserveCollinear(true);
     c.StrictlySimple(true);
-    c.AddPaths(input_subject, ClipperLib::ptSubject, true);
+    c.AddPaths(ClipperUtils::PolygonsView(subject), ClipperLib::ptSubject, true);
     c.Execute(ClipperLib::ctUnion, polytree, ClipperLib::pftNonZero, ClipperLib::pftNonZero);
     
     // convert into ExPolygons
@@ -784,7 +894,7 @@ Polygons top_level_islands(const Slic3r::Polygons &polygons)
     ClipperLib::Clipper clipper;
     clipper.Clear();
     // perform union
-    clipper.AddPaths(Slic3rMultiPoints_to_ClipperPaths(polygons), ClipperLib::ptSubject, true);
+    clipper.AddPaths(ClipperUtils::PolygonsView(polygons), ClipperLib::ptSubject, true);
     ClipperLib::PolyTree polytree;
     clipper.Execute(ClipperLib::ctUnion, polytree, ClipperLib::pftEvenOdd, ClipperLib::pftEvenOdd); 
     // Convert only the top level islands to the output.
@@ -26,6 +26,74 @@ using ClipperLib::jtSquare;
 
 namespace Slic3r {
 
+namespace ClipperUtils {
+    inline ClipperLib::IntPoint to_IntPoint(const Point &pt, ClipperLib::cInt scale)
+        { return ClipperLib::IntPoint(ClipperLib::cInt(pt(0)) * scale, ClipperLib::cInt(pt(1)) * scale); }
+    inline ClipperLib::IntPoint to_IntPoint(const ClipperLib::IntPoint &pt, ClipperLib::cInt scale)
+        { return ClipperLib::IntPoint(pt.X * scale, pt.Y * scale); }
+
+    // A view over the points of a Slic3r polygon or polyline (or of a ClipperLib::Path), which the Clipper library
+    // reads in place of a ClipperLib::Path, so that the points are not copied into a ClipperLib::Path first.
+    // The points may be scaled by CLIPPER_OFFSET_SCALE for the offset functions and traversed in reverse order.
+    template<typename PointType>
+    class PathView
+    {
+    public:
+        PathView() : m_points(nullptr), m_size(0), m_scale(1), m_reversed(false) {}
+        explicit PathView(const std::vector<PointType> &points, ClipperLib::cInt scale = 1, bool reversed = false) :
+            m_points(points.data()), m_size(points.size()), m_scale(scale), m_reversed(reversed) {}
+
+        size_t               size() const { return m_size; }
+        ClipperLib::IntPoint operator[](size_t i) const
+            { return to_IntPoint(m_points[m_reversed ? m_size - 1 - i : i], m_scale); }
+
+    private:
+        const PointType     *m_points;
+        size_t               m_size;
+        ClipperLib::cInt     m_scale;
+        bool                 m_reversed;
+    };
+    typedef PathView<Point> PointsView;
+
+    // A view over a vector of Polygons or Polylines.
+    template<typename MultiPoints>
+    class MultiPointsView
+    {
+    public:
+        explicit MultiPointsView(const MultiPoints &src, ClipperLib::cInt scale = 1) : m_src(src), m_scale(scale) {}
+
+        size_t      size() const { return m_src.size(); }
+        PointsView  operator[](size_t i) const { return PointsView(m_src[i].points, m_scale); }
+
+    private:
+        const MultiPoints  &m_src;
+        ClipperLib::cInt    m_scale;
+    };
+    typedef MultiPointsView<Polygons>  PolygonsView;
+    typedef MultiPointsView<Polylines> PolylinesView;
+
+    // A view over the contours and holes of ExPolygons or Surfaces, as if they were converted with to_polygons().
+    class ExPolygonsView
+    {
+    public:
+        explicit ExPolygonsView(const ExPolygon &src)  { this->append(src); }
+        explicit ExPolygonsView(const ExPolygons &src) { for (const ExPolygon &expoly : src) this->append(expoly); }
+        explicit ExPolygonsView(const Surfaces &src)   { for (const Surface &surface : src) this->append(surface.expolygon); }
+
+        size_t            size() const { return m_paths.size(); }
+        const PointsView& operator[](size_t i) const { return m_paths[i]; }
+
+    private:
+        void append(const ExPolygon &expoly) {
+            m_paths.emplace_back(expoly.contour.points);
+            for (const Polygon &hole : expoly.holes)
+                m_paths.emplace_back(hole.points);
+        }
+
+        std::vector<PointsView> m_paths;
+    };
+}
+
 //-----------------------------------------------------------
 // legacy code from Clipper documentation
 void AddOuterPolyNodeToExPolygons(ClipperLib::PolyNode& polynode, Slic3r::ExPolygons *expolygons);
@@ -42,18 +110,22 @@ Slic3r::Polylines  ClipperPaths_to_Slic3rPolylines(const ClipperLib::Paths &inpu
 Slic3r::ExPolygons ClipperPaths_to_Slic3rExPolygons(const ClipperLib::Paths &input);
 
 // offset Polygons
+// The Slic3r polygons and polylines are read by the Clipper library in place, see ClipperUtils::PathView.
 ClipperLib::Paths _offset(ClipperLib::Path &&input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit);
 ClipperLib::Paths _offset(ClipperLib::Paths &&input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit);
+ClipperLib::Paths _offset(const Slic3r::MultiPoint &input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit);
+ClipperLib::Paths _offset(const Slic3r::Polygons &input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit);
+ClipperLib::Paths _offset(const Slic3r::Polylines &input, ClipperLib::EndType endType, const float delta, ClipperLib::JoinType joinType, double miterLimit);
 inline Slic3r::Polygons offset(const Slic3r::Polygon &polygon, const float delta, ClipperLib::JoinType joinType = ClipperLib::jtMiter,  double miterLimit = 3)
-    { return ClipperPaths_to_Slic3rPolygons(_offset(Slic3rMultiPoint_to_ClipperPath(polygon), ClipperLib::etClosedPolygon, delta, joinType, miterLimit)); }
+    { return ClipperPaths_to_Slic3rPolygons(_offset(polygon, ClipperLib::etClosedPolygon, delta, joinType, miterLimit)); }
 inline Slic3r::Polygons offset(const Slic3r::Polygons &polygons, const float delta, ClipperLib::JoinType joinType = ClipperLib::jtMiter, double miterLimit = 3)
-    { return ClipperPaths_to_Slic3rPolygons(_offset(Slic3rMultiPoints_to_ClipperPaths(polygons), ClipperLib::etClosedPolygon, delta, joinType, miterLimit)); }
+    { return ClipperPaths_to_Slic3rPolygons(_offset(polygons, ClipperLib::etClosedPolygon, delta, joinType, miterLimit)); }
 
 // offset Polylines
 inline Slic3r::Polygons offset(const Slic3r::Polyline &polyline, const float delta, ClipperLib::JoinType joinType = ClipperLib::jtSquare, double miterLimit = 3)
-    { return ClipperPaths_to_Slic3rPolygons(_offset(Slic3rMultiPoint_to_ClipperPath(polyline), ClipperLib::etOpenButt, delta, joinType, miterLimit)); }
+    { return ClipperPaths_to_Slic3rPolygons(_offset(polyline, ClipperLib::etOpenButt, delta, joinType, miterLimit)); }
 inline Slic3r::Polygons offset(const Slic3r::Polylines &polylines, const float delta, ClipperLib::JoinType joinType = ClipperLib::jtSquare, double miterLimit = 3)
-    { return ClipperPaths_to_Slic3rPolygons(_offset(Slic3rMultiPoints_to_ClipperPaths(polylines), ClipperLib::etOpenButt, delta, joinType, miterLimit)); }
+    { return ClipperPaths_to_Slic3rPolygons(_offset(polylines, ClipperLib::etOpenButt, delta, joinType, miterLimit)); }
 
 // offset expolygons and surfaces
 ClipperLib::Paths _offset(const Slic3r::ExPolygon &expolygon, const float delta, ClipperLib::JoinType joinType, double miterLimit);
@@ -63,9 +135,9 @@ inline Slic3r::Polygons offset(const Slic3r::ExPolygon &expolygon, const float d
 inline Slic3r::Polygons offset(const Slic3r::ExPolygons &expolygons, const float delta, ClipperLib::JoinType joinType = ClipperLib::jtMiter, double miterLimit = 3)
     { return ClipperPaths_to_Slic3rPolygons(_offset(expolygons, delta, joinType, miterLimit)); }
 inline Slic3r::ExPolygons offset_ex(const Slic3r::Polygon &polygon, const float delta, ClipperLib::JoinType joinType = ClipperLib::jtMiter, double miterLimit = 3)
-    { return ClipperPaths_to_Slic3rExPolygons(_offset(Slic3rMultiPoint_to_ClipperPath(polygon), ClipperLib::etClosedPolygon, delta, joinType, miterLimit)); }    
+    { return ClipperPaths_to_Slic3rExPolygons(_offset(polygon, ClipperLib::etClosedPolygon, delta, joinType, miterLimit)); }    
 inline Slic3r::ExPolygons offset_ex(const Slic3r::Polygons &polygons, const float delta, ClipperLib::JoinType joinType = ClipperLib::jtMiter, double miterLimit = 3)
-    { return ClipperPaths_to_Slic3rExPolygons(_offset(Slic3rMultiPoints_to_ClipperPaths(polygons), ClipperLib::etClosedPolygon, delta, joinType, miterLimit)); }
+    { return ClipperPaths_to_Slic3rExPolygons(_offset(polygons, ClipperLib::etClosedPolygon, delta, joinType, miterLimit)); }
 inline Slic3r::ExPolygons offset_ex(const Slic3r::ExPolygon &expolygon, const float delta, ClipperLib::JoinType joinType = ClipperLib::jtMiter, double miterLimit = 3)
     { return ClipperPaths_to_Slic3rExPolygons(_offset(expolygon, delta, joinType, miterLimit)); }
 inline Slic3r::ExPolygons offset_ex(const Slic3r::ExPolygons &expolygons, const float delta, ClipperLib::JoinType joinType = ClipperLib::jtMiter, double miterLimit = 3)
@@ -84,10 +156,24 @@ Slic3r::ExPolygons offset2_ex(const Slic3r::ExPolygons &expolygons, const float
     const float delta2, ClipperLib::JoinType joinType = ClipperLib::jtMiter, 
     double miterLimit = 3);
 
+// Fused operations, the intermediate results are kept in the Clipper form.
+// union_offset(subject, delta) == offset(union_ex(subject), delta)
+Slic3r::Polygons union_offset(const Slic3r::Polygons &subject, const float delta,
+    ClipperLib::JoinType joinType = ClipperLib::jtMiter, double miterLimit = 3);
+// union_offset_ex(subject, delta) == offset_ex(union_ex(subject), delta)
+Slic3r::ExPolygons union_offset_ex(const Slic3r::Polygons &subject, const float delta,
+    ClipperLib::JoinType joinType = ClipperLib::jtMiter, double miterLimit = 3);
+
 Slic3r::Polygons _clipper(ClipperLib::ClipType clipType,
     const Slic3r::Polygons &subject, const Slic3r::Polygons &clip, bool safety_offset_ = false);
+Slic3r::Polygons _clipper(ClipperLib::ClipType clipType,
+    const Slic3r::ExPolygons &subject, const Slic3r::ExPolygons &clip, bool safety_offset_ = false);
 Slic3r::ExPolygons _clipper_ex(ClipperLib::ClipType clipType,
     const Slic3r::Polygons &subject, const Slic3r::Polygons &clip, bool safety_offset_ = false);
+Slic3r::ExPolygons _clipper_ex(ClipperLib::ClipType clipType,
+    const Slic3r::ExPolygons &subject, const Slic3r::ExPolygons &clip, bool safety_offset_ = false);
+Slic3r::ExPolygons _clipper_ex(ClipperLib::ClipType clipType,
+    const Slic3r::Surfaces &subject, bool safety_offset_ = false);
 Slic3r::Polylines _clipper_pl(ClipperLib::ClipType clipType,
     const Slic3r::Polylines &subject, const Slic3r::Polygons &clip, bool safety_offset_ = false);
 Slic3r::Polylines _clipper_pl(ClipperLib::ClipType clipType,
@@ -111,13 +197,13 @@ diff_ex(const Slic3r::Polygons &subject, const Slic3r::Polygons &clip, bool safe
 inline Slic3r::ExPolygons
 diff_ex(const Slic3r::ExPolygons &subject, const Slic3r::ExPolygons &clip, bool safety_offset_ = false)
 {
-    return _clipper_ex(ClipperLib::ctDifference, to_polygons(subject), to_polygons(clip), safety_offset_);
+    return _clipper_ex(ClipperLib::ctDifference, subject, clip, safety_offset_);
 }
 
 inline Slic3r::Polygons
 diff(const Slic3r::ExPolygons &subject, const Slic3r::ExPolygons &clip, bool safety_offset_ = false)
 {
-    return _clipper(ClipperLib::ctDifference, to_polygons(subject), to_polygons(clip), safety_offset_);
+    return _clipper(ClipperLib::ctDifference, subject, clip, safety_offset_);
 }
 
 inline Slic3r::Polylines
@@ -154,13 +240,13 @@ intersection_ex(const Slic3r::Polygons &subject, const Slic3r::Polygons &clip, b
 inline Slic3r::ExPolygons
 intersection_ex(const Slic3r::ExPolygons &subject, const Slic3r::ExPolygons &clip, bool safety_offset_ = false)
 {
-    return _clipper_ex(ClipperLib::ctIntersection, to_polygons(subject), to_polygons(clip), safety_offset_);
+    return _clipper_ex(ClipperLib::ctIntersection, subject, clip, safety_offset_);
 }
 
 inline Slic3r::Polygons
 intersection(const Slic3r::ExPolygons &subject, const Slic3r::ExPolygons &clip, bool safety_offset_ = false)
 {
-    return _clipper(ClipperLib::ctIntersection, to_polygons(subject), to_polygons(clip), safety_offset_);
+    return _clipper(ClipperLib::ctIntersection, subject, clip, safety_offset_);
 }
 
 inline Slic3r::Polylines
@@ -205,12 +291,12 @@ inline Slic3r::ExPolygons union_ex(const Slic3r::Polygons &subject, bool safety_
 
 inline Slic3r::ExPolygons union_ex(const Slic3r::ExPolygons &subject, bool safety_offset_ = false)
 {
-    return _clipper_ex(ClipperLib::ctUnion, to_polygons(subject), Slic3r::Polygons(), safety_offset_);
+    return _clipper_ex(ClipperLib::ctUnion, subject, Slic3r::ExPolygons(), safety_offset_);
 }
 
 inline Slic3r::ExPolygons union_ex(const Slic3r::Surfaces &subject, bool safety_offset_ = false)
 {
-    return _clipper_ex(ClipperLib::ctUnion, to_polygons(subject), Slic3r::Polygons(), safety_offset_);
+    return _clipper_ex(ClipperLib::ctUnion, subject, safety_offset_);
 }
 
 
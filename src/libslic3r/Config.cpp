@@ -333,9 +333,32 @@ void ConfigBase::apply_only(const ConfigBase &other, const t_config_option_keys
     }
 }
 
+void ConfigBase::apply_only(const ConfigBase &other, const ConfigOptionIdSet &ids, bool ignore_nonexistent)
+{
+    const ConfigDef *def = this->def();
+    if (def == nullptr)
+        throw NoDefinitionException();
+    ids.for_each([this, &other, def, ignore_nonexistent](size_t id) {
+        const ConfigOptionDef &optdef = *def->by_id()[id];
+        ConfigOption *my_opt = this->optptr_by_def(optdef, true);
+        if (my_opt == nullptr) {
+            if (ignore_nonexistent)
+                return;
+            throw UnknownOptionException(optdef.opt_key);
+        }
+        const ConfigOption *other_opt = const_cast<ConfigBase&>(other).optptr_by_def(optdef);
+        if (other_opt != nullptr)
+            my_opt->set(other_opt);
+    });
+}
+
 // this will *ignore* options not present in both configs
 t_config_option_keys ConfigBase::diff(const ConfigBase &other) const
 {
+    if (this->option_ids() != nullptr)
+        // Static configuration store, all its options are defined by this->def(). The keys are sorted as this->keys().
+        return this->def()->keys(this->diff_ids(other));
+
     t_config_option_keys diff;
     for (const t_config_option_key &opt_key : this->keys()) {
         const ConfigOption *this_opt  = this->option(opt_key);
@@ -346,6 +369,30 @@ t_config_option_keys ConfigBase::diff(const ConfigBase &other) const
     return diff;
 }
 
+ConfigOptionIdSet ConfigBase::diff_ids(const ConfigBase &other) const
+{
+    const ConfigDef *def = this->def();
+    if (def == nullptr)
+        throw NoDefinitionException();
+    ConfigOptionIdSet diff(def->by_id().size());
+    auto compare = [this, &other, def, &diff](size_t id) {
+        const ConfigOptionDef &optdef    = *def->by_id()[id];
+        const ConfigOption    *this_opt  = const_cast<ConfigBase*>(this)->optptr_by_def(optdef);
+        const ConfigOption    *other_opt = const_cast<ConfigBase&>(other).optptr_by_def(optdef);
+        if (this_opt != nullptr && other_opt != nullptr && *this_opt != *other_opt)
+            diff.insert(id);
+    };
+    if (const ConfigOptionIdSet *ids = this->option_ids())
+        ids->for_each(compare);
+    else
+        for (const t_config_option_key &opt_key : this->keys()) {
+            const ConfigOptionDef *optdef = def->get(opt_key);
+            if (optdef != nullptr)
+                compare(optdef->id);
+        }
+    return diff;
+}
+
 t_config_option_keys ConfigBase::equal(const ConfigBase &other) const
 {
     t_config_option_keys equal;
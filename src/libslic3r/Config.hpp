@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <map>
 #include <climits>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
@@ -1008,6 +1009,10 @@ public:
 class ConfigOptionDef
 {
 public:
+    // Name of this option, the key of this definition in ConfigDef::options.
+    t_config_option_key                 opt_key;
+    // Dense index of this option in its ConfigDef, see ConfigDef::by_id().
+    size_t                              id              = size_t(-1);
     // What type? bool, int, string etc.
     ConfigOptionType                    type            = coNone;
     // Default value of this option. The default value object is owned by ConfigDef, it is released in its destructor.
@@ -1097,12 +1102,57 @@ public:
 // t_config_option_key is std::string
 typedef std::map<t_config_option_key, ConfigOptionDef> t_optiondef_map;
 
+// Set of config options of a single ConfigDef given by their ConfigOptionDef::id.
+class ConfigOptionIdSet
+{
+public:
+    ConfigOptionIdSet() {}
+    explicit ConfigOptionIdSet(size_t num_ids) : m_bits((num_ids + 63) / 64, 0) {}
+
+    void    insert(size_t id) {
+        if (id / 64 >= m_bits.size())
+            m_bits.resize(id / 64 + 1, 0);
+        m_bits[id / 64] |= uint64_t(1) << (id % 64);
+    }
+    bool    contains(size_t id) const { return id / 64 < m_bits.size() && ((m_bits[id / 64] >> (id % 64)) & 1) != 0; }
+    bool    empty() const {
+        for (uint64_t w : m_bits)
+            if (w != 0)
+                return false;
+        return true;
+    }
+    size_t  size() const {
+        size_t n = 0;
+        for (uint64_t w : m_bits)
+            for (; w != 0; w &= w - 1)
+                ++ n;
+        return n;
+    }
+    // Call fn(id) for all ids of the set in ascending order.
+    template<typename FN> void for_each(FN fn) const {
+        for (size_t i = 0; i < m_bits.size(); ++ i)
+            for (uint64_t w = m_bits[i], id = i * 64; w != 0; w >>= 1, ++ id)
+                if (w & 1)
+                    fn(size_t(id));
+    }
+
+private:
+    std::vector<uint64_t> m_bits;
+};
+
 // Definition of configuration values for the purpose of GUI presentation, editing, value mapping and config file handling.
 // The configuration definition is static: It does not carry the actual configuration values,
 // but it carries the defaults of the configuration values.
 class ConfigDef
 {
 public:
+    ConfigDef() {}
+    // by_id() points into the options map, therefore it is rebuilt for the copied or moved map. The ids are kept.
+    ConfigDef(const ConfigDef &rhs) : options(rhs.options) { this->update_by_id(); }
+    ConfigDef(ConfigDef &&rhs) : options(std::move(rhs.options)) { rhs.clear(); this->update_by_id(); }
+    ConfigDef& operator=(const ConfigDef &rhs) { this->options = rhs.options; this->update_by_id(); return *this; }
+    ConfigDef& operator=(ConfigDef &&rhs) { this->options = std::move(rhs.options); rhs.clear(); this->update_by_id(); return *this; }
+
     t_optiondef_map         options;
 
     bool                    has(const t_config_option_key &opt_key) const { return this->options.count(opt_key) > 0; }
@@ -1117,6 +1167,16 @@ public:
             out.push_back(kvp.first);
         return out;
     }
+    // Keys of the options of the set, sorted.
+    std::vector<std::string> keys(const ConfigOptionIdSet &ids) const {
+        std::vector<std::string> out;
+        for (auto const& kvp : options)
+            if (ids.contains(kvp.second.id))
+                out.push_back(kvp.first);
+        return out;
+    }
+    // Definitions indexed by ConfigOptionDef::id.
+    const std::vector<const ConfigOptionDef*>& by_id() const { return m_by_id; }
 
     /// Iterate through all of the CLI options and write them to a stream.
     std::ostream&           print_cli_help(
@@ -1125,10 +1185,42 @@ public:
 
 protected:
     ConfigOptionDef*        add(const t_config_option_key &opt_key, ConfigOptionType type) {
-        ConfigOptionDef* opt = &this->options[opt_key];
-        opt->type = type;
-        return opt;
+        auto it = this->options.find(opt_key);
+        if (it == this->options.end()) {
+            it = this->options.emplace(opt_key, ConfigOptionDef()).first;
+            it->second.opt_key = opt_key;
+            it->second.id      = m_by_id.size();
+            m_by_id.emplace_back(&it->second);
+        }
+        it->second.type = type;
+        return &it->second;
+    }
+    // To be called at the end of the constructor of a derived ConfigDef: Numbers the options in the order of their keys,
+    // also if the options were copied over from another ConfigDef.
+    void                    assign_ids() {
+        m_by_id.clear();
+        m_by_id.reserve(this->options.size());
+        for (auto &kvp : this->options) {
+            kvp.second.opt_key = kvp.first;
+            kvp.second.id      = m_by_id.size();
+            m_by_id.emplace_back(&kvp.second);
+        }
     }
+
+private:
+    void                    clear() {
+        this->options.clear();
+        m_by_id.clear();
+    }
+    void                    update_by_id() {
+        m_by_id.assign(this->options.size(), nullptr);
+        for (auto &kvp : this->options) {
+            assert(kvp.second.id < m_by_id.size() && m_by_id[kvp.second.id] == nullptr);
+            m_by_id[kvp.second.id] = &kvp.second;
+        }
+    }
+
+    std::vector<const ConfigOptionDef*> m_by_id;
 };
 
 // An abstract configuration store.
@@ -1150,6 +1242,12 @@ public:
     virtual ConfigOption*           optptr(const t_config_option_key &opt_key, bool create = false) = 0;
     // Collect names of all configuration values maintained by this configuration store.
     virtual t_config_option_keys    keys() const = 0;
+    // Find a ConfigOption instance given its definition, which shall be a definition of this->def().
+    // Static configuration stores resolve the definition by its id, the others by its key.
+    virtual ConfigOption*           optptr_by_def(const ConfigOptionDef &optdef, bool create = false) { return this->optptr(optdef.opt_key, create); }
+    // Ids of all configuration values maintained by this configuration store, if it is a static configuration store
+    // holding a fixed set of options of this->def(). Returns nullptr otherwise.
+    virtual const ConfigOptionIdSet* option_ids() const { return nullptr; }
 protected:
     // Verify whether the opt_key has not been obsoleted or renamed.
     // Both opt_key and value may be modified by handle_legacy().
@@ -1194,8 +1292,13 @@ public:
     // An UnknownOptionException is thrown in case some option keys are not defined by this->def(),
     // or this ConfigBase is of a StaticConfig type and it does not support some of the keys, and ignore_nonexistent is not set.
     void apply_only(const ConfigBase &other, const t_config_option_keys &keys, bool ignore_nonexistent = false);
+    // Apply the options of other enumerated by their ids in this->def().
+    void apply_only(const ConfigBase &other, const ConfigOptionIdSet &ids, bool ignore_nonexistent = false);
     bool equals(const ConfigBase &other) const { return this->diff(other).empty(); }
     t_config_option_keys diff(const ConfigBase &other) const;
+    // Ids of the options of this->def() differing between this and other. Only the options present in both configs
+    // and defined by this->def() are compared.
+    ConfigOptionIdSet    diff_ids(const ConfigBase &other) const;
     t_config_option_keys equal(const ConfigBase &other) const;
     std::string serialize(const t_config_option_key &opt_key) const;
     // Set a configuration value from a string, it will call an overridable handle_legacy() 
@@ -5,6 +5,8 @@
 #include "Polygon.hpp"
 #include "Polyline.hpp"
 
+#include <memory>
+
 namespace Slic3r {
 
 class ExPolygonCollection;
@@ -208,11 +210,27 @@ public:
     double total_volume() const override { double volume =0.; for (const auto& path : paths) volume += path.total_volume(); return volume; }
 };
 
+// Seam of an ExtrusionLoop scored ahead of the G-code export by GCode::prepare_layer(), to be placed by GCode::extrude_loop().
+struct ExtrusionLoopSeam
+{
+    // Winding of the loop, the penalties are assigned to the vertices of its counter clockwise polygon().
+    bool                was_clockwise = false;
+    // Penalties for the visibility of a seam at the vertices.
+    std::vector<float>  visibility;
+    // Penalties for a seam above an overhang at the vertices, empty if there is no layer below.
+    std::vector<float>  overhang;
+    // The seam does not depend on the position of the extruder (rear seam) and it has been placed already.
+    bool                placed = false;
+    Point               seam;
+};
+
 // Single continuous extrusion loop, possibly with varying extrusion thickness, extrusion height or bridging / non bridging.
 class ExtrusionLoop : public ExtrusionEntity
 {
 public:
     ExtrusionPaths paths;
+    // Seam scored ahead of the G-code export, null if the seam is to be scored by GCode::extrude_loop().
+    std::shared_ptr<const ExtrusionLoopSeam> seam;
     
     ExtrusionLoop(ExtrusionLoopRole role = elrDefault) : m_loop_role(role) {};
     ExtrusionLoop(const ExtrusionPaths &paths, ExtrusionLoopRole role = elrDefault) : paths(paths), m_loop_role(role) {};
@@ -1,7 +1,7 @@
 #include "ExtrusionEntityCollection.hpp"
+#include "ShortestPath.hpp"
 #include <algorithm>
 #include <cmath>
-#include <map>
 
 namespace Slic3r {
 
@@ -108,54 +108,80 @@ void ExtrusionEntityCollection::chained_path_from(Point start_near, ExtrusionEnt
         *retval = *this;
         return;
     }
-    retval->entities.reserve(this->entities.size());
-    retval->orig_indices.reserve(this->entities.size());
-    
-    // if we're asked to return the original indices, build a map
-    std::map<ExtrusionEntity*,size_t> indices_map;
-    
-    ExtrusionEntitiesPtr my_paths;
-    for (ExtrusionEntitiesPtr::const_iterator it = this->entities.begin(); it != this->entities.end(); ++it) {
+    ChainOrder order = this->chained_order_from(start_near, no_reverse, role);
+    retval->entities.reserve(retval->entities.size() + order.size());
+    if (orig_indices != nullptr)
+        orig_indices->reserve(orig_indices->size() + order.size());
+    // Only the entities picked are cloned, each of them once.
+    for (const std::pair<size_t, bool> &o : order) {
+        ExtrusionEntity *entity = this->entities[o.first]->clone();
+        if (o.second)
+            entity->reverse();
+        retval->entities.push_back(entity);
+        if (orig_indices != nullptr)
+            orig_indices->push_back(o.first);
+    }
+}
+
+template<typename EntityRef>
+static inline ChainSegment extrusion_chain_segment(const EntityRef &entity, bool no_reverse)
+{
+    // never reverse loops, since it's pointless for chained path and callers might depend on orientation
+    // The chain continues from the last point of the entity even if the entity is not reversible.
+    return { entity.first_point(), entity.last_point(), ! no_reverse && entity.can_reverse() };
+}
+
+ChainOrder ExtrusionEntityCollection::chained_order_from(const Point &start_near, bool no_reverse, ExtrusionRole role) const
+{
+    ChainOrder order;
+    if (this->no_sort) {
+        order.reserve(this->entities.size());
+        for (size_t i = 0; i < this->entities.size(); ++ i)
+            order.emplace_back(i, false);
+        return order;
+    }
+
+    std::vector<size_t>       indices;
+    std::vector<ChainSegment> segments;
+    indices.reserve(this->entities.size());
+    segments.reserve(this->entities.size());
+    for (size_t i = 0; i < this->entities.size(); ++ i) {
+        const ExtrusionEntity *entity = this->entities[i];
         if (role != erMixed) {
             // The caller wants only paths with a specific extrusion role.
-            auto role2 = (*it)->role();
+            auto role2 = entity->role();
             if (role != role2) {
                 // This extrusion entity does not match the role asked.
                 assert(role2 != erMixed);
                 continue;
             }
         }
-
-        ExtrusionEntity* entity = (*it)->clone();
-        my_paths.push_back(entity);
-        if (orig_indices != NULL) indices_map[entity] = it - this->entities.begin();
+        indices.push_back(i);
+        segments.push_back(extrusion_chain_segment(*entity, no_reverse));
     }
-    
-    Points endpoints;
-    for (ExtrusionEntitiesPtr::iterator it = my_paths.begin(); it != my_paths.end(); ++it) {
-        endpoints.push_back((*it)->first_point());
-        if (no_reverse || !(*it)->can_reverse()) {
-            endpoints.push_back((*it)->first_point());
-        } else {
-            endpoints.push_back((*it)->last_point());
-        }
-    }
-    
-    while (!my_paths.empty()) {
-        // find nearest point
-        int start_index = start_near.nearest_point_index(endpoints);
-        int path_index = start_index/2;
-        ExtrusionEntity* entity = my_paths.at(path_index);
-        // never reverse loops, since it's pointless for chained path and callers might depend on orientation
-        if (start_index % 2 && !no_reverse && entity->can_reverse()) {
-            entity->reverse();
-        }
-        retval->entities.push_back(my_paths.at(path_index));
-        if (orig_indices != NULL) orig_indices->push_back(indices_map[entity]);
-        my_paths.erase(my_paths.begin() + path_index);
-        endpoints.erase(endpoints.begin() + 2*path_index, endpoints.begin() + 2*path_index + 2);
-        start_near = retval->entities.back()->last_point();
+
+    order = chain_segments_greedy(segments, start_near, ChainTies::PreferLast);
+    for (std::pair<size_t, bool> &o : order)
+        o.first = indices[o.first];
+    return order;
+}
+
+void chain_extrusion_paths(ExtrusionPaths &paths, bool no_reverse)
+{
+    if (paths.empty())
+        return;
+    std::vector<ChainSegment> segments;
+    segments.reserve(paths.size());
+    for (const ExtrusionPath &path : paths)
+        segments.push_back(extrusion_chain_segment(path, no_reverse));
+    ExtrusionPaths out;
+    out.reserve(paths.size());
+    for (const std::pair<size_t, bool> &o : chain_segments_greedy(segments, paths.front().first_point(), ChainTies::PreferLast)) {
+        out.emplace_back(std::move(paths[o.first]));
+        if (o.second)
+            out.back().reverse();
     }
+    paths = std::move(out);
 }
 
 void ExtrusionEntityCollection::polygons_covered_by_width(Polygons &out, const float scaled_epsilon) const
@@ -190,13 +216,12 @@ ExtrusionEntityCollection::items_count() const
 void
 ExtrusionEntityCollection::flatten(ExtrusionEntityCollection* retval) const
 {
+    // The nested collections are flattened directly into retval, so that each item is cloned once.
     for (ExtrusionEntitiesPtr::const_iterator it = this->entities.begin(); it != this->entities.end(); ++it) {
-        if ((*it)->is_collection()) {
-            ExtrusionEntityCollection* collection = dynamic_cast<ExtrusionEntityCollection*>(*it);
-            retval->append(collection->flatten().entities);
-        } else {
+        if ((*it)->is_collection())
+            static_cast<const ExtrusionEntityCollection*>(*it)->flatten(retval);
+        else
             retval->append(**it);
-        }
     }
 }
 
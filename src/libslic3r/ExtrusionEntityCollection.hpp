@@ -3,6 +3,7 @@
 
 #include "libslic3r.h"
 #include "ExtrusionEntity.hpp"
+#include "ShortestPath.hpp"
 
 namespace Slic3r {
 
@@ -66,6 +67,9 @@ public:
     void chained_path(ExtrusionEntityCollection* retval, bool no_reverse = false, ExtrusionRole role = erMixed, std::vector<size_t>* orig_indices = nullptr) const;
     ExtrusionEntityCollection chained_path_from(Point start_near, bool no_reverse = false, ExtrusionRole role = erMixed) const;
     void chained_path_from(Point start_near, ExtrusionEntityCollection* retval, bool no_reverse = false, ExtrusionRole role = erMixed, std::vector<size_t>* orig_indices = nullptr) const;
+    // Order of the entities chained by chained_path_from(), without cloning them: Pairs of an index into this->entities
+    // and a flag whether the entity shall be extruded reversed. The entities with a role other than the one asked are skipped.
+    ChainOrder chained_order_from(const Point &start_near, bool no_reverse = false, ExtrusionRole role = erMixed) const;
     void reverse();
     Point first_point() const { return this->entities.front()->first_point(); }
     Point last_point() const { return this->entities.back()->last_point(); }
@@ -81,6 +85,7 @@ public:
     Polygons polygons_covered_by_spacing(const float scaled_epsilon = 0.f) const
         { Polygons out; this->polygons_covered_by_spacing(out, scaled_epsilon); return out; }
     size_t items_count() const;
+    // Appends copies of all non-collection items contained in this one to retval.
     void flatten(ExtrusionEntityCollection* retval) const;
     ExtrusionEntityCollection flatten() const;
     double min_mm3_per_mm() const;
@@ -103,6 +108,9 @@ public:
     }
 };
 
+// Reorder the paths in place by the greedy chaining of ExtrusionEntityCollection::chained_path(), reversing them as needed.
+void chain_extrusion_paths(ExtrusionPaths &paths, bool no_reverse = false);
+
 }
 
 #endif
@@ -6,6 +6,9 @@
 
 #include "3mf.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <limits>
 
 #include <boost/algorithm/string/classification.hpp>
@@ -15,6 +18,9 @@
 #include <boost/nowide/fstream.hpp>
 #include <boost/nowide/cstdio.hpp>
 
+#include <tbb/pipeline.h>
+#include <tbb/task_scheduler_init.h>
+
 #include <expat.h>
 #include <Eigen/Dense>
 #include "miniz_extension.hpp"
@@ -77,6 +83,12 @@ const char* NAME_KEY = "name";
 const char* MODIFIER_KEY = "modifier";
 const char* VOLUME_TYPE_KEY = "volume_type";
 
+// Number of vertices or triangles formatted into a single block of the model file, see add_mesh_blocks_to_archive().
+const size_t MESH_BLOCK_SIZE = 16384;
+// Upper bounds of the lengths of the lines of the vertices and triangles of the model file.
+const size_t MAX_VERTEX_LINE_LENGTH = 80;
+const size_t MAX_TRIANGLE_LINE_LENGTH = 80;
+
 const unsigned int VALID_OBJECT_TYPES_COUNT = 1;
 const char* VALID_OBJECT_TYPES[] =
 {
@@ -112,16 +124,113 @@ std::string get_attribute_value_string(const char** attributes, unsigned int att
     return (text != nullptr) ? text : "";
 }
 
+// Converts the text to float the same way as (float)::atof(), which it falls back to unless the number has at most
+// 19 significant digits and fits into the mantissa of a double with a decimal exponent within [-22, 22]. Then a single
+// correctly rounded multiplication or division gives the same double as strtod() (Clinger's fast path).
+// This is the case of all the coordinates written by the exporter.
+float parse_float(const char* text)
+{
+    static const double pow10[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    const char* c = text;
+    while ((*c == ' ') || ((*c >= '\t') && (*c <= '\r')))
+        ++c;
+
+    bool negative = (*c == '-');
+    if ((*c == '-') || (*c == '+'))
+        ++c;
+
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    bool in_fraction = false;
+    for (;; ++c)
+    {
+        if ((*c == '.') && !in_fraction)
+        {
+            in_fraction = true;
+            continue;
+        }
+        if ((*c < '0') || (*c > '9'))
+            break;
+        has_digits = true;
+        // leading zeros are not significant
+        if ((mantissa != 0) || (*c != '0'))
+        {
+            if (++num_digits > 19)
+                return (float)::atof(text);
+            mantissa = mantissa * 10 + (uint64_t)(*c - '0');
+        }
+        if (in_fraction)
+            --exponent;
+    }
+
+    // inf, nan, hexadecimal numbers and the like
+    if (!has_digits || (*c == 'x') || (*c == 'X'))
+        return (float)::atof(text);
+
+    if ((*c == 'e') || (*c == 'E'))
+    {
+        const char* e = c + 1;
+        bool negative_exponent = (*e == '-');
+        if ((*e == '-') || (*e == '+'))
+            ++e;
+        // without digits the 'e' is not a part of the number
+        if ((*e >= '0') && (*e <= '9'))
+        {
+            int value = 0;
+            for (; (*e >= '0') && (*e <= '9'); ++e)
+            {
+                if (value > 1000)
+                    return (float)::atof(text);
+                value = value * 10 + (*e - '0');
+            }
+            exponent += negative_exponent ? -value : value;
+        }
+    }
+
+    if ((mantissa > (uint64_t(1) << 53)) || (exponent < -22) || (exponent > 22))
+        return (float)::atof(text);
+
+    double value = (exponent < 0) ? (double)mantissa / pow10[-exponent] : (double)mantissa * pow10[exponent];
+    return (float)(negative ? -value : value);
+}
+
+// Converts the text to int the same way as ::atoi() for the values in range.
+int parse_int(const char* text)
+{
+    const char* c = text;
+    while ((*c == ' ') || ((*c >= '\t') && (*c <= '\r')))
+        ++c;
+
+    bool negative = (*c == '-');
+    if ((*c == '-') || (*c == '+'))
+        ++c;
+
+    unsigned int value = 0;
+    for (; (*c >= '0') && (*c <= '9'); ++c)
+    {
+        value = value * 10 + (unsigned int)(*c - '0');
+    }
+
+    return negative ? -(int)value : (int)value;
+}
+
 float get_attribute_value_float(const char** attributes, unsigned int attributes_size, const char* attribute_key)
 {
     const char* text = get_attribute_value_charptr(attributes, attributes_size, attribute_key);
-    return (text != nullptr) ? (float)::atof(text) : 0.0f;
+    return (text != nullptr) ? parse_float(text) : 0.0f;
 }
 
 int get_attribute_value_int(const char** attributes, unsigned int attributes_size, const char* attribute_key)
 {
     const char* text = get_attribute_value_charptr(attributes, attributes_size, attribute_key);
-    return (text != nullptr) ? ::atoi(text) : 0;
+    return (text != nullptr) ? parse_int(text) : 0;
 }
 
 Slic3r::Transform3d get_transform_from_string(const std::string& mat_str)
@@ -186,6 +295,154 @@ bool is_valid_object_type(const std::string& type)
     return false;
 }
 
+// Formats an unsigned integer into buf, returns the end of the formatted text.
+char* format_uint(unsigned int value, char* buf)
+{
+    char digits[10];
+    char* d = digits;
+    do {
+        *d++ = char('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    while (d != digits)
+        *buf++ = *--d;
+    return buf;
+}
+
+// Formats a float into buf with the least number of significant digits, which are read back by the 3MF importer
+// as (float)atof() to the same float, returns the end of the formatted text. buf has to hold at least 16 characters.
+// The numbers from 1e-4 to 1e9 are printed in the fixed point notation, the others by snprintf() with max_digits10.
+char* format_float(float value, char* buf)
+{
+    // Powers of ten up to 1e22 are exact in double precision.
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12 };
+    static const uint64_t ipow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+    const int max_digits = std::numeric_limits<float>::max_digits10;
+
+    if (value == 0.f) {
+        if (std::signbit(value))
+            *buf++ = '-';
+        *buf++ = '0';
+        return buf;
+    }
+
+    double a = std::abs(double(value));
+    int    e10 = 0;
+    if (std::isfinite(value)) {
+        // Estimate the decimal exponent from the binary one, it may be one less than the right one.
+        int e2;
+        std::frexp(a, &e2);
+        e10 = int(std::floor(double(e2 - 1) * 0.30102999566398120));
+        if (e10 >= -5 && e10 < max_digits && (e10 >= 0 ? a >= pow10[e10 + 1] : a >= 1. / pow10[- e10 - 1]))
+            ++ e10;
+    }
+    if (std::isfinite(value) && e10 >= -4 && e10 < max_digits) {
+        // Round the significant digits to num_digits. Both the scaling and the conversion back to the float
+        // are single operations over exactly represented numbers, therefore the conversion back is rounded
+        // the same way as strtod() would round the formatted number. Returns false if it is not read back as value.
+        uint64_t digits;
+        int      e;
+        auto round_to = [a, e10, &digits, &e](int num_digits) {
+            int    exp    = num_digits - 1 - e10;
+            double scaled = (exp >= 0) ? a * pow10[exp] : a / pow10[- exp];
+            digits = uint64_t(scaled + 0.5);
+            e      = e10;
+            if (digits == ipow10[num_digits]) {
+                // Rounded up to the next power of ten.
+                digits /= 10;
+                ++ e;
+                -- exp;
+            }
+            return float((exp >= 0) ? double(digits) / pow10[exp] : double(digits) * pow10[- exp]) == float(a);
+        };
+        // If a number of digits is read back as value, so is any higher number of digits. Bisect the number of digits.
+        int num_digits = max_digits;
+        if (round_to(num_digits)) {
+            for (int lo = 0; num_digits - lo > 1;) {
+                int mid = (lo + num_digits) / 2;
+                if (round_to(mid))
+                    num_digits = mid;
+                else
+                    lo = mid;
+            }
+            round_to(num_digits);
+        } else
+            e = max_digits;
+        if (e < max_digits) {
+            // Format the digits in the fixed point notation.
+            char  text[16];
+            char* end = text + num_digits;
+            for (char* d = end; d != text; digits /= 10)
+                *--d = char('0' + digits % 10);
+            // Strip the trailing zeros of the fraction.
+            while (end - text > std::max(e + 1, 1) && end[-1] == '0')
+                -- end;
+            if (value < 0.f)
+                *buf++ = '-';
+            if (e < 0) {
+                *buf++ = '0';
+                *buf++ = '.';
+                for (int i = -1; i > e; -- i)
+                    *buf++ = '0';
+                for (const char* d = text; d != end; ++ d)
+                    *buf++ = *d;
+            } else {
+                const char* d = text;
+                for (int i = 0; i <= e; ++ i)
+                    *buf++ = (d != end) ? *d++ : '0';
+                if (d != end) {
+                    *buf++ = '.';
+                    while (d != end)
+                        *buf++ = *d++;
+                }
+            }
+            return buf;
+        }
+    }
+
+    return buf + ::snprintf(buf, 16, "%.*g", max_digits, double(value));
+}
+
+// Writes the text accumulated in stream into a file being added to a ZIP archive and empties the stream.
+bool flush_stream_to_archive(Slic3r::ZipFileWriter& file, std::stringstream& stream)
+{
+    std::string out = stream.str();
+    stream.str(std::string());
+    return file.add(out);
+}
+
+// Formats num_items vertices or triangles by blocks of MESH_BLOCK_SIZE items by calling format_block(out, begin, end)
+// and writes the blocks in order into a file being added to a ZIP archive. The blocks are formatted in parallel,
+// only a few blocks per thread are held in memory at once.
+bool add_mesh_blocks_to_archive(Slic3r::ZipFileWriter& file, size_t num_items, const std::function<void(std::string&, size_t, size_t)>& format_block)
+{
+    bool   ok = true;
+    size_t next_block = 0;
+    tbb::parallel_pipeline(2 * tbb::task_scheduler_init::default_num_threads(),
+        tbb::make_filter<void, size_t>(tbb::filter::serial_in_order,
+            [&next_block, &ok, num_items](tbb::flow_control& fc) -> size_t {
+                if (! ok || next_block >= num_items) {
+                    fc.stop();
+                    return num_items;
+                }
+                size_t begin = next_block;
+                next_block += MESH_BLOCK_SIZE;
+                return begin;
+            }) &
+        tbb::make_filter<size_t, std::string>(tbb::filter::parallel,
+            [&format_block, num_items](size_t begin) -> std::string {
+                std::string out;
+                format_block(out, begin, std::min(begin + MESH_BLOCK_SIZE, num_items));
+                return out;
+            }) &
+        tbb::make_filter<std::string, void>(tbb::filter::serial_in_order,
+            [&file, &ok](const std::string& out) {
+                if (ok && ! file.add(out))
+                    ok = false;
+            }));
+    return ok;
+}
+
 namespace Slic3r {
 
     // Base class with error messages management
@@ -369,6 +626,8 @@ namespace Slic3r {
 
         void _extract_print_config_from_archive(mz_zip_archive& archive, const mz_zip_archive_file_stat& stat, DynamicPrintConfig& config, const std::string& archive_filename);
         bool _extract_model_config_from_archive(mz_zip_archive& archive, const mz_zip_archive_file_stat& stat, Model& model);
+        // feeds the given file of the archive to the current xml parser, reports read_error if the file cannot be read
+        bool _parse_xml_from_archive(mz_zip_archive& archive, const mz_zip_archive_file_stat& stat, const char* read_error);
 
         // handlers to parse the .model file
         void _handle_start_model_xml_element(const char* name, const char** attributes);
@@ -658,29 +917,7 @@ namespace Slic3r {
         XML_SetElementHandler(m_xml_parser, _3MF_Importer::_handle_start_model_xml_element, _3MF_Importer::_handle_end_model_xml_element);
         XML_SetCharacterDataHandler(m_xml_parser, _3MF_Importer::_handle_model_xml_characters);
 
-        void* parser_buffer = XML_GetBuffer(m_xml_parser, (int)stat.m_uncomp_size);
-        if (parser_buffer == nullptr)
-        {
-            add_error("Unable to create buffer");
-            return false;
-        }
-
-        mz_bool res = mz_zip_reader_extract_file_to_mem(&archive, stat.m_filename, parser_buffer, (size_t)stat.m_uncomp_size, 0);
-        if (res == 0)
-        {
-            add_error("Error while reading model data to buffer");
-            return false;
-        }
-
-        if (!XML_ParseBuffer(m_xml_parser, (int)stat.m_uncomp_size, 1))
-        {
-            char error_buf[1024];
-            ::sprintf(error_buf, "Error (%s) while parsing xml file at line %d", XML_ErrorString(XML_GetErrorCode(m_xml_parser)), XML_GetCurrentLineNumber(m_xml_parser));
-            add_error(error_buf);
-            return false;
-        }
-
-        return true;
+        return _parse_xml_from_archive(archive, stat, "Error while reading model data");
     }
 
     void _3MF_Importer::_extract_print_config_from_archive(mz_zip_archive& archive, const mz_zip_archive_file_stat& stat, DynamicPrintConfig& config, const std::string& archive_filename)
@@ -878,25 +1115,26 @@ namespace Slic3r {
         XML_SetUserData(m_xml_parser, (void*)this);
         XML_SetElementHandler(m_xml_parser, _3MF_Importer::_handle_start_config_xml_element, _3MF_Importer::_handle_end_config_xml_element);
 
-        void* parser_buffer = XML_GetBuffer(m_xml_parser, (int)stat.m_uncomp_size);
-        if (parser_buffer == nullptr)
-        {
-            add_error("Unable to create buffer");
-            return false;
-        }
+        return _parse_xml_from_archive(archive, stat, "Error while reading config data");
+    }
 
-        mz_bool res = mz_zip_reader_extract_file_to_mem(&archive, stat.m_filename, parser_buffer, (size_t)stat.m_uncomp_size, 0);
-        if (res == 0)
-        {
-            add_error("Error while reading config data to buffer");
-            return false;
-        }
+    bool _3MF_Importer::_parse_xml_from_archive(mz_zip_archive& archive, const mz_zip_archive_file_stat& stat, const char* read_error)
+    {
+        // the file is inflated and parsed by blocks, it is never extracted to memory as a whole
+        bool res = extract_zip_file_by_blocks(&archive, stat.m_file_index, [this](const char* data, size_t size, bool last) {
+            return XML_Parse(m_xml_parser, data, (int)size, last ? 1 : 0) != XML_STATUS_ERROR;
+        });
 
-        if (!XML_ParseBuffer(m_xml_parser, (int)stat.m_uncomp_size, 1))
+        if (!res)
         {
-            char error_buf[1024];
-            ::sprintf(error_buf, "Error (%s) while parsing xml file at line %d", XML_ErrorString(XML_GetErrorCode(m_xml_parser)), XML_GetCurrentLineNumber(m_xml_parser));
-            add_error(error_buf);
+            if (XML_GetErrorCode(m_xml_parser) != XML_ERROR_NONE)
+            {
+                char error_buf[1024];
+                ::sprintf(error_buf, "Error (%s) while parsing xml file at line %d", XML_ErrorString(XML_GetErrorCode(m_xml_parser)), XML_GetCurrentLineNumber(m_xml_parser));
+                add_error(error_buf);
+            }
+            else
+                add_error(read_error);
             return false;
         }
 
@@ -1175,9 +1413,21 @@ namespace Slic3r {
     {
         // appends the vertex coordinates
         // missing values are set equal to ZERO
-        m_curr_object.geometry.vertices.push_back(m_unit_factor * get_attribute_value_float(attributes, num_attributes, X_ATTR));
-        m_curr_object.geometry.vertices.push_back(m_unit_factor * get_attribute_value_float(attributes, num_attributes, Y_ATTR));
-        m_curr_object.geometry.vertices.push_back(m_unit_factor * get_attribute_value_float(attributes, num_attributes, Z_ATTR));
+        // the attributes are walked once, there is one vertex element per vertex of the mesh
+        float coords[3] = { 0.0f, 0.0f, 0.0f };
+        for (unsigned int a = 0; a + 1 < num_attributes; a += 2)
+        {
+            if (::strcmp(attributes[a], X_ATTR) == 0)
+                coords[0] = parse_float(attributes[a + 1]);
+            else if (::strcmp(attributes[a], Y_ATTR) == 0)
+                coords[1] = parse_float(attributes[a + 1]);
+            else if (::strcmp(attributes[a], Z_ATTR) == 0)
+                coords[2] = parse_float(attributes[a + 1]);
+        }
+
+        m_curr_object.geometry.vertices.push_back(m_unit_factor * coords[0]);
+        m_curr_object.geometry.vertices.push_back(m_unit_factor * coords[1]);
+        m_curr_object.geometry.vertices.push_back(m_unit_factor * coords[2]);
         return true;
     }
 
@@ -1211,9 +1461,20 @@ namespace Slic3r {
 
         // appends the triangle's vertices indices
         // missing values are set equal to ZERO
-        m_curr_object.geometry.triangles.push_back((unsigned int)get_attribute_value_int(attributes, num_attributes, V1_ATTR));
-        m_curr_object.geometry.triangles.push_back((unsigned int)get_attribute_value_int(attributes, num_attributes, V2_ATTR));
-        m_curr_object.geometry.triangles.push_back((unsigned int)get_attribute_value_int(attributes, num_attributes, V3_ATTR));
+        int indices[3] = { 0, 0, 0 };
+        for (unsigned int a = 0; a + 1 < num_attributes; a += 2)
+        {
+            if (::strcmp(attributes[a], V1_ATTR) == 0)
+                indices[0] = parse_int(attributes[a + 1]);
+            else if (::strcmp(attributes[a], V2_ATTR) == 0)
+                indices[1] = parse_int(attributes[a + 1]);
+            else if (::strcmp(attributes[a], V3_ATTR) == 0)
+                indices[2] = parse_int(attributes[a + 1]);
+        }
+
+        m_curr_object.geometry.triangles.push_back((unsigned int)indices[0]);
+        m_curr_object.geometry.triangles.push_back((unsigned int)indices[1]);
+        m_curr_object.geometry.triangles.push_back((unsigned int)indices[2]);
         return true;
     }
 
@@ -1620,8 +1881,8 @@ namespace Slic3r {
         bool _add_content_types_file_to_archive(mz_zip_archive& archive);
         bool _add_relationships_file_to_archive(mz_zip_archive& archive);
         bool _add_model_file_to_archive(mz_zip_archive& archive, const Model& model, IdToObjectDataMap &objects_data);
-        bool _add_object_to_model_stream(std::stringstream& stream, unsigned int& object_id, ModelObject& object, BuildItemsList& build_items, VolumeToOffsetsMap& volumes_offsets);
-        bool _add_mesh_to_object_stream(std::stringstream& stream, ModelObject& object, VolumeToOffsetsMap& volumes_offsets);
+        bool _add_object_to_model_stream(ZipFileWriter& file, std::stringstream& stream, unsigned int& object_id, ModelObject& object, BuildItemsList& build_items, VolumeToOffsetsMap& volumes_offsets);
+        bool _add_mesh_to_object_stream(ZipFileWriter& file, std::stringstream& stream, ModelObject& object, VolumeToOffsetsMap& volumes_offsets);
         bool _add_build_to_model_stream(std::stringstream& stream, const BuildItemsList& build_items);
         bool _add_layer_height_profile_file_to_archive(mz_zip_archive& archive, Model& model);
         bool _add_sla_support_points_file_to_archive(mz_zip_archive& archive, Model& model);
@@ -1771,6 +2032,9 @@ namespace Slic3r {
 
 	bool _3MF_Exporter::_add_model_file_to_archive(mz_zip_archive& archive, const Model& model, IdToObjectDataMap &objects_data)
     {
+        // The model file is deflated as it is being written, so that the text of the meshes is never held in memory as a whole.
+        ZipFileWriter file(&archive, MODEL_FILE);
+
         std::stringstream stream;
         // https://en.cppreference.com/w/cpp/types/numeric_limits/max_digits10
         // Conversion of a floating-point value to text and back is exact as long as at least max_digits10 were used (9 for float, 17 for double).
@@ -1800,7 +2064,7 @@ namespace Slic3r {
             // Store geometry of all ModelVolumes contained in a single ModelObject into a single 3MF indexed triangle set object.
             // object_it->second.volumes_offsets will contain the offsets of the ModelVolumes in that single indexed triangle set.
             // object_id will be increased to point to the 1st instance of the next ModelObject.
-            if (!_add_object_to_model_stream(stream, object_id, *obj, build_items, object_it->second.volumes_offsets))
+            if (!_add_object_to_model_stream(file, stream, object_id, *obj, build_items, object_it->second.volumes_offsets))
             {
                 add_error("Unable to add object to archive");
                 return false;
@@ -1818,9 +2082,7 @@ namespace Slic3r {
 
         stream << "</" << MODEL_TAG << ">\n";
 
-        std::string out = stream.str();
-
-        if (!mz_zip_writer_add_mem(&archive, MODEL_FILE.c_str(), (const void*)out.data(), out.length(), MZ_DEFAULT_COMPRESSION))
+        if (!flush_stream_to_archive(file, stream) || !file.finish())
         {
             add_error("Unable to add model file to archive");
             return false;
@@ -1829,7 +2091,7 @@ namespace Slic3r {
         return true;
     }
 
-    bool _3MF_Exporter::_add_object_to_model_stream(std::stringstream& stream, unsigned int& object_id, ModelObject& object, BuildItemsList& build_items, VolumeToOffsetsMap& volumes_offsets)
+    bool _3MF_Exporter::_add_object_to_model_stream(ZipFileWriter& file, std::stringstream& stream, unsigned int& object_id, ModelObject& object, BuildItemsList& build_items, VolumeToOffsetsMap& volumes_offsets)
     {
         unsigned int id = 0;
         for (const ModelInstance* instance : object.instances)
@@ -1843,7 +2105,7 @@ namespace Slic3r {
 
             if (id == 0)
             {
-                if (!_add_mesh_to_object_stream(stream, object, volumes_offsets))
+                if (!_add_mesh_to_object_stream(file, stream, object, volumes_offsets))
                 {
                     add_error("Unable to add mesh to archive");
                     return false;
@@ -1870,7 +2132,7 @@ namespace Slic3r {
         return true;
     }
 
-    bool _3MF_Exporter::_add_mesh_to_object_stream(std::stringstream& stream, ModelObject& object, VolumeToOffsetsMap& volumes_offsets)
+    bool _3MF_Exporter::_add_mesh_to_object_stream(ZipFileWriter& file, std::stringstream& stream, ModelObject& object, VolumeToOffsetsMap& volumes_offsets)
     {
         stream << "   <" << MESH_TAG << ">\n";
         stream << "    <" << VERTICES_TAG << ">\n";
@@ -1899,14 +2161,25 @@ namespace Slic3r {
 
             const Transform3d& matrix = volume->get_matrix();
 
-            for (size_t i = 0; i < its.vertices.size(); ++i)
-            {
-                stream << "     <" << VERTEX_TAG << " ";
-                Vec3f v = (matrix * its.vertices[i].cast<double>()).cast<float>();
-                stream << "x=\"" << v(0) << "\" ";
-                stream << "y=\"" << v(1) << "\" ";
-                stream << "z=\"" << v(2) << "\" />\n";
-            }
+            if (!flush_stream_to_archive(file, stream) ||
+                !add_mesh_blocks_to_archive(file, its.vertices.size(), [&its, &matrix](std::string& out, size_t begin, size_t end) {
+                    const std::string prefix = std::string("     <") + VERTEX_TAG + " x=\"";
+                    char line[MAX_VERTEX_LINE_LENGTH];
+                    out.reserve((end - begin) * MAX_VERTEX_LINE_LENGTH / 2);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        Vec3f v = (matrix * its.vertices[i].cast<double>()).cast<float>();
+                        char* ptr = std::copy(prefix.begin(), prefix.end(), line);
+                        ptr = format_float(v(0), ptr);
+                        ptr = strcpy(ptr, "\" y=\"") + 5;
+                        ptr = format_float(v(1), ptr);
+                        ptr = strcpy(ptr, "\" z=\"") + 5;
+                        ptr = format_float(v(2), ptr);
+                        ptr = strcpy(ptr, "\" />\n") + 5;
+                        out.append(line, ptr - line);
+                    }
+                }))
+                return false;
         }
 
         stream << "    </" << VERTICES_TAG << ">\n";
@@ -1928,15 +2201,30 @@ namespace Slic3r {
             triangles_count += its.indices.size();
             volume_it->second.last_triangle_id = triangles_count - 1;
 
-            for (size_t i = 0; i < its.indices.size(); ++ i)
-            {
-                stream << "     <" << TRIANGLE_TAG << " ";
-                for (int j = 0; j < 3; ++j)
-                {
-                    stream << "v" << j + 1 << "=\"" << its.indices[i][j] + volume_it->second.first_vertex_id << "\" ";
-                }
-                stream << "/>\n";
-            }
+            const unsigned int first_vertex_id = volume_it->second.first_vertex_id;
+            if (!flush_stream_to_archive(file, stream) ||
+                !add_mesh_blocks_to_archive(file, its.indices.size(), [&its, first_vertex_id](std::string& out, size_t begin, size_t end) {
+                    const std::string prefix = std::string("     <") + TRIANGLE_TAG + " ";
+                    char line[MAX_TRIANGLE_LINE_LENGTH];
+                    out.reserve((end - begin) * MAX_TRIANGLE_LINE_LENGTH / 2);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        char* ptr = std::copy(prefix.begin(), prefix.end(), line);
+                        for (int j = 0; j < 3; ++j)
+                        {
+                            *ptr++ = 'v';
+                            *ptr++ = char('1' + j);
+                            *ptr++ = '=';
+                            *ptr++ = '"';
+                            ptr = format_uint(its.indices[i][j] + first_vertex_id, ptr);
+                            *ptr++ = '"';
+                            *ptr++ = ' ';
+                        }
+                        ptr = strcpy(ptr, "/>\n") + 3;
+                        out.append(line, ptr - line);
+                    }
+                }))
+                return false;
         }
 
         stream << "    </" << TRIANGLES_TAG << ">\n";
@@ -735,25 +735,18 @@ bool extract_model_from_archive(mz_zip_archive& archive, const mz_zip_archive_fi
     XML_SetElementHandler(parser, AMFParserContext::startElement, AMFParserContext::endElement);
     XML_SetCharacterDataHandler(parser, AMFParserContext::characters);
 
-    void* parser_buffer = XML_GetBuffer(parser, (int)stat.m_uncomp_size);
-    if (parser_buffer == nullptr)
-    {
-        printf("Unable to create buffer\n");
-        close_zip_reader(&archive);
-        return false;
-    }
+    // the .amf file is inflated and parsed by blocks, it is never extracted to memory as a whole
+    bool res = extract_zip_file_by_blocks(&archive, stat.m_file_index, [parser](const char* data, size_t size, bool last) {
+        return XML_Parse(parser, data, (int)size, last ? 1 : 0) != XML_STATUS_ERROR;
+    });
 
-    mz_bool res = mz_zip_reader_extract_file_to_mem(&archive, stat.m_filename, parser_buffer, (size_t)stat.m_uncomp_size, 0);
-    if (res == 0)
+    if (!res)
     {
-        printf("Error while reading model data to buffer\n");
-        close_zip_reader(&archive);
-        return false;
-    }
-
-    if (!XML_ParseBuffer(parser, (int)stat.m_uncomp_size, 1))
-    {
-        printf("Error (%s) while parsing xml file at line %d\n", XML_ErrorString(XML_GetErrorCode(parser)), XML_GetCurrentLineNumber(parser));
+        if (XML_GetErrorCode(parser) != XML_ERROR_NONE)
+            printf("Error (%s) while parsing xml file at line %d\n", XML_ErrorString(XML_GetErrorCode(parser)), XML_GetCurrentLineNumber(parser));
+        else
+            printf("Error while reading model data\n");
+        XML_ParserFree(parser);
         close_zip_reader(&archive);
         return false;
     }
@@ -762,6 +755,8 @@ bool extract_model_from_archive(mz_zip_archive& archive, const mz_zip_archive_fi
 
     version = ctx.m_version;
 
+    XML_ParserFree(parser);
+
     return true;
 }
 
@@ -5,6 +5,7 @@
 #include "Geometry.hpp"
 #include "GCode/PrintExtents.hpp"
 #include "GCode/WipeTowerPrusaMM.hpp"
+#include "Profiler.hpp"
 #include "Utils.hpp"
 
 #include <algorithm>
@@ -21,9 +22,11 @@
 #include <boost/nowide/cstdio.hpp>
 #include <boost/nowide/cstdlib.hpp>
 
-#include "SVG.hpp"
+#include <tbb/parallel_for.h>
+#include <tbb/pipeline.h>
+#include <tbb/task_scheduler_init.h>
 
-#include <Shiny/Shiny.h>
+#include "SVG.hpp"
 
 #if 0
 // Enable debugging and asserts, even in the release build.
@@ -43,6 +46,38 @@ static inline void check_add_eol(std::string &gcode)
         gcode += '\n';    
 }
     
+static bool islands_equal(const ExPolygons &islands1, const ExPolygons &islands2)
+{
+    if (islands1.size() != islands2.size())
+        return false;
+    for (size_t i = 0; i < islands1.size(); ++ i) {
+        const ExPolygon &expoly1 = islands1[i];
+        const ExPolygon &expoly2 = islands2[i];
+        if (expoly1.contour.points != expoly2.contour.points || expoly1.holes.size() != expoly2.holes.size())
+            return false;
+        for (size_t j = 0; j < expoly1.holes.size(); ++ j)
+            if (expoly1.holes[j].points != expoly2.holes[j].points)
+                return false;
+    }
+    return true;
+}
+
+void AvoidCrossingPerimeters::init_layer_mp(const ExPolygons &islands)
+{
+    // Layers of prismatic objects share their islands, while the objects printed at the same height alternate.
+    static const size_t cache_size = 8;
+    auto it = std::find_if(m_layer_mp_cache.begin(), m_layer_mp_cache.end(),
+        [&islands](const std::pair<ExPolygons, std::unique_ptr<MotionPlanner>> &entry) { return islands_equal(entry.first, islands); });
+    if (it == m_layer_mp_cache.end()) {
+        if (m_layer_mp_cache.size() == cache_size)
+            m_layer_mp_cache.pop_back();
+        m_layer_mp_cache.emplace(m_layer_mp_cache.begin(), islands, Slic3r::make_unique<MotionPlanner>(islands));
+    } else
+        // Move to front.
+        std::rotate(m_layer_mp_cache.begin(), it, it + 1);
+    m_layer_mp = m_layer_mp_cache.front().second.get();
+}
+
 // Plan a travel move while minimizing the number of perimeter crossings.
 // point is in unscaled coordinates, in the coordinate system of the current active object
 // (set by gcodegen.set_origin()).
@@ -52,7 +87,7 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &
     // Otherwise perform the path planning in the coordinate system of the active object.
     bool  use_external  = this->use_external_mp || this->use_external_mp_once;
     Point scaled_origin = use_external ? Point::new_scale(gcodegen.origin()(0), gcodegen.origin()(1)) : Point(0, 0);
-    Polyline result = (use_external ? m_external_mp.get() : m_layer_mp.get())->
+    Polyline result = (use_external ? m_external_mp.get() : m_layer_mp)->
         shortest_path(gcodegen.last_pos() + scaled_origin, point + scaled_origin);
     if (use_external)
         result.translate(- scaled_origin);
@@ -421,7 +456,7 @@ std::vector<std::pair<coordf_t, std::vector<GCode::LayerToPrint>>> GCode::collec
 
 void GCode::do_export(Print *print, const char *path, GCodePreviewData *preview_data)
 {
-    PROFILE_CLEAR();
+    SLIC3R_PROFILE_FUNCTION();
 
     // Does the file exist? If so, we hope that it is still valid.
     if (print->is_step_done(psGCodeExport) && boost::filesystem::exists(boost::filesystem::path(path)))
@@ -442,10 +477,18 @@ void GCode::do_export(Print *print, const char *path, GCodePreviewData *preview_
         throw std::runtime_error(std::string("G-code export to ") + path + " failed.\nCannot open the file for writing.\n");
 
     m_enable_analyzer = preview_data != nullptr;
+    // The analyzer adds the layers to the preview data while the G-code is being exported,
+    // the preview is reloaded as the count of the added layers doubles.
+    m_analyzer.set_preview_data(preview_data, [print]() { print->set_status(-2, "", PrintBase::SlicingStatus::RELOAD_GCODE_PREVIEW); });
 
     try {
         m_placeholder_parser_failed_templates.clear();
         this->_do_export(*print, file);
+        if (m_enable_analyzer) {
+            BOOST_LOG_TRIVIAL(debug) << "Completing G-code preview data";
+            m_analyzer.flush_gcode_preview_data();
+            m_analyzer.reset();
+        }
         fflush(file);
         if (ferror(file)) {
             fclose(file);
@@ -454,9 +497,12 @@ void GCode::do_export(Print *print, const char *path, GCodePreviewData *preview_
         }
     } catch (std::exception & /* ex */) {
         // Rethrow on any exception. std::runtime_exception and CanceledException are expected to be thrown.
-        // Close and remove the file.
+        // Close and remove the file, drop the partial preview.
         fclose(file);
         boost::nowide::remove(path_tmp.c_str());
+        m_analyzer.set_preview_data(nullptr);
+        if (preview_data != nullptr)
+            preview_data->reset();
         throw;
     }
     fclose(file);
@@ -485,12 +531,7 @@ void GCode::do_export(Print *print, const char *path, GCodePreviewData *preview_
         }
     }
 
-    // starts analyzer calculations
-    if (m_enable_analyzer) {
-        BOOST_LOG_TRIVIAL(debug) << "Preparing G-code preview data";
-        m_analyzer.calc_gcode_preview_data(*preview_data, [print]() { print->throw_if_canceled(); });
-        m_analyzer.reset();
-    }
+    m_analyzer.set_preview_data(nullptr);
 
     if (rename_file(path_tmp, path) != 0)
         throw std::runtime_error(
@@ -499,15 +540,11 @@ void GCode::do_export(Print *print, const char *path, GCodePreviewData *preview_
 
     BOOST_LOG_TRIVIAL(info) << "Exporting G-code finished" << log_memory_info();
 	print->set_done(psGCodeExport);
-
-    // Write the profiler measurements to file
-    PROFILE_UPDATE();
-    PROFILE_OUTPUT(debug_out_path("gcode-export-profile.txt").c_str());
 }
 
 void GCode::_do_export(Print &print, FILE *file)
 {
-    PROFILE_FUNC();
+    SLIC3R_PROFILE_FUNCTION();
 
     // resets time estimators
     m_normal_time_estimator.reset();
@@ -931,12 +968,18 @@ void GCode::_do_export(Print &print, FILE *file)
                 m_cooling_buffer->set_current_extruder(initial_extruder_id);
                 // Pair the object layers with the support layers by z, extrude them.
                 std::vector<LayerToPrint> layers_to_print = collect_layers_to_print(object);
-                for (const LayerToPrint &ltp : layers_to_print) {
-                    std::vector<LayerToPrint> lrs;
-                    lrs.emplace_back(std::move(ltp));
-                    this->process_layer(file, print, lrs, tool_ordering.tools_for_layer(ltp.print_z()), &copy - object.copies().data());
-                    print.throw_if_canceled();
-                }
+                const size_t single_object_idx = &copy - object.copies().data();
+                this->process_layers(file, print, layers_to_print.size(), 
+                    [&print, &tool_ordering, &layers_to_print](size_t layer_idx) {
+                        const LayerToPrint &ltp = layers_to_print[layer_idx];
+                        return prepare_layer(print, std::vector<LayerToPrint>(1, ltp), tool_ordering.tools_for_layer(ltp.print_z()));
+                    },
+                    [this, &print, &tool_ordering, &layers_to_print, single_object_idx](size_t layer_idx, PreparedLayer &prepared) {
+                        const LayerToPrint &ltp = layers_to_print[layer_idx];
+                        std::vector<LayerToPrint> lrs;
+                        lrs.emplace_back(ltp);
+                        return this->process_layer(print, lrs, tool_ordering.tools_for_layer(ltp.print_z()), prepared, single_object_idx);
+                    });
 #ifdef HAS_PRESSURE_EQUALIZER
                 if (m_pressure_equalizer)
                     _write(file, m_pressure_equalizer->process("", true));
@@ -988,13 +1031,18 @@ void GCode::_do_export(Print &print, FILE *file)
             print.throw_if_canceled();
         }
         // Extrude the layers.
-        for (auto &layer : layers_to_print) {
-            const LayerTools &layer_tools = tool_ordering.tools_for_layer(layer.first);
-            if (m_wipe_tower && layer_tools.has_wipe_tower)
-                m_wipe_tower->next_layer();
-            this->process_layer(file, print, layer.second, layer_tools, size_t(-1));
-            print.throw_if_canceled();
-        }
+        this->process_layers(file, print, layers_to_print.size(), 
+            [&print, &tool_ordering, &layers_to_print](size_t layer_idx) {
+                const auto &layer = layers_to_print[layer_idx];
+                return prepare_layer(print, layer.second, tool_ordering.tools_for_layer(layer.first));
+            },
+            [this, &print, &tool_ordering, &layers_to_print](size_t layer_idx, PreparedLayer &prepared) {
+                const auto       &layer       = layers_to_print[layer_idx];
+                const LayerTools &layer_tools = tool_ordering.tools_for_layer(layer.first);
+                if (m_wipe_tower && layer_tools.has_wipe_tower)
+                    m_wipe_tower->next_layer();
+                return this->process_layer(print, layer.second, layer_tools, prepared, size_t(-1));
+            });
 #ifdef HAS_PRESSURE_EQUALIZER
         if (m_pressure_equalizer)
             _write(file, m_pressure_equalizer->process("", true));
@@ -1006,7 +1054,8 @@ void GCode::_do_export(Print &print, FILE *file)
 
     // Write end commands to file.
     _write(file, this->retract());
-    _write(file, m_writer.set_fan(false));
+    // The fan was set by the cooling buffer.
+    _write(file, m_cooling_buffer->writer().set_fan(false));
 
     if (m_enable_analyzer)
     {
@@ -1299,30 +1348,241 @@ inline std::vector<GCode::ObjectByExtruder::Island>& object_islands_by_extruder(
     return islands;
 }
 
+// Does the collection contain an extrusion loop, possibly nested in the child collections?
+// Only the loops are extruded by GCode::extrude_loop(), which places the seams.
+static bool has_extrusion_loops(const ExtrusionEntityCollection &collection)
+{
+    for (const ExtrusionEntity *ee : collection.entities)
+        if (ee->is_loop() || (ee->is_collection() && has_extrusion_loops(*static_cast<const ExtrusionEntityCollection*>(ee))))
+            return true;
+    return false;
+}
+
+// Create the distance fields over the layers below the object layers, which have perimeter loops with seams to be placed
+// by GCode::extrude_loop(). This is the most expensive part of the seam placement, which does not depend on the state
+// of the G-code generator, therefore it is done by process_layers() ahead of process_layer() and in parallel.
+GCode::LowerLayerEdgeGrids GCode::lower_layer_edge_grids(const Print &print, const std::vector<LayerToPrint> &layers)
+{
+    LowerLayerEdgeGrids edge_grids(layers.size());
+    // A spiral vase does not place seams.
+    if (print.config().spiral_vase)
+        return edge_grids;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, layers.size()),
+        [&layers, &edge_grids](const tbb::blocked_range<size_t> &range) {
+            for (size_t layer_id = range.begin(); layer_id < range.end(); ++ layer_id) {
+                const Layer *layer = layers[layer_id].object_layer;
+                if (layer == nullptr || layer->lower_layer == nullptr || layer->object()->config().seam_position == spRandom)
+                    continue;
+                bool has_loops = false;
+                for (const LayerRegion *layerm : layer->regions())
+                    if (has_extrusion_loops(layerm->perimeters)) {
+                        has_loops = true;
+                        break;
+                    }
+                if (! has_loops)
+                    continue;
+                // Create the distance field for a layer below.
+                const coord_t distance_field_resolution = coord_t(scale_(1.) + 0.5);
+                std::unique_ptr<EdgeGrid::Grid> grid = make_unique<EdgeGrid::Grid>();
+                grid->create(layer->lower_layer->slices, distance_field_resolution);
+                grid->calculate_sdf();
+                #if 0
+                {
+                    static int iRun = 0;
+                    BoundingBox bbox = grid->bbox();
+                    bbox.min(0) -= scale_(5.f);
+                    bbox.min(1) -= scale_(5.f);
+                    bbox.max(0) += scale_(5.f);
+                    bbox.max(1) += scale_(5.f);
+                    EdgeGrid::save_png(*grid, bbox, scale_(0.1f), debug_out_path("GCode_extrude_loop_edge_grid-%d.png", iRun++));
+                }
+                #endif
+                edge_grids[layer_id] = std::move(grid);
+            }
+        });
+    return edge_grids;
+}
+
+// Group the extrusions of a layer by an extruder, then by an object, an island and a region, and create the distance fields
+// for the seam placement. Neither depends on the state of the G-code generator, therefore process_layers() prepares
+// multiple layers in parallel ahead of process_layer(), which extrudes them in the order of the layers.
+// The extruder overrides of the wiping extrusions are stored into layer_tools, which belongs to this layer only.
+GCode::PreparedLayer GCode::prepare_layer(
+    const Print                     &print,
+    const std::vector<LayerToPrint> &layers,
+    const LayerTools                &layer_tools)
+{
+    SLIC3R_PROFILE_FUNCTION();
+    PreparedLayer prepared;
+    if (layer_tools.extruders.empty())
+        // Nothing to extrude.
+        return prepared;
+    unsigned int first_extruder_id = layer_tools.extruders.front();
+
+    for (const LayerToPrint &layer_to_print : layers) {
+        if (layer_to_print.support_layer != nullptr) {
+            const SupportLayer &support_layer = *layer_to_print.support_layer;
+            const PrintObject  &object = *support_layer.object();
+            if (! support_layer.support_fills.entities.empty()) {
+                ExtrusionRole   role               = support_layer.support_fills.role();
+                bool            has_support        = role == erMixed || role == erSupportMaterial;
+                bool            has_interface      = role == erMixed || role == erSupportMaterialInterface;
+                // Extruder ID of the support base. -1 if "don't care".
+                unsigned int    support_extruder   = object.config().support_material_extruder.value - 1;
+                // Shall the support be printed with the active extruder, preferably with non-soluble, to avoid tool changes?
+                bool            support_dontcare   = object.config().support_material_extruder.value == 0;
+                // Extruder ID of the support interface. -1 if "don't care".
+                unsigned int    interface_extruder = object.config().support_material_interface_extruder.value - 1;
+                // Shall the support interface be printed with the active extruder, preferably with non-soluble, to avoid tool changes?
+                bool            interface_dontcare = object.config().support_material_interface_extruder.value == 0;
+                if (support_dontcare || interface_dontcare) {
+                    // Some support will be printed with "don't care" material, preferably non-soluble.
+                    // Is the current extruder assigned a soluble filament?
+                    unsigned int dontcare_extruder = first_extruder_id;
+                    if (print.config().filament_soluble.get_at(dontcare_extruder)) {
+                        // The last extruder printed on the previous layer extrudes soluble filament.
+                        // Try to find a non-soluble extruder on the same layer.
+                        for (unsigned int extruder_id : layer_tools.extruders)
+                            if (! print.config().filament_soluble.get_at(extruder_id)) {
+                                dontcare_extruder = extruder_id;
+                                break;
+                            }
+                    }
+                    if (support_dontcare)
+                        support_extruder = dontcare_extruder;
+                    if (interface_dontcare)
+                        interface_extruder = dontcare_extruder;
+                }
+                // Both the support and the support interface are printed with the same extruder, therefore
+                // the interface may be interleaved with the support base.
+                bool single_extruder = ! has_support || support_extruder == interface_extruder;
+                // Assign an extruder to the base.
+                ObjectByExtruder &obj = object_by_extruder(prepared.by_extruder, has_support ? support_extruder : interface_extruder, &layer_to_print - layers.data(), layers.size());
+                obj.support = &support_layer.support_fills;
+                obj.support_extrusion_role = single_extruder ? erMixed : erSupportMaterial;
+                if (! single_extruder && has_interface) {
+                    ObjectByExtruder &obj_interface = object_by_extruder(prepared.by_extruder, interface_extruder, &layer_to_print - layers.data(), layers.size());
+                    obj_interface.support = &support_layer.support_fills;
+                    obj_interface.support_extrusion_role = erSupportMaterialInterface;
+                }
+            }
+        }
+        if (layer_to_print.object_layer != nullptr) {
+            const Layer &layer = *layer_to_print.object_layer;
+            // We now define a strategy for building perimeters and fills. The separation 
+            // between regions doesn't matter in terms of printing order, as we follow 
+            // another logic instead:
+            // - we group all extrusions by extruder so that we minimize toolchanges
+            // - we start from the last used extruder
+            // - for each extruder, we group extrusions by island
+            // - for each island, we extrude perimeters first, unless user set the infill_first
+            //   option
+            // (Still, we have to keep track of regions because we need to apply their config)
+            size_t n_slices = layer.slices.expolygons.size();
+            std::vector<BoundingBox> layer_surface_bboxes;
+            layer_surface_bboxes.reserve(n_slices);
+            for (const ExPolygon &expoly : layer.slices.expolygons)
+                layer_surface_bboxes.push_back(get_extents(expoly.contour));
+            auto point_inside_surface = [&layer, &layer_surface_bboxes](const size_t i, const Point &point) { 
+                const BoundingBox &bbox = layer_surface_bboxes[i];
+                return point(0) >= bbox.min(0) && point(0) < bbox.max(0) &&
+                       point(1) >= bbox.min(1) && point(1) < bbox.max(1) &&
+                       layer.slices.expolygons[i].contour.contains(point);
+            };
+
+            for (size_t region_id = 0; region_id < print.regions().size(); ++ region_id) {
+                const LayerRegion *layerm = (region_id < layer.regions().size()) ? layer.regions()[region_id] : nullptr;
+                if (layerm == nullptr)
+                    continue;
+                const PrintRegion &region = *print.regions()[region_id];
+
+
+                // Now we must process perimeters and infills and create islands of extrusions in by_region std::map.
+                // It is also necessary to save which extrusions are part of MM wiping and which are not.
+                // The process is almost the same for perimeters and infills - we will do it in a cycle that repeats twice:
+                for (std::string entity_type("infills") ; entity_type != "done" ; entity_type = entity_type=="infills" ? "perimeters" : "done") {
+
+                    const ExtrusionEntitiesPtr& source_entities = entity_type=="infills" ? layerm->fills.entities : layerm->perimeters.entities;
+
+                    for (const ExtrusionEntity *ee : source_entities) {
+                        // fill represents infill extrusions of a single island.
+                        const auto *fill = dynamic_cast<const ExtrusionEntityCollection*>(ee);
+                        if (fill->entities.empty()) // This shouldn't happen but first_point() would fail.
+                            continue;
+
+                        // This extrusion is part of certain Region, which tells us which extruder should be used for it:
+                        int correct_extruder_id = Print::get_extruder(*fill, region);
+                        //FIXME what is this?
+                        entity_type=="infills" ? 
+                            std::max<int>(0, (is_solid_infill(fill->entities.front()->role()) ? region.config().solid_infill_extruder : region.config().infill_extruder) - 1) :
+                            std::max<int>(region.config().perimeter_extruder.value - 1, 0);
+
+                        // Let's recover vector of extruder overrides:
+                        const ExtruderPerCopy* entity_overrides = const_cast<LayerTools&>(layer_tools).wiping_extrusions().get_extruder_overrides(fill, correct_extruder_id, (int)layer_to_print.object()->copies().size());
+
+                        // Now we must add this extrusion into the by_extruder map, once for each extruder that will print it:
+                        for (unsigned int extruder : layer_tools.extruders)
+                        {
+                            // Init by_extruder item only if we actually use the extruder:
+                            if (std::find(entity_overrides->begin(), entity_overrides->end(), extruder) != entity_overrides->end() ||      // at least one copy is overridden to use this extruder
+                                std::find(entity_overrides->begin(), entity_overrides->end(), -extruder-1) != entity_overrides->end() ||   // at least one copy would normally be printed with this extruder (see get_extruder_overrides function for explanation)
+                                (std::find(layer_tools.extruders.begin(), layer_tools.extruders.end(), correct_extruder_id) == layer_tools.extruders.end() && extruder == layer_tools.extruders.back())) // this entity is not overridden, but its extruder is not in layer_tools - we'll print it
+                                                                                                                                            //by last extruder on this layer (could happen e.g. when a wiping object is taller than others - dontcare extruders are eradicated from layer_tools)
+                            {
+                                std::vector<ObjectByExtruder::Island> &islands = object_islands_by_extruder(
+                                    prepared.by_extruder,
+                                    extruder,
+                                    &layer_to_print - layers.data(),
+                                    layers.size(), n_slices+1);
+                                for (size_t i = 0; i <= n_slices; ++i)
+                                    if (// fill->first_point does not fit inside any slice
+                                        i == n_slices ||
+                                        // fill->first_point fits inside ith slice
+                                        point_inside_surface(i, fill->first_point())) {
+                                        if (islands[i].by_region.empty())
+                                            islands[i].by_region.assign(print.regions().size(), ObjectByExtruder::Island::Region());
+                                        islands[i].by_region[region_id].append(entity_type, fill, entity_overrides, layer_to_print.object()->copies().size());
+                                        break;
+                                    }
+                            }
+                        }
+                    }
+                }
+            } // for regions
+        }
+    } // for objects
+
+    prepared.lower_layer_edge_grids = lower_layer_edge_grids(print, layers);
+    score_seams(print, layers, prepared);
+    return prepared;
+}
+
 // In sequential mode, process_layer is called once per each object and its copy, 
 // therefore layers will contain a single entry and single_object_idx will point to the copy of the object.
 // In non-sequential mode, process_layer is called per each print_z height with all object and support layers accumulated.
 // For multi-material prints, this routine minimizes extruder switches by gathering extruder specific extrusion paths
 // and performing the extruder specific extrusions together.
-void GCode::process_layer(
-    // Write into the output file.
-    FILE                            *file,
+GCode::LayerResult GCode::process_layer(
     const Print                     &print,
     // Set of object & print layers of the same PrintObject and with the same print_z.
     const std::vector<LayerToPrint> &layers,
     const LayerTools                &layer_tools,
+    // Extrusions of the layers grouped by prepare_layer().
+    PreparedLayer                   &prepared,
     // If set to size_t(-1), then print all copies of all objects.
     // Otherwise print a single copy of a single object.
     const size_t                     single_object_idx)
 {
+    SLIC3R_PROFILE_FUNCTION();
     assert(! layers.empty());
 //    assert(! layer_tools.extruders.empty());
     // Either printing all copies of all objects, or just a single copy of a single object.
     assert(single_object_idx == size_t(-1) || layers.size() == 1);
 
+    LayerResult result;
     if (layer_tools.extruders.empty())
         // Nothing to extrude.
-        return;
+        return result;
 
     // Extract 1st object_layer and support_layer of this set of layers with an equal print_z.
     const Layer         *object_layer  = nullptr;
@@ -1458,143 +1718,8 @@ void GCode::process_layer(
             skirt_loops_per_extruder[first_extruder_id] = std::pair<size_t, size_t>(0, print.config().skirts.value);
     }
 
-    // Group extrusions by an extruder, then by an object, an island and a region.
-    std::map<unsigned int, std::vector<ObjectByExtruder>> by_extruder;
-    for (const LayerToPrint &layer_to_print : layers) {
-        if (layer_to_print.support_layer != nullptr) {
-            const SupportLayer &support_layer = *layer_to_print.support_layer;
-            const PrintObject  &object = *support_layer.object();
-            if (! support_layer.support_fills.entities.empty()) {
-                ExtrusionRole   role               = support_layer.support_fills.role();
-                bool            has_support        = role == erMixed || role == erSupportMaterial;
-                bool            has_interface      = role == erMixed || role == erSupportMaterialInterface;
-                // Extruder ID of the support base. -1 if "don't care".
-                unsigned int    support_extruder   = object.config().support_material_extruder.value - 1;
-                // Shall the support be printed with the active extruder, preferably with non-soluble, to avoid tool changes?
-                bool            support_dontcare   = object.config().support_material_extruder.value == 0;
-                // Extruder ID of the support interface. -1 if "don't care".
-                unsigned int    interface_extruder = object.config().support_material_interface_extruder.value - 1;
-                // Shall the support interface be printed with the active extruder, preferably with non-soluble, to avoid tool changes?
-                bool            interface_dontcare = object.config().support_material_interface_extruder.value == 0;
-                if (support_dontcare || interface_dontcare) {
-                    // Some support will be printed with "don't care" material, preferably non-soluble.
-                    // Is the current extruder assigned a soluble filament?
-                    unsigned int dontcare_extruder = first_extruder_id;
-                    if (print.config().filament_soluble.get_at(dontcare_extruder)) {
-                        // The last extruder printed on the previous layer extrudes soluble filament.
-                        // Try to find a non-soluble extruder on the same layer.
-                        for (unsigned int extruder_id : layer_tools.extruders)
-                            if (! print.config().filament_soluble.get_at(extruder_id)) {
-                                dontcare_extruder = extruder_id;
-                                break;
-                            }
-                    }
-                    if (support_dontcare)
-                        support_extruder = dontcare_extruder;
-                    if (interface_dontcare)
-                        interface_extruder = dontcare_extruder;
-                }
-                // Both the support and the support interface are printed with the same extruder, therefore
-                // the interface may be interleaved with the support base.
-                bool single_extruder = ! has_support || support_extruder == interface_extruder;
-                // Assign an extruder to the base.
-                ObjectByExtruder &obj = object_by_extruder(by_extruder, has_support ? support_extruder : interface_extruder, &layer_to_print - layers.data(), layers.size());
-                obj.support = &support_layer.support_fills;
-                obj.support_extrusion_role = single_extruder ? erMixed : erSupportMaterial;
-                if (! single_extruder && has_interface) {
-                    ObjectByExtruder &obj_interface = object_by_extruder(by_extruder, interface_extruder, &layer_to_print - layers.data(), layers.size());
-                    obj_interface.support = &support_layer.support_fills;
-                    obj_interface.support_extrusion_role = erSupportMaterialInterface;
-                }
-            }
-        }
-        if (layer_to_print.object_layer != nullptr) {
-            const Layer &layer = *layer_to_print.object_layer;
-            // We now define a strategy for building perimeters and fills. The separation 
-            // between regions doesn't matter in terms of printing order, as we follow 
-            // another logic instead:
-            // - we group all extrusions by extruder so that we minimize toolchanges
-            // - we start from the last used extruder
-            // - for each extruder, we group extrusions by island
-            // - for each island, we extrude perimeters first, unless user set the infill_first
-            //   option
-            // (Still, we have to keep track of regions because we need to apply their config)
-            size_t n_slices = layer.slices.expolygons.size();
-            std::vector<BoundingBox> layer_surface_bboxes;
-            layer_surface_bboxes.reserve(n_slices);
-            for (const ExPolygon &expoly : layer.slices.expolygons)
-                layer_surface_bboxes.push_back(get_extents(expoly.contour));
-            auto point_inside_surface = [&layer, &layer_surface_bboxes](const size_t i, const Point &point) { 
-                const BoundingBox &bbox = layer_surface_bboxes[i];
-                return point(0) >= bbox.min(0) && point(0) < bbox.max(0) &&
-                       point(1) >= bbox.min(1) && point(1) < bbox.max(1) &&
-                       layer.slices.expolygons[i].contour.contains(point);
-            };
-
-            for (size_t region_id = 0; region_id < print.regions().size(); ++ region_id) {
-                const LayerRegion *layerm = (region_id < layer.regions().size()) ? layer.regions()[region_id] : nullptr;
-                if (layerm == nullptr)
-                    continue;
-                const PrintRegion &region = *print.regions()[region_id];
-
-
-                // Now we must process perimeters and infills and create islands of extrusions in by_region std::map.
-                // It is also necessary to save which extrusions are part of MM wiping and which are not.
-                // The process is almost the same for perimeters and infills - we will do it in a cycle that repeats twice:
-                for (std::string entity_type("infills") ; entity_type != "done" ; entity_type = entity_type=="infills" ? "perimeters" : "done") {
-
-                    const ExtrusionEntitiesPtr& source_entities = entity_type=="infills" ? layerm->fills.entities : layerm->perimeters.entities;
-
-                    for (const ExtrusionEntity *ee : source_entities) {
-                        // fill represents infill extrusions of a single island.
-                        const auto *fill = dynamic_cast<const ExtrusionEntityCollection*>(ee);
-                        if (fill->entities.empty()) // This shouldn't happen but first_point() would fail.
-                            continue;
-
-                        // This extrusion is part of certain Region, which tells us which extruder should be used for it:
-                        int correct_extruder_id = Print::get_extruder(*fill, region);
-                        //FIXME what is this?
-                        entity_type=="infills" ? 
-                            std::max<int>(0, (is_solid_infill(fill->entities.front()->role()) ? region.config().solid_infill_extruder : region.config().infill_extruder) - 1) :
-                            std::max<int>(region.config().perimeter_extruder.value - 1, 0);
-
-                        // Let's recover vector of extruder overrides:
-                        const ExtruderPerCopy* entity_overrides = const_cast<LayerTools&>(layer_tools).wiping_extrusions().get_extruder_overrides(fill, correct_extruder_id, (int)layer_to_print.object()->copies().size());
-
-                        // Now we must add this extrusion into the by_extruder map, once for each extruder that will print it:
-                        for (unsigned int extruder : layer_tools.extruders)
-                        {
-                            // Init by_extruder item only if we actually use the extruder:
-                            if (std::find(entity_overrides->begin(), entity_overrides->end(), extruder) != entity_overrides->end() ||      // at least one copy is overridden to use this extruder
-                                std::find(entity_overrides->begin(), entity_overrides->end(), -extruder-1) != entity_overrides->end() ||   // at least one copy would normally be printed with this extruder (see get_extruder_overrides function for explanation)
-                                (std::find(layer_tools.extruders.begin(), layer_tools.extruders.end(), correct_extruder_id) == layer_tools.extruders.end() && extruder == layer_tools.extruders.back())) // this entity is not overridden, but its extruder is not in layer_tools - we'll print it
-                                                                                                                                            //by last extruder on this layer (could happen e.g. when a wiping object is taller than others - dontcare extruders are eradicated from layer_tools)
-                            {
-                                std::vector<ObjectByExtruder::Island> &islands = object_islands_by_extruder(
-                                    by_extruder,
-                                    extruder,
-                                    &layer_to_print - layers.data(),
-                                    layers.size(), n_slices+1);
-                                for (size_t i = 0; i <= n_slices; ++i)
-                                    if (// fill->first_point does not fit inside any slice
-                                        i == n_slices ||
-                                        // fill->first_point fits inside ith slice
-                                        point_inside_surface(i, fill->first_point())) {
-                                        if (islands[i].by_region.empty())
-                                            islands[i].by_region.assign(print.regions().size(), ObjectByExtruder::Island::Region());
-                                        islands[i].by_region[region_id].append(entity_type, fill, entity_overrides, layer_to_print.object()->copies().size());
-                                        break;
-                                    }
-                            }
-                        }
-                    }
-                }
-            } // for regions
-        }
-    } // for objects
 
     // Extrude the skirt, brim, support, perimeters, infill ordered by the extruders.
-    std::vector<std::unique_ptr<EdgeGrid::Grid>> lower_layer_edge_grids(layers.size());
     for (unsigned int extruder_id : layer_tools.extruders)
     {
         gcode += (layer_tools.has_wipe_tower && m_wipe_tower) ?
@@ -1644,8 +1769,8 @@ void GCode::process_layer(
         }
 
 
-        auto objects_by_extruder_it = by_extruder.find(extruder_id);
-        if (objects_by_extruder_it == by_extruder.end())
+        auto objects_by_extruder_it = prepared.by_extruder.find(extruder_id);
+        if (objects_by_extruder_it == prepared.by_extruder.end())
             continue;
 
         // We are almost ready to print. However, we must go through all the objects twice to print the the overridden extrusions first (infill/perimeter wiping feature):
@@ -1684,9 +1809,8 @@ void GCode::process_layer(
                     this->set_origin(unscale(copy));
                     if (object_by_extruder.support != nullptr && !print_wipe_extrusions) {
                         m_layer = layers[layer_id].support_layer;
-                        gcode += this->extrude_support(
-                            // support_extrusion_role is erSupportMaterial, erSupportMaterialInterface or erMixed for all extrusion paths.
-                            object_by_extruder.support->chained_path_from(m_last_pos, false, object_by_extruder.support_extrusion_role));
+                        // support_extrusion_role is erSupportMaterial, erSupportMaterialInterface or erMixed for all extrusion paths.
+                        gcode += this->extrude_support(*object_by_extruder.support, object_by_extruder.support_extrusion_role);
                         m_layer = layers[layer_id].layer();
                     }
                     for (ObjectByExtruder::Island &island : object_by_extruder.islands) {
@@ -1694,9 +1818,9 @@ void GCode::process_layer(
 
                         if (print.config().infill_first) {
                             gcode += this->extrude_infill(print, by_region_specific);
-                            gcode += this->extrude_perimeters(print, by_region_specific, lower_layer_edge_grids[layer_id]);
+                            gcode += this->extrude_perimeters(print, by_region_specific, prepared.lower_layer_edge_grids[layer_id].get());
                         } else {
-                            gcode += this->extrude_perimeters(print, by_region_specific, lower_layer_edge_grids[layer_id]);
+                            gcode += this->extrude_perimeters(print, by_region_specific, prepared.lower_layer_edge_grids[layer_id].get());
                             gcode += this->extrude_infill(print,by_region_specific);
                         }
                     }
@@ -1716,24 +1840,79 @@ void GCode::process_layer(
     if (m_spiral_vase)
         gcode = m_spiral_vase->process_layer(gcode);
 
-    // Apply cooling logic; this may alter speeds.
-    if (m_cooling_buffer)
-        gcode = m_cooling_buffer->process_layer(gcode, layer.id());
+    result.gcode    = std::move(gcode);
+    result.layer_id = layer.id();
+    result.print_z  = print_z;
+    return result;
+}
 
+void GCode::process_layers(FILE *file, const Print &print, size_t num_layers,
+                           const std::function<PreparedLayer(size_t)> &prepare,
+                           const std::function<LayerResult(size_t, PreparedLayer&)> &generate)
+{
+    // The extrusions of the layers are grouped by prepare_layer() in parallel, as it does not depend on the state
+    // of the G-code generator. The G-code generation, the cooling buffer and the output (including the G-code analyzer
+    // and the time estimators) each keep their own state and they have to see the layers in order, therefore each of them
+    // is a serial_in_order stage. While a layer is being generated, the preceding layer is being post-processed
+    // by the cooling buffer and the layer before it is being written out, so the output is identical to processing
+    // the layers one by one. The stages share no mutable state: The cooling buffer works with its own copy
+    // of the print config and its own GCodeWriter, see CoolingBuffer.
+    typedef std::pair<size_t, PreparedLayer> LayerToGenerate;
+    size_t layer_to_prepare = 0;
+    const auto layers = tbb::make_filter<void, size_t>(tbb::filter::serial_in_order,
+        [&layer_to_prepare, num_layers](tbb::flow_control &fc) -> size_t {
+            if (layer_to_prepare == num_layers) {
+                fc.stop();
+                return num_layers;
+            }
+            return layer_to_prepare ++;
+        });
+    const auto prepared = tbb::make_filter<size_t, std::shared_ptr<LayerToGenerate>>(tbb::filter::parallel,
+        [&print, &prepare](size_t layer_idx) -> std::shared_ptr<LayerToGenerate> {
+            SLIC3R_PROFILE_ZONE("process_layers_prepare");
+            std::shared_ptr<LayerToGenerate> layer = std::make_shared<LayerToGenerate>();
+            layer->first = layer_idx;
+            if (! print.canceled())
+                layer->second = prepare(layer_idx);
+            return layer;
+        });
+    const auto generator = tbb::make_filter<std::shared_ptr<LayerToGenerate>, LayerResult>(tbb::filter::serial_in_order,
+        [&print, &generate](std::shared_ptr<LayerToGenerate> layer) -> LayerResult {
+            print.throw_if_canceled();
+            return generate(layer->first, layer->second);
+        });
+    const auto cooling = tbb::make_filter<LayerResult, LayerResult>(tbb::filter::serial_in_order,
+        [this](LayerResult layer) -> LayerResult {
+            SLIC3R_PROFILE_ZONE("process_layers_cooling");
+            if (! layer.empty()) {
+                // Apply cooling logic; this may alter speeds.
+                if (m_cooling_buffer)
+                    layer.gcode = m_cooling_buffer->process_layer(layer.gcode, layer.layer_id);
 #ifdef HAS_PRESSURE_EQUALIZER
-    // Apply pressure equalization if enabled;
-    // printf("G-code before filter:\n%s\n", gcode.c_str());
-    if (m_pressure_equalizer)
-        gcode = m_pressure_equalizer->process(gcode.c_str(), false);
-    // printf("G-code after filter:\n%s\n", out.c_str());
+                // Apply pressure equalization if enabled;
+                if (m_pressure_equalizer)
+                    layer.gcode = m_pressure_equalizer->process(layer.gcode.c_str(), false);
 #endif /* HAS_PRESSURE_EQUALIZER */
-    
-    _write(file, gcode);
-    BOOST_LOG_TRIVIAL(trace) << "Exported layer " << layer.id() << " print_z " << print_z << 
-        ", time estimator memory: " <<
-            format_memsize_MB(m_normal_time_estimator.memory_used() + m_silent_time_estimator_enabled ? m_silent_time_estimator.memory_used() : 0) <<
-        ", analyzer memory: " <<
-            format_memsize_MB(m_analyzer.memory_used());
+            }
+            return layer;
+        });
+    const auto output = tbb::make_filter<LayerResult, void>(tbb::filter::serial_in_order,
+        [this, file](const LayerResult &layer) {
+            if (layer.empty())
+                return;
+            SLIC3R_PROFILE_ZONE("process_layers_output");
+            _write(file, layer.gcode);
+            BOOST_LOG_TRIVIAL(trace) << "Exported layer " << layer.layer_id << " print_z " << layer.print_z << 
+                ", time estimator memory: " <<
+                    format_memsize_MB(m_normal_time_estimator.memory_used() + m_silent_time_estimator_enabled ? m_silent_time_estimator.memory_used() : 0) <<
+                ", analyzer memory: " <<
+                    format_memsize_MB(m_analyzer.memory_used());
+        });
+    // The layers waiting for the G-code generator hold their extrusions and edge grids, which are large for big prints, therefore
+    // the number of layers in flight is bounded independently of the number of threads: One layer per serial stage
+    // and a few layers being prepared ahead of the G-code generator, which is the bottleneck.
+    const size_t max_layers_in_flight = 3 + std::min(4, tbb::task_scheduler_init::default_num_threads());
+    tbb::parallel_pipeline(max_layers_in_flight, layers & prepared & generator & cooling & output);
 }
 
 void GCode::apply_print_config(const PrintConfig &print_config)
@@ -1897,7 +2076,7 @@ plot(p2.subs(r,0.2).subs(z,1.), (x, -1, 3), adaptive=False, nb_of_points=400)
     }
 }
 
-static Points::iterator project_point_to_polygon_and_insert(Polygon &polygon, const Point &pt, double eps)
+Points::iterator project_point_to_polygon_and_insert(Polygon &polygon, const Point &pt, double eps)
 {
     assert(polygon.points.size() >= 2);
     if (polygon.points.size() <= 1)
@@ -2022,32 +2201,238 @@ std::vector<float> polygon_angles_at_vertices(const Polygon &polygon, const std:
     return angles;
 }
 
-std::string GCode::extrude_loop(ExtrusionLoop loop, std::string description, double speed, std::unique_ptr<EdgeGrid::Grid> *lower_layer_edge_grid)
+// Angle at a single vertex of a polygon as calculated by polygon_angles_at_vertices().
+static float polygon_angle_at_vertex(const Polygon &polygon, const std::vector<float> &lengths, size_t idx, float min_arm_length)
 {
-    // get a copy; don't modify the orientation of the original loop object otherwise
-    // next copies (if any) would not detect the correct orientation
+    assert(polygon.points.size() + 1 == lengths.size());
+    if (min_arm_length > 0.25f * lengths.back())
+        min_arm_length = 0.25f * lengths.back();
+    const size_t n = polygon.points.size();
+    auto arm_length = [&lengths, n](size_t from, size_t to) {
+        return (from <= to) ? lengths[to] - lengths[from] : lengths.back() - lengths[from] + lengths[to];
+    };
+    // The closest preceding vertex farther than min_arm_length, the closest following vertex at least min_arm_length away.
+    size_t idx_prev = idx;
+    do {
+        idx_prev = (idx_prev == 0) ? n - 1 : idx_prev - 1;
+    } while (idx_prev != idx && arm_length(idx_prev, idx) <= min_arm_length);
+    size_t idx_next = idx;
+    do {
+        idx_next = (idx_next + 1 == n) ? 0 : idx_next + 1;
+    } while (idx_next != idx && arm_length(idx, idx_next) < min_arm_length);
+    const Point  v1 = polygon.points[idx] - polygon.points[idx_prev];
+    const Point  v2 = polygon.points[idx_next] - polygon.points[idx];
+    int64_t dot   = int64_t(v1(0))*int64_t(v2(0)) + int64_t(v1(1))*int64_t(v2(1));
+    int64_t cross = int64_t(v1(0))*int64_t(v2(1)) - int64_t(v1(1))*int64_t(v2(0));
+    return float(atan2(double(cross), double(dot)));
+}
 
-    if (m_layer->lower_layer != nullptr && lower_layer_edge_grid != nullptr) {
-        if (! *lower_layer_edge_grid) {
-            // Create the distance field for a layer below.
-            const coord_t distance_field_resolution = coord_t(scale_(1.) + 0.5);
-            *lower_layer_edge_grid = make_unique<EdgeGrid::Grid>();
-            (*lower_layer_edge_grid)->create(m_layer->lower_layer->slices, distance_field_resolution);
-            (*lower_layer_edge_grid)->calculate_sdf();
-            #if 0
-            {
-                static int iRun = 0;
-                BoundingBox bbox = (*lower_layer_edge_grid)->bbox();
-                bbox.min(0) -= scale_(5.f);
-                bbox.min(1) -= scale_(5.f);
-                bbox.max(0) += scale_(5.f);
-                bbox.max(1) += scale_(5.f);
-                EdgeGrid::save_png(*(*lower_layer_edge_grid), bbox, scale_(0.1f), debug_out_path("GCode_extrude_loop_edge_grid-%d.png", iRun++));
+// Penalty for the visibility of a seam at a vertex of a counter clockwise polygon with the angle ccwAngle.
+static float seam_visibility_penalty(float ccwAngle)
+{
+    // No penalty for reflex points, slight penalty for convex points, high penalty for flat surfaces.
+    const float penaltyConvexVertex = 1.f;
+    const float penaltyFlatSurface  = 5.f;
+//  if (ccwAngle <- float(PI/3.))
+    if (ccwAngle <- float(0.6 * PI))
+        // Sharp reflex vertex. We love that, it hides the seam perfectly.
+        return 0.f;
+//  else if (ccwAngle > float(PI/3.))
+    else if (ccwAngle > float(0.6 * PI))
+        // Seams on sharp convex vertices are more visible than on reflex vertices.
+        return penaltyConvexVertex;
+    else if (ccwAngle < 0.f) {
+        // Interpolate penalty between maximum and zero.
+        return penaltyFlatSurface * bspline_kernel(ccwAngle * float(PI * 2. / 3.));
+    } else {
+        assert(ccwAngle >= 0.f);
+        // Interpolate penalty between maximum and the penalty for a convex vertex.
+        return penaltyConvexVertex + (penaltyFlatSurface - penaltyConvexVertex) * bspline_kernel(ccwAngle * float(PI * 2. / 3.));
+    }
+}
+
+// Penalty for a seam at a point above an overhang.
+static float seam_overhang_penalty(const EdgeGrid::Grid &lower_layer_edge_grid, const Point &p, coordf_t nozzle_dmr)
+{
+    const float penaltyOverhangHalf = 10.f;
+    // Use the edge grid distance field structure over the lower layer to calculate overhangs.
+    coord_t nozzle_r = coord_t(floor(scale_(0.5 * nozzle_dmr) + 0.5));
+    coord_t search_r = coord_t(floor(scale_(0.8 * nozzle_dmr) + 0.5));
+    coordf_t dist;
+    // Signed distance is positive outside the object, negative inside the object.
+    // The point is considered at an overhang, if it is more than nozzle radius
+    // outside of the lower layer contour.
+    bool found = lower_layer_edge_grid.signed_distance(p, search_r, dist);
+    // If the approximate Signed Distance Field was initialized over lower_layer_edge_grid,
+    // then the signed distnace shall always be known.
+    assert(found);
+    return extrudate_overlap_penalty(float(nozzle_r), penaltyOverhangHalf, float(dist));
+}
+
+// Score the vertices of the counter clockwise polygon of a loop for placing a seam. This does not depend on the position
+// of the extruder, therefore it is done for the loops of the object layers by prepare_layer() ahead of extrude_loop().
+ExtrusionLoopSeam score_seam(const Polygon &polygon, bool was_clockwise, coordf_t nozzle_dmr, const EdgeGrid::Grid *lower_layer_edge_grid)
+{
+    const coord_t nozzle_r = coord_t(scale_(0.5 * nozzle_dmr) + 0.5);
+    ExtrusionLoopSeam seam;
+    seam.was_clockwise = was_clockwise;
+    // Parametrize the polygon by its length.
+    std::vector<float> lengths = polygon_parameter_by_length(polygon);
+    // The angles are caluculated over a minimum arm length of nozzle_r.
+    seam.visibility = polygon_angles_at_vertices(polygon, lengths, float(nozzle_r));
+    for (float &penalty : seam.visibility)
+        penalty = seam_visibility_penalty(was_clockwise ? - penalty : penalty);
+    // Penalty for overhangs.
+    if (lower_layer_edge_grid != nullptr) {
+        seam.overhang.reserve(polygon.points.size());
+        for (const Point &p : polygon.points)
+            seam.overhang.emplace_back(seam_overhang_penalty(*lower_layer_edge_grid, p, nozzle_dmr));
+    }
+    return seam;
+}
+
+// Place the seam of a loop scored by score_seam() close to last_pos, which is the extruder position,
+// the seam at the preceding layer or the rear of the object. Returns the seam point.
+Point place_seam(Polygon polygon, const ExtrusionLoopSeam &seam, const Point &last_pos, float last_pos_weight, coordf_t nozzle_dmr, const EdgeGrid::Grid *lower_layer_edge_grid)
+{
+    assert(polygon.points.size() == seam.visibility.size());
+    const coord_t nozzle_r = coord_t(scale_(0.5 * nozzle_dmr) + 0.5);
+    std::vector<float> visibility = seam.visibility;
+    std::vector<float> overhang   = seam.overhang;
+
+    // Insert a projection of last_pos into the polygon.
+    size_t last_pos_proj_idx;
+    std::vector<float> lengths;
+    {
+        const size_t num_points  = polygon.points.size();
+        const float  length_prev = polygon_parameter_by_length(polygon).back();
+        Points::iterator it = project_point_to_polygon_and_insert(polygon, last_pos, 0.1 * nozzle_r);
+        last_pos_proj_idx = it - polygon.points.begin();
+        // Parametrize the polygon by its length.
+        lengths = polygon_parameter_by_length(polygon);
+        if (polygon.points.size() > num_points) {
+            visibility.insert(visibility.begin() + last_pos_proj_idx, 0.f);
+            if (! overhang.empty()) {
+                assert(lower_layer_edge_grid != nullptr);
+                overhang.insert(overhang.begin() + last_pos_proj_idx, seam_overhang_penalty(*lower_layer_edge_grid, *it, nozzle_dmr));
+            }
+            // Score the inserted point and the vertices, the arms of which reach over the inserted point to the neighbour vertices of the inserted point,
+            // as polygon_angles_at_vertices() would on the polygon with the inserted point.
+            const size_t n          = polygon.points.size();
+            const float  arm_length = float(nozzle_r);
+            auto         score      = [&](size_t idx) {
+                float ccwAngle  = polygon_angle_at_vertex(polygon, lengths, idx, arm_length);
+                visibility[idx] = seam_visibility_penalty(seam.was_clockwise ? - ccwAngle : ccwAngle);
+            };
+            if (arm_length > 0.25f * std::min(length_prev, lengths.back())) {
+                // The arms are shortened to a quarter of the length of the polygon, which changed by the insertion. Score all the vertices.
+                for (size_t idx = 0; idx < n; ++ idx)
+                    score(idx);
+            } else {
+                auto dist = [&lengths](size_t from, size_t to) {
+                    return (from <= to) ? lengths[to] - lengths[from] : lengths.back() - lengths[from] + lengths[to];
+                };
+                score(last_pos_proj_idx);
+                // The following arm of a preceding vertex ends at the first vertex at least arm_length away.
+                const size_t idx_before = (last_pos_proj_idx == 0) ? n - 1 : last_pos_proj_idx - 1;
+                for (size_t idx = idx_before, i = 1; i < n && dist(idx, idx_before) < arm_length; idx = (idx == 0) ? n - 1 : idx - 1, ++ i)
+                    score(idx);
+                // The preceding arm of a following vertex ends at the first vertex farther than arm_length.
+                const size_t idx_after = (last_pos_proj_idx + 1 == n) ? 0 : last_pos_proj_idx + 1;
+                for (size_t idx = idx_after, i = 1; i < n && dist(idx_after, idx) <= arm_length; idx = (idx + 1 == n) ? 0 : idx + 1, ++ i)
+                    score(idx);
             }
-            #endif
         }
     }
-  
+
+    // For each polygon point, store a penalty.
+    std::vector<float> penalties(polygon.points.size(), 0.f);
+    for (size_t i = 0; i < polygon.points.size(); ++ i) {
+        // Give a negative penalty for points close to the last point or the prefered seam location.
+        float dist_to_last_pos_proj = (i < last_pos_proj_idx) ? 
+            std::min(lengths[last_pos_proj_idx] - lengths[i], lengths.back() - lengths[last_pos_proj_idx] + lengths[i]) : 
+            std::min(lengths[i] - lengths[last_pos_proj_idx], lengths.back() - lengths[i] + lengths[last_pos_proj_idx]);
+        float dist_max = 0.1f * lengths.back(); // 5.f * nozzle_dmr
+        penalties[i] = std::max(0.f, visibility[i] - last_pos_weight * bspline_kernel(dist_to_last_pos_proj / dist_max));
+        if (! overhang.empty())
+            penalties[i] += overhang[i];
+    }
+
+    // Find a point with a minimum penalty.
+    size_t idx_min = std::min_element(penalties.begin(), penalties.end()) - penalties.begin();
+
+    // if (seam_position == spAligned)
+    // For all (aligned, nearest, rear) seams:
+    {
+        // Very likely the weight of idx_min is very close to the weight of last_pos_proj_idx.
+        // In that case use last_pos_proj_idx instead.
+        float penalty_aligned  = penalties[last_pos_proj_idx];
+        float penalty_min      = penalties[idx_min];
+        float penalty_diff_abs = std::abs(penalty_min - penalty_aligned);
+        float penalty_max      = std::max(penalty_min, penalty_aligned);
+        float penalty_diff_rel = (penalty_max == 0.f) ? 0.f : penalty_diff_abs / penalty_max;
+        // printf("Align seams, penalty aligned: %f, min: %f, diff abs: %f, diff rel: %f\n", penalty_aligned, penalty_min, penalty_diff_abs, penalty_diff_rel);
+        if (penalty_diff_rel < 0.05) {
+            // Penalty of the aligned point is very close to the minimum penalty.
+            // Align the seams as accurately as possible.
+            idx_min = last_pos_proj_idx;
+        }
+    }
+    return polygon.points[idx_min];
+}
+
+// Score the seams of the loops of the object layers grouped by prepare_layer(). The rear seams are placed right away,
+// the nearest and aligned seams depend on the position of the extruder and on the seam at the preceding layer,
+// therefore extrude_loop() only picks the point with the lowest penalty close to that position.
+void GCode::score_seams(const Print &print, const std::vector<LayerToPrint> &layers, PreparedLayer &prepared)
+{
+    if (print.config().spiral_vase)
+        return;
+    for (std::pair<const unsigned int, std::vector<ObjectByExtruder>> &objects_by_extruder : prepared.by_extruder) {
+        const coordf_t nozzle_dmr = print.config().nozzle_diameter.get_at(objects_by_extruder.first);
+        for (size_t layer_id = 0; layer_id < objects_by_extruder.second.size(); ++ layer_id) {
+            const Layer *layer = layers[layer_id].object_layer;
+            if (layer == nullptr)
+                continue;
+            SeamPosition seam_position = layer->object()->config().seam_position;
+            if (seam_position != spNearest && seam_position != spAligned && seam_position != spRear)
+                continue;
+            Point rear = layer->object()->bounding_box().center();
+            rear(1) += coord_t(3. * layer->object()->bounding_box().radius());
+            auto score_loops = [seam_position, nozzle_dmr, &rear](ExtrusionEntityCollection &extrusions, const EdgeGrid::Grid *lower_layer_edge_grid) {
+                for (ExtrusionEntity *ee : extrusions.entities)
+                    if (ee->is_loop()) {
+                        ExtrusionLoop &loop = *static_cast<ExtrusionLoop*>(ee);
+                        // Counter clockwise polygon of the loop as produced by extrude_loop(), see ExtrusionLoop::reverse().
+                        Polygon polygon       = loop.polygon();
+                        bool    was_clockwise = polygon.is_clockwise();
+                        if (was_clockwise)
+                            std::reverse(polygon.points.begin() + 1, polygon.points.end());
+                        auto seam = std::make_shared<ExtrusionLoopSeam>(score_seam(polygon, was_clockwise, nozzle_dmr, lower_layer_edge_grid));
+                        if (seam_position == spRear) {
+                            seam->seam   = place_seam(std::move(polygon), *seam, rear, 5.f, nozzle_dmr, lower_layer_edge_grid);
+                            seam->placed = true;
+                            seam->visibility.clear();
+                            seam->overhang.clear();
+                        }
+                        loop.seam = std::move(seam);
+                    }
+            };
+            for (ObjectByExtruder::Island &island : objects_by_extruder.second[layer_id].islands)
+                for (ObjectByExtruder::Island::Region &region : island.by_region) {
+                    score_loops(region.perimeters, prepared.lower_layer_edge_grids[layer_id].get());
+                    // extrude_infill() does not avoid the overhangs.
+                    score_loops(region.infills, nullptr);
+                }
+        }
+    }
+}
+
+std::string GCode::extrude_loop(ExtrusionLoop loop, std::string description, double speed, const EdgeGrid::Grid *lower_layer_edge_grid)
+{
+    // get a copy; don't modify the orientation of the original loop object otherwise
+    // next copies (if any) would not detect the correct orientation
+
     // extrude all loops ccw
     bool was_clockwise = loop.make_counter_clockwise();
     
@@ -2061,145 +2446,40 @@ std::string GCode::extrude_loop(ExtrusionLoop loop, std::string description, dou
     if (m_config.spiral_vase) {
         loop.split_at(last_pos, false);
     } else if (seam_position == spNearest || seam_position == spAligned || seam_position == spRear) {
-        Polygon        polygon    = loop.polygon();
-        const coordf_t nozzle_dmr = EXTRUDER_CONFIG(nozzle_diameter);
-        const coord_t  nozzle_r   = coord_t(scale_(0.5 * nozzle_dmr) + 0.5);
-
-        // Retrieve the last start position for this object.
-        float last_pos_weight = 1.f;
-        switch (seam_position) {
-        case spAligned:
-            // Seam is aligned to the seam at the preceding layer.
-            if (m_layer != NULL && m_seam_position.count(m_layer->object()) > 0) {
-                last_pos = m_seam_position[m_layer->object()];
-                last_pos_weight = 1.f;
-            }
-            break;
-        case spRear:
-            last_pos = m_layer->object()->bounding_box().center();
-            last_pos(1) += coord_t(3. * m_layer->object()->bounding_box().radius());
-            last_pos_weight = 5.f;
-            break;
-        }
-
-        // Insert a projection of last_pos into the polygon.
-        size_t last_pos_proj_idx;
-        {
-            Points::iterator it = project_point_to_polygon_and_insert(polygon, last_pos, 0.1 * nozzle_r);
-            last_pos_proj_idx = it - polygon.points.begin();
-        }
-        Point last_pos_proj = polygon.points[last_pos_proj_idx];
-        // Parametrize the polygon by its length.
-        std::vector<float> lengths = polygon_parameter_by_length(polygon);
-
-        // For each polygon point, store a penalty.
-        // First calculate the angles, store them as penalties. The angles are caluculated over a minimum arm length of nozzle_r.
-        std::vector<float> penalties = polygon_angles_at_vertices(polygon, lengths, float(nozzle_r));
-        // No penalty for reflex points, slight penalty for convex points, high penalty for flat surfaces.
-        const float penaltyConvexVertex = 1.f;
-        const float penaltyFlatSurface  = 5.f;
-        const float penaltySeam         = 1.3f;
-        const float penaltyOverhangHalf = 10.f;
-        // Penalty for visible seams.
-        for (size_t i = 0; i < polygon.points.size(); ++ i) {
-            float ccwAngle = penalties[i];
-            if (was_clockwise)
-                ccwAngle = - ccwAngle;
-            float penalty = 0;
-//            if (ccwAngle <- float(PI/3.))
-            if (ccwAngle <- float(0.6 * PI))
-                // Sharp reflex vertex. We love that, it hides the seam perfectly.
-                penalty = 0.f;
-//            else if (ccwAngle > float(PI/3.))
-            else if (ccwAngle > float(0.6 * PI))
-                // Seams on sharp convex vertices are more visible than on reflex vertices.
-                penalty = penaltyConvexVertex;
-            else if (ccwAngle < 0.f) {
-                // Interpolate penalty between maximum and zero.
-                penalty = penaltyFlatSurface * bspline_kernel(ccwAngle * float(PI * 2. / 3.));
-            } else {
-                assert(ccwAngle >= 0.f);
-                // Interpolate penalty between maximum and the penalty for a convex vertex.
-                penalty = penaltyConvexVertex + (penaltyFlatSurface - penaltyConvexVertex) * bspline_kernel(ccwAngle * float(PI * 2. / 3.));
-            }
-            // Give a negative penalty for points close to the last point or the prefered seam location.
-            //float dist_to_last_pos_proj = last_pos_proj.distance_to(polygon.points[i]);
-            float dist_to_last_pos_proj = (i < last_pos_proj_idx) ? 
-                std::min(lengths[last_pos_proj_idx] - lengths[i], lengths.back() - lengths[last_pos_proj_idx] + lengths[i]) : 
-                std::min(lengths[i] - lengths[last_pos_proj_idx], lengths.back() - lengths[i] + lengths[last_pos_proj_idx]);
-            float dist_max = 0.1f * lengths.back(); // 5.f * nozzle_dmr
-            penalty -= last_pos_weight * bspline_kernel(dist_to_last_pos_proj / dist_max);
-            penalties[i] = std::max(0.f, penalty);
-        }
-
-        // Penalty for overhangs.
-        if (lower_layer_edge_grid && (*lower_layer_edge_grid)) {
-            // Use the edge grid distance field structure over the lower layer to calculate overhangs.
-            coord_t nozzle_r = coord_t(floor(scale_(0.5 * nozzle_dmr) + 0.5));
-            coord_t search_r = coord_t(floor(scale_(0.8 * nozzle_dmr) + 0.5));
-            for (size_t i = 0; i < polygon.points.size(); ++ i) {
-                const Point &p = polygon.points[i];
-                coordf_t dist;
-                // Signed distance is positive outside the object, negative inside the object.
-                // The point is considered at an overhang, if it is more than nozzle radius
-                // outside of the lower layer contour.
-                bool found = (*lower_layer_edge_grid)->signed_distance(p, search_r, dist);
-                // If the approximate Signed Distance Field was initialized over lower_layer_edge_grid,
-                // then the signed distnace shall always be known.
-                assert(found);
-                penalties[i] += extrudate_overlap_penalty(float(nozzle_r), penaltyOverhangHalf, float(dist));
-            }
-        }
-
-        // Find a point with a minimum penalty.
-        size_t idx_min = std::min_element(penalties.begin(), penalties.end()) - penalties.begin();
-
-        // if (seam_position == spAligned)
-        // For all (aligned, nearest, rear) seams:
-        {
-            // Very likely the weight of idx_min is very close to the weight of last_pos_proj_idx.
-            // In that case use last_pos_proj_idx instead.
-            float penalty_aligned  = penalties[last_pos_proj_idx];
-            float penalty_min      = penalties[idx_min];
-            float penalty_diff_abs = std::abs(penalty_min - penalty_aligned);
-            float penalty_max      = std::max(penalty_min, penalty_aligned);
-            float penalty_diff_rel = (penalty_max == 0.f) ? 0.f : penalty_diff_abs / penalty_max;
-            // printf("Align seams, penalty aligned: %f, min: %f, diff abs: %f, diff rel: %f\n", penalty_aligned, penalty_min, penalty_diff_abs, penalty_diff_rel);
-            if (penalty_diff_rel < 0.05) {
-                // Penalty of the aligned point is very close to the minimum penalty.
-                // Align the seams as accurately as possible.
-                idx_min = last_pos_proj_idx;
+        // The seam is scored by prepare_layer() for the loops of the object layers, the other loops (skirt, brim, support)
+        // are scored here.
+        Polygon polygon = loop.polygon();
+        std::shared_ptr<const ExtrusionLoopSeam> seam = loop.seam;
+        if (! seam || seam->was_clockwise != was_clockwise || (! seam->placed && seam->visibility.size() != polygon.points.size()))
+            seam = std::make_shared<const ExtrusionLoopSeam>(score_seam(polygon, was_clockwise, EXTRUDER_CONFIG(nozzle_diameter), lower_layer_edge_grid));
+        Point seam_point;
+        if (seam->placed)
+            seam_point = seam->seam;
+        else {
+            // Retrieve the last start position for this object.
+            float last_pos_weight = 1.f;
+            switch (seam_position) {
+            case spAligned:
+                // Seam is aligned to the seam at the preceding layer.
+                if (m_layer != NULL && m_seam_position.count(m_layer->object()) > 0) {
+                    last_pos = m_seam_position[m_layer->object()];
+                    last_pos_weight = 1.f;
+                }
+                break;
+            case spRear:
+                last_pos = m_layer->object()->bounding_box().center();
+                last_pos(1) += coord_t(3. * m_layer->object()->bounding_box().radius());
+                last_pos_weight = 5.f;
+                break;
             }
-            m_seam_position[m_layer->object()] = polygon.points[idx_min];
+            seam_point = place_seam(std::move(polygon), *seam, last_pos, last_pos_weight, EXTRUDER_CONFIG(nozzle_diameter), lower_layer_edge_grid);
         }
-
-        // Export the contour into a SVG file.
-        #if 0
-        {
-            static int iRun = 0;
-            SVG svg(debug_out_path("GCode_extrude_loop-%d.svg", iRun ++));
-            if (m_layer->lower_layer != NULL)
-                svg.draw(m_layer->lower_layer->slices.expolygons);
-            for (size_t i = 0; i < loop.paths.size(); ++ i)
-                svg.draw(loop.paths[i].as_polyline(), "red");
-            Polylines polylines;
-            for (size_t i = 0; i < loop.paths.size(); ++ i)
-                polylines.push_back(loop.paths[i].as_polyline());
-            Slic3r::Polygons polygons;
-            coordf_t nozzle_dmr = EXTRUDER_CONFIG(nozzle_diameter);
-            coord_t delta = scale_(0.5*nozzle_dmr);
-            Slic3r::offset(polylines, &polygons, delta);
-//            for (size_t i = 0; i < polygons.size(); ++ i) svg.draw((Polyline)polygons[i], "blue");
-            svg.draw(last_pos, "green", 3);
-            svg.draw(polygon.points[idx_min], "yellow", 3);
-            svg.Close();
-        }
-        #endif
+        m_seam_position[m_layer->object()] = seam_point;
 
         // Split the loop at the point with a minium penalty.
-        if (!loop.split_at_vertex(polygon.points[idx_min]))
+        if (!loop.split_at_vertex(seam_point))
             // The point is not in the original loop. Insert it.
-            loop.split_at(polygon.points[idx_min], true);
+            loop.split_at(seam_point, true);
 
     } else if (seam_position == spRandom) {
         if (loop.loop_role() == elrContourInternalPerimeter) {
@@ -2304,7 +2584,7 @@ std::string GCode::extrude_multi_path(ExtrusionMultiPath multipath, std::string
     return gcode;
 }
 
-std::string GCode::extrude_entity(const ExtrusionEntity &entity, std::string description, double speed, std::unique_ptr<EdgeGrid::Grid> *lower_layer_edge_grid)
+std::string GCode::extrude_entity(const ExtrusionEntity &entity, std::string description, double speed, const EdgeGrid::Grid *lower_layer_edge_grid)
 {
     if (const ExtrusionPath* path = dynamic_cast<const ExtrusionPath*>(&entity))
         return this->extrude_path(*path, description, speed);
@@ -2333,30 +2613,49 @@ std::string GCode::extrude_path(ExtrusionPath path, std::string description, dou
 }
 
 // Extrude perimeters: Decide where to put seams (hide or align seams).
-std::string GCode::extrude_perimeters(const Print &print, const std::vector<ObjectByExtruder::Island::Region> &by_region, std::unique_ptr<EdgeGrid::Grid> &lower_layer_edge_grid)
+std::string GCode::extrude_perimeters(const Print &print, const std::vector<ObjectByExtruder::Island::Region> &by_region, const EdgeGrid::Grid *lower_layer_edge_grid)
 {
     std::string gcode;
     for (const ObjectByExtruder::Island::Region &region : by_region) {
         m_config.apply(print.regions()[&region - &by_region.front()]->config());
         for (ExtrusionEntity *ee : region.perimeters.entities)
-            gcode += this->extrude_entity(*ee, "perimeter", -1., &lower_layer_edge_grid);
+            gcode += this->extrude_entity(*ee, "perimeter", -1., lower_layer_edge_grid);
     }
     return gcode;
 }
 
 // Chain the paths hierarchically by a greedy algorithm to minimize a travel distance.
+// The entities are extruded in the chained order, only those to be extruded reversed are copied.
 std::string GCode::extrude_infill(const Print &print, const std::vector<ObjectByExtruder::Island::Region> &by_region)
 {
     std::string gcode;
+    auto extrude_chained = [this, &gcode](const ExtrusionEntityCollection &fills) {
+        for (const std::pair<size_t, bool> &o : fills.chained_order_from(m_last_pos, false)) {
+            const ExtrusionEntity *ee = fills.entities[o.first];
+            if (o.second) {
+                std::unique_ptr<ExtrusionEntity> reversed(ee->clone());
+                reversed->reverse();
+                gcode += this->extrude_entity(*reversed, "infill");
+            } else
+                gcode += this->extrude_entity(*ee, "infill");
+        }
+    };
     for (const ObjectByExtruder::Island::Region &region : by_region) {
         m_config.apply(print.regions()[&region - &by_region.front()]->config());
-		ExtrusionEntityCollection chained = region.infills.chained_path_from(m_last_pos, false);
-        for (ExtrusionEntity *fill : chained.entities) {
-            auto *eec = dynamic_cast<ExtrusionEntityCollection*>(fill);
-            if (eec) {
-				ExtrusionEntityCollection chained2 = eec->chained_path_from(m_last_pos, false);
-				for (ExtrusionEntity *ee : chained2.entities)
-                    gcode += this->extrude_entity(*ee, "infill");
+        for (const std::pair<size_t, bool> &o : region.infills.chained_order_from(m_last_pos, false)) {
+            const ExtrusionEntity *fill = region.infills.entities[o.first];
+            if (fill->is_collection()) {
+                const auto *eec = static_cast<const ExtrusionEntityCollection*>(fill);
+                if (o.second) {
+                    ExtrusionEntityCollection reversed(*eec);
+                    reversed.reverse();
+                    extrude_chained(reversed);
+                } else
+                    extrude_chained(*eec);
+            } else if (o.second) {
+                std::unique_ptr<ExtrusionEntity> reversed(fill->clone());
+                reversed->reverse();
+                gcode += this->extrude_entity(*reversed, "infill");
             } else
                 gcode += this->extrude_entity(*fill, "infill");
         }
@@ -2364,7 +2663,7 @@ std::string GCode::extrude_infill(const Print &print, const std::vector<ObjectBy
     return gcode;
 }
 
-std::string GCode::extrude_support(const ExtrusionEntityCollection &support_fills)
+std::string GCode::extrude_support(const ExtrusionEntityCollection &support_fills, ExtrusionRole support_extrusion_role)
 {
     std::string gcode;
     if (! support_fills.entities.empty()) {
@@ -2372,19 +2671,27 @@ std::string GCode::extrude_support(const ExtrusionEntityCollection &support_fill
         const char   *support_interface_label  = "support material interface";
         const double  support_speed            = m_config.support_material_speed.value;
         const double  support_interface_speed  = m_config.support_material_interface_speed.get_abs_value(support_speed);
-        for (const ExtrusionEntity *ee : support_fills.entities) {
+        for (const std::pair<size_t, bool> &o : support_fills.chained_order_from(m_last_pos, false, support_extrusion_role)) {
+            const ExtrusionEntity *ee = support_fills.entities[o.first];
             ExtrusionRole role = ee->role();
             assert(role == erSupportMaterial || role == erSupportMaterialInterface);
             const char  *label = (role == erSupportMaterial) ? support_label : support_interface_label;
             const double speed = (role == erSupportMaterial) ? support_speed : support_interface_speed;
             const ExtrusionPath *path = dynamic_cast<const ExtrusionPath*>(ee);
-            if (path)
-                gcode += this->extrude_path(*path, label, speed);
-            else {
+            if (path) {
+                ExtrusionPath copy(*path);
+                if (o.second)
+                    copy.reverse();
+                gcode += this->extrude_path(std::move(copy), label, speed);
+            } else {
                 const ExtrusionMultiPath *multipath = dynamic_cast<const ExtrusionMultiPath*>(ee);
                 assert(multipath != nullptr);
-                if (multipath)
-                    gcode += this->extrude_multi_path(*multipath, label, speed);
+                if (multipath) {
+                    ExtrusionMultiPath copy(*multipath);
+                    if (o.second)
+                        copy.reverse();
+                    gcode += this->extrude_multi_path(std::move(copy), label, speed);
+                }
             }
         }
     }
@@ -2394,15 +2701,31 @@ std::string GCode::extrude_support(const ExtrusionEntityCollection &support_fill
 void GCode::_write(FILE* file, const char *what)
 {
     if (what != nullptr) {
-        // apply analyzer, if enabled
-        const char* gcode = m_enable_analyzer ? m_analyzer.process_gcode(what).c_str() : what;
+        // Parse the G-code once, pass the parsed lines to the analyzer (if enabled) and to the time estimators.
+        // The analyzer workcodes are consumed by the analyzer, they are neither written to the file nor seen by the time estimators.
+        m_write_buffer.clear();
+        GCodeReader::GCodeLine gline;
+        auto action = [this](GCodeReader &, const GCodeReader::GCodeLine &line) {
+            if (m_enable_analyzer) {
+                if (! m_analyzer.process_gcode_line(line))
+                    return;
+                m_write_buffer += line.raw();
+                m_write_buffer += '\n';
+            }
+            m_normal_time_estimator.add_gcode_line(line);
+            if (m_silent_time_estimator_enabled)
+                m_silent_time_estimator.add_gcode_line(line);
+        };
+        for (const char *ptr = what; *ptr != 0;) {
+            gline.reset();
+            ptr = m_gcode_reader.parse_line(ptr, gline, action);
+        }
 
         // writes string to file
-        fwrite(gcode, 1, ::strlen(gcode), file);
-        // updates time estimator and gcode lines vector
-        m_normal_time_estimator.add_gcode_block(gcode);
-        if (m_silent_time_estimator_enabled)
-            m_silent_time_estimator.add_gcode_block(gcode);
+        if (m_enable_analyzer)
+            fwrite(m_write_buffer.data(), 1, m_write_buffer.size(), file);
+        else
+            fwrite(what, 1, ::strlen(what), file);
     }
 }
 
@@ -18,6 +18,8 @@
 #include "EdgeGrid.hpp"
 #include "GCode/Analyzer.hpp"
 
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -46,13 +48,16 @@ public:
     ~AvoidCrossingPerimeters() {}
 
     void init_external_mp(const ExPolygons &islands) { m_external_mp = Slic3r::make_unique<MotionPlanner>(islands); }
-    void init_layer_mp(const ExPolygons &islands) { m_layer_mp = Slic3r::make_unique<MotionPlanner>(islands); }
+    // Reuses the motion planner of one of the recently printed layers with identical islands, together with its graphs.
+    void init_layer_mp(const ExPolygons &islands);
 
     Polyline travel_to(const GCode &gcodegen, const Point &point);
 
 private:
     std::unique_ptr<MotionPlanner> m_external_mp;
-    std::unique_ptr<MotionPlanner> m_layer_mp;
+    MotionPlanner                 *m_layer_mp = nullptr;
+    // Motion planners of the recently printed layers with their islands, the most recently used first.
+    std::vector<std::pair<ExPolygons, std::unique_ptr<MotionPlanner>>> m_layer_mp_cache;
 };
 
 class OozePrevention {
@@ -197,27 +202,15 @@ protected:
     };
     static std::vector<GCode::LayerToPrint>                            collect_layers_to_print(const PrintObject &object);
     static std::vector<std::pair<coordf_t, std::vector<LayerToPrint>>> collect_layers_to_print(const Print &print);
-    void            process_layer(
-        // Write into the output file.
-        FILE                            *file,
-        const Print                     &print,
-        // Set of object & print layers of the same PrintObject and with the same print_z.
-        const std::vector<LayerToPrint> &layers,
-        const LayerTools  &layer_tools,
-        // If set to size_t(-1), then print all copies of all objects.
-        // Otherwise print a single copy of a single object.
-        const size_t                     single_object_idx = size_t(-1));
-
-    void            set_last_pos(const Point &pos) { m_last_pos = pos; m_last_pos_defined = true; }
-    bool            last_pos_defined() const { return m_last_pos_defined; }
-    void            set_extruders(const std::vector<unsigned int> &extruder_ids);
-    std::string     preamble();
-    std::string     change_layer(coordf_t print_z);
-    std::string     extrude_entity(const ExtrusionEntity &entity, std::string description = "", double speed = -1., std::unique_ptr<EdgeGrid::Grid> *lower_layer_edge_grid = nullptr);
-    std::string     extrude_loop(ExtrusionLoop loop, std::string description, double speed = -1., std::unique_ptr<EdgeGrid::Grid> *lower_layer_edge_grid = nullptr);
-    std::string     extrude_multi_path(ExtrusionMultiPath multipath, std::string description = "", double speed = -1.);
-    std::string     extrude_path(ExtrusionPath path, std::string description = "", double speed = -1.);
-
+    // G-code of a single layer produced by process_layer(), to be post-processed by the cooling buffer
+    // and written out by process_layers().
+    struct LayerResult {
+        std::string gcode;
+        // Layer ID passed to the cooling buffer, size_t(-1) if there was nothing to extrude at this layer.
+        size_t      layer_id = size_t(-1);
+        coordf_t    print_z  = 0.;
+        bool        empty() const { return layer_id == size_t(-1); }
+    };
     typedef std::vector<int> ExtruderPerCopy;
     // Extruding multiple objects with soluble / non-soluble / combined supports
     // on a multi-material printer, trying to minimize tool switches.
@@ -251,10 +244,56 @@ protected:
         std::vector<Island>         islands;
     };
 
+    // Signed distance fields over the lower layers of a set of LayerToPrint, one per LayerToPrint, used to avoid placing
+    // the seams of the perimeters above overhangs. A field is null if its layer has no perimeters to place a seam on.
+    typedef std::vector<std::unique_ptr<EdgeGrid::Grid>> LowerLayerEdgeGrids;
+    static LowerLayerEdgeGrids lower_layer_edge_grids(const Print &print, const std::vector<LayerToPrint> &layers);
+    // Extrusions of a set of LayerToPrint grouped by prepare_layer(), to be extruded by process_layer().
+    struct PreparedLayer {
+        // Extrusions grouped by an extruder, then by an object (index of LayerToPrint), an island and a region.
+        std::map<unsigned int, std::vector<ObjectByExtruder>>   by_extruder;
+        // Distance fields over the layers below, see lower_layer_edge_grids(). They are queried by extrude_loop()
+        // for a seam point, which was not scored by score_seams().
+        LowerLayerEdgeGrids                                     lower_layer_edge_grids;
+    };
+    // Score the seams of the loops grouped by prepare_layer(), to be placed by extrude_loop().
+    static void score_seams(const Print &print, const std::vector<LayerToPrint> &layers, PreparedLayer &prepared);
+    static PreparedLayer prepare_layer(
+        const Print                     &print,
+        // Set of object & print layers of the same PrintObject and with the same print_z.
+        const std::vector<LayerToPrint> &layers,
+        const LayerTools                &layer_tools);
+    LayerResult     process_layer(
+        const Print                     &print,
+        // Set of object & print layers of the same PrintObject and with the same print_z.
+        const std::vector<LayerToPrint> &layers,
+        const LayerTools                &layer_tools,
+        // Extrusions of the layers grouped by prepare_layer().
+        PreparedLayer                   &prepared,
+        // If set to size_t(-1), then print all copies of all objects.
+        // Otherwise print a single copy of a single object.
+        const size_t                     single_object_idx = size_t(-1));
+    // Generate num_layers layers by calling generate(layer_idx) in the order of the layers, post-process them
+    // by the cooling buffer and write them into the output file. The stages are pipelined over the layers.
+    // The extrusions of a layer are grouped by prepare(layer_idx) ahead of generate(), in parallel for several layers.
+    void            process_layers(FILE *file, const Print &print, size_t num_layers,
+                                   const std::function<PreparedLayer(size_t)> &prepare,
+                                   const std::function<LayerResult(size_t, PreparedLayer&)> &generate);
+
+    void            set_last_pos(const Point &pos) { m_last_pos = pos; m_last_pos_defined = true; }
+    bool            last_pos_defined() const { return m_last_pos_defined; }
+    void            set_extruders(const std::vector<unsigned int> &extruder_ids);
+    std::string     preamble();
+    std::string     change_layer(coordf_t print_z);
+    std::string     extrude_entity(const ExtrusionEntity &entity, std::string description = "", double speed = -1., const EdgeGrid::Grid *lower_layer_edge_grid = nullptr);
+    std::string     extrude_loop(ExtrusionLoop loop, std::string description, double speed = -1., const EdgeGrid::Grid *lower_layer_edge_grid = nullptr);
+    std::string     extrude_multi_path(ExtrusionMultiPath multipath, std::string description = "", double speed = -1.);
+    std::string     extrude_path(ExtrusionPath path, std::string description = "", double speed = -1.);
 
-    std::string     extrude_perimeters(const Print &print, const std::vector<ObjectByExtruder::Island::Region> &by_region, std::unique_ptr<EdgeGrid::Grid> &lower_layer_edge_grid);
+    std::string     extrude_perimeters(const Print &print, const std::vector<ObjectByExtruder::Island::Region> &by_region, const EdgeGrid::Grid *lower_layer_edge_grid);
     std::string     extrude_infill(const Print &print, const std::vector<ObjectByExtruder::Island::Region> &by_region);
-    std::string     extrude_support(const ExtrusionEntityCollection &support_fills);
+    // Extrudes the support paths of the given role (or of all roles if erMixed) chained from the last position.
+    std::string     extrude_support(const ExtrusionEntityCollection &support_fills, ExtrusionRole support_extrusion_role);
 
     std::string     travel_to(const Point &point, ExtrusionRole role, std::string comment);
     bool            needs_retraction(const Polyline &travel, ExtrusionRole role = erNone);
@@ -334,6 +373,12 @@ protected:
     // Analyzer
     GCodeAnalyzer m_analyzer;
 
+    // Parser of the exported G-code. The G-code is parsed once by _write() and the parsed lines
+    // are passed to the analyzer and to the time estimators.
+    GCodeReader m_gcode_reader;
+    // Output of _write() with the analyzer workcodes removed.
+    std::string m_write_buffer;
+
     // Write a string into a file.
     void _write(FILE* file, const std::string& what) { this->_write(file, what.c_str()); }
     void _write(FILE* file, const char *what);
@@ -369,6 +414,14 @@ protected:
     friend class WipeTowerIntegration;
 };
 
+// The seam placement of GCode::extrude_loop() split into the scoring of a loop, which does not depend on the position
+// of the extruder, and the placement close to the extruder position. The polygon is the counter clockwise polygon of the loop.
+std::vector<float>  polygon_parameter_by_length(const Polygon &polygon);
+std::vector<float>  polygon_angles_at_vertices(const Polygon &polygon, const std::vector<float> &lengths, float min_arm_length);
+Points::iterator    project_point_to_polygon_and_insert(Polygon &polygon, const Point &pt, double eps);
+ExtrusionLoopSeam   score_seam(const Polygon &polygon, bool was_clockwise, coordf_t nozzle_dmr, const EdgeGrid::Grid *lower_layer_edge_grid);
+Point               place_seam(Polygon polygon, const ExtrusionLoopSeam &seam, const Point &last_pos, float last_pos_weight, coordf_t nozzle_dmr, const EdgeGrid::Grid *lower_layer_edge_grid);
+
 }
 
 #endif
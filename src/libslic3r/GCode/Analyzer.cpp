@@ -122,10 +122,23 @@ void GCodeAnalyzer::reset()
     _set_start_extrusion(DEFAULT_START_EXTRUSION);
     _reset_axes_position();
 
-    m_moves_map.clear();
+    m_extrusion = ExtrusionAccumulator();
+    m_travel = TravelAccumulator();
+    m_retractions = GCodePreviewData::Retraction::Layer(FLT_MAX);
+    m_unretractions = GCodePreviewData::Retraction::Layer(FLT_MAX);
     m_extruder_offsets.clear();
 }
 
+void GCodeAnalyzer::set_preview_data(GCodePreviewData *preview_data, std::function<void()> layers_added_callback)
+{
+    m_preview_data = preview_data;
+    m_layers_added_callback = layers_added_callback;
+    m_layers_added = 0;
+    m_layers_added_next_callback = 1;
+    if (m_preview_data != nullptr)
+        m_preview_data->reset();
+}
+
 const std::string& GCodeAnalyzer::process_gcode(const std::string& gcode)
 {
     m_process_output = "";
@@ -137,22 +150,20 @@ const std::string& GCodeAnalyzer::process_gcode(const std::string& gcode)
     return m_process_output;
 }
 
-void GCodeAnalyzer::calc_gcode_preview_data(GCodePreviewData& preview_data, std::function<void()> cancel_callback)
+void GCodeAnalyzer::flush_gcode_preview_data()
 {
-    // resets preview data
-    preview_data.reset();
-
-    // calculates extrusion layers
-    _calc_gcode_preview_extrusion_layers(preview_data, cancel_callback);
-
-    // calculates travel
-    _calc_gcode_preview_travel(preview_data, cancel_callback);
+    // stores the last polylines
+    _flush_gcode_preview_extrusion_layers();
+    _flush_gcode_preview_travel();
 
-    // calculates retractions
-    _calc_gcode_preview_retractions(preview_data, cancel_callback);
+    // stores the last layers
+    _add_gcode_preview_extrusion_layer(FLT_MAX);
+    _add_gcode_preview_travel_layer(FLT_MAX);
+    _add_gcode_preview_retraction_layer(m_retractions, false, FLT_MAX);
+    _add_gcode_preview_retraction_layer(m_unretractions, true, FLT_MAX);
 
-    // calculates unretractions
-    _calc_gcode_preview_unretractions(preview_data, cancel_callback);
+    m_extrusion = ExtrusionAccumulator();
+    m_travel = TravelAccumulator();
 }
 
 bool GCodeAnalyzer::is_valid_extrusion_role(ExtrusionRole role)
@@ -161,16 +172,17 @@ bool GCodeAnalyzer::is_valid_extrusion_role(ExtrusionRole role)
 }
 
 void GCodeAnalyzer::_process_gcode_line(GCodeReader&, const GCodeReader::GCodeLine& line)
+{
+    if (process_gcode_line(line))
+        // puts the line back into the gcode
+        m_process_output += line.raw() + "\n";
+}
+
+bool GCodeAnalyzer::process_gcode_line(const GCodeReader::GCodeLine& line)
 {
     // processes 'special' comments contained in line
     if (_process_tags(line))
-    {
-#if 0
-        // DEBUG ONLY: puts the line back into the gcode
-        m_process_output += line.raw() + "\n";
-#endif
-        return;
-    }
+        return false;
 
     // sets new start position/extrusion
     _set_start_position(_get_end_position());
@@ -261,8 +273,7 @@ void GCodeAnalyzer::_process_gcode_line(GCodeReader&, const GCodeReader::GCodeLi
         }
     }
 
-    // puts the line back into the gcode
-    m_process_output += line.raw() + "\n";
+    return true;
 }
 
 // Returns the new absolute position on the given axis in dependence of the given parameters
@@ -654,11 +665,6 @@ Vec3d GCodeAnalyzer::_get_end_position() const
 
 void GCodeAnalyzer::_store_move(GCodeAnalyzer::GCodeMove::EType type)
 {
-    // if type non mapped yet, map it
-    TypeToMovesMap::iterator it = m_moves_map.find(type);
-    if (it == m_moves_map.end())
-        it = m_moves_map.insert(TypeToMovesMap::value_type(type, GCodeMovesList())).first;
-
     // store move
     Vec3d extruder_offset = Vec3d::Zero();
     unsigned int extruder_id = _get_extruder_id();
@@ -668,7 +674,24 @@ void GCodeAnalyzer::_store_move(GCodeAnalyzer::GCodeMove::EType type)
 
     Vec3d start_position = _get_start_position() + extruder_offset;
     Vec3d end_position = _get_end_position() + extruder_offset;
-    it->second.emplace_back(type, _get_extrusion_role(), extruder_id, _get_mm3_per_mm(), _get_width(), _get_height(), _get_feedrate(), start_position, end_position, _get_delta_extrusion(), _get_cp_color_id());
+    GCodeMove move(type, _get_extrusion_role(), extruder_id, _get_mm3_per_mm(), _get_width(), _get_height(), _get_feedrate(), start_position, end_position, _get_delta_extrusion(), _get_cp_color_id());
+
+    switch (type)
+    {
+    case GCodeMove::Extrude:
+        _update_gcode_preview_extrusion_layers(move);
+        break;
+    case GCodeMove::Move:
+        _update_gcode_preview_travel(move);
+        break;
+    case GCodeMove::Retract:
+    case GCodeMove::Unretract:
+        _update_gcode_preview_retractions(move);
+        break;
+    default:
+        // tool changes are not visualized
+        break;
+    }
 }
 
 bool GCodeAnalyzer::_is_valid_extrusion_role(int value) const
@@ -676,255 +699,181 @@ bool GCodeAnalyzer::_is_valid_extrusion_role(int value) const
     return ((int)erNone <= value) && (value <= (int)erMixed);
 }
 
-void GCodeAnalyzer::_calc_gcode_preview_extrusion_layers(GCodePreviewData& preview_data, std::function<void()> cancel_callback)
+void GCodeAnalyzer::_update_gcode_preview_extrusion_layers(const GCodeMove& move)
 {
-    struct Helper
-    {
-        static GCodePreviewData::Extrusion::Layer& get_layer_at_z(GCodePreviewData::Extrusion::LayersList& layers, float z)
-        {
-            //FIXME this has a terrible time complexity
-            for (GCodePreviewData::Extrusion::Layer& layer : layers)
-            {
-                // if layer found, return it
-                if (layer.z == z)
-                    return layer;
-            }
-
-            // if layer not found, create and return it
-            layers.emplace_back(z, ExtrusionPaths());
-            return layers.back();
-        }
-
-        static void store_polyline(const Polyline& polyline, const Metadata& data, float z, GCodePreviewData& preview_data)
-        {
-            // if the polyline is valid, create the extrusion path from it and store it
-            if (polyline.is_valid())
-            {
-                ExtrusionPath path(data.extrusion_role, data.mm3_per_mm, data.width, data.height);
-                path.polyline = polyline;
-                path.feedrate = data.feedrate;
-                path.extruder_id = data.extruder_id;
-                path.cp_color_id = data.cp_color_id;
-
-                get_layer_at_z(preview_data.extrusion.layers, z).paths.push_back(path);
-            }
-        }
-    };
-
-    TypeToMovesMap::iterator extrude_moves = m_moves_map.find(GCodeMove::Extrude);
-    if (extrude_moves == m_moves_map.end())
-        return;
-
-    Metadata data;
-    float z = FLT_MAX;
-    Polyline polyline;
-    Vec3d position(FLT_MAX, FLT_MAX, FLT_MAX);
-    float volumetric_rate = FLT_MAX;
-    GCodePreviewData::Range height_range;
-    GCodePreviewData::Range width_range;
-    GCodePreviewData::Range feedrate_range;
-    GCodePreviewData::Range volumetric_rate_range;
-
-    // to avoid to call the callback too often
-    unsigned int cancel_callback_threshold = (unsigned int)std::max((int)extrude_moves->second.size() / 25, 1);
-    unsigned int cancel_callback_curr = 0;
-
-    // constructs the polylines while traversing the moves
-    for (const GCodeMove& move : extrude_moves->second)
+    ExtrusionAccumulator &acc = m_extrusion;
+    if ((acc.data != move.data) || (acc.z != move.start_position.z()) || (acc.position != move.start_position) || (acc.volumetric_rate != move.data.feedrate * (float)move.data.mm3_per_mm))
     {
-        // to avoid to call the callback too often
-        cancel_callback_curr = (cancel_callback_curr + 1) % cancel_callback_threshold;
-        if (cancel_callback_curr == 0)
-            cancel_callback();
+        // store current polyline
+        _flush_gcode_preview_extrusion_layers();
 
-        if ((data != move.data) || (z != move.start_position.z()) || (position != move.start_position) || (volumetric_rate != move.data.feedrate * (float)move.data.mm3_per_mm))
-        {
-            // store current polyline
-            polyline.remove_duplicate_points();
-            Helper::store_polyline(polyline, data, z, preview_data);
-
-            // reset current polyline
-            polyline = Polyline();
-
-            // add both vertices of the move
-            polyline.append(Point(scale_(move.start_position.x()), scale_(move.start_position.y())));
-            polyline.append(Point(scale_(move.end_position.x()), scale_(move.end_position.y())));
-
-            // update current values
-            data = move.data;
-            z = (float)move.start_position.z();
-            volumetric_rate = move.data.feedrate * (float)move.data.mm3_per_mm;
-            height_range.update_from(move.data.height);
-            width_range.update_from(move.data.width);
-            feedrate_range.update_from(move.data.feedrate);
-            volumetric_rate_range.update_from(volumetric_rate);
-        }
-        else
-            // append end vertex of the move to current polyline
-            polyline.append(Point(scale_(move.end_position.x()), scale_(move.end_position.y())));
+        // add both vertices of the move
+        acc.polyline.append(Point(scale_(move.start_position.x()), scale_(move.start_position.y())));
+        acc.polyline.append(Point(scale_(move.end_position.x()), scale_(move.end_position.y())));
 
         // update current values
-        position = move.end_position;
+        acc.data = move.data;
+        acc.z = (float)move.start_position.z();
+        acc.volumetric_rate = move.data.feedrate * (float)move.data.mm3_per_mm;
+        acc.ranges.height.update_from(move.data.height);
+        acc.ranges.width.update_from(move.data.width);
+        acc.ranges.feedrate.update_from(move.data.feedrate);
+        acc.ranges.volumetric_rate.update_from(acc.volumetric_rate);
     }
+    else
+        // append end vertex of the move to current polyline
+        acc.polyline.append(Point(scale_(move.end_position.x()), scale_(move.end_position.y())));
 
-    // store last polyline
-    polyline.remove_duplicate_points();
-    Helper::store_polyline(polyline, data, z, preview_data);
-
-    // updates preview ranges data
-    preview_data.ranges.height.update_from(height_range);
-    preview_data.ranges.width.update_from(width_range);
-    preview_data.ranges.feedrate.update_from(feedrate_range);
-    preview_data.ranges.volumetric_rate.update_from(volumetric_rate_range);
-
-    // we need to sort the layers by their z as they can be shuffled in case of sequential prints
-    std::sort(preview_data.extrusion.layers.begin(), preview_data.extrusion.layers.end(), [](const GCodePreviewData::Extrusion::Layer& l1, const GCodePreviewData::Extrusion::Layer& l2)->bool { return l1.z < l2.z; });
+    // update current values
+    acc.position = move.end_position;
 }
 
-void GCodeAnalyzer::_calc_gcode_preview_travel(GCodePreviewData& preview_data, std::function<void()> cancel_callback)
+void GCodeAnalyzer::_flush_gcode_preview_extrusion_layers()
 {
-    struct Helper
-    {
-        static void store_polyline(const Polyline3& polyline, GCodePreviewData::Travel::EType type, GCodePreviewData::Travel::Polyline::EDirection direction, 
-            float feedrate, unsigned int extruder_id, GCodePreviewData& preview_data)
-        {
-            // if the polyline is valid, store it
-            if (polyline.is_valid())
-                preview_data.travel.polylines.emplace_back(type, direction, feedrate, extruder_id, polyline);
-        }
-    };
+    ExtrusionAccumulator &acc = m_extrusion;
+    acc.polyline.remove_duplicate_points();
 
-    TypeToMovesMap::iterator travel_moves = m_moves_map.find(GCodeMove::Move);
-    if (travel_moves == m_moves_map.end())
-        return;
-
-    Polyline3 polyline;
-    Vec3d position(FLT_MAX, FLT_MAX, FLT_MAX);
-    GCodePreviewData::Travel::EType type = GCodePreviewData::Travel::Num_Types;
-    GCodePreviewData::Travel::Polyline::EDirection direction = GCodePreviewData::Travel::Polyline::Num_Directions;
-    float feedrate = FLT_MAX;
-    unsigned int extruder_id = -1;
+    // if the polyline is valid, store it into the current layer
+    if (acc.polyline.is_valid())
+    {
+        // the layers are added to the preview data as the moves leave them, the layers of a sequential print
+        // are merged with the ones of the objects printed before by GCodePreviewData::add_extrusion_layer()
+        if (acc.layer.z != acc.z)
+            _add_gcode_preview_extrusion_layer(acc.z);
+        acc.layer.add_path(acc.data.extrusion_role, acc.data.width, acc.data.height, acc.data.feedrate, (float)acc.data.mm3_per_mm,
+            acc.data.extruder_id, acc.data.cp_color_id, acc.polyline.points);
+    }
 
-    GCodePreviewData::Range height_range;
-    GCodePreviewData::Range width_range;
-    GCodePreviewData::Range feedrate_range;
+    // reset current polyline
+    acc.polyline = Polyline();
+}
 
-    // to avoid to call the callback too often
-    unsigned int cancel_callback_threshold = (unsigned int)std::max((int)travel_moves->second.size() / 25, 1);
-    unsigned int cancel_callback_curr = 0;
+void GCodeAnalyzer::_update_gcode_preview_travel(const GCodeMove& move)
+{
+    TravelAccumulator &acc = m_travel;
+    GCodePreviewData::Travel::EType move_type = (move.delta_extruder < 0.0f) ? GCodePreviewData::Travel::Retract : ((move.delta_extruder > 0.0f) ? GCodePreviewData::Travel::Extrude : GCodePreviewData::Travel::Move);
+    GCodePreviewData::Travel::EDirection move_direction = ((move.start_position.x() != move.end_position.x()) || (move.start_position.y() != move.end_position.y())) ? GCodePreviewData::Travel::Generic : GCodePreviewData::Travel::Vertical;
 
-    // constructs the polylines while traversing the moves
-    for (const GCodeMove& move : travel_moves->second)
+    if ((acc.type != move_type) || (acc.direction != move_direction) || (acc.feedrate != move.data.feedrate) || (acc.position != move.start_position) || (acc.extruder_id != move.data.extruder_id))
     {
-        cancel_callback_curr = (cancel_callback_curr + 1) % cancel_callback_threshold;
-        if (cancel_callback_curr == 0)
-            cancel_callback();
-
-        GCodePreviewData::Travel::EType move_type = (move.delta_extruder < 0.0f) ? GCodePreviewData::Travel::Retract : ((move.delta_extruder > 0.0f) ? GCodePreviewData::Travel::Extrude : GCodePreviewData::Travel::Move);
-        GCodePreviewData::Travel::Polyline::EDirection move_direction = ((move.start_position.x() != move.end_position.x()) || (move.start_position.y() != move.end_position.y())) ? GCodePreviewData::Travel::Polyline::Generic : GCodePreviewData::Travel::Polyline::Vertical;
+        // store current polyline
+        _flush_gcode_preview_travel();
 
-        if ((type != move_type) || (direction != move_direction) || (feedrate != move.data.feedrate) || (position != move.start_position) || (extruder_id != move.data.extruder_id))
-        {
-            // store current polyline
-            polyline.remove_duplicate_points();
-            Helper::store_polyline(polyline, type, direction, feedrate, extruder_id, preview_data);
+        // add both vertices of the move
+        acc.polyline.append(Vec3crd(scale_(move.start_position.x()), scale_(move.start_position.y()), scale_(move.start_position.z())));
+        acc.polyline.append(Vec3crd(scale_(move.end_position.x()), scale_(move.end_position.y()), scale_(move.end_position.z())));
+    }
+    else
+        // append end vertex of the move to current polyline
+        acc.polyline.append(Vec3crd(scale_(move.end_position.x()), scale_(move.end_position.y()), scale_(move.end_position.z())));
 
-            // reset current polyline
-            polyline = Polyline3();
+    // update current values
+    acc.position = move.end_position;
+    acc.type = move_type;
+    acc.feedrate = move.data.feedrate;
+    acc.extruder_id = move.data.extruder_id;
+    acc.ranges.height.update_from(move.data.height);
+    acc.ranges.width.update_from(move.data.width);
+    acc.ranges.feedrate.update_from(move.data.feedrate);
+}
 
-            // add both vertices of the move
-            polyline.append(Vec3crd(scale_(move.start_position.x()), scale_(move.start_position.y()), scale_(move.start_position.z())));
-            polyline.append(Vec3crd(scale_(move.end_position.x()), scale_(move.end_position.y()), scale_(move.end_position.z())));
-        }
-        else
-            // append end vertex of the move to current polyline
-            polyline.append(Vec3crd(scale_(move.end_position.x()), scale_(move.end_position.y()), scale_(move.end_position.z())));
+void GCodeAnalyzer::_flush_gcode_preview_travel()
+{
+    TravelAccumulator &acc = m_travel;
+    acc.polyline.remove_duplicate_points();
 
-        // update current values
-        position = move.end_position;
-        type = move_type;
-        feedrate = move.data.feedrate;
-        extruder_id = move.data.extruder_id;
-        height_range.update_from(move.data.height);
-        width_range.update_from(move.data.width);
-        feedrate_range.update_from(move.data.feedrate);
+    // if the polyline is valid, store it into the layer at its lowest z
+    if (acc.polyline.is_valid())
+    {
+        coord_t z_scaled = std::numeric_limits<coord_t>::max();
+        for (const Vec3crd &point : acc.polyline.points)
+            z_scaled = std::min(z_scaled, point(2));
+        float z = float(unscale<double>(z_scaled));
+        if (acc.layer.z != z)
+            _add_gcode_preview_travel_layer(z);
+        acc.layer.add_polyline(acc.type, acc.direction, acc.feedrate, acc.extruder_id, acc.polyline.points);
     }
 
-    // store last polyline
-    polyline.remove_duplicate_points();
-    Helper::store_polyline(polyline, type, direction, feedrate, extruder_id, preview_data);
-
-    // updates preview ranges data
-    preview_data.ranges.height.update_from(height_range);
-    preview_data.ranges.width.update_from(width_range);
-    preview_data.ranges.feedrate.update_from(feedrate_range);
+    // reset current polyline
+    acc.polyline = Polyline3();
+}
 
-    // we need to sort the polylines by their min z as they can be shuffled in case of sequential prints
-    std::sort(preview_data.travel.polylines.begin(), preview_data.travel.polylines.end(),
-        [](const GCodePreviewData::Travel::Polyline& p1, const GCodePreviewData::Travel::Polyline& p2)->bool
-    { return unscale<double>(p1.polyline.bounding_box().min(2)) < unscale<double>(p2.polyline.bounding_box().min(2)); });
+void GCodeAnalyzer::_update_gcode_preview_retractions(const GCodeMove& move)
+{
+    Vec3crd position(scale_(move.start_position.x()), scale_(move.start_position.y()), scale_(move.start_position.z()));
+    GCodePreviewData::Retraction::Layer &layer = (move.type == GCodeMove::Retract) ? m_retractions : m_unretractions;
+    float z = float(unscale<double>(position(2)));
+    if (layer.z != z)
+        _add_gcode_preview_retraction_layer(layer, move.type == GCodeMove::Unretract, z);
+    layer.add_position(position, move.data.width, move.data.height);
 }
 
-void GCodeAnalyzer::_calc_gcode_preview_retractions(GCodePreviewData& preview_data, std::function<void()> cancel_callback)
+void GCodeAnalyzer::_add_gcode_preview_extrusion_layer(float z)
 {
-    TypeToMovesMap::iterator retraction_moves = m_moves_map.find(GCodeMove::Retract);
-    if (retraction_moves == m_moves_map.end())
+    GCodePreviewData::Extrusion::Layer layer(z);
+    std::swap(layer, m_extrusion.layer);
+    if (m_preview_data == nullptr || layer.empty())
         return;
 
-    // to avoid to call the callback too often
-    unsigned int cancel_callback_threshold = (unsigned int)std::max((int)retraction_moves->second.size() / 25, 1);
-    unsigned int cancel_callback_curr = 0;
-
-    for (const GCodeMove& move : retraction_moves->second)
     {
-        cancel_callback_curr = (cancel_callback_curr + 1) % cancel_callback_threshold;
-        if (cancel_callback_curr == 0)
-            cancel_callback();
-
-        // store position
-        Vec3crd position(scale_(move.start_position.x()), scale_(move.start_position.y()), scale_(move.start_position.z()));
-        preview_data.retraction.positions.emplace_back(position, move.data.width, move.data.height);
+        auto lock = m_preview_data->lock();
+        m_preview_data->add_extrusion_layer(std::move(layer));
+        _update_gcode_preview_ranges();
     }
 
-    // we need to sort the positions by their z as they can be shuffled in case of sequential prints
-    std::sort(preview_data.retraction.positions.begin(), preview_data.retraction.positions.end(),
-        [](const GCodePreviewData::Retraction::Position& p1, const GCodePreviewData::Retraction::Position& p2)->bool
-    { return unscale<double>(p1.position(2)) < unscale<double>(p2.position(2)); });
+    if (++ m_layers_added == m_layers_added_next_callback)
+    {
+        m_layers_added_next_callback *= 2;
+        if (m_layers_added_callback)
+            m_layers_added_callback();
+    }
 }
 
-void GCodeAnalyzer::_calc_gcode_preview_unretractions(GCodePreviewData& preview_data, std::function<void()> cancel_callback)
+void GCodeAnalyzer::_add_gcode_preview_travel_layer(float z)
 {
-    TypeToMovesMap::iterator unretraction_moves = m_moves_map.find(GCodeMove::Unretract);
-    if (unretraction_moves == m_moves_map.end())
+    GCodePreviewData::Travel::Layer layer(z);
+    std::swap(layer, m_travel.layer);
+    if (m_preview_data == nullptr || layer.empty())
         return;
 
-    // to avoid to call the callback too often
-    unsigned int cancel_callback_threshold = (unsigned int)std::max((int)unretraction_moves->second.size() / 25, 1);
-    unsigned int cancel_callback_curr = 0;
+    auto lock = m_preview_data->lock();
+    m_preview_data->add_travel_layer(std::move(layer));
+    _update_gcode_preview_ranges();
+}
 
-    for (const GCodeMove& move : unretraction_moves->second)
-    {
-        cancel_callback_curr = (cancel_callback_curr + 1) % cancel_callback_threshold;
-        if (cancel_callback_curr == 0)
-            cancel_callback();
+void GCodeAnalyzer::_add_gcode_preview_retraction_layer(GCodePreviewData::Retraction::Layer &pending, bool unretraction, float z)
+{
+    GCodePreviewData::Retraction::Layer layer(z);
+    std::swap(layer, pending);
+    if (m_preview_data == nullptr || layer.empty())
+        return;
 
-        // store position
-        Vec3crd position(scale_(move.start_position.x()), scale_(move.start_position.y()), scale_(move.start_position.z()));
-        preview_data.unretraction.positions.emplace_back(position, move.data.width, move.data.height);
-    }
+    auto lock = m_preview_data->lock();
+    if (unretraction)
+        m_preview_data->add_unretraction_layer(std::move(layer));
+    else
+        m_preview_data->add_retraction_layer(std::move(layer));
+}
 
-    // we need to sort the positions by their z as they can be shuffled in case of sequential prints
-    std::sort(preview_data.unretraction.positions.begin(), preview_data.unretraction.positions.end(),
-        [](const GCodePreviewData::Retraction::Position& p1, const GCodePreviewData::Retraction::Position& p2)->bool
-    { return unscale<double>(p1.position(2)) < unscale<double>(p2.position(2)); });
+void GCodeAnalyzer::_update_gcode_preview_ranges()
+{
+    GCodePreviewData::Ranges &ranges = m_preview_data->ranges;
+    ranges.height.update_from(m_extrusion.ranges.height);
+    ranges.width.update_from(m_extrusion.ranges.width);
+    ranges.feedrate.update_from(m_extrusion.ranges.feedrate);
+    ranges.volumetric_rate.update_from(m_extrusion.ranges.volumetric_rate);
+    ranges.height.update_from(m_travel.ranges.height);
+    ranges.width.update_from(m_travel.ranges.width);
+    ranges.feedrate.update_from(m_travel.ranges.feedrate);
 }
 
 // Return an estimate of the memory consumed by the time estimator.
 size_t GCodeAnalyzer::memory_used() const
 {
     size_t out = sizeof(*this);
-    for (const std::pair<GCodeMove::EType, GCodeMovesList> &kvp : m_moves_map)
-        out += sizeof(kvp) + SLIC3R_STDVEC_MEMSIZE(kvp.second, GCodeMove);
+    out += SLIC3R_STDVEC_MEMSIZE(m_extrusion.polyline.points, Point) + m_extrusion.layer.memory_used() - sizeof(m_extrusion.layer);
+    out += SLIC3R_STDVEC_MEMSIZE(m_travel.polyline.points, Vec3crd) + m_travel.layer.memory_used() - sizeof(m_travel.layer);
+    out += m_retractions.memory_used() - sizeof(m_retractions) + m_unretractions.memory_used() - sizeof(m_unretractions);
     out += m_process_output.size();
     return out;
 }
@@ -1,17 +1,20 @@
 #ifndef slic3r_GCode_Analyzer_hpp_
 #define slic3r_GCode_Analyzer_hpp_
 
+#include <float.h>
+#include <functional>
+#include <limits>
+
 #include "../libslic3r.h"
 #include "../PrintConfig.hpp"
 #include "../ExtrusionEntity.hpp"
 
 #include "../Point.hpp"
 #include "../GCodeReader.hpp"
+#include "PreviewData.hpp"
 
 namespace Slic3r {
 
-class GCodePreviewData;
-
 class GCodeAnalyzer
 {
 public:
@@ -84,8 +87,6 @@ public:
         GCodeMove(EType type, const Metadata& data, const Vec3d& start_position, const Vec3d& end_position, float delta_extruder);
     };
 
-    typedef std::vector<GCodeMove> GCodeMovesList;
-    typedef std::map<GCodeMove::EType, GCodeMovesList> TypeToMovesMap;
     typedef std::map<unsigned int, Vec2d> ExtruderOffsetsMap;
 
 private:
@@ -101,12 +102,51 @@ private:
         unsigned int cur_cp_color_id = 0;
     };
 
+    // The extrusion polyline being accumulated from the consecutive extrusion moves sharing the same metadata.
+    struct ExtrusionAccumulator
+    {
+        Metadata data;
+        float z = FLT_MAX;
+        Polyline polyline;
+        Vec3d position = Vec3d(FLT_MAX, FLT_MAX, FLT_MAX);
+        float volumetric_rate = FLT_MAX;
+        // The paths at the z of the last path, not added to the preview data yet.
+        GCodePreviewData::Extrusion::Layer layer = GCodePreviewData::Extrusion::Layer(FLT_MAX);
+        GCodePreviewData::Ranges ranges;
+    };
+
+    // The travel polyline being accumulated from the consecutive travel moves.
+    struct TravelAccumulator
+    {
+        Polyline3 polyline;
+        Vec3d position = Vec3d(FLT_MAX, FLT_MAX, FLT_MAX);
+        GCodePreviewData::Travel::EType type = GCodePreviewData::Travel::Num_Types;
+        GCodePreviewData::Travel::EDirection direction = GCodePreviewData::Travel::Num_Directions;
+        float feedrate = FLT_MAX;
+        unsigned int extruder_id = -1;
+        // The polylines at the z of the last polyline, not added to the preview data yet.
+        GCodePreviewData::Travel::Layer layer = GCodePreviewData::Travel::Layer(FLT_MAX);
+        GCodePreviewData::Ranges ranges;
+    };
+
 private:
     State m_state;
     GCodeReader m_parser;
-    TypeToMovesMap m_moves_map;
     ExtruderOffsetsMap m_extruder_offsets;
 
+    // The preview data is filled while the moves are being processed, so that neither the moves nor the whole preview
+    // need to be stored by the analyzer: The moves at a single z are accumulated into a layer, which is added to
+    // m_preview_data under its lock once the moves continue at another z.
+    GCodePreviewData *m_preview_data = nullptr;
+    // Called after the first, second, fourth, eighth... extrusion layer was added to m_preview_data.
+    std::function<void()> m_layers_added_callback;
+    size_t m_layers_added = 0;
+    size_t m_layers_added_next_callback = 1;
+    ExtrusionAccumulator m_extrusion;
+    TravelAccumulator m_travel;
+    GCodePreviewData::Retraction::Layer m_retractions = GCodePreviewData::Retraction::Layer(FLT_MAX);
+    GCodePreviewData::Retraction::Layer m_unretractions = GCodePreviewData::Retraction::Layer(FLT_MAX);
+
     // The output of process_layer()
     std::string m_process_output;
 
@@ -115,15 +155,23 @@ public:
 
     void set_extruder_offsets(const ExtruderOffsetsMap& extruder_offsets);
 
-    // Reinitialize the analyzer
+    // Reinitialize the analyzer, keeps the preview data to be filled.
     void reset();
 
+    // Resets the preview data and fills it with the moves processed from now on. The layers are visible
+    // to GCodePreviewData::lock() holders while the G-code is processed, layers_added_callback is called
+    // from the processing thread after the first, second, fourth... layer was added.
+    void set_preview_data(GCodePreviewData *preview_data, std::function<void()> layers_added_callback = std::function<void()>());
+
     // Adds the gcode contained in the given string to the analysis and returns it after removing the workcodes
     const std::string& process_gcode(const std::string& gcode);
 
-    // Calculates all data needed for gcode visualization
-    // throws CanceledException through print->throw_if_canceled() (sent by the caller as callback).
-    void calc_gcode_preview_data(GCodePreviewData& preview_data, std::function<void()> cancel_callback = std::function<void()>());
+    // Adds the given gcode line, already parsed by the caller, to the analysis.
+    // Returns false if the line is a workcode, which has to be removed from the output gcode.
+    bool process_gcode_line(const GCodeReader::GCodeLine& line);
+
+    // Adds the moves not added to the preview data yet, to be called after the last G-code line was processed.
+    void flush_gcode_preview_data();
 
     // Return an estimate of the memory consumed by the time estimator.
     size_t memory_used() const;
@@ -232,17 +280,28 @@ private:
     // Returns current xyz position (from m_state.position[])
     Vec3d _get_end_position() const;
 
-    // Adds a new move with the given data
+    // Adds a new move with the given data to the preview data
     void _store_move(GCodeMove::EType type);
 
     // Checks if the given int is a valid extrusion role (contained into enum ExtrusionRole)
     bool _is_valid_extrusion_role(int value) const;
 
-    // All the following methods throw CanceledException through print->throw_if_canceled() (sent by the caller as callback).
-    void _calc_gcode_preview_extrusion_layers(GCodePreviewData& preview_data, std::function<void()> cancel_callback);
-    void _calc_gcode_preview_travel(GCodePreviewData& preview_data, std::function<void()> cancel_callback);
-    void _calc_gcode_preview_retractions(GCodePreviewData& preview_data, std::function<void()> cancel_callback);
-    void _calc_gcode_preview_unretractions(GCodePreviewData& preview_data, std::function<void()> cancel_callback);
+    // Accumulate the given move into the current extrusion or travel polyline,
+    // storing the current polyline into the current layer first if the move does not continue it.
+    void _update_gcode_preview_extrusion_layers(const GCodeMove& move);
+    void _update_gcode_preview_travel(const GCodeMove& move);
+    void _update_gcode_preview_retractions(const GCodeMove& move);
+
+    // Store the polylines being accumulated into the current layers.
+    void _flush_gcode_preview_extrusion_layers();
+    void _flush_gcode_preview_travel();
+
+    // Add the current layers to m_preview_data and start new ones at z in unscaled mm.
+    void _add_gcode_preview_extrusion_layer(float z);
+    void _add_gcode_preview_travel_layer(float z);
+    void _add_gcode_preview_retraction_layer(GCodePreviewData::Retraction::Layer &layer, bool unretraction, float z);
+    // To be called with m_preview_data locked.
+    void _update_gcode_preview_ranges();
 };
 
 } // namespace Slic3r
@@ -17,6 +17,9 @@ namespace Slic3r {
 
 CoolingBuffer::CoolingBuffer(GCode &gcodegen) : m_gcodegen(gcodegen), m_current_extruder(0)
 {
+    m_config.apply(gcodegen.config(), true);
+    m_writer.apply_print_config(m_config);
+    m_writer.set_extruders(gcodegen.writer().extruder_ids());
     this->reset();
 }
 
@@ -27,7 +30,7 @@ void CoolingBuffer::reset()
     m_current_pos[0] = float(pos(0));
     m_current_pos[1] = float(pos(1));
     m_current_pos[2] = float(pos(2));
-    m_current_pos[4] = float(m_gcodegen.config().travel_speed.value);
+    m_current_pos[4] = float(m_config.travel_speed.value);
 }
 
 struct CoolingLine
@@ -289,8 +292,8 @@ std::string CoolingBuffer::process_layer(const std::string &gcode, size_t layer_
 // Return the list of parsed lines, bucketed by an extruder.
 std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::string &gcode, std::vector<float> &current_pos) const
 {
-    const FullPrintConfig       &config        = m_gcodegen.config();
-    const std::vector<Extruder> &extruders     = m_gcodegen.writer().extruders();
+    const PrintConfig           &config        = m_config;
+    const std::vector<Extruder> &extruders     = m_writer.extruders();
     unsigned int                 num_extruders = 0;
     for (const Extruder &ex : extruders)
         num_extruders = std::max(ex.id() + 1, num_extruders);
@@ -307,7 +310,7 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
         map_extruder_to_per_extruder_adjustment[extruder_id] = i;
     }
 
-    const std::string toolchange_prefix = m_gcodegen.writer().toolchange_prefix();
+    const std::string toolchange_prefix = m_writer.toolchange_prefix();
     unsigned int      current_extruder  = m_current_extruder;
     PerExtruderAdjustments *adjustment  = &per_extruder_adjustments[map_extruder_to_per_extruder_adjustment[current_extruder]];
     const char       *line_start = gcode.c_str();
@@ -668,7 +671,7 @@ std::string CoolingBuffer::apply_layer_cooldown(
     bool bridge_fan_control = false;
     int  bridge_fan_speed   = 0;
     auto change_extruder_set_fan = [ this, layer_id, layer_time, &new_gcode, &fan_speed, &bridge_fan_control, &bridge_fan_speed ]() {
-        const FullPrintConfig &config = m_gcodegen.config();
+        const PrintConfig &config = m_config;
 #define EXTRUDER_CONFIG(OPT) config.OPT.get_at(m_current_extruder)
         int min_fan_speed = EXTRUDER_CONFIG(min_fan_speed);
         int fan_speed_new = EXTRUDER_CONFIG(fan_always_on) ? min_fan_speed : 0;
@@ -697,13 +700,13 @@ std::string CoolingBuffer::apply_layer_cooldown(
         }
         if (fan_speed_new != fan_speed) {
             fan_speed = fan_speed_new;
-            new_gcode += m_gcodegen.writer().set_fan(fan_speed);
+            new_gcode += m_writer.set_fan(fan_speed);
         }
     };
 
     const char         *pos               = gcode.c_str();
     int                 current_feedrate  = 0;
-    const std::string   toolchange_prefix = m_gcodegen.writer().toolchange_prefix();
+    const std::string   toolchange_prefix = m_writer.toolchange_prefix();
     change_extruder_set_fan();
     for (const CoolingLine *line : lines) {
         const char *line_start  = gcode.c_str() + line->line_start;
@@ -719,10 +722,10 @@ std::string CoolingBuffer::apply_layer_cooldown(
             new_gcode.append(line_start, line_end - line_start);
         } else if (line->type & CoolingLine::TYPE_BRIDGE_FAN_START) {
             if (bridge_fan_control)
-                new_gcode += m_gcodegen.writer().set_fan(bridge_fan_speed, true);
+                new_gcode += m_writer.set_fan(bridge_fan_speed, true);
         } else if (line->type & CoolingLine::TYPE_BRIDGE_FAN_END) {
             if (bridge_fan_control)
-                new_gcode += m_gcodegen.writer().set_fan(fan_speed, true);
+                new_gcode += m_writer.set_fan(fan_speed, true);
         } else if (line->type & CoolingLine::TYPE_EXTRUDE_END) {
             // Just remove this comment.
         } else if (line->type & (CoolingLine::TYPE_ADJUSTABLE | CoolingLine::TYPE_EXTERNAL_PERIMETER | CoolingLine::TYPE_WIPE | CoolingLine::TYPE_HAS_F)) {
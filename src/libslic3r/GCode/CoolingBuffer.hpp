@@ -1,7 +1,9 @@
 #ifndef slic3r_CoolingBuffer_hpp_
 #define slic3r_CoolingBuffer_hpp_
 
-#include "libslic3r.h"
+#include "../libslic3r.h"
+#include "../GCodeWriter.hpp"
+#include "../PrintConfig.hpp"
 #include <map>
 #include <string>
 
@@ -20,13 +22,20 @@ struct PerExtruderAdjustments;
 // For example, some materials may not like to print too slowly, while with some materials 
 // we may slow down significantly.
 //
+// The cooling buffer takes a copy of the print config and the extruders of the G-code generator when constructed
+// and it emits the fan commands with its own GCodeWriter, so that it does not touch the G-code generator
+// while post-processing a layer, which runs concurrently with the G-code generation of the next layer.
+//
 class CoolingBuffer {
 public:
     CoolingBuffer(GCode &gcodegen);
+    // Reset the current position from the G-code generator. To be called while no layer is being processed.
     void        reset();
     void        set_current_extruder(unsigned int extruder_id) { m_current_extruder = extruder_id; }
     std::string process_layer(const std::string &gcode, size_t layer_id);
     GCode* 	    gcodegen() { return &m_gcodegen; }
+    // The fan is controlled by the cooling buffer, this writer keeps the last fan speed set.
+    GCodeWriter& writer() { return m_writer; }
 
 private:
 	CoolingBuffer& operator=(const CoolingBuffer&) = delete;
@@ -37,6 +46,8 @@ private:
     std::string apply_layer_cooldown(const std::string &gcode, size_t layer_id, float layer_time, std::vector<PerExtruderAdjustments> &per_extruder_adjustments);
 
     GCode&              m_gcodegen;
+    PrintConfig         m_config;
+    GCodeWriter         m_writer;
     std::string         m_gcode;
     // Internal data.
     // X,Y,Z,E,F
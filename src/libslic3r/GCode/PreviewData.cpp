@@ -39,19 +39,176 @@ std::vector<unsigned char> GCodePreviewData::Color::as_bytes() const
     return ret;
 }
 
-GCodePreviewData::Extrusion::Layer::Layer(float z, const ExtrusionPaths& paths)
-    : z(z)
-    , paths(paths)
+// Insert a layer into the layers sorted by z, merge it with a layer at the same z.
+// The layers are added in the order of the G-code, which goes back in z for sequential prints only.
+// The layer is copied into columns allocated to its size, as the columns of the layer being filled grow by doubling.
+template<typename LayerType>
+static void add_layer(std::vector<LayerType> &layers, LayerType &&layer)
 {
+    if (layer.empty())
+        return;
+    auto it = std::lower_bound(layers.begin(), layers.end(), layer.z, [](const LayerType &l, decltype(layer.z) z) { return l.z < z; });
+    if (it == layers.end() || it->z != layer.z)
+        it = layers.insert(it, LayerType(layer.z));
+    it->append(layer);
+}
+
+template<typename LayerType>
+static std::pair<typename std::vector<LayerType>::const_iterator, typename std::vector<LayerType>::const_iterator>
+    layers_in_z_range(const std::vector<LayerType> &layers, float z_min, float z_max)
+{
+    auto begin = std::lower_bound(layers.begin(), layers.end(), z_min, [](const LayerType &l, float z) { return l.z < z; });
+    auto end   = std::upper_bound(begin, layers.end(), z_max, [](float z, const LayerType &l) { return z < l.z; });
+    return std::make_pair(begin, end);
+}
+
+template<typename T>
+static void append_column(std::vector<T> &dst, const std::vector<T> &src)
+{
+    dst.reserve(dst.size() + src.size());
+    dst.insert(dst.end(), src.begin(), src.end());
+}
+
+// Append the first vertices of the other layer, shifted behind the vertices of this layer.
+static void append_first_vertices(std::vector<uint32_t> &dst, const std::vector<uint32_t> &src, size_t num_vertices)
+{
+    dst.reserve(dst.size() + src.size());
+    for (uint32_t idx : src)
+        dst.emplace_back(uint32_t(idx + num_vertices));
+}
+
+Polyline GCodePreviewData::Extrusion::Layer::polyline(size_t path_id) const
+{
+    size_t begin = first_vertices[path_id];
+    size_t end   = (path_id + 1 < first_vertices.size()) ? first_vertices[path_id + 1] : xs.size();
+    Polyline out;
+    out.points.reserve(end - begin);
+    for (size_t i = begin; i < end; ++ i)
+        out.points.emplace_back(xs[i], ys[i]);
+    return out;
+}
+
+void GCodePreviewData::Extrusion::Layer::add_path(ExtrusionRole role, float width, float height, float feedrate, float mm3_per_mm, unsigned int extruder_id, unsigned int cp_color_id, const Points &points)
+{
+    roles.emplace_back((unsigned char)role);
+    widths.emplace_back(width);
+    heights.emplace_back(height);
+    feedrates.emplace_back(feedrate);
+    this->mm3_per_mm.emplace_back(mm3_per_mm);
+    extruder_ids.emplace_back(extruder_id);
+    cp_color_ids.emplace_back(cp_color_id);
+    first_vertices.emplace_back(uint32_t(xs.size()));
+    for (const Point &pt : points) {
+        xs.emplace_back(pt(0));
+        ys.emplace_back(pt(1));
+    }
 }
 
-GCodePreviewData::Travel::Polyline::Polyline(EType type, EDirection direction, float feedrate, unsigned int extruder_id, const Polyline3& polyline)
-    : type(type)
-    , direction(direction)
-    , feedrate(feedrate)
-    , extruder_id(extruder_id)
-    , polyline(polyline)
+void GCodePreviewData::Extrusion::Layer::append(const Layer &other)
 {
+    append_column(roles, other.roles);
+    append_column(widths, other.widths);
+    append_column(heights, other.heights);
+    append_column(feedrates, other.feedrates);
+    append_column(mm3_per_mm, other.mm3_per_mm);
+    append_column(extruder_ids, other.extruder_ids);
+    append_column(cp_color_ids, other.cp_color_ids);
+    append_first_vertices(first_vertices, other.first_vertices, xs.size());
+    append_column(xs, other.xs);
+    append_column(ys, other.ys);
+}
+
+size_t GCodePreviewData::Extrusion::Layer::memory_used() const
+{
+    return sizeof(*this) +
+        SLIC3R_STDVEC_MEMSIZE(roles, unsigned char) +
+        SLIC3R_STDVEC_MEMSIZE(widths, float) +
+        SLIC3R_STDVEC_MEMSIZE(heights, float) +
+        SLIC3R_STDVEC_MEMSIZE(feedrates, float) +
+        SLIC3R_STDVEC_MEMSIZE(mm3_per_mm, float) +
+        SLIC3R_STDVEC_MEMSIZE(extruder_ids, unsigned int) +
+        SLIC3R_STDVEC_MEMSIZE(cp_color_ids, unsigned int) +
+        SLIC3R_STDVEC_MEMSIZE(first_vertices, uint32_t) +
+        SLIC3R_STDVEC_MEMSIZE(xs, coord_t) +
+        SLIC3R_STDVEC_MEMSIZE(ys, coord_t);
+}
+
+Polyline3 GCodePreviewData::Travel::Layer::polyline(size_t polyline_id) const
+{
+    size_t begin = first_vertices[polyline_id];
+    size_t end   = (polyline_id + 1 < first_vertices.size()) ? first_vertices[polyline_id + 1] : xs.size();
+    Polyline3 out;
+    out.points.reserve(end - begin);
+    for (size_t i = begin; i < end; ++ i)
+        out.points.emplace_back(xs[i], ys[i], zs[i]);
+    return out;
+}
+
+void GCodePreviewData::Travel::Layer::add_polyline(EType type, EDirection direction, float feedrate, unsigned int extruder_id, const Points3 &points)
+{
+    types.emplace_back((unsigned char)type);
+    directions.emplace_back((unsigned char)direction);
+    feedrates.emplace_back(feedrate);
+    extruder_ids.emplace_back(extruder_id);
+    first_vertices.emplace_back(uint32_t(xs.size()));
+    for (const Vec3crd &pt : points) {
+        xs.emplace_back(pt(0));
+        ys.emplace_back(pt(1));
+        zs.emplace_back(pt(2));
+    }
+}
+
+void GCodePreviewData::Travel::Layer::append(const Layer &other)
+{
+    append_column(types, other.types);
+    append_column(directions, other.directions);
+    append_column(feedrates, other.feedrates);
+    append_column(extruder_ids, other.extruder_ids);
+    append_first_vertices(first_vertices, other.first_vertices, xs.size());
+    append_column(xs, other.xs);
+    append_column(ys, other.ys);
+    append_column(zs, other.zs);
+}
+
+size_t GCodePreviewData::Travel::Layer::memory_used() const
+{
+    return sizeof(*this) +
+        SLIC3R_STDVEC_MEMSIZE(types, unsigned char) +
+        SLIC3R_STDVEC_MEMSIZE(directions, unsigned char) +
+        SLIC3R_STDVEC_MEMSIZE(feedrates, float) +
+        SLIC3R_STDVEC_MEMSIZE(extruder_ids, unsigned int) +
+        SLIC3R_STDVEC_MEMSIZE(first_vertices, uint32_t) +
+        SLIC3R_STDVEC_MEMSIZE(xs, coord_t) +
+        SLIC3R_STDVEC_MEMSIZE(ys, coord_t) +
+        SLIC3R_STDVEC_MEMSIZE(zs, coord_t);
+}
+
+void GCodePreviewData::Retraction::Layer::add_position(const Vec3crd &position, float width, float height)
+{
+    widths.emplace_back(width);
+    heights.emplace_back(height);
+    xs.emplace_back(position(0));
+    ys.emplace_back(position(1));
+    zs.emplace_back(position(2));
+}
+
+void GCodePreviewData::Retraction::Layer::append(const Layer &other)
+{
+    append_column(widths, other.widths);
+    append_column(heights, other.heights);
+    append_column(xs, other.xs);
+    append_column(ys, other.ys);
+    append_column(zs, other.zs);
+}
+
+size_t GCodePreviewData::Retraction::Layer::memory_used() const
+{
+    return sizeof(*this) +
+        SLIC3R_STDVEC_MEMSIZE(widths, float) +
+        SLIC3R_STDVEC_MEMSIZE(heights, float) +
+        SLIC3R_STDVEC_MEMSIZE(xs, coord_t) +
+        SLIC3R_STDVEC_MEMSIZE(ys, coord_t) +
+        SLIC3R_STDVEC_MEMSIZE(zs, coord_t);
 }
 
 const GCodePreviewData::Color GCodePreviewData::Range::Default_Colors[Colors_Count] =
@@ -206,15 +363,18 @@ bool GCodePreviewData::Extrusion::is_role_flag_set(unsigned int flags, Extrusion
     return GCodeAnalyzer::is_valid_extrusion_role(role) && (flags & (1 << (role - erPerimeter))) != 0;
 }
 
+std::pair<GCodePreviewData::Extrusion::LayersList::const_iterator, GCodePreviewData::Extrusion::LayersList::const_iterator>
+    GCodePreviewData::Extrusion::layers_in_range(float z_min, float z_max) const
+{
+    return layers_in_z_range(this->layers, z_min, z_max);
+}
+
 size_t GCodePreviewData::Extrusion::memory_used() const
 {
     size_t out = sizeof(*this);
-    out += SLIC3R_STDVEC_MEMSIZE(this->layers, Layer);
-    for (const Layer &layer : this->layers) {
-        out += SLIC3R_STDVEC_MEMSIZE(layer.paths, ExtrusionPath);
-        for (const ExtrusionPath &path : layer.paths)
-			out += SLIC3R_STDVEC_MEMSIZE(path.polyline.points, Point);
-    }
+    out += SLIC3R_STDVEC_MEMSIZE(this->layers, Layer) - this->layers.size() * sizeof(Layer);
+    for (const Layer &layer : this->layers)
+        out += layer.memory_used();
 	return out;
 }
 
@@ -237,33 +397,42 @@ void GCodePreviewData::Travel::set_default()
     is_visible = false;
 }
 
+std::pair<GCodePreviewData::Travel::LayersList::const_iterator, GCodePreviewData::Travel::LayersList::const_iterator>
+    GCodePreviewData::Travel::layers_in_range(float z_min, float z_max) const
+{
+    return layers_in_z_range(this->layers, z_min, z_max);
+}
+
 size_t GCodePreviewData::Travel::memory_used() const
 {
     size_t out = sizeof(*this);
-    out += SLIC3R_STDVEC_MEMSIZE(this->polylines, Polyline);
-	for (const Polyline &polyline : this->polylines)
-		out += SLIC3R_STDVEC_MEMSIZE(polyline.polyline.points, Vec3crd);
+    out += SLIC3R_STDVEC_MEMSIZE(this->layers, Layer) - this->layers.size() * sizeof(Layer);
+    for (const Layer &layer : this->layers)
+        out += layer.memory_used();
     return out;
 }
 
 const GCodePreviewData::Color GCodePreviewData::Retraction::Default_Color = GCodePreviewData::Color(1.0f, 1.0f, 1.0f, 1.0f);
 
-GCodePreviewData::Retraction::Position::Position(const Vec3crd& position, float width, float height)
-    : position(position)
-    , width(width)
-    , height(height)
-{
-}
-
 void GCodePreviewData::Retraction::set_default()
 {
     color = Default_Color;
     is_visible = false;
 }
 
+std::pair<GCodePreviewData::Retraction::LayersList::const_iterator, GCodePreviewData::Retraction::LayersList::const_iterator>
+    GCodePreviewData::Retraction::layers_in_range(float z_min, float z_max) const
+{
+    return layers_in_z_range(this->layers, z_min, z_max);
+}
+
 size_t GCodePreviewData::Retraction::memory_used() const
 {
-	return sizeof(*this) + SLIC3R_STDVEC_MEMSIZE(this->positions, Position);
+    size_t out = sizeof(*this);
+    out += SLIC3R_STDVEC_MEMSIZE(this->layers, Layer) - this->layers.size() * sizeof(Layer);
+    for (const Layer &layer : this->layers)
+        out += layer.memory_used();
+    return out;
 }
 
 void GCodePreviewData::Shell::set_default()
@@ -292,19 +461,40 @@ void GCodePreviewData::set_default()
 
 void GCodePreviewData::reset()
 {
+    std::unique_lock<std::mutex> l = this->lock();
     ranges.width.reset();
     ranges.height.reset();
     ranges.feedrate.reset();
     ranges.volumetric_rate.reset();
     extrusion.layers.clear();
-    travel.polylines.clear();
-    retraction.positions.clear();
-    unretraction.positions.clear();
+    travel.layers.clear();
+    retraction.layers.clear();
+    unretraction.layers.clear();
 }
 
 bool GCodePreviewData::empty() const
 {
-    return extrusion.layers.empty() && travel.polylines.empty() && retraction.positions.empty() && unretraction.positions.empty();
+    return extrusion.layers.empty() && travel.layers.empty() && retraction.layers.empty() && unretraction.layers.empty();
+}
+
+void GCodePreviewData::add_extrusion_layer(Extrusion::Layer &&layer)
+{
+    add_layer(extrusion.layers, std::move(layer));
+}
+
+void GCodePreviewData::add_travel_layer(Travel::Layer &&layer)
+{
+    add_layer(travel.layers, std::move(layer));
+}
+
+void GCodePreviewData::add_retraction_layer(Retraction::Layer &&layer)
+{
+    add_layer(retraction.layers, std::move(layer));
+}
+
+void GCodePreviewData::add_unretraction_layer(Retraction::Layer &&layer)
+{
+    add_layer(unretraction.layers, std::move(layer));
 }
 
 GCodePreviewData::Color GCodePreviewData::get_extrusion_role_color(ExtrusionRole role) const
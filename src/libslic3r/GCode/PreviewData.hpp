@@ -5,6 +5,8 @@
 #include "../ExtrusionEntity.hpp"
 #include "../Point.hpp"
 
+#include <mutex>
+
 namespace Slic3r {
 
 class GCodePreviewData
@@ -85,12 +87,35 @@ public:
         static const std::string Default_Extrusion_Role_Names[Num_Extrusion_Roles];
         static const EViewType Default_View_Type;
 
+        // The extrusion paths at a single print z, stored column wise: each attribute of the paths in its own array,
+        // the vertices of all the paths as scaled int32 coordinates in a pair of arrays.
         struct Layer
         {
+            // Print z in unscaled mm, like the z of the travel and the retraction layers.
             float z;
-            ExtrusionPaths paths;
-
-            Layer(float z, const ExtrusionPaths& paths);
+            std::vector<unsigned char> roles;
+            std::vector<float> widths;
+            std::vector<float> heights;
+            std::vector<float> feedrates;
+            std::vector<float> mm3_per_mm;
+            std::vector<unsigned int> extruder_ids;
+            std::vector<unsigned int> cp_color_ids;
+            // Index of the first vertex of a path into xs and ys, the vertices of a path end at the first vertex of the next one.
+            std::vector<uint32_t> first_vertices;
+            std::vector<coord_t> xs;
+            std::vector<coord_t> ys;
+
+            explicit Layer(float z) : z(z) {}
+
+            size_t paths_count() const { return roles.size(); }
+            bool empty() const { return roles.empty(); }
+            ExtrusionRole role(size_t path_id) const { return ExtrusionRole(roles[path_id]); }
+            Polyline polyline(size_t path_id) const;
+
+            void add_path(ExtrusionRole role, float width, float height, float feedrate, float mm3_per_mm, unsigned int extruder_id, unsigned int cp_color_id, const Points &points);
+            // Append the paths of another layer at the same z.
+            void append(const Layer &other);
+            size_t memory_used() const;
         };
 
         typedef std::vector<Layer> LayersList;
@@ -98,11 +123,14 @@ public:
         EViewType view_type;
         Color role_colors[Num_Extrusion_Roles];
         std::string role_names[Num_Extrusion_Roles];
+        // Sorted by z.
         LayersList layers;
         unsigned int role_flags;
 
         void set_default();
         bool is_role_flag_set(ExtrusionRole role) const;
+        // The layers with z_min <= z <= z_max, in unscaled mm.
+        std::pair<LayersList::const_iterator, LayersList::const_iterator> layers_in_range(float z_min, float z_max) const;
 
         // Return an estimate of the memory consumed by the time estimator.
         size_t memory_used() const;
@@ -124,27 +152,45 @@ public:
         static const float Default_Height;
         static const Color Default_Type_Colors[Num_Types];
 
-        struct Polyline
+        enum EDirection : unsigned char
+        {
+            Vertical,
+            Generic,
+            Num_Directions
+        };
+
+        // The travel polylines with their lowest point at a single z, stored column wise
+        // like the extrusion layers, the vertices as scaled int32 coordinates.
+        struct Layer
         {
-            enum EDirection
-            {
-                Vertical,
-                Generic,
-                Num_Directions
-            };
-
-            EType type;
-            EDirection direction;
-            float feedrate;
-            unsigned int extruder_id;
-            Polyline3 polyline;
-
-            Polyline(EType type, EDirection direction, float feedrate, unsigned int extruder_id, const Polyline3& polyline);
+            // The lowest z of the polylines in unscaled mm, unscale() of the scaled zs.
+            float z;
+            std::vector<unsigned char> types;
+            std::vector<unsigned char> directions;
+            std::vector<float> feedrates;
+            std::vector<unsigned int> extruder_ids;
+            // Index of the first vertex of a polyline into xs, ys and zs.
+            std::vector<uint32_t> first_vertices;
+            std::vector<coord_t> xs;
+            std::vector<coord_t> ys;
+            std::vector<coord_t> zs;
+
+            explicit Layer(float z) : z(z) {}
+
+            size_t polylines_count() const { return types.size(); }
+            bool empty() const { return types.empty(); }
+            EType type(size_t polyline_id) const { return EType(types[polyline_id]); }
+            Polyline3 polyline(size_t polyline_id) const;
+
+            void add_polyline(EType type, EDirection direction, float feedrate, unsigned int extruder_id, const Points3 &points);
+            void append(const Layer &other);
+            size_t memory_used() const;
         };
 
-        typedef std::vector<Polyline> PolylinesList;
+        typedef std::vector<Layer> LayersList;
 
-        PolylinesList polylines;
+        // Sorted by z.
+        LayersList layers;
         float width;
         float height;
         Color type_colors[Num_Types];
@@ -152,6 +198,8 @@ public:
         size_t color_print_idx;
 
         void set_default();
+        // The layers with z_min <= z <= z_max, in unscaled mm.
+        std::pair<LayersList::const_iterator, LayersList::const_iterator> layers_in_range(float z_min, float z_max) const;
 
         // Return an estimate of the memory consumed by the time estimator.
         size_t memory_used() const;
@@ -161,22 +209,39 @@ public:
     {
         static const Color Default_Color;
 
-        struct Position
+        // The retraction positions at a single z, stored column wise, the positions as scaled int32 coordinates.
+        struct Layer
         {
-            Vec3crd position;
-            float width;
-            float height;
-
-            Position(const Vec3crd& position, float width, float height);
+            // The z of the positions in unscaled mm, unscale() of the scaled zs.
+            float z;
+            std::vector<float> widths;
+            std::vector<float> heights;
+            std::vector<coord_t> xs;
+            std::vector<coord_t> ys;
+            std::vector<coord_t> zs;
+
+            explicit Layer(float z) : z(z) {}
+
+            size_t positions_count() const { return xs.size(); }
+            bool empty() const { return xs.empty(); }
+            // Scaled position.
+            Vec3crd position(size_t position_id) const { return Vec3crd(xs[position_id], ys[position_id], zs[position_id]); }
+
+            void add_position(const Vec3crd &position, float width, float height);
+            void append(const Layer &other);
+            size_t memory_used() const;
         };
 
-        typedef std::vector<Position> PositionsList;
+        typedef std::vector<Layer> LayersList;
 
-        PositionsList positions;
+        // Sorted by z.
+        LayersList layers;
         Color color;
         bool is_visible;
 
         void set_default();
+        // The layers with z_min <= z <= z_max, in unscaled mm.
+        std::pair<LayersList::const_iterator, LayersList::const_iterator> layers_in_range(float z_min, float z_max) const;
 
         // Return an estimate of the memory consumed by the time estimator.
         size_t memory_used() const;
@@ -199,9 +264,19 @@ public:
     GCodePreviewData();
 
     void set_default();
+    // Clears the layers and the ranges, locks the preview data.
     void reset();
     bool empty() const;
 
+    // The G-code export adds the layers while the G-code is being exported, see GCodeAnalyzer.
+    // Hold this lock while reading the layers or the ranges if the export may be running.
+    std::unique_lock<std::mutex> lock() const { return std::unique_lock<std::mutex>(m_mutex); }
+    // Add a layer, merge it with an already added layer at the same z. Lock the preview data first.
+    void add_extrusion_layer(Extrusion::Layer &&layer);
+    void add_travel_layer(Travel::Layer &&layer);
+    void add_retraction_layer(Retraction::Layer &&layer);
+    void add_unretraction_layer(Retraction::Layer &&layer);
+
     Color get_extrusion_role_color(ExtrusionRole role) const;
     Color get_height_color(float height) const;
     Color get_width_color(float width) const;
@@ -218,6 +293,9 @@ public:
     size_t memory_used() const;
 
     static const std::vector<std::string>& ColorPrintColors();
+
+private:
+    mutable std::mutex m_mutex;
 };
 
 GCodePreviewData::Color operator + (const GCodePreviewData::Color& c1, const GCodePreviewData::Color& c2);
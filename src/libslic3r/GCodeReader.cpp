@@ -5,8 +5,6 @@
 #include <iostream>
 #include <iomanip>
 
-#include <Shiny/Shiny.h>
-
 namespace Slic3r {
 
 void GCodeReader::apply_config(const GCodeConfig &config)
@@ -23,12 +21,9 @@ void GCodeReader::apply_config(const DynamicPrintConfig &config)
 
 const char* GCodeReader::parse_line_internal(const char *ptr, GCodeLine &gline, std::pair<const char*, const char*> &command)
 {
-    PROFILE_FUNC();
-    
     // command and args
     const char *c = ptr;
     {
-        PROFILE_BLOCK(command_and_args);
         // Skip the whitespaces.
         command.first = skip_whitespaces(c);
         // Skip the command.
@@ -77,7 +72,6 @@ const char* GCodeReader::parse_line_internal(const char *ptr, GCodeLine &gline,
 
     // Copy the raw string including the comment, without the trailing newlines.
     if (c > ptr) {
-        PROFILE_BLOCK(copy_raw_string);
         gline.m_raw.assign(ptr, c);
     }
 
@@ -95,7 +89,6 @@ const char* GCodeReader::parse_line_internal(const char *ptr, GCodeLine &gline,
 
 void GCodeReader::update_coordinates(GCodeLine &gline, std::pair<const char*, const char*> &command)
 {
-    PROFILE_FUNC();
     if (*command.first == 'G') {
         int cmd_len = int(command.second - command.first);
         if ((cmd_len == 2 && (command.first[1] == '0' || command.first[1] == '1')) ||
@@ -3,7 +3,7 @@
 #include <boost/bind.hpp>
 #include <cmath>
 
-#include <Shiny/Shiny.h>
+#include "Profiler.hpp"
 
 #include <boost/nowide/fstream.hpp>
 #include <boost/nowide/cstdio.hpp>
@@ -182,7 +182,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::add_gcode_line(const std::string& gcode_line)
     {
-        PROFILE_FUNC();
         _parser.parse_line(gcode_line, 
             [this](GCodeReader &reader, const GCodeReader::GCodeLine &line)
         { this->_process_gcode_line(reader, line); });
@@ -190,7 +189,7 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::add_gcode_block(const char *ptr)
     {
-        PROFILE_FUNC();
+        SLIC3R_PROFILE_FUNCTION();
         GCodeReader::GCodeLine gline;
         auto action = [this](GCodeReader &reader, const GCodeReader::GCodeLine &line)
         { this->_process_gcode_line(reader, line); };
@@ -202,7 +201,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::calculate_time(bool start_from_beginning)
     {
-        PROFILE_FUNC();
         if (start_from_beginning)
         {
             _reset_time();
@@ -259,6 +257,7 @@ namespace Slic3r {
 
     bool GCodeTimeEstimator::post_process_remaining_times(const std::string& filename, float interval)
     {
+        SLIC3R_PROFILE_FUNCTION();
         boost::nowide::ifstream in(filename);
         if (!in.good())
             throw std::runtime_error(std::string("Remaining times export failed.\nCannot open file for reading.\n"));
@@ -541,7 +540,6 @@ namespace Slic3r {
 
     GCodeFlavor GCodeTimeEstimator::get_dialect() const
     {
-        PROFILE_FUNC();
         return _state.dialect;
     }
 
@@ -609,7 +607,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::add_additional_time(float timeSec)
     {
-        PROFILE_FUNC();
         _state.additional_time += timeSec;
     }
 
@@ -718,7 +715,7 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_calculate_time()
     {
-        PROFILE_FUNC();
+        SLIC3R_PROFILE_FUNCTION();
         _forward_pass();
         _reverse_pass();
         _recalculate_trapezoids();
@@ -758,7 +755,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_process_gcode_line(GCodeReader&, const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         std::string cmd = line.cmd();
         if (cmd.length() > 1)
         {
@@ -899,7 +895,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processG1(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         increment_g1_line_id();
 
         // updates axes positions from line
@@ -1097,7 +1092,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processG4(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         GCodeFlavor dialect = get_dialect();
 
         float value;
@@ -1119,37 +1113,31 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processG20(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         set_units(Inches);
     }
 
     void GCodeTimeEstimator::_processG21(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         set_units(Millimeters);
     }
 
     void GCodeTimeEstimator::_processG28(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         // TODO
     }
 
     void GCodeTimeEstimator::_processG90(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         set_global_positioning_type(Absolute);
     }
 
     void GCodeTimeEstimator::_processG91(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         set_global_positioning_type(Relative);
     }
 
     void GCodeTimeEstimator::_processG92(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         float lengthsScaleFactor = (get_units() == Inches) ? INCHES_TO_MM : 1.0f;
         bool anyFound = false;
 
@@ -1190,31 +1178,26 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processM1(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         _simulate_st_synchronize();
     }
 
     void GCodeTimeEstimator::_processM82(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         set_e_local_positioning_type(Absolute);
     }
 
     void GCodeTimeEstimator::_processM83(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         set_e_local_positioning_type(Relative);
     }
 
     void GCodeTimeEstimator::_processM109(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         // TODO
     }
 
     void GCodeTimeEstimator::_processM201(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         GCodeFlavor dialect = get_dialect();
 
         // see http://reprap.org/wiki/G-code#M201:_Set_max_printing_acceleration
@@ -1235,7 +1218,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processM203(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         GCodeFlavor dialect = get_dialect();
 
         // see http://reprap.org/wiki/G-code#M203:_Set_maximum_feedrate
@@ -1261,7 +1243,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processM204(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         float value;
         if (line.has_value('S', value)) {
             // Legacy acceleration format. This format is used by the legacy Marlin, MK2 or MK3 firmware,
@@ -1286,7 +1267,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processM205(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         if (line.has_x())
         {
             float max_jerk = line.x();
@@ -1313,7 +1293,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processM221(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         float value_s;
         float value_t;
         if (line.has_value('S', value_s) && !line.has_value('T', value_t))
@@ -1322,7 +1301,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processM566(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         if (line.has_x())
             set_axis_max_jerk(X, line.x() * MMMIN_TO_MMSEC);
 
@@ -1338,7 +1316,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_processM702(const GCodeReader::GCodeLine& line)
     {
-        PROFILE_FUNC();
         if (line.has('C')) {
             // MK3 MMU2 specific M code:
             // M702 C is expected to be sent by the custom end G-code when finalizing a print.
@@ -1369,13 +1346,11 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_simulate_st_synchronize()
     {
-        PROFILE_FUNC();
         _calculate_time();
     }
 
     void GCodeTimeEstimator::_forward_pass()
     {
-        PROFILE_FUNC();
         if (_blocks.size() > 1)
         {
             for (int i = _last_st_synchronized_block_id + 1; i < (int)_blocks.size() - 1; ++i)
@@ -1387,7 +1362,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_reverse_pass()
     {
-        PROFILE_FUNC();
         if (_blocks.size() > 1)
         {
             for (int i = (int)_blocks.size() - 1; i >= _last_st_synchronized_block_id + 2; --i)
@@ -1399,7 +1373,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_planner_forward_pass_kernel(Block& prev, Block& curr)
     {
-        PROFILE_FUNC();
         // If the previous block is an acceleration block, but it is not long enough to complete the
         // full speed change within the block, we need to adjust the entry speed accordingly. Entry
         // speeds have already been reset, maximized, and reverse planned by reverse planner.
@@ -1440,7 +1413,6 @@ namespace Slic3r {
 
     void GCodeTimeEstimator::_recalculate_trapezoids()
     {
-        PROFILE_FUNC();
         Block* curr = nullptr;
         Block* next = nullptr;
 
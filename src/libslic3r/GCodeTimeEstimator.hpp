@@ -236,6 +236,9 @@ namespace Slic3r {
 
         // Adds the given gcode line
         void add_gcode_line(const std::string& gcode_line);
+        // Adds the given gcode line, already parsed by the caller.
+        // Used by the G-code export to share a single parsing pass between the analyzer and the time estimators.
+        void add_gcode_line(const GCodeReader::GCodeLine& gcode_line) { this->_process_gcode_line(_parser, gcode_line); }
 
         void add_gcode_block(const char *ptr);
         void add_gcode_block(const std::string &str) { this->add_gcode_block(str.c_str()); }
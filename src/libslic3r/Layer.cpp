@@ -2,9 +2,12 @@
 #include "ClipperUtils.hpp"
 #include "Geometry.hpp"
 #include "Print.hpp"
+#include "Profiler.hpp"
 #include "Fill/Fill.hpp"
 #include "SVG.hpp"
 
+#include <cstring>
+
 #include <boost/log/trivial.hpp>
 
 namespace Slic3r {
@@ -97,11 +100,43 @@ ExPolygons Layer::merged(float offset_scaled) const
     return out;
 }
 
+void Layer::backup_untyped_slices()
+{
+    for (LayerRegion *layerm : m_regions)
+        layerm->raw_slices = to_expolygons(layerm->slices.surfaces);
+}
+
+void Layer::restore_untyped_slices()
+{
+    for (LayerRegion *layerm : m_regions)
+        if (layerm->raw_slices.empty() && ! layerm->slices.empty()) {
+            // Not backed up, for example by the Perl bindings slicing the layers on their own.
+            this->merge_slices();
+            return;
+        }
+    for (LayerRegion *layerm : m_regions)
+        layerm->slices.set(layerm->raw_slices, stInternal);
+}
+
+bool Layer::perimeters_compatible(const PrintRegionConfig &config, const PrintRegionConfig &other_config)
+{
+    return config.perimeter_extruder   == other_config.perimeter_extruder
+        && config.perimeters        == other_config.perimeters
+        && config.perimeter_speed   == other_config.perimeter_speed
+        && config.external_perimeter_speed == other_config.external_perimeter_speed
+        && config.gap_fill_speed    == other_config.gap_fill_speed
+        && config.overhangs         == other_config.overhangs
+        && config.serialize("perimeter_extrusion_width").compare(other_config.serialize("perimeter_extrusion_width")) == 0
+        && config.thin_walls        == other_config.thin_walls
+        && config.external_perimeters_first == other_config.external_perimeters_first;
+}
+
 // Here the perimeters are created cummulatively for all layer regions sharing the same parameters influencing the perimeters.
 // The perimeter paths and the thin fills (ExtrusionEntityCollection) are assigned to the first compatible layer region.
 // The resulting fill surface is split back among the originating regions.
-void Layer::make_perimeters()
+void Layer::make_perimeters(bool dirty_only)
 {
+    SLIC3R_PROFILE_FUNCTION();
     BOOST_LOG_TRIVIAL(trace) << "Generating perimeters for layer " << this->id();
     
     // keep track of regions whose perimeters we have already generated
@@ -111,33 +146,36 @@ void Layer::make_perimeters()
         size_t region_id = layerm - m_regions.begin();
         if (done[region_id])
             continue;
-        BOOST_LOG_TRIVIAL(trace) << "Generating perimeters for layer " << this->id() << ", region " << region_id;
         done[region_id] = true;
         const PrintRegionConfig &config = (*layerm)->region()->config();
         
         // find compatible regions
+        // Empty regions are not grouped, so that the options of a region do not influence the layers without its slices.
+        // The perimeters of a group are owned by its first region with slices at this layer and they are extruded with the options
+        // of that region not compared by perimeters_compatible() (small_perimeter_speed for example), not with the options
+        // of a compatible empty region with a lower index.
         LayerRegionPtrs layerms;
         layerms.push_back(*layerm);
-        for (LayerRegionPtrs::const_iterator it = layerm + 1; it != m_regions.end(); ++it) {
-            LayerRegion* other_layerm = *it;
-            const PrintRegionConfig &other_config = other_layerm->region()->config();
-            
-            if (config.perimeter_extruder   == other_config.perimeter_extruder
-                && config.perimeters        == other_config.perimeters
-                && config.perimeter_speed   == other_config.perimeter_speed
-                && config.external_perimeter_speed == other_config.external_perimeter_speed
-                && config.gap_fill_speed    == other_config.gap_fill_speed
-                && config.overhangs         == other_config.overhangs
-                && config.serialize("perimeter_extrusion_width").compare(other_config.serialize("perimeter_extrusion_width")) == 0
-                && config.thin_walls        == other_config.thin_walls
-                && config.external_perimeters_first == other_config.external_perimeters_first) {
-                layerms.push_back(other_layerm);
+        for (LayerRegionPtrs::const_iterator it = layerm + 1; it != m_regions.end() && ! (*layerm)->slices.empty(); ++it)
+            if (! (*it)->slices.empty() && perimeters_compatible(config, (*it)->region()->config())) {
+                layerms.push_back(*it);
                 done[it - m_regions.begin()] = true;
             }
+
+        if (dirty_only && std::none_of(layerms.begin(), layerms.end(), [](const LayerRegion *l) { return l->perimeters_dirty; }))
+            continue;
+        BOOST_LOG_TRIVIAL(trace) << "Generating perimeters for layer " << this->id() << ", region " << region_id;
+        // The regions may have been grouped differently before, clear the results of all the group members.
+        for (LayerRegion *l : layerms) {
+            l->perimeters.clear();
+            l->thin_fills.clear();
+            l->fill_surfaces.clear();
+            l->fill_expolygons.clear();
+            l->perimeters_dirty = false;
+            l->fills_dirty      = true;
         }
         
         if (layerms.size() == 1) {  // optimization
-            (*layerm)->fill_surfaces.surfaces.clear();
             (*layerm)->make_perimeters((*layerm)->slices, &(*layerm)->fill_surfaces);
             (*layerm)->fill_expolygons = to_expolygons((*layerm)->fill_surfaces.surfaces);
         } else {
@@ -171,14 +209,59 @@ void Layer::make_perimeters()
     BOOST_LOG_TRIVIAL(trace) << "Generating perimeters for layer " << this->id() << " - Done";
 }
 
-void Layer::make_fills()
+// 64bit multiply-xorshift digest of the surfaces and of their parameters consumed by make_fill().
+static uint64_t surfaces_digest(const Surfaces &surfaces)
+{
+    uint64_t h = 0x243f6a8885a308d3ull;
+    auto add = [&h](uint64_t v) {
+        h ^= v;
+        h  = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+        h  = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+        h ^= h >> 31;
+    };
+    auto add_double = [&add](double d) { uint64_t v; memcpy(&v, &d, sizeof(v)); add(v); };
+    auto add_polygon = [&add](const Polygon &polygon) {
+        add(polygon.points.size());
+        for (const Point &pt : polygon.points)
+            add((uint64_t(uint32_t(pt(0))) << 32) | uint64_t(uint32_t(pt(1))));
+    };
+    add(surfaces.size());
+    for (const Surface &surface : surfaces) {
+        add(uint64_t(surface.surface_type));
+        add_double(surface.thickness);
+        add(surface.thickness_layers);
+        add_double(surface.bridge_angle);
+        add_polygon(surface.expolygon.contour);
+        add(surface.expolygon.holes.size());
+        for (const Polygon &hole : surface.expolygon.holes)
+            add_polygon(hole);
+    }
+    return h;
+}
+
+void Layer::make_fills(bool dirty_only)
 {
+    SLIC3R_PROFILE_FUNCTION();
     #ifdef SLIC3R_DEBUG
     printf("Making fills for layer " PRINTF_ZU "\n", this->id());
     #endif
     for (LayerRegion *layerm : m_regions) {
+        // posPrepareInfill runs for the whole object, it may have changed the fill surfaces of a region, which is not dirty.
+        // Besides the digest, the number and the area of the surfaces have to match.
+        uint64_t digest = surfaces_digest(layerm->fill_surfaces.surfaces);
+        size_t   count  = layerm->fill_surfaces.surfaces.size();
+        double   area   = 0.;
+        for (const Surface &surface : layerm->fill_surfaces.surfaces)
+            area += surface.area();
+        if (dirty_only && ! layerm->fills_dirty && digest == layerm->filled_surfaces_digest &&
+            count == layerm->filled_surfaces_count && area == layerm->filled_surfaces_area)
+            continue;
         layerm->fills.clear();
         make_fill(*layerm, layerm->fills);
+        layerm->fills_dirty            = false;
+        layerm->filled_surfaces_digest = digest;
+        layerm->filled_surfaces_count  = count;
+        layerm->filled_surfaces_area   = area;
 #ifndef NDEBUG
         for (size_t i = 0; i < layerm->fills.entities.size(); ++ i)
             assert(dynamic_cast<ExtrusionEntityCollection*>(layerm->fills.entities[i]) != NULL);
@@ -14,6 +14,7 @@ namespace Slic3r {
 class Layer;
 class PrintRegion;
 class PrintObject;
+class PrintRegionConfig;
 
 class LayerRegion
 {
@@ -26,6 +27,11 @@ public:
     // collection of surfaces generated by slicing the original geometry
     // divided by type top/bottom/internal
     SurfaceCollection           slices;
+    // Untyped slices of this region as produced by PrintObject::slice(), before detect_surfaces_type() split them.
+    // Restored by Layer::restore_untyped_slices() before the perimeters are generated again.
+    // Empty if Print::region_invalidation() is disabled or if the object has a single region, as the backup doubles
+    // the memory held by the slices, while only the perimeters of some regions of an object may be kept.
+    ExPolygons                  raw_slices;
 
     // collection of extrusion paths/loops filling gaps
     // These fills are generated by the perimeter generator.
@@ -57,6 +63,17 @@ public:
     // ordered collection of extrusion paths to fill surfaces
     // (this collection contains only ExtrusionEntityCollection objects)
     ExtrusionEntityCollection   fills;
+
+    // Set by PrintObject when a change of an option of this region invalidated posPerimeters,
+    // while the perimeters of the other regions or layers are still valid. Cleared by Layer::make_perimeters().
+    bool                        perimeters_dirty = false;
+    // Set by PrintObject when a change of an option of this region invalidated posInfill, and by Layer::make_perimeters()
+    // for the regions with new perimeters, while the fills of the other regions are still valid. Cleared by Layer::make_fills().
+    bool                        fills_dirty = false;
+    // Digest, number and area of the fill_surfaces the fills were generated from, to detect the fill_surfaces changed by posPrepareInfill.
+    uint64_t                    filled_surfaces_digest = 0;
+    size_t                      filled_surfaces_count  = 0;
+    double                      filled_surfaces_area   = 0.;
     
     Flow    flow(FlowRole role, bool bridge = false, double width = -1) const;
     void    slices_to_fill_surfaces_clipped();
@@ -124,6 +141,10 @@ public:
     void                    make_slices();
     // Merge typed slices into untyped slices. This method is used to revert the effects of detect_surfaces_type() called for posPrepareInfill.
     void                    merge_slices();
+    // Save the untyped region slices into LayerRegion::raw_slices, called at the end of posSlice.
+    void                    backup_untyped_slices();
+    // Revert the effects of detect_surfaces_type() exactly, falls back to merge_slices() if there is no backup.
+    void                    restore_untyped_slices();
     // Slices merged into islands, to be used by the elephant foot compensation to trim the individual surfaces with the shrunk merged slices.
     ExPolygons              merged(float offset) const;
     template <class T> bool any_internal_region_slice_contains(const T &item) const {
@@ -134,8 +155,13 @@ public:
         for (const LayerRegion *layerm : m_regions) if (layerm->slices.any_bottom_contains(item)) return true;
         return false;
     }
-    void                    make_perimeters();
-    void                    make_fills();
+    // Test whether the perimeters of the regions of the two configs are generated together by make_perimeters().
+    static bool             perimeters_compatible(const PrintRegionConfig &config, const PrintRegionConfig &other_config);
+    // If dirty_only, only the groups of compatible regions with a member marked with LayerRegion::perimeters_dirty
+    // get new perimeters, and their members are marked with LayerRegion::fills_dirty.
+    void                    make_perimeters(bool dirty_only = false);
+    // If dirty_only, only the regions marked with LayerRegion::fills_dirty or with their fill_surfaces changed are filled again.
+    void                    make_fills(bool dirty_only = false);
 
     void                    export_region_slices_to_svg(const char *path) const;
     void                    export_region_fill_surfaces_to_svg(const char *path) const;
@@ -3,6 +3,7 @@
 #include "MutablePriorityQueue.hpp"
 #include "Utils.hpp"
 
+#include <functional>
 #include <limits> // for numeric_limits
 #include <assert.h>
 
@@ -121,11 +122,13 @@ Polyline MotionPlanner::shortest_path(const Point &from, const Point &to)
     polyline.points.emplace_back(to);
     
     {
-        // grow our environment slightly in order for simplify_by_visibility()
-        // to work best by considering moves on boundaries valid as well
-        ExPolygonCollection grown_env(offset_ex(env.m_env.expolygons, float(+SCALED_EPSILON)));
-        
         if (island_idx == -1) {
+            // grow our environment slightly in order for simplify_by_visibility()
+            // to work best by considering moves on boundaries valid as well
+            if (m_outer_env_grown.expolygons.empty())
+                m_outer_env_grown = ExPolygonCollection(offset_ex(env.m_env.expolygons, float(+SCALED_EPSILON)));
+            const ExPolygonCollection &grown_env = m_outer_env_grown;
+
             /*  If 'from' or 'to' are not inside our env, they were connected using the 
                 nearest_env_point() search which maybe produce ugly paths since it does not
                 include the endpoint in the Dijkstra search; the simplify_by_visibility() 
@@ -192,46 +195,164 @@ const MotionPlannerGraph& MotionPlanner::init_graph(int island_idx)
         
         typedef voronoi_diagram<double> VD;
         VD vd;
-        // Mapping between Voronoi vertices and graph nodes.
-        std::map<const VD::vertex_type*, size_t> vd_vertices;
         // get boundaries as lines
-        const MotionPlannerEnv &env = this->get_env(island_idx);
+        MotionPlannerEnv &env = (island_idx == -1) ? m_outer : m_islands[island_idx];
+        if (env.m_island_index.empty())
+            env.m_island_index.create(env.m_island);
         Lines lines = env.m_env.lines();
         boost::polygon::construct_voronoi(lines.begin(), lines.end(), &vd);
+        // Voronoi vertices are indexed by their position in vd.vertices().
+        // Cache of the vertex in island test: -1 not tested yet, 0 outside, 1 inside.
+        std::vector<signed char> vd_vertices_inside(vd.num_vertices(), -1);
+        // Mapping between Voronoi vertices and graph nodes.
+        std::vector<size_t>      vd_vertices(vd.num_vertices(), size_t(-1));
+        auto vertex_idx = [&vd](const VD::vertex_type *v) { return size_t(v - &vd.vertices().front()); };
         // traverse the Voronoi diagram and generate graph nodes and edges
         for (const VD::edge_type &edge : vd.edges()) {
             if (edge.is_infinite())
                 continue;
             const VD::vertex_type* v0 = edge.vertex0();
             const VD::vertex_type* v1 = edge.vertex1();
+            size_t i0 = vertex_idx(v0);
+            size_t i1 = vertex_idx(v1);
             Point p0(v0->x(), v0->y());
             Point p1(v1->x(), v1->y());
             // Insert only Voronoi edges fully contained in the island.
-            //FIXME This test has a terrible O(n^2) time complexity.
-            if (env.island_contains_b(p0) && env.island_contains_b(p1)) {
-                // Find v0 in the graph, allocate a new node if v0 does not exist in the graph yet.
-                auto i_v0 = vd_vertices.find(v0);
-                size_t v0_idx;
-                if (i_v0 == vd_vertices.end())
-                    vd_vertices[v0] = v0_idx = graph->add_node(p0);
-                else
-                    v0_idx = i_v0->second;
-                // Find v1 in the graph, allocate a new node if v0 does not exist in the graph yet.
-                auto i_v1 = vd_vertices.find(v1);
-                size_t v1_idx;
-                if (i_v1 == vd_vertices.end())
-                    vd_vertices[v1] = v1_idx = graph->add_node(p1);
-                else
-                    v1_idx = i_v1->second;
-                // Euclidean distance is used as weight for the graph edge
-                graph->add_edge(v0_idx, v1_idx, (p1 - p0).cast<double>().norm());
-            }
+            if (vd_vertices_inside[i0] == -1)
+                vd_vertices_inside[i0] = env.island_contains_b(p0);
+            if (vd_vertices_inside[i0] == 0)
+                continue;
+            if (vd_vertices_inside[i1] == -1)
+                vd_vertices_inside[i1] = env.island_contains_b(p1);
+            if (vd_vertices_inside[i1] == 0)
+                continue;
+            // Find v0 and v1 in the graph, allocate new nodes if they do not exist in the graph yet.
+            if (vd_vertices[i0] == size_t(-1))
+                vd_vertices[i0] = graph->add_node(p0);
+            if (vd_vertices[i1] == size_t(-1))
+                vd_vertices[i1] = graph->add_node(p1);
+            // Euclidean distance is used as weight for the graph edge
+            graph->add_edge(vd_vertices[i0], vd_vertices[i1], (p1 - p0).cast<double>().norm());
         }
     }
 
     return *graph;
 }
 
+void MotionPlannerIslandIndex::create(const ExPolygon &island)
+{
+    m_edges.clear();
+    m_first_points.clear();
+    BoundingBox bbox;
+    for (size_t i = 0; i <= island.holes.size(); ++ i) {
+        const Polygon &polygon = (i == 0) ? island.contour : island.holes[i - 1];
+        if (polygon.points.empty())
+            continue;
+        for (const Line &line : polygon.lines())
+            m_edges.push_back({ line, (unsigned int)i });
+        m_first_points.emplace_back(polygon.points.front());
+        bbox.merge(polygon.points);
+    }
+    if (m_edges.empty())
+        return;
+
+    // A point on the boundary is up to SCALED_EPSILON from its edge, plus the rounding of its projection to the edge.
+    const coord_t margin = coord_t(SCALED_EPSILON) + 2;
+    bbox.offset(margin);
+    m_origin    = bbox.min;
+    Vec2d size  = (bbox.max - bbox.min).cast<double>();
+    // Roughly a single edge per cell.
+    m_cell_size = std::max<coord_t>(margin, coord_t(std::sqrt(size.x() * size.y() / double(m_edges.size()))));
+    m_cols      = size_t((bbox.max(0) - bbox.min(0)) / m_cell_size) + 1;
+    m_rows      = size_t((bbox.max(1) - bbox.min(1)) / m_cell_size) + 1;
+
+    // Fill in the edges into the ranges of rows / cells in two passes, first counting them, then storing them.
+    auto bin = [this](std::vector<size_t> &begin, std::vector<size_t> &data, size_t num_bins, 
+        std::function<void(const Edge&, std::function<void(size_t)>)> for_each_bin) {
+        begin.assign(num_bins + 1, 0);
+        for (const Edge &edge : m_edges)
+            for_each_bin(edge, [&begin](size_t idx) { ++ begin[idx + 1]; });
+        for (size_t i = 1; i <= num_bins; ++ i)
+            begin[i] += begin[i - 1];
+        data.assign(begin.back(), 0);
+        std::vector<size_t> end(begin.begin(), begin.end() - 1);
+        for (const Edge &edge : m_edges)
+            for_each_bin(edge, [this, &edge, &data, &end](size_t idx) { data[end[idx] ++] = &edge - m_edges.data(); });
+    };
+    // A row contains the edges, which may cross a horizontal line through a point of the row.
+    bin(m_row_begin, m_row_edges, m_rows, [this](const Edge &edge, std::function<void(size_t)> fn) {
+        coord_t ymin = std::min(edge.line.a(1), edge.line.b(1));
+        coord_t ymax = std::max(edge.line.a(1), edge.line.b(1));
+        if (ymin < ymax)
+            for (size_t r = size_t(ymin - m_origin(1)) / m_cell_size; r <= size_t(ymax - 1 - m_origin(1)) / m_cell_size; ++ r)
+                fn(r);
+    });
+    // A cell contains the edges closer than the margin to the cell.
+    bin(m_cell_begin, m_cell_edges, m_rows * m_cols, [this, margin](const Edge &edge, std::function<void(size_t)> fn) {
+        size_t c0 = size_t(std::min(edge.line.a(0), edge.line.b(0)) - margin - m_origin(0)) / m_cell_size;
+        size_t c1 = size_t(std::max(edge.line.a(0), edge.line.b(0)) + margin - m_origin(0)) / m_cell_size;
+        size_t r0 = size_t(std::min(edge.line.a(1), edge.line.b(1)) - margin - m_origin(1)) / m_cell_size;
+        size_t r1 = size_t(std::max(edge.line.a(1), edge.line.b(1)) + margin - m_origin(1)) / m_cell_size;
+        for (size_t r = r0; r <= r1; ++ r)
+            for (size_t c = c0; c <= c1; ++ c)
+                fn(r * m_cols + c);
+    });
+}
+
+bool MotionPlannerIslandIndex::contains_b(const Point &pt) const
+{
+    return this->contains(pt) || this->has_boundary_point(pt);
+}
+
+// Same as ExPolygon::contains(), which evaluates the crossing number test of Polygon::contains() over the contour and the holes.
+bool MotionPlannerIslandIndex::contains(const Point &pt) const
+{
+    if (pt(1) < m_origin(1))
+        return false;
+    size_t row = size_t(pt(1) - m_origin(1)) / m_cell_size;
+    if (row >= m_rows)
+        return false;
+    bool   contour_odd = false;
+    // The edges of a row are sorted by their polygon.
+    for (size_t i = m_row_begin[row]; i < m_row_begin[row + 1];) {
+        unsigned int polygon = m_edges[m_row_edges[i]].polygon;
+        bool         odd     = false;
+        for (; i < m_row_begin[row + 1] && m_edges[m_row_edges[i]].polygon == polygon; ++ i) {
+            // Polygon::contains() tests the edge from the previous point j to the current point i.
+            const Point &pi = m_edges[m_row_edges[i]].line.b;
+            const Point &pj = m_edges[m_row_edges[i]].line.a;
+            if (((pi(1) > pt(1)) != (pj(1) > pt(1)))
+                && ((double)pt(0) < (double)(pj(0) - pi(0)) * (double)(pt(1) - pi(1)) / (double)(pj(1) - pi(1)) + (double)pi(0)) )
+                odd = ! odd;
+        }
+        if (polygon == 0)
+            contour_odd = odd;
+        else if (odd)
+            // Inside a hole.
+            return false;
+    }
+    return contour_odd;
+}
+
+// Same as ExPolygon::has_boundary_point(), which projects the point onto all the edges of the contour and of the holes.
+bool MotionPlannerIslandIndex::has_boundary_point(const Point &pt) const
+{
+    for (const Point &first_point : m_first_points)
+        if ((first_point - pt).cast<double>().norm() < SCALED_EPSILON)
+            return true;
+    if (pt(0) < m_origin(0) || pt(1) < m_origin(1))
+        return false;
+    size_t col = size_t(pt(0) - m_origin(0)) / m_cell_size;
+    size_t row = size_t(pt(1) - m_origin(1)) / m_cell_size;
+    if (col >= m_cols || row >= m_rows)
+        return false;
+    size_t cell = row * m_cols + col;
+    for (size_t i = m_cell_begin[cell]; i < m_cell_begin[cell + 1]; ++ i)
+        if ((pt.projection_onto(m_edges[m_cell_edges[i]].line) - pt).cast<double>().norm() < SCALED_EPSILON)
+            return true;
+    return false;
+}
+
 // Find a middle point on the path from start_point to end_point with the shortest path.
 static inline size_t nearest_waypoint_index(const Point &start_point, const Points &middle_points, const Point &end_point)
 {
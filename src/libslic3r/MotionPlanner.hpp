@@ -18,6 +18,40 @@ namespace Slic3r {
 
 class MotionPlanner;
 
+// Index of the edges of an island for a fast inclusive point in island test, returning exactly what ExPolygon::contains_b() returns.
+// The edges are binned into the rows of a regular grid for the crossing number test, which only considers the edges
+// crossing the horizontal line through the point, and into the cells of the grid for the test of the point being
+// on the island boundary.
+class MotionPlannerIslandIndex
+{
+public:
+    void create(const ExPolygon &island);
+    bool empty() const { return m_edges.empty(); }
+    bool contains_b(const Point &pt) const;
+
+private:
+    bool contains(const Point &pt) const;
+    bool has_boundary_point(const Point &pt) const;
+
+    struct Edge {
+        // Line of Polygon::lines().
+        Line            line;
+        // 0 for the contour, 1 based index of a hole.
+        unsigned int    polygon;
+    };
+    std::vector<Edge>       m_edges;
+    Points                  m_first_points;
+    Point                   m_origin;
+    coord_t                 m_cell_size = 1;
+    size_t                  m_rows = 0;
+    size_t                  m_cols = 0;
+    // Edges crossing the rows and edges close to the cells, stored as ranges of m_row_edges and m_cell_edges.
+    std::vector<size_t>     m_row_begin;
+    std::vector<size_t>     m_row_edges;
+    std::vector<size_t>     m_cell_begin;
+    std::vector<size_t>     m_cell_edges;
+};
+
 class MotionPlannerEnv
 {
     friend class MotionPlanner;
@@ -29,11 +63,13 @@ public:
     bool  island_contains(const Point &pt) const
         { return m_island_bbox.contains(pt) && m_island.contains(pt); }
     bool  island_contains_b(const Point &pt) const
-        { return m_island_bbox.contains(pt) && m_island.contains_b(pt); }
+        { return m_island_bbox.contains(pt) && (m_island_index.empty() ? m_island.contains_b(pt) : m_island_index.contains_b(pt)); }
 
 private:
     ExPolygon           m_island;
     BoundingBox         m_island_bbox;
+    // Created lazily for the islands, for which the graph is being built.
+    MotionPlannerIslandIndex m_island_index;
     // Region, where the travel is allowed.
     ExPolygonCollection m_env;
 };
@@ -77,6 +113,8 @@ private:
     bool                                m_initialized;
     std::vector<MotionPlannerEnv>       m_islands;
     MotionPlannerEnv                    m_outer;
+    // m_outer.m_env grown by SCALED_EPSILON, created lazily.
+    ExPolygonCollection                 m_outer_env_grown;
     // 0th graph is the graph for m_outer. Other graphs are 1 indexed.
     std::vector<std::unique_ptr<MotionPlannerGraph>> m_graphs;
     
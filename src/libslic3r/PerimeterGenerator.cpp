@@ -1,6 +1,7 @@
 #include "PerimeterGenerator.hpp"
 #include "ClipperUtils.hpp"
 #include "ExtrusionEntityCollection.hpp"
+#include "Profiler.hpp"
 #include <cmath>
 #include <cassert>
 
@@ -8,6 +9,7 @@ namespace Slic3r {
 
 void PerimeterGenerator::process()
 {
+    SLIC3R_PROFILE_FUNCTION();
     // other perimeters
     this->_mm3_per_mm               = this->perimeter_flow.mm3_per_mm();
     coord_t perimeter_width         = this->perimeter_flow.scaled_width();
@@ -309,7 +311,7 @@ ExtrusionEntityCollection PerimeterGenerator::_traverse_loops(
             // reapply the nearest point search for starting point
             // We allow polyline reversal because Clipper may have randomly
             // reversed polylines during clipping.
-            paths = (ExtrusionPaths)ExtrusionEntityCollection(paths).chained_path();
+            chain_extrusion_paths(paths);
         } else {
             ExtrusionPath path(role);
             path.polyline   = loop->polygon.split_at_first_point();
@@ -327,39 +329,38 @@ ExtrusionEntityCollection PerimeterGenerator::_traverse_loops(
         ExtrusionEntityCollection tw = this->_variable_width
             (thin_walls, erExternalPerimeter, this->ext_perimeter_flow);
         
-        coll.append(tw.entities);
+        coll.append(std::move(tw.entities));
         thin_walls.clear();
     }
     
-    // sort entities into a new collection using a nearest-neighbor search,
-    // preserving the original indices which are useful for detecting thin walls
-    ExtrusionEntityCollection sorted_coll;
-    coll.chained_path(&sorted_coll, false, erMixed, &sorted_coll.orig_indices);
+    // sort entities using a nearest-neighbor search, preserving the original indices
+    // which are useful for detecting thin walls
+    ChainOrder order = coll.chained_order_from(coll.entities.empty() ? Point() : coll.first_point());
     
-    // traverse children and build the final collection
+    // traverse children and build the final collection, taking the entities over from coll
     ExtrusionEntityCollection entities;
-    for (std::vector<size_t>::const_iterator idx = sorted_coll.orig_indices.begin();
-        idx != sorted_coll.orig_indices.end();
-        ++idx) {
-        
-        if (*idx >= loops.size()) {
+    entities.entities.reserve(order.size());
+    for (const std::pair<size_t, bool> &o : order) {
+        ExtrusionEntity *entity = coll.entities[o.first];
+        coll.entities[o.first] = nullptr;
+        if (o.first >= loops.size()) {
             // this is a thin wall
-            // let's get it from the sorted collection as it might have been reversed
-            size_t i = idx - sorted_coll.orig_indices.begin();
-            entities.append(*sorted_coll.entities[i]);
+            if (o.second)
+                entity->reverse();
+            entities.entities.push_back(entity);
         } else {
-            const PerimeterGeneratorLoop &loop = loops[*idx];
-            ExtrusionLoop eloop = *dynamic_cast<ExtrusionLoop*>(coll.entities[*idx]);
+            const PerimeterGeneratorLoop &loop = loops[o.first];
+            ExtrusionLoop *eloop = static_cast<ExtrusionLoop*>(entity);
             
             ExtrusionEntityCollection children = this->_traverse_loops(loop.children, thin_walls);
             if (loop.is_contour) {
-                eloop.make_counter_clockwise();
-                entities.append(children.entities);
-                entities.append(eloop);
+                eloop->make_counter_clockwise();
+                entities.append(std::move(children.entities));
+                entities.entities.push_back(eloop);
             } else {
-                eloop.make_clockwise();
-                entities.append(eloop);
-                entities.append(children.entities);
+                eloop->make_clockwise();
+                entities.entities.push_back(eloop);
+                entities.append(std::move(children.entities));
             }
         }
     }
@@ -13,11 +13,16 @@
 //#include "PrintExport.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <limits>
+#include <mutex>
 #include <unordered_set>
 #include <boost/filesystem/path.hpp>
 #include <boost/log/trivial.hpp>
 
+#include <tbb/task_group.h>
+
 //! macro used to mark string used at localization, 
 //! return same string
 #define L(s) Slic3r::I18N::translate(s)
@@ -519,10 +524,11 @@ bool Print::apply_config_perl_tests_only(DynamicPrintConfig config)
             if (this_region_config_set) {
                 t_config_option_keys diff = region.config().diff(this_region_config);
                 if (! diff.empty()) {
-                    region.config_apply_only(this_region_config, diff, false);
+                    // Invalidate with the old region config, which tells the regions sharing the perimeters with this one.
                     for (PrintObject *object : m_objects)
                         if (region_id < object->region_volumes.size() && ! object->region_volumes[region_id].empty())
-                            invalidated |= object->invalidate_state_by_config_options(diff);
+                            invalidated |= object->invalidate_region_state_by_config_options(region_id, diff);
+                    region.config_apply_only(this_region_config, diff, false);
                 }
                 other_region_configs.emplace_back(std::move(this_region_config));
             }
@@ -686,10 +692,12 @@ Print::ApplyStatus Print::apply(const Model &model, const DynamicPrintConfig &co
 	config.option("filament_settings_id", true);
 	config.option("printer_settings_id",  true);
     config.normalize();
-    // Collect changes to print config.
-    t_config_option_keys print_diff  = m_config.diff(config);
-    t_config_option_keys object_diff = m_default_object_config.diff(config);
-    t_config_option_keys region_diff = m_default_region_config.diff(config);
+    // Collect changes to print config. The option ids address the static configs directly, the keys are only needed
+    // for the invalidation of the print steps.
+    ConfigOptionIdSet    print_diff_ids = m_config.diff_ids(config);
+    t_config_option_keys print_diff     = print_config_def.keys(print_diff_ids);
+    ConfigOptionIdSet    object_diff    = m_default_object_config.diff_ids(config);
+    ConfigOptionIdSet    region_diff    = m_default_region_config.diff_ids(config);
     t_config_option_keys placeholder_parser_diff = this->placeholder_parser().config_diff(config);
 
     // Do not use the ApplyStatus as we will use the max function when updating apply_status. 
@@ -718,7 +726,7 @@ Print::ApplyStatus Print::apply(const Model &model, const DynamicPrintConfig &co
     }
 
     // It is also safe to change m_config now after this->invalidate_state_by_config_options() call.
-    m_config.apply_only(config, print_diff, true);
+    m_config.apply_only(config, print_diff_ids, true);
     // Handle changes to object config defaults
     m_default_object_config.apply_only(config, object_diff, true);
     // Handle changes to regions config defaults
@@ -1064,10 +1072,11 @@ Print::ApplyStatus Print::apply(const Model &model, const DynamicPrintConfig &co
         if (this_region_config_set) {
             t_config_option_keys diff = region.config().diff(this_region_config);
             if (! diff.empty()) {
-                region.config_apply_only(this_region_config, diff, false);
+                // Invalidate with the old region config, which tells the regions sharing the perimeters with this one.
                 for (PrintObject *print_object : m_objects)
                     if (region_id < print_object->region_volumes.size() && ! print_object->region_volumes[region_id].empty())
-                        update_apply_status(print_object->invalidate_state_by_config_options(diff));
+                        update_apply_status(print_object->invalidate_region_state_by_config_options(region_id, diff));
+                region.config_apply_only(this_region_config, diff, false);
             }
         }
     }
@@ -1489,22 +1498,77 @@ void Print::auto_assign_extruders(ModelObject* model_object) const
     }
 }
 
+// Run a single step of the background processing, log its wall clock time.
+template<typename StepFn>
+static void run_timed_step(const std::string &name, StepFn step_fn)
+{
+    auto time_start = std::chrono::steady_clock::now();
+    step_fn();
+    BOOST_LOG_TRIVIAL(info) << name << " took " << std::chrono::duration<double>(std::chrono::steady_clock::now() - time_start).count() << " s";
+}
+
+// Called by the steps of the PrintObjects. If multiple objects are processed concurrently, Print::process() reports
+// the share of the object steps finished instead, as the percentages of the steps of the individual objects
+// would move the progress bar back and forth.
+void Print::set_object_status(int percent, const std::string &message)
+{
+    if (m_object_steps_total == 0)
+        this->set_status(percent, message);
+}
+
 // Slicing process, running at a background thread.
 void Print::process()
 {
     BOOST_LOG_TRIVIAL(info) << "Staring the slicing process." << log_memory_info();
-    for (PrintObject *obj : m_objects)
-        obj->make_perimeters();
-    this->set_status(70, L("Infilling layers"));
-    for (PrintObject *obj : m_objects)
-        obj->infill();
-    for (PrintObject *obj : m_objects)
-        obj->generate_support_material();
+
+    // The steps of a single object depend on each other and they are executed in sequence,
+    // while the objects are independent and they are processed concurrently. The layers of each step are processed
+    // in parallel as before, so that the layers of multiple objects share the worker threads. This keeps the cores busy
+    // on plates with many small objects, which would not saturate the cores when processed one after the other.
+    // The steps are entered and finalized through set_started() / set_done(), which are guarded by the state mutex,
+    // and the steps of all objects check for cancelation as before. An exception thrown by one of the objects
+    // cancels processing of the other objects and it is rethrown by task_group::wait().
+    // While multiple objects are processed, the progress is reported as the share of the object steps finished.
+    m_object_steps_total = (m_objects.size() > 1) ? 4 * m_objects.size() : 0;
+    size_t     object_steps_done = 0;
+    std::mutex object_status_mutex;
+    auto object_step_done = [this, &object_steps_done, &object_status_mutex]() {
+        if (m_object_steps_total > 0) {
+            // The steps of all objects share the range of 10% to 85%, which the steps of a single object report.
+            std::lock_guard<std::mutex> lock(object_status_mutex);
+            ++ object_steps_done;
+            this->set_status(int(10 + 75 * object_steps_done / m_object_steps_total), L("Processing objects"));
+        }
+    };
+    auto process_object = [this, &object_step_done](PrintObject *obj) {
+        const std::string object_name = "Object \"" + obj->model_object()->name + "\"";
+        run_timed_step(object_name + " slicing",    [obj]() { obj->slice(); });
+        object_step_done();
+        run_timed_step(object_name + " perimeters", [obj]() { obj->make_perimeters(); });
+        object_step_done();
+        if (m_object_steps_total == 0)
+            this->set_status(70, L("Infilling layers"));
+        run_timed_step(object_name + " infill",     [obj]() { obj->infill(); });
+        object_step_done();
+        run_timed_step(object_name + " support material", [obj]() { obj->generate_support_material(); });
+        object_step_done();
+    };
+    if (m_objects.size() == 1)
+        process_object(m_objects.front());
+    else {
+        this->set_status(10, L("Processing objects"));
+        tbb::task_group task_group;
+        for (PrintObject *obj : m_objects)
+            task_group.run([&process_object, obj]() { process_object(obj); });
+        task_group.wait();
+    }
+    m_object_steps_total = 0;
+
     if (this->set_started(psSkirt)) {
         m_skirt.clear();
         if (this->has_skirt()) {
             this->set_status(88, L("Generating skirt"));
-            this->_make_skirt();
+            run_timed_step("Skirt", [this]() { this->_make_skirt(); });
         }
         this->set_done(psSkirt);
     }
@@ -1512,7 +1576,7 @@ void Print::process()
         m_brim.clear();
         if (m_config.brim_width > 0) {
             this->set_status(88, L("Generating brim"));
-            this->_make_brim();
+            run_timed_step("Brim", [this]() { this->_make_brim(); });
         }
        this->set_done(psBrim);
     }
@@ -1520,7 +1584,7 @@ void Print::process()
         m_wipe_tower_data.clear();
         if (this->has_wipe_tower()) {
             //this->set_status(95, L("Generating wipe tower"));
-            this->_make_wipe_tower();
+            run_timed_step("Wipe tower", [this]() { this->_make_wipe_tower(); });
         }
        this->set_done(psWipeTower);
     }
@@ -161,6 +161,11 @@ protected:
     bool                    invalidate_all_steps();
     // Invalidate steps based on a set of parameters changed.
     bool                    invalidate_state_by_config_options(const std::vector<t_config_option_key> &opt_keys);
+    // Invalidate steps based on a set of parameters of a single region changed. Options influencing the perimeters
+    // or the fills of that region only are invalidated for the layers of that region and for the regions sharing
+    // its perimeters, so that posPerimeters and posInfill do not recalculate the other regions.
+    // To be called before the new config is applied to the region.
+    bool                    invalidate_region_state_by_config_options(size_t region_id, const std::vector<t_config_option_key> &opt_keys);
     // If ! m_slicing_params.valid, recalculate.
     void                    update_slicing_parameters();
 
@@ -186,6 +191,11 @@ private:
     void discover_horizontal_shells();
     void combine_infill();
     void _generate_support_material();
+    // Print::region_invalidation() for an object with more than one region. Only then the untyped slices are backed up,
+    // as they double the memory held by the slices and the single region of an object is always processed completely.
+    bool region_invalidation() const;
+    bool invalidate_region_perimeters(size_t region_id);
+    bool invalidate_region_infill(size_t region_id);
 
     PrintObjectConfig                       m_config;
     // Translation in Z + Rotation + Scaling / Mirroring.
@@ -200,6 +210,12 @@ private:
     SlicingParameters                       m_slicing_params;
     LayerPtrs                               m_layers;
     SupportLayerPtrs                        m_support_layers;
+    // The fills of the layer regions not marked with LayerRegion::fills_dirty are valid,
+    // posInfill shall only fill the dirty ones.
+    bool                                    m_infill_dirty_only = false;
+    // The perimeters of the layer regions not marked with LayerRegion::perimeters_dirty are valid,
+    // posPerimeters shall only generate the perimeters of the dirty ones.
+    bool                                    m_perimeters_dirty_only = false;
 
     std::vector<ExPolygons> _slice_region(size_t region_id, const std::vector<float> &z, bool modifier);
     std::vector<ExPolygons> _slice_volumes(const std::vector<float> &z, const std::vector<const ModelVolume*> &volumes) const;
@@ -297,6 +313,11 @@ public:
     bool                apply_config_perl_tests_only(DynamicPrintConfig config);
 
     void                process() override;
+    // If enabled (the default), a change of an option of a single region recalculates the perimeters and fills
+    // of that region only, for which the untyped slices of the layer regions are kept. The command line slicer disables it,
+    // as no Print::apply() follows process() there.
+    void                set_region_invalidation(bool enable) { m_region_invalidation = enable; }
+    bool                region_invalidation() const { return m_region_invalidation; }
     // Exports G-code into a file name based on the path_template, returns the file path of the generated G-code file.
     // If preview_data is not null, the preview_data is filled in for the G-code visualization (not used by the command line Slic3r).
     std::string         export_gcode(const std::string &path_template, GCodePreviewData *preview_data);
@@ -368,6 +389,9 @@ protected:
 private:
     bool                invalidate_state_by_config_options(const std::vector<t_config_option_key> &opt_keys);
 
+    // Progress of a step of a PrintObject, see Print::process().
+    void                set_object_status(int percent, const std::string &message);
+
     void                _make_skirt();
     void                _make_brim();
     void                _make_wipe_tower();
@@ -392,6 +416,11 @@ private:
     // Estimated print time, filament consumed.
     PrintStatistics                         m_print_statistics;
 
+    // Number of the steps of the objects processed concurrently by Print::process(), zero if a single object is processed.
+    size_t                                  m_object_steps_total = 0;
+    // See set_region_invalidation().
+    bool                                    m_region_invalidation = true;
+
     // To allow GCode to set the Print's GCodeExport step status.
     friend class GCode;
     // Allow PrintObject to access m_mutex and m_cancel_callback.
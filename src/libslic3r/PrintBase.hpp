@@ -273,6 +273,8 @@ public:
             RELOAD_SCENE                    = 1 << 1,
             RELOAD_SLA_SUPPORT_POINTS       = 1 << 2,
             RELOAD_SLA_PREVIEW              = 1 << 3,
+            // The G-code export added layers to the G-code preview data.
+            RELOAD_GCODE_PREVIEW            = 1 << 4,
         };
         // Bitmap of FlagBits
         unsigned int    flags;
@@ -32,6 +32,8 @@ PrintConfigDef::PrintConfigDef()
     assign_printer_technology_to_unknown(this->options, ptFFF);
     this->init_sla_params();
     assign_printer_technology_to_unknown(this->options, ptSLA);
+    // Some definitions are copies of the others.
+    this->assign_ids();
 }
 
 void PrintConfigDef::init_common_params()
@@ -3165,6 +3167,33 @@ CLIMiscConfigDef::CLIMiscConfigDef()
     def->label = L("Data directory");
     def->tooltip = L("Load and store settings at the given directory. This is useful for maintaining different profiles or including configurations from a network storage.");
 
+    def = this->add("slice_cache_dir", coString);
+    def->label = L("Slice cache directory");
+    def->tooltip = L("Store the sliced layers of the objects in the given directory and reuse them when the same objects "
+                     "are sliced at the same layer heights again.");
+
+    def = this->add("slice_cache_dir_size", coInt);
+    def->label = L("Slice cache directory size limit");
+    def->tooltip = L("Delete the least recently used files of the slice cache directory above the given number of megabytes. "
+                     "Zero disables the limit.");
+    def->sidetext = L("MB");
+    def->min = 0;
+    def->set_default_value(new ConfigOptionInt(1024));
+
+    def = this->add("slice_cache_memory", coInt);
+    def->label = L("Slice cache memory limit");
+    def->tooltip = L("Keep the sliced layers of the objects in memory up to the given number of megabytes "
+                     "and reuse them when the same objects are sliced at the same layer heights again. Zero disables the memory cache.");
+    def->sidetext = L("MB");
+    def->min = 0;
+    def->set_default_value(new ConfigOptionInt(0));
+
+    def = this->add("profile", coString);
+    def->label = L("Profile");
+    def->tooltip = L("Measure the time spent in the slicing and G-code export stages and write the measurements on exit "
+                     "into the given file as a Chrome trace (to be opened by chrome://tracing or Perfetto) "
+                     "and into a file with the .txt suffix as a text summary.");
+
     def = this->add("loglevel", coInt);
     def->label = L("Logging level");
     def->tooltip = L("Messages with severity lower or eqal to the loglevel will be printed out. 0:trace, 1:debug, 2:info, 3:warning, 4:error, 5:fatal");
@@ -290,7 +290,16 @@ protected:
             return (it == m_map_name_to_offset.end()) ? nullptr : reinterpret_cast<const ConfigOption*>((const char*)owner + it->second);
         }
 
+        // Find the option by the id of its definition, if it is a definition of the ConfigDef this cache was finalized with.
+        ConfigOption*       optptr(const ConfigOptionDef &optdef, T *owner) const
+        {
+            if (optdef.id < m_offsets.size() && m_defs->by_id()[optdef.id] == &optdef)
+                return (m_offsets[optdef.id] < 0) ? nullptr : reinterpret_cast<ConfigOption*>((char*)owner + m_offsets[optdef.id]);
+            return this->optptr(optdef.opt_key, owner);
+        }
+
         const std::vector<std::string>& keys()      const { return m_keys; }
+        const ConfigOptionIdSet&        ids()       const { return m_ids; }
         const T&                        defaults()  const { return *m_defaults; }
 
         // To be called during the StaticCache setup.
@@ -300,8 +309,11 @@ protected:
         {
             assert(defs != nullptr);
             m_defaults = defaults;
+            m_defs     = defs;
             m_keys.clear();
             m_keys.reserve(m_map_name_to_offset.size());
+            m_offsets.assign(defs->by_id().size(), -1);
+            m_ids = ConfigOptionIdSet(defs->by_id().size());
             for (const auto &kvp : defs->options) {
                 // Find the option given the option name kvp.first by an offset from (char*)m_defaults.
                 ConfigOption *opt = this->optptr(kvp.first, m_defaults);
@@ -309,6 +321,8 @@ protected:
                     // This option is not defined by the ConfigBase of type T.
                     continue;
                 m_keys.emplace_back(kvp.first);
+                m_offsets[kvp.second.id] = (const char*)opt - (const char*)m_defaults;
+                m_ids.insert(kvp.second.id);
                 const ConfigOptionDef *def = defs->get(kvp.first);
                 assert(def != nullptr);
                 if (def->default_value)
@@ -318,7 +332,11 @@ protected:
 
     private:
         T                                  *m_defaults;
+        const ConfigDef                    *m_defs = nullptr;
         std::vector<std::string>            m_keys;
+        // Offsets of the options from the start of T indexed by ConfigOptionDef::id, -1 for the options T does not have.
+        std::vector<ptrdiff_t>              m_offsets;
+        ConfigOptionIdSet                   m_ids;
     };
 };
 
@@ -329,6 +347,11 @@ public: \
         { return s_cache_##CLASS_NAME.optptr(opt_key, this); } \
     /* Overrides ConfigBase::keys(). Collect names of all configuration values maintained by this configuration store. */ \
     t_config_option_keys     keys() const override { return s_cache_##CLASS_NAME.keys(); } \
+    /* Overrides ConfigBase::optptr_by_def(). Find a ConfigOption instance by the id of its definition. */ \
+    ConfigOption*            optptr_by_def(const ConfigOptionDef &optdef, bool create = false) override \
+        { return s_cache_##CLASS_NAME.optptr(optdef, this); } \
+    /* Overrides ConfigBase::option_ids(). Ids of all configuration values maintained by this configuration store. */ \
+    const ConfigOptionIdSet* option_ids() const override { return &s_cache_##CLASS_NAME.ids(); } \
     static const CLASS_NAME& defaults() { initialize_cache(); return s_cache_##CLASS_NAME.defaults(); } \
 private: \
     static void initialize_cache() \
@@ -1190,6 +1213,7 @@ private:
             this->options.insert(cli_actions_config_def.options.begin(), cli_actions_config_def.options.end());
             this->options.insert(cli_transform_config_def.options.begin(), cli_transform_config_def.options.end());
             this->options.insert(cli_misc_config_def.options.begin(), cli_misc_config_def.options.end());
+            this->assign_ids();
         }
         // Do not release the default values, they are handled by print_config_def & cli_actions_config_def / cli_transform_config_def / cli_misc_config_def.
         ~PrintAndCLIConfigDef() { this->options.clear(); }
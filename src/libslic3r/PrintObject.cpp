@@ -3,12 +3,15 @@
 #include "ClipperUtils.hpp"
 #include "Geometry.hpp"
 #include "I18N.hpp"
+#include "Profiler.hpp"
 #include "SupportMaterial.hpp"
 #include "Surface.hpp"
+#include "SliceCache.hpp"
 #include "Slicing.hpp"
 #include "Utils.hpp"
 
 #include <utility>
+#include <unordered_map>
 #include <boost/log/trivial.hpp>
 #include <float.h>
 
@@ -16,7 +19,6 @@
 #include <tbb/parallel_for.h>
 #include <tbb/atomic.h>
 
-#include <Shiny/Shiny.h>
 
 //! macro used to mark string used at localization, 
 //! return same string
@@ -105,9 +107,10 @@ PrintBase::ApplyStatus PrintObject::set_copies(const Points &points)
 // this should be idempotent
 void PrintObject::slice()
 {
+    SLIC3R_PROFILE_FUNCTION();
     if (! this->set_started(posSlice))
         return;
-    m_print->set_status(10, L("Processing triangulated mesh"));
+    m_print->set_object_status(10, L("Processing triangulated mesh"));
     std::vector<coordf_t> layer_height_profile;
     this->update_layer_height_profile(*this->model_object(), m_slicing_params, layer_height_profile);
     m_print->throw_if_canceled();
@@ -124,31 +127,38 @@ void PrintObject::slice()
         this->_simplify_slices(scale_(this->print()->config().resolution));
     if (m_layers.empty())
         throw std::runtime_error("No layers were detected. You might want to repair your STL file(s) or check their size or thickness and retry.\n");    
+    if (this->region_invalidation())
+        for (Layer *layer : m_layers)
+            layer->backup_untyped_slices();
     this->set_done(posSlice);
 }
 
-// 1) Merges typed region slices into stInternal type.
+// 1) Restores the untyped region slices of type stInternal.
 // 2) Increases an "extra perimeters" counter at region slices where needed.
 // 3) Generates perimeters, gap fills and fill regions (fill regions of type stInternal).
 void PrintObject::make_perimeters()
 {
+    SLIC3R_PROFILE_FUNCTION();
     // prerequisites
     this->slice();
 
     if (! this->set_started(posPerimeters))
         return;
 
-    m_print->set_status(20, L("Generating perimeters"));
-    BOOST_LOG_TRIVIAL(info) << "Generating perimeters..." << log_memory_info();
+    m_print->set_object_status(20, L("Generating perimeters"));
+    // Print::apply() changes m_perimeters_dirty_only with the background processing stopped.
+    bool dirty_only = m_perimeters_dirty_only;
+    BOOST_LOG_TRIVIAL(info) << "Generating perimeters..." << (dirty_only ? " dirty regions only" : "") << log_memory_info();
     
-    // merge slices if they were split into types
-    if (this->typed_slices) {
+    // Revert the slices split into types by posPrepareInfill and the extra perimeters counted by a previous run,
+    // so that the perimeters are the same as if generated for a fresh object. Without the region invalidation,
+    // the untyped slices are not backed up, and they are only merged if they were split into types.
+    if (this->typed_slices || this->region_invalidation())
         for (Layer *layer : m_layers) {
-            layer->merge_slices();
+            layer->restore_untyped_slices();
             m_print->throw_if_canceled();
         }
-        this->typed_slices = false;
-    }
+    this->typed_slices = false;
     
     // compare each layer to the one below, and mark those slices needing
     // one additional inner perimeter, like the top of domed objects-
@@ -223,10 +233,10 @@ void PrintObject::make_perimeters()
     BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - start";
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, m_layers.size()),
-        [this](const tbb::blocked_range<size_t>& range) {
+        [this, dirty_only](const tbb::blocked_range<size_t>& range) {
             for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                 m_print->throw_if_canceled();
-                m_layers[layer_idx]->make_perimeters();
+                m_layers[layer_idx]->make_perimeters(dirty_only);
             }
         }
     );
@@ -240,15 +250,17 @@ void PrintObject::make_perimeters()
     ###$self->_simplify_slices(&Slic3r::SCALED_RESOLUTION);
     */
     
+    m_perimeters_dirty_only = false;
     this->set_done(posPerimeters);
 }
 
 void PrintObject::prepare_infill()
 {
+    SLIC3R_PROFILE_FUNCTION();
     if (! this->set_started(posPrepareInfill))
         return;
 
-    m_print->set_status(30, L("Preparing infill"));
+    m_print->set_object_status(30, L("Preparing infill"));
 
     // This will assign a type (top/bottom/internal) to $layerm->slices.
     // Then the classifcation of $layerm->slices is transfered onto 
@@ -360,17 +372,20 @@ void PrintObject::prepare_infill()
 
 void PrintObject::infill()
 {
+    SLIC3R_PROFILE_FUNCTION();
     // prerequisites
     this->prepare_infill();
 
     if (this->set_started(posInfill)) {
-        BOOST_LOG_TRIVIAL(debug) << "Filling layers in parallel - start";
+        // Print::apply() changes m_infill_dirty_only with the background processing stopped.
+        bool dirty_only = m_infill_dirty_only;
+        BOOST_LOG_TRIVIAL(debug) << "Filling layers in parallel - start" << (dirty_only ? ", dirty regions only" : "");
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, m_layers.size()),
-            [this](const tbb::blocked_range<size_t>& range) {
+            [this, dirty_only](const tbb::blocked_range<size_t>& range) {
                 for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                     m_print->throw_if_canceled();
-                    m_layers[layer_idx]->make_fills();
+                    m_layers[layer_idx]->make_fills(dirty_only);
                 }
             }
         );
@@ -379,16 +394,18 @@ void PrintObject::infill()
         /*  we could free memory now, but this would make this step not idempotent
         ### $_->fill_surfaces->clear for map @{$_->regions}, @{$object->layers};
         */
+        m_infill_dirty_only = false;
         this->set_done(posInfill);
     }
 }
 
 void PrintObject::generate_support_material()
 {
+    SLIC3R_PROFILE_FUNCTION();
     if (this->set_started(posSupportMaterial)) {
         this->clear_support_layers();
         if ((m_config.support_material || m_config.raft_layers > 0) && m_layers.size() > 1) {
-            m_print->set_status(85, L("Generating support material"));    
+            m_print->set_object_status(85, L("Generating support material"));    
             this->_generate_support_material();
             m_print->throw_if_canceled();
         } else {
@@ -435,6 +452,44 @@ SupportLayerPtrs::const_iterator PrintObject::insert_support_layer(SupportLayerP
     return m_support_layers.insert(pos, new SupportLayer(id, this, height, print_z, slice_z));
 }
 
+// The options consumed by the perimeter generator and by make_fill() and the steps they invalidate.
+// The region local options influence the perimeters and the fills of the layer regions of their region only,
+// so that PrintObject::invalidate_region_state_by_config_options() limits their invalidation to the layers of that region.
+struct PerimeterInfillOption
+{
+    std::vector<PrintObjectStep> steps;
+    bool                         region_local;
+};
+
+static const PerimeterInfillOption* perimeter_infill_option(const t_config_option_key &opt_key)
+{
+    static const std::unordered_map<std::string, PerimeterInfillOption> options = {
+        { "perimeters",                         { { posPerimeters },                        true } },
+        { "extra_perimeters",                   { { posPerimeters },                        true } },
+        { "gap_fill_speed",                     { { posPerimeters },                        true } },
+        { "overhangs",                          { { posPerimeters },                        true } },
+        { "first_layer_extrusion_width",        { { posPerimeters },                        false } },
+        { "perimeter_extrusion_width",          { { posPerimeters },                        true } },
+        { "infill_overlap",                     { { posPerimeters },                        true } },
+        { "thin_walls",                         { { posPerimeters },                        true } },
+        { "external_perimeters_first",          { { posPerimeters },                        true } },
+        { "top_fill_pattern",                   { { posInfill },                            true } },
+        { "bottom_fill_pattern",                { { posInfill },                            true } },
+        { "external_fill_link_max_length",      { { posInfill },                            false } },
+        { "fill_angle",                         { { posInfill },                            true } },
+        { "fill_pattern",                       { { posInfill },                            true } },
+        { "fill_link_max_length",               { { posInfill },                            false } },
+        { "top_infill_extrusion_width",         { { posInfill },                            true } },
+        { "fill_density",                       { { posPerimeters, posPrepareInfill },      true } },
+        { "solid_infill_extrusion_width",       { { posPerimeters, posPrepareInfill },      true } },
+        { "external_perimeter_extrusion_width", { { posPerimeters, posSupportMaterial },    true } },
+        { "perimeter_extruder",                 { { posPerimeters, posSupportMaterial },    true } },
+        { "bridge_flow_ratio",                  { { posPerimeters, posInfill },             true } },
+    };
+    auto it = options.find(opt_key);
+    return (it == options.end()) ? nullptr : &it->second;
+}
+
 // Called by Print::apply().
 // This method only accepts PrintObjectConfig and PrintRegionConfig option keys.
 bool PrintObject::invalidate_state_by_config_options(const std::vector<t_config_option_key> &opt_keys)
@@ -445,16 +500,8 @@ bool PrintObject::invalidate_state_by_config_options(const std::vector<t_config_
     std::vector<PrintObjectStep> steps;
     bool invalidated = false;
     for (const t_config_option_key &opt_key : opt_keys) {
-        if (   opt_key == "perimeters"
-            || opt_key == "extra_perimeters"
-            || opt_key == "gap_fill_speed"
-            || opt_key == "overhangs"
-            || opt_key == "first_layer_extrusion_width"
-            || opt_key == "perimeter_extrusion_width"
-            || opt_key == "infill_overlap"
-            || opt_key == "thin_walls"
-            || opt_key == "external_perimeters_first") {
-            steps.emplace_back(posPerimeters);
+        if (const PerimeterInfillOption *option = perimeter_infill_option(opt_key)) {
+            steps.insert(steps.end(), option->steps.begin(), option->steps.end());
         } else if (
                opt_key == "layer_height"
             || opt_key == "first_layer_height"
@@ -503,29 +550,6 @@ bool PrintObject::invalidate_state_by_config_options(const std::vector<t_config_
             || opt_key == "ensure_vertical_shell_thickness"
             || opt_key == "bridge_angle") {
             steps.emplace_back(posPrepareInfill);
-        } else if (
-               opt_key == "top_fill_pattern"
-            || opt_key == "bottom_fill_pattern"
-            || opt_key == "external_fill_link_max_length"
-            || opt_key == "fill_angle"
-            || opt_key == "fill_pattern"
-            || opt_key == "fill_link_max_length"
-            || opt_key == "top_infill_extrusion_width"
-            || opt_key == "first_layer_extrusion_width") {
-            steps.emplace_back(posInfill);
-        } else if (
-               opt_key == "fill_density"
-            || opt_key == "solid_infill_extrusion_width") {
-            steps.emplace_back(posPerimeters);
-            steps.emplace_back(posPrepareInfill);
-        } else if (
-               opt_key == "external_perimeter_extrusion_width"
-            || opt_key == "perimeter_extruder") {
-            steps.emplace_back(posPerimeters);
-            steps.emplace_back(posSupportMaterial);
-        } else if (opt_key == "bridge_flow_ratio") {
-            steps.emplace_back(posPerimeters);
-            steps.emplace_back(posInfill);
         } else if (
                opt_key == "seam_position"
             || opt_key == "seam_preferred_direction"
@@ -558,6 +582,89 @@ bool PrintObject::invalidate_state_by_config_options(const std::vector<t_config_
     return invalidated;
 }
 
+// Called by Print::apply() for the options of a PrintRegion, which has some volumes of this object assigned.
+// This method only accepts PrintRegionConfig option keys.
+bool PrintObject::invalidate_region_state_by_config_options(size_t region_id, const std::vector<t_config_option_key> &opt_keys)
+{
+    if (! this->region_invalidation())
+        return this->invalidate_state_by_config_options(opt_keys);
+
+    std::vector<t_config_option_key> other_keys;
+    bool                             perimeters  = false;
+    bool                             infill_only = false;
+    bool                             support     = false;
+    for (const t_config_option_key &opt_key : opt_keys) {
+        const PerimeterInfillOption *option = perimeter_infill_option(opt_key);
+        if (option == nullptr || ! option->region_local)
+            other_keys.emplace_back(opt_key);
+        else if (std::find(option->steps.begin(), option->steps.end(), posPerimeters) != option->steps.end()) {
+            // posPrepareInfill and posInfill are invalidated by posPerimeters.
+            perimeters = true;
+            if (std::find(option->steps.begin(), option->steps.end(), posSupportMaterial) != option->steps.end())
+                support = true;
+        } else
+            infill_only = true;
+    }
+
+    bool invalidated = this->invalidate_state_by_config_options(other_keys);
+    if (perimeters)
+        invalidated |= this->invalidate_region_perimeters(region_id);
+    if (support)
+        invalidated |= this->invalidate_step(posSupportMaterial);
+    if (infill_only)
+        invalidated |= this->invalidate_region_infill(region_id);
+    return invalidated;
+}
+
+// Only the objects with more than one region may keep the perimeters and the fills of some of their regions.
+bool PrintObject::region_invalidation() const
+{
+    return m_print->region_invalidation() &&
+        std::count_if(this->region_volumes.begin(), this->region_volumes.end(), [](const std::vector<int> &volumes) { return ! volumes.empty(); }) > 1;
+}
+
+// Invalidate posPerimeters, but keep the perimeters and the fills of the layer regions, which do not depend on the region.
+// The region config is still the old one, it tells the regions which shared the perimeters with this region.
+bool PrintObject::invalidate_region_perimeters(size_t region_id)
+{
+    // Same as with invalidate_region_infill(), the perimeters and fills of the other regions are valid if their steps are done
+    // or if their steps were already limited to the dirty regions.
+    bool keep_others = this->is_step_done_unguarded(posPerimeters) || m_perimeters_dirty_only;
+    bool keep_fills  = keep_others && (this->is_step_done_unguarded(posInfill) || m_infill_dirty_only);
+    bool invalidated = this->invalidate_step(posPerimeters);
+    if (keep_others) {
+        const PrintRegion       *region = m_print->regions()[region_id];
+        const PrintRegionConfig &config = region->config();
+        // Only the layers with the slices of this region are influenced, Layer::make_perimeters() does not group empty regions.
+        for (Layer *layer : m_layers)
+            if (region_id < layer->region_count() && ! layer->get_region(int(region_id))->slices.empty())
+                for (LayerRegion *layerm : layer->regions())
+                    if (layerm->region() == region || (! layerm->slices.empty() && Layer::perimeters_compatible(config, layerm->region()->config())))
+                        layerm->perimeters_dirty = true;
+        m_perimeters_dirty_only = true;
+        // The regions with new perimeters are marked with LayerRegion::fills_dirty by Layer::make_perimeters().
+        m_infill_dirty_only     = keep_fills;
+    }
+    return invalidated;
+}
+
+// Invalidate posInfill, but keep the fills of the other regions if they are valid.
+bool PrintObject::invalidate_region_infill(size_t region_id)
+{
+    // The fills of all regions are valid if posInfill is done. If posInfill is invalid or if it has been canceled
+    // while running, they are valid only if posInfill was already limited to the dirty regions.
+    // The background processing is stopped by invalidate_step() if posInfill was started or done.
+    bool keep_others = this->is_step_done_unguarded(posInfill) || m_infill_dirty_only;
+    bool invalidated = this->invalidate_step(posInfill);
+    if (keep_others) {
+        for (Layer *layer : m_layers)
+            if (region_id < layer->region_count())
+                layer->get_region(int(region_id))->fills_dirty = true;
+        m_infill_dirty_only = true;
+    }
+    return invalidated;
+}
+
 bool PrintObject::invalidate_step(PrintObjectStep step)
 {
 	bool invalidated = Inherited::invalidate_step(step);
@@ -578,6 +685,11 @@ bool PrintObject::invalidate_step(PrintObjectStep step)
         invalidated |= m_print->invalidate_steps({ psSkirt, psBrim });
         this->m_slicing_params.valid = false;
     }
+    // The perimeters or the fills of all regions need to be calculated again.
+    if (step == posSlice || step == posPerimeters)
+        m_perimeters_dirty_only = false;
+    if (step == posSlice || step == posPerimeters || step == posPrepareInfill || step == posInfill)
+        m_infill_dirty_only = false;
 
     // Wipe tower depends on the ordering of extruders, which in turn depends on everything.
     // It also decides about what the wipe_into_infill / wipe_into_object features will do,
@@ -590,6 +702,8 @@ bool PrintObject::invalidate_step(PrintObjectStep step)
 
 bool PrintObject::invalidate_all_steps()
 {
+    m_perimeters_dirty_only = false;
+    m_infill_dirty_only     = false;
     return Inherited::invalidate_all_steps() | m_print->invalidate_all_steps();
 }
 
@@ -611,6 +725,7 @@ bool PrintObject::has_support_material() const
 // If a part of a region is of stBottom and stTop, the stBottom wins.
 void PrintObject::detect_surfaces_type()
 {
+    SLIC3R_PROFILE_FUNCTION();
     BOOST_LOG_TRIVIAL(info) << "Detecting solid surfaces..." << log_memory_info();
 
     // Interface shells: the intersecting parts are treated as self standing objects supporting each other.
@@ -803,6 +918,7 @@ void PrintObject::detect_surfaces_type()
 
 void PrintObject::process_external_surfaces()
 {
+    SLIC3R_PROFILE_FUNCTION();
     BOOST_LOG_TRIVIAL(info) << "Processing external surfaces..." << log_memory_info();
 
 	for (size_t region_id = 0; region_id < this->region_volumes.size(); ++region_id) {
@@ -826,7 +942,7 @@ void PrintObject::process_external_surfaces()
 
 void PrintObject::discover_vertical_shells()
 {
-    PROFILE_FUNC();
+    SLIC3R_PROFILE_FUNCTION();
 
     BOOST_LOG_TRIVIAL(info) << "Discovering vertical shells..." << log_memory_info();
 
@@ -923,7 +1039,7 @@ void PrintObject::discover_vertical_shells()
     }
 
     for (size_t idx_region = 0; idx_region < this->region_volumes.size(); ++ idx_region) {
-        PROFILE_BLOCK(discover_vertical_shells_region);
+        SLIC3R_PROFILE_ZONE("discover_vertical_shells_region");
 
         const PrintRegion &region = *m_print->get_region(idx_region);
         if (! region.config().ensure_vertical_shell_thickness.value)
@@ -976,7 +1092,7 @@ void PrintObject::discover_vertical_shells()
             (const tbb::blocked_range<size_t>& range) {
                 // printf("discover_vertical_shells from %d to %d\n", range.begin(), range.end());
                 for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++ idx_layer) {
-                    PROFILE_BLOCK(discover_vertical_shells_region_layer);
+                    SLIC3R_PROFILE_ZONE("discover_vertical_shells_region_layer");
                     m_print->throw_if_canceled();
 #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
         			static size_t debug_idx = 0;
@@ -1001,7 +1117,7 @@ void PrintObject::discover_vertical_shells()
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
                     float min_perimeter_infill_spacing = float(infill_line_spacing) * 1.05f;
                     {
-                        PROFILE_BLOCK(discover_vertical_shells_region_layer_collect);
+                        SLIC3R_PROFILE_ZONE("discover_vertical_shells_region_layer_collect");
 #if 0
 // #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
                         {
@@ -1059,7 +1175,7 @@ void PrintObject::discover_vertical_shells()
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
 #if 0
                         {
-                            PROFILE_BLOCK(discover_vertical_shells_region_layer_shell_);
+                            SLIC3R_PROFILE_ZONE("discover_vertical_shells_region_layer_shell_");
         //                    shell = union_(shell, true);
                             shell = union_(shell, false); 
                         }
@@ -1202,16 +1318,13 @@ void PrintObject::discover_vertical_shells()
 		}
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
     } // for each region
-
-    // Write the profiler measurements to file
-//    PROFILE_UPDATE();
-//    PROFILE_OUTPUT(debug_out_path("discover_vertical_shells-profile.txt").c_str());
 }
 
 /* This method applies bridge flow to the first internal solid layer above
    sparse infill */
 void PrintObject::bridge_over_infill()
 {
+    SLIC3R_PROFILE_FUNCTION();
     BOOST_LOG_TRIVIAL(info) << "Bridge over infill..." << log_memory_info();
 
     for (size_t region_id = 0; region_id < this->region_volumes.size(); ++ region_id) {
@@ -1451,6 +1564,7 @@ bool PrintObject::update_layer_height_profile(const ModelObject &model_object, c
 // this should be idempotent
 void PrintObject::_slice(const std::vector<coordf_t> &layer_height_profile)
 {
+    SLIC3R_PROFILE_FUNCTION();
     BOOST_LOG_TRIVIAL(info) << "Slicing objects..." << log_memory_info();
 
     this->typed_slices = false;
@@ -1814,15 +1928,25 @@ std::vector<ExPolygons> PrintObject::_slice_volumes(const std::vector<float> &z,
             mesh.transform(m_trafo, true);
             // apply XY shift
             mesh.translate(- unscale<float>(m_copies_shift(0)), - unscale<float>(m_copies_shift(1)), 0);
-            // perform actual slicing
-            const Print *print = this->print();
-            auto callback = TriangleMeshSlicer::throw_on_cancel_callback_type([print](){print->throw_if_canceled();});
-            // TriangleMeshSlicer needs shared vertices, also this calls the repair() function.
-            mesh.require_shared_vertices();
-            TriangleMeshSlicer mslicer;
-            mslicer.init(&mesh, callback);
-			mslicer.slice(z, float(m_config.slice_closing_radius.value), &layers, callback);
-            m_print->throw_if_canceled();
+            // perform actual slicing, unless the same mesh has already been sliced at the same heights
+            SliceCache     &cache     = SliceCache::instance();
+            SliceCache::Key cache_key;
+            bool            cached    = cache.enabled();
+            if (cached)
+                cache_key = SliceCache::make_key(mesh, z, float(m_config.slice_closing_radius.value));
+            // A hit with a wrong number of layers is treated as a miss.
+            if (! cached || ! cache.get(cache_key, layers) || layers.size() != z.size()) {
+                const Print *print = this->print();
+                auto callback = TriangleMeshSlicer::throw_on_cancel_callback_type([print](){print->throw_if_canceled();});
+                // TriangleMeshSlicer needs shared vertices, also this calls the repair() function.
+                mesh.require_shared_vertices();
+                TriangleMeshSlicer mslicer;
+                mslicer.init(&mesh, callback);
+                mslicer.slice(z, float(m_config.slice_closing_radius.value), &layers, callback);
+                m_print->throw_if_canceled();
+                if (cached)
+                    cache.put(cache_key, layers);
+            }
         }
     }
     return layers;
@@ -1843,15 +1967,25 @@ std::vector<ExPolygons> PrintObject::_slice_volume(const std::vector<float> &z,
         mesh.transform(m_trafo, true);
         // apply XY shift
         mesh.translate(- unscale<float>(m_copies_shift(0)), - unscale<float>(m_copies_shift(1)), 0);
-        // perform actual slicing
-        TriangleMeshSlicer mslicer;
-        const Print *print = this->print();
-        auto callback = TriangleMeshSlicer::throw_on_cancel_callback_type([print](){print->throw_if_canceled();});
-        // TriangleMeshSlicer needs the shared vertices.
-        mesh.require_shared_vertices();
-        mslicer.init(&mesh, callback);
-        mslicer.slice(z, float(m_config.slice_closing_radius.value), &layers, callback);
-        m_print->throw_if_canceled();
+        // perform actual slicing, unless the same mesh has already been sliced at the same heights
+        SliceCache     &cache     = SliceCache::instance();
+        SliceCache::Key cache_key;
+        bool            cached    = cache.enabled();
+        if (cached)
+            cache_key = SliceCache::make_key(mesh, z, float(m_config.slice_closing_radius.value));
+        // A hit with a wrong number of layers is treated as a miss.
+        if (! cached || ! cache.get(cache_key, layers) || layers.size() != z.size()) {
+            TriangleMeshSlicer mslicer;
+            const Print *print = this->print();
+            auto callback = TriangleMeshSlicer::throw_on_cancel_callback_type([print](){print->throw_if_canceled();});
+            // TriangleMeshSlicer needs the shared vertices.
+            mesh.require_shared_vertices();
+            mslicer.init(&mesh, callback);
+            mslicer.slice(z, float(m_config.slice_closing_radius.value), &layers, callback);
+            m_print->throw_if_canceled();
+            if (cached)
+                cache.put(cache_key, layers);
+        }
     }
     return layers;
 }
@@ -1961,15 +2095,16 @@ void PrintObject::_simplify_slices(double distance)
 
 void PrintObject::_make_perimeters()
 {
+    SLIC3R_PROFILE_FUNCTION();
     if (! this->set_started(posPerimeters))
         return;
 
     BOOST_LOG_TRIVIAL(info) << "Generating perimeters..." << log_memory_info();
     
-    // merge slices if they were split into types
+    // restore the untyped slices if they were split into types
     if (this->typed_slices) {
         for (Layer *layer : m_layers)
-            layer->merge_slices();
+            layer->restore_untyped_slices();
         this->typed_slices = false;
         this->invalidate_step(posPrepareInfill);
     }
@@ -2072,6 +2207,7 @@ void PrintObject::_make_perimeters()
 // fill_surfaces but we only turn them into VOID surfaces, thus preserving the boundaries.
 void PrintObject::clip_fill_surfaces()
 {
+    SLIC3R_PROFILE_FUNCTION();
     if (! m_config.infill_only_where_needed.value ||
         ! std::any_of(this->print()->regions().begin(), this->print()->regions().end(), 
             [](const PrintRegion *region) { return region->config().fill_density > 0; }))
@@ -2151,6 +2287,7 @@ void PrintObject::clip_fill_surfaces()
 
 void PrintObject::discover_horizontal_shells()
 {
+    SLIC3R_PROFILE_FUNCTION();
     BOOST_LOG_TRIVIAL(trace) << "discover_horizontal_shells()";
     
     for (size_t region_id = 0; region_id < this->region_volumes.size(); ++ region_id) {
@@ -2342,6 +2479,7 @@ void PrintObject::discover_horizontal_shells()
 // fill_surfaces but we only turn them into VOID surfaces, thus preserving the boundaries.
 void PrintObject::combine_infill()
 {
+    SLIC3R_PROFILE_FUNCTION();
     // Work on each region separately.
     for (size_t region_id = 0; region_id < this->region_volumes.size(); ++ region_id) {
         const PrintRegion *region = this->print()->regions()[region_id];
@@ -2451,6 +2589,7 @@ void PrintObject::combine_infill()
 
 void PrintObject::_generate_support_material()
 {
+    SLIC3R_PROFILE_FUNCTION();
     PrintObjectSupportMaterial support_material(this, m_slicing_params);
     support_material.generate(*this);
 }
@@ -0,0 +1,196 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/cstdio.hpp>
+
+namespace Slic3r {
+
+std::atomic<bool> Profiler::s_enabled(false);
+
+struct ProfilerEvent
+{
+    const char   *name;
+    uint64_t      start;
+    uint64_t      end;
+    unsigned int  depth;
+};
+
+// Ring buffer of the zones recorded by a single thread. Only the owning thread writes into it,
+// the profile is expected to be written out after the profiled work finished.
+struct ProfilerThreadBuffer
+{
+    ProfilerThreadBuffer(unsigned int thread_id) : thread_id(thread_id), events(Profiler::ring_buffer_size) {}
+
+    unsigned int                thread_id;
+    std::vector<ProfilerEvent>  events;
+    // Total number of the zones recorded, the ring buffer contains the last min(num_recorded, ring_buffer_size) of them.
+    size_t                      num_recorded = 0;
+    unsigned int                depth = 0;
+
+    template<typename Fn> void for_each_event(Fn fn) const
+    {
+        size_t n = std::min(num_recorded, events.size());
+        for (size_t i = num_recorded - n; i < num_recorded; ++ i)
+            fn(events[i % events.size()]);
+    }
+};
+
+// The buffers of all the threads, which ever recorded a zone. The buffers are never released, as the threads of the TBB pool live
+// until the application exits.
+static std::mutex                                          g_profiler_mutex;
+static std::vector<std::unique_ptr<ProfilerThreadBuffer>>  g_profiler_buffers;
+
+static ProfilerThreadBuffer& profiler_thread_buffer()
+{
+    static thread_local ProfilerThreadBuffer *buffer = nullptr;
+    if (buffer == nullptr) {
+        std::lock_guard<std::mutex> lock(g_profiler_mutex);
+        g_profiler_buffers.emplace_back(new ProfilerThreadBuffer((unsigned int)g_profiler_buffers.size()));
+        buffer = g_profiler_buffers.back().get();
+    }
+    return *buffer;
+}
+
+static const auto g_profiler_epoch = std::chrono::steady_clock::now();
+
+uint64_t Profiler::now()
+{
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_profiler_epoch).count());
+}
+
+unsigned int& Profiler::thread_depth()
+{
+    return profiler_thread_buffer().depth;
+}
+
+void Profiler::record(const char *name, uint64_t start, uint64_t end, unsigned int depth)
+{
+    ProfilerThreadBuffer &buffer = profiler_thread_buffer();
+    ProfilerEvent &event = buffer.events[buffer.num_recorded ++ % buffer.events.size()];
+    event.name  = name;
+    event.start = start;
+    event.end   = end;
+    event.depth = depth;
+}
+
+void Profiler::clear()
+{
+    std::lock_guard<std::mutex> lock(g_profiler_mutex);
+    for (std::unique_ptr<ProfilerThreadBuffer> &buffer : g_profiler_buffers)
+        buffer->num_recorded = 0;
+}
+
+// Escapes a zone name to be emitted as a JSON string.
+static std::string json_escape(const char *str)
+{
+    std::string out;
+    for (; *str != 0; ++ str) {
+        unsigned char c = (unsigned char)*str;
+        switch (c) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\b': out += "\\b"; break;
+        case '\f': out += "\\f"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (c < 0x20) {
+                char buf[8];
+                sprintf(buf, "\\u%04x", (unsigned int)c);
+                out += buf;
+            } else
+                out += char(c);
+        }
+    }
+    return out;
+}
+
+bool Profiler::write_chrome_trace(const std::string &path)
+{
+    FILE *file = boost::nowide::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        BOOST_LOG_TRIVIAL(error) << "Profiler: Cannot open " << path << " for writing";
+        return false;
+    }
+    fprintf(file, "{\"traceEvents\":[\n");
+    bool first = true;
+    std::lock_guard<std::mutex> lock(g_profiler_mutex);
+    for (const std::unique_ptr<ProfilerThreadBuffer> &buffer : g_profiler_buffers)
+        buffer->for_each_event([file, &buffer, &first](const ProfilerEvent &event) {
+            fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                first ? "" : ",\n", json_escape(event.name).c_str(), double(event.start) * 0.001, double(event.end - event.start) * 0.001, buffer->thread_id);
+            first = false;
+        });
+    fprintf(file, "\n]}\n");
+    return fclose(file) == 0;
+}
+
+bool Profiler::write_summary(const std::string &path)
+{
+    // Accumulate the zones by their path in the zone hierarchy of a thread.
+    struct Stats {
+        size_t   count     = 0;
+        uint64_t inclusive = 0;
+        uint64_t children  = 0;
+    };
+    std::map<std::string, Stats> stats;
+    size_t num_dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_profiler_mutex);
+        for (const std::unique_ptr<ProfilerThreadBuffer> &buffer : g_profiler_buffers) {
+            if (buffer->num_recorded > buffer->events.size())
+                num_dropped += buffer->num_recorded - buffer->events.size();
+            // The zones are recorded when they end, sort them by their start to reconstruct the hierarchy.
+            std::vector<ProfilerEvent> events;
+            buffer->for_each_event([&events](const ProfilerEvent &event) { events.emplace_back(event); });
+            std::sort(events.begin(), events.end(), [](const ProfilerEvent &a, const ProfilerEvent &b)
+                { return a.start < b.start || (a.start == b.start && a.depth < b.depth); });
+            std::vector<std::string> stack;
+            for (const ProfilerEvent &event : events) {
+                // Parents of the oldest zones may have been overwritten in the ring buffer, these zones are attributed to "?".
+                stack.resize(event.depth + 1, std::string("?"));
+                stack[event.depth] = (event.depth == 0 ? std::string() : stack[event.depth - 1] + "/") + event.name;
+                Stats &s = stats[stack[event.depth]];
+                ++ s.count;
+                s.inclusive += event.end - event.start;
+                if (event.depth > 0)
+                    stats[stack[event.depth - 1]].children += event.end - event.start;
+            }
+        }
+    }
+
+    FILE *file = boost::nowide::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        BOOST_LOG_TRIVIAL(error) << "Profiler: Cannot open " << path << " for writing";
+        return false;
+    }
+    fprintf(file, "%-80s %10s %14s %14s\n", "Zone (summed over all threads)", "Calls", "Inclusive [s]", "Exclusive [s]");
+    for (const std::pair<const std::string, Stats> &kvp : stats) {
+        size_t depth = std::count(kvp.first.begin(), kvp.first.end(), '/');
+        size_t name_pos = kvp.first.rfind('/');
+        std::string name = std::string(2 * depth, ' ') + ((name_pos == std::string::npos) ? kvp.first : kvp.first.substr(name_pos + 1));
+        const Stats &s = kvp.second;
+        fprintf(file, "%-80s %10zu %14.6f %14.6f\n", name.c_str(), s.count, double(s.inclusive) * 1e-9, double(s.inclusive - std::min(s.inclusive, s.children)) * 1e-9);
+    }
+    if (num_dropped > 0)
+        fprintf(file, "\n%zu oldest zones were overwritten in the ring buffers and are missing from the profile.\n", num_dropped);
+    return fclose(file) == 0;
+}
+
+bool Profiler::write(const std::string &path)
+{
+    bool trace_ok = write_chrome_trace(path);
+    bool summary_ok = write_summary(boost::filesystem::path(path).replace_extension(".txt").string());
+    return trace_ok && summary_ok;
+}
+
+} // namespace Slic3r
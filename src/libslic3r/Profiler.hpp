@@ -0,0 +1,73 @@
+#ifndef slic3r_Profiler_hpp_
+#define slic3r_Profiler_hpp_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Slic3r {
+
+// Thread aware zone profiler.
+// A zone is a scope marked with SLIC3R_PROFILE_ZONE("name"). When the profiler is enabled, each thread records its zones
+// into its own ring buffer without any locking, therefore the zones may be placed into the bodies of tbb::parallel_for.
+// When the profiler is disabled, a zone costs a single relaxed atomic load.
+// The recorded zones are written out as a Chrome trace-event JSON (to be opened by chrome://tracing or Perfetto)
+// and as a text summary of the zone hierarchy with the inclusive and exclusive times.
+class Profiler
+{
+public:
+    // Number of zones recorded per thread before the oldest ones are overwritten.
+    static const size_t ring_buffer_size = 1 << 16;
+
+    static void enable(bool enable = true) { s_enabled.store(enable, std::memory_order_relaxed); }
+    static bool enabled() { return s_enabled.load(std::memory_order_relaxed); }
+    // Discards the recorded zones of all threads.
+    static void clear();
+
+    // Writes the Chrome trace-event JSON into path, and the text summary into path with the suffix replaced with ".txt".
+    static bool write(const std::string &path);
+    static bool write_chrome_trace(const std::string &path);
+    static bool write_summary(const std::string &path);
+
+    // Zone recording, used by the ProfileZone.
+    static uint64_t now();
+    static void     record(const char *name, uint64_t start, uint64_t end, unsigned int depth);
+    static unsigned int& thread_depth();
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+class ProfileZone
+{
+public:
+    explicit ProfileZone(const char *name) : m_name(Profiler::enabled() ? name : nullptr)
+    {
+        if (m_name != nullptr) {
+            m_depth = Profiler::thread_depth() ++;
+            m_start = Profiler::now();
+        }
+    }
+    ~ProfileZone()
+    {
+        if (m_name != nullptr) {
+            Profiler::record(m_name, m_start, Profiler::now(), m_depth);
+            -- Profiler::thread_depth();
+        }
+    }
+
+private:
+    const char   *m_name;
+    uint64_t      m_start = 0;
+    unsigned int  m_depth = 0;
+};
+
+} // namespace Slic3r
+
+#define SLIC3R_PROFILE_CONCAT_IMPL(A, B) A##B
+#define SLIC3R_PROFILE_CONCAT(A, B) SLIC3R_PROFILE_CONCAT_IMPL(A, B)
+// Profile the enclosing scope. The name has to be a string literal or otherwise a string living until the profile is written.
+#define SLIC3R_PROFILE_ZONE(NAME) Slic3r::ProfileZone SLIC3R_PROFILE_CONCAT(slic3r_profile_zone_, __LINE__)(NAME)
+#define SLIC3R_PROFILE_FUNCTION() SLIC3R_PROFILE_ZONE(__FUNCTION__)
+
+#endif /* slic3r_Profiler_hpp_ */
@@ -49,8 +49,9 @@ float SLAAutoSupports::distance_limit(float angle) const
 }*/
 
 SLAAutoSupports::SLAAutoSupports(const TriangleMesh& mesh, const sla::EigenMesh3D& emesh, const std::vector<ExPolygons>& slices, const std::vector<float>& heights,
-                                   const Config& config, std::function<void(void)> throw_on_cancel, std::function<void(int)> statusfn)
-: m_config(config), m_emesh(emesh), m_throw_on_cancel(throw_on_cancel), m_statusfn(statusfn)
+                                   const Config& config, std::function<void(void)> throw_on_cancel, std::function<void(int)> statusfn,
+                                   IslandCache *island_cache)
+: m_config(config), m_island_cache(island_cache), m_emesh(emesh), m_throw_on_cancel(throw_on_cancel), m_statusfn(statusfn)
 {
     process(slices, heights);
     project_onto_mesh(m_output);
@@ -59,23 +60,26 @@ SLAAutoSupports::SLAAutoSupports(const TriangleMesh& mesh, const sla::EigenMesh3
 void SLAAutoSupports::project_onto_mesh(std::vector<sla::SupportPoint>& points) const
 {
     // The function  makes sure that all the points are really exactly placed on the mesh.
-    igl::Hit hit_up{0, 0, 0.f, 0.f, 0.f};
-    igl::Hit hit_down{0, 0, 0.f, 0.f, 0.f};
-
     // Use a reasonable granularity to account for the worker thread synchronization cost.
     tbb::parallel_for(tbb::blocked_range<size_t>(0, points.size(), 64),
         [this, &points](const tbb::blocked_range<size_t>& range) {
-            for (size_t point_id = range.begin(); point_id < range.end(); ++ point_id) {
-                if ((point_id % 16) == 0)
-                    // Don't call the following function too often as it flushes CPU write caches due to synchronization primitves.
-                    m_throw_on_cancel();
-                Vec3f& p = points[point_id].pos;
-                // Project the point upward and downward and choose the closer intersection with the mesh.
-                //bool up   = igl::ray_mesh_intersect(p.cast<float>(), Vec3f(0., 0., 1.), m_V, m_F, hit_up);
-                //bool down = igl::ray_mesh_intersect(p.cast<float>(), Vec3f(0., 0., -1.), m_V, m_F, hit_down);
-
-                sla::EigenMesh3D::hit_result hit_up   = m_emesh.query_ray_hit(p.cast<double>(), Vec3d(0., 0., 1.));
-                sla::EigenMesh3D::hit_result hit_down = m_emesh.query_ray_hit(p.cast<double>(), Vec3d(0., 0., -1.));
+            m_throw_on_cancel();
+            // Project the points upward and downward and choose the closer intersection with the mesh.
+            // The rays of the range are cast in batches, nearby points share the traversal of the mesh.
+            const size_t cnt = range.size();
+            std::vector<Vec3d> sources(cnt);
+            for (size_t i = 0; i < cnt; ++ i)
+                sources[i] = points[range.begin() + i].pos.cast<double>();
+            std::vector<Vec3d> dirs_up(cnt, Vec3d(0., 0., 1.));
+            std::vector<Vec3d> dirs_down(cnt, Vec3d(0., 0., -1.));
+            std::vector<sla::EigenMesh3D::hit_result> hits_up(cnt);
+            std::vector<sla::EigenMesh3D::hit_result> hits_down(cnt);
+            m_emesh.query_ray_hits(cnt, sources.data(), dirs_up.data(), hits_up.data());
+            m_emesh.query_ray_hits(cnt, sources.data(), dirs_down.data(), hits_down.data());
+
+            for (size_t i = 0; i < cnt; ++ i) {
+                const sla::EigenMesh3D::hit_result &hit_up   = hits_up[i];
+                const sla::EigenMesh3D::hit_result &hit_down = hits_down[i];
 
                 bool up   = hit_up.face() != -1;
                 bool down = hit_down.face() != -1;
@@ -83,11 +87,8 @@ void SLAAutoSupports::project_onto_mesh(std::vector<sla::SupportPoint>& points)
                 if (!up && !down)
                     continue;
 
-                sla::EigenMesh3D::hit_result& hit = (!down || (hit_up.distance() < hit_down.distance())) ? hit_up : hit_down;
-                //int fid = hit.face();
-                //Vec3f bc(1-hit.u-hit.v, hit.u, hit.v);
-                //p = (bc(0) * m_V.row(m_F(fid, 0)) + bc(1) * m_V.row(m_F(fid, 1)) + bc(2)*m_V.row(m_F(fid, 2))).cast<float>();
-
+                const sla::EigenMesh3D::hit_result& hit = (!down || (hit_up.distance() < hit_down.distance())) ? hit_up : hit_down;
+                Vec3f& p = points[range.begin() + i].pos;
                 p = p + (hit.distance() * hit.direction()).cast<float>();
             }
         });
@@ -192,7 +193,19 @@ void SLAAutoSupports::process(const std::vector<ExPolygons>& slices, const std::
     std::vector<std::pair<ExPolygon, coord_t>> islands;
 #endif /* SLA_AUTOSUPPORTS_DEBUG */
 
-    std::vector<SLAAutoSupports::MyLayer> layers = make_layers(slices, heights, m_throw_on_cancel);
+    IslandCache  local_cache;
+    IslandCache &cache = (m_island_cache != nullptr) ? *m_island_cache : local_cache;
+    if (cache.empty())
+        cache.layers = make_layers(slices, heights, m_throw_on_cancel);
+    else {
+        // The overlaps and overhangs are reused, only the support forces of a previous run are reset.
+        for (MyLayer &layer : cache.layers)
+            for (Structure &s : layer.islands) {
+                s.supports_force_this_layer = 0.f;
+                s.supports_force_inherited  = 0.f;
+            }
+    }
+    std::vector<SLAAutoSupports::MyLayer> &layers = cache.layers;
 
     PointGrid3D point_grid;
     point_grid.cell_size = Vec3f(10.f, 10.f, 10.f);
@@ -329,8 +342,10 @@ std::vector<Vec2f> sample_expolygon_with_boundary(const ExPolygons &expolys, flo
     return out;
 }
 
-template<typename REFUSE_FUNCTION>
-static inline std::vector<Vec2f> poisson_disk_from_samples(const std::vector<Vec2f> &raw_samples, float radius, REFUSE_FUNCTION refuse_function)
+// Obstacles are the support points placed before in the neighborhood: Their XY position and the squared vertical distance
+// to the sampled layer. A sample must not be closer to an obstacle than obstacle_radius (measured in 3D). The obstacles are
+// hashed into the same grid as the samples, so that a candidate sample is tested against both with a single set of lookups.
+static std::vector<Vec2f> poisson_disk_from_samples(const std::vector<Vec2f> &raw_samples, float radius, const std::vector<Vec3f> &obstacles, float obstacle_radius)
 {
     Vec2f corner_min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
     for (const Vec2f &pt : raw_samples) {
@@ -362,8 +377,12 @@ static inline std::vector<Vec2f> poisson_disk_from_samples(const std::vector<Vec
         int     num_poisson_samples = 0;
 
         // Index into raw_samples:
-        int     first_sample_idx;
-        int     sample_cnt;
+        int     first_sample_idx = 0;
+        int     sample_cnt       = 0;
+
+        // Index into obstacles_sorted:
+        int     first_obstacle_idx = 0;
+        int     obstacle_cnt       = 0;
     };
 
     struct CellIDHash {
@@ -398,6 +417,30 @@ static inline std::vector<Vec2f> poisson_disk_from_samples(const std::vector<Vec
         }
     }
 
+    // Assign the obstacles to the grid cells, creating the cells without raw samples as needed.
+    struct Obstacle {
+        Vec3f coord;
+        Vec2i cell_id;
+    };
+    std::vector<Obstacle> obstacles_sorted;
+    obstacles_sorted.reserve(obstacles.size());
+    for (const Vec3f &pt : obstacles) {
+        Obstacle obstacle;
+        obstacle.coord   = pt;
+        obstacle.cell_id = Vec2i(int(floor((pt.x() - corner_min.x()) / radius)), int(floor((pt.y() - corner_min.y()) / radius)));
+        obstacles_sorted.emplace_back(obstacle);
+    }
+    std::sort(obstacles_sorted.begin(), obstacles_sorted.end(), [](const Obstacle &lhs, const Obstacle &rhs)
+        { return lhs.cell_id.x() < rhs.cell_id.x() || (lhs.cell_id.x() == rhs.cell_id.x() && lhs.cell_id.y() < rhs.cell_id.y()); });
+    for (int i = 0; i < int(obstacles_sorted.size()); ++ i) {
+        PoissonDiskGridEntry &cell_data = cells[obstacles_sorted[i].cell_id];
+        if (cell_data.obstacle_cnt ++ == 0)
+            cell_data.first_obstacle_idx = i;
+    }
+    // Reach of the obstacles in grid cells.
+    const int   obstacle_cells = std::max(1, int(ceil(obstacle_radius / radius)));
+    const float obstacle_radius_squared = obstacle_radius * obstacle_radius;
+
     const int   max_trials = 5;
     const float radius_squared = radius * radius;
     for (int trial = 0; trial < max_trials; ++ trial) {
@@ -413,12 +456,22 @@ static inline std::vector<Vec2f> poisson_disk_from_samples(const std::vector<Vec
             const RawSample &candidate = raw_samples_sorted[next_sample_idx];
             // See if this point conflicts with any other points in this cell, or with any points in
             // neighboring cells.  Note that it's possible to have more than one point in the same cell.
-            bool conflict = refuse_function(candidate.coord);
-            for (int i = -1; i < 2 && ! conflict; ++ i) {
-                for (int j = -1; j < 2; ++ j) {
+            // The same holds for the obstacles.
+            bool conflict = false;
+            for (int i = - obstacle_cells; i <= obstacle_cells && ! conflict; ++ i) {
+                for (int j = - obstacle_cells; j <= obstacle_cells && ! conflict; ++ j) {
                     const auto &it_neighbor = cells.find(cell_id + Vec2i(i, j));
                     if (it_neighbor != cells.end()) {
                         const PoissonDiskGridEntry &neighbor = it_neighbor->second;
+                        for (int i_obstacle = 0; i_obstacle < neighbor.obstacle_cnt; ++ i_obstacle) {
+                            const Vec3f &obstacle = obstacles_sorted[neighbor.first_obstacle_idx + i_obstacle].coord;
+                            if ((Vec2f(obstacle.x(), obstacle.y()) - candidate.coord).squaredNorm() + obstacle.z() < obstacle_radius_squared) {
+                                conflict = true;
+                                break;
+                            }
+                        }
+                        if (std::abs(i) > 1 || std::abs(j) > 1)
+                            continue;
                         for (int i_sample = 0; i_sample < neighbor.num_poisson_samples; ++ i_sample)
                             if ((neighbor.poisson_samples[i_sample] - candidate.coord).squaredNorm() < radius_squared) {
                                 conflict = true;
@@ -469,11 +522,24 @@ void SLAAutoSupports::uniformly_cover(const ExPolygons& islands, Structure& stru
     std::mt19937        rng(rd());
 	std::vector<Vec2f>  raw_samples = sample_expolygon_with_boundary(islands, samples_per_mm2, 5.f / poisson_radius, rng);
     std::vector<Vec2f>  poisson_samples;
+    if (raw_samples.empty())
+        return;
+
+    // The support points placed before, which may collide with the new ones. They are fetched from the 3D grid once,
+    // the spacing only decreases with the iterations below.
+    std::vector<Vec3f>  obstacles;
+    {
+        Vec2f min = raw_samples.front();
+        Vec2f max = raw_samples.front();
+        for (const Vec2f &pt : raw_samples) {
+            min = min.cwiseMin(pt);
+            max = max.cwiseMax(pt);
+        }
+        obstacles = grid3d.points_near(min, max, &structure, min_spacing);
+    }
+
     for (size_t iter = 0; iter < 4; ++ iter) {
-        poisson_samples = poisson_disk_from_samples(raw_samples, poisson_radius, 
-            [&structure, &grid3d, min_spacing](const Vec2f &pos) {
-                return grid3d.collides_with(pos, &structure, min_spacing);
-            });
+        poisson_samples = poisson_disk_from_samples(raw_samples, poisson_radius, obstacles, min_spacing);
         if (poisson_samples.size() >= poisson_samples_target || m_config.minimal_distance > poisson_radius-EPSILON)
             break;
         float coeff = 0.5f;
@@ -23,12 +23,15 @@ public:
             inline float tear_pressure() const { return 1.f; }  // pressure that the display exerts    (the force unit per mm2)
         };
 
+	struct MyLayer;
+    struct IslandCache;
+
+    // If island_cache is given, the islands of the slices are taken from it or stored into it.
     SLAAutoSupports(const TriangleMesh& mesh, const sla::EigenMesh3D& emesh, const std::vector<ExPolygons>& slices,
-                     const std::vector<float>& heights, const Config& config, std::function<void(void)> throw_on_cancel, std::function<void(int)> statusfn);
+                     const std::vector<float>& heights, const Config& config, std::function<void(void)> throw_on_cancel, std::function<void(int)> statusfn,
+                     IslandCache *island_cache = nullptr);
     const std::vector<sla::SupportPoint>& output() { return m_output; }
 
-	struct MyLayer;
-
     struct Structure {
         Structure(MyLayer &layer, const ExPolygon& poly, const BoundingBox &bbox, const Vec2f &centroid, float area, float h) : 
             layer(&layer), polygon(&poly), bbox(bbox), centroid(centroid), area(area), height(h)
@@ -72,7 +75,7 @@ public:
         ExPolygons                              overhangs;
         // Overhangs, where the surface must slope.
         ExPolygons                              overhangs_slopes;
-        float                                   overhangs_area;
+        float                                   overhangs_area = 0.f;
 
         bool overlaps(const Structure &rhs) const { 
             return this->bbox.overlap(rhs.bbox) && (this->polygon->overlaps(*rhs.polygon) || rhs.polygon->overlaps(*this->polygon)); 
@@ -122,6 +125,20 @@ public:
         std::vector<Structure>  islands;
     };
 
+    // The islands of the layers linked by their overlaps, with their overhangs. They only depend on the slices,
+    // so the caller may keep them for another run over the same slices, e.g. with a different support point density.
+    // The islands point into the slices, the cache has to be cleared whenever the slices change.
+    struct IslandCache {
+        IslandCache() = default;
+        IslandCache(const IslandCache&) = delete;
+        IslandCache& operator=(const IslandCache&) = delete;
+
+        bool empty() const { return layers.empty(); }
+        void clear() { layers.clear(); }
+
+        std::vector<MyLayer> layers;
+    };
+
     struct RichSupportPoint {
         Vec3f        position;
         Structure   *island;
@@ -151,6 +168,30 @@ public:
             grid.emplace(cell_id(pt.position), pt);
         }
 
+        // Collect the points, which may collide with a point inside the rectangle [min, max] at the height of the island,
+        // as their XY position and the squared vertical distance. The cells searched by collides_with() for all the points
+        // of the rectangle are visited once.
+        std::vector<Vec3f> points_near(const Vec2f &min, const Vec2f &max, Structure *island, float radius) {
+            std::vector<Vec3f> out;
+            const float z       = float(island->layer->print_z);
+            const Vec3i cell_lo = cell_id(Vec3f(min.x(), min.y(), z)) - Vec3i(1, 1, 1);
+            const Vec3i cell_hi = cell_id(Vec3f(max.x(), max.y(), z)) + Vec3i(1, 1, 0);
+            for (int i = cell_lo.x(); i <= cell_hi.x(); ++ i)
+                for (int j = cell_lo.y(); j <= cell_hi.y(); ++ j)
+                    for (int k = cell_lo.z(); k <= cell_hi.z(); ++ k) {
+                        std::pair<Grid::const_iterator, Grid::const_iterator> it_pair = grid.equal_range(Vec3i(i, j, k));
+                        for (Grid::const_iterator it = it_pair.first; it != it_pair.second; ++ it) {
+                            const Vec3f &pos = it->second.position;
+                            float dz2 = (pos.z() - z) * (pos.z() - z);
+                            float dx  = std::max(0.f, std::max(min.x() - pos.x(), pos.x() - max.x()));
+                            float dy  = std::max(0.f, std::max(min.y() - pos.y(), pos.y() - max.y()));
+                            if (dx * dx + dy * dy + dz2 < radius * radius)
+                                out.emplace_back(pos.x(), pos.y(), dz2);
+                        }
+                    }
+            return out;
+        }
+
         bool collides_with(const Vec2f &pos, Structure *island, float radius) {
             Vec3f pos3d(pos.x(), pos.y(), float(island->layer->print_z));
             Vec3i cell = cell_id(pos3d);
@@ -187,6 +228,8 @@ private:
 
     float m_supports_force_total = 0.f;
 
+    IslandCache *m_island_cache = nullptr;
+
     void process(const std::vector<ExPolygons>& slices, const std::vector<float>& heights);
     void uniformly_cover(const ExPolygons& islands, Structure& structure, PointGrid3D &grid3d, bool is_new_island = false, bool just_one = false);
     void project_onto_mesh(std::vector<sla::SupportPoint>& points) const;
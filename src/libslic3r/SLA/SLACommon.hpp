@@ -123,6 +123,15 @@ public:
     // Casting a ray on the mesh, returns the distance where the hit occures.
     hit_result query_ray_hit(const Vec3d &s, const Vec3d &dir) const;
 
+    // Casting n rays at once. The rays are traced through the mesh in packets
+    // of consecutive rays, which is faster than casting them one by one if
+    // the neighboring rays start close to each other and have similar
+    // directions.
+    void query_ray_hits(size_t n,
+                        const Vec3d *sources,
+                        const Vec3d *dirs,
+                        hit_result *hits) const;
+
     class si_result {
         double m_value;
         int m_fidx;
@@ -2,6 +2,7 @@
 #define SLARASTER_CPP
 
 #include <functional>
+#include <algorithm>
 
 #include "SLARaster.hpp"
 #include "libslic3r/ExPolygon.hpp"
@@ -32,6 +33,43 @@ inline const ClipperLib::Paths& holes(const ClipperLib::Polygon& p) { return p.H
 
 namespace sla {
 
+namespace {
+
+mz_bool png_put_buf(const void *buf, int len, void *user)
+{
+    auto out = static_cast<std::vector<std::uint8_t>*>(user);
+    auto ptr = static_cast<const std::uint8_t*>(buf);
+    out->insert(out->end(), ptr, ptr + len);
+    return MZ_TRUE;
+}
+
+void png_put_u32(std::vector<std::uint8_t>& out, mz_uint32 v)
+{
+    out.push_back(std::uint8_t(v >> 24)); out.push_back(std::uint8_t(v >> 16));
+    out.push_back(std::uint8_t(v >> 8));  out.push_back(std::uint8_t(v));
+}
+
+void png_begin_chunk(std::vector<std::uint8_t>& out, const char *type)
+{
+    png_put_u32(out, 0);
+    out.insert(out.end(), type, type + 4);
+}
+
+// Finish the PNG chunk started at chunk_start by png_begin_chunk(): Fill in
+// the length of its data and append the CRC.
+void png_end_chunk(std::vector<std::uint8_t>& out, size_t chunk_start)
+{
+    auto len = mz_uint32(out.size() - chunk_start - 8);
+    for(int i = 0; i < 4; ++i)
+        out[chunk_start + size_t(i)] = std::uint8_t(len >> (24 - 8 * i));
+
+    auto crc = mz_uint32(mz_crc32(MZ_CRC32_INIT, out.data() + chunk_start + 4,
+                                  len + 4));
+    png_put_u32(out, crc);
+}
+
+}
+
 class Raster::Impl {
 public:
     using TPixelRenderer = agg::pixfmt_gray8; // agg::pixfmt_rgb24;
@@ -48,11 +86,19 @@ public:
 
     using Format = Raster::Format;
 
+    // A run of pixels of the same gray value on a single row. The pixels not
+    // covered by any run are black.
+    struct Run {
+        unsigned x;
+        unsigned len;
+        std::uint8_t value;
+    };
+
 private:
     Raster::Resolution m_resolution;
-//    Raster::PixelDim m_pxdim;
+    Raster::PixelDim m_pxdim;
     Raster::PixelDim m_pxdim_scaled;    // used for scaled coordinate polygons
-    TBuffer m_buf;
+    TBuffer m_buf;                      // empty with the RLE format
     TRawBuffer m_rbuf;
     TPixelRenderer m_pixfmt;
     TRawRenderer m_raw_renderer;
@@ -61,6 +107,13 @@ private:
     std::function<double(double)> m_gammafn;
     std::array<bool, 2> m_mirror;
     Format m_fmt = Format::PNG;
+
+    // With the RLE format, the paths of all the drawn polygons are collected
+    // and swept into runs on demand, no full frame buffer is allocated.
+    agg::path_storage m_paths;
+    std::vector<Run> m_runs;
+    std::vector<size_t> m_row_start;    // first run of each row, height + 1 items
+    bool m_runs_valid = false;
     
     inline void flipy(agg::path_storage& path) const {
         path.flip_y(0, m_resolution.height_px);
@@ -73,18 +126,20 @@ private:
 public:
 
     inline Impl(const Raster::Resolution& res, const Raster::PixelDim &pd,
-                const std::array<bool, 2>& mirror, double gamma = 1.0):
+                const std::array<bool, 2>& mirror, Format fmt, 
+                double gamma = 1.0):
         m_resolution(res), 
-//        m_pxdim(pd), 
+        m_pxdim(pd), 
         m_pxdim_scaled(SCALING_FACTOR / pd.w_mm, SCALING_FACTOR / pd.h_mm),
-        m_buf(res.pixels()),
+        m_buf(fmt == Format::RLE ? 0 : res.pixels()),
         m_rbuf(reinterpret_cast<TPixelRenderer::value_type*>(m_buf.data()),
               res.width_px, res.height_px,
               int(res.width_px*TPixelRenderer::num_components)),
         m_pixfmt(m_rbuf),
         m_raw_renderer(m_pixfmt),
         m_renderer(m_raw_renderer),
-        m_mirror(mirror)
+        m_mirror(mirror),
+        m_fmt(fmt)
     {
         m_renderer.color(ColorWhite);
         
@@ -93,45 +148,238 @@ public:
         
         clear();
     }
+
+    inline Impl(const Raster::Resolution& res, const Raster::PixelDim &pd,
+                const std::array<bool, 2>& mirror, double gamma = 1.0):
+        Impl(res, pd, mirror, Format::PNG, gamma) {}
     
     inline Impl(const Raster::Resolution& res, 
                 const Raster::PixelDim &pd,
                 Format fmt, 
                 double gamma = 1.0): 
-        Impl(res, pd, {false, false}, gamma) 
+        Impl(res, pd, {false, false}, fmt, gamma) 
     {
         switch (fmt) {
-        case Format::PNG: m_mirror = {false, true}; break;
+        case Format::PNG: 
+        case Format::RLE: m_mirror = {false, true}; break;
         case Format::RAW: m_mirror = {false, false}; break;
         }
-        m_fmt = fmt;
     }
 
     template<class P> void draw(const P &poly) {
+        if(m_fmt == Format::RLE) {
+            for_each_path(poly, [this](agg::path_storage& path) {
+                m_paths.concat_path(path);
+            });
+            m_runs_valid = false;
+            return;
+        }
+
         agg::rasterizer_scanline_aa<> ras;
         agg::scanline_p8 scanlines;
         
         ras.gamma(m_gammafn);
 
-        auto&& path = to_path(contour(poly));
-        
-        if(m_mirror[X]) flipx(path);
-        if(m_mirror[Y]) flipy(path);
+        for_each_path(poly, [&ras](agg::path_storage& path) {
+            ras.add_path(path);
+        });
 
-        ras.add_path(path);
+        agg::render_scanlines(ras, scanlines, m_renderer);
+    }
 
-        for(auto& h : holes(poly)) {
-            auto&& holepath = to_path(h);
-            if(m_mirror[X]) flipx(holepath);
-            if(m_mirror[Y]) flipy(holepath);
-            ras.add_path(holepath);
+    inline void clear() {
+        if(m_fmt == Format::RLE) {
+            m_paths.remove_all();
+            m_runs.clear();
+            m_row_start.assign(m_resolution.height_px + 1, 0);
+            m_runs_valid = true;
+        } 
+        else m_raw_renderer.clear(ColorBlack);
+    }
+
+    // Sweep the collected paths into runs. All the polygons of the layer are
+    // rasterized at once with the non-zero fill rule, thus the overlapping
+    // polygons are merged instead of being blended over each other.
+    void sweep_runs() {
+        if(m_runs_valid) return;
+
+        const int w = int(m_resolution.width_px);
+        const int h = int(m_resolution.height_px);
+
+        m_runs.clear();
+        m_row_start.assign(size_t(h) + 1, 0);
+
+        agg::rasterizer_scanline_aa<> ras;
+        agg::scanline_p8 sl;
+
+        ras.gamma(m_gammafn);
+        ras.clip_box(0, 0, w, h);
+        ras.add_path(m_paths);
+
+        int next_row = 0;
+        auto add_run = [this, w, &next_row](int x, int len, std::uint8_t v) {
+            if(v == 0) return;
+            if(x < 0) { len += x; x = 0; }
+            if(x + len > w) len = w - x;
+            if(len <= 0) return;
+
+            // Merge with the previous run of the same row if possible.
+            if(m_runs.size() > m_row_start[size_t(next_row - 1)]) {
+                Run& last = m_runs.back();
+                if(last.value == v && last.x + last.len == unsigned(x)) {
+                    last.len += unsigned(len);
+                    return;
+                }
+            }
+
+            m_runs.push_back({unsigned(x), unsigned(len), v});
+        };
+
+        if(ras.rewind_scanlines()) {
+            sl.reset(ras.min_x(), ras.max_x());
+            while(ras.sweep_scanline(sl)) {
+                int y = sl.y();
+                if(y < next_row || y >= h) continue;
+
+                for(; next_row <= y; ++next_row)
+                    m_row_start[size_t(next_row)] = m_runs.size();
+
+                auto span = sl.begin();
+                for(unsigned n = sl.num_spans(); n > 0; --n, ++span) {
+                    if(span->len < 0)
+                        add_run(span->x, -span->len, *span->covers);
+                    else for(int i = 0; i < span->len; ++i)
+                        add_run(span->x + i, 1, span->covers[i]);
+                }
+            }
         }
 
-        agg::render_scanlines(ras, scanlines, m_renderer);
+        for(; next_row <= h; ++next_row)
+            m_row_start[size_t(next_row)] = m_runs.size();
+
+        m_runs_valid = true;
     }
 
-    inline void clear() {
-        m_raw_renderer.clear(ColorBlack);
+    // Expand a single row of the raster into gray pixels.
+    void expand_row(unsigned y, std::uint8_t *row) {
+        if(m_fmt == Format::RLE) {
+            sweep_runs();
+            std::fill(row, row + m_resolution.width_px, std::uint8_t(0));
+            for(size_t i = m_row_start[y]; i < m_row_start[y + 1]; ++i) {
+                const Run& r = m_runs[i];
+                std::fill(row + r.x, row + r.x + r.len, r.value);
+            }
+        } else {
+            auto src = reinterpret_cast<const std::uint8_t*>(m_buf.data()) + 
+                       size_t(y) * m_resolution.width_px;
+            std::copy(src, src + m_resolution.width_px, row);
+        }
+    }
+
+    // Feed the runs of the whole raster in row major order to the visitor 
+    // including the black runs. Adjacent runs may have the same value.
+    template<class Fn> void visit_runs(Fn &&fn) {
+        const unsigned w = m_resolution.width_px;
+        const unsigned h = m_resolution.height_px;
+        if(m_fmt == Format::RLE) {
+            sweep_runs();
+            for(unsigned y = 0; y < h; ++y) {
+                unsigned x = 0;
+                for(size_t i = m_row_start[y]; i < m_row_start[y + 1]; ++i) {
+                    const Run& r = m_runs[i];
+                    if(r.x > x) fn(std::uint8_t(0), r.x - x);
+                    fn(r.value, r.len);
+                    x = r.x + r.len;
+                }
+                if(x < w) fn(std::uint8_t(0), w - x);
+            }
+        } else {
+            auto px = reinterpret_cast<const std::uint8_t*>(m_buf.data());
+            size_t n = m_buf.size();
+            for(size_t i = 0; i < n;) {
+                size_t j = i + 1;
+                while(j < n && px[j] == px[i]) ++j;
+                fn(px[i], unsigned(j - i));
+                i = j;
+            }
+        }
+    }
+
+    // Encode a gray PNG row by row, so that the raster does not have to be
+    // expanded into a full frame. The deflate compressor only looks for runs
+    // (matches with a distance of 1), which is much faster than the default
+    // compression level and it compresses the mostly black or white masked
+    // layers just as well.
+    std::vector<std::uint8_t> encode_png() {
+        const unsigned w = m_resolution.width_px, h = m_resolution.height_px;
+        std::vector<std::uint8_t> out;
+
+        static const std::uint8_t signature[] = { 
+            0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a };
+        out.insert(out.end(), std::begin(signature), std::end(signature));
+
+        size_t chunk = out.size();
+        png_begin_chunk(out, "IHDR");
+        png_put_u32(out, w);
+        png_put_u32(out, h);
+        // bit depth 8, gray, deflate, adaptive filtering, no interlace
+        static const std::uint8_t ihdr[] = { 8, 0, 0, 0, 0 };
+        out.insert(out.end(), std::begin(ihdr), std::end(ihdr));
+        png_end_chunk(out, chunk);
+
+        chunk = out.size();
+        png_begin_chunk(out, "IDAT");
+
+        std::unique_ptr<tdefl_compressor, void(*)(tdefl_compressor*)> 
+            comp(tdefl_compressor_alloc(), tdefl_compressor_free);
+        if(!comp) return {};
+
+        tdefl_init(comp.get(), png_put_buf, &out, 
+                   TDEFL_RLE_MATCHES | TDEFL_WRITE_ZLIB_HEADER | 1);
+
+        // A leading zero byte selects no filtering for each row.
+        std::vector<std::uint8_t> row(size_t(w) + 1, 0);
+        for(unsigned y = 0; y < h; ++y) {
+            expand_row(y, row.data() + 1);
+            tdefl_compress_buffer(comp.get(), row.data(), row.size(), TDEFL_NO_FLUSH);
+        }
+
+        if(tdefl_compress_buffer(comp.get(), nullptr, 0, TDEFL_FINISH) != 
+                TDEFL_STATUS_DONE) return {};
+
+        png_end_chunk(out, chunk);
+
+        chunk = out.size();
+        png_begin_chunk(out, "IEND");
+        png_end_chunk(out, chunk);
+
+        return out;
+    }
+
+    // Serialize the raster into the RLE format, see SLARaster.hpp
+    std::vector<std::uint8_t> encode_rle() {
+        const unsigned w = m_resolution.width_px, h = m_resolution.height_px;
+        std::string header = std::string("RLE8 ") + std::to_string(w) + " " + 
+                             std::to_string(h) + "\n";
+
+        std::vector<std::uint8_t> out(header.begin(), header.end());
+
+        std::uint8_t value = 0; size_t len = 0;
+        auto flush = [&out, &value, &len]() {
+            if(len == 0) return;
+            out.push_back(value);
+            for(; len >= 0x80; len >>= 7) out.push_back(std::uint8_t(len | 0x80));
+            out.push_back(std::uint8_t(len));
+            len = 0;
+        };
+
+        visit_runs([&](std::uint8_t v, unsigned n) {
+            if(v != value) { flush(); value = v; }
+            len += n;
+        });
+        flush();
+
+        return out;
     }
 
     inline TBuffer& buffer()  { return m_buf; }
@@ -141,6 +389,23 @@ public:
     inline const Raster::Resolution resolution() { return m_resolution; }
    
 private:
+    // Call fn with the mirrored paths of the contour and of the holes.
+    template<class P, class Fn> void for_each_path(const P &poly, Fn &&fn) {
+        auto&& path = to_path(contour(poly));
+        
+        if(m_mirror[X]) flipx(path);
+        if(m_mirror[Y]) flipy(path);
+
+        fn(path);
+
+        for(auto& h : holes(poly)) {
+            auto&& holepath = to_path(h);
+            if(m_mirror[X]) flipx(holepath);
+            if(m_mirror[Y]) flipy(holepath);
+            fn(holepath);
+        }
+    }
+
     inline double getPx(const Point& p) {
         return p(0) * m_pxdim_scaled.w_mm;
     }
@@ -207,6 +472,13 @@ void Raster::reset(const Raster::Resolution &r, const Raster::PixelDim &pd,
     m_impl.reset(new Impl(r, pd, mirror, gamma));
 }
 
+void Raster::reset(const Raster::Resolution &r, const Raster::PixelDim &pd,
+                   const std::array<bool, 2>& mirror, Format fmt, double gamma)
+{
+    m_impl.reset();
+    m_impl.reset(new Impl(r, pd, mirror, fmt, gamma));
+}
+
 void Raster::reset()
 {
     m_impl.reset();
@@ -240,7 +512,15 @@ void Raster::save(std::ostream& stream, Format fmt)
     assert(m_impl);
     if(!stream.good()) return;
 
+    if(fmt == Format::RLE || m_impl->format() == Format::RLE) {
+        RawBytes bytes = save(fmt);
+        stream.write(reinterpret_cast<const char*>(bytes.data()),
+                     std::streamsize(bytes.size()));
+        return;
+    }
+
     switch(fmt) {
+    case Format::RLE: break;
     case Format::PNG: {
         auto& b = m_impl->buffer();
         size_t out_len = 0;
@@ -281,8 +561,27 @@ RawBytes Raster::save(Format fmt)
     assert(m_impl);
 
     std::vector<std::uint8_t> data; size_t s = 0;
+    
+    const unsigned w = resolution().width_px, h = resolution().height_px;
+
+    if(fmt == Format::RLE) return {m_impl->encode_rle()};
+
+    if(m_impl->format() == Format::RLE) {
+        // The pixels are only expanded from the runs here, row by row.
+        if(fmt == Format::PNG) return {m_impl->encode_png()};
+
+        auto header = std::string("P5 ") + std::to_string(w) + " " +
+                      std::to_string(h) + " " + "255 ";
+        data.resize(header.size() + size_t(w) * h);
+        std::copy(header.begin(), header.end(), data.begin());
+        for(unsigned y = 0; y < h; ++y)
+            m_impl->expand_row(y, data.data() + header.size() + size_t(y) * w);
+        
+        return {std::move(data)};
+    }
 
     switch(fmt) {
+    case Format::RLE: break;
     case Format::PNG: {
         void *rawdata = tdefl_write_image_to_png_file_in_memory(
                     m_impl->buffer().data(),
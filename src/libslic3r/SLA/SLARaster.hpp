@@ -54,6 +54,10 @@ public:
  *
  * It also supports saving the raster data into a standard output stream in raw
  * or PNG format.
+ *
+ * With the RLE format, the polygons are rasterized straight into runs of
+ * pixels instead of a full frame buffer. The runs are saved as they are, the
+ * PNG and raw outputs are expanded from the runs on demand.
  */
 class Raster {
     class Impl;
@@ -63,7 +67,8 @@ public:
     /// Supported compression types
     enum class Format {
         RAW,    //!> Uncompressed pixel data
-        PNG     //!> PNG compression
+        PNG,    //!> PNG compression
+        RLE     //!> Run-length encoded pixel data
     };
 
     /// Type that represents a resolution in pixels.
@@ -110,6 +115,13 @@ public:
                const PixelDim& pd, 
                Format o, 
                double gamma = 1.0);
+
+    /// Mirroring given explicitly along with the format of the raster.
+    void reset(const Resolution&, 
+               const PixelDim&, 
+               const std::array<bool, 2>& mirror, 
+               Format o,
+               double gamma = 1.0);
     
     /**
      * Release the allocated resources. Drawing in this state ends in
@@ -131,6 +143,10 @@ public:
     // It is possible to override the format given in the constructor but
     // be aware that the mirroring will not be modified.
     
+    // The RLE format is "RLE8 <width> <height>\n" followed by the runs in row
+    // major order, each run being its gray value followed by its length as
+    // a LEB128 varint.
+
     /// Save the raster on the specified stream.
     void save(std::ostream& stream, Format);
     void save(std::ostream& stream);
@@ -3,8 +3,16 @@
 #include "ExPolygon.hpp"
 #include <libnest2d/backends/clipper/clipper_polygon.hpp>
 
+#include <cstdio>
+#include <memory>
+
 #include <boost/log/trivial.hpp>
+#include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
+#include <boost/nowide/cstdio.hpp>
+
+#include <tbb/pipeline.h>
+#include <tbb/task_scheduler_init.h>
 
 namespace Slic3r { namespace sla {
 
@@ -87,7 +95,36 @@ SLARasterWriter::SLARasterWriter(const SLAPrinterConfig &cfg,
     m_gamma = cfg.gamma_correction.getFloat();
 }
 
-void SLARasterWriter::save(const std::string &fpath, const std::string &prjname)
+SLARasterWriter::~SLARasterWriter()
+{
+    if(!m_cache_path.empty()) {
+        boost::system::error_code ec;
+        boost::filesystem::remove(m_cache_path, ec);
+    }
+}
+
+namespace {
+
+std::string layer_file_name(const std::string& project, unsigned id)
+{
+    char lyrnum[6];
+    std::sprintf(lyrnum, "%.5d", id);
+    return project + lyrnum + ".png";
+}
+
+struct FileCloser {
+    void operator()(FILE* f) const { if(f) std::fclose(f); }
+};
+using FilePtr = std::unique_ptr<FILE, FileCloser>;
+
+}
+
+void SLARasterWriter::save(const std::string &fpath, 
+                           const std::string &prjname,
+                           unsigned layer_cnt,
+                           const DrawLayerFn &draw_layer,
+                           std::function<void(unsigned)> statuscb,
+                           std::function<void(void)> throw_on_cancel)
 {
     try {
         Zipper zipper(fpath); // zipper with no compression
@@ -99,23 +136,123 @@ void SLARasterWriter::save(const std::string &fpath, const std::string &prjname)
         
         zipper << createIniContent(project);
         
-        for(unsigned i = 0; i < m_layers_rst.size(); i++)
-        {
-            if(m_layers_rst[i].rawbytes.size() > 0) {
-                char lyrnum[6];
-                std::sprintf(lyrnum, "%.5d", i);
-                auto zfilename = project + lyrnum + ".png";
-                
-                // Add binary entry to the zipper
-                zipper.add_entry(zfilename,
-                                 m_layers_rst[i].rawbytes.data(),
-                                 m_layers_rst[i].rawbytes.size());
+        FilePtr cache;
+        if(layer_cnt > 0 && m_cached_layers.size() == layer_cnt)
+            cache.reset(boost::nowide::fopen(m_cache_path.c_str(), "rb"));
+        
+        if(cache) {
+            // Copy the images encoded by the previous save().
+            std::vector<std::uint8_t> buf;
+            for(unsigned id = 0; id < layer_cnt; ++id) {
+                throw_on_cancel();
+                buf.resize(m_cached_layers[id]);
+                if(std::fread(buf.data(), 1, buf.size(), cache.get()) != 
+                        buf.size())
+                    throw std::runtime_error("Cannot read the rasterized "
+                                             "layers from " + m_cache_path);
+                zipper.add_entry(layer_file_name(project, id), buf.data(),
+                                 buf.size());
             }
+            zipper.finalize();
+            return;
+        }
+        
+        // The images are written into a new cache file as well. Failing to
+        // write it only means the layers are rasterized again next time.
+        if(!m_cache_path.empty()) {
+            boost::system::error_code ec;
+            boost::filesystem::remove(m_cache_path, ec);
         }
+        m_cached_layers.clear();
+        {
+            boost::system::error_code ec;
+            boost::filesystem::path dir = 
+                    boost::filesystem::temp_directory_path(ec);
+            m_cache_path = ec ? std::string() : (dir / 
+                boost::filesystem::unique_path("sla_layers-%%%%-%%%%.tmp", ec))
+                    .string();
+            if(!ec && !m_cache_path.empty())
+                cache.reset(boost::nowide::fopen(m_cache_path.c_str(), "wb"));
+            if(!cache) m_cache_path.clear();
+        }
+        // A layer flowing through the pipeline: Its raster is allocated,
+        // drawn and compressed in parallel, and released right away.
+        // The filters pass their items by value, while RawBytes is not
+        // copyable, therefore the layers are passed by shared pointers.
+        struct EncodedLayer {
+            unsigned id = 0;
+            RawBytes rawbytes;
+        };
+        using EncodedLayerPtr = std::shared_ptr<EncodedLayer>;
+        
+        unsigned next_layer = 0;
+        auto source = tbb::make_filter<void, EncodedLayerPtr>(
+            tbb::filter::serial_in_order,
+            [&next_layer, layer_cnt, &throw_on_cancel](tbb::flow_control &fc) {
+                EncodedLayerPtr lyr;
+                if(next_layer == layer_cnt) fc.stop();
+                else {
+                    // Throwing here stops the pipeline, the layers in flight
+                    // are dropped.
+                    throw_on_cancel();
+                    lyr = std::make_shared<EncodedLayer>();
+                    lyr->id = next_layer++;
+                }
+                return lyr;
+            });
+        
+        auto encode = tbb::make_filter<EncodedLayerPtr, EncodedLayerPtr>(
+            tbb::filter::parallel,
+            [this, &draw_layer](EncodedLayerPtr lyr) {
+                Raster raster;
+                raster.reset(m_res, m_pxdim, m_mirror, Raster::Format::RLE,
+                             m_gamma);
+                draw_layer(raster, lyr->id);
+                lyr->rawbytes = raster.save(Raster::Format::PNG);
+                return lyr;
+            });
+        
+        unsigned layers_written = 0, last_status = 0;
+        auto write = tbb::make_filter<EncodedLayerPtr, void>(
+            tbb::filter::serial_in_order,
+            [this, &zipper, &project, &layers_written, &last_status, layer_cnt,
+             &statuscb, &cache](EncodedLayerPtr lyr) {
+                // Add binary entry to the zipper
+                zipper.add_entry(layer_file_name(project, lyr->id),
+                                 lyr->rawbytes.data(),
+                                 lyr->rawbytes.size());
+                
+                if(cache) {
+                    size_t sz = lyr->rawbytes.size();
+                    if(std::fwrite(lyr->rawbytes.data(), 1, sz, cache.get()) 
+                            == sz)
+                        m_cached_layers.emplace_back(sz);
+                    else cache.reset();
+                }
+                
+                unsigned st = unsigned(100 * ++layers_written / layer_cnt);
+                if(st > last_status) statuscb(last_status = st);
+            });
+        
+        // The number of layers in flight bounds the memory held by the
+        // rasters and the compressed layers waiting for their predecessors.
+        size_t max_layers_in_flight = size_t(
+            2 * tbb::task_scheduler_init::default_num_threads());
+        
+        tbb::parallel_pipeline(max_layers_in_flight, source & encode & write);
         
         zipper.finalize();
+        
+        if(!cache || std::fclose(cache.release()) != 0) 
+            m_cached_layers.clear();
     } catch(std::exception& e) {
         BOOST_LOG_TRIVIAL(error) << e.what();
+        // A partially written cache is not reused.
+        if(m_cached_layers.size() != layer_cnt) m_cached_layers.clear();
+        // The zipper has already been destructed, don't leave an archive
+        // with a part of the layers behind.
+        boost::system::error_code ec;
+        boost::filesystem::remove(fpath, ec);
         // Rethrow the exception
         throw;
     }
@@ -6,6 +6,7 @@
 #include <sstream>
 #include <vector>
 #include <array>
+#include <functional>
 
 #include "libslic3r/PrintConfig.hpp"
 
@@ -14,12 +15,14 @@
 namespace Slic3r { namespace sla {
 
 // Implementation for PNG raster output
-// Be aware that if a large number of layers are allocated, it can very well
-// exhaust the available memory especially on 32 bit platform.
-// This class is designed to be used in parallel mode. Layers have an ID and
-// each layer can be written and compressed independently (in parallel).
-// At the end when all layers where written, the save method can be used to 
-// write out the result into a zipped archive.
+// The layers are rasterized and compressed when the archive is being saved.
+// This is done in parallel, while the compressed layers are written into the
+// zipped archive in order as soon as they are ready. Only a bounded window of
+// layers is kept in memory, therefore the memory consumption depends on the
+// number of threads and not on the number of layers. The layers are drawn
+// into run-length encoded rasters, from which the PNG images are encoded.
+// The PNG images are kept in a temporary file, from which the following
+// exports copy them instead of rasterizing the layers again.
 class SLARasterWriter
 {
 public:
@@ -41,32 +44,6 @@ public:
     
 private:
     
-    // A struct to bind the raster image data and its compressed bytes together.
-    struct Layer {
-        Raster raster;
-        RawBytes rawbytes;
-
-        Layer() = default;
-        Layer(const Layer&) = delete; // The image is big, do not copy by accident
-        Layer& operator=(const Layer&) = delete;
-        
-        // /////////////////////////////////////////////////////////////////////
-        // FIXME: the following is needed for MSVC2013 compatibility
-        // /////////////////////////////////////////////////////////////////////
-
-        // Layer(Layer&& m) = default;
-        // Layer& operator=(Layer&&) = default;
-        Layer(Layer &&m):
-            raster(std::move(m.raster)), rawbytes(std::move(m.rawbytes)) {}
-        Layer& operator=(Layer &&m) {
-            raster = std::move(m.raster); rawbytes = std::move(m.rawbytes);
-            return *this;
-        }
-    };
-
-    // We will save the compressed PNG data into RawBytes type buffers in 
-    // parallel. Later we can write every layer to the disk sequentially.
-    std::vector<Layer> m_layers_rst;
     Raster::Resolution m_res;
     Raster::PixelDim m_pxdim;
     double m_exp_time_s = .0, m_exp_time_first_s = .0;
@@ -81,6 +58,12 @@ private:
     int    m_cnt_slow_layers = 0;
     int    m_cnt_fast_layers = 0;
 
+    // Temporary file with the PNG images of the layers encoded by the first
+    // save() one after another, and the size of each image. The writer is
+    // recreated whenever the rasterization is invalidated.
+    std::string m_cache_path;
+    std::vector<size_t> m_cached_layers;
+
     std::string createIniContent(const std::string& projectname) const;
     
     static void flpXY(ClipperLib::Polygon& poly);
@@ -94,6 +77,7 @@ public:
 
     SLARasterWriter(const SLARasterWriter& ) = delete;
     SLARasterWriter& operator=(const SLARasterWriter&) = delete;
+    ~SLARasterWriter();
 
     // /////////////////////////////////////////////////////////////////////////
     // FIXME: the following is needed for MSVC2013 compatibility
@@ -102,7 +86,6 @@ public:
     // SLARasterWriter(SLARasterWriter&& m) = default;
     // SLARasterWriter& operator=(SLARasterWriter&&) = default;
     SLARasterWriter(SLARasterWriter&& m):
-        m_layers_rst(std::move(m.m_layers_rst)),
         m_res(m.m_res),
         m_pxdim(m.m_pxdim),
         m_exp_time_s(m.m_exp_time_s),
@@ -114,49 +97,40 @@ public:
         m_used_material(m.m_used_material),
         m_cnt_fade_layers(m.m_cnt_fade_layers),
         m_cnt_slow_layers(m.m_cnt_slow_layers),
-        m_cnt_fast_layers(m.m_cnt_fast_layers)
-    {}
+        m_cnt_fast_layers(m.m_cnt_fast_layers),
+        m_cache_path(std::move(m.m_cache_path)),
+        m_cached_layers(std::move(m.m_cached_layers))
+    {
+        m.m_cache_path.clear();
+        m.m_cached_layers.clear();
+    }
 
     // /////////////////////////////////////////////////////////////////////////
 
-    inline void layers(unsigned cnt) { if(cnt > 0) m_layers_rst.resize(cnt); }
-    inline unsigned layers() const { return unsigned(m_layers_rst.size()); }
-    
-    template<class Poly> void draw_polygon(const Poly& p, unsigned lyr) {
-        assert(lyr < m_layers_rst.size());
+    // Draws the polygons of a single layer into the raster using draw_polygon().
+    // Called in parallel for the layers.
+    using DrawLayerFn = std::function<void(Raster& raster, unsigned lyr)>;
+
+    template<class Poly> void draw_polygon(const Poly& p, Raster& raster) const {
         if(m_o == roPortrait) {
             Poly poly(p); flpXY(poly);
-            m_layers_rst[lyr].raster.draw(poly);
-        }
-        else m_layers_rst[lyr].raster.draw(p);
-    }
-
-    inline void begin_layer(unsigned lyr) {
-        if(m_layers_rst.size() <= lyr) m_layers_rst.resize(lyr+1);
-        m_layers_rst[lyr].raster.reset(m_res, m_pxdim, m_mirror, m_gamma);
-    }
-
-    inline void begin_layer() {
-        m_layers_rst.emplace_back();
-        m_layers_rst.front().raster.reset(m_res, m_pxdim, m_mirror, m_gamma);
-    }
-
-    inline void finish_layer(unsigned lyr_id) {
-        assert(lyr_id < m_layers_rst.size());
-        m_layers_rst[lyr_id].rawbytes =
-                m_layers_rst[lyr_id].raster.save(Raster::Format::PNG);
-        m_layers_rst[lyr_id].raster.reset();
-    }
-
-    inline void finish_layer() {
-        if(!m_layers_rst.empty()) {
-            m_layers_rst.back().rawbytes =
-                    m_layers_rst.back().raster.save(Raster::Format::PNG);
-            m_layers_rst.back().raster.reset();
+            raster.draw(poly);
         }
+        else raster.draw(p);
     }
 
-    void save(const std::string& fpath, const std::string& prjname = "");
+    // Rasterize layers 0 .. layer_cnt-1 with draw_layer and write them into
+    // a zipped archive at fpath. statuscb is called with the percentage of
+    // the layers written, throw_on_cancel is called before each layer is
+    // rasterized. If an exception is thrown, the incomplete archive is removed.
+    // If the layers were rasterized by a previous save(), their images are
+    // copied, neither draw_layer nor statuscb is called.
+    void save(const std::string& fpath, 
+              const std::string& prjname,
+              unsigned layer_cnt,
+              const DrawLayerFn& draw_layer,
+              std::function<void(unsigned)> statuscb = [] (unsigned) {},
+              std::function<void(void)> throw_on_cancel = [] () {});
 
     void set_statistics(const std::vector<double> statistics);
 };
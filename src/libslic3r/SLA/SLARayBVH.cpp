@@ -0,0 +1,461 @@
+#include "SLARayBVH.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace Slic3r {
+namespace sla {
+
+namespace {
+
+// The epsilon of the ray-triangle test of igl::ray_mesh_intersect()
+const double RAY_TRIANGLE_EPSILON = 0.000001;
+
+// Bounding boxes are inflated slightly, so that the rays grazing the faces of
+// a box (e.g. the flat faces of a mesh aligned with the axes) are not lost to
+// a rounding error.
+const double BOX_INFLATION = 1e-6;
+
+// The build switches from SAH to median splits below this depth, which bounds
+// the depth of the tree and the traversal stack.
+const size_t MAX_SAH_DEPTH = 48;
+const size_t MAX_STACK_SIZE = 128;
+
+const size_t SAH_BINS = 16;
+
+struct BBox {
+    double min[3] = { std::numeric_limits<double>::max(),
+                      std::numeric_limits<double>::max(),
+                      std::numeric_limits<double>::max() };
+    double max[3] = { std::numeric_limits<double>::lowest(),
+                      std::numeric_limits<double>::lowest(),
+                      std::numeric_limits<double>::lowest() };
+
+    void merge(const double *p) {
+        for(int a = 0; a < 3; ++a) {
+            min[a] = std::min(min[a], p[a]);
+            max[a] = std::max(max[a], p[a]);
+        }
+    }
+
+    void merge(const BBox& b) { if(!b.empty()) { merge(b.min); merge(b.max); } }
+
+    bool empty() const { return min[0] > max[0]; }
+
+    double half_area() const {
+        if(empty()) return 0.;
+        double dx = max[0] - min[0], dy = max[1] - min[1], dz = max[2] - min[2];
+        return dx * dy + dy * dz + dz * dx;
+    }
+};
+
+struct BuildTriangle {
+    BBox box;
+    double centroid[3];
+    int face;
+};
+
+}
+
+const size_t RayBVH::TrianglesInLeaf;
+const size_t RayBVH::RaysInPacket;
+
+struct RayBVH::Ray {
+    double o[3];
+    double d[3];
+    double inv[3];
+};
+
+struct RayBVH::RayPacket {
+    double o[3][RaysInPacket];
+    double d[3][RaysInPacket];
+    double inv[3][RaysInPacket];
+    double tmax[RaysInPacket];
+};
+
+class RayBVH::Builder {
+public:
+    Builder(RayBVH& bvh, const Eigen::MatrixXd& V, const Eigen::MatrixXi& F):
+        m_bvh(bvh), m_V(V), m_F(F) {}
+
+    std::vector<BuildTriangle> triangles;
+
+    // Build the subtree of triangles [lo, hi), returns the index of its root.
+    uint32_t build(size_t lo, size_t hi, size_t depth)
+    {
+        auto idx = uint32_t(m_bvh.m_nodes.size());
+        m_bvh.m_nodes.emplace_back();
+
+        BBox box, cbox;
+        for(size_t i = lo; i < hi; ++i) {
+            box.merge(triangles[i].box);
+            cbox.merge(triangles[i].centroid);
+        }
+
+        Node& node = m_bvh.m_nodes.back();
+        for(int a = 0; a < 3; ++a) {
+            node.bmin[a] = box.min[a] - BOX_INFLATION;
+            node.bmax[a] = box.max[a] + BOX_INFLATION;
+        }
+
+        if(hi - lo <= TrianglesInLeaf) {
+            node.is_leaf = 1;
+            node.axis = 0;
+            node.offset = uint32_t(m_bvh.m_packets.size());
+            m_bvh.m_packets.emplace_back(make_packet(lo, hi));
+            return idx;
+        }
+
+        int axis = 0;
+        for(int a = 1; a < 3; ++a)
+            if(cbox.max[a] - cbox.min[a] > cbox.max[axis] - cbox.min[axis])
+                axis = a;
+
+        size_t mid = (depth < MAX_SAH_DEPTH) ? sah_split(lo, hi, axis, cbox) : lo;
+        if(mid == lo || mid == hi) {
+            mid = (lo + hi) / 2;
+            std::nth_element(triangles.begin() + long(lo),
+                             triangles.begin() + long(mid),
+                             triangles.begin() + long(hi),
+                             [axis](const BuildTriangle& t1, const BuildTriangle& t2) {
+                return t1.centroid[axis] < t2.centroid[axis];
+            });
+        }
+
+        // The left child follows its parent.
+        build(lo, mid, depth + 1);
+        uint32_t right = build(mid, hi, depth + 1);
+
+        Node& inner = m_bvh.m_nodes[idx];
+        inner.is_leaf = 0;
+        inner.axis = uint16_t(axis);
+        inner.offset = right;
+        return idx;
+    }
+
+private:
+    RayBVH& m_bvh;
+    const Eigen::MatrixXd& m_V;
+    const Eigen::MatrixXi& m_F;
+
+    // Binned surface area heuristic. Partitions the triangles and returns the
+    // split position, lo or hi if no split was found.
+    size_t sah_split(size_t lo, size_t hi, int axis, const BBox& cbox)
+    {
+        double cmin = cbox.min[axis], extent = cbox.max[axis] - cmin;
+        if(extent <= 0.) return lo;
+
+        auto bin_of = [cmin, extent, axis](const BuildTriangle& t) {
+            auto b = size_t(SAH_BINS * (t.centroid[axis] - cmin) / extent);
+            return std::min(b, SAH_BINS - 1);
+        };
+
+        std::array<BBox, SAH_BINS> bins;
+        std::array<size_t, SAH_BINS> counts;
+        counts.fill(0);
+        for(size_t i = lo; i < hi; ++i) {
+            size_t b = bin_of(triangles[i]);
+            bins[b].merge(triangles[i].box);
+            ++counts[b];
+        }
+
+        // Cost of the splits after each of the bins from the right.
+        std::array<double, SAH_BINS> right_cost;
+        BBox acc; size_t cnt = 0;
+        for(size_t b = SAH_BINS - 1; b > 0; --b) {
+            acc.merge(bins[b]); cnt += counts[b];
+            right_cost[b - 1] = acc.half_area() * double(cnt);
+        }
+
+        double best_cost = std::numeric_limits<double>::max();
+        size_t best = SAH_BINS;
+        acc = BBox(); cnt = 0;
+        for(size_t b = 0; b + 1 < SAH_BINS; ++b) {
+            acc.merge(bins[b]); cnt += counts[b];
+            double cost = acc.half_area() * double(cnt) + right_cost[b];
+            if(cnt > 0 && cnt < hi - lo && cost < best_cost) {
+                best_cost = cost;
+                best = b;
+            }
+        }
+
+        if(best == SAH_BINS) return lo;
+
+        auto it = std::partition(triangles.begin() + long(lo),
+                                 triangles.begin() + long(hi),
+                                 [&bin_of, best](const BuildTriangle& t) {
+            return bin_of(t) <= best;
+        });
+
+        return size_t(it - triangles.begin());
+    }
+
+    TrianglePacket make_packet(size_t lo, size_t hi) const
+    {
+        TrianglePacket p;
+        for(size_t j = 0; j < TrianglesInLeaf; ++j) {
+            int face = (lo + j < hi) ? triangles[lo + j].face : -1;
+            p.face[j] = face;
+            for(int a = 0; a < 3; ++a) {
+                if(face < 0) {
+                    p.v0[a][j] = p.e1[a][j] = p.e2[a][j] = 0.;
+                    continue;
+                }
+
+                // The edges are calculated the same way as in
+                // igl::ray_mesh_intersect(), so that the hits match.
+                double v0 = m_V(m_F(face, 0), a);
+                p.v0[a][j] = v0;
+                p.e1[a][j] = m_V(m_F(face, 1), a) - v0;
+                p.e2[a][j] = m_V(m_F(face, 2), a) - v0;
+            }
+        }
+        return p;
+    }
+};
+
+void RayBVH::build(const Eigen::MatrixXd &V, const Eigen::MatrixXi &F)
+{
+    m_nodes.clear();
+    m_packets.clear();
+
+    size_t nf = size_t(F.rows());
+    if(nf == 0) return;
+
+    Builder builder(*this, V, F);
+    builder.triangles.resize(nf);
+    for(size_t i = 0; i < nf; ++i) {
+        BuildTriangle& t = builder.triangles[i];
+        t.face = int(i);
+        for(int c = 0; c < 3; ++c) {
+            double p[3] = { V(F(i, c), 0), V(F(i, c), 1), V(F(i, c), 2) };
+            t.box.merge(p);
+        }
+        for(int a = 0; a < 3; ++a)
+            t.centroid[a] = 0.5 * (t.box.min[a] + t.box.max[a]);
+    }
+
+    m_nodes.reserve(2 * nf / TrianglesInLeaf + 1);
+    m_packets.reserve(nf / TrianglesInLeaf + 1);
+    builder.build(0, nf, 0);
+}
+
+namespace {
+
+template<class Node, class Ray>
+inline bool ray_box_intersect(const Node& node, const Ray& r, double tmax)
+{
+    double t0 = 0., t1 = tmax;
+    for(int a = 0; a < 3; ++a) {
+        if(r.d[a] == 0.) {
+            if(r.o[a] < node.bmin[a] || r.o[a] > node.bmax[a]) return false;
+            continue;
+        }
+
+        double tnear = (node.bmin[a] - r.o[a]) * r.inv[a];
+        double tfar  = (node.bmax[a] - r.o[a]) * r.inv[a];
+        if(tnear > tfar) std::swap(tnear, tfar);
+
+        t0 = std::max(t0, tnear);
+        t1 = std::min(t1, tfar);
+        if(t0 > t1) return false;
+    }
+
+    return true;
+}
+
+// Slab test of all the rays of a packet at once. The loop over the rays only
+// consists of min / max operations, so that it is vectorized. For the rays
+// parallel to an axis, the inverse direction is infinite. Their slab distances
+// are infinite with the proper sign, or NaN if the ray starts on the side of
+// the box, which rejects the box. That is fine, as the box is inflated and
+// such a ray would never hit its triangles. The maximum distance of the rays
+// without a hit is the largest finite number instead of infinity, so that the
+// parallel rays outside of the slab are rejected.
+template<class Node, class Packet>
+inline bool packet_box_intersect(const Node& node, const Packet& p,
+                                 int64_t *active)
+{
+    const size_t N = RayBVH::RaysInPacket;
+    int64_t any = 0;
+    for(size_t k = 0; k < N; ++k) {
+        double t0 = 0., t1 = p.tmax[k];
+        for(int a = 0; a < 3; ++a) {
+            double tn = (node.bmin[a] - p.o[a][k]) * p.inv[a][k];
+            double tf = (node.bmax[a] - p.o[a][k]) * p.inv[a][k];
+            double lo = tn < tf ? tn : tf;
+            double hi = tn < tf ? tf : tn;
+            t0 = t0 < lo ? lo : t0;
+            t1 = hi < t1 ? hi : t1;
+        }
+        active[k] = t0 <= t1;
+        any |= active[k];
+    }
+    return any != 0;
+}
+
+// Moller-Trumbore test of a ray against the triangles of a packet. The loop
+// over the triangles is free of branches, so that it is vectorized.
+template<class Packet, class Ray, class Hit>
+inline void ray_packet_intersect(const Packet& p, const Ray& r, Hit& hit)
+{
+    const size_t N = RayBVH::TrianglesInLeaf;
+    double  t[N];
+    int64_t valid[N];
+
+    for(size_t j = 0; j < N; ++j) {
+        double e1x = p.e1[0][j], e1y = p.e1[1][j], e1z = p.e1[2][j];
+        double e2x = p.e2[0][j], e2y = p.e2[1][j], e2z = p.e2[2][j];
+
+        double px = r.d[1] * e2z - r.d[2] * e2y;
+        double py = r.d[2] * e2x - r.d[0] * e2z;
+        double pz = r.d[0] * e2y - r.d[1] * e2x;
+
+        double det = e1x * px + e1y * py + e1z * pz;
+
+        double tx = r.o[0] - p.v0[0][j];
+        double ty = r.o[1] - p.v0[1][j];
+        double tz = r.o[2] - p.v0[2][j];
+
+        double u = tx * px + ty * py + tz * pz;
+
+        double qx = ty * e1z - tz * e1y;
+        double qy = tz * e1x - tx * e1z;
+        double qz = tx * e1y - ty * e1x;
+
+        double v = r.d[0] * qx + r.d[1] * qy + r.d[2] * qz;
+
+        int64_t front = (det > RAY_TRIANGLE_EPSILON) & (u >= 0.) & (u <= det) &
+                        (v >= 0.) & (u + v <= det);
+        int64_t back  = (det < -RAY_TRIANGLE_EPSILON) & (u <= 0.) & (u >= det) &
+                        (v <= 0.) & (u + v >= det);
+
+        // Division by a zero determinant of the rejected triangles is harmless.
+        double inv_det = 1. / det;
+        t[j] = (e2x * qx + e2y * qy + e2z * qz) * inv_det;
+        valid[j] = front | back;
+    }
+
+    for(size_t j = 0; j < N; ++j)
+        if(valid[j] && t[j] > 0. && t[j] < hit.t) {
+            hit.t = t[j];
+            hit.face = p.face[j];
+        }
+}
+
+}
+
+void RayBVH::intersect_packet(size_t n, const Vec3d *sources,
+                              const Vec3d *dirs, Hit *hits) const
+{
+    assert(n > 0 && n <= RaysInPacket);
+
+    for(size_t k = 0; k < n; ++k) hits[k] = Hit();
+
+    if(m_nodes.empty()) return;
+
+    std::array<uint32_t, MAX_STACK_SIZE> stack;
+    size_t top = 0;
+    stack[top++] = 0;
+
+    // A single ray is traced with the early exit of the scalar slab test.
+    if(n == 1) {
+        Ray ray;
+        for(int a = 0; a < 3; ++a) {
+            ray.o[a] = sources[0](a);
+            ray.d[a] = dirs[0](a);
+            ray.inv[a] = 1. / dirs[0](a);
+        }
+
+        while(top > 0) {
+            uint32_t idx = stack[--top];
+            const Node& node = m_nodes[idx];
+            if(!ray_box_intersect(node, ray, hits[0].t)) continue;
+
+            if(node.is_leaf) {
+                ray_packet_intersect(m_packets[node.offset], ray, hits[0]);
+                continue;
+            }
+
+            assert(top + 2 <= MAX_STACK_SIZE);
+            uint32_t left = idx + 1, right = node.offset;
+            bool left_first = ray.d[node.axis] >= 0.;
+            stack[top++] = left_first ? right : left;
+            stack[top++] = left_first ? left : right;
+        }
+
+        return;
+    }
+
+    // The rays of the packet as a structure of arrays for the slab tests. The
+    // unused slots have a negative tmax, thus they never enter a box.
+    const double no_hit = std::numeric_limits<double>::max();
+    RayPacket packet;
+    std::array<Ray, RaysInPacket> rays;
+    for(size_t k = 0; k < RaysInPacket; ++k) {
+        const Vec3d& o = sources[std::min(k, n - 1)];
+        const Vec3d& d = dirs[std::min(k, n - 1)];
+        for(int a = 0; a < 3; ++a) {
+            rays[k].o[a] = packet.o[a][k] = o(a);
+            rays[k].d[a] = packet.d[a][k] = d(a);
+            rays[k].inv[a] = packet.inv[a][k] = 1. / d(a);
+        }
+        packet.tmax[k] = k < n ? no_hit : -1.;
+    }
+
+    std::array<int64_t, RaysInPacket> active;
+    while(top > 0) {
+        uint32_t idx = stack[--top];
+        const Node& node = m_nodes[idx];
+
+        // The node is skipped if none of the rays enters it.
+        if(!packet_box_intersect(node, packet, active.data())) continue;
+
+        if(node.is_leaf) {
+            const TrianglePacket& p = m_packets[node.offset];
+            for(size_t k = 0; k < n; ++k)
+                if(active[k]) {
+                    ray_packet_intersect(p, rays[k], hits[k]);
+                    packet.tmax[k] = std::min(hits[k].t, no_hit);
+                }
+            continue;
+        }
+
+        // Visit the near child first, as seen by the first entering ray.
+        size_t first = 0;
+        while(!active[first]) ++first;
+
+        assert(top + 2 <= MAX_STACK_SIZE);
+        uint32_t left = idx + 1, right = node.offset;
+        bool left_first = rays[first].d[node.axis] >= 0.;
+        stack[top++] = left_first ? right : left;
+        stack[top++] = left_first ? left : right;
+    }
+}
+
+void RayBVH::intersect(size_t n, const Vec3d *sources, const Vec3d *dirs,
+                       Hit *hits) const
+{
+#ifdef __AVX__
+    for(size_t i = 0; i < n; i += RaysInPacket)
+        intersect_packet(std::min(RaysInPacket, n - i),
+                         sources + i, dirs + i, hits + i);
+#else
+    // Without AVX, the slab tests of a packet are not vectorized and tracing
+    // the rays one by one with the early exit of the scalar slab test is
+    // faster.
+    for(size_t i = 0; i < n; ++i)
+        intersect_packet(1, sources + i, dirs + i, hits + i);
+#endif
+}
+
+RayBVH::Hit RayBVH::intersect(const Vec3d &source, const Vec3d &dir) const
+{
+    Hit hit;
+    intersect_packet(1, &source, &dir, &hit);
+    return hit;
+}
+
+} // namespace sla
+} // namespace Slic3r
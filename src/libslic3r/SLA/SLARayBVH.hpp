@@ -0,0 +1,96 @@
+#ifndef SLARAYBVH_HPP
+#define SLARAYBVH_HPP
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+#include <libslic3r/Point.hpp>
+
+namespace Slic3r {
+namespace sla {
+
+/**
+ * @brief Bounding volume hierarchy for casting rays onto a triangle mesh.
+ *
+ * The tree is flattened into an array of nodes in depth first order: The left
+ * child of an inner node follows the node, only the index of the right child
+ * is stored. Each leaf holds a single packet of up to four triangles stored as
+ * a structure of arrays, so that the four ray-triangle tests of a leaf are
+ * vectorized by the compiler.
+ *
+ * The rays can be cast in packets of nearby rays with similar directions,
+ * which traverse the tree together, each node being fetched once for all the
+ * rays of the packet. The slab tests of a packet are vectorized as well, which
+ * pays off with AVX. Otherwise the rays of a batch are traced one by one.
+ *
+ * The triangle test is the one of igl::ray_mesh_intersect (Moller-Trumbore
+ * with the same epsilon), only hits at a positive distance are reported.
+ */
+class RayBVH {
+public:
+
+    /// Number of triangles in a leaf.
+    static const size_t TrianglesInLeaf = 4;
+
+    /// Maximum number of rays traversing the tree together.
+    static const size_t RaysInPacket = 8;
+
+    struct Hit {
+        double t = std::numeric_limits<double>::infinity();
+        int face = -1;
+    };
+
+    RayBVH() = default;
+    RayBVH(const Eigen::MatrixXd& V, const Eigen::MatrixXi& F) { build(V, F); }
+
+    void build(const Eigen::MatrixXd& V, const Eigen::MatrixXi& F);
+
+    /// Closest hit of a single ray.
+    Hit intersect(const Vec3d& source, const Vec3d& dir) const;
+
+    /// Closest hits of n rays. Consecutive rays are grouped into packets of
+    /// RaysInPacket rays, which works best if they are coherent.
+    void intersect(size_t n, const Vec3d *sources, const Vec3d *dirs,
+                   Hit *hits) const;
+
+    /// Closest hits of up to RaysInPacket rays traversing the tree together.
+    /// A single ray is traced with the scalar slab test. intersect() calls
+    /// this with whole packets only if AVX is enabled, with single rays
+    /// otherwise.
+    void intersect_packet(size_t n, const Vec3d *sources, const Vec3d *dirs,
+                          Hit *hits) const;
+
+private:
+
+    struct Node {
+        double bmin[3];
+        double bmax[3];
+        // Index of the right child for inner nodes, index of the triangle
+        // packet for leaves.
+        uint32_t offset;
+        uint16_t is_leaf;
+        uint16_t axis;      // split axis of inner nodes
+    };
+
+    // Triangles of a leaf as a structure of arrays. The unused slots are
+    // degenerate triangles with a face index of -1, they are never hit.
+    struct TrianglePacket {
+        double v0[3][TrianglesInLeaf];
+        double e1[3][TrianglesInLeaf];
+        double e2[3][TrianglesInLeaf];
+        int    face[TrianglesInLeaf];
+    };
+
+    struct Ray;
+    struct RayPacket;
+    class Builder;
+
+    std::vector<Node> m_nodes;
+    std::vector<TrianglePacket> m_packets;
+};
+
+} // namespace sla
+} // namespace Slic3r
+
+#endif // SLARAYBVH_HPP
@@ -1,5 +1,10 @@
 #include <limits>
 #include <exception>
+#include <atomic>
+#include <mutex>
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
 #include <libnest2d/optimizers/nlopt/genetic.hpp>
 #include "SLABoilerPlate.hpp"
@@ -10,6 +15,91 @@
 namespace Slic3r {
 namespace sla {
 
+RotationScore::RotationScore(const TriangleMesh &mesh)
+{
+    const std::vector<stl_facet> &facets = mesh.stl.facet_start;
+    std::vector<Vec3d> normals(facets.size());
+
+    tbb::parallel_for(size_t(0), facets.size(), [&facets, &normals](size_t i)
+    {
+        Vec3d p1 = facets[i].vertex[0].cast<double>();
+        Vec3d p2 = facets[i].vertex[1].cast<double>();
+        Vec3d p3 = facets[i].vertex[2].cast<double>();
+
+        // Degenerate facets end up with a zero normal, they do not score.
+        normals[i] = (p2 - p1).cross(p3 - p1).normalized();
+    });
+
+    // Flat regions of a mesh consist of many facets with the same normal.
+    tbb::parallel_sort(normals.begin(), normals.end(),
+                       [](const Vec3d& a, const Vec3d& b) {
+        return std::lexicographical_compare(a.data(), a.data() + 3,
+                                            b.data(), b.data() + 3);
+    });
+
+    for(size_t i = 0; i < normals.size();) {
+        size_t j = i + 1;
+        while(j < normals.size() && normals[j] == normals[i]) ++j;
+
+        m_x.emplace_back(normals[i](X));
+        m_y.emplace_back(normals[i](Y));
+        m_z.emplace_back(normals[i](Z));
+        m_w.emplace_back(double(j - i));
+        i = j;
+    }
+}
+
+double RotationScore::operator()(double rx, double ry, double rz) const
+{
+    // prepare the rotation transformation
+    Transform3d rt = Transform3d::Identity();
+
+    rt.rotate(Eigen::AngleAxisd(rz, Vec3d::UnitZ()));
+    rt.rotate(Eigen::AngleAxisd(ry, Vec3d::UnitY()));
+    rt.rotate(Eigen::AngleAxisd(rx, Vec3d::UnitX()));
+
+    const Eigen::Matrix3d r = rt.linear();
+
+    // For all normals we sum up the dot product (a scalar indicating how much
+    // are two vectors aligned) of the rotated normal with each axis. This
+    // will result in a value that is greater if a normal is aligned with all
+    // axes. If the normal is aligned than the triangle itself is orthogonal to
+    // the axes and that is good for print quality. The dot product of the
+    // rotated normal with an axis is the dot product of the normal with a row
+    // of the rotation matrix.
+
+    // TODO: some applications optimize for minimum z-axis cross section
+    // area. The current function is only an example of how to optimize.
+
+    // Later we can add more criteria like the number of overhangs, etc...
+
+    // Independent partial sums, so that the compiler can vectorize the loop.
+    static const size_t Lanes = 4;
+    double sums[Lanes] = { 0., 0., 0., 0. };
+
+    const double *x = m_x.data(), *y = m_y.data(), *z = m_z.data();
+    const double *w = m_w.data();
+    const size_t  n = m_w.size();
+
+    size_t i = 0;
+    for(; i + Lanes <= n; i += Lanes)
+        for(size_t l = 0; l < Lanes; ++l) {
+            size_t k = i + l;
+            sums[l] += w[k] * (
+                std::abs(r(0, 0) * x[k] + r(0, 1) * y[k] + r(0, 2) * z[k]) +
+                std::abs(r(1, 0) * x[k] + r(1, 1) * y[k] + r(1, 2) * z[k]) +
+                std::abs(r(2, 0) * x[k] + r(2, 1) * y[k] + r(2, 2) * z[k]));
+        }
+
+    for(; i < n; ++i)
+        sums[0] += w[i] * (
+            std::abs(r(0, 0) * x[i] + r(0, 1) * y[i] + r(0, 2) * z[i]) +
+            std::abs(r(1, 0) * x[i] + r(1, 1) * y[i] + r(1, 2) * z[i]) +
+            std::abs(r(2, 0) * x[i] + r(2, 1) * y[i] + r(2, 2) * z[i]));
+
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
 std::array<double, 3> find_best_rotation(const ModelObject& modelobj,
                                          float accuracy,
                                          std::function<void(unsigned)> statuscb,
@@ -20,103 +110,92 @@ std::array<double, 3> find_best_rotation(const ModelObject& modelobj,
     using libnest2d::opt::Optimizer;
     using libnest2d::opt::TOptimizer;
     using libnest2d::opt::StopCriteria;
+    using libnest2d::opt::Result;
 
     static const unsigned MAX_TRIES = 100000;
 
+    // Number of independent runs of the optimizer. It does not depend on the
+    // number of cores, so that the result is the same on any machine.
+    static const unsigned STARTS = 4;
+
     // return value
     std::array<double, 3> rot;
 
-    // We will use only one instance of this converted mesh to examine different
+    // We will use only one instance of the normal table to examine different
     // rotations
-    EigenMesh3D emesh(modelobj.raw_mesh());
+    RotationScore score(modelobj.raw_mesh());
+
+    // For the number of iterations of all the runs
+    std::atomic<unsigned> status(0);
 
-    // For current iteration number
-    unsigned status = 0;
+    // The last reported percentage and a lock serializing the reports, the
+    // status callback may not be thread safe.
+    std::atomic<unsigned> reported(0);
+    std::mutex reportmtx;
 
-    // The maximum number of iterations
+    // The maximum number of iterations of a run
     auto max_tries = unsigned(accuracy * MAX_TRIES);
 
     // call status callback with zero, because we are at the start
-    statuscb(status);
-
-    // So this is the object function which is called by the solver many times
-    // It has to yield a single value representing the current score. We will
-    // call the status callback in each iteration but the actual value may be
-    // the same for subsequent iterations (status goes from 0 to 100 but
-    // iterations can be many more)
-    auto objfunc = [&emesh, &status, &statuscb, &stopcond, max_tries]
-            (double rx, double ry, double rz)
+    statuscb(0);
+
+    // So this is the object function which is called by the solvers many
+    // times It has to yield a single value representing the current score. The
+    // status callback is called whenever the percentage of all the iterations
+    // increases.
+    auto objfunc = [&score, &status, &reported, &reportmtx, &statuscb,
+                    &stopcond, max_tries] (double rx, double ry, double rz)
     {
-        EigenMesh3D& m = emesh;
-
-        // prepare the rotation transformation
-        Transform3d rt = Transform3d::Identity();
-
-        rt.rotate(Eigen::AngleAxisd(rz, Vec3d::UnitZ()));
-        rt.rotate(Eigen::AngleAxisd(ry, Vec3d::UnitY()));
-        rt.rotate(Eigen::AngleAxisd(rx, Vec3d::UnitX()));
-
-        double score = 0;
-
-        // For all triangles we calculate the normal and sum up the dot product
-        // (a scalar indicating how much are two vectors aligned) with each axis
-        // this will result in a value that is greater if a normal is aligned
-        // with all axes. If the normal is aligned than the triangle itself is
-        // orthogonal to the axes and that is good for print quality.
-
-        // TODO: some applications optimize for minimum z-axis cross section
-        // area. The current function is only an example of how to optimize.
-
-        // Later we can add more criteria like the number of overhangs, etc...
-        for(int i = 0; i < m.F().rows(); i++) {
-            auto idx = m.F().row(i);
-
-            Vec3d p1 = m.V().row(idx(0));
-            Vec3d p2 = m.V().row(idx(1));
-            Vec3d p3 = m.V().row(idx(2));
-
-            Eigen::Vector3d U = p2 - p1;
-            Eigen::Vector3d V = p3 - p1;
-
-            // So this is the normal
-            auto n = U.cross(V).normalized();
-
-            // rotate the normal with the current rotation given by the solver
-            n = rt * n;
-
-            // We should score against the alignment with the reference planes
-            score += std::abs(n.dot(Vec3d::UnitX()));
-            score += std::abs(n.dot(Vec3d::UnitY()));
-            score += std::abs(n.dot(Vec3d::UnitZ()));
-        }
+        double ret = score(rx, ry, rz);
 
         // report status
-        if(!stopcond()) statuscb( unsigned(++status * 100.0/max_tries) );
+        unsigned st = unsigned(++status * 100.0 / (STARTS * max_tries));
+        if(st > reported && !stopcond()) {
+            std::lock_guard<std::mutex> lk(reportmtx);
+            if(st > reported) { reported = st; statuscb(st); }
+        }
 
-        return score;
+        return ret;
     };
 
-    // Firing up the genetic optimizer. For now it uses the nlopt library.
-    StopCriteria stc;
-    stc.max_iterations = max_tries;
-    stc.relative_score_difference = 1e-3;
-    stc.stop_condition = stopcond;      // stop when stopcond returns true
-    TOptimizer<Method::G_GENETIC> solver(stc);
-
-    // We are searching rotations around the three axes x, y, z. Thus the
-    // problem becomes a 3 dimensional optimization task.
-    // We can specify the bounds for a dimension in the following way:
-    auto b = bound(-PI/2, PI/2);
+    using OptResult = Result<double, double, double>;
+    std::array<OptResult, STARTS> results{};
 
-    // Now we start the optimization process with initial angles (0, 0, 0)
-    auto result = solver.optimize_max(objfunc,
-                                      libnest2d::opt::initvals(0.0, 0.0, 0.0),
-                                      b, b, b);
+    // Firing up the genetic optimizers. For now it uses the nlopt library,
+    // which keeps the state of its random generator per thread. A run is
+    // never interrupted by another one in the same thread, the objective
+    // function is evaluated serially, so the seed of a run determines its
+    // result.
+    tbb::parallel_for(size_t(0), size_t(STARTS),
+                      [&objfunc, &results, &stopcond, max_tries](size_t s)
+    {
+        StopCriteria stc;
+        stc.max_iterations = max_tries;
+        stc.relative_score_difference = 1e-3;
+        stc.stop_condition = stopcond;      // stop when stopcond returns true
+        TOptimizer<Method::G_GENETIC> solver(stc);
+        solver.seed(s);
+
+        // We are searching rotations around the three axes x, y, z. Thus the
+        // problem becomes a 3 dimensional optimization task.
+        // We can specify the bounds for a dimension in the following way:
+        auto b = bound(-PI/2, PI/2);
+
+        // Now we start the optimization process with initial angles (0, 0, 0)
+        results[s] = solver.optimize_max(objfunc,
+                                         libnest2d::opt::initvals(0.0, 0.0, 0.0),
+                                         b, b, b);
+    });
+
+    // The best of the runs, the first one wins a tie.
+    size_t best = 0;
+    for(size_t s = 1; s < STARTS; ++s)
+        if(results[s].score > results[best].score) best = s;
 
     // Save the result and fck off
-    rot[0] = std::get<0>(result.optimum);
-    rot[1] = std::get<1>(result.optimum);
-    rot[2] = std::get<2>(result.optimum);
+    rot[0] = std::get<0>(results[best].optimum);
+    rot[1] = std::get<1>(results[best].optimum);
+    rot[2] = std::get<2>(results[best].optimum);
 
     return rot;
 }
@@ -3,20 +3,46 @@
 
 #include <functional>
 #include <array>
+#include <vector>
 
 namespace Slic3r {
 
 class ModelObject;
+class TriangleMesh;
 
 namespace sla {
 
+/**
+ * The score of a rotation of a mesh, which is maximized by find_best_rotation.
+ *
+ * The unit normals of the facets are rotated and their alignments with the
+ * axes are summed up. The normals are computed once into a table, facets with
+ * the same normal share an entry weighted by their count, so that a score is
+ * evaluated by a single vectorizable pass over the table.
+ */
+class RotationScore {
+public:
+    explicit RotationScore(const TriangleMesh& mesh);
+
+    /// Score of the rotation by rz around Z, then ry around Y, then rx around X.
+    double operator()(double rx, double ry, double rz) const;
+
+    /// Number of distinct facet normals.
+    size_t size() const { return m_w.size(); }
+
+private:
+    std::vector<double> m_x, m_y, m_z;  // unit normals
+    std::vector<double> m_w;            // number of facets with the normal
+};
+
 /**
   * The function should find the best rotation for SLA upside down printing.
   *
   * @param modelobj The model object representing the 3d mesh.
   * @param accuracy The optimization accuracy from 0.0f to 1.0f. Currently,
   * the nlopt genetic optimizer is used and the number of iterations is
-  * accuracy * 100000. This can change in the future.
+  * accuracy * 100000 for each of the independent runs, which are started with
+  * fixed seeds and evaluated in parallel. This can change in the future.
   * @param statuscb A status indicator callback called with the unsigned
   * argument spanning from 0 to 100. May not reach 100 if the optimization finds
   * an optimum before max iterations are reached.
@@ -584,6 +584,34 @@ struct Pad {
     bool empty() const { return tmesh.facets_count() == 0; }
 };
 
+// The outcome of the filtering and classification steps for one support
+// point. It only depends on the support point, the object mesh and the head
+// parameters of the configuration, so it can be taken over by a support tree
+// generated for an edited set of support points on the same mesh.
+struct HeadPlacement {
+    enum Kind { DISCARDED, PINHEAD, HEADLESS };
+
+    Kind kind = DISCARDED;
+
+    // The corrected (and possibly optimized) head direction
+    Vec3d normal = Vec3d::Zero();
+
+    // Hit of the downward ray from the head junction point. A pinhead which
+    // does not hit the model can be routed directly to the ground.
+    EigenMesh3D::hit_result ground_hit;
+    bool classified = false;
+};
+
+// The support point is the provenance of its head placement. The is_new_island
+// flag has no influence on the placement, it is not part of the key.
+using PlacementKey = std::array<float, 4>;
+
+inline PlacementKey placement_key(const SupportPoint& sp) {
+    return {{sp.pos.x(), sp.pos.y(), sp.pos.z(), sp.head_front_radius}};
+}
+
+using HeadPlacements = std::map<PlacementKey, HeadPlacement>;
+
 // The minimum distance for two support points to remain valid.
 static const double /*constexpr*/ D_SP   = 0.1;
 
@@ -644,12 +672,26 @@ class SLASupportTree::Impl {
     std::vector<CompactBridge> m_compact_bridges;
     Controller m_ctl;
 
+    // Head placements of the support points, kept after the generation. They
+    // are valid for the mesh and the head parameters they were computed with.
+    HeadPlacements m_placements;
+    const EigenMesh3D *m_placement_mesh = nullptr;
+    SupportConfig m_placement_cfg;
+
+    // The head junctions and the pillar axes, kept when the support data is
+    // cleared.
+    Pointf3s m_head_junctions;
+    std::vector<std::pair<Vec3d, Vec3d>> m_pillar_endpoints;
+
     Pad m_pad;
     mutable TriangleMesh meshcache; mutable bool meshcache_valid = false;
     mutable double model_height = 0; // the full height of the model
 public:
     double ground_level = 0;
 
+    // Count of the head placements taken over from the previous tree.
+    size_t reused_placements = 0;
+
     Impl() = default;
     inline Impl(const Controller& ctl): m_ctl(ctl) {}
 
@@ -775,6 +817,32 @@ public:
 
     const Pad& pad() const { return m_pad; }
 
+    HeadPlacements& placements() { return m_placements; }
+
+    void set_placement_source(const EigenMesh3D& mesh,
+                              const SupportConfig& cfg)
+    {
+        m_placement_mesh = &mesh;
+        m_placement_cfg = cfg;
+    }
+
+    // Take over the head placements of a tree generated on the same mesh
+    // object with the same head geometry.
+    bool reuse_placements(const Impl& prev,
+                          const EigenMesh3D& mesh,
+                          const SupportConfig& cfg)
+    {
+        const SupportConfig& pcfg = prev.m_placement_cfg;
+        if(prev.m_placement_mesh != &mesh ||
+           pcfg.head_front_radius_mm != cfg.head_front_radius_mm ||
+           pcfg.head_penetration_mm != cfg.head_penetration_mm ||
+           pcfg.head_back_radius_mm != cfg.head_back_radius_mm ||
+           pcfg.head_width_mm != cfg.head_width_mm) return false;
+
+        m_placements = prev.m_placements;
+        return true;
+    }
+
     // WITHOUT THE PAD!!!
     const TriangleMesh& merged_mesh() const {
         if(meshcache_valid) return meshcache;
@@ -848,8 +916,24 @@ public:
     }
     
     // Intended to be called after the generation is fully complete
+    const Pointf3s& head_junctions() const { return m_head_junctions; }
+    const std::vector<std::pair<Vec3d, Vec3d>>& pillar_endpoints() const {
+        return m_pillar_endpoints;
+    }
+
     void clear_support_data() {
         merged_mesh(); // in case the mesh is not generated, it should be...
+
+        m_head_junctions.clear();
+        for(auto& headel : m_heads)
+            if(headel.second.is_valid())
+                m_head_junctions.emplace_back(headel.second.junction_point());
+
+        m_pillar_endpoints.clear();
+        for(auto& pillar : m_pillars)
+            m_pillar_endpoints.emplace_back(pillar.startpoint(),
+                                            pillar.endpoint());
+
         m_heads.clear();
         m_pillars.clear();
         m_junctions.clear();
@@ -955,6 +1039,22 @@ class SLASupportTree::Algorithm {
         return m_mesh.query_ray_hit(s, dir).distance();
     }
 
+    // Casts the sample rays of a collision test. The rays are split into
+    // batches of RAYS_IN_BATCH, the batches are cast in parallel.
+    void query_ray_hits(size_t n, const Vec3d *sources, const Vec3d *dirs,
+                        EigenMesh3D::hit_result *hits)
+    {
+        static const size_t RAYS_IN_BATCH = 2;
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, n, RAYS_IN_BATCH),
+                          [this, sources, dirs, hits]
+                          (const tbb::blocked_range<size_t>& range)
+        {
+            m_mesh.query_ray_hits(range.size(), sources + range.begin(),
+                                  dirs + range.begin(), hits + range.begin());
+        });
+    }
+
     // This function will test if a future pinhead would not collide with the
     // model geometry. It does not take a 'Head' object because those are
     // created after this test. Parameters: s: The touching point on the model
@@ -998,7 +1098,6 @@ class SLASupportTree::Algorithm {
         std::array<double, SAMPLES> phis;
         for(size_t i = 0; i < phis.size(); ++i) phis[i] = i*2*PI/phis.size();
 
-        auto& m = m_mesh;
         using HitResult = EigenMesh3D::hit_result;
 
         // Hit results
@@ -1024,11 +1123,10 @@ class SLASupportTree::Algorithm {
 
         // Now a and b vectors are perpendicular to v and to each other.
         // Together they define the plane where we have to iterate with the
-        // given angles in the 'phis' vector
-        tbb::parallel_for(size_t(0), phis.size(),
-                          [&phis, &hits, &m, sd, r_pin, r_back, s, a, b, c]
-                          (size_t i)
-        {
+        // given angles in the 'phis' vector. The rays are cast together, in
+        // parallel batches.
+        std::array<Vec3d, SAMPLES> pss, sources, dirs;
+        for(size_t i = 0; i < phis.size(); ++i) {
             double& phi = phis[i];
             double sinphi = std::sin(phi);
             double cosphi = std::cos(phi);
@@ -1055,8 +1153,18 @@ class SLASupportTree::Algorithm {
                     c(Z) + rpbcos * a(Z) + rpbsin * b(Z));
 
             Vec3d n = (p - ps).normalized();
-            auto q = m.query_ray_hit(ps + sd*n, n);
+            pss[i] = ps;
+            sources[i] = ps + sd*n;
+            dirs[i] = n;
+        }
+
+        query_ray_hits(SAMPLES, sources.data(), dirs.data(), hits.data());
 
+        // The rays hitting the model from inside are re-cast together.
+        size_t recast_cnt = 0;
+        std::array<size_t, SAMPLES> recast_idx;
+        for(size_t i = 0; i < SAMPLES; ++i) {
+            HitResult& q = hits[i];
             if(q.is_inside()) { // the hit is inside the model
                 if(q.distance() > r_pin + sd)  {
                     // If we are inside the model and the hit distance is bigger
@@ -1066,17 +1174,26 @@ class SLASupportTree::Algorithm {
                     // zero hit distance to these cases which will enforce the
                     // function return value to be an invalid ray with zero hit
                     // distance. (see min_element at the end)
-                    hits[i] = HitResult(0.0);
+                    q = HitResult(0.0);
                 }
                 else {
                     // re-cast the ray from the outside of the object.
                     // The starting point has an offset of 2*safety_distance
                     // because the original ray has also had an offset
-                    auto q2 = m.query_ray_hit(ps + (q.distance() + 2*sd)*n, n);
-                    hits[i] = q2;
+                    sources[recast_cnt] = pss[i] + (q.distance() + 2*sd)*dirs[i];
+                    dirs[recast_cnt] = dirs[i];
+                    recast_idx[recast_cnt++] = i;
                 }
-            } else hits[i] = q;
-        });
+            }
+        }
+
+        if(recast_cnt > 0) {
+            std::array<HitResult, SAMPLES> hits2;
+            query_ray_hits(recast_cnt, sources.data(), dirs.data(),
+                           hits2.data());
+            for(size_t j = 0; j < recast_cnt; ++j)
+                hits[recast_idx[j]] = hits2[j];
+        }
 
         auto mit = std::min_element(hits.begin(), hits.end());
 
@@ -1123,16 +1240,13 @@ class SLASupportTree::Algorithm {
         std::array<double, SAMPLES> phis;
         for(size_t i = 0; i < phis.size(); ++i) phis[i] = i*2*PI/phis.size();
 
-        auto& m = m_mesh;
         using HitResult = EigenMesh3D::hit_result;
 
         // Hit results
         std::array<HitResult, SAMPLES> hits;
 
-        tbb::parallel_for(size_t(0), phis.size(),
-                          [&m, &phis, a, b, sd, dir, r, s, ins_check, &hits]
-                          (size_t i)
-        {
+        std::array<Vec3d, SAMPLES> ps, sources, dirs;
+        for(size_t i = 0; i < phis.size(); ++i) {
             double& phi = phis[i];
             double sinphi = std::sin(phi);
             double cosphi = std::cos(phi);
@@ -1142,23 +1256,40 @@ class SLASupportTree::Algorithm {
             double rsin = (sd + r) * sinphi;
 
             // Point on the circle on the pin sphere
-            Vec3d p (s(X) + rcos * a(X) + rsin * b(X),
-                     s(Y) + rcos * a(Y) + rsin * b(Y),
-                     s(Z) + rcos * a(Z) + rsin * b(Z));
+            ps[i] = Vec3d(s(X) + rcos * a(X) + rsin * b(X),
+                          s(Y) + rcos * a(Y) + rsin * b(Y),
+                          s(Z) + rcos * a(Z) + rsin * b(Z));
 
-            auto hr = m.query_ray_hit(p + sd*dir, dir);
-
-            if(ins_check && hr.is_inside()) {
-                if(hr.distance() > r + sd) hits[i] = HitResult(0.0);
-                else {
-                    // re-cast the ray from the outside of the object
-                    auto hr2 =
-                           m.query_ray_hit(p + (hr.distance() + 2*sd)*dir, dir);
+            sources[i] = ps[i] + sd*dir;
+            dirs[i] = dir;
+        }
 
-                    hits[i] = hr2;
+        query_ray_hits(SAMPLES, sources.data(), dirs.data(), hits.data());
+
+        if(ins_check) {
+            size_t recast_cnt = 0;
+            std::array<size_t, SAMPLES> recast_idx;
+            for(size_t i = 0; i < SAMPLES; ++i) {
+                HitResult& hr = hits[i];
+                if(hr.is_inside()) {
+                    if(hr.distance() > r + sd) hr = HitResult(0.0);
+                    else {
+                        // re-cast the ray from the outside of the object
+                        sources[recast_cnt] = 
+                                ps[i] + (hr.distance() + 2*sd)*dir;
+                        recast_idx[recast_cnt++] = i;
+                    }
                 }
-            } else hits[i] = hr;
-        });
+            }
+
+            if(recast_cnt > 0) {
+                std::array<HitResult, SAMPLES> hits2;
+                query_ray_hits(recast_cnt, sources.data(), dirs.data(),
+                               hits2.data());
+                for(size_t j = 0; j < recast_cnt; ++j)
+                    hits[recast_idx[j]] = hits2[j];
+            }
+        }
 
         auto mit = std::min_element(hits.begin(), hits.end());
 
@@ -1419,9 +1550,28 @@ public:
             filtered_indices.emplace_back(a.front());
         }
 
-        // calculate the normals to the triangles for filtered points
-        auto nmls = sla::normals(m_points, m_mesh, m_cfg.head_front_radius_mm,
-                                 m_thr, filtered_indices);
+        // The points which were not edited since the previous generation keep
+        // their head placement. Only the new ones have to be evaluated.
+        HeadPlacements& cache = m_result.placements();
+        HeadPlacements placements;
+        PtIndices new_indices;
+        new_indices.reserve(filtered_indices.size());
+        for(unsigned fidx : filtered_indices) {
+            auto it = cache.find(placement_key(m_support_pts[fidx]));
+            if(it != cache.end()) placements.emplace(*it);
+            else new_indices.emplace_back(fidx);
+        }
+
+        m_result.reused_placements = placements.size();
+        BOOST_LOG_TRIVIAL(debug) << "Reused head placements: "
+                                 << placements.size() << ", new points: "
+                                 << new_indices.size();
+
+        // calculate the normals to the triangles for the new points
+        PointSet nmls;
+        if(!new_indices.empty())
+            nmls = sla::normals(m_points, m_mesh, m_cfg.head_front_radius_mm,
+                                m_thr, new_indices);
 
         // Not all of the support points have to be a valid position for
         // support creation. The angle may be inappropriate or there may
@@ -1433,12 +1583,14 @@ public:
         using libnest2d::opt::GeneticOptimizer;
         using libnest2d::opt::StopCriteria;
 
-        for(unsigned i = 0, fidx = 0; i < filtered_indices.size(); ++i)
+        for(unsigned i = 0, fidx = 0; i < new_indices.size(); ++i)
         {
             m_thr();
 
-            fidx = filtered_indices[i];
+            fidx = new_indices[i];
             auto n = nmls.row(i);
+            HeadPlacement& placement =
+                    placements[placement_key(m_support_pts[fidx])];
 
             // for all normals we generate the spherical coordinates and
             // saturate the polar angle to 45 degrees from the bottom then
@@ -1521,19 +1673,35 @@ public:
                 }
 
                 // save the verified and corrected normal
-                m_support_nmls.row(fidx) = nn;
+                placement.normal = nn;
 
                 if(t > w) {
                     // mark the point for needing a head.
-                    m_iheads.emplace_back(fidx);
+                    placement.kind = HeadPlacement::PINHEAD;
                 } else if( polar >= 3*PI/4 ) {
                     // Headless supports do not tilt like the headed ones so
                     // the normal should point almost to the ground.
-                    m_iheadless.emplace_back(fidx);
+                    placement.kind = HeadPlacement::HEADLESS;
                 }
             }
         }
 
+        // Placements of the removed or moved points are dropped here.
+        cache.swap(placements);
+
+        for(unsigned fidx : filtered_indices) {
+            const HeadPlacement& placement =
+                    cache[placement_key(m_support_pts[fidx])];
+
+            switch(placement.kind) {
+            case HeadPlacement::PINHEAD: m_iheads.emplace_back(fidx); break;
+            case HeadPlacement::HEADLESS: m_iheadless.emplace_back(fidx); break;
+            case HeadPlacement::DISCARDED: continue;
+            }
+
+            m_support_nmls.row(fidx) = placement.normal;
+        }
+
         m_thr();
     }
 
@@ -1578,12 +1746,20 @@ public:
             m_thr();
 
             auto& head = m_result.head(i);
-            Vec3d n(0, 0, -1);
-            double r = head.r_back_mm;
-            Vec3d headjp = head.junction_point();
+            HeadPlacement& placement =
+                    m_result.placements()[placement_key(m_support_pts[i])];
+
+            if(!placement.classified) {
+                Vec3d n(0, 0, -1);
+                double r = head.r_back_mm;
+                Vec3d headjp = head.junction_point();
 
-            // collision check
-            auto hit = bridge_mesh_intersect(headjp, n, r);
+                // collision check
+                placement.ground_hit = bridge_mesh_intersect(headjp, n, r);
+                placement.classified = true;
+            }
+
+            const EigenMesh3D::hit_result& hit = placement.ground_hit;
 
             if(std::isinf(hit.distance())) ground_head_indices.emplace_back(i);
             else if(m_cfg.ground_facing_only)  head.invalidate();
@@ -2097,6 +2273,8 @@ bool SLASupportTree::generate(const std::vector<SupportPoint> &support_points,
 {
     if(support_points.empty()) return false;
 
+    m_impl->set_placement_source(mesh, cfg);
+
     Algorithm alg(cfg, mesh, support_points, *m_impl, ctl.cancelfn);
 
     // Let's define the individual steps of the processing. We can experiment
@@ -2287,6 +2465,22 @@ void SLASupportTree::remove_pad()
     m_impl->remove_pad();
 }
 
+const Pointf3s &SLASupportTree::head_junctions() const
+{
+    return get().head_junctions();
+}
+
+const std::vector<std::pair<Vec3d, Vec3d>> &
+SLASupportTree::pillar_endpoints() const
+{
+    return get().pillar_endpoints();
+}
+
+size_t SLASupportTree::reused_placements() const
+{
+    return get().reused_placements;
+}
+
 SLASupportTree::SLASupportTree(const std::vector<SupportPoint> &points,
                                const EigenMesh3D& emesh,
                                const SupportConfig &cfg,
@@ -2298,6 +2492,21 @@ SLASupportTree::SLASupportTree(const std::vector<SupportPoint> &points,
     m_impl->clear_support_data();
 }
 
+SLASupportTree::SLASupportTree(const std::vector<SupportPoint> &points,
+                               const EigenMesh3D& emesh,
+                               const SupportConfig &cfg,
+                               const Controller &ctl,
+                               const SLASupportTree &previous):
+    m_impl(new Impl(ctl))
+{
+    m_impl->ground_level = emesh.ground_level() - cfg.object_elevation_mm;
+    if(!m_impl->reuse_placements(previous.get(), emesh, cfg))
+        BOOST_LOG_TRIVIAL(debug) << "Head placements of the previous support "
+                                    "tree are not applicable";
+    generate(points, emesh, cfg, ctl);
+    m_impl->clear_support_data();
+}
+
 SLASupportTree::SLASupportTree(const SLASupportTree &c):
     m_impl(new Impl(*c.m_impl)) {}
 
@@ -167,6 +167,16 @@ public:
                    const SupportConfig& cfg = {},
                    const Controller& ctl = {});
 
+    /// Generate the supports for an edited set of support points. The head
+    /// placements of the points which are also present in the previous tree,
+    /// generated on the same mesh object, are taken over from it, only the new
+    /// points are evaluated against the model. The routing is done anew.
+    SLASupportTree(const std::vector<SupportPoint>& pts,
+                   const EigenMesh3D& em,
+                   const SupportConfig& cfg,
+                   const Controller& ctl,
+                   const SLASupportTree& previous);
+
     SLASupportTree(const SLASupportTree&);
     SLASupportTree& operator=(const SLASupportTree&);
 
@@ -192,6 +202,16 @@ public:
 
     void remove_pad();
 
+    /// Get the junction points of the valid heads, ordered by the index of
+    /// their support point
+    const Pointf3s& head_junctions() const;
+
+    /// Get the start and end points of the pillars
+    const std::vector<std::pair<Vec3d, Vec3d>>& pillar_endpoints() const;
+
+    /// Get the count of the head placements taken over from the previous tree
+    size_t reused_placements() const;
+
 };
 
 }
@@ -1,7 +1,9 @@
 #include <cmath>
+#include <array>
 #include "SLA/SLASupportTree.hpp"
 #include "SLA/SLABoilerPlate.hpp"
 #include "SLA/SLASpatIndex.hpp"
+#include "SLA/SLARayBVH.hpp"
 
 // Workaround: IGL signed_distance.h will define PI in the igl namespace.
 #undef PI
@@ -102,6 +104,10 @@ void SpatIndex::foreach(std::function<void (const SpatElement &)> fn)
 
 class EigenMesh3D::AABBImpl: public igl::AABB<Eigen::MatrixXd, 3> {
 public:
+    // Flattened tree for the ray casting, the igl tree serves the distance
+    // queries.
+    RayBVH raytree;
+
 #ifdef SLIC3R_SLA_NEEDS_WINDTREE
     igl::WindingNumberAABB<Vec3d, Eigen::MatrixXd, Eigen::MatrixXi> windtree;
 #endif /* SLIC3R_SLA_NEEDS_WINDTREE */
@@ -136,6 +142,7 @@ EigenMesh3D::EigenMesh3D(const TriangleMesh& tmesh): m_aabb(new AABBImpl()) {
 
     // Build the AABB accelaration tree
     m_aabb->init(m_V, m_F);
+    m_aabb->raytree.build(m_V, m_F);
 #ifdef SLIC3R_SLA_NEEDS_WINDTREE
     m_aabb->windtree.set_mesh(m_V, m_F);
 #endif /* SLIC3R_SLA_NEEDS_WINDTREE */
@@ -158,19 +165,38 @@ EigenMesh3D &EigenMesh3D::operator=(const EigenMesh3D &other)
 EigenMesh3D::hit_result
 EigenMesh3D::query_ray_hit(const Vec3d &s, const Vec3d &dir) const
 {
-    igl::Hit hit;
-    hit.t = std::numeric_limits<float>::infinity();
-    m_aabb->intersect_ray(m_V, m_F, s, dir, hit);
+    RayBVH::Hit hit = m_aabb->raytree.intersect(s, dir);
 
     hit_result ret(*this);
-    ret.m_t = double(hit.t);
+    ret.m_t = hit.t;
     ret.m_dir = dir;
     ret.m_source = s;
-    if(!std::isinf(hit.t) && !std::isnan(hit.t)) ret.m_face_id = hit.id;
+    ret.m_face_id = hit.face;
 
     return ret;
 }
 
+void EigenMesh3D::query_ray_hits(size_t n,
+                                 const Vec3d *sources,
+                                 const Vec3d *dirs,
+                                 hit_result *hits) const
+{
+    std::array<RayBVH::Hit, RayBVH::RaysInPacket> packet;
+    for(size_t i = 0; i < n; i += packet.size()) {
+        size_t cnt = std::min(packet.size(), n - i);
+        m_aabb->raytree.intersect(cnt, sources + i, dirs + i, packet.data());
+
+        for(size_t k = 0; k < cnt; ++k) {
+            hit_result& ret = hits[i + k];
+            ret = hit_result(*this);
+            ret.m_t = packet[k].t;
+            ret.m_dir = dirs[i + k];
+            ret.m_source = sources[i + k];
+            ret.m_face_id = packet[k].face;
+        }
+    }
+}
+
 #ifdef SLIC3R_SLA_NEEDS_WINDTREE
 EigenMesh3D::si_result EigenMesh3D::signed_distance(const Vec3d &p) const {
     double sign = 0; double sqdst = 0; int i = 0;  Vec3d c;
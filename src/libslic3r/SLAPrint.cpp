@@ -35,8 +35,12 @@ public:
     std::vector<sla::SupportPoint>
                    support_points;      // all the support points (manual/auto)
     SupportTreePtr support_tree_ptr;    // the supports
+    SupportTreePtr previous_tree_ptr;   // supports of the previous points
     SlicedSupports support_slices;      // sliced supports
 
+    // Islands of the model slices for the support point generation
+    SLAAutoSupports::IslandCache island_cache;
+
     inline SupportData(const TriangleMesh &trmesh) : emesh(trmesh) {}
 };
 
@@ -158,11 +162,15 @@ SLAPrint::ApplyStatus SLAPrint::apply(const Model &model, const DynamicPrintConf
     config.option("sla_material_settings_id", true);
     config.option("printer_settings_id",      true);
     config.normalize();
-    // Collect changes to print config.
-    t_config_option_keys print_diff    = m_print_config.diff(config);
-    t_config_option_keys printer_diff  = m_printer_config.diff(config);
-    t_config_option_keys material_diff = m_material_config.diff(config);
-    t_config_option_keys object_diff   = m_default_object_config.diff(config);
+    // Collect changes to print config. The option ids address the static configs directly, the keys are only needed
+    // for the invalidation of the print steps.
+    ConfigOptionIdSet    print_diff_ids    = m_print_config.diff_ids(config);
+    ConfigOptionIdSet    printer_diff_ids  = m_printer_config.diff_ids(config);
+    ConfigOptionIdSet    material_diff_ids = m_material_config.diff_ids(config);
+    t_config_option_keys print_diff        = print_config_def.keys(print_diff_ids);
+    t_config_option_keys printer_diff      = print_config_def.keys(printer_diff_ids);
+    t_config_option_keys material_diff     = print_config_def.keys(material_diff_ids);
+    ConfigOptionIdSet    object_diff       = m_default_object_config.diff_ids(config);
     t_config_option_keys placeholder_parser_diff = this->placeholder_parser().config_diff(config);
 
     // Do not use the ApplyStatus as we will use the max function when updating apply_status.
@@ -197,10 +205,10 @@ SLAPrint::ApplyStatus SLAPrint::apply(const Model &model, const DynamicPrintConf
     }
 
     // It is also safe to change m_config now after this->invalidate_state_by_config_options() call.
-    m_print_config.apply_only(config, print_diff, true);
-    m_printer_config.apply_only(config, printer_diff, true);
+    m_print_config.apply_only(config, print_diff_ids, true);
+    m_printer_config.apply_only(config, printer_diff_ids, true);
     // Handle changes to material config.
-    m_material_config.apply_only(config, material_diff, true);
+    m_material_config.apply_only(config, material_diff_ids, true);
     // Handle changes to object config defaults
     m_default_object_config.apply_only(config, object_diff, true);
 
@@ -563,6 +571,23 @@ void SLAPrint::finalize()
         m_stepmask[istep] = true;
 }
 
+void SLAPrint::export_raster(const std::string& fpath,
+                             const std::string& projectname)
+{
+    if(! m_printer) return;
+    
+    m_printer->save(fpath, projectname, unsigned(m_printer_input.size()),
+                    [this](sla::Raster& raster, unsigned level_id) {
+        for(const ClipperLib::Polygon& poly :
+            m_printer_input[level_id].transformed_slices())
+            m_printer->draw_polygon(poly, raster);
+    },
+    [this](unsigned st) {
+        this->set_status(int(st), L("Exporting rasterized layers"));
+    },
+    [this]() { this->throw_if_canceled(); });
+}
+
 // Generate a recommended output file name based on the format template, default extension, and template parameters
 // (timestamps, object placeholders derived from the model, current placeholder prameters and print statistics.
 // Use the final print statistics if available, or just keep the print statistics placeholders if not available yet (before the output is finalized).
@@ -692,6 +717,9 @@ void SLAPrint::process()
     auto slice_model = [this, ilhs, ilh](SLAPrintObject& po) {
         const TriangleMesh& mesh = po.transformed_mesh();
 
+        // The cached islands refer to the slices which are about to change.
+        if(po.m_supportdata) po.m_supportdata->island_cache.clear();
+
         // We need to prepare the slice index...
 
         double lhd  = m_objects.front()->m_config.layer_height.getFloat();
@@ -758,8 +786,21 @@ void SLAPrint::process()
     // support points. Then we sprinkle the rest of the mesh.
     auto support_points = [this, ostepd](SLAPrintObject& po) {
         const ModelObject& mo = *po.m_model_object;
-        po.m_supportdata.reset(
+
+        // The transformed mesh does not change during the lifetime of the
+        // print object so the support data is created only once. The support
+        // tree of the previous support points is set aside, the unchanged
+        // points will take over their head placements from it.
+        if(po.m_supportdata) {
+            auto& sd = *po.m_supportdata;
+            if(sd.support_tree_ptr)
+                sd.previous_tree_ptr = std::move(sd.support_tree_ptr);
+            sd.support_points.clear();
+            sd.support_slices.clear();
+        } else {
+            po.m_supportdata.reset(
                     new SLAPrintObject::SupportData(po.transformed_mesh()) );
+        }
 
         // If supports are disabled, we can skip the model scan.
         if(!po.m_config.supports_enable.getBool()) return;
@@ -811,7 +852,8 @@ void SLAPrint::process()
                                           heights,
                                           config,
                                           [this]() { throw_if_canceled(); },
-                                          statuscb);
+                                          statuscb,
+                                          &po.m_supportdata->island_cache);
 
             // Now let's extract the result.
             const std::vector<sla::SupportPoint>& points = auto_supports.output();
@@ -860,9 +902,22 @@ void SLAPrint::process()
         ctl.stopcondition = [this](){ return canceled(); };
         ctl.cancelfn = [this]() { throw_if_canceled(); };
 
-        po.m_supportdata->support_tree_ptr.reset(
-                    new SLASupportTree(po.m_supportdata->support_points,
-                                       po.m_supportdata->emesh, scfg, ctl));
+        // Take over the head placements from the most recent support tree,
+        // which is the current one if only the tree parameters have changed.
+        auto& sd = *po.m_supportdata;
+        const SLASupportTree *prev = sd.support_tree_ptr ?
+                    sd.support_tree_ptr.get() : sd.previous_tree_ptr.get();
+
+        if(prev)
+            sd.support_tree_ptr.reset(
+                        new SLASupportTree(sd.support_points, sd.emesh, scfg,
+                                           ctl, *prev));
+        else
+            sd.support_tree_ptr.reset(
+                        new SLASupportTree(sd.support_points, sd.emesh, scfg,
+                                           ctl));
+
+        sd.previous_tree_ptr.reset();
 
         throw_if_canceled();
 
@@ -1292,6 +1347,10 @@ void SLAPrint::process()
     };
 
     // Rasterizing the model objects, and their supports
+    // The layers are rasterized and compressed by export_raster(), which
+    // streams them into the archive, so that the rasters of all the layers
+    // are never held in memory at once. The following exports copy the
+    // images encoded by the first one.
     auto rasterize = [this]() {
         if(canceled()) return;
 
@@ -1302,66 +1361,6 @@ void SLAPrint::process()
                                            layerh));
         }
 
-        // Allocate space for all the layers
-        SLAPrinter& printer = *m_printer;
-        auto lvlcnt = unsigned(m_printer_input.size());
-        printer.layers(lvlcnt);
-
-        // coefficient to map the rasterization state (0-99) to the allocated
-        // portion (slot) of the process state
-        double sd = (100 - max_objstatus) / 100.0;
-
-        // slot is the portion of 100% that is realted to rasterization
-        unsigned slot = PRINT_STEP_LEVELS[slapsRasterize];
-
-        // pst: previous state
-        double pst = m_report_status.status();
-
-        double increment = (slot * sd) / m_printer_input.size();
-        double dstatus = m_report_status.status();
-
-        SpinMutex slck;
-
-        // procedure to process one height level. This will run in parallel
-        auto lvlfn =
-        [this, &slck, &printer, increment, &dstatus, &pst]
-            (unsigned level_id)
-        {
-            if(canceled()) return;
-
-            PrintLayer& printlayer = m_printer_input[level_id];
-
-            // Switch to the appropriate layer in the printer
-            printer.begin_layer(level_id);
-
-            for(const ClipperLib::Polygon& poly : printlayer.transformed_slices())
-                printer.draw_polygon(poly, level_id);
-
-            // Finish the layer for later saving it.
-            printer.finish_layer(level_id);
-
-            // Status indication guarded with the spinlock
-            {
-                std::lock_guard<SpinMutex> lck(slck);
-                dstatus += increment;
-                double st = std::round(dstatus);
-                if(st > pst) {
-                    m_report_status(*this, st,
-                                    PRINT_STEP_LABELS(slapsRasterize));
-                    pst = st;
-                }
-            }
-        };
-
-        // last minute escape
-        if(canceled()) return;
-
-        // Sequential version (for testing)
-        // for(unsigned l = 0; l < lvlcnt; ++l) process_level(l);
-
-        // Print all the layers in parallel
-        tbb::parallel_for<unsigned, decltype(lvlfn)>(0, lvlcnt, lvlfn);
-
         // Set statistics values to the printer
         m_printer->set_statistics(
             {(m_print_statistics.objects_used_material
@@ -358,11 +358,9 @@ public:
     // Returns true if the last step was finished with success.
     bool                finished() const override { return this->is_step_done(slaposSliceSupports) && this->Inherited::is_step_done(slapsRasterize); }
 
-    inline void export_raster(const std::string& fpath,
-                              const std::string& projectname = "")
-    {
-        if(m_printer) m_printer->save(fpath, projectname);
-    }
+    // Rasterizes the layers and writes them into a zipped archive.
+    void export_raster(const std::string& fpath,
+                       const std::string& projectname = "");
 
     const PrintObjects& objects() const { return m_objects; }
 
@@ -0,0 +1,153 @@
+#include "ShortestPath.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace Slic3r {
+
+// Squared distance evaluated exactly the way Point::nearest_point_index() evaluates it, so that the ties are resolved identically.
+static inline double chain_distance2(const Point &a, const Point &b)
+{
+    double d = sqr<double>(a(0) - b(0));
+    d += sqr<double>(a(1) - b(1));
+    return d;
+}
+
+// KD tree over the end points of the segments, from which the segments are removed as they are being chained.
+// The tree is stored implicitly in a single array: The node of a range [lo, hi) is stored at (lo + hi) / 2,
+// its left subtree in [lo, mid) and its right subtree in [mid + 1, hi), the split axis alternates with the depth.
+// Each node keeps the number of end points still alive in its subtree, so that the emptied subtrees are skipped.
+class ChainEndPointIndex
+{
+public:
+    ChainEndPointIndex(const std::vector<ChainSegment> &segments) : m_position(segments.size() * 2, size_t(-1))
+    {
+        m_nodes.reserve(segments.size() * 2);
+        for (size_t i = 0; i < segments.size(); ++ i) {
+            m_nodes.push_back({ segments[i].first, 2 * i });
+            if (segments[i].can_reverse)
+                m_nodes.push_back({ segments[i].last, 2 * i + 1 });
+        }
+        m_alive.assign(m_nodes.size(), true);
+        m_count.assign(m_nodes.size(), 0);
+        this->build(0, m_nodes.size(), 0);
+        for (size_t i = 0; i < m_nodes.size(); ++ i)
+            m_position[m_nodes[i].key] = i;
+    }
+
+    // Returns the key (2 * segment index + reversed) of the alive end point closest to pt.
+    size_t nearest(const Point &pt, ChainTies ties) const
+    {
+        Nearest out { pt, std::numeric_limits<double>::max(), size_t(-1), ties == ChainTies::PreferLast };
+        this->nearest(out, 0, m_nodes.size(), 0);
+        return out.key;
+    }
+
+    void remove_segment(size_t segment_idx)
+    {
+        for (size_t key = 2 * segment_idx; key < 2 * segment_idx + 2; ++ key)
+            if (m_position[key] != size_t(-1))
+                this->remove(m_position[key]);
+    }
+
+private:
+    struct Node
+    {
+        Point   pt;
+        size_t  key;
+    };
+    struct Nearest
+    {
+        Point   pt;
+        double  dist2;
+        size_t  key;
+        bool    prefer_last;
+
+        bool    better(double d, size_t k) const {
+            return d < dist2 || (d == dist2 && ((prefer_last && d > 0.) ? k > key : k < key));
+        }
+    };
+
+    void build(size_t lo, size_t hi, int axis)
+    {
+        if (lo >= hi)
+            return;
+        size_t mid = (lo + hi) / 2;
+        std::nth_element(m_nodes.begin() + lo, m_nodes.begin() + mid, m_nodes.begin() + hi,
+            [axis](const Node &a, const Node &b) { return a.pt(axis) < b.pt(axis); });
+        m_count[mid] = hi - lo;
+        this->build(lo, mid, 1 - axis);
+        this->build(mid + 1, hi, 1 - axis);
+    }
+
+    void remove(size_t pos)
+    {
+        assert(m_alive[pos]);
+        m_alive[pos] = false;
+        for (size_t lo = 0, hi = m_nodes.size();;) {
+            size_t mid = (lo + hi) / 2;
+            -- m_count[mid];
+            if (pos == mid)
+                break;
+            if (pos < mid)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+    }
+
+    void nearest(Nearest &out, size_t lo, size_t hi, int axis) const
+    {
+        if (lo >= hi)
+            return;
+        size_t mid = (lo + hi) / 2;
+        if (m_count[mid] == 0)
+            return;
+        const Node &node = m_nodes[mid];
+        if (m_alive[mid]) {
+            double d = chain_distance2(out.pt, node.pt);
+            if (out.better(d, node.key)) {
+                out.dist2 = d;
+                out.key   = node.key;
+            }
+        }
+        coord_t diff = out.pt(axis) - node.pt(axis);
+        // The points of the left subtree are not above the split, the points of the right subtree are not below it.
+        // Visit the far subtree unless it is strictly further than the best point found, so that the ties are resolved
+        // by the key independently of the tree layout.
+        if (diff <= 0) {
+            this->nearest(out, lo, mid, 1 - axis);
+            if (sqr<double>(diff) <= out.dist2)
+                this->nearest(out, mid + 1, hi, 1 - axis);
+        } else {
+            this->nearest(out, mid + 1, hi, 1 - axis);
+            if (sqr<double>(diff) <= out.dist2)
+                this->nearest(out, lo, mid, 1 - axis);
+        }
+    }
+
+    std::vector<Node>   m_nodes;
+    std::vector<bool>   m_alive;
+    std::vector<size_t> m_count;
+    // Position of an end point in m_nodes indexed by its key, size_t(-1) for the last points of the non-reversible segments.
+    std::vector<size_t> m_position;
+};
+
+ChainOrder chain_segments_greedy(const std::vector<ChainSegment> &segments, const Point &start_near, ChainTies ties)
+{
+    ChainOrder out;
+    out.reserve(segments.size());
+    ChainEndPointIndex index(segments);
+    Point pt = start_near;
+    for (size_t i = 0; i < segments.size(); ++ i) {
+        size_t key         = index.nearest(pt, ties);
+        size_t segment_idx = key / 2;
+        bool   reversed    = (key & 1) != 0;
+        out.emplace_back(segment_idx, reversed);
+        index.remove_segment(segment_idx);
+        pt = reversed ? segments[segment_idx].first : segments[segment_idx].last;
+    }
+    return out;
+}
+
+} // namespace Slic3r
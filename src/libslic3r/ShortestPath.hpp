@@ -0,0 +1,43 @@
+#ifndef slic3r_ShortestPath_hpp_
+#define slic3r_ShortestPath_hpp_
+
+#include "libslic3r.h"
+#include "Point.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace Slic3r {
+
+// A segment to be chained: A polyline or an extrusion entity represented by its end points.
+struct ChainSegment
+{
+    Point   first;
+    Point   last;
+    // Is it allowed to traverse the segment from last to first?
+    bool    can_reverse;
+};
+
+// Order of the chained segments: Pairs of the segment index and a flag whether the segment is traversed reversed.
+typedef std::vector<std::pair<size_t, bool>> ChainOrder;
+
+// How the ties of the distances to the end points are resolved by chain_segments_greedy().
+enum class ChainTies {
+    // In favor of the lower segment index and of the first point over the last point,
+    // as the former linear search of PolylineCollection did.
+    PreferFirst,
+    // In favor of the higher segment index and of the last point over the first point, unless the end point coincides
+    // with the point searched for, when the first coincident end point wins. This is how Point::nearest_point_index(),
+    // used by the former linear search of ExtrusionEntityCollection, resolves the ties.
+    PreferLast,
+};
+
+// Greedy chaining: Starting at start_near, repeatedly pick the segment with the end point closest to the end of the last
+// picked segment. The last point of a segment, which cannot be reversed, is only used to continue the chain.
+// With the ties resolved as the former linear searches over the remaining segments did, the result is identical to theirs.
+// The closest end point is searched for in a KD tree of the end points, making the chaining O(n log n) instead of O(n^2).
+ChainOrder chain_segments_greedy(const std::vector<ChainSegment> &segments, const Point &start_near, ChainTies ties = ChainTies::PreferFirst);
+
+} // namespace Slic3r
+
+#endif /* slic3r_ShortestPath_hpp_ */
@@ -0,0 +1,415 @@
+#include "SliceCache.hpp"
+#include "TriangleMesh.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/cstdio.hpp>
+
+namespace Slic3r {
+
+// Two lanes of a 64bit multiply-xorshift hash, seeded differently, giving a 128bit digest.
+class SliceCacheDigest
+{
+public:
+    void add(uint64_t v)
+    {
+        m_lo = mix(m_lo ^ v, 0xbf58476d1ce4e5b9ull);
+        m_hi = mix(m_hi + v, 0x94d049bb133111ebull);
+    }
+    void add_float(float f)
+    {
+        uint32_t v;
+        memcpy(&v, &f, sizeof(v));
+        this->add(v);
+    }
+    SliceCache::Key key() const
+    {
+        SliceCache::Key key;
+        key.lo = m_lo;
+        key.hi = m_hi;
+        return key;
+    }
+
+private:
+    static uint64_t mix(uint64_t h, uint64_t mul)
+    {
+        h = (h ^ (h >> 30)) * mul;
+        h = (h ^ (h >> 27)) * 0x9e3779b97f4a7c15ull;
+        return h ^ (h >> 31);
+    }
+
+    uint64_t m_lo = 0x243f6a8885a308d3ull;
+    uint64_t m_hi = 0x13198a2e03707344ull;
+};
+
+// Version of the slicing algorithm, salting the digest. Increase it with any change of TriangleMeshSlicer
+// or of the post-processing of its output, which may change the sliced layers, so that the layers cached
+// on disk by the former version are not reused. The digest is salted with the build ID as well, so that
+// a bump of the version forgotten in a development build does not reach the users.
+static const uint64_t SLICE_CACHE_ALGORITHM_VERSION = 1;
+
+std::string SliceCache::Key::to_string() const
+{
+    char buf[33];
+    sprintf(buf, "%016llx%016llx", (unsigned long long)hi, (unsigned long long)lo);
+    return std::string(buf);
+}
+
+SliceCache::Key SliceCache::make_key(const TriangleMesh &mesh, const std::vector<float> &z, float closing_radius)
+{
+    SliceCacheDigest digest;
+    digest.add(SLICE_CACHE_ALGORITHM_VERSION);
+    for (const char *c = SLIC3R_BUILD_ID; *c != 0; ++ c)
+        digest.add(uint64_t((unsigned char)*c));
+    digest.add(mesh.stl.stats.number_of_facets);
+    for (const stl_facet &facet : mesh.stl.facet_start) {
+        // Hash the vertices only, the slicer ignores the normals.
+        for (const stl_vertex &v : facet.vertex)
+            for (size_t i = 0; i < 3; ++ i)
+                digest.add_float(v(i));
+    }
+    digest.add(z.size());
+    for (float zz : z)
+        digest.add_float(zz);
+    digest.add_float(closing_radius);
+    SliceCache::Key key = digest.key();
+    key.num_layers = z.size();
+    key.num_facets = size_t(mesh.stl.stats.number_of_facets);
+    return key;
+}
+
+bool SliceCache::enabled() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_memory_limit > 0 || ! m_directory.empty();
+}
+
+static size_t layers_memsize(const std::vector<ExPolygons> &layers)
+{
+    size_t out = sizeof(layers) + SLIC3R_STDVEC_MEMSIZE(layers, ExPolygons);
+    for (const ExPolygons &expolygons : layers) {
+        out += SLIC3R_STDVEC_MEMSIZE(expolygons, ExPolygon);
+        for (const ExPolygon &expoly : expolygons) {
+            out += SLIC3R_STDVEC_MEMSIZE(expoly.contour.points, Point) + SLIC3R_STDVEC_MEMSIZE(expoly.holes, Polygon);
+            for (const Polygon &hole : expoly.holes)
+                out += SLIC3R_STDVEC_MEMSIZE(hole.points, Point);
+        }
+    }
+    return out;
+}
+
+// The on-disk encoding: A magic header, the number of facets of the mesh and the number of layers followed by the layers,
+// where all the counts are stored as variable length integers and the polygon points are stored as zig-zag encoded
+// variable length differences to the preceding point.
+static const char SLICE_CACHE_MAGIC[8] = { 'S', 'L', 'C', 'A', 'C', 'H', 'E', '2' };
+
+static void encode_varint(std::string &out, uint64_t v)
+{
+    for (; v >= 0x80; v >>= 7)
+        out += char((v & 0x7f) | 0x80);
+    out += char(v);
+}
+
+static void encode_polygon(std::string &out, const Polygon &polygon)
+{
+    encode_varint(out, polygon.points.size());
+    int64_t x = 0, y = 0;
+    for (const Point &pt : polygon.points) {
+        int64_t dx = int64_t(pt(0)) - x;
+        int64_t dy = int64_t(pt(1)) - y;
+        encode_varint(out, (uint64_t(dx) << 1) ^ uint64_t(dx >> 63));
+        encode_varint(out, (uint64_t(dy) << 1) ^ uint64_t(dy >> 63));
+        x = pt(0);
+        y = pt(1);
+    }
+}
+
+class SliceCacheDecoder
+{
+public:
+    SliceCacheDecoder(const std::string &data) : m_ptr(data.data()), m_end(data.data() + data.size()) {}
+
+    // Fails if the data is corrupted or if the header does not match the key.
+    bool decode(const SliceCache::Key &key, std::vector<ExPolygons> &layers)
+    {
+        if (size_t(m_end - m_ptr) < sizeof(SLICE_CACHE_MAGIC) || memcmp(m_ptr, SLICE_CACHE_MAGIC, sizeof(SLICE_CACHE_MAGIC)) != 0)
+            return false;
+        m_ptr += sizeof(SLICE_CACHE_MAGIC);
+        uint64_t num_facets, num_layers;
+        if (! this->varint(num_facets) || num_facets != key.num_facets ||
+            ! this->varint(num_layers) || num_layers != key.num_layers || num_layers > uint64_t(m_end - m_ptr))
+            return false;
+        layers.assign(size_t(num_layers), ExPolygons());
+        for (ExPolygons &expolygons : layers) {
+            uint64_t num_expolygons;
+            if (! this->varint(num_expolygons) || num_expolygons > uint64_t(m_end - m_ptr))
+                return false;
+            expolygons.assign(size_t(num_expolygons), ExPolygon());
+            for (ExPolygon &expoly : expolygons) {
+                uint64_t num_holes;
+                if (! this->polygon(expoly.contour) || ! this->varint(num_holes) || num_holes > uint64_t(m_end - m_ptr))
+                    return false;
+                expoly.holes.assign(size_t(num_holes), Polygon());
+                for (Polygon &hole : expoly.holes)
+                    if (! this->polygon(hole))
+                        return false;
+            }
+        }
+        return m_ptr == m_end;
+    }
+
+private:
+    bool varint(uint64_t &v)
+    {
+        v = 0;
+        for (int shift = 0; shift < 64 && m_ptr != m_end; shift += 7) {
+            unsigned char c = (unsigned char)*m_ptr ++;
+            v |= uint64_t(c & 0x7f) << shift;
+            if ((c & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool polygon(Polygon &polygon)
+    {
+        uint64_t num_points;
+        if (! this->varint(num_points) || num_points > uint64_t(m_end - m_ptr))
+            return false;
+        polygon.points.reserve(size_t(num_points));
+        int64_t x = 0, y = 0;
+        for (uint64_t i = 0; i < num_points; ++ i) {
+            uint64_t dx, dy;
+            if (! this->varint(dx) || ! this->varint(dy))
+                return false;
+            x += int64_t(dx >> 1) ^ - int64_t(dx & 1);
+            y += int64_t(dy >> 1) ^ - int64_t(dy & 1);
+            polygon.points.emplace_back(coord_t(x), coord_t(y));
+        }
+        return true;
+    }
+
+    const char *m_ptr;
+    const char *m_end;
+};
+
+static std::string encode_layers(const SliceCache::Key &key, const std::vector<ExPolygons> &layers)
+{
+    std::string out(SLICE_CACHE_MAGIC, sizeof(SLICE_CACHE_MAGIC));
+    encode_varint(out, key.num_facets);
+    encode_varint(out, layers.size());
+    for (const ExPolygons &expolygons : layers) {
+        encode_varint(out, expolygons.size());
+        for (const ExPolygon &expoly : expolygons) {
+            encode_polygon(out, expoly.contour);
+            encode_varint(out, expoly.holes.size());
+            for (const Polygon &hole : expoly.holes)
+                encode_polygon(out, hole);
+        }
+    }
+    return out;
+}
+
+bool SliceCache::get(const Key &key, std::vector<ExPolygons> &layers)
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_map.find(key);
+        if (it != m_map.end()) {
+            // Move the entry to the front of the LRU list.
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            layers = it->second->layers;
+            return true;
+        }
+        if (m_directory.empty())
+            return false;
+        path = this->file_path(key);
+    }
+
+    FILE *file = boost::nowide::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+        return false;
+    std::string data;
+    char        buf[65536];
+    for (size_t len; (len = fread(buf, 1, sizeof(buf), file)) > 0;)
+        data.append(buf, len);
+    fclose(file);
+    boost::system::error_code ec;
+    if (! SliceCacheDecoder(data).decode(key, layers)) {
+        // Delete the file, so that it is replaced with the freshly sliced layers.
+        BOOST_LOG_TRIVIAL(warning) << "SliceCache: Deleting a corrupted cache file " << path;
+        layers.clear();
+        boost::filesystem::remove(path, ec);
+        return false;
+    }
+    BOOST_LOG_TRIVIAL(debug) << "SliceCache: Loaded " << layers.size() << " layers from " << path;
+    // Mark the file as recently used for trim_directory().
+    boost::filesystem::last_write_time(path, std::time(nullptr), ec);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    this->insert_in_memory(key, layers);
+    return true;
+}
+
+void SliceCache::put(const Key &key, const std::vector<ExPolygons> &layers)
+{
+    assert(layers.size() == key.num_layers);
+    if (layers.size() != key.num_layers)
+        return;
+
+    std::string path;
+    std::string dir;
+    size_t      disk_limit;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        this->insert_in_memory(key, layers);
+        if (m_directory.empty())
+            return;
+        path       = this->file_path(key);
+        dir        = m_directory;
+        disk_limit = m_disk_limit;
+    }
+
+    // Write into a temporary file first and rename it, so that a concurrently running slicer never reads a partially written file.
+    std::string data = encode_layers(key, layers);
+    boost::filesystem::path path_tmp = boost::filesystem::unique_path(path + ".%%%%-%%%%.tmp");
+    FILE *file = boost::nowide::fopen(path_tmp.string().c_str(), "wb");
+    if (file == nullptr) {
+        BOOST_LOG_TRIVIAL(warning) << "SliceCache: Cannot write " << path_tmp.string();
+        return;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = (fclose(file) == 0) && ok;
+    boost::system::error_code ec;
+    if (ok)
+        boost::filesystem::rename(path_tmp, path, ec);
+    if (! ok || ec) {
+        BOOST_LOG_TRIVIAL(warning) << "SliceCache: Cannot write " << path;
+        boost::filesystem::remove(path_tmp, ec);
+    } else if (disk_limit > 0)
+        trim_directory(dir, disk_limit);
+}
+
+void SliceCache::trim_directory(const std::string &dir, size_t limit)
+{
+    struct CacheFile
+    {
+        boost::filesystem::path path;
+        uintmax_t               size;
+        std::time_t             time;
+    };
+    std::vector<CacheFile> files;
+    uintmax_t              total = 0;
+    boost::system::error_code ec;
+    for (boost::filesystem::directory_iterator it(dir, ec), end; ! ec && it != end; it.increment(ec)) {
+        const boost::filesystem::path &path = it->path();
+        if (path.extension() != ".slices")
+            continue;
+        boost::system::error_code ec_size, ec_time;
+        CacheFile file { path, boost::filesystem::file_size(path, ec_size), boost::filesystem::last_write_time(path, ec_time) };
+        // Skip the files deleted by a concurrently running slicer.
+        if (! ec_size && ! ec_time) {
+            total += file.size;
+            files.emplace_back(std::move(file));
+        }
+    }
+    if (total <= limit)
+        return;
+    // Delete the least recently used files first.
+    std::sort(files.begin(), files.end(), [](const CacheFile &l, const CacheFile &r) { return l.time < r.time; });
+    for (const CacheFile &file : files) {
+        if (total <= limit)
+            break;
+        boost::filesystem::remove(file.path, ec);
+        total -= file.size;
+    }
+    BOOST_LOG_TRIVIAL(debug) << "SliceCache: Trimmed the cache directory " << dir << " to " << total << " bytes";
+}
+
+void SliceCache::insert_in_memory(const Key &key, const std::vector<ExPolygons> &layers)
+{
+    if (m_map.find(key) != m_map.end())
+        return;
+    size_t memsize = layers_memsize(layers);
+    if (memsize > m_memory_limit)
+        return;
+    // Evict the least recently used entries.
+    while (m_memsize + memsize > m_memory_limit) {
+        m_memsize -= m_entries.back().memsize;
+        m_map.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+    m_entries.push_front(Entry{ key, layers, memsize });
+    m_map[key] = m_entries.begin();
+    m_memsize += memsize;
+}
+
+std::string SliceCache::file_path(const Key &key) const
+{
+    return (boost::filesystem::path(m_directory) / (key.to_string() + ".slices")).string();
+}
+
+void SliceCache::set_directory(const std::string &dir)
+{
+    boost::system::error_code ec;
+    if (! dir.empty() && ! boost::filesystem::is_directory(dir, ec)) {
+        boost::filesystem::create_directories(dir, ec);
+        if (ec)
+            BOOST_LOG_TRIVIAL(error) << "SliceCache: Cannot create the cache directory " << dir << ": " << ec.message();
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_directory = dir;
+}
+
+void SliceCache::set_disk_limit(size_t limit)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_disk_limit = limit;
+}
+
+void SliceCache::set_memory_limit(size_t limit)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memory_limit = limit;
+    while (m_memsize > m_memory_limit) {
+        m_memsize -= m_entries.back().memsize;
+        m_map.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+}
+
+void SliceCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_map.clear();
+    m_memsize = 0;
+}
+
+size_t SliceCache::memory_limit() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_memory_limit;
+}
+
+size_t SliceCache::memsize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_memsize;
+}
+
+SliceCache& SliceCache::instance()
+{
+    static SliceCache cache;
+    return cache;
+}
+
+} // namespace Slic3r
@@ -0,0 +1,97 @@
+#ifndef slic3r_SliceCache_hpp_
+#define slic3r_SliceCache_hpp_
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "libslic3r.h"
+#include "ExPolygon.hpp"
+
+namespace Slic3r {
+
+class TriangleMesh;
+
+// Cache of the layers sliced out of a mesh.
+// The layers are keyed by a digest of the mesh geometry with all the transformations applied, of the slicing heights,
+// of the slice closing radius, of the version of the slicing algorithm and of the build, therefore a hit returns exactly
+// the layers the slicer would produce.
+// The cache is disabled by default. The layers are optionally kept in memory, where the least recently used ones
+// are evicted above a memory limit, and optionally in a directory, so that they are reused by later runs
+// of the command line slicer. The least recently used files are deleted above a disk limit. The GUI enables the in-memory cache at startup (the "slice_cache_memory" preference),
+// so that re-slicing after an edit, which changes neither the geometry nor the layer heights, skips the slicing.
+class SliceCache
+{
+public:
+    struct Key
+    {
+        uint64_t    lo = 0;
+        uint64_t    hi = 0;
+        // Number of the slicing heights and of the facets, stored in the file header and validated on a hit.
+        size_t      num_layers = 0;
+        size_t      num_facets = 0;
+
+        bool        operator==(const Key &rhs) const
+            { return lo == rhs.lo && hi == rhs.hi && num_layers == rhs.num_layers && num_facets == rhs.num_facets; }
+        // Hexadecimal representation, used as a file name of the on-disk cache.
+        std::string to_string() const;
+    };
+
+    static Key  make_key(const TriangleMesh &mesh, const std::vector<float> &z, float closing_radius);
+
+    // Is either the in-memory or the on-disk cache enabled?
+    bool        enabled() const;
+
+    // Returns true and fills in the layers if the layers were found in memory or on disk.
+    // A file, which fails to decode or does not match the key, is deleted and reported as a miss.
+    bool        get(const Key &key, std::vector<ExPolygons> &layers);
+    // Stores the layers into memory and, if the directory is set, on disk.
+    // The number of layers must match the number of the slicing heights of the key.
+    void        put(const Key &key, const std::vector<ExPolygons> &layers);
+
+    // Directory of the on-disk cache. Empty string disables the on-disk cache.
+    void        set_directory(const std::string &dir);
+    // Size limit of the on-disk cache in bytes. Zero disables the limit.
+    // Storing a new file deletes the least recently used files above the limit.
+    void        set_disk_limit(size_t limit);
+    // Memory limit of the in-memory cache in bytes. Zero (the default) disables the in-memory cache.
+    void        set_memory_limit(size_t limit);
+    size_t      memory_limit() const;
+    // Clears the in-memory cache.
+    void        clear();
+    // Memory occupied by the layers of the in-memory cache in bytes.
+    size_t      memsize() const;
+
+    // Cache shared by all the PrintObjects of the application.
+    static SliceCache& instance();
+
+private:
+    struct KeyHash { size_t operator()(const Key &key) const { return size_t(key.lo ^ key.hi); } };
+    struct Entry
+    {
+        Key                         key;
+        std::vector<ExPolygons>     layers;
+        size_t                      memsize;
+    };
+
+    // Called with m_mutex locked.
+    void        insert_in_memory(const Key &key, const std::vector<ExPolygons> &layers);
+    std::string file_path(const Key &key) const;
+    // Deletes the least recently used files of the directory above the disk limit.
+    static void trim_directory(const std::string &dir, size_t limit);
+
+    mutable std::mutex              m_mutex;
+    // Most recently used entry first.
+    std::list<Entry>                m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_map;
+    size_t                          m_memsize      = 0;
+    size_t                          m_memory_limit = 0;
+    std::string                     m_directory;
+    size_t                          m_disk_limit   = 0;
+};
+
+} // namespace Slic3r
+
+#endif /* slic3r_SliceCache_hpp_ */
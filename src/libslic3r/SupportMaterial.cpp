@@ -3,6 +3,7 @@
 #include "PerimeterGenerator.hpp"
 #include "Layer.hpp"
 #include "Print.hpp"
+#include "Profiler.hpp"
 #include "SupportMaterial.hpp"
 #include "Fill/FillBase.hpp"
 #include "EdgeGrid.hpp"
@@ -218,6 +219,7 @@ struct MyLayersPtrCompare
 
 void PrintObjectSupportMaterial::generate(PrintObject &object)
 {
+    SLIC3R_PROFILE_FUNCTION();
     BOOST_LOG_TRIVIAL(info) << "Support generator - Start";
 
     coordf_t max_object_layer_height = 0.;
@@ -2454,7 +2456,7 @@ void LoopInterfaceProcessor::generate(MyLayerExtruded &top_contact_layer, const
 
     // Generate the outermost loop.
     // Find centerline of the external loop (or any other kind of extrusions should the loop be skipped)
-    ExPolygons top_contact_expolygons = offset_ex(union_ex(top_contact_layer.layer->polygons), - 0.5f * flow.scaled_width());
+    ExPolygons top_contact_expolygons = union_offset_ex(top_contact_layer.layer->polygons, - 0.5f * flow.scaled_width());
 
     // Grid size and bit shifts for quick and exact to/from grid coordinates manipulation.
     coord_t circle_grid_resolution = 1;
@@ -2480,7 +2482,7 @@ void LoopInterfaceProcessor::generate(MyLayerExtruded &top_contact_layer, const
         Polygons external_loops;
         // Holes in the external loops.
         Polygons circles;
-        Polygons overhang_with_margin = offset(union_ex(overhang_polygons), 0.5f * flow.scaled_width());
+        Polygons overhang_with_margin = union_offset(overhang_polygons, 0.5f * flow.scaled_width());
         for (ExPolygons::iterator it_contact_expoly = top_contact_expolygons.begin(); it_contact_expoly != top_contact_expolygons.end(); ++ it_contact_expoly) {
             // Store the circle centers placed for an expolygon into a regular grid, hashed by the circle centers.
             ClosestPointLookupType circle_centers_lookup(coord_t(circle_distance - SCALED_EPSILON));
@@ -2770,7 +2772,7 @@ void modulate_extrusion_by_overlapping_layers(
     for (int i_overlapping_layer = int(n_overlapping_layers) - 1; i_overlapping_layer >= 0; -- i_overlapping_layer) {
         const PrintObjectSupportMaterial::MyLayer &overlapping_layer = *overlapping_layers[i_overlapping_layer];
         ExtrusionPathFragment &frag = path_fragments[i_overlapping_layer];
-        Polygons polygons_trimming = offset(union_ex(overlapping_layer.polygons), float(scale_(0.5*extrusion_width)));
+        Polygons polygons_trimming = union_offset(overlapping_layer.polygons, float(scale_(0.5*extrusion_width)));
         frag.polylines = intersection_pl(path_fragments.back().polylines, polygons_trimming, false);
         path_fragments.back().polylines = diff_pl(path_fragments.back().polylines, polygons_trimming, false);
         // Adjust the extrusion parameters for a reduced layer height and a non-bridging flow (nozzle_dmr = -1, does not matter).
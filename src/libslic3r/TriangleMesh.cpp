@@ -692,6 +692,105 @@ void TriangleMeshSlicer::init(const TriangleMesh *_mesh, throw_on_cancel_callbac
         if ((i & 0x0ffff) == 0)
             throw_on_cancel();
     }
+
+    // Index the Z spans of the facets.
+    {
+        std::vector<std::pair<float, float>> spans;
+        spans.reserve(this->mesh->stl.stats.number_of_facets);
+        for (uint32_t facet_idx = 0; facet_idx < this->mesh->stl.stats.number_of_facets; ++ facet_idx) {
+            const stl_facet &facet = this->mesh->stl.facet_start[facet_idx];
+            spans.emplace_back(
+                fminf(facet.vertex[0](2), fminf(facet.vertex[1](2), facet.vertex[2](2))),
+                fmaxf(facet.vertex[0](2), fmaxf(facet.vertex[1](2), facet.vertex[2](2))));
+        }
+        throw_on_cancel();
+        m_facets_z_index.build(spans);
+    }
+}
+
+void TriangleMeshSlicer::FacetZIndex::build(const std::vector<std::pair<float, float>> &spans)
+{
+    this->clear();
+    m_by_min_z.reserve(spans.size());
+    m_by_max_z.reserve(spans.size());
+    std::vector<uint32_t> facets(spans.size());
+    for (uint32_t i = 0; i < uint32_t(spans.size()); ++ i)
+        facets[i] = i;
+    this->build_recursive(facets, spans);
+}
+
+int TriangleMeshSlicer::FacetZIndex::build_recursive(std::vector<uint32_t> &facets, const std::vector<std::pair<float, float>> &spans)
+{
+    if (facets.empty())
+        return -1;
+
+    // Split at the median of the facet centers. The facet with the median center crosses the split plane,
+    // therefore each node stores at least one facet and each of the subtrees receives at most half of the facets.
+    float center;
+    {
+        std::vector<float> centers;
+        centers.reserve(facets.size());
+        for (uint32_t facet_idx : facets)
+            centers.emplace_back(0.5f * (spans[facet_idx].first + spans[facet_idx].second));
+        auto it_median = centers.begin() + centers.size() / 2;
+        std::nth_element(centers.begin(), it_median, centers.end());
+        center = *it_median;
+    }
+
+    std::vector<uint32_t> below, above;
+    Node node;
+    node.center = center;
+    node.begin  = uint32_t(m_by_min_z.size());
+    for (uint32_t facet_idx : facets) {
+        const std::pair<float, float> &span = spans[facet_idx];
+        if (span.second < center)
+            below.emplace_back(facet_idx);
+        else if (span.first > center)
+            above.emplace_back(facet_idx);
+        else {
+            m_by_min_z.emplace_back(span.first,  facet_idx);
+            m_by_max_z.emplace_back(span.second, facet_idx);
+        }
+    }
+    node.end = uint32_t(m_by_min_z.size());
+    std::sort(m_by_min_z.begin() + node.begin, m_by_min_z.end(),
+        [](const std::pair<float, uint32_t> &l, const std::pair<float, uint32_t> &r) { return l.first < r.first; });
+    std::sort(m_by_max_z.begin() + node.begin, m_by_max_z.end(),
+        [](const std::pair<float, uint32_t> &l, const std::pair<float, uint32_t> &r) { return l.first > r.first; });
+    // Release the memory before descending.
+    facets.clear();
+    facets.shrink_to_fit();
+
+    int node_idx = int(m_nodes.size());
+    m_nodes.emplace_back(node);
+    int left  = this->build_recursive(below, spans);
+    int right = this->build_recursive(above, spans);
+    m_nodes[node_idx].left  = left;
+    m_nodes[node_idx].right = right;
+    return node_idx;
+}
+
+template<typename FN>
+void TriangleMeshSlicer::FacetZIndex::query(float z, FN fn) const
+{
+    for (int node_idx = m_nodes.empty() ? -1 : 0; node_idx != -1;) {
+        const Node &node = m_nodes[node_idx];
+        if (z < node.center) {
+            // All facets of this node end above z, report those starting below z.
+            for (uint32_t i = node.begin; i < node.end && m_by_min_z[i].first <= z; ++ i)
+                fn(m_by_min_z[i].second);
+            node_idx = node.left;
+        } else if (z > node.center) {
+            // All facets of this node start below z, report those ending above z.
+            for (uint32_t i = node.begin; i < node.end && m_by_max_z[i].first >= z; ++ i)
+                fn(m_by_max_z[i].second);
+            node_idx = node.right;
+        } else {
+            for (uint32_t i = node.begin; i < node.end; ++ i)
+                fn(m_by_min_z[i].second);
+            break;
+        }
+    }
 }
 
 
@@ -737,15 +836,68 @@ void TriangleMeshSlicer::slice(const std::vector<float> &z, std::vector<Polygons
     
     BOOST_LOG_TRIVIAL(debug) << "TriangleMeshSlicer::_slice_do";
     std::vector<IntersectionLines> lines(z.size());
-    {
-        boost::mutex lines_mutex;
+    if (! m_use_quaternion && ! m_facets_z_index.empty()) {
+        // Slice the layers in parallel, each layer visiting just the facets it intersects as reported by the Z index.
+        // The facets are sorted, so that the lines are ordered by their facets, as if the facets were sliced in sequence.
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, z.size()),
+            [&lines, &z, throw_on_cancel, this](const tbb::blocked_range<size_t>& range) {
+                std::vector<uint32_t> facets;
+                for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+                    throw_on_cancel();
+                    facets.clear();
+                    m_facets_z_index.query(z[layer_idx], [&facets](uint32_t facet_idx) { facets.emplace_back(facet_idx); });
+                    std::sort(facets.begin(), facets.end());
+                    IntersectionLines &layer_lines = lines[layer_idx];
+                    for (uint32_t facet_idx : facets) {
+                        const stl_facet &facet = this->mesh->stl.facet_start[facet_idx];
+                        const float min_z = fminf(facet.vertex[0](2), fminf(facet.vertex[1](2), facet.vertex[2](2)));
+                        const float max_z = fmaxf(facet.vertex[0](2), fmaxf(facet.vertex[1](2), facet.vertex[2](2)));
+                        IntersectionLine il;
+                        if (this->slice_facet(z[layer_idx] / SCALING_FACTOR, facet, facet_idx, min_z, max_z, &il) == TriangleMeshSlicer::Slicing &&
+                            // Ignore horizontal triangles. Any valid horizontal triangle must have a vertical triangle connected, otherwise the part has zero volume.
+                            il.edge_type != feHorizontal)
+                            layer_lines.emplace_back(il);
+                    }
+                }
+            }
+        );
+    } else {
+        // The facets are rotated by set_up_direction(), the Z index does not apply.
+        // Slice the facets in chunks of a fixed size. Each chunk collects its intersection lines into its own bucket,
+        // so that the worker threads do not contend for a shared lock. The buckets are merged in the order of the chunks,
+        // therefore the order of lines in a layer is the order of their facets, independent of the number of threads.
+        const size_t chunk_size  = 0x04000;
+        const size_t num_facets  = this->mesh->stl.stats.number_of_facets;
+        std::vector<LayerIntersectionLines> buckets((num_facets + chunk_size - 1) / chunk_size);
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, buckets.size()),
+            [&buckets, &z, chunk_size, num_facets, throw_on_cancel, this](const tbb::blocked_range<size_t>& range) {
+                for (size_t chunk_idx = range.begin(); chunk_idx < range.end(); ++ chunk_idx) {
+                    LayerIntersectionLines &bucket = buckets[chunk_idx];
+                    size_t facet_end = std::min(num_facets, (chunk_idx + 1) * chunk_size);
+                    for (size_t facet_idx = chunk_idx * chunk_size; facet_idx < facet_end; ++ facet_idx) {
+                        if ((facet_idx & 0x0ffff) == 0)
+                            throw_on_cancel();
+                        this->_slice_do(facet_idx, bucket, z);
+                    }
+                    // Sort the lines by their layers, keeping the lines of a single layer ordered by their facets.
+                    std::stable_sort(bucket.begin(), bucket.end(), 
+                        [](const std::pair<uint32_t, IntersectionLine> &l1, const std::pair<uint32_t, IntersectionLine> &l2) { return l1.first < l2.first; });
+                }
+            }
+        );
+        throw_on_cancel();
+
+        // Merge the buckets, in parallel over layers.
         tbb::parallel_for(
-            tbb::blocked_range<int>(0,this->mesh->stl.stats.number_of_facets),
-            [&lines, &lines_mutex, &z, throw_on_cancel, this](const tbb::blocked_range<int>& range) {
-                for (int facet_idx = range.begin(); facet_idx < range.end(); ++ facet_idx) {
-                    if ((facet_idx & 0x0ffff) == 0)
-                        throw_on_cancel();
-                    this->_slice_do(facet_idx, &lines, &lines_mutex, z);
+            tbb::blocked_range<size_t>(0, z.size()),
+            [&buckets, &lines](const tbb::blocked_range<size_t>& range) {
+                for (const LayerIntersectionLines &bucket : buckets) {
+                    auto it = std::lower_bound(bucket.begin(), bucket.end(), range.begin(),
+                        [](const std::pair<uint32_t, IntersectionLine> &l, size_t layer_idx) { return l.first < layer_idx; });
+                    for (; it != bucket.end() && it->first < range.end(); ++ it)
+                        lines[it->first].emplace_back(it->second);
                 }
             }
         );
@@ -803,8 +955,7 @@ void TriangleMeshSlicer::slice(const std::vector<float> &z, std::vector<Polygons
 #endif
 }
 
-void TriangleMeshSlicer::_slice_do(size_t facet_idx, std::vector<IntersectionLines>* lines, boost::mutex* lines_mutex, 
-    const std::vector<float> &z) const
+void TriangleMeshSlicer::_slice_do(size_t facet_idx, LayerIntersectionLines &lines, const std::vector<float> &z) const
 {
     const stl_facet &facet = m_use_quaternion ? (this->mesh->stl.facet_start.data() + facet_idx)->rotated(m_quaternion) : *(this->mesh->stl.facet_start.data() + facet_idx);
     
@@ -832,11 +983,10 @@ void TriangleMeshSlicer::_slice_do(size_t facet_idx, std::vector<IntersectionLin
         std::vector<float>::size_type layer_idx = it - z.begin();
         IntersectionLine il;
         if (this->slice_facet(*it / SCALING_FACTOR, facet, facet_idx, min_z, max_z, &il) == TriangleMeshSlicer::Slicing) {
-            boost::lock_guard<boost::mutex> l(*lines_mutex);
             if (il.edge_type == feHorizontal) {
                 // Ignore horizontal triangles. Any valid horizontal triangle must have a vertical triangle connected, otherwise the part has zero volume.
             } else
-                (*lines)[layer_idx].emplace_back(il);
+                lines.emplace_back(uint32_t(layer_idx), il);
         }
     }
 }
@@ -179,7 +179,42 @@ private:
     // Whether or not the above quaterion should be used
     bool                     m_use_quaternion = false;
 
-    void _slice_do(size_t facet_idx, std::vector<IntersectionLines>* lines, boost::mutex* lines_mutex, const std::vector<float> &z) const;
+    // Interval tree over the Z spans of the facets. Built by init() and reused by all the slice() calls,
+    // so that a layer only visits the facets it intersects.
+    class FacetZIndex {
+    public:
+        void clear() { m_nodes.clear(); m_by_min_z.clear(); m_by_max_z.clear(); }
+        bool empty() const { return m_nodes.empty(); }
+        // spans: (min_z, max_z) of each facet.
+        void build(const std::vector<std::pair<float, float>> &spans);
+        // Call fn(facet_idx) for all facets with min_z <= z <= max_z.
+        template<typename FN> void query(float z, FN fn) const;
+
+    private:
+        struct Node {
+            // Z of the split plane. All facets stored at this node cross this plane.
+            float    center;
+            // Range of m_by_min_z and m_by_max_z covered by this node.
+            uint32_t begin;
+            uint32_t end;
+            // Subtrees of the facets fully below / above the split plane, -1 if empty.
+            int      left;
+            int      right;
+        };
+        int  build_recursive(std::vector<uint32_t> &facets, const std::vector<std::pair<float, float>> &spans);
+
+        std::vector<Node>                       m_nodes;
+        // (min_z, facet_idx) of the facets of a node sorted by min_z ascending.
+        std::vector<std::pair<float, uint32_t>> m_by_min_z;
+        // (max_z, facet_idx) of the facets of a node sorted by max_z descending.
+        std::vector<std::pair<float, uint32_t>> m_by_max_z;
+    };
+    FacetZIndex              m_facets_z_index;
+
+    // Intersection lines of a chunk of facets, each line tagged with the index of its layer.
+    typedef std::vector<std::pair<uint32_t, IntersectionLine>> LayerIntersectionLines;
+
+    void _slice_do(size_t facet_idx, LayerIntersectionLines &lines, const std::vector<float> &z) const;
     void make_loops(std::vector<IntersectionLine> &lines, Polygons* loops) const;
     void make_expolygons(const Polygons &loops, const float closing_radius, ExPolygons* slices) const;
     void make_expolygons_simple(std::vector<IntersectionLine> &lines, ExPolygons* slices) const;
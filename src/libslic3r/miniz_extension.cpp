@@ -1,8 +1,15 @@
 #include "miniz_extension.hpp"
 
-#if defined(_MSC_VER) || defined(__MINGW64__)
-#include "boost/nowide/cstdio.hpp"
-#endif
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <memory>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/nowide/cstdio.hpp>
+
+#include <tbb/pipeline.h>
 
 namespace Slic3r {
 
@@ -56,4 +63,213 @@ bool open_zip_writer(mz_zip_archive *zip, const std::string &fname)
 bool close_zip_reader(mz_zip_archive *zip) { return close_zip(zip, true); }
 bool close_zip_writer(mz_zip_archive *zip) { return close_zip(zip, false); }
 
+bool extract_zip_file_by_blocks(mz_zip_archive *zip, mz_uint file_index,
+                                const std::function<bool(const char *data, size_t size, bool last)> &process,
+                                size_t block_size)
+{
+    mz_zip_archive_file_stat stat;
+    if (zip == nullptr || block_size == 0 || ! mz_zip_reader_file_stat(zip, file_index, &stat))
+        return false;
+
+    mz_zip_reader_extract_iter_state *iter = mz_zip_reader_extract_iter_new(zip, file_index, 0);
+    if (iter == nullptr)
+        return false;
+
+    struct Block {
+        std::vector<char> data;
+        bool              last;
+    };
+
+    // Written by the processing stage, read by the inflating stage.
+    std::atomic<bool> ok(true);
+    mz_uint64         remaining = stat.m_uncomp_size;
+    bool              finished  = false;
+
+    // Two blocks in flight at most: one being inflated, one being processed.
+    tbb::parallel_pipeline(2,
+        tbb::make_filter<void, std::shared_ptr<Block>>(tbb::filter::serial_in_order,
+            [iter, block_size, &ok, &remaining, &finished](tbb::flow_control &fc) -> std::shared_ptr<Block> {
+                if (finished || ! ok) {
+                    fc.stop();
+                    return nullptr;
+                }
+                auto block = std::make_shared<Block>();
+                block->data.assign((size_t)std::min<mz_uint64>(remaining, block_size), 0);
+                if (! block->data.empty() &&
+                    mz_zip_reader_extract_iter_read(iter, block->data.data(), block->data.size()) != block->data.size()) {
+                    ok = false;
+                    fc.stop();
+                    return nullptr;
+                }
+                remaining  -= block->data.size();
+                finished    = remaining == 0;
+                block->last = finished;
+                return block;
+            }) &
+        tbb::make_filter<std::shared_ptr<Block>, void>(tbb::filter::serial_in_order,
+            [&process, &ok](std::shared_ptr<Block> block) {
+                if (ok && ! process(block->data.data(), block->data.size(), block->last))
+                    ok = false;
+            }));
+
+    // Verifies the size and the CRC of the inflated data.
+    if (! mz_zip_reader_extract_iter_free(iter))
+        ok = false;
+    return ok;
+}
+
+ZipFileWriter::ZipFileWriter(mz_zip_archive *zip, const std::string &name, mz_uint level, size_t memory_limit) :
+    m_zip(zip), m_name(name), m_level(level), m_memory_limit(memory_limit)
+{
+    if (m_level > MZ_UBER_COMPRESSION)
+        m_level = MZ_DEFAULT_LEVEL;
+    if (m_level > 0) {
+        m_compressor = tdefl_compressor_alloc();
+        m_ok = m_compressor != nullptr &&
+            tdefl_init(m_compressor, put_deflated, this, tdefl_create_comp_flags_from_zip_params(int(m_level), -15, MZ_DEFAULT_STRATEGY)) == TDEFL_STATUS_OKAY;
+    }
+}
+
+ZipFileWriter::~ZipFileWriter()
+{
+    if (m_compressor != nullptr)
+        tdefl_compressor_free(m_compressor);
+    if (m_spill_file != nullptr) {
+        fclose(m_spill_file);
+        boost::system::error_code ec;
+        boost::filesystem::remove(m_spill_path, ec);
+    }
+}
+
+int ZipFileWriter::put_deflated(const void *data, int size, void *user)
+{
+    auto *writer = static_cast<ZipFileWriter*>(user);
+    writer->put(data, size_t(size));
+    return writer->m_ok ? MZ_TRUE : MZ_FALSE;
+}
+
+void ZipFileWriter::put(const void *data, size_t size)
+{
+    m_data.insert(m_data.end(), static_cast<const mz_uint8*>(data), static_cast<const mz_uint8*>(data) + size);
+    if (m_data.size() > m_memory_limit && ! this->spill())
+        m_ok = false;
+}
+
+bool ZipFileWriter::spill()
+{
+    if (m_spill_file == nullptr) {
+        boost::system::error_code ec;
+        boost::filesystem::path   dir = boost::filesystem::temp_directory_path(ec);
+        if (ec)
+            return false;
+        m_spill_path = (dir / boost::filesystem::unique_path("zip_file_writer-%%%%-%%%%-%%%%.tmp", ec)).string();
+        m_spill_file = ec ? nullptr : boost::nowide::fopen(m_spill_path.c_str(), "w+b");
+        if (m_spill_file == nullptr)
+            return false;
+    }
+    if (! m_data.empty() && fwrite(m_data.data(), 1, m_data.size(), m_spill_file) != m_data.size())
+        return false;
+    m_spill_size += m_data.size();
+    m_data.clear();
+    return true;
+}
+
+bool ZipFileWriter::add(const void *data, size_t size)
+{
+    if (! m_ok || size == 0)
+        return m_ok;
+    m_crc32 = (mz_uint32)mz_crc32(m_crc32, static_cast<const mz_uint8*>(data), size);
+    m_size += size;
+    if (m_compressor == nullptr)
+        this->put(data, size);
+    else if (tdefl_compress_buffer(m_compressor, data, size, TDEFL_NO_FLUSH) != TDEFL_STATUS_OKAY)
+        m_ok = false;
+    return m_ok;
+}
+
+namespace {
+// Reads the spilled file sequentially for mz_zip_writer_add_read_buf_callback().
+size_t read_spilled(void *opaque, mz_uint64 /* file_ofs */, void *buf, size_t n)
+{
+    return fread(buf, 1, n, static_cast<FILE*>(opaque));
+}
+
+// Write function of an archive, which forwards all writes to the original write function, except for the write of
+// the (fake) buffer marker, for which the spilled file is copied instead.
+struct SpilledWrite
+{
+    mz_file_write_func  write;
+    void               *opaque;
+    const void         *marker;
+    FILE               *file;
+};
+
+size_t write_spilled(void *opaque, mz_uint64 file_ofs, const void *buf, size_t n)
+{
+    const SpilledWrite &sw = *static_cast<const SpilledWrite*>(opaque);
+    if (buf != sw.marker)
+        return sw.write(sw.opaque, file_ofs, buf, n);
+    std::vector<char> block(std::min<size_t>(n, MZ_ZIP_MAX_IO_BUF_SIZE));
+    for (size_t done = 0; done < n;) {
+        size_t len = std::min(block.size(), n - done);
+        if (fread(block.data(), 1, len, sw.file) != len || sw.write(sw.opaque, file_ofs + done, block.data(), len) != len)
+            return 0;
+        done += len;
+    }
+    return n;
+}
+}
+
+bool ZipFileWriter::finish_spilled()
+{
+    if (! this->spill() || fflush(m_spill_file) != 0 || fseek(m_spill_file, 0, SEEK_SET) != 0)
+        return false;
+    if (m_compressor == nullptr) {
+        // Stored with the current time as mz_zip_writer_add_mem() stores it.
+#ifndef MINIZ_NO_TIME
+        MZ_TIME_T  now  = time(nullptr);
+        MZ_TIME_T *pnow = &now;
+#else
+        MZ_TIME_T *pnow = nullptr;
+#endif
+        return mz_zip_writer_add_read_buf_callback(m_zip, m_name.c_str(), read_spilled, m_spill_file, m_spill_size, pnow, nullptr, 0, 0, nullptr, 0, nullptr, 0) != 0;
+    }
+    // miniz only records the deflated data from a buffer, mz_zip_writer_add_read_buf_callback() rejects
+    // MZ_ZIP_FLAG_COMPRESSED_DATA. The archive is handed a marker instead of the buffer, which its write function
+    // replaces by the contents of the spilled file. miniz writes the buffer by a single call of the write function
+    // after the local header, see the ZipFileWriterSpillsLargeFile test.
+    SpilledWrite sw { m_zip->m_pWrite, m_zip->m_pIO_opaque, this, m_spill_file };
+    m_zip->m_pWrite     = write_spilled;
+    m_zip->m_pIO_opaque = &sw;
+    bool ok = mz_zip_writer_add_mem_ex_v2(m_zip, m_name.c_str(), this, (size_t)m_spill_size, nullptr, 0, m_level | MZ_ZIP_FLAG_COMPRESSED_DATA,
+                                          m_size, m_crc32, nullptr, nullptr, 0, nullptr, 0) != 0;
+    m_zip->m_pWrite     = sw.write;
+    m_zip->m_pIO_opaque = sw.opaque;
+    return ok;
+}
+
+bool ZipFileWriter::finish()
+{
+    if (! m_ok)
+        return false;
+    bool ok;
+    if (m_compressor != nullptr && tdefl_compress_buffer(m_compressor, nullptr, 0, TDEFL_FINISH) != TDEFL_STATUS_DONE)
+        ok = false;
+    else if (! m_ok)
+        // Spilling the rest of the deflated data failed.
+        ok = false;
+    else if (m_spill_file != nullptr)
+        ok = this->finish_spilled();
+    else if (m_compressor == nullptr)
+        ok = mz_zip_writer_add_mem(m_zip, m_name.c_str(), m_data.data(), m_data.size(), 0) != 0;
+    else
+        // Record the deflated data together with the size and the CRC of the data as added.
+        ok = mz_zip_writer_add_mem_ex_v2(m_zip, m_name.c_str(), m_data.data(), m_data.size(), nullptr, 0, m_level | MZ_ZIP_FLAG_COMPRESSED_DATA,
+                                         m_size, m_crc32, nullptr, nullptr, 0, nullptr, 0) != 0;
+    std::vector<mz_uint8>().swap(m_data);
+    // The file cannot be finished twice.
+    m_ok = false;
+    return ok;
+}
+
 }
@@ -1,7 +1,10 @@
 #ifndef MINIZ_EXTENSION_HPP
 #define MINIZ_EXTENSION_HPP
 
+#include <cstdio>
 #include <string>
+#include <functional>
+#include <vector>
 #include <miniz.h>
 
 namespace Slic3r {
@@ -11,6 +14,55 @@ bool open_zip_writer(mz_zip_archive *zip, const std::string &fname_utf8);
 bool close_zip_reader(mz_zip_archive *zip);
 bool close_zip_writer(mz_zip_archive *zip);
 
+// Inflates the file_index-th file of a ZIP archive by blocks of up to block_size bytes and hands the blocks over
+// to process(data, size, last) in order, the last one with last == true. The next block is inflated while the previous
+// one is being processed, so the whole file is never held in memory.
+// Returns false if the file could not be inflated (including a CRC mismatch) or if process() returned false.
+bool extract_zip_file_by_blocks(mz_zip_archive *zip, mz_uint file_index,
+                                const std::function<bool(const char *data, size_t size, bool last)> &process,
+                                size_t block_size = 1024 * 1024);
+
+// Adds a file of an unknown size to a ZIP archive in parts. The parts are deflated by the tdefl compressor as they are added
+// and the deflated file is recorded into the archive by finish(). Up to memory_limit bytes of the deflated file are held
+// in memory, the rest is spilled into a temporary file, which finish() copies into the archive by blocks.
+// No other file may be added to the archive before the file is finished. A file, which is not finished, is discarded.
+class ZipFileWriter
+{
+public:
+    // level is the compression level of miniz (0-10), see mz_zip_writer_add_mem().
+    ZipFileWriter(mz_zip_archive *zip, const std::string &name, mz_uint level = MZ_DEFAULT_LEVEL, size_t memory_limit = 16 * 1024 * 1024);
+    ZipFileWriter(const ZipFileWriter &) = delete;
+    ZipFileWriter& operator=(const ZipFileWriter &) = delete;
+    ~ZipFileWriter();
+
+    // Deflates the next part of the file. Returns false if the file could not be deflated, then it shall not be finished.
+    bool add(const void *data, size_t size);
+    bool add(const std::string &data) { return this->add(data.data(), data.size()); }
+    // Records the file into the archive. Returns false on error.
+    bool finish();
+
+private:
+    static int put_deflated(const void *data, int size, void *user);
+    void       put(const void *data, size_t size);
+    // Moves m_data to the end of the temporary file, opening the file first.
+    bool       spill();
+    bool       finish_spilled();
+
+    mz_zip_archive         *m_zip;
+    std::string             m_name;
+    mz_uint                 m_level;
+    size_t                  m_memory_limit;
+    tdefl_compressor       *m_compressor = nullptr;
+    // Deflated data, or the data as added if the level is zero, not yet spilled into m_spill_file.
+    std::vector<mz_uint8>   m_data;
+    std::string             m_spill_path;
+    FILE                   *m_spill_file = nullptr;
+    mz_uint64               m_spill_size = 0;
+    mz_uint32               m_crc32      = MZ_CRC32_INIT;
+    mz_uint64               m_size       = 0;
+    bool                    m_ok         = true;
+};
+
 }
 
 #endif // MINIZ_EXTENSION_HPP
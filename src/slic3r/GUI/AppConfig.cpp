@@ -75,6 +75,10 @@ void AppConfig::set_defaults()
     if (get("use_perspective_camera").empty())
         set("use_perspective_camera", "1");
 
+    // Memory limit of the in-memory cache of the sliced layers in megabytes, see SliceCache.
+    if (get("slice_cache_memory").empty())
+        set("slice_cache_memory", "256");
+
     // Remove legacy window positions/sizes
     erase("", "main_frame_maximized");
     erase("", "main_frame_pos");
@@ -2213,7 +2213,7 @@ void GLCanvas3D::load_preview(const std::vector<std::string>& str_tool_colors, c
     if (color_print_values.empty())
         reset_legend_texture();
     else {
-        auto preview_data = GCodePreviewData();
+        GCodePreviewData preview_data;
         preview_data.extrusion.view_type = GCodePreviewData::Extrusion::ColorPrint;
         const std::vector<float> tool_colors = _parse_colors(str_tool_colors);
         _generate_legend_texture(preview_data, tool_colors);
@@ -4863,24 +4863,24 @@ void GLCanvas3D::_load_gcode_extrusion_paths(const GCodePreviewData& preview_dat
     // helper functions to select data in dependence of the extrusion view type
     struct Helper
     {
-        static float path_filter(GCodePreviewData::Extrusion::EViewType type, const ExtrusionPath& path)
+        static float path_filter(GCodePreviewData::Extrusion::EViewType type, const GCodePreviewData::Extrusion::Layer& layer, size_t path_id)
         {
             switch (type)
             {
             case GCodePreviewData::Extrusion::FeatureType:
-                return (float)path.role();
+                return (float)layer.role(path_id);
             case GCodePreviewData::Extrusion::Height:
-                return path.height;
+                return layer.heights[path_id];
             case GCodePreviewData::Extrusion::Width:
-                return path.width;
+                return layer.widths[path_id];
             case GCodePreviewData::Extrusion::Feedrate:
-                return path.feedrate;
+                return layer.feedrates[path_id];
             case GCodePreviewData::Extrusion::VolumetricRate:
-                return path.feedrate * (float)path.mm3_per_mm;
+                return layer.feedrates[path_id] * layer.mm3_per_mm[path_id];
             case GCodePreviewData::Extrusion::Tool:
-                return (float)path.extruder_id;
+                return (float)layer.extruder_ids[path_id];
             case GCodePreviewData::Extrusion::ColorPrint:
-                return (float)path.cp_color_id;
+                return (float)layer.cp_color_ids[path_id];
             default:
                 return 0.0f;
             }
@@ -4962,10 +4962,10 @@ void GLCanvas3D::_load_gcode_extrusion_paths(const GCodePreviewData& preview_dat
     FiltersList filters;
     for (const GCodePreviewData::Extrusion::Layer& layer : preview_data.extrusion.layers)
     {
-        for (const ExtrusionPath& path : layer.paths)
+        for (size_t path_id = 0; path_id < layer.paths_count(); ++path_id)
         {
-            ExtrusionRole role = path.role();
-            float path_filter = Helper::path_filter(preview_data.extrusion.view_type, path);
+            ExtrusionRole role = layer.role(path_id);
+            float path_filter = Helper::path_filter(preview_data.extrusion.view_type, layer, path_id);
             if (std::find(filters.begin(), filters.end(), Filter(path_filter, role)) == filters.end())
                 filters.emplace_back(path_filter, role);
         }
@@ -5008,17 +5008,20 @@ void GLCanvas3D::_load_gcode_extrusion_paths(const GCodePreviewData& preview_dat
     // populates volumes
     for (const GCodePreviewData::Extrusion::Layer& layer : preview_data.extrusion.layers)
     {
-        for (const ExtrusionPath& path : layer.paths)
+        for (size_t path_id = 0; path_id < layer.paths_count(); ++path_id)
         {
-            float path_filter = Helper::path_filter(preview_data.extrusion.view_type, path);
-            FiltersList::iterator filter = std::find(filters.begin(), filters.end(), Filter(path_filter, path.role()));
+            float path_filter = Helper::path_filter(preview_data.extrusion.view_type, layer, path_id);
+            FiltersList::iterator filter = std::find(filters.begin(), filters.end(), Filter(path_filter, layer.role(path_id)));
             if (filter != filters.end())
             {
                 filter->volume->print_zs.push_back(layer.z);
                 filter->volume->offsets.push_back(filter->volume->indexed_vertex_array.quad_indices.size());
                 filter->volume->offsets.push_back(filter->volume->indexed_vertex_array.triangle_indices.size());
 
-                _3DScene::extrusionentity_to_verts(path, layer.z, *filter->volume);
+                Lines lines = layer.polyline(path_id).lines();
+                std::vector<double> widths(lines.size(), layer.widths[path_id]);
+                std::vector<double> heights(lines.size(), layer.heights[path_id]);
+                _3DScene::thick_lines_to_verts(lines, widths, heights, false, layer.z, *filter->volume);
             }
         }
     }
@@ -5116,10 +5119,13 @@ bool GLCanvas3D::_travel_paths_by_type(const GCodePreviewData& preview_data)
 
     // detects types
     TypesList types;
-    for (const GCodePreviewData::Travel::Polyline& polyline : preview_data.travel.polylines)
+    for (const GCodePreviewData::Travel::Layer& layer : preview_data.travel.layers)
     {
-        if (std::find(types.begin(), types.end(), Type(polyline.type)) == types.end())
-            types.emplace_back(polyline.type);
+        for (size_t polyline_id = 0; polyline_id < layer.polylines_count(); ++polyline_id)
+        {
+            if (std::find(types.begin(), types.end(), Type(layer.type(polyline_id))) == types.end())
+                types.emplace_back(layer.type(polyline_id));
+        }
     }
 
     // nothing to render, return
@@ -5140,16 +5146,19 @@ bool GLCanvas3D::_travel_paths_by_type(const GCodePreviewData& preview_data)
     }
 
     // populates volumes
-    for (const GCodePreviewData::Travel::Polyline& polyline : preview_data.travel.polylines)
+    for (const GCodePreviewData::Travel::Layer& layer : preview_data.travel.layers)
     {
-        TypesList::iterator type = std::find(types.begin(), types.end(), Type(polyline.type));
-        if (type != types.end())
+        for (size_t polyline_id = 0; polyline_id < layer.polylines_count(); ++polyline_id)
         {
-            type->volume->print_zs.push_back(unscale<double>(polyline.polyline.bounding_box().min(2)));
-            type->volume->offsets.push_back(type->volume->indexed_vertex_array.quad_indices.size());
-            type->volume->offsets.push_back(type->volume->indexed_vertex_array.triangle_indices.size());
+            TypesList::iterator type = std::find(types.begin(), types.end(), Type(layer.type(polyline_id)));
+            if (type != types.end())
+            {
+                type->volume->print_zs.push_back(layer.z);
+                type->volume->offsets.push_back(type->volume->indexed_vertex_array.quad_indices.size());
+                type->volume->offsets.push_back(type->volume->indexed_vertex_array.triangle_indices.size());
 
-            _3DScene::polyline3_to_verts(polyline.polyline, preview_data.travel.width, preview_data.travel.height, *type->volume);
+                _3DScene::polyline3_to_verts(layer.polyline(polyline_id), preview_data.travel.width, preview_data.travel.height, *type->volume);
+            }
         }
     }
 
@@ -5182,10 +5191,13 @@ bool GLCanvas3D::_travel_paths_by_feedrate(const GCodePreviewData& preview_data)
 
     // detects feedrates
     FeedratesList feedrates;
-    for (const GCodePreviewData::Travel::Polyline& polyline : preview_data.travel.polylines)
+    for (const GCodePreviewData::Travel::Layer& layer : preview_data.travel.layers)
     {
-        if (std::find(feedrates.begin(), feedrates.end(), Feedrate(polyline.feedrate)) == feedrates.end())
-            feedrates.emplace_back(polyline.feedrate);
+        for (size_t polyline_id = 0; polyline_id < layer.polylines_count(); ++polyline_id)
+        {
+            if (std::find(feedrates.begin(), feedrates.end(), Feedrate(layer.feedrates[polyline_id])) == feedrates.end())
+                feedrates.emplace_back(layer.feedrates[polyline_id]);
+        }
     }
 
     // nothing to render, return
@@ -5206,16 +5218,19 @@ bool GLCanvas3D::_travel_paths_by_feedrate(const GCodePreviewData& preview_data)
     }
 
     // populates volumes
-    for (const GCodePreviewData::Travel::Polyline& polyline : preview_data.travel.polylines)
+    for (const GCodePreviewData::Travel::Layer& layer : preview_data.travel.layers)
     {
-        FeedratesList::iterator feedrate = std::find(feedrates.begin(), feedrates.end(), Feedrate(polyline.feedrate));
-        if (feedrate != feedrates.end())
+        for (size_t polyline_id = 0; polyline_id < layer.polylines_count(); ++polyline_id)
         {
-            feedrate->volume->print_zs.push_back(unscale<double>(polyline.polyline.bounding_box().min(2)));
-            feedrate->volume->offsets.push_back(feedrate->volume->indexed_vertex_array.quad_indices.size());
-            feedrate->volume->offsets.push_back(feedrate->volume->indexed_vertex_array.triangle_indices.size());
+            FeedratesList::iterator feedrate = std::find(feedrates.begin(), feedrates.end(), Feedrate(layer.feedrates[polyline_id]));
+            if (feedrate != feedrates.end())
+            {
+                feedrate->volume->print_zs.push_back(layer.z);
+                feedrate->volume->offsets.push_back(feedrate->volume->indexed_vertex_array.quad_indices.size());
+                feedrate->volume->offsets.push_back(feedrate->volume->indexed_vertex_array.triangle_indices.size());
 
-            _3DScene::polyline3_to_verts(polyline.polyline, preview_data.travel.width, preview_data.travel.height, *feedrate->volume);
+                _3DScene::polyline3_to_verts(layer.polyline(polyline_id), preview_data.travel.width, preview_data.travel.height, *feedrate->volume);
+            }
         }
     }
 
@@ -5248,10 +5263,13 @@ bool GLCanvas3D::_travel_paths_by_tool(const GCodePreviewData& preview_data, con
 
     // detects tools
     ToolsList tools;
-    for (const GCodePreviewData::Travel::Polyline& polyline : preview_data.travel.polylines)
+    for (const GCodePreviewData::Travel::Layer& layer : preview_data.travel.layers)
     {
-        if (std::find(tools.begin(), tools.end(), Tool(polyline.extruder_id)) == tools.end())
-            tools.emplace_back(polyline.extruder_id);
+        for (size_t polyline_id = 0; polyline_id < layer.polylines_count(); ++polyline_id)
+        {
+            if (std::find(tools.begin(), tools.end(), Tool(layer.extruder_ids[polyline_id])) == tools.end())
+                tools.emplace_back(layer.extruder_ids[polyline_id]);
+        }
     }
 
     // nothing to render, return
@@ -5276,16 +5294,19 @@ bool GLCanvas3D::_travel_paths_by_tool(const GCodePreviewData& preview_data, con
     }
 
     // populates volumes
-    for (const GCodePreviewData::Travel::Polyline& polyline : preview_data.travel.polylines)
+    for (const GCodePreviewData::Travel::Layer& layer : preview_data.travel.layers)
     {
-        ToolsList::iterator tool = std::find(tools.begin(), tools.end(), Tool(polyline.extruder_id));
-        if (tool != tools.end() && tool->volume != nullptr)
+        for (size_t polyline_id = 0; polyline_id < layer.polylines_count(); ++polyline_id)
         {
-            tool->volume->print_zs.push_back(unscale<double>(polyline.polyline.bounding_box().min(2)));
-            tool->volume->offsets.push_back(tool->volume->indexed_vertex_array.quad_indices.size());
-            tool->volume->offsets.push_back(tool->volume->indexed_vertex_array.triangle_indices.size());
+            ToolsList::iterator tool = std::find(tools.begin(), tools.end(), Tool(layer.extruder_ids[polyline_id]));
+            if (tool != tools.end() && tool->volume != nullptr)
+            {
+                tool->volume->print_zs.push_back(layer.z);
+                tool->volume->offsets.push_back(tool->volume->indexed_vertex_array.quad_indices.size());
+                tool->volume->offsets.push_back(tool->volume->indexed_vertex_array.triangle_indices.size());
 
-            _3DScene::polyline3_to_verts(polyline.polyline, preview_data.travel.width, preview_data.travel.height, *tool->volume);
+                _3DScene::polyline3_to_verts(layer.polyline(polyline_id), preview_data.travel.width, preview_data.travel.height, *tool->volume);
+            }
         }
     }
 
@@ -5297,7 +5318,7 @@ void GLCanvas3D::_load_gcode_retractions(const GCodePreviewData& preview_data)
     m_gcode_preview_volume_index.first_volumes.emplace_back(GCodePreviewVolumeIndex::Retraction, 0, (unsigned int)m_volumes.volumes.size());
 
     // nothing to render, return
-    if (preview_data.retraction.positions.empty())
+    if (preview_data.retraction.layers.empty())
         return;
 
     GLVolume* volume = new GLVolume(preview_data.retraction.color.rgba);
@@ -5305,16 +5326,17 @@ void GLCanvas3D::_load_gcode_retractions(const GCodePreviewData& preview_data)
     {
         m_volumes.volumes.emplace_back(volume);
 
-        GCodePreviewData::Retraction::PositionsList copy(preview_data.retraction.positions);
-        std::sort(copy.begin(), copy.end(), [](const GCodePreviewData::Retraction::Position& p1, const GCodePreviewData::Retraction::Position& p2){ return p1.position(2) < p2.position(2); });
-
-        for (const GCodePreviewData::Retraction::Position& position : copy)
+        // the layers are sorted by z already
+        for (const GCodePreviewData::Retraction::Layer& layer : preview_data.retraction.layers)
         {
-            volume->print_zs.push_back(unscale<double>(position.position(2)));
-            volume->offsets.push_back(volume->indexed_vertex_array.quad_indices.size());
-            volume->offsets.push_back(volume->indexed_vertex_array.triangle_indices.size());
+            for (size_t position_id = 0; position_id < layer.positions_count(); ++position_id)
+            {
+                volume->print_zs.push_back(layer.z);
+                volume->offsets.push_back(volume->indexed_vertex_array.quad_indices.size());
+                volume->offsets.push_back(volume->indexed_vertex_array.triangle_indices.size());
 
-            _3DScene::point3_to_verts(position.position, position.width, position.height, *volume);
+                _3DScene::point3_to_verts(layer.position(position_id), layer.widths[position_id], layer.heights[position_id], *volume);
+            }
         }
 
         // finalize volumes and sends geometry to gpu
@@ -5328,7 +5350,7 @@ void GLCanvas3D::_load_gcode_unretractions(const GCodePreviewData& preview_data)
     m_gcode_preview_volume_index.first_volumes.emplace_back(GCodePreviewVolumeIndex::Unretraction, 0, (unsigned int)m_volumes.volumes.size());
 
     // nothing to render, return
-    if (preview_data.unretraction.positions.empty())
+    if (preview_data.unretraction.layers.empty())
         return;
 
     GLVolume* volume = new GLVolume(preview_data.unretraction.color.rgba);
@@ -5336,16 +5358,17 @@ void GLCanvas3D::_load_gcode_unretractions(const GCodePreviewData& preview_data)
     {
         m_volumes.volumes.emplace_back(volume);
 
-        GCodePreviewData::Retraction::PositionsList copy(preview_data.unretraction.positions);
-        std::sort(copy.begin(), copy.end(), [](const GCodePreviewData::Retraction::Position& p1, const GCodePreviewData::Retraction::Position& p2){ return p1.position(2) < p2.position(2); });
-
-        for (const GCodePreviewData::Retraction::Position& position : copy)
+        // the layers are sorted by z already
+        for (const GCodePreviewData::Retraction::Layer& layer : preview_data.unretraction.layers)
         {
-            volume->print_zs.push_back(unscale<double>(position.position(2)));
-            volume->offsets.push_back(volume->indexed_vertex_array.quad_indices.size());
-            volume->offsets.push_back(volume->indexed_vertex_array.triangle_indices.size());
+            for (size_t position_id = 0; position_id < layer.positions_count(); ++position_id)
+            {
+                volume->print_zs.push_back(layer.z);
+                volume->offsets.push_back(volume->indexed_vertex_array.quad_indices.size());
+                volume->offsets.push_back(volume->indexed_vertex_array.triangle_indices.size());
 
-            _3DScene::point3_to_verts(position.position, position.width, position.height, *volume);
+                _3DScene::point3_to_verts(layer.position(position_id), layer.widths[position_id], layer.heights[position_id], *volume);
+            }
         }
 
         // finalize volumes and sends geometry to gpu
@@ -570,6 +570,7 @@ public:
 
     void reload_scene(bool refresh_immediately, bool force_full_scene_refresh = false);
 
+    // The G-code export may be adding layers to preview_data, hold preview_data.lock() while loading.
     void load_gcode_preview(const GCodePreviewData& preview_data, const std::vector<std::string>& str_tool_colors);
     void load_sla_preview();
     void load_preview(const std::vector<std::string>& str_tool_colors, const std::vector<double>& color_print_values);
@@ -28,6 +28,7 @@
 #include "libslic3r/Utils.hpp"
 #include "libslic3r/Model.hpp"
 #include "libslic3r/I18N.hpp"
+#include "libslic3r/SliceCache.hpp"
 
 #include "GUI.hpp"
 #include "GUI_Utils.hpp"
@@ -193,6 +194,11 @@ bool GUI_App::on_init_inner()
     app_config->set("version", SLIC3R_VERSION);
     app_config->save();
 
+    // Keep the sliced layers in memory, so that re-slicing after an edit, which changes neither the geometry
+    // nor the layer heights, skips the slicing. A memory limit given on the command line takes precedence.
+    if (SliceCache::instance().memory_limit() == 0)
+        SliceCache::instance().set_memory_limit(size_t(std::max(0, atoi(app_config->get("slice_cache_memory").c_str()))) * 1024 * 1024);
+
 #ifdef __WXMSW__
     associate_3mf_files();
 #endif // __WXMSW__
@@ -744,7 +744,11 @@ void Preview::load_print_as_fff(bool keep_z_range)
         m_preferred_color_mode = "tool_or_feature";
     }
 
-    bool gcode_preview_data_valid = print->is_step_done(psGCodeExport) && ! m_gcode_preview_data->empty();
+    // The G-code export fills the preview data layer by layer, show the layers exported so far.
+    // The preview data is reset if the G-code export is invalidated or canceled, so any layers loaded are valid.
+    auto gcode_preview_data_lock = m_gcode_preview_data->lock();
+    bool gcode_preview_data_valid = ! m_gcode_preview_data->empty();
+    bool gcode_preview_data_complete = gcode_preview_data_valid && print->is_step_done(psGCodeExport);
     // Collect colors per extruder.
     std::vector<std::string> colors;
     std::vector<double> color_print_values = {};
@@ -784,9 +788,9 @@ void Preview::load_print_as_fff(bool keep_z_range)
     if (IsShown())
     {
         if (gcode_preview_data_valid) {
-            // Load the real G-code preview.
+            // Load the real G-code preview, reloaded once the G-code export adds more layers.
             m_canvas->load_gcode_preview(*m_gcode_preview_data, colors);
-            m_loaded = true;
+            m_loaded = gcode_preview_data_complete;
         } else
             // Load the initial preview based on slices, not the final G-code.
             m_canvas->load_preview(colors, color_print_values);
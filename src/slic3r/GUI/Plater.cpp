@@ -2955,6 +2955,9 @@ void Plater::priv::on_slicing_update(SlicingStatusEvent &evt)
     } else if (evt.status.flags & PrintBase::SlicingStatus::RELOAD_SLA_PREVIEW) {
         // Update the SLA preview. Only called if not RELOAD_SLA_SUPPORT_POINTS, as the block above will refresh the preview anyways.
         this->preview->reload_print();
+    } else if (evt.status.flags & PrintBase::SlicingStatus::RELOAD_GCODE_PREVIEW) {
+        // Show the layers of the G-code preview added by the running G-code export.
+        this->preview->reload_print();
     }
 }
 
@@ -0,0 +1,19013 @@
+
+; 
+
+; external perimeters extrusion width = 0.45mm
+; perimeters extrusion width = 0.45mm
+; infill extrusion width = 0.45mm
+; solid infill extrusion width = 0.45mm
+; top infill extrusion width = 0.40mm
+; support material extrusion width = 0.40mm
+; first layer extrusion width = 0.70mm
+
+M107
+M104 S200 ; set temperature
+G28 ; home all axes
+G1 Z5 F5000 ; lift nozzle
+; Filament gcode
+M109 S200 ; set temperature and wait for it to be reached
+G21 ; set units to millimeters
+G90 ; use absolute coordinates
+M82 ; use absolute distances for extrusion
+G92 E0
+G1 Z0.350 F7800.000
+G1 E-2.00000 F2400.00000
+G92 E0
+G1 X56.267 Y94.909 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1800
+G1 X57.424 Y94.237 E2.12168
+G1 X58.697 Y93.824 E2.24337
+G1 X97.252 Y85.954 E5.82141
+G1 X98.559 Y85.760 E5.94156
+G1 X100.007 Y85.688 E6.07342
+G1 X101.968 Y85.824 E6.25217
+G1 X159.179 Y93.750 E11.50401
+G1 X160.177 Y93.975 E11.59704
+G1 X161.131 Y94.361 E11.69063
+G1 X162.418 Y95.221 E11.83137
+G1 X163.461 Y96.373 E11.97268
+G1 X164.190 Y97.745 E12.11399
+G1 X164.562 Y99.254 E12.25530
+G1 X164.603 Y115.217 E13.70682
+G1 X164.409 Y116.566 E13.83075
+G1 X163.933 Y117.837 E13.95411
+G1 X163.491 Y118.584 E14.03307
+G1 X162.954 Y119.258 E14.11146
+G1 X162.330 Y119.854 E14.18985
+G1 X161.631 Y120.358 E14.26824
+G1 X160.870 Y120.763 E14.34664
+G1 X160.055 Y121.062 E14.42559
+G1 X159.206 Y121.246 E14.50455
+G1 X158.347 Y121.312 E14.58294
+G1 X59.845 Y121.311 E23.53966
+G1 X58.422 Y121.112 E23.67032
+G1 X57.080 Y120.597 E23.80098
+G1 X55.886 Y119.787 E23.93220
+G1 X54.909 Y118.733 E24.06286
+G1 X54.431 Y117.972 E24.14463
+G1 X54.067 Y117.156 E24.22584
+G1 X53.821 Y116.291 E24.30761
+G1 X53.700 Y115.400 E24.38938
+G1 X53.698 Y99.640 E25.82240
+G1 X53.929 Y98.272 E25.94857
+G1 X54.453 Y96.987 E26.07474
+G1 X55.245 Y95.848 E26.20091
+G1 X56.223 Y94.950 E26.32163
+G1 E24.32163 F2400.00000
+G92 E0
+G1 X73.400 Y113.400 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1800
+G1 X61.600 Y113.400 E3.07301
+G1 X61.600 Y101.600 E4.14602
+G1 X73.400 Y101.600 E5.21903
+G1 X73.400 Y113.340 E6.28658
+G1 X74.025 Y114.025 F7800.000
+G1 F1800
+G1 X60.975 Y114.025 E7.47323
+G1 X60.975 Y100.975 E8.65989
+G1 X74.025 Y100.975 E9.84654
+G1 X74.025 Y113.965 E11.02773
+G1 X74.650 Y114.650 F7800.000
+G1 F1800
+G1 X60.350 Y114.650 E12.32803
+G1 X60.350 Y100.350 E13.62832
+G1 X74.650 Y100.350 E14.92861
+G1 X74.650 Y114.590 E16.22345
+G1 X74.264 Y114.546 F7800.000
+G1 E14.22345 F2400.00000
+G92 E0
+G1 X73.213 Y103.103 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1800
+G1 X72.178 Y102.068 E2.13841
+G1 X71.259 Y102.068 E2.22531
+G1 X72.932 Y103.741 E2.44902
+G1 X72.932 Y104.660 E2.53593
+G1 X70.340 Y102.068 E2.88254
+G1 X69.421 Y102.068 E2.96945
+G1 X72.932 Y105.579 E3.43897
+G1 X72.932 Y106.498 E3.52587
+G1 X68.502 Y102.068 E4.11830
+G1 X67.583 Y102.068 E4.20521
+G1 X72.932 Y107.417 E4.92054
+G1 X72.932 Y108.336 E5.00744
+G1 X66.664 Y102.068 E5.84568
+G1 X65.745 Y102.068 E5.93259
+G1 X72.932 Y109.255 E6.89373
+G1 X72.932 Y110.175 E6.98064
+G1 X64.825 Y102.068 E8.06469
+G1 X63.906 Y102.068 E8.15159
+G1 X72.932 Y111.094 E9.35855
+G1 X72.932 Y112.013 E9.44546
+G1 X62.987 Y102.068 E10.77532
+G1 X62.068 Y102.068 E10.86222
+G1 X72.932 Y112.932 E12.31497
+G1 X72.012 Y112.932 E12.40188
+G1 X62.068 Y102.988 E13.73173
+G1 X62.068 Y103.907 E13.81863
+G1 X71.093 Y112.932 E15.02557
+G1 X70.174 Y112.932 E15.11248
+G1 X62.068 Y104.826 E16.19651
+G1 X62.068 Y105.745 E16.28342
+G1 X69.255 Y112.932 E17.24455
+G1 X68.336 Y112.932 E17.33145
+G1 X62.068 Y106.664 E18.16968
+G1 X62.068 Y107.583 E18.25658
+G1 X67.417 Y112.932 E18.97190
+G1 X66.498 Y112.932 E19.05881
+G1 X62.068 Y108.502 E19.65121
+G1 X62.068 Y109.421 E19.73812
+G1 X65.579 Y112.932 E20.20763
+G1 X64.660 Y112.932 E20.29453
+G1 X62.068 Y110.340 E20.64113
+G1 X62.068 Y111.259 E20.72804
+G1 X63.741 Y112.932 E20.95173
+G1 X62.822 Y112.932 E21.03864
+G1 X61.787 Y111.897 E21.17703
+G1 E19.17703 F2400.00000
+G92 E0
+G1 X93.848 Y101.757 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1800
+G1 X93.720 Y101.228 E2.04949
+G1 X93.625 Y100.551 E2.11165
+G1 X93.601 Y100.000 E2.16177
+G1 X93.625 Y99.448 E2.21203
+G1 X93.720 Y98.779 E2.27342
+G1 X93.883 Y98.123 E2.33495
+G1 X94.065 Y97.608 E2.38458
+G1 X94.351 Y96.996 E2.44597
+G1 X94.699 Y96.416 E2.50750
+G1 X95.024 Y95.978 E2.55713
+G1 X95.476 Y95.476 E2.61852
+G1 X95.979 Y95.023 E2.68005
+G1 X96.417 Y94.699 E2.72968
+G1 X96.996 Y94.351 E2.79107
+G1 X97.603 Y94.068 E2.85197
+G1 X98.243 Y93.848 E2.91350
+G1 X98.772 Y93.720 E2.96299
+G1 X99.449 Y93.625 E3.02515
+G1 X99.994 Y93.602 E3.07477
+G1 X100.669 Y93.637 E3.13617
+G1 X101.337 Y93.743 E3.19770
+G1 X101.864 Y93.879 E3.24719
+G1 X102.500 Y94.111 E3.30872
+G1 X103.108 Y94.407 E3.37025
+G1 X103.578 Y94.695 E3.42037
+G1 X104.022 Y95.024 E3.47063
+G1 X104.524 Y95.476 E3.53202
+G1 X104.977 Y95.979 E3.59355
+G1 X105.301 Y96.417 E3.64318
+G1 X105.649 Y96.996 E3.70457
+G1 X105.932 Y97.603 E3.76547
+G1 X106.152 Y98.243 E3.82700
+G1 X106.280 Y98.772 E3.87649
+G1 X106.375 Y99.449 E3.93866
+G1 X106.399 Y100.000 E3.98877
+G1 X106.375 Y100.552 E4.03903
+G1 X106.280 Y101.221 E4.10043
+G1 X106.117 Y101.877 E4.16196
+G1 X105.935 Y102.392 E4.21158
+G1 X105.649 Y103.004 E4.27297
+G1 X105.301 Y103.584 E4.33450
+G1 X104.976 Y104.022 E4.38413
+G1 X104.524 Y104.524 E4.44552
+G1 X104.026 Y104.972 E4.50642
+G1 X103.479 Y105.370 E4.56796
+G1 X103.010 Y105.646 E4.61744
+G1 X102.397 Y105.932 E4.67897
+G1 X101.757 Y106.152 E4.74050
+G1 X101.228 Y106.280 E4.78999
+G1 X100.551 Y106.375 E4.85216
+G1 X100.000 Y106.399 E4.90227
+G1 X99.448 Y106.375 E4.95254
+G1 X98.779 Y106.280 E5.01393
+G1 X98.123 Y106.117 E5.07546
+G1 X97.608 Y105.935 E5.12508
+G1 X96.996 Y105.649 E5.18648
+G1 X96.416 Y105.301 E5.24801
+G1 X95.978 Y104.976 E5.29763
+G1 X95.476 Y104.524 E5.35903
+G1 X95.028 Y104.026 E5.41993
+G1 X94.630 Y103.479 E5.48145
+G1 X94.353 Y103.009 E5.53108
+G1 X94.068 Y102.397 E5.59247
+G1 X93.867 Y101.814 E5.64855
+G1 X93.240 Y101.903 F7800.000
+G1 F1800
+G1 X93.106 Y101.344 E5.70077
+G1 X93.002 Y100.608 E5.76839
+G1 X92.976 Y100.000 E5.82372
+G1 X93.003 Y99.391 E5.87920
+G1 X93.105 Y98.660 E5.94629
+G1 X93.284 Y97.942 E6.01353
+G1 X93.486 Y97.371 E6.06862
+G1 X93.798 Y96.703 E6.13571
+G1 X94.179 Y96.069 E6.20295
+G1 X94.540 Y95.582 E6.25804
+G1 X95.033 Y95.033 E6.32513
+G1 X95.583 Y94.539 E6.39237
+G1 X96.070 Y94.178 E6.44746
+G1 X96.703 Y93.798 E6.51456
+G1 X97.369 Y93.488 E6.58141
+G1 X98.068 Y93.247 E6.64865
+G1 X98.656 Y93.106 E6.70359
+G1 X99.392 Y93.002 E6.77121
+G1 X99.997 Y92.976 E6.82630
+G1 X100.734 Y93.015 E6.89340
+G1 X101.465 Y93.130 E6.96064
+G1 X102.050 Y93.282 E7.01559
+G1 X102.744 Y93.535 E7.08282
+G1 X103.409 Y93.859 E7.15006
+G1 X103.928 Y94.177 E7.20539
+G1 X104.418 Y94.540 E7.26087
+G1 X104.967 Y95.033 E7.32796
+G1 X105.461 Y95.583 E7.39520
+G1 X105.822 Y96.070 E7.45029
+G1 X106.202 Y96.703 E7.51738
+G1 X106.512 Y97.369 E7.58424
+G1 X106.753 Y98.068 E7.65148
+G1 X106.894 Y98.656 E7.70642
+G1 X106.998 Y99.392 E7.77405
+G1 X107.024 Y100.000 E7.82937
+G1 X106.997 Y100.609 E7.88485
+G1 X106.895 Y101.340 E7.95195
+G1 X106.716 Y102.058 E8.01918
+G1 X106.514 Y102.629 E8.07427
+G1 X106.202 Y103.297 E8.14137
+G1 X105.821 Y103.931 E8.20861
+G1 X105.460 Y104.418 E8.26369
+G1 X104.967 Y104.967 E8.33079
+G1 X104.420 Y105.458 E8.39764
+G1 X103.822 Y105.893 E8.46488
+G1 X103.301 Y106.200 E8.51983
+G1 X102.631 Y106.512 E8.58707
+G1 X101.932 Y106.753 E8.65430
+G1 X101.344 Y106.894 E8.70925
+G1 X100.608 Y106.998 E8.77688
+G1 X100.000 Y107.024 E8.83220
+G1 X99.391 Y106.997 E8.88768
+G1 X98.660 Y106.895 E8.95478
+G1 X97.942 Y106.716 E9.02201
+G1 X97.371 Y106.514 E9.07710
+G1 X96.703 Y106.202 E9.14420
+G1 X96.069 Y105.821 E9.21143
+G1 X95.582 Y105.460 E9.26652
+G1 X95.033 Y104.967 E9.33362
+G1 X94.542 Y104.420 E9.40047
+G1 X94.107 Y103.822 E9.46771
+G1 X93.799 Y103.300 E9.52279
+G1 X93.488 Y102.631 E9.58989
+G1 X93.257 Y101.960 E9.65441
+G1 X92.632 Y102.049 F7800.000
+G1 F1800
+G1 X92.491 Y101.461 E9.70935
+G1 X92.379 Y100.665 E9.78244
+G1 X92.350 Y100.000 E9.84298
+G1 X92.380 Y99.333 E9.90367
+G1 X92.491 Y98.540 E9.97647
+G1 X92.685 Y97.762 E10.04941
+G1 X92.907 Y97.134 E10.10996
+G1 X93.246 Y96.409 E10.18276
+G1 X93.659 Y95.721 E10.25570
+G1 X94.055 Y95.186 E10.31625
+G1 X94.591 Y94.591 E10.38905
+G1 X95.187 Y94.054 E10.46200
+G1 X95.722 Y93.658 E10.52255
+G1 X96.409 Y93.246 E10.59535
+G1 X97.134 Y92.907 E10.66816
+G1 X97.893 Y92.646 E10.74110
+G1 X98.539 Y92.491 E10.80151
+G1 X99.335 Y92.379 E10.87459
+G1 X100.000 Y92.350 E10.93514
+G1 X100.800 Y92.392 E11.00794
+G1 X101.592 Y92.518 E11.08088
+G1 X102.235 Y92.684 E11.14129
+G1 X102.989 Y92.959 E11.21423
+G1 X103.710 Y93.310 E11.28718
+G1 X104.278 Y93.658 E11.34772
+G1 X104.814 Y94.055 E11.40841
+G1 X105.409 Y94.591 E11.48121
+G1 X105.946 Y95.187 E11.55415
+G1 X106.342 Y95.722 E11.61470
+G1 X106.754 Y96.409 E11.68750
+G1 X107.093 Y97.134 E11.76031
+G1 X107.354 Y97.893 E11.83326
+G1 X107.509 Y98.539 E11.89366
+G1 X107.621 Y99.335 E11.96674
+G1 X107.650 Y100.000 E12.02728
+G1 X107.620 Y100.667 E12.08797
+G1 X107.509 Y101.460 E12.16077
+G1 X107.315 Y102.238 E12.23372
+G1 X107.093 Y102.866 E12.29427
+G1 X106.754 Y103.591 E12.36707
+G1 X106.341 Y104.279 E12.44001
+G1 X105.945 Y104.814 E12.50056
+G1 X105.409 Y105.409 E12.57336
+G1 X104.814 Y105.945 E12.64617
+G1 X104.165 Y106.416 E12.71912
+G1 X103.593 Y106.753 E12.77952
+G1 X102.866 Y107.093 E12.85246
+G1 X102.107 Y107.354 E12.92541
+G1 X101.461 Y107.509 E12.98581
+G1 X100.665 Y107.621 E13.05890
+G1 X100.000 Y107.650 E13.11944
+G1 X99.333 Y107.620 E13.18013
+G1 X98.540 Y107.509 E13.25293
+G1 X97.762 Y107.315 E13.32587
+G1 X97.134 Y107.093 E13.38642
+G1 X96.409 Y106.754 E13.45922
+G1 X95.721 Y106.341 E13.53217
+G1 X95.186 Y105.945 E13.59272
+G1 X94.591 Y105.409 E13.66552
+G1 X94.055 Y104.814 E13.73832
+G1 X93.584 Y104.165 E13.81127
+G1 X93.246 Y103.591 E13.87182
+G1 X92.907 Y102.866 E13.94462
+G1 X92.646 Y102.107 E14.01757
+G1 X92.909 Y101.760 F7800.000
+G1 X93.951 Y101.384
+G1 F1800
+G1 X98.221 Y105.654 E14.59494
+G1 X98.869 Y105.820 E14.65884
+G1 X99.389 Y105.893 E14.70904
+G1 X94.107 Y100.611 E15.42315
+G1 X94.070 Y100.000 E15.48168
+G1 X94.085 Y99.660 E15.51420
+G1 X100.340 Y105.915 E16.35984
+G1 X100.508 Y105.907 E16.37591
+G1 X101.166 Y105.812 E16.43954
+G1 X94.189 Y98.835 E17.38295
+G1 X94.387 Y98.104 E17.45535
+G1 X101.893 Y105.610 E18.47020
+G1 X102.221 Y105.497 E18.50334
+G1 X102.554 Y105.342 E18.53849
+G1 X94.658 Y97.446 E19.60604
+G1 X94.765 Y97.217 E19.63021
+G1 X94.988 Y96.846 E19.67153
+G1 X103.157 Y105.016 E20.77607
+G1 X103.700 Y104.630 E20.83978
+G1 X95.369 Y96.299 E21.96617
+G1 X95.808 Y95.808 E22.02908
+G1 X104.192 Y104.192 E23.16270
+G1 X104.630 Y103.701 E23.22561
+G1 X96.299 Y95.369 E24.35212
+G1 X96.678 Y95.089 E24.39725
+G1 X96.846 Y94.988 E24.41599
+G1 X105.012 Y103.154 E25.52007
+G1 X105.235 Y102.783 E25.56141
+G1 X105.342 Y102.554 E25.58557
+G1 X97.446 Y94.658 E26.65312
+G1 X97.779 Y94.503 E26.68828
+G1 X98.107 Y94.390 E26.72141
+G1 X105.613 Y101.896 E27.73628
+G1 X105.811 Y101.166 E27.80867
+G1 X98.833 Y94.188 E28.75210
+G1 X98.860 Y94.181 E28.75468
+G1 X99.492 Y94.093 E28.81573
+G1 X99.660 Y94.085 E28.83181
+G1 X105.915 Y100.340 E29.67745
+G1 X105.930 Y100.000 E29.70999
+G1 X105.893 Y99.389 E29.76851
+G1 X100.607 Y94.103 E30.48317
+G1 X101.242 Y94.202 E30.54457
+G1 X101.781 Y94.348 E30.59795
+G1 X106.049 Y98.616 E31.17507
+G1 X105.515 Y97.153 F7800.000
+G1 F1800
+G1 X102.854 Y94.492 E31.53486
+G1 E29.53486 F2400.00000
+G92 E0
+G1 X94.485 Y102.847 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1800
+G1 X97.153 Y105.515 E2.36076
+G1 E0.36076 F2400.00000
+G92 E0
+G1 X141.720 Y101.600 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1800
+G1 X156.694 Y101.600 E3.36166
+G1 X156.694 Y113.400 E4.43467
+G1 X141.720 Y113.400 E5.79633
+G1 X141.720 Y101.660 E6.86388
+G1 X141.095 Y100.975 F7800.000
+G1 F1800
+G1 X157.319 Y100.975 E8.33918
+G1 X157.319 Y114.025 E9.52583
+G1 X141.095 Y114.025 E11.00113
+G1 X141.095 Y101.035 E12.18233
+G1 X140.470 Y100.350 F7800.000
+G1 F1800
+G1 X157.944 Y100.350 E13.77127
+G1 X157.944 Y114.650 E15.07156
+G1 X140.470 Y114.650 E16.66051
+G1 X140.470 Y100.410 E17.95534
+G1 X140.859 Y100.441 F7800.000
+G1 E15.95534 F2400.00000
+G92 E0
+G1 X141.907 Y111.923 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1800
+G1 X142.916 Y112.932 E2.13238
+G1 X143.818 Y112.932 E2.21605
+G1 X142.188 Y111.302 E2.42985
+G1 X142.188 Y110.400 E2.51352
+G1 X144.719 Y112.932 E2.84564
+G1 X145.621 Y112.932 E2.92931
+G1 X142.188 Y109.499 E3.37976
+G1 X142.188 Y108.597 E3.46342
+G1 X146.523 Y112.932 E4.03220
+G1 X147.425 Y112.932 E4.11586
+G1 X142.188 Y107.695 E4.80295
+G1 X142.188 Y106.793 E4.88662
+G1 X148.326 Y112.932 E5.69203
+G1 X149.228 Y112.932 E5.77570
+G1 X142.188 Y105.892 E6.69944
+G1 X142.188 Y104.990 E6.78310
+G1 X150.130 Y112.932 E7.82516
+G1 X151.031 Y112.932 E7.90883
+G1 X142.188 Y104.088 E9.06921
+G1 X142.188 Y103.186 E9.15287
+G1 X151.933 Y112.932 E10.43158
+G1 X152.835 Y112.932 E10.51524
+G1 X142.188 Y102.285 E11.91227
+G1 X142.188 Y102.068 E11.93234
+G1 X142.874 Y102.068 E11.99593
+G1 X153.737 Y112.932 E13.42134
+G1 X154.638 Y112.932 E13.50501
+G1 X143.775 Y102.068 E14.93042
+G1 X144.677 Y102.068 E15.01408
+G1 X155.540 Y112.932 E16.43949
+G1 X156.226 Y112.932 E16.50310
+G1 X156.226 Y112.715 E16.52316
+G1 X145.579 Y102.068 E17.92020
+G1 X146.481 Y102.068 E18.00387
+G1 X156.226 Y111.814 E19.28258
+G1 X156.226 Y110.912 E19.36625
+G1 X147.382 Y102.068 E20.52665
+G1 X148.284 Y102.068 E20.61031
+G1 X156.226 Y110.010 E21.65238
+G1 X156.226 Y109.108 E21.73605
+G1 X149.186 Y102.068 E22.65980
+G1 X150.087 Y102.068 E22.74347
+G1 X156.226 Y108.207 E23.54890
+G1 X156.226 Y107.305 E23.63256
+G1 X150.989 Y102.068 E24.31967
+G1 X151.891 Y102.068 E24.40334
+G1 X156.226 Y106.403 E24.97212
+G1 X156.226 Y105.501 E25.05579
+G1 X152.793 Y102.068 E25.50625
+G1 X153.694 Y102.068 E25.58992
+G1 X156.226 Y104.600 E25.92206
+G1 X156.226 Y103.698 E26.00573
+G1 X154.596 Y102.068 E26.21955
+G1 X155.498 Y102.068 E26.30321
+G1 X156.507 Y103.077 E26.43561
+G1 Z0.650 F7800.000
+G1 E24.43561 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F3600
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X73.091 Y113.888
+G1 F1200
+G1 X73.715 Y113.264 E9.98722
+G1 X73.715 Y112.707 E10.01460
+G1 X72.707 Y113.715 E10.08461
+G1 X72.150 Y113.715 E10.11198
+G1 X73.715 Y112.150 E10.22071
+G1 X73.715 Y111.593 E10.24808
+G1 X71.593 Y113.715 E10.39552
+G1 X71.036 Y113.715 E10.42290
+G1 X73.715 Y111.036 E10.60906
+G1 X73.715 Y110.479 E10.63644
+G1 X70.479 Y113.715 E10.86132
+G1 X69.921 Y113.715 E10.88869
+G1 X73.715 Y109.921 E11.15229
+G1 X73.715 Y109.364 E11.17967
+G1 X69.364 Y113.715 E11.48198
+G1 X68.807 Y113.715 E11.50936
+G1 X73.715 Y108.807 E11.85039
+G1 X73.715 Y108.250 E11.87777
+G1 X68.250 Y113.715 E12.25752
+G1 X67.693 Y113.715 E12.28490
+G1 X73.715 Y107.693 E12.70337
+G1 X73.715 Y107.136 E12.73075
+G1 X67.136 Y113.715 E13.18794
+G1 X66.578 Y113.715 E13.21532
+G1 X73.715 Y106.578 E13.71122
+G1 X73.715 Y106.021 E13.73860
+G1 X66.021 Y113.715 E14.27323
+G1 X65.464 Y113.715 E14.30060
+G1 X73.715 Y105.464 E14.87395
+G1 X73.715 Y104.907 E14.90133
+G1 X64.907 Y113.715 E15.51339
+G1 X64.350 Y113.715 E15.54077
+G1 X73.715 Y104.350 E16.19155
+G1 X73.715 Y103.793 E16.21893
+G1 X63.793 Y113.715 E16.90842
+G1 X63.235 Y113.715 E16.93580
+G1 X73.715 Y103.235 E17.66402
+G1 X73.715 Y102.678 E17.69140
+G1 X62.678 Y113.715 E18.45833
+G1 X62.121 Y113.715 E18.48571
+G1 X73.715 Y102.121 E19.29137
+G1 X73.715 Y101.564 E19.31875
+G1 X61.564 Y113.715 E20.16312
+G1 X61.285 Y113.715 E20.17681
+G1 X61.285 Y113.436 E20.19050
+G1 X73.436 Y101.285 E21.03486
+G1 X72.879 Y101.285 E21.06224
+G1 X61.285 Y112.879 E21.86789
+G1 X61.285 Y112.322 E21.89527
+G1 X72.322 Y101.285 E22.66220
+G1 X71.764 Y101.285 E22.68958
+G1 X61.285 Y111.764 E23.41779
+G1 X61.285 Y111.207 E23.44517
+G1 X71.207 Y101.285 E24.13466
+G1 X70.650 Y101.285 E24.16204
+G1 X61.285 Y110.650 E24.81282
+G1 X61.285 Y110.093 E24.84019
+G1 X70.093 Y101.285 E25.45225
+G1 X69.536 Y101.285 E25.47963
+G1 X61.285 Y109.536 E26.05297
+G1 X61.285 Y108.979 E26.08034
+G1 X68.979 Y101.285 E26.61496
+G1 X68.421 Y101.285 E26.64234
+G1 X61.285 Y108.421 E27.13824
+G1 X61.285 Y107.864 E27.16562
+G1 X67.864 Y101.285 E27.62280
+G1 X67.307 Y101.285 E27.65018
+G1 X61.285 Y107.307 E28.06865
+G1 X61.285 Y106.750 E28.09603
+G1 X66.750 Y101.285 E28.47577
+G1 X66.193 Y101.285 E28.50315
+G1 X61.285 Y106.193 E28.84418
+G1 X61.285 Y105.636 E28.87155
+G1 X65.636 Y101.285 E29.17386
+G1 X65.079 Y101.285 E29.20124
+G1 X61.285 Y105.079 E29.46483
+G1 X61.285 Y104.521 E29.49221
+G1 X64.521 Y101.285 E29.71708
+G1 X63.964 Y101.285 E29.74446
+G1 X61.285 Y103.964 E29.93061
+G1 X61.285 Y103.407 E29.95799
+G1 X63.407 Y101.285 E30.10543
+G1 X62.850 Y101.285 E30.13280
+G1 X61.285 Y102.850 E30.24152
+G1 X61.285 Y102.293 E30.26890
+G1 X62.293 Y101.285 E30.33890
+G1 X61.736 Y101.285 E30.36628
+G1 X61.112 Y101.909 E30.40961
+G1 E28.40961 F2400.00000
+G92 E0
+G1 X93.261 Y101.898 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X93.127 Y101.340 E2.02757
+G1 X93.024 Y100.606 E2.06324
+G1 X92.997 Y100.000 E2.09241
+G1 X93.024 Y99.390 E2.12180
+G1 X93.126 Y98.664 E2.15704
+G1 X93.305 Y97.949 E2.19250
+G1 X93.507 Y97.377 E2.22169
+G1 X93.817 Y96.713 E2.25693
+G1 X94.197 Y96.081 E2.29240
+G1 X94.555 Y95.596 E2.32136
+G1 X95.049 Y95.049 E2.35683
+G1 X95.596 Y94.555 E2.39228
+G1 X96.084 Y94.195 E2.42146
+G1 X96.712 Y93.817 E2.45671
+G1 X97.377 Y93.507 E2.49197
+G1 X98.074 Y93.267 E2.52743
+G1 X98.660 Y93.127 E2.55639
+G1 X99.394 Y93.024 E2.59206
+G1 X100.000 Y92.997 E2.62124
+G1 X100.732 Y93.036 E2.65649
+G1 X101.460 Y93.151 E2.69195
+G1 X102.043 Y93.302 E2.72092
+G1 X102.736 Y93.554 E2.75638
+G1 X103.399 Y93.877 E2.79184
+G1 X103.912 Y94.192 E2.82081
+G1 X104.505 Y94.638 E2.85648
+G1 X104.949 Y95.045 E2.88544
+G1 X105.445 Y95.596 E2.92111
+G1 X105.805 Y96.084 E2.95029
+G1 X106.183 Y96.712 E2.98553
+G1 X106.493 Y97.377 E3.02079
+G1 X106.733 Y98.074 E3.05625
+G1 X106.873 Y98.660 E3.08522
+G1 X106.976 Y99.394 E3.12089
+G1 X107.003 Y100.000 E3.15006
+G1 X106.976 Y100.610 E3.17945
+G1 X106.874 Y101.336 E3.21469
+G1 X106.695 Y102.051 E3.25015
+G1 X106.493 Y102.623 E3.27934
+G1 X106.183 Y103.287 E3.31458
+G1 X105.803 Y103.919 E3.35004
+G1 X105.442 Y104.407 E3.37922
+G1 X104.952 Y104.951 E3.41447
+G1 X104.407 Y105.442 E3.44973
+G1 X103.810 Y105.875 E3.48518
+G1 X103.288 Y106.183 E3.51436
+G1 X102.623 Y106.492 E3.54961
+G1 X101.926 Y106.733 E3.58508
+G1 X101.340 Y106.873 E3.61404
+G1 X100.606 Y106.976 E3.64972
+G1 X100.000 Y107.003 E3.67888
+G1 X99.390 Y106.976 E3.70827
+G1 X98.664 Y106.874 E3.74352
+G1 X97.949 Y106.695 E3.77898
+G1 X97.377 Y106.493 E3.80816
+G1 X96.713 Y106.183 E3.84341
+G1 X96.081 Y105.803 E3.87887
+G1 X95.593 Y105.442 E3.90805
+G1 X95.049 Y104.952 E3.94330
+G1 X94.558 Y104.407 E3.97855
+G1 X94.125 Y103.810 E4.01401
+G1 X93.817 Y103.288 E4.04319
+G1 X93.508 Y102.623 E4.07844
+G1 X93.278 Y101.955 E4.11241
+G1 X92.886 Y101.988 F7800.000
+G1 F3600
+G1 X92.748 Y101.412 E4.14087
+G1 X92.639 Y100.641 E4.17833
+G1 X92.611 Y100.000 E4.20920
+G1 X92.640 Y99.354 E4.24029
+G1 X92.747 Y98.590 E4.27740
+G1 X92.935 Y97.837 E4.31472
+G1 X93.150 Y97.230 E4.34569
+G1 X93.476 Y96.531 E4.38279
+G1 X93.876 Y95.866 E4.42012
+G1 X94.256 Y95.352 E4.45087
+G1 X94.776 Y94.776 E4.48819
+G1 X95.352 Y94.256 E4.52551
+G1 X95.870 Y93.874 E4.55648
+G1 X96.531 Y93.476 E4.59358
+G1 X97.232 Y93.149 E4.63078
+G1 X97.966 Y92.897 E4.66811
+G1 X98.588 Y92.748 E4.69885
+G1 X99.359 Y92.639 E4.73630
+G1 X100.002 Y92.611 E4.76727
+G1 X100.772 Y92.652 E4.80438
+G1 X101.539 Y92.773 E4.84170
+G1 X102.158 Y92.933 E4.87245
+G1 X102.887 Y93.199 E4.90977
+G1 X103.584 Y93.539 E4.94710
+G1 X104.129 Y93.873 E4.97785
+G1 X104.751 Y94.342 E5.01530
+G1 X105.223 Y94.774 E5.04605
+G1 X105.744 Y95.352 E5.08349
+G1 X106.126 Y95.870 E5.11446
+G1 X106.524 Y96.531 E5.15157
+G1 X106.851 Y97.232 E5.18877
+G1 X107.103 Y97.966 E5.22609
+G1 X107.252 Y98.588 E5.25684
+G1 X107.361 Y99.359 E5.29429
+G1 X107.389 Y100.000 E5.32516
+G1 X107.360 Y100.646 E5.35625
+G1 X107.253 Y101.410 E5.39336
+G1 X107.065 Y102.163 E5.43068
+G1 X106.850 Y102.770 E5.46165
+G1 X106.524 Y103.469 E5.49876
+G1 X106.124 Y104.134 E5.53608
+G1 X105.741 Y104.651 E5.56704
+G1 X105.225 Y105.224 E5.60415
+G1 X104.650 Y105.742 E5.64135
+G1 X104.022 Y106.198 E5.67867
+G1 X103.467 Y106.525 E5.70964
+G1 X102.768 Y106.851 E5.74674
+G1 X102.034 Y107.103 E5.78407
+G1 X101.412 Y107.252 E5.81482
+G1 X100.641 Y107.361 E5.85227
+G1 X100.000 Y107.389 E5.88314
+G1 X99.354 Y107.360 E5.91423
+G1 X98.590 Y107.253 E5.95134
+G1 X97.837 Y107.065 E5.98866
+G1 X97.230 Y106.850 E6.01963
+G1 X96.531 Y106.524 E6.05674
+G1 X95.866 Y106.124 E6.09406
+G1 X95.349 Y105.741 E6.12503
+G1 X94.776 Y105.225 E6.16213
+G1 X94.258 Y104.650 E6.19933
+G1 X93.802 Y104.022 E6.23665
+G1 X93.475 Y103.467 E6.26762
+G1 X93.149 Y102.768 E6.30473
+G1 X92.901 Y102.046 E6.34145
+G1 X92.511 Y102.078 F7800.000
+G1 F1800
+G1 X92.368 Y101.484 E6.37080
+G1 X92.255 Y100.677 E6.41004
+G1 X92.225 Y100.000 E6.44261
+G1 X92.255 Y99.319 E6.47541
+G1 X92.368 Y98.517 E6.51438
+G1 X92.565 Y97.726 E6.55356
+G1 X92.793 Y97.084 E6.58631
+G1 X93.135 Y96.350 E6.62528
+G1 X93.555 Y95.652 E6.66447
+G1 X93.957 Y95.108 E6.69700
+G1 X94.502 Y94.502 E6.73618
+G1 X95.108 Y93.957 E6.77537
+G1 X95.655 Y93.552 E6.80812
+G1 X96.350 Y93.135 E6.84709
+G1 X97.088 Y92.791 E6.88623
+G1 X97.858 Y92.526 E6.92542
+G1 X98.516 Y92.368 E6.95794
+G1 X99.323 Y92.255 E6.99718
+G1 X100.004 Y92.225 E7.02993
+G1 X100.813 Y92.268 E7.06889
+G1 X101.617 Y92.395 E7.10808
+G1 X102.272 Y92.565 E7.14061
+G1 X103.038 Y92.843 E7.17980
+G1 X103.770 Y93.201 E7.21899
+G1 X104.347 Y93.554 E7.25151
+G1 X104.998 Y94.045 E7.29075
+G1 X105.497 Y94.502 E7.32328
+G1 X106.043 Y95.108 E7.36251
+G1 X106.448 Y95.655 E7.39526
+G1 X106.865 Y96.350 E7.43423
+G1 X107.209 Y97.088 E7.47337
+G1 X107.474 Y97.858 E7.51255
+G1 X107.632 Y98.516 E7.54508
+G1 X107.745 Y99.323 E7.58432
+G1 X107.775 Y100.000 E7.61689
+G1 X107.745 Y100.681 E7.64969
+G1 X107.632 Y101.483 E7.68865
+G1 X107.435 Y102.274 E7.72784
+G1 X107.207 Y102.916 E7.76059
+G1 X106.865 Y103.650 E7.79956
+G1 X106.445 Y104.348 E7.83874
+G1 X106.040 Y104.896 E7.87149
+G1 X105.498 Y105.498 E7.91046
+G1 X104.893 Y106.042 E7.94960
+G1 X104.234 Y106.521 E7.98879
+G1 X103.647 Y106.866 E8.02154
+G1 X102.912 Y107.209 E8.06050
+G1 X102.142 Y107.474 E8.09969
+G1 X101.484 Y107.632 E8.13222
+G1 X100.677 Y107.745 E8.17146
+G1 X100.000 Y107.775 E8.20403
+G1 X99.319 Y107.745 E8.23683
+G1 X98.517 Y107.632 E8.27579
+G1 X97.726 Y107.435 E8.31498
+G1 X97.084 Y107.207 E8.34773
+G1 X96.350 Y106.865 E8.38670
+G1 X95.652 Y106.445 E8.42588
+G1 X95.104 Y106.040 E8.45863
+G1 X94.502 Y105.498 E8.49760
+G1 X93.958 Y104.893 E8.53674
+G1 X93.479 Y104.234 E8.57593
+G1 X93.134 Y103.647 E8.60868
+G1 X92.791 Y102.912 E8.64764
+G1 X92.525 Y102.136 E8.68712
+G1 X92.788 Y101.789 F7800.000
+G1 X94.181 Y96.331
+G1 F1200
+G1 X96.332 Y94.181 E8.83682
+G1 X97.475 Y93.596 F7800.000
+G1 F1200
+G1 X93.942 Y97.128 E9.08268
+G1 X93.775 Y97.486 E9.10213
+G1 X93.577 Y98.052 E9.13162
+G1 X98.046 Y93.583 E9.44268
+G1 X98.786 Y93.401 E9.48019
+G1 X93.401 Y98.786 E9.85499
+G1 X93.312 Y99.433 E9.88716
+G1 X99.434 Y93.311 E10.31329
+G1 X100.015 Y93.288 E10.34194
+G1 X93.287 Y100.016 E10.81025
+G1 X93.311 Y100.550 E10.83659
+G1 X100.545 Y93.316 E11.34017
+G1 X101.041 Y93.378 E11.36478
+G1 X93.377 Y101.042 E11.89827
+G1 X93.465 Y101.512 E11.92179
+G1 X101.513 Y93.464 E12.48199
+G1 X101.957 Y93.578 E12.50453
+G1 X93.583 Y101.953 E13.08744
+G1 X93.725 Y102.368 E13.10905
+G1 X102.366 Y93.727 E13.71049
+G1 X102.763 Y93.889 E13.73157
+G1 X93.891 Y102.761 E14.34911
+G1 X94.068 Y103.141 E14.36978
+G1 X103.138 Y94.072 E15.00108
+G1 X103.493 Y94.274 E15.02122
+G1 X94.274 Y103.494 E15.66293
+G1 X94.496 Y103.830 E15.68276
+G1 X103.832 Y94.494 E16.33259
+G1 X104.150 Y94.734 E16.35220
+G1 X94.731 Y104.153 E17.00784
+G1 X94.989 Y104.453 E17.02732
+G1 X104.456 Y94.986 E17.68627
+G1 X104.747 Y95.253 E17.70572
+G1 X95.253 Y104.747 E18.36651
+G1 X95.547 Y105.011 E18.38596
+G1 X105.011 Y95.547 E19.04473
+G1 X105.270 Y95.846 E19.06421
+G1 X95.846 Y105.270 E19.72014
+G1 X96.167 Y105.507 E19.73978
+G1 X105.507 Y96.167 E20.38991
+G1 X105.723 Y96.509 E20.40982
+G1 X96.509 Y105.723 E21.05118
+G1 X96.859 Y105.932 E21.07121
+G1 X105.932 Y96.859 E21.70276
+G1 X106.109 Y97.239 E21.72343
+G1 X97.239 Y106.109 E22.34085
+G1 X97.486 Y106.225 E22.35428
+G1 X97.631 Y106.276 E22.36181
+G1 X106.275 Y97.632 E22.96348
+G1 X106.417 Y98.047 E22.98509
+G1 X98.044 Y106.421 E23.56797
+G1 X98.490 Y106.532 E23.59063
+G1 X106.535 Y98.488 E24.15057
+G1 X106.623 Y98.958 E24.17409
+G1 X98.958 Y106.623 E24.70765
+G1 X99.450 Y106.689 E24.73208
+G1 X106.689 Y99.450 E25.23601
+G1 X106.713 Y99.984 E25.26235
+G1 X99.984 Y106.713 E25.73069
+G1 X100.566 Y106.689 E25.75937
+G1 X106.688 Y100.567 E26.18550
+G1 X106.599 Y101.214 E26.21768
+G1 X101.214 Y106.599 E26.59248
+G1 X101.954 Y106.417 E26.62999
+G1 X106.423 Y101.948 E26.94106
+G1 X106.225 Y102.514 E26.97056
+G1 X106.058 Y102.871 E26.99000
+G1 X102.525 Y106.404 E27.23588
+G1 X103.655 Y105.833 F7800.000
+G1 F1200
+G1 X105.819 Y103.668 E27.38652
+G1 E25.38652 F2400.00000
+G92 E0
+G1 X141.338 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X157.520 Y100.996 E2.77830
+G1 X157.520 Y114.004 E3.40391
+G1 X141.338 Y114.004 E4.18221
+G1 X141.338 Y101.056 E4.80494
+G1 X140.953 Y100.611 F7800.000
+G1 F3600
+G1 X157.906 Y100.611 E5.62033
+G1 X157.906 Y114.389 E6.28304
+G1 X140.953 Y114.389 E7.09843
+G1 X140.953 Y100.671 E7.75826
+G1 X140.567 Y100.225 F7800.000
+G1 F1800
+G1 X158.291 Y100.225 E8.61074
+G1 X158.291 Y114.775 E9.31055
+G1 X140.567 Y114.775 E10.16303
+G1 X140.567 Y100.285 E10.85995
+G1 X140.957 Y100.316 F7800.000
+G1 X141.454 Y101.904
+G1 F1200
+G1 X142.073 Y101.285 E10.90270
+G1 X142.627 Y101.285 E10.92976
+G1 X141.627 Y102.285 E10.99880
+G1 X141.627 Y102.839 E11.02586
+G1 X143.181 Y101.285 E11.13316
+G1 X143.735 Y101.285 E11.16022
+G1 X141.627 Y103.392 E11.30579
+G1 X141.627 Y103.946 E11.33285
+G1 X144.288 Y101.285 E11.51669
+G1 X144.842 Y101.285 E11.54375
+G1 X141.627 Y104.500 E11.76586
+G1 X141.627 Y105.054 E11.79292
+G1 X145.396 Y101.285 E12.05329
+G1 X145.950 Y101.285 E12.08035
+G1 X141.627 Y105.608 E12.37900
+G1 X141.627 Y106.162 E12.40606
+G1 X146.504 Y101.285 E12.74298
+G1 X147.058 Y101.285 E12.77004
+G1 X141.627 Y106.716 E13.14522
+G1 X141.627 Y107.270 E13.17228
+G1 X147.612 Y101.285 E13.58574
+G1 X148.166 Y101.285 E13.61280
+G1 X141.627 Y107.824 E14.06452
+G1 X141.627 Y108.378 E14.09158
+G1 X148.720 Y101.285 E14.58158
+G1 X149.274 Y101.285 E14.60864
+G1 X141.627 Y108.932 E15.13690
+G1 X141.627 Y109.486 E15.16396
+G1 X149.828 Y101.285 E15.73049
+G1 X150.382 Y101.285 E15.75755
+G1 X141.627 Y110.039 E16.36235
+G1 X141.627 Y110.593 E16.38941
+G1 X150.935 Y101.285 E17.03248
+G1 X151.489 Y101.285 E17.05955
+G1 X141.627 Y111.147 E17.74089
+G1 X141.627 Y111.701 E17.76795
+G1 X152.043 Y101.285 E18.48755
+G1 X152.597 Y101.285 E18.51462
+G1 X141.627 Y112.255 E19.27249
+G1 X141.627 Y112.809 E19.29955
+G1 X153.151 Y101.285 E20.09570
+G1 X153.705 Y101.285 E20.12276
+G1 X141.627 Y113.363 E20.95718
+G1 X141.627 Y113.715 E20.97435
+G1 X141.830 Y113.715 E20.98424
+G1 X154.259 Y101.285 E21.84294
+G1 X154.813 Y101.285 E21.87000
+G1 X142.384 Y113.715 E22.72871
+G1 X142.938 Y113.715 E22.75577
+G1 X155.367 Y101.285 E23.61447
+G1 X155.921 Y101.285 E23.64153
+G1 X143.492 Y113.715 E24.50024
+G1 X144.046 Y113.715 E24.52730
+G1 X156.475 Y101.285 E25.38600
+G1 X157.029 Y101.285 E25.41306
+G1 X144.599 Y113.715 E26.27177
+G1 X145.153 Y113.715 E26.29883
+G1 X157.231 Y101.637 E27.13325
+G1 X157.231 Y102.191 E27.16031
+G1 X145.707 Y113.715 E27.95647
+G1 X146.261 Y113.715 E27.98353
+G1 X157.231 Y102.745 E28.74141
+G1 X157.231 Y103.299 E28.76847
+G1 X146.815 Y113.715 E29.48808
+G1 X147.369 Y113.715 E29.51515
+G1 X157.231 Y103.853 E30.19649
+G1 X157.231 Y104.407 E30.22355
+G1 X147.923 Y113.715 E30.86663
+G1 X148.477 Y113.715 E30.89369
+G1 X157.231 Y104.960 E31.49849
+G1 X157.231 Y105.514 E31.52555
+G1 X149.031 Y113.715 E32.09209
+G1 X149.585 Y113.715 E32.11915
+G1 X157.231 Y106.068 E32.64742
+G1 X157.231 Y106.622 E32.67448
+G1 X150.139 Y113.715 E33.16448
+G1 X150.693 Y113.715 E33.19154
+G1 X157.231 Y107.176 E33.64327
+G1 X157.231 Y107.730 E33.67033
+G1 X151.247 Y113.715 E34.08379
+G1 X151.800 Y113.715 E34.11085
+G1 X157.231 Y108.284 E34.48604
+G1 X157.231 Y108.838 E34.51310
+G1 X152.354 Y113.715 E34.85002
+G1 X152.908 Y113.715 E34.87708
+G1 X157.231 Y109.392 E35.17573
+G1 X157.231 Y109.946 E35.20280
+G1 X153.462 Y113.715 E35.46318
+G1 X154.016 Y113.715 E35.49024
+G1 X157.231 Y110.500 E35.71235
+G1 X157.231 Y111.054 E35.73941
+G1 X154.570 Y113.715 E35.92326
+G1 X155.124 Y113.715 E35.95032
+G1 X157.231 Y111.607 E36.09589
+G1 X157.231 Y112.161 E36.12295
+G1 X155.678 Y113.715 E36.23026
+G1 X156.232 Y113.715 E36.25732
+G1 X157.231 Y112.715 E36.32636
+G1 X157.231 Y113.269 E36.35342
+G1 X156.612 Y113.888 E36.39617
+G1 Z0.950 F7800.000
+G1 E34.39617 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F3600
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X73.888 Y101.909
+G1 F1200
+G1 X73.264 Y101.285 E9.98722
+G1 X72.707 Y101.285 E10.01460
+G1 X73.715 Y102.293 E10.08461
+G1 X73.715 Y102.850 E10.11198
+G1 X72.150 Y101.285 E10.22071
+G1 X71.593 Y101.285 E10.24808
+G1 X73.715 Y103.407 E10.39552
+G1 X73.715 Y103.964 E10.42290
+G1 X71.036 Y101.285 E10.60906
+G1 X70.479 Y101.285 E10.63644
+G1 X73.715 Y104.521 E10.86132
+G1 X73.715 Y105.079 E10.88870
+G1 X69.921 Y101.285 E11.15229
+G1 X69.364 Y101.285 E11.17967
+G1 X73.715 Y105.636 E11.48198
+G1 X73.715 Y106.193 E11.50936
+G1 X68.807 Y101.285 E11.85039
+G1 X68.250 Y101.285 E11.87777
+G1 X73.715 Y106.750 E12.25752
+G1 X73.715 Y107.307 E12.28490
+G1 X67.693 Y101.285 E12.70337
+G1 X67.136 Y101.285 E12.73075
+G1 X73.715 Y107.864 E13.18794
+G1 X73.715 Y108.422 E13.21532
+G1 X66.578 Y101.285 E13.71122
+G1 X66.021 Y101.285 E13.73860
+G1 X73.715 Y108.979 E14.27323
+G1 X73.715 Y109.536 E14.30061
+G1 X65.464 Y101.285 E14.87395
+G1 X64.907 Y101.285 E14.90133
+G1 X73.715 Y110.093 E15.51339
+G1 X73.715 Y110.650 E15.54077
+G1 X64.350 Y101.285 E16.19155
+G1 X63.793 Y101.285 E16.21893
+G1 X73.715 Y111.207 E16.90843
+G1 X73.715 Y111.765 E16.93580
+G1 X63.235 Y101.285 E17.66402
+G1 X62.678 Y101.285 E17.69140
+G1 X73.715 Y112.322 E18.45834
+G1 X73.715 Y112.879 E18.48571
+G1 X62.121 Y101.285 E19.29137
+G1 X61.564 Y101.285 E19.31875
+G1 X73.715 Y113.436 E20.16312
+G1 X73.715 Y113.715 E20.17681
+G1 X73.436 Y113.715 E20.19050
+G1 X61.285 Y101.564 E21.03486
+G1 X61.285 Y102.121 E21.06224
+G1 X72.879 Y113.715 E21.86789
+G1 X72.322 Y113.715 E21.89527
+G1 X61.285 Y102.678 E22.66220
+G1 X61.285 Y103.236 E22.68958
+G1 X71.764 Y113.715 E23.41779
+G1 X71.207 Y113.715 E23.44517
+G1 X61.285 Y103.793 E24.13466
+G1 X61.285 Y104.350 E24.16204
+G1 X70.650 Y113.715 E24.81282
+G1 X70.093 Y113.715 E24.84019
+G1 X61.285 Y104.907 E25.45225
+G1 X61.285 Y105.464 E25.47963
+G1 X69.536 Y113.715 E26.05297
+G1 X68.979 Y113.715 E26.08034
+G1 X61.285 Y106.021 E26.61496
+G1 X61.285 Y106.579 E26.64234
+G1 X68.421 Y113.715 E27.13824
+G1 X67.864 Y113.715 E27.16562
+G1 X61.285 Y107.136 E27.62280
+G1 X61.285 Y107.693 E27.65018
+G1 X67.307 Y113.715 E28.06865
+G1 X66.750 Y113.715 E28.09603
+G1 X61.285 Y108.250 E28.47577
+G1 X61.285 Y108.807 E28.50315
+G1 X66.193 Y113.715 E28.84418
+G1 X65.636 Y113.715 E28.87155
+G1 X61.285 Y109.364 E29.17386
+G1 X61.285 Y109.921 E29.20124
+G1 X65.079 Y113.715 E29.46483
+G1 X64.521 Y113.715 E29.49221
+G1 X61.285 Y110.479 E29.71708
+G1 X61.285 Y111.036 E29.74446
+G1 X63.964 Y113.715 E29.93061
+G1 X63.407 Y113.715 E29.95799
+G1 X61.285 Y111.593 E30.10543
+G1 X61.285 Y112.150 E30.13280
+G1 X62.850 Y113.715 E30.24152
+G1 X62.293 Y113.715 E30.26890
+G1 X61.285 Y112.707 E30.33890
+G1 X61.285 Y113.264 E30.36628
+G1 X61.909 Y113.888 E30.40961
+G1 E28.40961 F2400.00000
+G92 E0
+G1 X93.264 Y101.890 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X93.126 Y101.336 E2.02745
+G1 X93.024 Y100.606 E2.06292
+G1 X92.997 Y100.000 E2.09209
+G1 X93.024 Y99.394 E2.12126
+G1 X93.127 Y98.660 E2.15693
+G1 X93.267 Y98.074 E2.18590
+G1 X93.507 Y97.377 E2.22136
+G1 X93.819 Y96.709 E2.25681
+G1 X94.129 Y96.184 E2.28612
+G1 X94.558 Y95.593 E2.32124
+G1 X95.049 Y95.049 E2.35650
+G1 X95.596 Y94.555 E2.39195
+G1 X96.086 Y94.193 E2.42126
+G1 X96.712 Y93.817 E2.45638
+G1 X97.377 Y93.507 E2.49164
+G1 X98.074 Y93.267 E2.52710
+G1 X98.660 Y93.127 E2.55607
+G1 X99.394 Y93.024 E2.59173
+G1 X100.003 Y92.997 E2.62104
+G1 X100.732 Y93.036 E2.65616
+G1 X101.460 Y93.151 E2.69162
+G1 X102.050 Y93.304 E2.72093
+G1 X102.736 Y93.554 E2.75605
+G1 X103.399 Y93.877 E2.79152
+G1 X103.912 Y94.192 E2.82048
+G1 X104.505 Y94.638 E2.85615
+G1 X104.949 Y95.045 E2.88512
+G1 X105.445 Y95.596 E2.92079
+G1 X105.803 Y96.081 E2.94975
+G1 X106.185 Y96.716 E2.98541
+G1 X106.447 Y97.266 E3.01472
+G1 X106.696 Y97.953 E3.04984
+G1 X106.874 Y98.664 E3.08510
+G1 X106.976 Y99.394 E3.12056
+G1 X107.003 Y100.000 E3.14974
+G1 X106.976 Y100.606 E3.17891
+G1 X106.873 Y101.340 E3.21458
+G1 X106.733 Y101.926 E3.24355
+G1 X106.493 Y102.623 E3.27901
+G1 X106.181 Y103.291 E3.31446
+G1 X105.871 Y103.816 E3.34377
+G1 X105.442 Y104.407 E3.37889
+G1 X104.949 Y104.954 E3.41435
+G1 X104.499 Y105.366 E3.44366
+G1 X103.916 Y105.805 E3.47878
+G1 X103.284 Y106.185 E3.51424
+G1 X102.734 Y106.447 E3.54355
+G1 X102.047 Y106.696 E3.57867
+G1 X101.336 Y106.874 E3.61393
+G1 X100.606 Y106.976 E3.64939
+G1 X100.000 Y107.003 E3.67856
+G1 X99.394 Y106.976 E3.70774
+G1 X98.660 Y106.873 E3.74341
+G1 X98.074 Y106.733 E3.77237
+G1 X97.377 Y106.493 E3.80783
+G1 X96.709 Y106.181 E3.84328
+G1 X96.184 Y105.871 E3.87260
+G1 X95.593 Y105.442 E3.90771
+G1 X95.046 Y104.949 E3.94317
+G1 X94.634 Y104.499 E3.97248
+G1 X94.195 Y103.916 E4.00760
+G1 X93.815 Y103.284 E4.04306
+G1 X93.553 Y102.734 E4.07237
+G1 X93.279 Y101.948 E4.11239
+G1 X92.890 Y101.983 F7800.000
+G1 F3600
+G1 X92.747 Y101.410 E4.14081
+G1 X92.639 Y100.641 E4.17814
+G1 X92.611 Y100.000 E4.20901
+G1 X92.639 Y99.359 E4.23989
+G1 X92.748 Y98.588 E4.27734
+G1 X92.897 Y97.966 E4.30809
+G1 X93.149 Y97.232 E4.34541
+G1 X93.477 Y96.529 E4.38273
+G1 X93.806 Y95.972 E4.41383
+G1 X94.258 Y95.350 E4.45080
+G1 X94.776 Y94.776 E4.48800
+G1 X95.352 Y94.256 E4.52532
+G1 X95.872 Y93.872 E4.55642
+G1 X96.531 Y93.476 E4.59339
+G1 X97.232 Y93.149 E4.63060
+G1 X97.966 Y92.897 E4.66792
+G1 X98.588 Y92.748 E4.69867
+G1 X99.359 Y92.639 E4.73611
+G1 X100.004 Y92.611 E4.76721
+G1 X100.772 Y92.652 E4.80419
+G1 X101.539 Y92.773 E4.84151
+G1 X102.165 Y92.936 E4.87261
+G1 X102.887 Y93.199 E4.90958
+G1 X103.584 Y93.539 E4.94691
+G1 X104.129 Y93.873 E4.97766
+G1 X104.751 Y94.342 E5.01511
+G1 X105.223 Y94.774 E5.04586
+G1 X105.744 Y95.352 E5.08331
+G1 X106.124 Y95.866 E5.11406
+G1 X106.525 Y96.533 E5.15150
+G1 X106.803 Y97.117 E5.18260
+G1 X107.066 Y97.840 E5.21958
+G1 X107.253 Y98.590 E5.25678
+G1 X107.361 Y99.359 E5.29410
+G1 X107.389 Y100.000 E5.32498
+G1 X107.361 Y100.641 E5.35585
+G1 X107.252 Y101.412 E5.39330
+G1 X107.103 Y102.034 E5.42405
+G1 X106.851 Y102.768 E5.46138
+G1 X106.523 Y103.471 E5.49869
+G1 X106.194 Y104.028 E5.52979
+G1 X105.742 Y104.650 E5.56677
+G1 X105.223 Y105.226 E5.60409
+G1 X104.746 Y105.663 E5.63519
+G1 X104.132 Y106.125 E5.67216
+G1 X103.467 Y106.525 E5.70948
+G1 X102.883 Y106.803 E5.74058
+G1 X102.160 Y107.066 E5.77756
+G1 X101.410 Y107.253 E5.81476
+G1 X100.641 Y107.361 E5.85208
+G1 X100.000 Y107.389 E5.88296
+G1 X99.359 Y107.361 E5.91383
+G1 X98.588 Y107.252 E5.95129
+G1 X97.966 Y107.103 E5.98203
+G1 X97.232 Y106.851 E6.01936
+G1 X96.529 Y106.523 E6.05667
+G1 X95.972 Y106.194 E6.08777
+G1 X95.350 Y105.742 E6.12475
+G1 X94.774 Y105.223 E6.16207
+G1 X94.337 Y104.746 E6.19317
+G1 X93.875 Y104.132 E6.23014
+G1 X93.475 Y103.467 E6.26747
+G1 X93.197 Y102.883 E6.29856
+G1 X92.905 Y102.041 E6.34140
+G1 X92.565 Y102.273 F7800.000
+G1 F1800
+G1 X92.368 Y101.483 E6.38054
+G1 X92.255 Y100.677 E6.41973
+G1 X92.225 Y100.000 E6.45231
+G1 X92.255 Y99.323 E6.48488
+G1 X92.368 Y98.516 E6.52412
+G1 X92.526 Y97.858 E6.55664
+G1 X92.791 Y97.088 E6.59583
+G1 X93.136 Y96.349 E6.63502
+G1 X93.483 Y95.760 E6.66790
+G1 X93.958 Y95.107 E6.70673
+G1 X94.502 Y94.502 E6.74588
+G1 X95.108 Y93.957 E6.78506
+G1 X95.658 Y93.551 E6.81794
+G1 X96.350 Y93.135 E6.85678
+G1 X97.088 Y92.791 E6.89592
+G1 X97.858 Y92.526 E6.93511
+G1 X98.516 Y92.368 E6.96764
+G1 X99.323 Y92.255 E7.00687
+G1 X100.006 Y92.225 E7.03975
+G1 X100.813 Y92.268 E7.07858
+G1 X101.617 Y92.395 E7.11777
+G1 X102.279 Y92.567 E7.15065
+G1 X103.038 Y92.843 E7.18949
+G1 X103.770 Y93.201 E7.22868
+G1 X104.347 Y93.554 E7.26121
+G1 X104.998 Y94.045 E7.30044
+G1 X105.497 Y94.502 E7.33297
+G1 X106.043 Y95.108 E7.37220
+G1 X106.445 Y95.652 E7.40473
+G1 X106.865 Y96.351 E7.44396
+G1 X107.159 Y96.968 E7.47685
+G1 X107.435 Y97.727 E7.51568
+G1 X107.632 Y98.517 E7.55482
+G1 X107.745 Y99.323 E7.59401
+G1 X107.775 Y100.000 E7.62658
+G1 X107.745 Y100.677 E7.65916
+G1 X107.632 Y101.484 E7.69839
+G1 X107.474 Y102.142 E7.73092
+G1 X107.209 Y102.912 E7.77011
+G1 X106.864 Y103.651 E7.80929
+G1 X106.517 Y104.240 E7.84218
+G1 X106.042 Y104.893 E7.88101
+G1 X105.497 Y105.498 E7.92020
+G1 X104.993 Y105.960 E7.95308
+G1 X104.348 Y106.445 E7.99191
+G1 X103.649 Y106.865 E8.03110
+G1 X103.032 Y107.159 E8.06398
+G1 X102.273 Y107.435 E8.10282
+G1 X101.483 Y107.632 E8.14196
+G1 X100.677 Y107.745 E8.18115
+G1 X100.000 Y107.775 E8.21372
+G1 X99.323 Y107.745 E8.24630
+G1 X98.516 Y107.632 E8.28553
+G1 X97.858 Y107.474 E8.31806
+G1 X97.088 Y107.209 E8.35725
+G1 X96.349 Y106.864 E8.39643
+G1 X95.760 Y106.517 E8.42932
+G1 X95.107 Y106.042 E8.46815
+G1 X94.502 Y105.497 E8.50734
+G1 X94.040 Y104.993 E8.54022
+G1 X93.555 Y104.348 E8.57905
+G1 X93.135 Y103.649 E8.61824
+G1 X92.841 Y103.032 E8.65112
+G1 X92.586 Y102.330 E8.68707
+G1 X92.839 Y101.981 F7800.000
+G1 X93.603 Y102.533
+G1 F1200
+G1 X97.128 Y106.057 E8.93241
+G1 X97.485 Y106.224 E8.95184
+G1 X98.045 Y106.417 E8.98099
+G1 X93.577 Y101.949 E9.29202
+G1 X93.401 Y101.215 E9.32916
+G1 X98.785 Y106.599 E9.70395
+G1 X99.433 Y106.689 E9.73615
+G1 X93.311 Y100.567 E10.16228
+G1 X93.287 Y99.985 E10.19096
+G1 X100.015 Y106.713 E10.65930
+G1 X100.550 Y106.689 E10.68565
+G1 X93.311 Y99.450 E11.18958
+G1 X93.377 Y98.958 E11.21401
+G1 X101.042 Y106.623 E11.74757
+G1 X101.510 Y106.532 E11.77101
+G1 X93.465 Y98.488 E12.33095
+G1 X93.582 Y98.047 E12.35341
+G1 X101.956 Y106.421 E12.93630
+G1 X102.366 Y106.273 E12.95775
+G1 X93.725 Y97.632 E13.55922
+G1 X93.891 Y97.239 E13.58020
+G1 X102.764 Y106.112 E14.19784
+G1 X103.142 Y105.932 E14.21845
+G1 X94.068 Y96.859 E14.85005
+G1 X94.274 Y96.507 E14.87013
+G1 X103.491 Y105.723 E15.51169
+G1 X103.832 Y105.506 E15.53159
+G1 X94.496 Y96.170 E16.18146
+G1 X94.731 Y95.847 E16.20113
+G1 X104.150 Y105.267 E16.85680
+G1 X104.456 Y105.014 E16.87631
+G1 X94.989 Y95.547 E17.53528
+G1 X95.253 Y95.253 E17.55473
+G1 X104.747 Y104.747 E18.21555
+G1 X105.011 Y104.453 E18.23501
+G1 X95.547 Y94.989 E18.89379
+G1 X95.846 Y94.730 E18.91327
+G1 X105.269 Y104.153 E19.56917
+G1 X105.504 Y103.830 E19.58884
+G1 X96.167 Y94.493 E20.23875
+G1 X96.509 Y94.277 E20.25866
+G1 X105.726 Y103.494 E20.90024
+G1 X105.932 Y103.141 E20.92032
+G1 X96.859 Y94.068 E21.55189
+G1 X97.239 Y93.891 E21.57256
+G1 X106.109 Y102.761 E22.18999
+G1 X106.224 Y102.515 E22.20336
+G1 X106.275 Y102.368 E22.21100
+G1 X97.632 Y93.725 E22.81259
+G1 X98.047 Y93.583 E22.83420
+G1 X106.417 Y101.953 E23.41685
+G1 X106.535 Y101.512 E23.43930
+G1 X98.488 Y93.465 E23.99940
+G1 X98.958 Y93.377 E24.02293
+G1 X106.623 Y101.042 E24.55649
+G1 X106.689 Y100.550 E24.58092
+G1 X99.450 Y93.311 E25.08485
+G1 X99.985 Y93.288 E25.11121
+G1 X106.713 Y100.016 E25.57953
+G1 X106.689 Y99.433 E25.60821
+G1 X100.572 Y93.317 E26.03396
+G1 X101.219 Y93.406 E26.06610
+G1 X106.599 Y98.785 E26.44057
+G1 X106.423 Y98.052 E26.47771
+G1 X101.948 Y93.577 E26.78922
+G1 X102.623 Y93.821 E26.82454
+G1 X102.872 Y93.942 E26.83817
+G1 X106.397 Y97.467 E27.08356
+G1 X105.818 Y96.331 F7800.000
+G1 F1200
+G1 X103.662 Y94.175 E27.23366
+G1 X94.182 Y103.669 F7800.000
+G1 F1200
+G1 X96.344 Y105.831 E27.38414
+G1 E25.38414 F2400.00000
+G92 E0
+G1 X141.544 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X157.725 Y100.996 E2.77830
+G1 X157.725 Y114.004 E3.40391
+G1 X141.544 Y114.004 E4.18221
+G1 X141.544 Y101.056 E4.80494
+G1 X141.158 Y100.611 F7800.000
+G1 F3600
+G1 X158.111 Y100.611 E5.62033
+G1 X158.111 Y114.389 E6.28304
+G1 X141.158 Y114.389 E7.09843
+G1 X141.158 Y100.671 E7.75826
+G1 X140.772 Y100.225 F7800.000
+G1 F1800
+G1 X158.497 Y100.225 E8.61074
+G1 X158.497 Y114.775 E9.31055
+G1 X140.772 Y114.775 E10.16303
+G1 X140.772 Y100.285 E10.85995
+G1 X141.162 Y100.316 F7800.000
+G1 X142.452 Y113.888
+G1 F1200
+G1 X141.833 Y113.269 E10.90270
+G1 X141.833 Y112.715 E10.92976
+G1 X142.832 Y113.715 E10.99880
+G1 X143.386 Y113.715 E11.02586
+G1 X141.833 Y112.161 E11.13316
+G1 X141.833 Y111.608 E11.16022
+G1 X143.940 Y113.715 E11.30579
+G1 X144.494 Y113.715 E11.33285
+G1 X141.833 Y111.054 E11.51669
+G1 X141.833 Y110.500 E11.54375
+G1 X145.048 Y113.715 E11.76586
+G1 X145.602 Y113.715 E11.79292
+G1 X141.833 Y109.946 E12.05329
+G1 X141.833 Y109.392 E12.08035
+G1 X146.155 Y113.715 E12.37900
+G1 X146.709 Y113.715 E12.40606
+G1 X141.833 Y108.838 E12.74298
+G1 X141.833 Y108.284 E12.77004
+G1 X147.263 Y113.715 E13.14522
+G1 X147.817 Y113.715 E13.17228
+G1 X141.833 Y107.730 E13.58574
+G1 X141.833 Y107.176 E13.61280
+G1 X148.371 Y113.715 E14.06452
+G1 X148.925 Y113.715 E14.09158
+G1 X141.833 Y106.622 E14.58158
+G1 X141.833 Y106.068 E14.60864
+G1 X149.479 Y113.715 E15.13690
+G1 X150.033 Y113.715 E15.16396
+G1 X141.833 Y105.514 E15.73049
+G1 X141.833 Y104.961 E15.75755
+G1 X150.587 Y113.715 E16.36235
+G1 X151.141 Y113.715 E16.38941
+G1 X141.833 Y104.407 E17.03249
+G1 X141.833 Y103.853 E17.05955
+G1 X151.695 Y113.715 E17.74089
+G1 X152.249 Y113.715 E17.76795
+G1 X141.833 Y103.299 E18.48756
+G1 X141.833 Y102.745 E18.51462
+G1 X152.802 Y113.715 E19.27249
+G1 X153.356 Y113.715 E19.29955
+G1 X141.833 Y102.191 E20.09570
+G1 X141.833 Y101.637 E20.12276
+G1 X153.910 Y113.715 E20.95718
+G1 X154.464 Y113.715 E20.98424
+G1 X142.035 Y101.285 E21.84294
+G1 X142.589 Y101.285 E21.87000
+G1 X155.018 Y113.715 E22.72871
+G1 X155.572 Y113.715 E22.75577
+G1 X143.143 Y101.285 E23.61447
+G1 X143.697 Y101.285 E23.64153
+G1 X156.126 Y113.715 E24.50024
+G1 X156.680 Y113.715 E24.52730
+G1 X144.251 Y101.285 E25.38600
+G1 X144.805 Y101.285 E25.41307
+G1 X157.234 Y113.715 E26.27177
+G1 X157.436 Y113.715 E26.28166
+G1 X157.436 Y113.363 E26.29883
+G1 X145.359 Y101.285 E27.13325
+G1 X145.913 Y101.285 E27.16031
+G1 X157.436 Y112.809 E27.95647
+G1 X157.436 Y112.255 E27.98353
+G1 X146.466 Y101.285 E28.74141
+G1 X147.020 Y101.285 E28.76847
+G1 X157.436 Y111.701 E29.48808
+G1 X157.436 Y111.147 E29.51515
+G1 X147.574 Y101.285 E30.19649
+G1 X148.128 Y101.285 E30.22355
+G1 X157.436 Y110.593 E30.86663
+G1 X157.436 Y110.040 E30.89369
+G1 X148.682 Y101.285 E31.49849
+G1 X149.236 Y101.285 E31.52555
+G1 X157.436 Y109.486 E32.09209
+G1 X157.436 Y108.932 E32.11915
+G1 X149.790 Y101.285 E32.64742
+G1 X150.344 Y101.285 E32.67448
+G1 X157.436 Y108.378 E33.16448
+G1 X157.436 Y107.824 E33.19154
+G1 X150.898 Y101.285 E33.64327
+G1 X151.452 Y101.285 E33.67033
+G1 X157.436 Y107.270 E34.08379
+G1 X157.436 Y106.716 E34.11085
+G1 X152.006 Y101.285 E34.48604
+G1 X152.560 Y101.285 E34.51310
+G1 X157.436 Y106.162 E34.85002
+G1 X157.436 Y105.608 E34.87708
+G1 X153.114 Y101.285 E35.17573
+G1 X153.667 Y101.285 E35.20280
+G1 X157.436 Y105.054 E35.46318
+G1 X157.436 Y104.500 E35.49024
+G1 X154.221 Y101.285 E35.71235
+G1 X154.775 Y101.285 E35.73941
+G1 X157.436 Y103.946 E35.92326
+G1 X157.436 Y103.393 E35.95032
+G1 X155.329 Y101.285 E36.09589
+G1 X155.883 Y101.285 E36.12295
+G1 X157.436 Y102.839 E36.23026
+G1 X157.436 Y102.285 E36.25732
+G1 X156.437 Y101.285 E36.32636
+G1 X156.991 Y101.285 E36.35342
+G1 X157.610 Y101.904 E36.39617
+M106 S252.45
+G1 Z1.250 F7800.000
+G1 E34.39617 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1815
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1815
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1815
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1815
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1815
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.300 Y102.020 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X93.126 Y101.337 E2.03392
+G1 X93.035 Y100.727 E2.06358
+G1 X92.997 Y99.996 E2.09877
+G1 X93.024 Y99.394 E2.12775
+G1 X93.126 Y98.664 E2.16321
+G1 X93.305 Y97.949 E2.19866
+G1 X93.509 Y97.372 E2.22810
+G1 X93.817 Y96.713 E2.26309
+G1 X94.197 Y96.081 E2.29855
+G1 X94.561 Y95.589 E2.32799
+G1 X95.048 Y95.049 E2.36298
+G1 X95.596 Y94.555 E2.39843
+G1 X96.089 Y94.192 E2.42788
+G1 X96.712 Y93.817 E2.46287
+G1 X97.377 Y93.507 E2.49813
+G1 X98.074 Y93.267 E2.53359
+G1 X98.660 Y93.127 E2.56256
+G1 X99.394 Y93.024 E2.59821
+G1 X100.005 Y92.997 E2.62765
+G1 X100.732 Y93.036 E2.66264
+G1 X101.460 Y93.151 E2.69812
+G1 X102.043 Y93.302 E2.72708
+G1 X102.736 Y93.554 E2.76254
+G1 X103.399 Y93.877 E2.79801
+G1 X103.912 Y94.192 E2.82697
+G1 X104.505 Y94.638 E2.86264
+G1 X104.949 Y95.045 E2.89161
+G1 X105.442 Y95.593 E2.92707
+G1 X105.875 Y96.189 E2.96251
+G1 X106.185 Y96.717 E2.99195
+G1 X106.492 Y97.377 E3.02694
+G1 X106.733 Y98.074 E3.06242
+G1 X106.873 Y98.660 E3.09138
+G1 X106.976 Y99.394 E3.12705
+G1 X107.003 Y100.000 E3.15621
+G1 X106.975 Y100.616 E3.18586
+G1 X106.874 Y101.336 E3.22085
+G1 X106.695 Y102.051 E3.25631
+G1 X106.491 Y102.628 E3.28575
+G1 X106.183 Y103.287 E3.32074
+G1 X105.803 Y103.919 E3.35619
+G1 X105.439 Y104.411 E3.38564
+G1 X104.952 Y104.951 E3.42063
+G1 X104.407 Y105.442 E3.45589
+G1 X103.811 Y105.875 E3.49134
+G1 X103.283 Y106.185 E3.52078
+G1 X102.623 Y106.492 E3.55577
+G1 X101.926 Y106.733 E3.59124
+G1 X101.340 Y106.873 E3.62021
+G1 X100.606 Y106.976 E3.65588
+G1 X100.000 Y107.003 E3.68503
+G1 X99.384 Y106.975 E3.71469
+G1 X98.664 Y106.874 E3.74967
+G1 X97.949 Y106.695 E3.78513
+G1 X97.372 Y106.491 E3.81457
+G1 X96.713 Y106.183 E3.84956
+G1 X96.081 Y105.803 E3.88502
+G1 X95.589 Y105.439 E3.91446
+G1 X95.049 Y104.952 E3.94945
+G1 X94.555 Y104.404 E3.98491
+G1 X94.192 Y103.911 E4.01435
+G1 X93.817 Y103.288 E4.04934
+G1 X93.507 Y102.623 E4.08460
+G1 X93.319 Y102.077 E4.11239
+G1 X92.935 Y102.146 F7800.000
+G1 F1815
+G1 X92.747 Y101.410 E4.14891
+G1 X92.651 Y100.765 E4.18027
+G1 X92.611 Y99.997 E4.21724
+G1 X92.639 Y99.359 E4.24800
+G1 X92.747 Y98.590 E4.28532
+G1 X92.935 Y97.837 E4.32264
+G1 X93.152 Y97.226 E4.35386
+G1 X93.476 Y96.531 E4.39071
+G1 X93.876 Y95.866 E4.42803
+G1 X94.262 Y95.345 E4.45926
+G1 X94.775 Y94.776 E4.49610
+G1 X95.352 Y94.256 E4.53343
+G1 X95.874 Y93.871 E4.56466
+G1 X96.531 Y93.476 E4.60150
+G1 X97.232 Y93.149 E4.63871
+G1 X97.966 Y92.897 E4.67603
+G1 X98.588 Y92.748 E4.70678
+G1 X99.358 Y92.639 E4.74422
+G1 X100.007 Y92.611 E4.77545
+G1 X100.772 Y92.652 E4.81229
+G1 X101.539 Y92.773 E4.84963
+G1 X102.158 Y92.933 E4.88037
+G1 X102.887 Y93.199 E4.91770
+G1 X103.584 Y93.539 E4.95502
+G1 X104.129 Y93.873 E4.98577
+G1 X104.751 Y94.342 E5.02322
+G1 X105.223 Y94.774 E5.05397
+G1 X105.742 Y95.350 E5.09129
+G1 X106.198 Y95.978 E5.12861
+G1 X106.527 Y96.538 E5.15983
+G1 X106.850 Y97.232 E5.19668
+G1 X107.103 Y97.966 E5.23401
+G1 X107.252 Y98.588 E5.26476
+G1 X107.361 Y99.359 E5.30221
+G1 X107.389 Y100.000 E5.33307
+G1 X107.360 Y100.651 E5.36443
+G1 X107.253 Y101.410 E5.40128
+G1 X107.065 Y102.163 E5.43860
+G1 X106.848 Y102.774 E5.46983
+G1 X106.524 Y103.469 E5.50667
+G1 X106.124 Y104.134 E5.54399
+G1 X105.738 Y104.655 E5.57522
+G1 X105.225 Y105.224 E5.61207
+G1 X104.650 Y105.742 E5.64927
+G1 X104.022 Y106.198 E5.68659
+G1 X103.462 Y106.527 E5.71782
+G1 X102.768 Y106.850 E5.75466
+G1 X102.034 Y107.103 E5.79199
+G1 X101.412 Y107.252 E5.82274
+G1 X100.641 Y107.361 E5.86019
+G1 X100.000 Y107.389 E5.89106
+G1 X99.349 Y107.360 E5.92241
+G1 X98.590 Y107.253 E5.95926
+G1 X97.837 Y107.065 E5.99658
+G1 X97.226 Y106.848 E6.02781
+G1 X96.531 Y106.524 E6.06465
+G1 X95.866 Y106.124 E6.10198
+G1 X95.345 Y105.738 E6.13320
+G1 X94.776 Y105.225 E6.17005
+G1 X94.256 Y104.648 E6.20737
+G1 X93.871 Y104.126 E6.23860
+G1 X93.476 Y103.469 E6.27544
+G1 X93.149 Y102.768 E6.31265
+G1 X92.955 Y102.202 E6.34141
+G1 X92.571 Y102.271 F7800.000
+G1 F1800
+G1 X92.368 Y101.484 E6.38052
+G1 X92.267 Y100.804 E6.41359
+G1 X92.225 Y99.999 E6.45234
+G1 X92.255 Y99.323 E6.48487
+G1 X92.368 Y98.517 E6.52405
+G1 X92.565 Y97.726 E6.56324
+G1 X92.795 Y97.079 E6.59625
+G1 X93.135 Y96.350 E6.63495
+G1 X93.555 Y95.652 E6.67414
+G1 X93.964 Y95.100 E6.70716
+G1 X94.502 Y94.503 E6.74586
+G1 X95.108 Y93.957 E6.78504
+G1 X95.660 Y93.549 E6.81806
+G1 X96.350 Y93.135 E6.85676
+G1 X97.088 Y92.791 E6.89590
+G1 X97.858 Y92.526 E6.93509
+G1 X98.516 Y92.368 E6.96762
+G1 X99.323 Y92.255 E7.00685
+G1 X100.009 Y92.225 E7.03987
+G1 X100.813 Y92.268 E7.07857
+G1 X101.617 Y92.395 E7.11776
+G1 X102.272 Y92.565 E7.15029
+G1 X103.038 Y92.843 E7.18947
+G1 X103.770 Y93.201 E7.22866
+G1 X104.347 Y93.554 E7.26119
+G1 X104.998 Y94.045 E7.30042
+G1 X105.497 Y94.502 E7.33295
+G1 X106.042 Y95.107 E7.37214
+G1 X106.521 Y95.766 E7.41132
+G1 X106.869 Y96.358 E7.44434
+G1 X107.209 Y97.087 E7.48304
+G1 X107.474 Y97.858 E7.52223
+G1 X107.632 Y98.516 E7.55476
+G1 X107.745 Y99.323 E7.59399
+G1 X107.775 Y100.000 E7.62656
+G1 X107.744 Y100.687 E7.65963
+G1 X107.632 Y101.483 E7.69833
+G1 X107.435 Y102.274 E7.73752
+G1 X107.205 Y102.921 E7.77053
+G1 X106.865 Y103.650 E7.80923
+G1 X106.445 Y104.348 E7.84842
+G1 X106.036 Y104.900 E7.88143
+G1 X105.498 Y105.497 E7.92013
+G1 X104.893 Y106.042 E7.95928
+G1 X104.234 Y106.521 E7.99846
+G1 X103.642 Y106.869 E8.03148
+G1 X102.913 Y107.209 E8.07018
+G1 X102.142 Y107.474 E8.10937
+G1 X101.484 Y107.632 E8.14190
+G1 X100.677 Y107.745 E8.18113
+G1 X100.000 Y107.775 E8.21370
+G1 X99.313 Y107.744 E8.24677
+G1 X98.517 Y107.632 E8.28547
+G1 X97.726 Y107.435 E8.32465
+G1 X97.079 Y107.205 E8.35767
+G1 X96.350 Y106.865 E8.39637
+G1 X95.652 Y106.445 E8.43556
+G1 X95.100 Y106.036 E8.46857
+G1 X94.503 Y105.498 E8.50727
+G1 X93.957 Y104.892 E8.54646
+G1 X93.549 Y104.340 E8.57948
+G1 X93.135 Y103.650 E8.61818
+G1 X92.791 Y102.912 E8.65732
+G1 X92.590 Y102.328 E8.68705
+G1 X92.843 Y101.978 F7800.000
+G1 X93.273 Y101.453
+G1 F1815
+G1 X98.306 Y106.487 E9.02942
+G1 X98.719 Y106.590 E9.04990
+G1 X99.411 Y106.687 E9.08350
+G1 X100.000 Y106.713 E9.11187
+G1 X100.579 Y106.688 E9.13975
+G1 X101.286 Y106.589 E9.17408
+G1 X101.845 Y106.455 E9.20171
+G1 X102.515 Y106.224 E9.23579
+G1 X103.148 Y105.929 E9.26939
+G1 X103.652 Y105.633 E9.29749
+G1 X104.225 Y105.217 E9.33153
+G1 X104.747 Y104.747 E9.36533
+G1 X95.253 Y95.253 E10.01105
+G1 X95.779 Y94.780 E10.04509
+G1 X96.249 Y94.433 E10.07320
+G1 X96.848 Y94.073 E10.10679
+G1 X97.485 Y93.776 E10.14060
+G1 X98.155 Y93.545 E10.17467
+G1 X98.714 Y93.411 E10.20230
+G1 X99.420 Y93.312 E10.23661
+G1 X100.004 Y93.287 E10.26471
+G1 X100.701 Y93.324 E10.29831
+G1 X101.401 Y93.435 E10.33239
+G1 X101.690 Y93.509 E10.34671
+G1 X106.727 Y98.547 E10.68936
+G1 X106.779 Y101.178 F7800.000
+G1 F1815
+G1 X94.717 Y104.410 E11.29001
+G1 X93.221 Y98.822 F7800.000
+G1 F1815
+G1 X105.283 Y95.590 E11.89064
+G1 X104.624 Y105.090 F7800.000
+G1 F1815
+G1 X106.468 Y98.210 E12.23321
+G1 X106.224 Y97.485 E12.27002
+G1 X105.929 Y96.852 E12.30362
+G1 X105.633 Y96.348 E12.33172
+G1 X105.217 Y95.775 E12.36576
+G1 X104.743 Y95.249 E12.39983
+G1 X104.319 Y94.861 E12.42746
+G1 X103.749 Y94.431 E12.46179
+G1 X103.259 Y94.131 E12.48942
+G1 X102.623 Y93.821 E12.52348
+G1 X101.957 Y93.579 E12.55755
+G1 X101.736 Y93.521 E12.56855
+G1 X98.265 Y106.476 E13.21361
+G1 X98.032 Y106.418 E13.22513
+G1 X97.482 Y106.223 E13.25323
+G1 X96.849 Y105.927 E13.28683
+G1 X96.242 Y105.563 E13.32089
+G1 X95.772 Y105.215 E13.34899
+G1 X95.254 Y104.747 E13.38258
+G1 X94.780 Y104.221 E13.41664
+G1 X94.433 Y103.751 E13.44475
+G1 X94.073 Y103.152 E13.47834
+G1 X93.776 Y102.515 E13.51215
+G1 X93.545 Y101.845 E13.54622
+G1 X93.532 Y101.790 E13.54896
+G1 X95.376 Y94.910 E13.89153
+G1 E11.89153 F2400.00000
+G92 E0
+G1 X141.749 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X157.931 Y100.996 E2.77830
+G1 X157.931 Y114.004 E3.40391
+G1 X141.749 Y114.004 E4.18221
+G1 X141.749 Y101.056 E4.80494
+G1 X141.363 Y100.611 F7800.000
+G1 F1815
+G1 X158.316 Y100.611 E5.62033
+G1 X158.316 Y114.389 E6.28304
+G1 X141.363 Y114.389 E7.09843
+G1 X141.363 Y100.671 E7.75826
+G1 X140.978 Y100.225 F7800.000
+G1 F1800
+G1 X158.702 Y100.225 E8.61074
+G1 X158.702 Y114.775 E9.31055
+G1 X140.978 Y114.775 E10.16303
+G1 X140.978 Y100.285 E10.85995
+G1 X141.367 Y100.316 F7800.000
+G1 X141.864 Y105.708
+G1 F1815
+G1 X149.871 Y113.715 E11.40453
+G1 X157.642 Y113.715 E11.77828
+G1 X157.642 Y113.305 E11.79797
+G1 X145.622 Y101.285 E12.61554
+G1 X153.802 Y101.285 E13.00898
+G1 X157.815 Y105.298 E13.28193
+G1 X157.815 Y102.904 F7800.000
+G1 F1815
+G1 X141.864 Y107.178 E14.07617
+G1 X141.864 Y113.166 F7800.000
+G1 F1815
+G1 X157.815 Y108.892 E14.87040
+G1 X156.113 Y113.888 F7800.000
+G1 F1815
+G1 X157.642 Y108.184 E15.15443
+G1 X157.642 Y101.285 E15.48622
+G1 X153.502 Y101.285 E15.68534
+G1 X150.171 Y113.715 E16.30422
+G1 X144.183 Y113.715 E16.59224
+G1 X147.560 Y101.112 E17.21977
+G1 Z1.550 F7800.000
+G1 E15.21977 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1811
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1811
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1811
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1811
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1811
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1811
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.300 Y102.020 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1811
+G1 X93.127 Y101.340 E2.03373
+G1 X93.024 Y100.606 E2.06940
+G1 X92.997 Y100.000 E2.09856
+G1 X93.025 Y99.382 E2.12834
+G1 X93.126 Y98.664 E2.16320
+G1 X93.305 Y97.949 E2.19865
+G1 X93.510 Y97.370 E2.22823
+G1 X93.817 Y96.713 E2.26309
+G1 X94.197 Y96.081 E2.29854
+G1 X94.563 Y95.587 E2.32811
+G1 X95.048 Y95.049 E2.36297
+G1 X95.596 Y94.556 E2.39843
+G1 X96.091 Y94.190 E2.42800
+G1 X96.712 Y93.817 E2.46286
+G1 X97.377 Y93.507 E2.49813
+G1 X98.074 Y93.267 E2.53359
+G1 X98.660 Y93.127 E2.56256
+G1 X99.394 Y93.024 E2.59821
+G1 X100.008 Y92.997 E2.62778
+G1 X100.732 Y93.036 E2.66264
+G1 X101.460 Y93.151 E2.69812
+G1 X102.043 Y93.302 E2.72708
+G1 X102.736 Y93.554 E2.76254
+G1 X103.399 Y93.877 E2.79801
+G1 X103.916 Y94.194 E2.82716
+G1 X104.413 Y94.563 E2.85694
+G1 X104.951 Y95.048 E2.89180
+G1 X105.444 Y95.596 E2.92725
+G1 X105.810 Y96.091 E2.95683
+G1 X106.183 Y96.712 E2.99169
+G1 X106.493 Y97.377 E3.02696
+G1 X106.733 Y98.074 E3.06242
+G1 X106.873 Y98.660 E3.09138
+G1 X106.976 Y99.394 E3.12705
+G1 X107.003 Y100.000 E3.15620
+G1 X106.975 Y100.618 E3.18599
+G1 X106.874 Y101.336 E3.22085
+G1 X106.695 Y102.051 E3.25630
+G1 X106.490 Y102.630 E3.28587
+G1 X106.183 Y103.287 E3.32073
+G1 X105.803 Y103.919 E3.35619
+G1 X105.437 Y104.413 E3.38576
+G1 X104.952 Y104.951 E3.42062
+G1 X104.407 Y105.442 E3.45589
+G1 X103.810 Y105.875 E3.49135
+G1 X103.291 Y106.181 E3.52032
+G1 X102.623 Y106.493 E3.55578
+G1 X101.926 Y106.733 E3.59124
+G1 X101.340 Y106.873 E3.62021
+G1 X100.606 Y106.976 E3.65588
+G1 X100.000 Y107.003 E3.68503
+G1 X99.382 Y106.975 E3.71481
+G1 X98.664 Y106.874 E3.74967
+G1 X97.949 Y106.695 E3.78513
+G1 X97.370 Y106.490 E3.81470
+G1 X96.713 Y106.183 E3.84956
+G1 X96.081 Y105.803 E3.88501
+G1 X95.587 Y105.437 E3.91459
+G1 X95.049 Y104.952 E3.94945
+G1 X94.558 Y104.407 E3.98472
+G1 X94.125 Y103.811 E4.02015
+G1 X93.813 Y103.281 E4.04973
+G1 X93.508 Y102.623 E4.08459
+G1 X93.319 Y102.077 E4.11239
+G1 X92.935 Y102.146 F7800.000
+G1 F1811
+G1 X92.748 Y101.412 E4.14879
+G1 X92.639 Y100.641 E4.18625
+G1 X92.611 Y100.000 E4.21711
+G1 X92.640 Y99.346 E4.24860
+G1 X92.747 Y98.590 E4.28531
+G1 X92.935 Y97.837 E4.32263
+G1 X93.153 Y97.223 E4.35399
+G1 X93.476 Y96.531 E4.39071
+G1 X93.876 Y95.866 E4.42803
+G1 X94.264 Y95.343 E4.45939
+G1 X94.775 Y94.776 E4.49610
+G1 X95.352 Y94.256 E4.53342
+G1 X95.877 Y93.869 E4.56478
+G1 X96.531 Y93.476 E4.60150
+G1 X97.232 Y93.149 E4.63870
+G1 X97.966 Y92.897 E4.67603
+G1 X98.588 Y92.748 E4.70678
+G1 X99.358 Y92.639 E4.74421
+G1 X100.010 Y92.611 E4.77558
+G1 X100.772 Y92.652 E4.81229
+G1 X101.539 Y92.773 E4.84962
+G1 X102.158 Y92.933 E4.88037
+G1 X102.887 Y93.199 E4.91770
+G1 X103.584 Y93.539 E4.95502
+G1 X104.132 Y93.874 E4.98588
+G1 X104.657 Y94.264 E5.01737
+G1 X105.224 Y94.775 E5.05408
+G1 X105.744 Y95.352 E5.09140
+G1 X106.131 Y95.877 E5.12277
+G1 X106.524 Y96.531 E5.15948
+G1 X106.851 Y97.232 E5.19669
+G1 X107.103 Y97.966 E5.23401
+G1 X107.252 Y98.588 E5.26476
+G1 X107.361 Y99.359 E5.30221
+G1 X107.389 Y100.000 E5.33307
+G1 X107.360 Y100.654 E5.36456
+G1 X107.253 Y101.410 E5.40127
+G1 X107.065 Y102.163 E5.43859
+G1 X106.847 Y102.777 E5.46996
+G1 X106.524 Y103.469 E5.50667
+G1 X106.124 Y104.134 E5.54399
+G1 X105.736 Y104.657 E5.57535
+G1 X105.225 Y105.224 E5.61206
+G1 X104.650 Y105.742 E5.64927
+G1 X104.022 Y106.198 E5.68660
+G1 X103.471 Y106.523 E5.71734
+G1 X102.768 Y106.851 E5.75467
+G1 X102.034 Y107.103 E5.79199
+G1 X101.412 Y107.252 E5.82274
+G1 X100.641 Y107.361 E5.86019
+G1 X100.000 Y107.389 E5.89105
+G1 X99.346 Y107.360 E5.92254
+G1 X98.590 Y107.253 E5.95925
+G1 X97.837 Y107.065 E5.99658
+G1 X97.223 Y106.847 E6.02794
+G1 X96.531 Y106.524 E6.06465
+G1 X95.866 Y106.124 E6.10197
+G1 X95.343 Y105.736 E6.13333
+G1 X94.776 Y105.225 E6.17005
+G1 X94.258 Y104.650 E6.20725
+G1 X93.802 Y104.022 E6.24456
+G1 X93.472 Y103.460 E6.27592
+G1 X93.150 Y102.768 E6.31264
+G1 X92.955 Y102.202 E6.34141
+G1 X92.571 Y102.271 F7800.000
+G1 F1800
+G1 X92.368 Y101.484 E6.38048
+G1 X92.255 Y100.677 E6.41972
+G1 X92.225 Y100.000 E6.45229
+G1 X92.256 Y99.311 E6.48548
+G1 X92.368 Y98.517 E6.52405
+G1 X92.565 Y97.726 E6.56324
+G1 X92.796 Y97.077 E6.59639
+G1 X93.135 Y96.350 E6.63495
+G1 X93.555 Y95.652 E6.67414
+G1 X93.965 Y95.098 E6.70729
+G1 X94.502 Y94.503 E6.74586
+G1 X95.108 Y93.957 E6.78504
+G1 X95.662 Y93.548 E6.81819
+G1 X96.350 Y93.135 E6.85676
+G1 X97.088 Y92.791 E6.89590
+G1 X97.858 Y92.526 E6.93509
+G1 X98.516 Y92.368 E6.96762
+G1 X99.323 Y92.255 E7.00685
+G1 X100.012 Y92.225 E7.04000
+G1 X100.813 Y92.268 E7.07857
+G1 X101.617 Y92.395 E7.11776
+G1 X102.272 Y92.565 E7.15028
+G1 X103.038 Y92.843 E7.18947
+G1 X103.770 Y93.201 E7.22866
+G1 X104.348 Y93.554 E7.26123
+G1 X104.902 Y93.965 E7.29443
+G1 X105.497 Y94.502 E7.33299
+G1 X106.043 Y95.108 E7.37218
+G1 X106.452 Y95.662 E7.40533
+G1 X106.865 Y96.350 E7.44390
+G1 X107.209 Y97.088 E7.48304
+G1 X107.474 Y97.858 E7.52223
+G1 X107.632 Y98.516 E7.55476
+G1 X107.745 Y99.323 E7.59399
+G1 X107.775 Y100.000 E7.62656
+G1 X107.744 Y100.689 E7.65976
+G1 X107.632 Y101.483 E7.69833
+G1 X107.435 Y102.274 E7.73751
+G1 X107.204 Y102.923 E7.77066
+G1 X106.865 Y103.650 E7.80923
+G1 X106.445 Y104.348 E7.84842
+G1 X106.035 Y104.902 E7.88156
+G1 X105.498 Y105.497 E7.92013
+G1 X104.893 Y106.042 E7.95928
+G1 X104.234 Y106.521 E7.99846
+G1 X103.651 Y106.864 E8.03099
+G1 X102.912 Y107.209 E8.07018
+G1 X102.142 Y107.474 E8.10937
+G1 X101.484 Y107.632 E8.14190
+G1 X100.677 Y107.745 E8.18113
+G1 X100.000 Y107.775 E8.21370
+G1 X99.311 Y107.744 E8.24690
+G1 X98.517 Y107.632 E8.28546
+G1 X97.726 Y107.435 E8.32465
+G1 X97.077 Y107.204 E8.35780
+G1 X96.350 Y106.865 E8.39637
+G1 X95.652 Y106.445 E8.43555
+G1 X95.098 Y106.035 E8.46870
+G1 X94.503 Y105.498 E8.50727
+G1 X93.958 Y104.893 E8.54641
+G1 X93.479 Y104.234 E8.58560
+G1 X93.130 Y103.639 E8.61875
+G1 X92.791 Y102.913 E8.65731
+G1 X92.590 Y102.328 E8.68705
+G1 X92.843 Y101.979 F7800.000
+G1 X93.273 Y101.453
+G1 F1811
+G1 X98.306 Y106.487 E9.02942
+G1 X98.720 Y106.590 E9.04990
+G1 X99.409 Y106.687 E9.08337
+G1 X100.001 Y106.713 E9.11187
+G1 X100.579 Y106.688 E9.13974
+G1 X101.286 Y106.589 E9.17408
+G1 X101.845 Y106.455 E9.20171
+G1 X102.515 Y106.224 E9.23577
+G1 X103.157 Y105.925 E9.26984
+G1 X103.652 Y105.633 E9.29746
+G1 X104.224 Y105.217 E9.33153
+G1 X104.747 Y104.747 E9.36532
+G1 X95.253 Y95.253 E10.01105
+G1 X95.779 Y94.780 E10.04508
+G1 X96.251 Y94.431 E10.07332
+G1 X96.848 Y94.073 E10.10679
+G1 X97.485 Y93.776 E10.14060
+G1 X98.155 Y93.545 E10.17467
+G1 X98.714 Y93.411 E10.20229
+G1 X99.420 Y93.312 E10.23660
+G1 X100.006 Y93.287 E10.26483
+G1 X100.701 Y93.324 E10.29830
+G1 X101.401 Y93.435 E10.33239
+G1 X101.690 Y93.509 E10.34671
+G1 X106.727 Y98.547 E10.68936
+G1 X106.779 Y101.178 F7800.000
+G1 F1811
+G1 X94.717 Y104.410 E11.29001
+G1 X93.221 Y98.822 F7800.000
+G1 F1811
+G1 X105.283 Y95.590 E11.89065
+G1 X104.624 Y105.090 F7800.000
+G1 F1811
+G1 X106.468 Y98.210 E12.23322
+G1 X106.224 Y97.485 E12.27001
+G1 X105.927 Y96.848 E12.30383
+G1 X105.569 Y96.251 E12.33730
+G1 X105.220 Y95.779 E12.36553
+G1 X104.746 Y95.253 E12.39959
+G1 X104.230 Y94.787 E12.43305
+G1 X103.754 Y94.434 E12.46156
+G1 X103.259 Y94.131 E12.48943
+G1 X102.623 Y93.821 E12.52349
+G1 X101.957 Y93.579 E12.55756
+G1 X101.736 Y93.521 E12.56855
+G1 X98.265 Y106.476 E13.21362
+G1 X98.033 Y106.418 E13.22513
+G1 X97.479 Y106.222 E13.25336
+G1 X96.849 Y105.927 E13.28683
+G1 X96.242 Y105.563 E13.32089
+G1 X95.770 Y105.213 E13.34912
+G1 X95.254 Y104.747 E13.38259
+G1 X94.783 Y104.224 E13.41640
+G1 X94.367 Y103.652 E13.45044
+G1 X94.070 Y103.146 E13.47867
+G1 X93.776 Y102.515 E13.51214
+G1 X93.545 Y101.845 E13.54623
+G1 X93.532 Y101.790 E13.54896
+G1 X95.376 Y94.910 E13.89153
+G1 E11.89153 F2400.00000
+G92 E0
+G1 X141.954 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1811
+G1 X158.136 Y100.996 E2.77830
+G1 X158.136 Y114.004 E3.40391
+G1 X141.954 Y114.004 E4.18221
+G1 X141.954 Y101.056 E4.80494
+G1 X141.568 Y100.611 F7800.000
+G1 F1811
+G1 X158.522 Y100.611 E5.62033
+G1 X158.522 Y114.389 E6.28304
+G1 X141.568 Y114.389 E7.09843
+G1 X141.568 Y100.671 E7.75826
+G1 X141.183 Y100.225 F7800.000
+G1 F1800
+G1 X158.907 Y100.225 E8.61074
+G1 X158.907 Y114.775 E9.31055
+G1 X141.183 Y114.775 E10.16303
+G1 X141.183 Y100.285 E10.85995
+G1 X141.572 Y100.316 F7800.000
+G1 X142.070 Y105.913
+G1 F1811
+G1 X149.871 Y113.715 E11.39057
+G1 X157.847 Y113.715 E11.77419
+G1 X157.847 Y113.510 E11.78401
+G1 X145.622 Y101.285 E12.61554
+G1 X153.802 Y101.285 E13.00898
+G1 X158.020 Y105.504 E13.29589
+G1 X158.020 Y102.849 F7800.000
+G1 F1811
+G1 X142.070 Y107.123 E14.09013
+G1 X142.070 Y113.111 F7800.000
+G1 F1811
+G1 X158.020 Y108.837 E14.88436
+G1 X156.113 Y113.888 F7800.000
+G1 F1811
+G1 X157.847 Y107.418 E15.20653
+G1 X157.847 Y101.285 E15.50148
+G1 X153.502 Y101.285 E15.71047
+G1 X150.171 Y113.715 E16.32935
+G1 X144.183 Y113.715 E16.61737
+G1 X147.560 Y101.112 E17.24490
+G1 Z1.850 F7800.000
+G1 E15.24490 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1813
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1813
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1813
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1813
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1813
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.304 Y102.048 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X93.126 Y101.336 E2.03527
+G1 X93.024 Y100.606 E2.07074
+G1 X92.997 Y100.000 E2.09991
+G1 X93.024 Y99.394 E2.12908
+G1 X93.127 Y98.660 E2.16475
+G1 X93.267 Y98.074 E2.19372
+G1 X93.507 Y97.377 E2.22918
+G1 X93.819 Y96.709 E2.26461
+G1 X94.133 Y96.177 E2.29432
+G1 X94.558 Y95.594 E2.32905
+G1 X95.049 Y95.049 E2.36432
+G1 X95.596 Y94.556 E2.39975
+G1 X96.093 Y94.189 E2.42946
+G1 X96.712 Y93.817 E2.46419
+G1 X97.377 Y93.507 E2.49946
+G1 X98.074 Y93.267 E2.53492
+G1 X98.660 Y93.127 E2.56389
+G1 X99.393 Y93.024 E2.59953
+G1 X100.010 Y92.998 E2.62924
+G1 X100.732 Y93.036 E2.66396
+G1 X101.460 Y93.151 E2.69945
+G1 X102.043 Y93.302 E2.72841
+G1 X102.736 Y93.554 E2.76387
+G1 X103.399 Y93.877 E2.79934
+G1 X103.912 Y94.192 E2.82830
+G1 X104.505 Y94.638 E2.86397
+G1 X104.949 Y95.045 E2.89294
+G1 X105.445 Y95.596 E2.92861
+G1 X105.803 Y96.081 E2.95757
+G1 X106.185 Y96.716 E2.99322
+G1 X106.450 Y97.274 E3.02292
+G1 X106.696 Y97.952 E3.05765
+G1 X106.874 Y98.664 E3.09292
+G1 X106.976 Y99.394 E3.12838
+G1 X107.003 Y100.000 E3.15756
+G1 X106.976 Y100.606 E3.18673
+G1 X106.873 Y101.340 E3.22237
+G1 X106.728 Y101.940 E3.25208
+G1 X106.493 Y102.623 E3.28681
+G1 X106.181 Y103.291 E3.32229
+G1 X105.875 Y103.810 E3.35125
+G1 X105.442 Y104.407 E3.38672
+G1 X104.951 Y104.951 E3.42197
+G1 X104.404 Y105.445 E3.45743
+G1 X103.919 Y105.803 E3.48640
+G1 X103.284 Y106.185 E3.52204
+G1 X102.726 Y106.450 E3.55174
+G1 X102.048 Y106.696 E3.58647
+G1 X101.336 Y106.874 E3.62175
+G1 X100.606 Y106.976 E3.65721
+G1 X100.000 Y107.003 E3.68638
+G1 X99.394 Y106.976 E3.71556
+G1 X98.660 Y106.873 E3.75120
+G1 X98.060 Y106.728 E3.78090
+G1 X97.377 Y106.493 E3.81563
+G1 X96.709 Y106.181 E3.85109
+G1 X96.177 Y105.867 E3.88079
+G1 X95.594 Y105.442 E3.91552
+G1 X95.046 Y104.949 E3.95098
+G1 X94.629 Y104.493 E3.98068
+G1 X94.195 Y103.916 E4.01541
+G1 X93.815 Y103.284 E4.05086
+G1 X93.550 Y102.726 E4.08057
+G1 X93.324 Y102.104 E4.11241
+G1 X92.941 Y102.179 F7800.000
+G1 F1813
+G1 X92.747 Y101.410 E4.15058
+G1 X92.639 Y100.641 E4.18790
+G1 X92.611 Y100.000 E4.21878
+G1 X92.639 Y99.359 E4.24965
+G1 X92.748 Y98.588 E4.28711
+G1 X92.897 Y97.966 E4.31785
+G1 X93.149 Y97.232 E4.35518
+G1 X93.477 Y96.529 E4.39248
+G1 X93.810 Y95.965 E4.42398
+G1 X94.258 Y95.350 E4.46056
+G1 X94.776 Y94.776 E4.49777
+G1 X95.352 Y94.256 E4.53508
+G1 X95.879 Y93.868 E4.56657
+G1 X96.531 Y93.476 E4.60315
+G1 X97.232 Y93.149 E4.64036
+G1 X97.966 Y92.897 E4.67769
+G1 X98.588 Y92.748 E4.70843
+G1 X99.358 Y92.639 E4.74587
+G1 X100.013 Y92.611 E4.77736
+G1 X100.772 Y92.652 E4.81394
+G1 X101.539 Y92.773 E4.85128
+G1 X102.158 Y92.933 E4.88203
+G1 X102.887 Y93.199 E4.91935
+G1 X103.584 Y93.539 E4.95668
+G1 X104.129 Y93.873 E4.98742
+G1 X104.751 Y94.342 E5.02488
+G1 X105.223 Y94.774 E5.05562
+G1 X105.744 Y95.352 E5.09308
+G1 X106.124 Y95.866 E5.12382
+G1 X106.525 Y96.533 E5.16126
+G1 X106.806 Y97.125 E5.19275
+G1 X107.066 Y97.840 E5.22933
+G1 X107.253 Y98.590 E5.26654
+G1 X107.361 Y99.359 E5.30387
+G1 X107.389 Y100.000 E5.33474
+G1 X107.361 Y100.641 E5.36562
+G1 X107.252 Y101.412 E5.40305
+G1 X107.099 Y102.049 E5.43455
+G1 X106.851 Y102.768 E5.47113
+G1 X106.523 Y103.471 E5.50846
+G1 X106.198 Y104.022 E5.53921
+G1 X105.742 Y104.650 E5.57654
+G1 X105.224 Y105.224 E5.61373
+G1 X104.648 Y105.744 E5.65106
+G1 X104.134 Y106.124 E5.68180
+G1 X103.467 Y106.525 E5.71924
+G1 X102.875 Y106.806 E5.75073
+G1 X102.160 Y107.066 E5.78731
+G1 X101.410 Y107.253 E5.82452
+G1 X100.641 Y107.361 E5.86185
+G1 X100.000 Y107.389 E5.89272
+G1 X99.359 Y107.361 E5.92360
+G1 X98.588 Y107.252 E5.96103
+G1 X97.951 Y107.099 E5.99253
+G1 X97.232 Y106.851 E6.02911
+G1 X96.529 Y106.523 E6.06643
+G1 X95.965 Y106.190 E6.09792
+G1 X95.350 Y105.742 E6.13450
+G1 X94.774 Y105.223 E6.17182
+G1 X94.332 Y104.740 E6.20332
+G1 X93.875 Y104.132 E6.23990
+G1 X93.475 Y103.467 E6.27722
+G1 X93.194 Y102.875 E6.30871
+G1 X92.962 Y102.236 E6.34145
+G1 X92.579 Y102.311 F7800.000
+G1 F1800
+G1 X92.368 Y101.483 E6.38251
+G1 X92.255 Y100.677 E6.42170
+G1 X92.225 Y100.000 E6.45427
+G1 X92.255 Y99.323 E6.48685
+G1 X92.368 Y98.516 E6.52608
+G1 X92.526 Y97.858 E6.55861
+G1 X92.791 Y97.088 E6.59780
+G1 X93.136 Y96.349 E6.63698
+G1 X93.488 Y95.753 E6.67026
+G1 X93.958 Y95.107 E6.70870
+G1 X94.502 Y94.502 E6.74784
+G1 X95.108 Y93.957 E6.78702
+G1 X95.665 Y93.546 E6.82031
+G1 X96.350 Y93.135 E6.85874
+G1 X97.088 Y92.791 E6.89788
+G1 X97.858 Y92.526 E6.93707
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00883
+G1 X100.015 Y92.225 E7.04211
+G1 X100.813 Y92.268 E7.08055
+G1 X101.617 Y92.395 E7.11974
+G1 X102.272 Y92.565 E7.15227
+G1 X103.038 Y92.843 E7.19145
+G1 X103.770 Y93.201 E7.23064
+G1 X104.347 Y93.554 E7.26317
+G1 X104.998 Y94.045 E7.30240
+G1 X105.497 Y94.502 E7.33493
+G1 X106.043 Y95.108 E7.37417
+G1 X106.445 Y95.652 E7.40669
+G1 X106.865 Y96.351 E7.44592
+G1 X107.162 Y96.976 E7.47921
+G1 X107.435 Y97.727 E7.51764
+G1 X107.632 Y98.517 E7.55679
+G1 X107.745 Y99.323 E7.59597
+G1 X107.775 Y100.000 E7.62855
+G1 X107.745 Y100.677 E7.66112
+G1 X107.632 Y101.484 E7.70035
+G1 X107.469 Y102.157 E7.73364
+G1 X107.209 Y102.912 E7.77207
+G1 X106.864 Y103.651 E7.81126
+G1 X106.521 Y104.234 E7.84379
+G1 X106.042 Y104.893 E7.88298
+G1 X105.498 Y105.498 E7.92212
+G1 X104.892 Y106.043 E7.96131
+G1 X104.348 Y106.445 E7.99383
+G1 X103.649 Y106.865 E8.03306
+G1 X103.024 Y107.162 E8.06635
+G1 X102.273 Y107.435 E8.10478
+G1 X101.483 Y107.632 E8.14392
+G1 X100.677 Y107.745 E8.18311
+G1 X100.000 Y107.775 E8.21569
+G1 X99.323 Y107.745 E8.24826
+G1 X98.516 Y107.632 E8.28749
+G1 X97.843 Y107.469 E8.32077
+G1 X97.088 Y107.209 E8.35921
+G1 X96.349 Y106.864 E8.39839
+G1 X95.753 Y106.512 E8.43168
+G1 X95.107 Y106.042 E8.47011
+G1 X94.502 Y105.497 E8.50930
+G1 X94.035 Y104.986 E8.54258
+G1 X93.555 Y104.348 E8.58101
+G1 X93.135 Y103.649 E8.62020
+G1 X92.838 Y103.024 E8.65348
+G1 X92.599 Y102.367 E8.68710
+G1 X92.851 Y102.018 F7800.000
+G1 X93.275 Y101.455
+G1 F1813
+G1 X98.311 Y106.492 E9.02965
+G1 X98.714 Y106.589 E9.04959
+G1 X99.421 Y106.688 E9.08389
+G1 X100.000 Y106.713 E9.11179
+G1 X100.579 Y106.688 E9.13969
+G1 X101.281 Y106.589 E9.17375
+G1 X101.963 Y106.419 E9.20757
+G1 X102.615 Y106.183 E9.24091
+G1 X103.147 Y105.930 E9.26927
+G1 X103.759 Y105.562 E9.30357
+G1 X104.220 Y105.221 E9.33120
+G1 X104.747 Y104.747 E9.36527
+G1 X95.253 Y95.253 E10.01099
+G1 X95.779 Y94.780 E10.04502
+G1 X96.254 Y94.430 E10.07338
+G1 X96.848 Y94.073 E10.10672
+G1 X97.485 Y93.776 E10.14054
+G1 X98.155 Y93.545 E10.17461
+G1 X98.714 Y93.411 E10.20224
+G1 X99.420 Y93.312 E10.23654
+G1 X100.009 Y93.287 E10.26490
+G1 X100.701 Y93.324 E10.29824
+G1 X101.401 Y93.435 E10.33233
+G1 X101.690 Y93.509 E10.34665
+G1 X106.725 Y98.545 E10.68914
+G1 X106.779 Y101.178 F7800.000
+G1 F1813
+G1 X94.712 Y104.411 E11.29000
+G1 X93.221 Y98.822 F7800.000
+G1 F1813
+G1 X105.283 Y95.590 E11.89064
+G1 X104.624 Y105.090 F7800.000
+G1 F1813
+G1 X106.465 Y98.221 E12.23271
+G1 X106.419 Y98.037 E12.24181
+G1 X106.183 Y97.385 E12.27515
+G1 X105.930 Y96.853 E12.30351
+G1 X105.562 Y96.241 E12.33781
+G1 X105.221 Y95.780 E12.36544
+G1 X104.743 Y95.249 E12.39978
+G1 X104.319 Y94.861 E12.42741
+G1 X103.749 Y94.431 E12.46174
+G1 X103.259 Y94.131 E12.48937
+G1 X102.623 Y93.821 E12.52343
+G1 X101.957 Y93.579 E12.55750
+G1 X101.736 Y93.521 E12.56850
+G1 X98.264 Y106.480 E13.21375
+G1 X97.486 Y106.224 E13.25314
+G1 X96.844 Y105.925 E13.28719
+G1 X96.336 Y105.625 E13.31555
+G1 X95.776 Y105.217 E13.34889
+G1 X95.250 Y104.743 E13.38295
+G1 X94.852 Y104.308 E13.41131
+G1 X94.435 Y103.754 E13.44465
+G1 X94.070 Y103.147 E13.47871
+G1 X93.817 Y102.615 E13.50707
+G1 X93.581 Y101.963 E13.54041
+G1 X93.535 Y101.779 E13.54951
+G1 X95.376 Y94.910 E13.89158
+G1 E11.89158 F2400.00000
+G92 E0
+G1 X142.159 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X158.341 Y100.996 E2.77830
+G1 X158.341 Y114.004 E3.40391
+G1 X142.159 Y114.004 E4.18221
+G1 X142.159 Y101.056 E4.80494
+G1 X141.774 Y100.611 F7800.000
+G1 F1813
+G1 X158.727 Y100.611 E5.62033
+G1 X158.727 Y114.389 E6.28304
+G1 X141.774 Y114.389 E7.09843
+G1 X141.774 Y100.671 E7.75826
+G1 X141.388 Y100.225 F7800.000
+G1 F1800
+G1 X159.112 Y100.225 E8.61074
+G1 X159.112 Y114.775 E9.31055
+G1 X141.388 Y114.775 E10.16303
+G1 X141.388 Y100.285 E10.85995
+G1 X141.778 Y100.316 F7800.000
+G1 X142.275 Y106.119
+G1 F1813
+G1 X149.871 Y113.715 E11.37661
+G1 X158.051 Y113.715 E11.77005
+G1 X145.622 Y101.285 E12.61547
+G1 X153.802 Y101.285 E13.00891
+G1 X158.226 Y105.709 E13.30979
+G1 X158.226 Y102.794 F7800.000
+G1 F1813
+G1 X142.275 Y107.068 E14.10402
+G1 X142.275 Y113.056 F7800.000
+G1 F1813
+G1 X158.226 Y108.782 E14.89825
+G1 X156.113 Y113.888 F7800.000
+G1 F1813
+G1 X158.052 Y106.652 E15.25856
+G1 X158.052 Y101.285 E15.51667
+G1 X153.502 Y101.285 E15.73553
+G1 X150.171 Y113.715 E16.35442
+G1 X144.183 Y113.715 E16.64243
+G1 X147.560 Y101.112 E17.26996
+G1 Z2.150 F7800.000
+G1 E15.26996 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1814
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1814
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1814
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1814
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1814
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1814
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.058 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1814
+G1 X93.126 Y101.337 E2.03583
+G1 X93.035 Y100.719 E2.06588
+G1 X92.997 Y99.996 E2.10069
+G1 X93.024 Y99.394 E2.12968
+G1 X93.126 Y98.664 E2.16514
+G1 X93.304 Y97.949 E2.20057
+G1 X93.512 Y97.365 E2.23040
+G1 X93.817 Y96.713 E2.26500
+G1 X94.197 Y96.081 E2.30049
+G1 X94.555 Y95.596 E2.32945
+G1 X95.049 Y95.049 E2.36491
+G1 X95.596 Y94.556 E2.40034
+G1 X96.095 Y94.187 E2.43018
+G1 X96.712 Y93.817 E2.46478
+G1 X97.377 Y93.507 E2.50006
+G1 X98.074 Y93.267 E2.53552
+G1 X98.660 Y93.127 E2.56448
+G1 X99.393 Y93.024 E2.60012
+G1 X100.013 Y92.998 E2.62995
+G1 X100.731 Y93.036 E2.66456
+G1 X101.460 Y93.151 E2.70001
+G1 X102.060 Y93.307 E2.72984
+G1 X102.736 Y93.554 E2.76444
+G1 X103.399 Y93.877 E2.79993
+G1 X103.912 Y94.192 E2.82889
+G1 X104.505 Y94.638 E2.86456
+G1 X104.949 Y95.045 E2.89353
+G1 X105.442 Y95.593 E2.92899
+G1 X105.875 Y96.190 E2.96445
+G1 X106.181 Y96.709 E2.99342
+G1 X106.493 Y97.377 E3.02888
+G1 X106.733 Y98.074 E3.06434
+G1 X106.873 Y98.660 E3.09331
+G1 X106.976 Y99.394 E3.12898
+G1 X107.003 Y99.999 E3.15812
+G1 X106.975 Y100.623 E3.18816
+G1 X106.874 Y101.336 E3.22276
+G1 X106.696 Y102.051 E3.25822
+G1 X106.488 Y102.635 E3.28805
+G1 X106.183 Y103.287 E3.32265
+G1 X105.803 Y103.919 E3.35814
+G1 X105.445 Y104.404 E3.38710
+G1 X104.951 Y104.951 E3.42256
+G1 X104.407 Y105.442 E3.45782
+G1 X103.810 Y105.875 E3.49328
+G1 X103.291 Y106.181 E3.52224
+G1 X102.623 Y106.493 E3.55770
+G1 X101.926 Y106.733 E3.59317
+G1 X101.340 Y106.873 E3.62213
+G1 X100.606 Y106.976 E3.65780
+G1 X100.001 Y107.003 E3.68694
+G1 X99.377 Y106.975 E3.71699
+G1 X98.664 Y106.874 E3.75159
+G1 X97.949 Y106.696 E3.78704
+G1 X97.365 Y106.488 E3.81687
+G1 X96.713 Y106.183 E3.85147
+G1 X96.081 Y105.803 E3.88696
+G1 X95.596 Y105.445 E3.91592
+G1 X95.049 Y104.951 E3.95139
+G1 X94.556 Y104.404 E3.98682
+G1 X94.187 Y103.905 E4.01665
+G1 X93.817 Y103.288 E4.05125
+G1 X93.507 Y102.623 E4.08653
+G1 X93.332 Y102.115 E4.11239
+G1 X92.948 Y102.184 F7800.000
+G1 F1814
+G1 X92.747 Y101.410 E4.15082
+G1 X92.650 Y100.757 E4.18257
+G1 X92.611 Y99.998 E4.21915
+G1 X92.639 Y99.359 E4.24991
+G1 X92.747 Y98.590 E4.28724
+G1 X92.935 Y97.838 E4.32454
+G1 X93.155 Y97.218 E4.35617
+G1 X93.476 Y96.532 E4.39262
+G1 X93.876 Y95.866 E4.42996
+G1 X94.256 Y95.352 E4.46071
+G1 X94.776 Y94.776 E4.49803
+G1 X95.352 Y94.257 E4.53534
+G1 X95.881 Y93.866 E4.56696
+G1 X96.531 Y93.476 E4.60341
+G1 X97.232 Y93.149 E4.64062
+G1 X97.966 Y92.897 E4.67795
+G1 X98.588 Y92.748 E4.70869
+G1 X99.358 Y92.639 E4.74613
+G1 X100.015 Y92.611 E4.77775
+G1 X100.772 Y92.652 E4.81420
+G1 X101.538 Y92.773 E4.85152
+G1 X102.175 Y92.939 E4.88315
+G1 X102.887 Y93.199 E4.91960
+G1 X103.584 Y93.539 E4.95694
+G1 X104.129 Y93.873 E4.98768
+G1 X104.751 Y94.342 E5.02514
+G1 X105.223 Y94.774 E5.05588
+G1 X105.742 Y95.350 E5.09321
+G1 X106.198 Y95.978 E5.13053
+G1 X106.523 Y96.529 E5.16128
+G1 X106.851 Y97.232 E5.19860
+G1 X107.103 Y97.966 E5.23593
+G1 X107.252 Y98.588 E5.26667
+G1 X107.361 Y99.359 E5.30413
+G1 X107.389 Y100.000 E5.33498
+G1 X107.359 Y100.659 E5.36674
+G1 X107.253 Y101.410 E5.40319
+G1 X107.065 Y102.162 E5.44051
+G1 X106.845 Y102.782 E5.47213
+G1 X106.524 Y103.468 E5.50858
+G1 X106.124 Y104.134 E5.54592
+G1 X105.744 Y104.648 E5.57667
+G1 X105.224 Y105.224 E5.61399
+G1 X104.650 Y105.742 E5.65119
+G1 X104.022 Y106.198 E5.68851
+G1 X103.471 Y106.523 E5.71926
+G1 X102.768 Y106.851 E5.75659
+G1 X102.034 Y107.103 E5.79391
+G1 X101.412 Y107.252 E5.82466
+G1 X100.641 Y107.361 E5.86211
+G1 X100.000 Y107.389 E5.89296
+G1 X99.341 Y107.359 E5.92472
+G1 X98.590 Y107.253 E5.96117
+G1 X97.838 Y107.065 E5.99849
+G1 X97.218 Y106.845 E6.03011
+G1 X96.532 Y106.524 E6.06656
+G1 X95.866 Y106.124 E6.10390
+G1 X95.352 Y105.744 E6.13465
+G1 X94.776 Y105.224 E6.17197
+G1 X94.257 Y104.648 E6.20928
+G1 X93.866 Y104.119 E6.24090
+G1 X93.476 Y103.469 E6.27736
+G1 X93.149 Y102.768 E6.31457
+G1 X92.968 Y102.240 E6.34140
+G1 X92.584 Y102.309 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34990
+G1 X92.368 Y101.484 E6.38246
+G1 X92.266 Y100.795 E6.41593
+G1 X92.225 Y99.999 E6.45428
+G1 X92.255 Y99.323 E6.48681
+G1 X92.368 Y98.517 E6.52600
+G1 X92.565 Y97.726 E6.56518
+G1 X92.798 Y97.071 E6.59859
+G1 X93.135 Y96.350 E6.63689
+G1 X93.555 Y95.652 E6.67609
+G1 X93.957 Y95.108 E6.70861
+G1 X94.502 Y94.502 E6.74780
+G1 X95.108 Y93.957 E6.78698
+G1 X95.667 Y93.545 E6.82040
+G1 X96.350 Y93.135 E6.85870
+G1 X97.088 Y92.791 E6.89785
+G1 X97.858 Y92.526 E6.93703
+G1 X98.516 Y92.368 E6.96956
+G1 X99.323 Y92.255 E7.00879
+G1 X100.017 Y92.225 E7.04221
+G1 X100.813 Y92.268 E7.08051
+G1 X101.617 Y92.395 E7.11969
+G1 X102.290 Y92.570 E7.15311
+G1 X103.038 Y92.843 E7.19141
+G1 X103.770 Y93.201 E7.23060
+G1 X104.347 Y93.554 E7.26313
+G1 X104.998 Y94.045 E7.30237
+G1 X105.497 Y94.502 E7.33489
+G1 X106.042 Y95.107 E7.37408
+G1 X106.521 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44580
+G1 X107.209 Y97.088 E7.48498
+G1 X107.474 Y97.858 E7.52417
+G1 X107.632 Y98.516 E7.55670
+G1 X107.745 Y99.323 E7.59594
+G1 X107.775 Y100.000 E7.62850
+G1 X107.743 Y100.695 E7.66197
+G1 X107.632 Y101.483 E7.70027
+G1 X107.435 Y102.274 E7.73945
+G1 X107.202 Y102.929 E7.77287
+G1 X106.865 Y103.650 E7.81117
+G1 X106.445 Y104.348 E7.85036
+G1 X106.043 Y104.892 E7.88289
+G1 X105.498 Y105.498 E7.92208
+G1 X104.893 Y106.042 E7.96122
+G1 X104.234 Y106.521 E8.00041
+G1 X103.651 Y106.864 E8.03294
+G1 X102.912 Y107.209 E8.07212
+G1 X102.142 Y107.474 E8.11131
+G1 X101.484 Y107.632 E8.14384
+G1 X100.677 Y107.745 E8.18307
+G1 X100.000 Y107.775 E8.21564
+G1 X99.305 Y107.743 E8.24911
+G1 X98.517 Y107.632 E8.28741
+G1 X97.726 Y107.435 E8.32659
+G1 X97.071 Y107.202 E8.36001
+G1 X96.350 Y106.865 E8.39831
+G1 X95.652 Y106.445 E8.43750
+G1 X95.108 Y106.043 E8.47003
+G1 X94.502 Y105.498 E8.50922
+G1 X93.957 Y104.892 E8.54840
+G1 X93.545 Y104.333 E8.58181
+G1 X93.135 Y103.650 E8.62012
+G1 X92.791 Y102.912 E8.65926
+G1 X92.603 Y102.366 E8.68706
+G1 X92.697 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1814
+G1 X98.306 Y106.487 E9.02943
+G1 X98.720 Y106.590 E9.04993
+G1 X99.403 Y106.686 E9.08314
+G1 X100.001 Y106.713 E9.11190
+G1 X100.579 Y106.688 E9.13976
+G1 X101.286 Y106.589 E9.17409
+G1 X101.845 Y106.455 E9.20172
+G1 X102.515 Y106.224 E9.23578
+G1 X103.157 Y105.925 E9.26985
+G1 X103.652 Y105.633 E9.29748
+G1 X104.224 Y105.217 E9.33154
+G1 X104.747 Y104.747 E9.36534
+G1 X95.253 Y95.253 E10.01106
+G1 X95.779 Y94.780 E10.04508
+G1 X96.256 Y94.428 E10.07358
+G1 X96.848 Y94.073 E10.10679
+G1 X97.485 Y93.776 E10.14061
+G1 X98.155 Y93.545 E10.17468
+G1 X98.714 Y93.411 E10.20231
+G1 X99.420 Y93.312 E10.23660
+G1 X100.011 Y93.287 E10.26509
+G1 X100.701 Y93.324 E10.29830
+G1 X101.400 Y93.435 E10.33236
+G1 X101.690 Y93.510 E10.34677
+G1 X106.727 Y98.547 E10.68937
+G1 X106.779 Y101.178 F7800.000
+G1 F1814
+G1 X94.717 Y104.410 E11.29001
+G1 X93.221 Y98.822 F7800.000
+G1 F1814
+G1 X105.283 Y95.590 E11.89065
+G1 X104.624 Y105.090 F7800.000
+G1 F1814
+G1 X106.468 Y98.210 E12.23322
+G1 X106.224 Y97.485 E12.27001
+G1 X105.925 Y96.843 E12.30408
+G1 X105.633 Y96.349 E12.33171
+G1 X105.217 Y95.776 E12.36577
+G1 X104.743 Y95.249 E12.39984
+G1 X104.319 Y94.861 E12.42746
+G1 X103.749 Y94.431 E12.46180
+G1 X103.259 Y94.131 E12.48943
+G1 X102.622 Y93.821 E12.52352
+G1 X101.974 Y93.584 E12.55674
+G1 X101.736 Y93.522 E12.56856
+G1 X98.265 Y106.476 E13.21359
+G1 X98.033 Y106.418 E13.22509
+G1 X97.475 Y106.220 E13.25358
+G1 X96.849 Y105.927 E13.28679
+G1 X96.241 Y105.562 E13.32089
+G1 X95.780 Y105.221 E13.34852
+G1 X95.253 Y104.747 E13.38258
+G1 X94.780 Y104.221 E13.41661
+G1 X94.428 Y103.744 E13.44510
+G1 X94.073 Y103.152 E13.47831
+G1 X93.776 Y102.515 E13.51214
+G1 X93.545 Y101.845 E13.54620
+G1 X93.532 Y101.790 E13.54894
+G1 X95.376 Y94.910 E13.89151
+G1 E11.89151 F2400.00000
+G92 E0
+G1 X142.365 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1814
+G1 X158.546 Y100.996 E2.77830
+G1 X158.546 Y114.004 E3.40391
+G1 X142.365 Y114.004 E4.18221
+G1 X142.365 Y101.056 E4.80494
+G1 X141.979 Y100.611 F7800.000
+G1 F1814
+G1 X158.932 Y100.611 E5.62033
+G1 X158.932 Y114.389 E6.28304
+G1 X141.979 Y114.389 E7.09843
+G1 X141.979 Y100.671 E7.75826
+G1 X141.593 Y100.225 F7800.000
+G1 F1800
+G1 X159.318 Y100.225 E8.61074
+G1 X159.318 Y114.775 E9.31055
+G1 X141.593 Y114.775 E10.16303
+G1 X141.593 Y100.285 E10.85995
+G1 X141.983 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1814
+G1 X144.183 Y113.715 E11.48748
+G1 X150.171 Y113.715 E11.77550
+G1 X153.502 Y101.285 E12.39438
+G1 X158.257 Y101.285 E12.62311
+G1 X158.257 Y105.886 E12.84438
+G1 X156.113 Y113.888 E13.24284
+G1 X158.431 Y108.727 F7800.000
+G1 F1814
+G1 X142.480 Y113.001 E14.03707
+G1 X142.480 Y107.013 F7800.000
+G1 F1814
+G1 X158.431 Y102.739 E14.83130
+G1 X158.431 Y105.914 F7800.000
+G1 F1814
+G1 X153.802 Y101.285 E15.14614
+G1 X145.622 Y101.285 E15.53958
+G1 X158.051 Y113.715 E16.38499
+G1 X149.871 Y113.715 E16.77843
+G1 X142.480 Y106.324 E17.28113
+G1 Z2.450 F7800.000
+G1 E15.28113 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1811
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1811
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1811
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1811
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1811
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1811
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.304 Y102.048 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1811
+G1 X93.126 Y101.336 E2.03529
+G1 X93.024 Y100.606 E2.07075
+G1 X92.997 Y100.001 E2.09989
+G1 X93.026 Y99.374 E2.13006
+G1 X93.127 Y98.660 E2.16474
+G1 X93.267 Y98.074 E2.19373
+G1 X93.507 Y97.377 E2.22919
+G1 X93.819 Y96.709 E2.26462
+G1 X94.136 Y96.173 E2.29458
+G1 X94.558 Y95.594 E2.32906
+G1 X95.049 Y95.049 E2.36434
+G1 X95.596 Y94.556 E2.39976
+G1 X96.097 Y94.186 E2.42973
+G1 X96.712 Y93.817 E2.46420
+G1 X97.377 Y93.507 E2.49948
+G1 X98.074 Y93.267 E2.53494
+G1 X98.660 Y93.127 E2.56390
+G1 X99.393 Y93.024 E2.59954
+G1 X100.016 Y92.998 E2.62950
+G1 X100.731 Y93.036 E2.66397
+G1 X101.460 Y93.151 E2.69946
+G1 X102.043 Y93.302 E2.72843
+G1 X102.736 Y93.554 E2.76389
+G1 X103.399 Y93.877 E2.79935
+G1 X103.912 Y94.192 E2.82831
+G1 X104.505 Y94.638 E2.86399
+G1 X104.949 Y95.045 E2.89295
+G1 X105.445 Y95.596 E2.92862
+G1 X105.803 Y96.081 E2.95759
+G1 X106.185 Y96.716 E2.99322
+G1 X106.452 Y97.278 E3.02319
+G1 X106.696 Y97.952 E3.05766
+G1 X106.874 Y98.664 E3.09294
+G1 X106.976 Y99.394 E3.12840
+G1 X107.003 Y100.000 E3.15757
+G1 X106.976 Y100.606 E3.18675
+G1 X106.873 Y101.340 E3.22242
+G1 X106.733 Y101.926 E3.25138
+G1 X106.493 Y102.623 E3.28684
+G1 X106.181 Y103.291 E3.32227
+G1 X105.864 Y103.827 E3.35223
+G1 X105.442 Y104.406 E3.38670
+G1 X104.951 Y104.951 E3.42198
+G1 X104.404 Y105.445 E3.45745
+G1 X103.919 Y105.803 E3.48641
+G1 X103.284 Y106.185 E3.52204
+G1 X102.722 Y106.452 E3.55201
+G1 X102.048 Y106.696 E3.58648
+G1 X101.336 Y106.874 E3.62176
+G1 X100.606 Y106.976 E3.65722
+G1 X100.001 Y107.003 E3.68636
+G1 X99.374 Y106.974 E3.71653
+G1 X98.660 Y106.873 E3.75121
+G1 X98.074 Y106.733 E3.78021
+G1 X97.377 Y106.493 E3.81567
+G1 X96.709 Y106.181 E3.85109
+G1 X96.173 Y105.864 E3.88106
+G1 X95.594 Y105.442 E3.91553
+G1 X95.045 Y104.949 E3.95102
+G1 X94.638 Y104.505 E3.97998
+G1 X94.195 Y103.916 E4.01544
+G1 X93.815 Y103.284 E4.05087
+G1 X93.548 Y102.722 E4.08083
+G1 X93.324 Y102.104 E4.11241
+G1 X92.941 Y102.179 F7800.000
+G1 F1811
+G1 X92.747 Y101.410 E4.15059
+G1 X92.639 Y100.641 E4.18791
+G1 X92.611 Y100.000 E4.21876
+G1 X92.641 Y99.338 E4.25065
+G1 X92.747 Y98.588 E4.28710
+G1 X92.897 Y97.966 E4.31786
+G1 X93.149 Y97.232 E4.35519
+G1 X93.477 Y96.529 E4.39249
+G1 X93.813 Y95.961 E4.42424
+G1 X94.258 Y95.350 E4.46056
+G1 X94.776 Y94.776 E4.49778
+G1 X95.352 Y94.257 E4.53508
+G1 X95.883 Y93.865 E4.56684
+G1 X96.531 Y93.476 E4.60316
+G1 X97.232 Y93.149 E4.64037
+G1 X97.966 Y92.897 E4.67769
+G1 X98.588 Y92.748 E4.70844
+G1 X99.358 Y92.639 E4.74587
+G1 X100.018 Y92.611 E4.77763
+G1 X100.772 Y92.652 E4.81395
+G1 X101.539 Y92.773 E4.85129
+G1 X102.158 Y92.933 E4.88204
+G1 X102.887 Y93.199 E4.91936
+G1 X103.584 Y93.539 E4.95669
+G1 X104.129 Y93.873 E4.98743
+G1 X104.751 Y94.342 E5.02488
+G1 X105.223 Y94.774 E5.05563
+G1 X105.744 Y95.352 E5.09308
+G1 X106.124 Y95.866 E5.12383
+G1 X106.525 Y96.533 E5.16126
+G1 X106.808 Y97.130 E5.19302
+G1 X107.066 Y97.839 E5.22934
+G1 X107.253 Y98.590 E5.26655
+G1 X107.361 Y99.359 E5.30388
+G1 X107.389 Y100.000 E5.33475
+G1 X107.361 Y100.641 E5.36562
+G1 X107.252 Y101.412 E5.40308
+G1 X107.103 Y102.034 E5.43382
+G1 X106.851 Y102.768 E5.47115
+G1 X106.523 Y103.471 E5.50845
+G1 X106.187 Y104.039 E5.54021
+G1 X105.742 Y104.650 E5.57653
+G1 X105.224 Y105.224 E5.61374
+G1 X104.648 Y105.744 E5.65107
+G1 X104.134 Y106.124 E5.68181
+G1 X103.467 Y106.525 E5.71924
+G1 X102.870 Y106.808 E5.75100
+G1 X102.161 Y107.066 E5.78732
+G1 X101.410 Y107.253 E5.82453
+G1 X100.641 Y107.361 E5.86186
+G1 X100.000 Y107.389 E5.89271
+G1 X99.338 Y107.359 E5.92459
+G1 X98.588 Y107.253 E5.96104
+G1 X97.966 Y107.103 E5.99180
+G1 X97.232 Y106.851 E6.02913
+G1 X96.529 Y106.523 E6.06643
+G1 X95.961 Y106.187 E6.09819
+G1 X95.350 Y105.742 E6.13451
+G1 X94.774 Y105.223 E6.17185
+G1 X94.342 Y104.751 E6.20260
+G1 X93.875 Y104.132 E6.23992
+G1 X93.475 Y103.467 E6.27722
+G1 X93.192 Y102.870 E6.30898
+G1 X92.962 Y102.236 E6.34144
+G1 X92.579 Y102.311 F7800.000
+G1 F1800
+G1 X92.368 Y101.483 E6.38251
+G1 X92.255 Y100.677 E6.42170
+G1 X92.225 Y100.000 E6.45427
+G1 X92.257 Y99.302 E6.48786
+G1 X92.368 Y98.516 E6.52608
+G1 X92.526 Y97.858 E6.55861
+G1 X92.791 Y97.088 E6.59780
+G1 X93.136 Y96.349 E6.63698
+G1 X93.491 Y95.749 E6.67053
+G1 X93.958 Y95.107 E6.70870
+G1 X94.502 Y94.502 E6.74784
+G1 X95.108 Y93.957 E6.78702
+G1 X95.669 Y93.543 E6.82057
+G1 X96.350 Y93.135 E6.85874
+G1 X97.088 Y92.791 E6.89789
+G1 X97.858 Y92.526 E6.93707
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00883
+G1 X100.020 Y92.225 E7.04238
+G1 X100.813 Y92.268 E7.08055
+G1 X101.617 Y92.395 E7.11974
+G1 X102.272 Y92.565 E7.15227
+G1 X103.038 Y92.843 E7.19146
+G1 X103.770 Y93.201 E7.23064
+G1 X104.347 Y93.554 E7.26317
+G1 X104.998 Y94.045 E7.30241
+G1 X105.497 Y94.502 E7.33493
+G1 X106.043 Y95.108 E7.37417
+G1 X106.445 Y95.652 E7.40670
+G1 X106.865 Y96.351 E7.44592
+G1 X107.164 Y96.981 E7.47947
+G1 X107.435 Y97.727 E7.51764
+G1 X107.632 Y98.517 E7.55679
+G1 X107.745 Y99.323 E7.59598
+G1 X107.775 Y100.000 E7.62855
+G1 X107.745 Y100.677 E7.66113
+G1 X107.632 Y101.484 E7.70036
+G1 X107.474 Y102.142 E7.73289
+G1 X107.209 Y102.912 E7.77208
+G1 X106.864 Y103.651 E7.81126
+G1 X106.509 Y104.251 E7.84481
+G1 X106.042 Y104.893 E7.88297
+G1 X105.498 Y105.498 E7.92212
+G1 X104.892 Y106.043 E7.96131
+G1 X104.348 Y106.445 E7.99384
+G1 X103.649 Y106.865 E8.03306
+G1 X103.019 Y107.164 E8.06661
+G1 X102.273 Y107.435 E8.10478
+G1 X101.483 Y107.632 E8.14393
+G1 X100.677 Y107.745 E8.18311
+G1 X100.000 Y107.775 E8.21568
+G1 X99.302 Y107.743 E8.24928
+G1 X98.516 Y107.632 E8.28749
+G1 X97.858 Y107.474 E8.32003
+G1 X97.088 Y107.209 E8.35921
+G1 X96.349 Y106.864 E8.39839
+G1 X95.749 Y106.509 E8.43194
+G1 X95.107 Y106.042 E8.47011
+G1 X94.502 Y105.497 E8.50930
+G1 X94.045 Y104.998 E8.54183
+G1 X93.554 Y104.348 E8.58102
+G1 X93.135 Y103.649 E8.62020
+G1 X92.836 Y103.019 E8.65375
+G1 X92.599 Y102.367 E8.68710
+G1 X92.851 Y102.018 F7800.000
+G1 X93.275 Y101.455
+G1 F1811
+G1 X98.312 Y106.492 E9.02970
+G1 X98.714 Y106.589 E9.04960
+G1 X99.401 Y106.686 E9.08295
+G1 X100.001 Y106.713 E9.11184
+G1 X100.579 Y106.688 E9.13969
+G1 X101.281 Y106.589 E9.17376
+G1 X101.963 Y106.419 E9.20759
+G1 X102.610 Y106.185 E9.24067
+G1 X103.148 Y105.929 E9.26929
+G1 X103.759 Y105.562 E9.30358
+G1 X104.220 Y105.221 E9.33121
+G1 X104.747 Y104.747 E9.36527
+G1 X95.253 Y95.253 E10.01100
+G1 X95.779 Y94.780 E10.04501
+G1 X96.258 Y94.427 E10.07363
+G1 X96.848 Y94.073 E10.10672
+G1 X97.485 Y93.776 E10.14055
+G1 X98.155 Y93.545 E10.17461
+G1 X98.714 Y93.411 E10.20224
+G1 X99.420 Y93.312 E10.23653
+G1 X100.014 Y93.287 E10.26515
+G1 X100.701 Y93.324 E10.29823
+G1 X101.401 Y93.435 E10.33233
+G1 X101.690 Y93.509 E10.34666
+G1 X106.725 Y98.545 E10.68915
+G1 X106.779 Y101.178 F7800.000
+G1 F1811
+G1 X94.713 Y104.411 E11.28998
+G1 X93.221 Y98.822 F7800.000
+G1 F1811
+G1 X105.283 Y95.590 E11.89063
+G1 X104.624 Y105.090 F7800.000
+G1 F1811
+G1 X106.465 Y98.221 E12.23269
+G1 X106.419 Y98.037 E12.24180
+G1 X106.185 Y97.390 E12.27489
+G1 X105.929 Y96.852 E12.30351
+G1 X105.562 Y96.241 E12.33780
+G1 X105.221 Y95.780 E12.36543
+G1 X104.743 Y95.249 E12.39976
+G1 X104.319 Y94.861 E12.42739
+G1 X103.749 Y94.431 E12.46172
+G1 X103.259 Y94.131 E12.48935
+G1 X102.623 Y93.821 E12.52342
+G1 X101.957 Y93.579 E12.55748
+G1 X101.736 Y93.521 E12.56848
+G1 X98.264 Y106.481 E13.21377
+G1 X97.485 Y106.224 E13.25318
+G1 X96.844 Y105.925 E13.28719
+G1 X96.332 Y105.622 E13.31581
+G1 X95.776 Y105.217 E13.34890
+G1 X95.249 Y104.743 E13.38300
+G1 X94.861 Y104.319 E13.41063
+G1 X94.435 Y103.754 E13.44469
+G1 X94.071 Y103.148 E13.47871
+G1 X93.815 Y102.610 E13.50733
+G1 X93.581 Y101.963 E13.54041
+G1 X93.535 Y101.779 E13.54953
+G1 X95.376 Y94.910 E13.89159
+G1 E11.89159 F2400.00000
+G92 E0
+G1 X142.570 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1811
+G1 X158.752 Y100.996 E2.77830
+G1 X158.752 Y114.004 E3.40391
+G1 X142.570 Y114.004 E4.18221
+G1 X142.570 Y101.056 E4.80494
+G1 X142.184 Y100.611 F7800.000
+G1 F1811
+G1 X159.137 Y100.611 E5.62033
+G1 X159.137 Y114.389 E6.28304
+G1 X142.184 Y114.389 E7.09843
+G1 X142.184 Y100.671 E7.75826
+G1 X141.799 Y100.225 F7800.000
+G1 F1800
+G1 X159.523 Y100.225 E8.61074
+G1 X159.523 Y114.775 E9.31055
+G1 X141.799 Y114.775 E10.16303
+G1 X141.799 Y100.285 E10.85995
+G1 X142.188 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1811
+G1 X144.183 Y113.715 E11.48748
+G1 X150.171 Y113.715 E11.77550
+G1 X153.502 Y101.285 E12.39438
+G1 X158.462 Y101.285 E12.63299
+G1 X158.462 Y105.120 E12.81742
+G1 X156.113 Y113.888 E13.25401
+G1 X158.636 Y108.672 F7800.000
+G1 F1811
+G1 X142.685 Y112.946 E14.04824
+G1 X142.685 Y106.958 F7800.000
+G1 F1811
+G1 X158.636 Y102.684 E14.84247
+G1 X158.636 Y106.119 F7800.000
+G1 F1811
+G1 X153.802 Y101.285 E15.17127
+G1 X145.622 Y101.285 E15.56471
+G1 X158.051 Y113.715 E16.41012
+G1 X149.871 Y113.715 E16.80356
+G1 X142.685 Y106.529 E17.29230
+G1 Z2.750 F7800.000
+G1 E15.29230 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1812
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1812
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1812
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1812
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1812
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1812
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.058 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1812
+G1 X93.127 Y101.340 E2.03566
+G1 X93.024 Y100.606 E2.07133
+G1 X92.997 Y100.000 E2.10051
+G1 X93.024 Y99.394 E2.12968
+G1 X93.127 Y98.660 E2.16535
+G1 X93.267 Y98.074 E2.19432
+G1 X93.507 Y97.377 E2.22978
+G1 X93.819 Y96.709 E2.26520
+G1 X94.137 Y96.171 E2.29529
+G1 X94.558 Y95.594 E2.32964
+G1 X95.049 Y95.049 E2.36492
+G1 X95.596 Y94.556 E2.40034
+G1 X96.099 Y94.184 E2.43043
+G1 X96.712 Y93.818 E2.46478
+G1 X97.377 Y93.507 E2.50006
+G1 X98.074 Y93.267 E2.53552
+G1 X98.660 Y93.127 E2.56449
+G1 X99.393 Y93.024 E2.60012
+G1 X100.018 Y92.998 E2.63021
+G1 X100.731 Y93.036 E2.66455
+G1 X101.460 Y93.151 E2.70005
+G1 X102.043 Y93.302 E2.72901
+G1 X102.739 Y93.555 E2.76464
+G1 X103.304 Y93.826 E2.79473
+G1 X103.918 Y94.196 E2.82924
+G1 X104.421 Y94.570 E2.85937
+G1 X104.951 Y95.048 E2.89371
+G1 X105.445 Y95.596 E2.92920
+G1 X105.803 Y96.081 E2.95817
+G1 X106.185 Y96.716 E2.99380
+G1 X106.453 Y97.281 E3.02389
+G1 X106.696 Y97.952 E3.05823
+G1 X106.874 Y98.664 E3.09352
+G1 X106.976 Y99.394 E3.12898
+G1 X107.003 Y100.000 E3.15815
+G1 X106.976 Y100.606 E3.18733
+G1 X106.873 Y101.340 E3.22300
+G1 X106.733 Y101.926 E3.25196
+G1 X106.493 Y102.623 E3.28743
+G1 X106.181 Y103.291 E3.32289
+G1 X105.875 Y103.810 E3.35185
+G1 X105.442 Y104.407 E3.38731
+G1 X104.951 Y104.951 E3.42257
+G1 X104.404 Y105.445 E3.45803
+G1 X103.919 Y105.803 E3.48699
+G1 X103.284 Y106.185 E3.52262
+G1 X102.719 Y106.453 E3.55272
+G1 X102.048 Y106.696 E3.58706
+G1 X101.336 Y106.874 E3.62234
+G1 X100.606 Y106.976 E3.65781
+G1 X100.000 Y107.003 E3.68698
+G1 X99.394 Y106.976 E3.71615
+G1 X98.660 Y106.873 E3.75182
+G1 X98.074 Y106.733 E3.78079
+G1 X97.377 Y106.493 E3.81625
+G1 X96.709 Y106.181 E3.85167
+G1 X96.171 Y105.863 E3.88177
+G1 X95.594 Y105.442 E3.91611
+G1 X95.049 Y104.951 E3.95139
+G1 X94.558 Y104.407 E3.98664
+G1 X94.125 Y103.811 E4.02206
+G1 X93.809 Y103.271 E4.05216
+G1 X93.508 Y102.624 E4.08650
+G1 X93.332 Y102.115 E4.11239
+G1 X92.948 Y102.184 F7800.000
+G1 F1812
+G1 X92.748 Y101.412 E4.15072
+G1 X92.639 Y100.641 E4.18817
+G1 X92.611 Y100.000 E4.21904
+G1 X92.639 Y99.359 E4.24992
+G1 X92.748 Y98.588 E4.28737
+G1 X92.897 Y97.966 E4.31812
+G1 X93.149 Y97.232 E4.35544
+G1 X93.477 Y96.529 E4.39274
+G1 X93.815 Y95.959 E4.42463
+G1 X94.258 Y95.351 E4.46082
+G1 X94.776 Y94.776 E4.49803
+G1 X95.352 Y94.257 E4.53533
+G1 X95.885 Y93.863 E4.56722
+G1 X96.531 Y93.476 E4.60341
+G1 X97.232 Y93.149 E4.64063
+G1 X97.966 Y92.897 E4.67795
+G1 X98.588 Y92.748 E4.70870
+G1 X99.358 Y92.639 E4.74613
+G1 X100.021 Y92.612 E4.77801
+G1 X100.772 Y92.652 E4.81420
+G1 X101.539 Y92.773 E4.85155
+G1 X102.158 Y92.933 E4.88229
+G1 X102.889 Y93.200 E4.91972
+G1 X103.487 Y93.486 E4.95161
+G1 X104.133 Y93.875 E4.98790
+G1 X104.666 Y94.271 E5.01981
+G1 X105.224 Y94.775 E5.05600
+G1 X105.744 Y95.352 E5.09334
+G1 X106.124 Y95.866 E5.12409
+G1 X106.525 Y96.533 E5.16151
+G1 X106.809 Y97.132 E5.19340
+G1 X107.066 Y97.839 E5.22959
+G1 X107.253 Y98.590 E5.26681
+G1 X107.361 Y99.359 E5.30413
+G1 X107.389 Y100.000 E5.33501
+G1 X107.361 Y100.641 E5.36588
+G1 X107.252 Y101.412 E5.40333
+G1 X107.103 Y102.034 E5.43408
+G1 X106.851 Y102.768 E5.47140
+G1 X106.523 Y103.471 E5.50873
+G1 X106.198 Y104.022 E5.53947
+G1 X105.742 Y104.650 E5.57680
+G1 X105.224 Y105.224 E5.61400
+G1 X104.648 Y105.744 E5.65132
+G1 X104.134 Y106.124 E5.68207
+G1 X103.467 Y106.525 E5.71950
+G1 X102.868 Y106.809 E5.75138
+G1 X102.161 Y107.066 E5.78757
+G1 X101.410 Y107.253 E5.82479
+G1 X100.641 Y107.361 E5.86211
+G1 X100.000 Y107.389 E5.89299
+G1 X99.359 Y107.361 E5.92386
+G1 X98.588 Y107.252 E5.96131
+G1 X97.966 Y107.103 E5.99206
+G1 X97.232 Y106.851 E6.02939
+G1 X96.529 Y106.523 E6.06668
+G1 X95.959 Y106.185 E6.09857
+G1 X95.351 Y105.742 E6.13476
+G1 X94.776 Y105.224 E6.17198
+G1 X94.258 Y104.650 E6.20917
+G1 X93.802 Y104.022 E6.24647
+G1 X93.467 Y103.450 E6.27836
+G1 X93.150 Y102.768 E6.31455
+G1 X92.968 Y102.240 E6.34140
+G1 X92.584 Y102.309 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34990
+G1 X92.368 Y101.484 E6.38243
+G1 X92.255 Y100.677 E6.42166
+G1 X92.225 Y100.000 E6.45424
+G1 X92.255 Y99.323 E6.48681
+G1 X92.368 Y98.516 E6.52605
+G1 X92.526 Y97.858 E6.55858
+G1 X92.791 Y97.088 E6.59776
+G1 X93.136 Y96.349 E6.63694
+G1 X93.492 Y95.746 E6.67062
+G1 X93.958 Y95.107 E6.70866
+G1 X94.502 Y94.502 E6.74781
+G1 X95.108 Y93.957 E6.78699
+G1 X95.671 Y93.542 E6.82067
+G1 X96.350 Y93.135 E6.85870
+G1 X97.088 Y92.791 E6.89785
+G1 X97.858 Y92.526 E6.93704
+G1 X98.516 Y92.368 E6.96957
+G1 X99.323 Y92.255 E7.00879
+G1 X100.023 Y92.225 E7.04247
+G1 X100.813 Y92.268 E7.08051
+G1 X101.617 Y92.395 E7.11970
+G1 X102.272 Y92.565 E7.15223
+G1 X103.039 Y92.844 E7.19146
+G1 X103.670 Y93.146 E7.22514
+G1 X104.348 Y93.555 E7.26321
+G1 X104.910 Y93.972 E7.29690
+G1 X105.497 Y94.502 E7.33494
+G1 X106.043 Y95.108 E7.37413
+G1 X106.445 Y95.652 E7.40666
+G1 X106.865 Y96.351 E7.44589
+G1 X107.165 Y96.983 E7.47957
+G1 X107.435 Y97.727 E7.51760
+G1 X107.632 Y98.517 E7.55675
+G1 X107.745 Y99.323 E7.59594
+G1 X107.775 Y100.000 E7.62851
+G1 X107.745 Y100.677 E7.66109
+G1 X107.632 Y101.484 E7.70032
+G1 X107.474 Y102.142 E7.73285
+G1 X107.209 Y102.912 E7.77204
+G1 X106.864 Y103.651 E7.81123
+G1 X106.521 Y104.234 E7.84375
+G1 X106.042 Y104.893 E7.88294
+G1 X105.498 Y105.498 E7.92208
+G1 X104.892 Y106.043 E7.96127
+G1 X104.348 Y106.445 E7.99380
+G1 X103.649 Y106.865 E8.03302
+G1 X103.017 Y107.165 E8.06671
+G1 X102.273 Y107.435 E8.10474
+G1 X101.483 Y107.632 E8.14389
+G1 X100.677 Y107.745 E8.18308
+G1 X100.000 Y107.775 E8.21565
+G1 X99.323 Y107.745 E8.24823
+G1 X98.516 Y107.632 E8.28746
+G1 X97.858 Y107.474 E8.31999
+G1 X97.088 Y107.209 E8.35918
+G1 X96.349 Y106.864 E8.39836
+G1 X95.746 Y106.508 E8.43204
+G1 X95.107 Y106.042 E8.47007
+G1 X94.502 Y105.498 E8.50922
+G1 X93.958 Y104.893 E8.54836
+G1 X93.479 Y104.234 E8.58754
+G1 X93.125 Y103.630 E8.62122
+G1 X92.791 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68706
+G1 X92.697 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1812
+G1 X98.312 Y106.492 E9.02982
+G1 X98.714 Y106.589 E9.04968
+G1 X99.421 Y106.688 E9.08402
+G1 X100.000 Y106.713 E9.11192
+G1 X100.579 Y106.688 E9.13981
+G1 X101.281 Y106.589 E9.17388
+G1 X101.963 Y106.419 E9.20771
+G1 X102.608 Y106.186 E9.24067
+G1 X103.148 Y105.929 E9.26942
+G1 X103.759 Y105.562 E9.30370
+G1 X104.220 Y105.221 E9.33133
+G1 X104.747 Y104.747 E9.36539
+G1 X95.253 Y95.253 E10.01112
+G1 X95.779 Y94.780 E10.04513
+G1 X96.260 Y94.425 E10.07388
+G1 X96.848 Y94.073 E10.10684
+G1 X97.485 Y93.776 E10.14067
+G1 X98.155 Y93.545 E10.17474
+G1 X98.714 Y93.411 E10.20236
+G1 X99.419 Y93.312 E10.23665
+G1 X100.017 Y93.287 E10.26540
+G1 X100.701 Y93.324 E10.29835
+G1 X101.401 Y93.435 E10.33246
+G1 X101.690 Y93.509 E10.34678
+G1 X106.725 Y98.545 E10.68927
+G1 X106.779 Y101.178 F7800.000
+G1 F1812
+G1 X94.717 Y104.410 E11.28991
+G1 X93.221 Y98.822 F7800.000
+G1 F1812
+G1 X105.283 Y95.590 E11.89055
+G1 X104.624 Y105.090 F7800.000
+G1 F1812
+G1 X106.465 Y98.221 E12.23261
+G1 X106.419 Y98.037 E12.24173
+G1 X106.186 Y97.392 E12.27469
+G1 X105.929 Y96.852 E12.30344
+G1 X105.562 Y96.241 E12.33772
+G1 X105.221 Y95.780 E12.36535
+G1 X104.746 Y95.253 E12.39945
+G1 X104.237 Y94.794 E12.43241
+G1 X103.757 Y94.437 E12.46120
+G1 X103.166 Y94.081 E12.49437
+G1 X102.627 Y93.822 E12.52312
+G1 X101.957 Y93.579 E12.55740
+G1 X101.736 Y93.521 E12.56840
+G1 X98.264 Y106.481 E13.21369
+G1 X97.485 Y106.224 E13.25310
+G1 X96.844 Y105.925 E13.28711
+G1 X96.330 Y105.621 E13.31586
+G1 X95.776 Y105.217 E13.34881
+G1 X95.253 Y104.747 E13.38265
+G1 X94.783 Y104.224 E13.41644
+G1 X94.368 Y103.652 E13.45045
+G1 X94.065 Y103.137 E13.47920
+G1 X93.776 Y102.515 E13.51216
+G1 X93.545 Y101.845 E13.54626
+G1 X93.532 Y101.790 E13.54900
+G1 X95.376 Y94.910 E13.89157
+G1 E11.89157 F2400.00000
+G92 E0
+G1 X142.775 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1812
+G1 X158.957 Y100.996 E2.77830
+G1 X158.957 Y114.004 E3.40391
+G1 X142.775 Y114.004 E4.18221
+G1 X142.775 Y101.056 E4.80494
+G1 X142.389 Y100.611 F7800.000
+G1 F1812
+G1 X159.343 Y100.611 E5.62033
+G1 X159.343 Y114.389 E6.28304
+G1 X142.389 Y114.389 E7.09843
+G1 X142.389 Y100.671 E7.75826
+G1 X142.004 Y100.225 F7800.000
+G1 F1800
+G1 X159.728 Y100.225 E8.61074
+G1 X159.728 Y114.775 E9.31055
+G1 X142.004 Y114.775 E10.16303
+G1 X142.004 Y100.285 E10.85995
+G1 X142.393 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1812
+G1 X144.183 Y113.715 E11.48748
+G1 X150.171 Y113.715 E11.77550
+G1 X153.502 Y101.285 E12.39438
+G1 X158.668 Y101.285 E12.64286
+G1 X158.668 Y104.354 E12.79045
+G1 X156.113 Y113.888 E13.26518
+G1 X158.841 Y108.617 F7800.000
+G1 F1812
+G1 X142.891 Y112.891 E14.05941
+G1 X142.891 Y106.903 F7800.000
+G1 F1812
+G1 X158.841 Y102.629 E14.85364
+G1 X158.841 Y106.325 F7800.000
+G1 F1812
+G1 X153.802 Y101.285 E15.19640
+G1 X145.622 Y101.285 E15.58984
+G1 X158.051 Y113.715 E16.43526
+G1 X149.871 Y113.715 E16.82870
+G1 X142.891 Y106.734 E17.30348
+G1 Z3.050 F7800.000
+G1 E15.30348 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1813
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1813
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1813
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1813
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1813
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.058 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X93.126 Y101.337 E2.03582
+G1 X93.034 Y100.711 E2.06626
+G1 X92.997 Y99.996 E2.10068
+G1 X93.024 Y99.394 E2.12968
+G1 X93.126 Y98.664 E2.16514
+G1 X93.304 Y97.949 E2.20056
+G1 X93.515 Y97.357 E2.23078
+G1 X93.817 Y96.713 E2.26500
+G1 X94.197 Y96.081 E2.30049
+G1 X94.555 Y95.596 E2.32946
+G1 X95.051 Y95.046 E2.36508
+G1 X95.515 Y94.622 E2.39531
+G1 X96.084 Y94.195 E2.42952
+G1 X96.713 Y93.817 E2.46481
+G1 X97.377 Y93.507 E2.50006
+G1 X98.074 Y93.267 E2.53552
+G1 X98.660 Y93.127 E2.56449
+G1 X99.393 Y93.024 E2.60011
+G1 X100.021 Y92.998 E2.63034
+G1 X100.731 Y93.036 E2.66455
+G1 X101.459 Y93.151 E2.70000
+G1 X102.067 Y93.310 E2.73022
+G1 X102.735 Y93.554 E2.76444
+G1 X103.399 Y93.877 E2.79993
+G1 X103.912 Y94.192 E2.82890
+G1 X104.505 Y94.638 E2.86457
+G1 X104.949 Y95.045 E2.89353
+G1 X105.442 Y95.593 E2.92899
+G1 X105.875 Y96.190 E2.96446
+G1 X106.181 Y96.709 E2.99342
+G1 X106.493 Y97.377 E3.02888
+G1 X106.733 Y98.074 E3.06435
+G1 X106.873 Y98.660 E3.09331
+G1 X106.976 Y99.394 E3.12898
+G1 X107.003 Y99.999 E3.15811
+G1 X106.974 Y100.631 E3.18854
+G1 X106.874 Y101.335 E3.22276
+G1 X106.696 Y102.051 E3.25821
+G1 X106.485 Y102.643 E3.28843
+G1 X106.183 Y103.287 E3.32264
+G1 X105.803 Y103.919 E3.35814
+G1 X105.445 Y104.404 E3.38710
+G1 X104.951 Y104.951 E3.42257
+G1 X104.407 Y105.442 E3.45782
+G1 X103.810 Y105.875 E3.49328
+G1 X103.291 Y106.181 E3.52225
+G1 X102.620 Y106.494 E3.55787
+G1 X102.027 Y106.703 E3.58810
+G1 X101.337 Y106.874 E3.62231
+G1 X100.606 Y106.976 E3.65780
+G1 X100.001 Y107.003 E3.68693
+G1 X99.369 Y106.974 E3.71737
+G1 X98.665 Y106.874 E3.75158
+G1 X97.949 Y106.696 E3.78703
+G1 X97.357 Y106.485 E3.81725
+G1 X96.713 Y106.183 E3.85147
+G1 X96.081 Y105.803 E3.88696
+G1 X95.596 Y105.445 E3.91593
+G1 X95.049 Y104.951 E3.95139
+G1 X94.558 Y104.407 E3.98664
+G1 X94.125 Y103.811 E4.02206
+G1 X93.807 Y103.269 E4.05228
+G1 X93.508 Y102.624 E4.08650
+G1 X93.332 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1813
+G1 X92.747 Y101.410 E4.15082
+G1 X92.650 Y100.749 E4.18296
+G1 X92.611 Y99.998 E4.21915
+G1 X92.639 Y99.359 E4.24992
+G1 X92.747 Y98.590 E4.28724
+G1 X92.935 Y97.838 E4.32454
+G1 X93.158 Y97.211 E4.35656
+G1 X93.476 Y96.532 E4.39262
+G1 X93.876 Y95.866 E4.42996
+G1 X94.256 Y95.352 E4.46071
+G1 X94.777 Y94.774 E4.49813
+G1 X95.269 Y94.325 E4.53015
+G1 X95.868 Y93.875 E4.56621
+G1 X96.531 Y93.476 E4.60343
+G1 X97.232 Y93.149 E4.64063
+G1 X97.966 Y92.897 E4.67795
+G1 X98.588 Y92.748 E4.70870
+G1 X99.358 Y92.639 E4.74612
+G1 X100.023 Y92.612 E4.77814
+G1 X100.772 Y92.652 E4.81420
+G1 X101.538 Y92.773 E4.85152
+G1 X102.182 Y92.941 E4.88354
+G1 X102.887 Y93.199 E4.91959
+G1 X103.584 Y93.539 E4.95694
+G1 X104.129 Y93.873 E4.98769
+G1 X104.751 Y94.342 E5.02514
+G1 X105.223 Y94.774 E5.05589
+G1 X105.742 Y95.350 E5.09321
+G1 X106.198 Y95.978 E5.13054
+G1 X106.523 Y96.529 E5.16128
+G1 X106.851 Y97.232 E5.19861
+G1 X107.103 Y97.966 E5.23593
+G1 X107.252 Y98.588 E5.26668
+G1 X107.361 Y99.359 E5.30413
+G1 X107.389 Y99.999 E5.33498
+G1 X107.358 Y100.667 E5.36713
+G1 X107.253 Y101.409 E5.40318
+G1 X107.065 Y102.162 E5.44050
+G1 X106.842 Y102.789 E5.47252
+G1 X106.524 Y103.468 E5.50858
+G1 X106.124 Y104.134 E5.54592
+G1 X105.744 Y104.648 E5.57667
+G1 X105.224 Y105.224 E5.61399
+G1 X104.650 Y105.742 E5.65119
+G1 X104.022 Y106.198 E5.68852
+G1 X103.471 Y106.523 E5.71926
+G1 X102.766 Y106.851 E5.75669
+G1 X102.138 Y107.072 E5.78871
+G1 X101.410 Y107.253 E5.82476
+G1 X100.641 Y107.361 E5.86211
+G1 X100.001 Y107.389 E5.89296
+G1 X99.333 Y107.358 E5.92511
+G1 X98.591 Y107.253 E5.96116
+G1 X97.838 Y107.065 E5.99848
+G1 X97.211 Y106.842 E6.03050
+G1 X96.532 Y106.524 E6.06656
+G1 X95.866 Y106.124 E6.10390
+G1 X95.352 Y105.744 E6.13465
+G1 X94.776 Y105.224 E6.17198
+G1 X94.258 Y104.650 E6.20917
+G1 X93.802 Y104.022 E6.24647
+G1 X93.465 Y103.448 E6.27849
+G1 X93.150 Y102.768 E6.31455
+G1 X92.968 Y102.240 E6.34139
+G1 X92.584 Y102.309 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34990
+G1 X92.368 Y101.484 E6.38246
+G1 X92.265 Y100.787 E6.41633
+G1 X92.225 Y99.999 E6.45427
+G1 X92.255 Y99.323 E6.48681
+G1 X92.368 Y98.517 E6.52600
+G1 X92.565 Y97.726 E6.56518
+G1 X92.801 Y97.064 E6.59899
+G1 X93.135 Y96.350 E6.63689
+G1 X93.555 Y95.652 E6.67609
+G1 X93.957 Y95.108 E6.70862
+G1 X94.503 Y94.502 E6.74784
+G1 X95.022 Y94.028 E6.78166
+G1 X95.652 Y93.555 E6.81956
+G1 X96.350 Y93.135 E6.85871
+G1 X97.088 Y92.791 E6.89785
+G1 X97.858 Y92.526 E6.93704
+G1 X98.516 Y92.368 E6.96956
+G1 X99.323 Y92.255 E7.00879
+G1 X100.026 Y92.225 E7.04260
+G1 X100.813 Y92.268 E7.08051
+G1 X101.617 Y92.395 E7.11969
+G1 X102.298 Y92.573 E7.15351
+G1 X103.038 Y92.843 E7.19141
+G1 X103.770 Y93.201 E7.23060
+G1 X104.347 Y93.554 E7.26313
+G1 X104.998 Y94.045 E7.30237
+G1 X105.497 Y94.502 E7.33489
+G1 X106.042 Y95.107 E7.37408
+G1 X106.521 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44580
+G1 X107.209 Y97.088 E7.48499
+G1 X107.474 Y97.858 E7.52417
+G1 X107.632 Y98.516 E7.55670
+G1 X107.745 Y99.323 E7.59594
+G1 X107.775 Y100.000 E7.62850
+G1 X107.743 Y100.703 E7.66236
+G1 X107.632 Y101.483 E7.70027
+G1 X107.435 Y102.274 E7.73945
+G1 X107.199 Y102.936 E7.77327
+G1 X106.865 Y103.650 E7.81117
+G1 X106.445 Y104.348 E7.85036
+G1 X106.043 Y104.892 E7.88289
+G1 X105.498 Y105.498 E7.92208
+G1 X104.893 Y106.042 E7.96122
+G1 X104.234 Y106.521 E8.00041
+G1 X103.651 Y106.864 E8.03294
+G1 X102.912 Y107.209 E8.07216
+G1 X102.249 Y107.442 E8.10598
+G1 X101.484 Y107.632 E8.14388
+G1 X100.677 Y107.745 E8.18307
+G1 X100.000 Y107.775 E8.21564
+G1 X99.297 Y107.743 E8.24950
+G1 X98.517 Y107.632 E8.28740
+G1 X97.726 Y107.435 E8.32659
+G1 X97.064 Y107.199 E8.36040
+G1 X96.350 Y106.865 E8.39831
+G1 X95.652 Y106.445 E8.43750
+G1 X95.108 Y106.043 E8.47003
+G1 X94.502 Y105.498 E8.50922
+G1 X93.958 Y104.893 E8.54836
+G1 X93.479 Y104.234 E8.58754
+G1 X93.123 Y103.627 E8.62135
+G1 X92.791 Y102.913 E8.65925
+G1 X92.603 Y102.366 E8.68706
+G1 X92.697 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1813
+G1 X98.306 Y106.487 E9.02943
+G1 X98.720 Y106.590 E9.04994
+G1 X99.396 Y106.686 E9.08276
+G1 X100.001 Y106.713 E9.11191
+G1 X100.579 Y106.688 E9.13975
+G1 X101.282 Y106.589 E9.17386
+G1 X101.944 Y106.425 E9.20669
+G1 X102.511 Y106.226 E9.23557
+G1 X103.157 Y105.925 E9.26984
+G1 X103.652 Y105.633 E9.29747
+G1 X104.224 Y105.217 E9.33154
+G1 X104.747 Y104.747 E9.36533
+G1 X95.253 Y95.253 E10.01106
+G1 X95.700 Y94.845 E10.04015
+G1 X96.245 Y94.435 E10.07297
+G1 X96.849 Y94.073 E10.10681
+G1 X97.485 Y93.776 E10.14061
+G1 X98.155 Y93.545 E10.17467
+G1 X98.714 Y93.411 E10.20230
+G1 X99.419 Y93.312 E10.23658
+G1 X100.019 Y93.287 E10.26546
+G1 X100.701 Y93.324 E10.29828
+G1 X101.400 Y93.435 E10.33233
+G1 X101.691 Y93.510 E10.34678
+G1 X106.727 Y98.547 E10.68936
+G1 X106.779 Y101.178 F7800.000
+G1 F1813
+G1 X94.717 Y104.410 E11.29001
+G1 X93.221 Y98.822 F7800.000
+G1 F1813
+G1 X105.283 Y95.590 E11.89065
+G1 X104.624 Y105.090 F7800.000
+G1 F1813
+G1 X106.468 Y98.210 E12.23322
+G1 X106.455 Y98.155 E12.23596
+G1 X106.224 Y97.485 E12.27002
+G1 X105.925 Y96.843 E12.30409
+G1 X105.633 Y96.349 E12.33171
+G1 X105.217 Y95.776 E12.36578
+G1 X104.743 Y95.249 E12.39984
+G1 X104.319 Y94.861 E12.42747
+G1 X103.749 Y94.431 E12.46181
+G1 X103.259 Y94.131 E12.48944
+G1 X102.622 Y93.820 E12.52355
+G1 X101.981 Y93.586 E12.55637
+G1 X101.736 Y93.522 E12.56856
+G1 X98.265 Y106.476 E13.21359
+G1 X98.033 Y106.418 E13.22507
+G1 X97.468 Y106.217 E13.25395
+G1 X96.849 Y105.928 E13.28678
+G1 X96.241 Y105.562 E13.32089
+G1 X95.780 Y105.221 E13.34851
+G1 X95.253 Y104.747 E13.38258
+G1 X94.783 Y104.224 E13.41637
+G1 X94.368 Y103.653 E13.45038
+G1 X94.064 Y103.135 E13.47926
+G1 X93.776 Y102.516 E13.51209
+G1 X93.532 Y101.790 E13.54892
+G1 X95.377 Y94.905 E13.89173
+G1 E11.89173 F2400.00000
+G92 E0
+G1 X142.980 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X159.162 Y100.996 E2.77830
+G1 X159.162 Y114.004 E3.40391
+G1 X142.980 Y114.004 E4.18221
+G1 X142.980 Y101.056 E4.80494
+G1 X142.595 Y100.611 F7800.000
+G1 F1813
+G1 X159.548 Y100.611 E5.62033
+G1 X159.548 Y114.389 E6.28304
+G1 X142.595 Y114.389 E7.09843
+G1 X142.595 Y100.671 E7.75826
+G1 X142.209 Y100.225 F7800.000
+G1 F1800
+G1 X159.933 Y100.225 E8.61074
+G1 X159.933 Y114.775 E9.31055
+G1 X142.209 Y114.775 E10.16303
+G1 X142.209 Y100.285 E10.85995
+G1 X142.599 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1813
+G1 X144.183 Y113.715 E11.48748
+G1 X150.171 Y113.715 E11.77550
+G1 X153.502 Y101.285 E12.39439
+G1 X158.873 Y101.285 E12.65273
+G1 X158.873 Y103.588 E12.76348
+G1 X156.113 Y113.888 E13.27635
+G1 X159.047 Y108.562 F7800.000
+G1 F1813
+G1 X143.096 Y112.836 E14.07058
+G1 X143.096 Y106.940 F7800.000
+G1 F1813
+G1 X149.871 Y113.715 E14.53140
+G1 X158.051 Y113.715 E14.92484
+G1 X145.622 Y101.285 E15.77025
+G1 X153.802 Y101.285 E16.16370
+G1 X159.047 Y106.530 E16.52041
+G1 X159.047 Y102.574 F7800.000
+G1 F1813
+G1 X143.096 Y106.848 E17.31465
+G1 Z3.350 F7800.000
+G1 E15.31465 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1814
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1814
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1814
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1814
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1814
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1814
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.304 Y102.048 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1814
+G1 X93.126 Y101.336 E2.03531
+G1 X93.024 Y100.606 E2.07077
+G1 X92.997 Y100.000 E2.09995
+G1 X93.024 Y99.394 E2.12912
+G1 X93.127 Y98.660 E2.16479
+G1 X93.267 Y98.074 E2.19375
+G1 X93.507 Y97.377 E2.22922
+G1 X93.819 Y96.710 E2.26463
+G1 X94.140 Y96.166 E2.29498
+G1 X94.558 Y95.594 E2.32907
+G1 X95.049 Y95.049 E2.36436
+G1 X95.596 Y94.556 E2.39977
+G1 X96.104 Y94.182 E2.43012
+G1 X96.712 Y93.818 E2.46421
+G1 X97.377 Y93.507 E2.49950
+G1 X98.074 Y93.267 E2.53496
+G1 X98.660 Y93.127 E2.56392
+G1 X99.393 Y93.024 E2.59954
+G1 X100.024 Y92.998 E2.62990
+G1 X100.731 Y93.036 E2.66398
+G1 X101.459 Y93.151 E2.69943
+G1 X102.070 Y93.310 E2.72979
+G1 X102.738 Y93.555 E2.76403
+G1 X103.308 Y93.828 E2.79442
+G1 X103.915 Y94.194 E2.82851
+G1 X104.505 Y94.638 E2.86401
+G1 X104.949 Y95.045 E2.89297
+G1 X105.445 Y95.596 E2.92864
+G1 X105.803 Y96.081 E2.95761
+G1 X106.184 Y96.715 E2.99323
+G1 X106.455 Y97.286 E3.02358
+G1 X106.696 Y97.952 E3.05767
+G1 X106.874 Y98.664 E3.09296
+G1 X106.976 Y99.394 E3.12842
+G1 X107.003 Y100.000 E3.15759
+G1 X106.976 Y100.606 E3.18677
+G1 X106.873 Y101.340 E3.22244
+G1 X106.733 Y101.926 E3.25140
+G1 X106.493 Y102.623 E3.28686
+G1 X106.181 Y103.291 E3.32233
+G1 X105.875 Y103.810 E3.35129
+G1 X105.442 Y104.407 E3.38675
+G1 X104.949 Y104.954 E3.42216
+G1 X104.483 Y105.379 E3.45252
+G1 X103.916 Y105.805 E3.48660
+G1 X103.285 Y106.184 E3.52205
+G1 X102.714 Y106.455 E3.55241
+G1 X102.048 Y106.696 E3.58649
+G1 X101.336 Y106.874 E3.62178
+G1 X100.606 Y106.976 E3.65724
+G1 X100.000 Y107.003 E3.68642
+G1 X99.394 Y106.976 E3.71559
+G1 X98.660 Y106.873 E3.75126
+G1 X98.074 Y106.733 E3.78023
+G1 X97.377 Y106.493 E3.81569
+G1 X96.710 Y106.181 E3.85110
+G1 X96.166 Y105.860 E3.88145
+G1 X95.594 Y105.442 E3.91554
+G1 X95.046 Y104.949 E3.95099
+G1 X94.621 Y104.483 E3.98134
+G1 X94.195 Y103.916 E4.01542
+G1 X93.816 Y103.285 E4.05087
+G1 X93.545 Y102.714 E4.08123
+G1 X93.324 Y102.105 E4.11241
+G1 X92.941 Y102.180 F7800.000
+G1 F1814
+G1 X92.747 Y101.410 E4.15060
+G1 X92.639 Y100.641 E4.18792
+G1 X92.611 Y100.000 E4.21880
+G1 X92.639 Y99.359 E4.24967
+G1 X92.748 Y98.588 E4.28713
+G1 X92.897 Y97.966 E4.31787
+G1 X93.149 Y97.232 E4.35520
+G1 X93.477 Y96.529 E4.39249
+G1 X93.818 Y95.954 E4.42464
+G1 X94.258 Y95.351 E4.46057
+G1 X94.776 Y94.776 E4.49779
+G1 X95.352 Y94.257 E4.53508
+G1 X95.890 Y93.860 E4.56724
+G1 X96.531 Y93.477 E4.60316
+G1 X97.232 Y93.149 E4.64038
+G1 X97.966 Y92.897 E4.67771
+G1 X98.588 Y92.748 E4.70845
+G1 X99.358 Y92.639 E4.74587
+G1 X100.026 Y92.612 E4.77803
+G1 X100.772 Y92.652 E4.81395
+G1 X101.538 Y92.773 E4.85127
+G1 X102.185 Y92.942 E4.88342
+G1 X102.888 Y93.199 E4.91944
+G1 X103.492 Y93.489 E4.95162
+G1 X104.131 Y93.874 E4.98755
+G1 X104.751 Y94.342 E5.02490
+G1 X105.223 Y94.774 E5.05564
+G1 X105.744 Y95.352 E5.09309
+G1 X106.124 Y95.866 E5.12384
+G1 X106.525 Y96.533 E5.16126
+G1 X106.811 Y97.137 E5.19341
+G1 X107.066 Y97.839 E5.22934
+G1 X107.253 Y98.590 E5.26656
+G1 X107.361 Y99.359 E5.30389
+G1 X107.389 Y100.000 E5.33476
+G1 X107.361 Y100.641 E5.36563
+G1 X107.252 Y101.412 E5.40309
+G1 X107.103 Y102.034 E5.43383
+G1 X106.851 Y102.768 E5.47116
+G1 X106.523 Y103.471 E5.50848
+G1 X106.198 Y104.022 E5.53923
+G1 X105.742 Y104.650 E5.57655
+G1 X105.223 Y105.226 E5.61385
+G1 X104.729 Y105.677 E5.64600
+G1 X104.132 Y106.125 E5.68193
+G1 X103.467 Y106.525 E5.71924
+G1 X102.863 Y106.811 E5.75140
+G1 X102.161 Y107.066 E5.78732
+G1 X101.410 Y107.253 E5.82454
+G1 X100.641 Y107.361 E5.86187
+G1 X100.000 Y107.389 E5.89274
+G1 X99.359 Y107.361 E5.92361
+G1 X98.588 Y107.252 E5.96107
+G1 X97.966 Y107.103 E5.99181
+G1 X97.232 Y106.851 E6.02914
+G1 X96.529 Y106.523 E6.06643
+G1 X95.954 Y106.182 E6.09859
+G1 X95.351 Y105.742 E6.13451
+G1 X94.774 Y105.223 E6.17183
+G1 X94.323 Y104.729 E6.20398
+G1 X93.875 Y104.132 E6.23991
+G1 X93.475 Y103.467 E6.27722
+G1 X93.189 Y102.863 E6.30938
+G1 X92.962 Y102.236 E6.34144
+G1 X92.579 Y102.311 F7800.000
+G1 F1800
+G1 X92.368 Y101.483 E6.38251
+G1 X92.255 Y100.677 E6.42170
+G1 X92.225 Y100.000 E6.45428
+G1 X92.255 Y99.323 E6.48685
+G1 X92.368 Y98.516 E6.52609
+G1 X92.526 Y97.858 E6.55861
+G1 X92.791 Y97.088 E6.59780
+G1 X93.136 Y96.349 E6.63698
+G1 X93.495 Y95.742 E6.67093
+G1 X93.958 Y95.107 E6.70870
+G1 X94.502 Y94.502 E6.74784
+G1 X95.108 Y93.957 E6.78702
+G1 X95.676 Y93.539 E6.82097
+G1 X96.350 Y93.135 E6.85874
+G1 X97.088 Y92.791 E6.89789
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00883
+G1 X100.028 Y92.226 E7.04278
+G1 X100.812 Y92.268 E7.08054
+G1 X101.617 Y92.395 E7.11973
+G1 X102.300 Y92.574 E7.15368
+G1 X103.038 Y92.844 E7.19148
+G1 X103.675 Y93.149 E7.22544
+G1 X104.347 Y93.554 E7.26321
+G1 X104.998 Y94.045 E7.30241
+G1 X105.497 Y94.502 E7.33493
+G1 X106.043 Y95.108 E7.37417
+G1 X106.445 Y95.652 E7.40670
+G1 X106.865 Y96.351 E7.44592
+G1 X107.168 Y96.988 E7.47987
+G1 X107.435 Y97.727 E7.51764
+G1 X107.632 Y98.517 E7.55679
+G1 X107.745 Y99.323 E7.59598
+G1 X107.775 Y100.000 E7.62855
+G1 X107.745 Y100.677 E7.66113
+G1 X107.632 Y101.484 E7.70036
+G1 X107.474 Y102.142 E7.73289
+G1 X107.209 Y102.912 E7.77208
+G1 X106.864 Y103.651 E7.81126
+G1 X106.521 Y104.234 E7.84379
+G1 X106.042 Y104.893 E7.88298
+G1 X105.497 Y105.498 E7.92216
+G1 X104.976 Y105.974 E7.95611
+G1 X104.348 Y106.445 E7.99387
+G1 X103.649 Y106.865 E8.03306
+G1 X103.012 Y107.168 E8.06701
+G1 X102.273 Y107.435 E8.10478
+G1 X101.483 Y107.632 E8.14393
+G1 X100.677 Y107.745 E8.18311
+G1 X100.000 Y107.775 E8.21569
+G1 X99.323 Y107.745 E8.24826
+G1 X98.516 Y107.632 E8.28750
+G1 X97.858 Y107.474 E8.32003
+G1 X97.088 Y107.209 E8.35921
+G1 X96.349 Y106.864 E8.39839
+G1 X95.742 Y106.505 E8.43234
+G1 X95.107 Y106.042 E8.47011
+G1 X94.502 Y105.497 E8.50929
+G1 X94.026 Y104.976 E8.54324
+G1 X93.555 Y104.348 E8.58101
+G1 X93.135 Y103.649 E8.62020
+G1 X92.832 Y103.012 E8.65415
+G1 X92.599 Y102.367 E8.68710
+G1 X92.851 Y102.018 F7800.000
+G1 X93.275 Y101.455
+G1 F1814
+G1 X98.312 Y106.492 E9.02970
+G1 X98.714 Y106.589 E9.04956
+G1 X99.421 Y106.688 E9.08389
+G1 X100.000 Y106.713 E9.11179
+G1 X100.579 Y106.688 E9.13969
+G1 X101.281 Y106.589 E9.17375
+G1 X101.964 Y106.419 E9.20760
+G1 X102.603 Y106.188 E9.24030
+G1 X103.148 Y105.929 E9.26931
+G1 X103.755 Y105.565 E9.30335
+G1 X104.298 Y105.156 E9.33605
+G1 X104.747 Y104.747 E9.36527
+G1 X95.253 Y95.253 E10.01099
+G1 X95.779 Y94.780 E10.04499
+G1 X96.264 Y94.423 E10.07400
+G1 X96.848 Y94.073 E10.10670
+G1 X97.485 Y93.776 E10.14054
+G1 X98.155 Y93.545 E10.17461
+G1 X98.714 Y93.411 E10.20224
+G1 X99.419 Y93.312 E10.23651
+G1 X100.022 Y93.287 E10.26551
+G1 X100.701 Y93.324 E10.29821
+G1 X101.400 Y93.435 E10.33226
+G1 X101.691 Y93.510 E10.34672
+G1 X106.725 Y98.545 E10.68913
+G1 X106.779 Y101.178 F7800.000
+G1 F1814
+G1 X94.712 Y104.411 E11.29001
+G1 X93.221 Y98.822 F7800.000
+G1 F1814
+G1 X105.283 Y95.590 E11.89065
+G1 X104.623 Y105.095 F7800.000
+G1 F1814
+G1 X106.465 Y98.221 E12.23294
+G1 X106.419 Y98.036 E12.24207
+G1 X106.188 Y97.397 E12.27477
+G1 X105.929 Y96.852 E12.30378
+G1 X105.562 Y96.241 E12.33805
+G1 X105.221 Y95.780 E12.36567
+G1 X104.743 Y95.249 E12.40001
+G1 X104.319 Y94.861 E12.42764
+G1 X103.753 Y94.434 E12.46175
+G1 X103.171 Y94.083 E12.49445
+G1 X102.626 Y93.822 E12.52351
+G1 X101.983 Y93.587 E12.55641
+G1 X101.736 Y93.522 E12.56873
+G1 X98.264 Y106.481 E13.21397
+G1 X97.485 Y106.224 E13.25338
+G1 X96.845 Y105.925 E13.28738
+G1 X96.326 Y105.618 E13.31639
+G1 X95.776 Y105.218 E13.34909
+G1 X95.250 Y104.744 E13.38314
+G1 X94.844 Y104.298 E13.41215
+G1 X94.435 Y103.755 E13.44485
+G1 X94.071 Y103.148 E13.47890
+G1 X93.812 Y102.603 E13.50790
+G1 X93.581 Y101.964 E13.54060
+G1 X93.535 Y101.779 E13.54973
+G1 X95.376 Y94.910 E13.89180
+G1 E11.89180 F2400.00000
+G92 E0
+G1 X143.185 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1814
+G1 X159.367 Y100.996 E2.77830
+G1 X159.367 Y114.004 E3.40391
+G1 X143.185 Y114.004 E4.18221
+G1 X143.185 Y101.056 E4.80494
+G1 X142.800 Y100.611 F7800.000
+G1 F1814
+G1 X159.753 Y100.611 E5.62033
+G1 X159.753 Y114.389 E6.28304
+G1 X142.800 Y114.389 E7.09843
+G1 X142.800 Y100.671 E7.75826
+G1 X142.414 Y100.225 F7800.000
+G1 F1800
+G1 X160.139 Y100.225 E8.61074
+G1 X160.139 Y114.775 E9.31055
+G1 X142.414 Y114.775 E10.16303
+G1 X142.414 Y100.285 E10.85995
+G1 X142.804 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1814
+G1 X144.183 Y113.715 E11.48748
+G1 X150.171 Y113.715 E11.77550
+G1 X153.502 Y101.285 E12.39438
+G1 X159.078 Y101.285 E12.66260
+G1 X159.078 Y102.822 E12.73651
+G1 X156.113 Y113.888 E13.28752
+G1 X159.252 Y108.507 F7800.000
+G1 F1814
+G1 X143.301 Y112.781 E14.08175
+G1 X143.301 Y107.145 F7800.000
+G1 F1814
+G1 X149.871 Y113.715 E14.52861
+G1 X158.051 Y113.715 E14.92205
+G1 X145.622 Y101.285 E15.76747
+G1 X153.802 Y101.285 E16.16091
+G1 X159.252 Y106.735 E16.53158
+G1 X159.252 Y102.519 F7800.000
+G1 F1814
+G1 X143.301 Y106.793 E17.32582
+G1 Z3.650 F7800.000
+G1 E15.32582 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1814
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1814
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1814
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1814
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1814
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1814
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.058 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1814
+G1 X93.127 Y101.340 E2.03567
+G1 X93.024 Y100.606 E2.07134
+G1 X92.997 Y100.000 E2.10051
+G1 X93.024 Y99.394 E2.12968
+G1 X93.127 Y98.660 E2.16536
+G1 X93.267 Y98.074 E2.19432
+G1 X93.507 Y97.377 E2.22978
+G1 X93.819 Y96.710 E2.26519
+G1 X94.142 Y96.164 E2.29567
+G1 X94.558 Y95.594 E2.32963
+G1 X95.049 Y95.049 E2.36492
+G1 X95.596 Y94.556 E2.40033
+G1 X96.106 Y94.180 E2.43082
+G1 X96.712 Y93.818 E2.46477
+G1 X97.377 Y93.507 E2.50006
+G1 X98.074 Y93.267 E2.53553
+G1 X98.660 Y93.127 E2.56449
+G1 X99.393 Y93.024 E2.60011
+G1 X100.026 Y92.998 E2.63059
+G1 X100.731 Y93.036 E2.66454
+G1 X101.460 Y93.151 E2.70005
+G1 X102.043 Y93.302 E2.72901
+G1 X102.736 Y93.554 E2.76448
+G1 X103.399 Y93.877 E2.79994
+G1 X103.912 Y94.192 E2.82890
+G1 X104.505 Y94.638 E2.86457
+G1 X104.949 Y95.045 E2.89354
+G1 X105.444 Y95.596 E2.92915
+G1 X105.820 Y96.106 E2.95964
+G1 X106.182 Y96.712 E2.99359
+G1 X106.493 Y97.377 E3.02889
+G1 X106.733 Y98.074 E3.06435
+G1 X106.873 Y98.660 E3.09331
+G1 X106.976 Y99.394 E3.12899
+G1 X107.003 Y100.000 E3.15816
+G1 X106.976 Y100.606 E3.18733
+G1 X106.874 Y101.336 E3.22279
+G1 X106.696 Y102.050 E3.25820
+G1 X106.483 Y102.647 E3.28869
+G1 X106.183 Y103.287 E3.32264
+G1 X105.803 Y103.919 E3.35814
+G1 X105.445 Y104.404 E3.38711
+G1 X104.951 Y104.951 E3.42257
+G1 X104.407 Y105.442 E3.45782
+G1 X103.810 Y105.875 E3.49329
+G1 X103.291 Y106.181 E3.52225
+G1 X102.623 Y106.493 E3.55771
+G1 X101.926 Y106.733 E3.59317
+G1 X101.340 Y106.873 E3.62214
+G1 X100.606 Y106.976 E3.65781
+G1 X100.000 Y107.003 E3.68698
+G1 X99.394 Y106.976 E3.71616
+G1 X98.664 Y106.874 E3.75162
+G1 X97.950 Y106.696 E3.78702
+G1 X97.353 Y106.483 E3.81751
+G1 X96.713 Y106.183 E3.85146
+G1 X96.081 Y105.803 E3.88697
+G1 X95.596 Y105.445 E3.91593
+G1 X95.049 Y104.951 E3.95140
+G1 X94.558 Y104.407 E3.98665
+G1 X94.125 Y103.811 E4.02205
+G1 X93.805 Y103.264 E4.05254
+G1 X93.508 Y102.624 E4.08649
+G1 X93.333 Y102.115 E4.11239
+G1 X92.948 Y102.184 F7800.000
+G1 F1814
+G1 X92.748 Y101.412 E4.15072
+G1 X92.639 Y100.641 E4.18817
+G1 X92.611 Y100.000 E4.21905
+G1 X92.639 Y99.359 E4.24992
+G1 X92.748 Y98.588 E4.28738
+G1 X92.897 Y97.966 E4.31812
+G1 X93.149 Y97.232 E4.35545
+G1 X93.477 Y96.530 E4.39274
+G1 X93.819 Y95.952 E4.42502
+G1 X94.258 Y95.351 E4.46082
+G1 X94.776 Y94.776 E4.49804
+G1 X95.352 Y94.257 E4.53533
+G1 X95.892 Y93.859 E4.56761
+G1 X96.531 Y93.477 E4.60341
+G1 X97.232 Y93.149 E4.64063
+G1 X97.966 Y92.897 E4.67796
+G1 X98.588 Y92.748 E4.70870
+G1 X99.358 Y92.639 E4.74612
+G1 X100.029 Y92.612 E4.77841
+G1 X100.772 Y92.652 E4.81420
+G1 X101.539 Y92.773 E4.85155
+G1 X102.158 Y92.933 E4.88230
+G1 X102.887 Y93.199 E4.91962
+G1 X103.584 Y93.539 E4.95695
+G1 X104.129 Y93.873 E4.98769
+G1 X104.751 Y94.342 E5.02515
+G1 X105.223 Y94.774 E5.05589
+G1 X105.743 Y95.352 E5.09331
+G1 X106.141 Y95.892 E5.12559
+G1 X106.523 Y96.531 E5.16139
+G1 X106.851 Y97.232 E5.19861
+G1 X107.103 Y97.966 E5.23594
+G1 X107.252 Y98.588 E5.26668
+G1 X107.361 Y99.359 E5.30414
+G1 X107.389 Y100.000 E5.33501
+G1 X107.361 Y100.641 E5.36588
+G1 X107.253 Y101.410 E5.40321
+G1 X107.065 Y102.162 E5.44050
+G1 X106.840 Y102.794 E5.47278
+G1 X106.524 Y103.468 E5.50858
+G1 X106.124 Y104.134 E5.54593
+G1 X105.744 Y104.648 E5.57668
+G1 X105.224 Y105.224 E5.61400
+G1 X104.650 Y105.742 E5.65120
+G1 X104.022 Y106.198 E5.68852
+G1 X103.471 Y106.523 E5.71927
+G1 X102.768 Y106.851 E5.75659
+G1 X102.034 Y107.103 E5.79392
+G1 X101.412 Y107.252 E5.82466
+G1 X100.641 Y107.361 E5.86212
+G1 X100.000 Y107.389 E5.89299
+G1 X99.359 Y107.361 E5.92387
+G1 X98.590 Y107.253 E5.96119
+G1 X97.838 Y107.065 E5.99848
+G1 X97.206 Y106.840 E6.03077
+G1 X96.532 Y106.524 E6.06656
+G1 X95.866 Y106.124 E6.10391
+G1 X95.352 Y105.744 E6.13466
+G1 X94.776 Y105.224 E6.17198
+G1 X94.258 Y104.650 E6.20918
+G1 X93.802 Y104.023 E6.24647
+G1 X93.463 Y103.443 E6.27875
+G1 X93.150 Y102.768 E6.31455
+G1 X92.968 Y102.241 E6.34140
+G1 X92.584 Y102.309 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34990
+G1 X92.368 Y101.484 E6.38243
+G1 X92.255 Y100.677 E6.42167
+G1 X92.225 Y100.000 E6.45424
+G1 X92.255 Y99.323 E6.48682
+G1 X92.368 Y98.516 E6.52605
+G1 X92.526 Y97.858 E6.55858
+G1 X92.791 Y97.088 E6.59777
+G1 X93.136 Y96.349 E6.63694
+G1 X93.497 Y95.740 E6.67103
+G1 X93.958 Y95.107 E6.70866
+G1 X94.502 Y94.502 E6.74781
+G1 X95.108 Y93.957 E6.78699
+G1 X95.678 Y93.537 E6.82107
+G1 X96.350 Y93.135 E6.85870
+G1 X97.088 Y92.791 E6.89785
+G1 X97.858 Y92.526 E6.93704
+G1 X98.516 Y92.368 E6.96957
+G1 X99.323 Y92.255 E7.00879
+G1 X100.031 Y92.226 E7.04288
+G1 X100.812 Y92.268 E7.08051
+G1 X101.617 Y92.395 E7.11971
+G1 X102.272 Y92.565 E7.15224
+G1 X103.038 Y92.843 E7.19142
+G1 X103.770 Y93.201 E7.23061
+G1 X104.347 Y93.554 E7.26314
+G1 X104.998 Y94.045 E7.30237
+G1 X105.497 Y94.502 E7.33490
+G1 X106.043 Y95.108 E7.37412
+G1 X106.463 Y95.678 E7.40821
+G1 X106.865 Y96.350 E7.44584
+G1 X107.209 Y97.088 E7.48499
+G1 X107.474 Y97.858 E7.52418
+G1 X107.632 Y98.516 E7.55671
+G1 X107.745 Y99.323 E7.59594
+G1 X107.775 Y100.000 E7.62852
+G1 X107.745 Y100.677 E7.66109
+G1 X107.632 Y101.483 E7.70028
+G1 X107.435 Y102.274 E7.73946
+G1 X107.197 Y102.941 E7.77354
+G1 X106.865 Y103.650 E7.81117
+G1 X106.445 Y104.348 E7.85037
+G1 X106.043 Y104.892 E7.88290
+G1 X105.498 Y105.498 E7.92209
+G1 X104.893 Y106.042 E7.96123
+G1 X104.234 Y106.521 E8.00042
+G1 X103.651 Y106.864 E8.03294
+G1 X102.912 Y107.209 E8.07213
+G1 X102.142 Y107.474 E8.11132
+G1 X101.484 Y107.632 E8.14385
+G1 X100.677 Y107.745 E8.18308
+G1 X100.000 Y107.775 E8.21566
+G1 X99.323 Y107.745 E8.24823
+G1 X98.517 Y107.632 E8.28742
+G1 X97.726 Y107.435 E8.32659
+G1 X97.059 Y107.197 E8.36068
+G1 X96.350 Y106.865 E8.39831
+G1 X95.652 Y106.445 E8.43751
+G1 X95.108 Y106.043 E8.47004
+G1 X94.502 Y105.498 E8.50923
+G1 X93.958 Y104.893 E8.54837
+G1 X93.479 Y104.234 E8.58754
+G1 X93.121 Y103.622 E8.62162
+G1 X92.791 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68706
+G1 X92.697 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1814
+G1 X98.306 Y106.487 E9.02943
+G1 X98.719 Y106.589 E9.04989
+G1 X99.421 Y106.688 E9.08396
+G1 X100.000 Y106.713 E9.11186
+G1 X100.579 Y106.688 E9.13976
+G1 X101.286 Y106.589 E9.17409
+G1 X101.845 Y106.455 E9.20172
+G1 X102.515 Y106.224 E9.23578
+G1 X103.157 Y105.925 E9.26985
+G1 X103.652 Y105.633 E9.29748
+G1 X104.224 Y105.217 E9.33154
+G1 X104.747 Y104.747 E9.36534
+G1 X95.253 Y95.253 E10.01106
+G1 X95.779 Y94.780 E10.04505
+G1 X96.266 Y94.421 E10.07419
+G1 X96.848 Y94.073 E10.10676
+G1 X97.485 Y93.776 E10.14061
+G1 X98.155 Y93.545 E10.17468
+G1 X98.714 Y93.411 E10.20231
+G1 X99.419 Y93.312 E10.23657
+G1 X100.024 Y93.287 E10.26571
+G1 X100.701 Y93.324 E10.29828
+G1 X101.401 Y93.435 E10.33240
+G1 X101.690 Y93.509 E10.34672
+G1 X106.727 Y98.547 E10.68937
+G1 X106.779 Y101.178 F7800.000
+G1 F1814
+G1 X94.717 Y104.410 E11.29001
+G1 X93.221 Y98.822 F7800.000
+G1 F1814
+G1 X105.283 Y95.590 E11.89065
+G1 X104.624 Y105.090 F7800.000
+G1 F1814
+G1 X106.468 Y98.210 E12.23322
+G1 X106.224 Y97.485 E12.27001
+G1 X105.927 Y96.848 E12.30386
+G1 X105.579 Y96.266 E12.33643
+G1 X105.220 Y95.779 E12.36557
+G1 X104.743 Y95.249 E12.39983
+G1 X104.319 Y94.861 E12.42746
+G1 X103.749 Y94.431 E12.46180
+G1 X103.259 Y94.131 E12.48942
+G1 X102.623 Y93.821 E12.52349
+G1 X101.957 Y93.579 E12.55755
+G1 X101.736 Y93.521 E12.56855
+G1 X98.265 Y106.476 E13.21362
+G1 X98.033 Y106.418 E13.22508
+G1 X97.463 Y106.215 E13.25422
+G1 X96.850 Y105.928 E13.28679
+G1 X96.241 Y105.562 E13.32091
+G1 X95.780 Y105.221 E13.34854
+G1 X95.253 Y104.747 E13.38261
+G1 X94.783 Y104.224 E13.41640
+G1 X94.368 Y103.653 E13.45039
+G1 X94.061 Y103.130 E13.47953
+G1 X93.776 Y102.516 E13.51210
+G1 X93.545 Y101.845 E13.54622
+G1 X93.532 Y101.790 E13.54896
+G1 X95.376 Y94.910 E13.89153
+G1 E11.89153 F2400.00000
+G92 E0
+G1 X143.391 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1814
+G1 X159.573 Y100.996 E2.77830
+G1 X159.573 Y114.004 E3.40391
+G1 X143.391 Y114.004 E4.18221
+G1 X143.391 Y101.056 E4.80494
+G1 X143.005 Y100.611 F7800.000
+G1 F1814
+G1 X159.958 Y100.611 E5.62033
+G1 X159.958 Y114.389 E6.28304
+G1 X143.005 Y114.389 E7.09843
+G1 X143.005 Y100.671 E7.75826
+G1 X142.619 Y100.225 F7800.000
+G1 F1800
+G1 X160.344 Y100.225 E8.61074
+G1 X160.344 Y114.775 E9.31055
+G1 X142.619 Y114.775 E10.16303
+G1 X142.619 Y100.285 E10.85995
+G1 X143.009 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1814
+G1 X144.183 Y113.715 E11.48748
+G1 X150.171 Y113.715 E11.77550
+G1 X153.502 Y101.285 E12.39438
+G1 X159.283 Y101.285 E12.67247
+G1 X159.283 Y102.056 E12.70954
+G1 X156.113 Y113.888 E13.29869
+G1 X159.457 Y108.452 F7800.000
+G1 F1814
+G1 X143.506 Y112.726 E14.09292
+G1 X143.506 Y107.350 F7800.000
+G1 F1814
+G1 X149.871 Y113.715 E14.52582
+G1 X158.051 Y113.715 E14.91926
+G1 X145.622 Y101.285 E15.76468
+G1 X153.802 Y101.285 E16.15812
+G1 X159.457 Y106.940 E16.54276
+G1 X159.457 Y102.464 F7800.000
+G1 F1814
+G1 X143.506 Y106.738 E17.33699
+G1 Z3.950 F7800.000
+G1 E15.33699 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1815
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1815
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1815
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1815
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1815
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.058 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X93.126 Y101.337 E2.03581
+G1 X93.033 Y100.703 E2.06664
+G1 X92.997 Y99.998 E2.10061
+G1 X93.027 Y99.361 E2.13128
+G1 X93.126 Y98.665 E2.16510
+G1 X93.304 Y97.950 E2.20055
+G1 X93.518 Y97.350 E2.23116
+G1 X93.817 Y96.713 E2.26499
+G1 X94.196 Y96.082 E2.30043
+G1 X94.576 Y95.571 E2.33105
+G1 X95.048 Y95.049 E2.36488
+G1 X95.596 Y94.556 E2.40032
+G1 X96.108 Y94.179 E2.43094
+G1 X96.712 Y93.818 E2.46476
+G1 X97.377 Y93.507 E2.50006
+G1 X98.074 Y93.267 E2.53552
+G1 X98.660 Y93.127 E2.56449
+G1 X99.393 Y93.024 E2.60010
+G1 X100.029 Y92.998 E2.63072
+G1 X100.731 Y93.036 E2.66454
+G1 X101.459 Y93.151 E2.69999
+G1 X102.075 Y93.312 E2.73060
+G1 X102.735 Y93.554 E2.76443
+G1 X103.399 Y93.877 E2.79994
+G1 X103.915 Y94.194 E2.82905
+G1 X104.429 Y94.576 E2.85987
+G1 X104.951 Y95.048 E2.89370
+G1 X105.444 Y95.596 E2.92915
+G1 X105.821 Y96.108 E2.95976
+G1 X106.182 Y96.712 E2.99359
+G1 X106.493 Y97.377 E3.02888
+G1 X106.733 Y98.074 E3.06435
+G1 X106.873 Y98.660 E3.09331
+G1 X106.976 Y99.394 E3.12898
+G1 X107.003 Y99.999 E3.15810
+G1 X106.973 Y100.639 E3.18892
+G1 X106.874 Y101.335 E3.22275
+G1 X106.696 Y102.050 E3.25819
+G1 X106.482 Y102.650 E3.28881
+G1 X106.183 Y103.287 E3.32263
+G1 X105.804 Y103.918 E3.35808
+G1 X105.424 Y104.429 E3.38870
+G1 X104.952 Y104.951 E3.42252
+G1 X104.407 Y105.442 E3.45782
+G1 X103.811 Y105.875 E3.49322
+G1 X103.262 Y106.196 E3.52384
+G1 X102.624 Y106.492 E3.55766
+G1 X101.926 Y106.733 E3.59317
+G1 X101.340 Y106.873 E3.62213
+G1 X100.606 Y106.976 E3.65781
+G1 X100.001 Y107.003 E3.68692
+G1 X99.361 Y106.973 E3.71774
+G1 X98.665 Y106.874 E3.75157
+G1 X97.950 Y106.696 E3.78702
+G1 X97.350 Y106.482 E3.81763
+G1 X96.713 Y106.183 E3.85146
+G1 X96.082 Y105.804 E3.88690
+G1 X95.571 Y105.424 E3.91752
+G1 X95.049 Y104.952 E3.95134
+G1 X94.558 Y104.407 E3.98664
+G1 X94.127 Y103.814 E4.02189
+G1 X93.759 Y103.175 E4.05736
+G1 X93.509 Y102.627 E4.08632
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1815
+G1 X92.747 Y101.411 E4.15081
+G1 X92.649 Y100.741 E4.18335
+G1 X92.611 Y99.999 E4.21911
+G1 X92.642 Y99.325 E4.25155
+G1 X92.747 Y98.591 E4.28721
+G1 X92.935 Y97.838 E4.32453
+G1 X93.161 Y97.203 E4.35695
+G1 X93.476 Y96.532 E4.39261
+G1 X93.876 Y95.867 E4.42992
+G1 X94.278 Y95.326 E4.46234
+G1 X94.775 Y94.776 E4.49800
+G1 X95.352 Y94.257 E4.53532
+G1 X95.894 Y93.857 E4.56774
+G1 X96.531 Y93.477 E4.60340
+G1 X97.232 Y93.149 E4.64062
+G1 X97.966 Y92.897 E4.67795
+G1 X98.588 Y92.748 E4.70870
+G1 X99.358 Y92.639 E4.74611
+G1 X100.031 Y92.612 E4.77853
+G1 X100.772 Y92.652 E4.81419
+G1 X101.538 Y92.773 E4.85151
+G1 X102.190 Y92.944 E4.88392
+G1 X102.886 Y93.199 E4.91959
+G1 X103.584 Y93.539 E4.95694
+G1 X104.131 Y93.874 E4.98778
+G1 X104.674 Y94.278 E5.02032
+G1 X105.224 Y94.775 E5.05598
+G1 X105.743 Y95.352 E5.09330
+G1 X106.143 Y95.894 E5.12572
+G1 X106.523 Y96.531 E5.16138
+G1 X106.851 Y97.232 E5.19860
+G1 X107.103 Y97.966 E5.23593
+G1 X107.252 Y98.588 E5.26667
+G1 X107.361 Y99.359 E5.30413
+G1 X107.389 Y99.999 E5.33497
+G1 X107.358 Y100.675 E5.36751
+G1 X107.253 Y101.409 E5.40317
+G1 X107.065 Y102.162 E5.44049
+G1 X106.839 Y102.797 E5.47291
+G1 X106.524 Y103.468 E5.50857
+G1 X106.124 Y104.133 E5.54588
+G1 X105.722 Y104.674 E5.57830
+G1 X105.225 Y105.224 E5.61396
+G1 X104.650 Y105.742 E5.65119
+G1 X104.023 Y106.198 E5.68848
+G1 X103.441 Y106.538 E5.72089
+G1 X102.768 Y106.850 E5.75656
+G1 X102.034 Y107.103 E5.79391
+G1 X101.412 Y107.252 E5.82465
+G1 X100.641 Y107.361 E5.86211
+G1 X100.001 Y107.389 E5.89295
+G1 X99.325 Y107.358 E5.92549
+G1 X98.591 Y107.253 E5.96115
+G1 X97.838 Y107.065 E5.99847
+G1 X97.203 Y106.839 E6.03089
+G1 X96.532 Y106.524 E6.06655
+G1 X95.867 Y106.124 E6.10386
+G1 X95.326 Y105.722 E6.13628
+G1 X94.776 Y105.225 E6.17194
+G1 X94.258 Y104.650 E6.20917
+G1 X93.803 Y104.024 E6.24637
+G1 X93.415 Y103.352 E6.28369
+G1 X93.150 Y102.770 E6.31444
+G1 X92.968 Y102.241 E6.34139
+G1 X92.584 Y102.309 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34989
+G1 X92.368 Y101.484 E6.38246
+G1 X92.265 Y100.779 E6.41672
+G1 X92.225 Y100.000 E6.45425
+G1 X92.258 Y99.289 E6.48848
+G1 X92.368 Y98.517 E6.52598
+G1 X92.565 Y97.726 E6.56517
+G1 X92.804 Y97.056 E6.59938
+G1 X93.135 Y96.350 E6.63689
+G1 X93.555 Y95.652 E6.67607
+G1 X93.979 Y95.081 E6.71029
+G1 X94.502 Y94.503 E6.74779
+G1 X95.108 Y93.957 E6.78697
+G1 X95.681 Y93.536 E6.82119
+G1 X96.350 Y93.135 E6.85869
+G1 X97.088 Y92.791 E6.89784
+G1 X97.858 Y92.526 E6.93703
+G1 X98.516 Y92.368 E6.96956
+G1 X99.323 Y92.255 E7.00878
+G1 X100.034 Y92.226 E7.04300
+G1 X100.812 Y92.268 E7.08050
+G1 X101.617 Y92.395 E7.11968
+G1 X102.305 Y92.575 E7.15390
+G1 X103.038 Y92.843 E7.19140
+G1 X103.770 Y93.201 E7.23060
+G1 X104.347 Y93.554 E7.26316
+G1 X104.919 Y93.979 E7.29742
+G1 X105.497 Y94.502 E7.33493
+G1 X106.043 Y95.108 E7.37411
+G1 X106.464 Y95.681 E7.40833
+G1 X106.865 Y96.350 E7.44583
+G1 X107.209 Y97.088 E7.48498
+G1 X107.474 Y97.858 E7.52417
+G1 X107.632 Y98.516 E7.55670
+G1 X107.745 Y99.323 E7.59593
+G1 X107.775 Y100.000 E7.62849
+G1 X107.742 Y100.711 E7.66276
+G1 X107.632 Y101.483 E7.70026
+G1 X107.435 Y102.274 E7.73944
+G1 X107.196 Y102.944 E7.77366
+G1 X106.865 Y103.650 E7.81116
+G1 X106.445 Y104.348 E7.85034
+G1 X106.021 Y104.919 E7.88456
+G1 X105.498 Y105.497 E7.92206
+G1 X104.893 Y106.042 E7.96121
+G1 X104.234 Y106.521 E8.00039
+G1 X103.620 Y106.880 E8.03460
+G1 X102.913 Y107.208 E8.07211
+G1 X102.142 Y107.474 E8.11130
+G1 X101.484 Y107.632 E8.14383
+G1 X100.677 Y107.745 E8.18307
+G1 X100.000 Y107.775 E8.21563
+G1 X99.289 Y107.742 E8.24989
+G1 X98.517 Y107.632 E8.28739
+G1 X97.726 Y107.435 E8.32658
+G1 X97.056 Y107.196 E8.36080
+G1 X96.350 Y106.865 E8.39830
+G1 X95.652 Y106.445 E8.43748
+G1 X95.081 Y106.021 E8.47170
+G1 X94.503 Y105.498 E8.50920
+G1 X93.958 Y104.893 E8.54835
+G1 X93.480 Y104.234 E8.58749
+G1 X93.072 Y103.529 E8.62668
+G1 X92.792 Y102.913 E8.65921
+G1 X92.603 Y102.366 E8.68705
+G1 X92.698 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1815
+G1 X98.306 Y106.487 E9.02942
+G1 X98.720 Y106.590 E9.04994
+G1 X99.388 Y106.685 E9.08238
+G1 X100.002 Y106.713 E9.11192
+G1 X100.579 Y106.688 E9.13974
+G1 X101.286 Y106.589 E9.17408
+G1 X101.845 Y106.455 E9.20170
+G1 X102.516 Y106.224 E9.23583
+G1 X103.128 Y105.940 E9.26827
+G1 X103.653 Y105.632 E9.29754
+G1 X104.224 Y105.217 E9.33153
+G1 X104.747 Y104.747 E9.36532
+G1 X95.253 Y95.253 E10.01105
+G1 X95.778 Y94.781 E10.04503
+G1 X96.269 Y94.420 E10.07430
+G1 X96.847 Y94.073 E10.10674
+G1 X97.485 Y93.776 E10.14060
+G1 X98.155 Y93.545 E10.17466
+G1 X98.714 Y93.411 E10.20229
+G1 X99.419 Y93.312 E10.23655
+G1 X100.027 Y93.287 E10.26582
+G1 X100.700 Y93.324 E10.29826
+G1 X101.400 Y93.435 E10.33231
+G1 X101.691 Y93.511 E10.34678
+G1 X106.727 Y98.547 E10.68935
+G1 X106.780 Y101.178 F7800.000
+G1 F1815
+G1 X94.717 Y104.410 E11.29000
+G1 X93.220 Y98.822 F7800.000
+G1 F1815
+G1 X105.283 Y95.590 E11.89066
+G1 X104.624 Y105.090 F7800.000
+G1 F1815
+G1 X106.468 Y98.210 E12.23323
+G1 X106.224 Y97.485 E12.27002
+G1 X105.927 Y96.847 E12.30388
+G1 X105.580 Y96.269 E12.33632
+G1 X105.219 Y95.778 E12.36559
+G1 X104.746 Y95.252 E12.39963
+G1 X104.245 Y94.800 E12.43208
+G1 X103.753 Y94.434 E12.46161
+G1 X103.259 Y94.131 E12.48943
+G1 X102.622 Y93.820 E12.52356
+G1 X101.988 Y93.588 E12.55600
+G1 X101.736 Y93.522 E12.56856
+G1 X98.265 Y106.476 E13.21358
+G1 X98.033 Y106.419 E13.22504
+G1 X97.460 Y106.214 E13.25431
+G1 X96.850 Y105.928 E13.28675
+G1 X96.243 Y105.563 E13.32080
+G1 X95.755 Y105.200 E13.35006
+G1 X95.254 Y104.748 E13.38251
+G1 X94.783 Y104.224 E13.41636
+G1 X94.370 Y103.656 E13.45016
+G1 X94.016 Y103.043 E13.48422
+G1 X93.778 Y102.520 E13.51185
+G1 X93.545 Y101.845 E13.54618
+G1 X93.532 Y101.790 E13.54892
+G1 X95.376 Y94.910 E13.89149
+G1 E11.89149 F2400.00000
+G92 E0
+G1 X143.596 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X159.778 Y100.996 E2.77830
+G1 X159.778 Y114.004 E3.40391
+G1 X143.596 Y114.004 E4.18221
+G1 X143.596 Y101.056 E4.80494
+G1 X143.210 Y100.611 F7800.000
+G1 F1815
+G1 X160.164 Y100.611 E5.62033
+G1 X160.164 Y114.389 E6.28304
+G1 X143.210 Y114.389 E7.09843
+G1 X143.210 Y100.671 E7.75826
+G1 X142.825 Y100.225 F7800.000
+G1 F1800
+G1 X160.549 Y100.225 E8.61074
+G1 X160.549 Y114.775 E9.31055
+G1 X142.825 Y114.775 E10.16303
+G1 X142.825 Y100.285 E10.85995
+G1 X143.214 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1815
+G1 X144.183 Y113.715 E11.48748
+G1 X150.171 Y113.715 E11.77550
+G1 X153.502 Y101.285 E12.39438
+G1 X159.489 Y101.285 E12.68234
+G1 X156.113 Y113.888 E13.30985
+G1 X159.662 Y108.397 F7800.000
+G1 F1815
+G1 X143.712 Y112.671 E14.10409
+G1 X143.712 Y107.555 F7800.000
+G1 F1815
+G1 X149.871 Y113.715 E14.52302
+G1 X158.051 Y113.715 E14.91647
+G1 X145.622 Y101.285 E15.76188
+G1 X153.802 Y101.285 E16.15532
+G1 X159.662 Y107.146 E16.55392
+G1 X159.662 Y102.409 F7800.000
+G1 F1815
+G1 X143.712 Y106.683 E17.34815
+G1 Z4.250 F7800.000
+G1 E15.34815 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1816
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1816
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1816
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1816
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1816
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1816
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.304 Y102.049 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1816
+G1 X93.126 Y101.336 E2.03533
+G1 X93.024 Y100.606 E2.07079
+G1 X92.997 Y100.000 E2.09997
+G1 X93.024 Y99.394 E2.12914
+G1 X93.127 Y98.660 E2.16481
+G1 X93.267 Y98.074 E2.19378
+G1 X93.507 Y97.377 E2.22924
+G1 X93.819 Y96.710 E2.26464
+G1 X94.144 Y96.160 E2.29538
+G1 X94.557 Y95.594 E2.32908
+G1 X95.049 Y95.049 E2.36438
+G1 X95.595 Y94.556 E2.39978
+G1 X96.110 Y94.177 E2.43052
+G1 X96.712 Y93.818 E2.46422
+G1 X97.377 Y93.507 E2.49952
+G1 X98.074 Y93.267 E2.53498
+G1 X98.660 Y93.127 E2.56395
+G1 X99.393 Y93.024 E2.59955
+G1 X100.031 Y92.998 E2.63030
+G1 X100.731 Y93.036 E2.66399
+G1 X101.459 Y93.151 E2.69944
+G1 X102.077 Y93.313 E2.73019
+G1 X102.735 Y93.554 E2.76388
+G1 X103.399 Y93.877 E2.79939
+G1 X103.912 Y94.192 E2.82836
+G1 X104.505 Y94.638 E2.86403
+G1 X104.951 Y95.047 E2.89314
+G1 X105.384 Y95.523 E2.92409
+G1 X105.805 Y96.083 E2.95779
+G1 X106.184 Y96.715 E2.99323
+G1 X106.458 Y97.293 E3.02398
+G1 X106.696 Y97.952 E3.05767
+G1 X106.874 Y98.664 E3.09298
+G1 X106.976 Y99.394 E3.12844
+G1 X107.003 Y100.000 E3.15761
+G1 X106.976 Y100.606 E3.18679
+G1 X106.873 Y101.339 E3.22239
+G1 X106.722 Y101.960 E3.25314
+G1 X106.493 Y102.622 E3.28683
+G1 X106.181 Y103.291 E3.32235
+G1 X105.875 Y103.810 E3.35131
+G1 X105.442 Y104.407 E3.38677
+G1 X104.949 Y104.954 E3.42217
+G1 X104.477 Y105.384 E3.45292
+G1 X103.917 Y105.805 E3.48661
+G1 X103.285 Y106.184 E3.52206
+G1 X102.707 Y106.458 E3.55280
+G1 X102.048 Y106.696 E3.58650
+G1 X101.336 Y106.874 E3.62180
+G1 X100.606 Y106.976 E3.65726
+G1 X100.000 Y107.003 E3.68644
+G1 X99.394 Y106.976 E3.71561
+G1 X98.661 Y106.873 E3.75122
+G1 X98.040 Y106.722 E3.78196
+G1 X97.378 Y106.493 E3.81566
+G1 X96.710 Y106.181 E3.85110
+G1 X96.160 Y105.856 E3.88185
+G1 X95.594 Y105.443 E3.91555
+G1 X95.046 Y104.949 E3.95099
+G1 X94.616 Y104.477 E3.98174
+G1 X94.195 Y103.917 E4.01543
+G1 X93.816 Y103.285 E4.05088
+G1 X93.542 Y102.707 E4.08163
+G1 X93.324 Y102.105 E4.11241
+G1 X92.941 Y102.180 F7800.000
+G1 F1816
+G1 X92.747 Y101.410 E4.15061
+G1 X92.639 Y100.641 E4.18794
+G1 X92.611 Y100.000 E4.21881
+G1 X92.639 Y99.359 E4.24968
+G1 X92.748 Y98.588 E4.28714
+G1 X92.897 Y97.966 E4.31788
+G1 X93.149 Y97.232 E4.35521
+G1 X93.477 Y96.530 E4.39249
+G1 X93.822 Y95.947 E4.42504
+G1 X94.258 Y95.351 E4.46057
+G1 X94.776 Y94.776 E4.49780
+G1 X95.352 Y94.257 E4.53508
+G1 X95.897 Y93.856 E4.56763
+G1 X96.531 Y93.477 E4.60316
+G1 X97.232 Y93.149 E4.64039
+G1 X97.966 Y92.897 E4.67772
+G1 X98.588 Y92.748 E4.70846
+G1 X99.358 Y92.639 E4.74588
+G1 X100.034 Y92.612 E4.77842
+G1 X100.772 Y92.652 E4.81396
+G1 X101.538 Y92.773 E4.85127
+G1 X102.193 Y92.944 E4.88382
+G1 X102.886 Y93.199 E4.91935
+G1 X103.584 Y93.539 E4.95671
+G1 X104.129 Y93.873 E4.98745
+G1 X104.751 Y94.342 E5.02491
+G1 X105.224 Y94.775 E5.05574
+G1 X105.682 Y95.277 E5.08842
+G1 X106.125 Y95.868 E5.12395
+G1 X106.525 Y96.533 E5.16126
+G1 X106.814 Y97.144 E5.19381
+G1 X107.066 Y97.839 E5.22934
+G1 X107.253 Y98.590 E5.26657
+G1 X107.361 Y99.359 E5.30390
+G1 X107.389 Y100.000 E5.33477
+G1 X107.361 Y100.641 E5.36564
+G1 X107.253 Y101.412 E5.40306
+G1 X107.093 Y102.069 E5.43561
+G1 X106.851 Y102.767 E5.47114
+G1 X106.523 Y103.471 E5.50849
+G1 X106.198 Y104.022 E5.53924
+G1 X105.742 Y104.650 E5.57656
+G1 X105.223 Y105.226 E5.61385
+G1 X104.723 Y105.682 E5.64640
+G1 X104.132 Y106.125 E5.68193
+G1 X103.467 Y106.525 E5.71924
+G1 X102.856 Y106.814 E5.75179
+G1 X102.161 Y107.066 E5.78732
+G1 X101.410 Y107.253 E5.82455
+G1 X100.641 Y107.361 E5.86188
+G1 X100.000 Y107.389 E5.89275
+G1 X99.359 Y107.361 E5.92362
+G1 X98.588 Y107.253 E5.96104
+G1 X97.931 Y107.093 E5.99359
+G1 X97.233 Y106.851 E6.02912
+G1 X96.530 Y106.523 E6.06643
+G1 X95.947 Y106.178 E6.09898
+G1 X95.351 Y105.742 E6.13451
+G1 X94.774 Y105.223 E6.17183
+G1 X94.318 Y104.723 E6.20438
+G1 X93.875 Y104.132 E6.23991
+G1 X93.475 Y103.467 E6.27722
+G1 X93.186 Y102.856 E6.30977
+G1 X92.962 Y102.236 E6.34144
+G1 X92.579 Y102.311 F7800.000
+G1 F1800
+G1 X92.368 Y101.483 E6.38251
+G1 X92.255 Y100.677 E6.42170
+G1 X92.225 Y100.000 E6.45428
+G1 X92.255 Y99.323 E6.48685
+G1 X92.368 Y98.516 E6.52609
+G1 X92.526 Y97.858 E6.55861
+G1 X92.791 Y97.088 E6.59780
+G1 X93.136 Y96.349 E6.63697
+G1 X93.500 Y95.735 E6.67132
+G1 X93.958 Y95.107 E6.70869
+G1 X94.502 Y94.502 E6.74784
+G1 X95.108 Y93.957 E6.78702
+G1 X95.683 Y93.534 E6.82137
+G1 X96.350 Y93.135 E6.85874
+G1 X97.088 Y92.791 E6.89789
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00882
+G1 X100.037 Y92.226 E7.04317
+G1 X100.812 Y92.268 E7.08054
+G1 X101.617 Y92.395 E7.11973
+G1 X102.308 Y92.576 E7.15408
+G1 X103.038 Y92.843 E7.19144
+G1 X103.770 Y93.201 E7.23064
+G1 X104.347 Y93.554 E7.26317
+G1 X104.998 Y94.045 E7.30241
+G1 X105.497 Y94.502 E7.33497
+G1 X105.979 Y95.031 E7.36936
+G1 X106.445 Y95.652 E7.40673
+G1 X106.865 Y96.351 E7.44592
+G1 X107.171 Y96.996 E7.48027
+G1 X107.435 Y97.727 E7.51764
+G1 X107.632 Y98.517 E7.55679
+G1 X107.745 Y99.323 E7.59598
+G1 X107.775 Y100.000 E7.62855
+G1 X107.745 Y100.677 E7.66112
+G1 X107.632 Y101.484 E7.70035
+G1 X107.463 Y102.178 E7.73469
+G1 X107.209 Y102.912 E7.77206
+G1 X106.864 Y103.651 E7.81126
+G1 X106.521 Y104.234 E7.84379
+G1 X106.042 Y104.893 E7.88298
+G1 X105.497 Y105.498 E7.92215
+G1 X104.969 Y105.979 E7.95650
+G1 X104.348 Y106.445 E7.99387
+G1 X103.649 Y106.865 E8.03305
+G1 X103.004 Y107.171 E8.06740
+G1 X102.273 Y107.435 E8.10477
+G1 X101.483 Y107.632 E8.14392
+G1 X100.677 Y107.745 E8.18311
+G1 X100.000 Y107.775 E8.21569
+G1 X99.323 Y107.745 E8.24826
+G1 X98.516 Y107.632 E8.28748
+G1 X97.822 Y107.463 E8.32183
+G1 X97.088 Y107.209 E8.35920
+G1 X96.349 Y106.864 E8.39839
+G1 X95.735 Y106.500 E8.43273
+G1 X95.107 Y106.042 E8.47010
+G1 X94.502 Y105.497 E8.50929
+G1 X94.021 Y104.969 E8.54364
+G1 X93.555 Y104.348 E8.58101
+G1 X93.135 Y103.649 E8.62019
+G1 X92.829 Y103.004 E8.65454
+G1 X92.599 Y102.368 E8.68709
+G1 X92.851 Y102.018 F7800.000
+G1 X93.275 Y101.455
+G1 F1816
+G1 X98.310 Y106.491 E9.02957
+G1 X98.715 Y106.589 E9.04962
+G1 X99.421 Y106.688 E9.08387
+G1 X100.000 Y106.713 E9.11176
+G1 X100.579 Y106.688 E9.13966
+G1 X101.281 Y106.589 E9.17373
+G1 X101.964 Y106.419 E9.20759
+G1 X102.596 Y106.191 E9.23990
+G1 X103.148 Y105.929 E9.26930
+G1 X103.755 Y105.564 E9.30334
+G1 X104.292 Y105.161 E9.33566
+G1 X104.747 Y104.747 E9.36524
+G1 X95.253 Y95.253 E10.01097
+G1 X95.778 Y94.781 E10.04495
+G1 X96.271 Y94.418 E10.07434
+G1 X96.847 Y94.074 E10.10666
+G1 X97.485 Y93.776 E10.14052
+G1 X98.155 Y93.545 E10.17458
+G1 X98.714 Y93.411 E10.20221
+G1 X99.419 Y93.312 E10.23646
+G1 X100.029 Y93.287 E10.26586
+G1 X100.700 Y93.324 E10.29818
+G1 X101.399 Y93.435 E10.33222
+G1 X101.691 Y93.511 E10.34671
+G1 X106.725 Y98.545 E10.68910
+G1 X106.779 Y101.178 F7800.000
+G1 F1816
+G1 X94.712 Y104.411 E11.28996
+G1 X93.221 Y98.822 F7800.000
+G1 F1816
+G1 X105.288 Y95.589 E11.89082
+G1 X104.623 Y105.094 F7800.000
+G1 F1816
+G1 X106.465 Y98.221 E12.23309
+G1 X106.419 Y98.036 E12.24223
+G1 X106.191 Y97.404 E12.27455
+G1 X105.929 Y96.852 E12.30395
+G1 X105.564 Y96.245 E12.33799
+G1 X105.161 Y95.708 E12.37031
+G1 X104.746 Y95.252 E12.39997
+G1 X104.319 Y94.861 E12.42779
+G1 X103.749 Y94.431 E12.46212
+G1 X103.259 Y94.131 E12.48975
+G1 X102.622 Y93.820 E12.52388
+G1 X101.991 Y93.589 E12.55620
+G1 X101.736 Y93.522 E12.56888
+G1 X98.264 Y106.479 E13.21404
+G1 X97.487 Y106.225 E13.25339
+G1 X96.845 Y105.925 E13.28743
+G1 X96.319 Y105.614 E13.31683
+G1 X95.776 Y105.218 E13.34914
+G1 X95.250 Y104.744 E13.38319
+G1 X94.839 Y104.292 E13.41258
+G1 X94.436 Y103.755 E13.44490
+G1 X94.071 Y103.148 E13.47895
+G1 X93.809 Y102.596 E13.50834
+G1 X93.581 Y101.964 E13.54066
+G1 X93.535 Y101.779 E13.54980
+G1 X95.376 Y94.910 E13.89187
+G1 E11.89187 F2400.00000
+G92 E0
+G1 X143.801 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1816
+G1 X159.983 Y100.996 E2.77830
+G1 X159.983 Y114.004 E3.40391
+G1 X143.801 Y114.004 E4.18221
+G1 X143.801 Y101.056 E4.80494
+G1 X143.416 Y100.611 F7800.000
+G1 F1816
+G1 X160.369 Y100.611 E5.62033
+G1 X160.369 Y114.389 E6.28304
+G1 X143.416 Y114.389 E7.09843
+G1 X143.416 Y100.671 E7.75826
+G1 X143.030 Y100.225 F7800.000
+G1 F1800
+G1 X160.754 Y100.225 E8.61074
+G1 X160.754 Y114.775 E9.31055
+G1 X143.030 Y114.775 E10.16303
+G1 X143.030 Y100.285 E10.85995
+G1 X143.420 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1816
+G1 X144.183 Y113.715 E11.48748
+G1 X150.171 Y113.715 E11.77550
+G1 X153.502 Y101.285 E12.39438
+G1 X159.490 Y101.285 E12.68240
+G1 X156.113 Y113.888 E13.30993
+G1 X159.867 Y108.342 F7800.000
+G1 F1816
+G1 X143.917 Y112.616 E14.10416
+G1 X143.917 Y107.761 F7800.000
+G1 F1816
+G1 X149.871 Y113.715 E14.50914
+G1 X158.051 Y113.715 E14.90258
+G1 X145.622 Y101.285 E15.74800
+G1 X153.802 Y101.285 E16.14144
+G1 X159.867 Y107.351 E16.55400
+G1 X159.867 Y102.354 F7800.000
+G1 F1816
+G1 X143.917 Y106.628 E17.34823
+G1 Z4.550 F7800.000
+G1 E15.34823 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1815
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1815
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1815
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1815
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1815
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.058 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X93.127 Y101.340 E2.03567
+G1 X93.024 Y100.606 E2.07134
+G1 X92.997 Y100.000 E2.10051
+G1 X93.024 Y99.394 E2.12969
+G1 X93.126 Y98.664 E2.16515
+G1 X93.304 Y97.950 E2.20054
+G1 X93.520 Y97.345 E2.23142
+G1 X93.817 Y96.714 E2.26498
+G1 X94.197 Y96.081 E2.30050
+G1 X94.555 Y95.596 E2.32946
+G1 X95.049 Y95.049 E2.36493
+G1 X95.595 Y94.556 E2.40032
+G1 X96.113 Y94.176 E2.43120
+G1 X96.712 Y93.818 E2.46476
+G1 X97.377 Y93.507 E2.50007
+G1 X98.074 Y93.267 E2.53553
+G1 X98.660 Y93.127 E2.56449
+G1 X99.393 Y93.024 E2.60010
+G1 X100.034 Y92.998 E2.63097
+G1 X100.731 Y93.036 E2.66454
+G1 X101.460 Y93.151 E2.70005
+G1 X102.043 Y93.302 E2.72902
+G1 X102.736 Y93.554 E2.76448
+G1 X103.399 Y93.877 E2.79994
+G1 X103.912 Y94.192 E2.82891
+G1 X104.505 Y94.638 E2.86458
+G1 X104.949 Y95.045 E2.89354
+G1 X105.442 Y95.593 E2.92900
+G1 X105.875 Y96.190 E2.96447
+G1 X106.181 Y96.709 E2.99343
+G1 X106.493 Y97.377 E3.02889
+G1 X106.733 Y98.074 E3.06435
+G1 X106.873 Y98.660 E3.09332
+G1 X106.976 Y99.394 E3.12899
+G1 X107.003 Y100.000 E3.15816
+G1 X106.976 Y100.606 E3.18734
+G1 X106.874 Y101.336 E3.22280
+G1 X106.696 Y102.050 E3.25819
+G1 X106.480 Y102.655 E3.28907
+G1 X106.183 Y103.286 E3.32263
+G1 X105.803 Y103.919 E3.35815
+G1 X105.445 Y104.404 E3.38711
+G1 X104.951 Y104.951 E3.42257
+G1 X104.407 Y105.442 E3.45783
+G1 X103.810 Y105.875 E3.49329
+G1 X103.291 Y106.181 E3.52225
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59318
+G1 X101.340 Y106.873 E3.62214
+G1 X100.606 Y106.976 E3.65781
+G1 X100.000 Y107.003 E3.68699
+G1 X99.394 Y106.976 E3.71616
+G1 X98.664 Y106.874 E3.75162
+G1 X97.950 Y106.696 E3.78702
+G1 X97.345 Y106.480 E3.81789
+G1 X96.714 Y106.183 E3.85146
+G1 X96.081 Y105.803 E3.88697
+G1 X95.596 Y105.445 E3.91594
+G1 X95.049 Y104.951 E3.95140
+G1 X94.558 Y104.407 E3.98665
+G1 X94.126 Y103.811 E4.02204
+G1 X93.801 Y103.257 E4.05292
+G1 X93.508 Y102.624 E4.08649
+G1 X93.333 Y102.115 E4.11239
+G1 X92.948 Y102.184 F7800.000
+G1 F1815
+G1 X92.748 Y101.412 E4.15072
+G1 X92.639 Y100.641 E4.18818
+G1 X92.611 Y100.000 E4.21905
+G1 X92.639 Y99.359 E4.24993
+G1 X92.747 Y98.590 E4.28725
+G1 X92.935 Y97.838 E4.32453
+G1 X93.163 Y97.198 E4.35721
+G1 X93.476 Y96.532 E4.39261
+G1 X93.876 Y95.866 E4.42997
+G1 X94.256 Y95.352 E4.46072
+G1 X94.776 Y94.776 E4.49804
+G1 X95.352 Y94.257 E4.53532
+G1 X95.899 Y93.854 E4.56800
+G1 X96.531 Y93.477 E4.60340
+G1 X97.232 Y93.149 E4.64063
+G1 X97.966 Y92.897 E4.67796
+G1 X98.588 Y92.748 E4.70871
+G1 X99.358 Y92.639 E4.74612
+G1 X100.037 Y92.612 E4.77880
+G1 X100.772 Y92.652 E4.81420
+G1 X101.539 Y92.773 E4.85155
+G1 X102.158 Y92.933 E4.88230
+G1 X102.887 Y93.199 E4.91962
+G1 X103.584 Y93.539 E4.95695
+G1 X104.129 Y93.873 E4.98770
+G1 X104.751 Y94.342 E5.02515
+G1 X105.223 Y94.774 E5.05589
+G1 X105.742 Y95.350 E5.09322
+G1 X106.198 Y95.978 E5.13054
+G1 X106.523 Y96.529 E5.16129
+G1 X106.851 Y97.232 E5.19862
+G1 X107.103 Y97.966 E5.23594
+G1 X107.252 Y98.588 E5.26669
+G1 X107.361 Y99.359 E5.30414
+G1 X107.389 Y100.000 E5.33501
+G1 X107.361 Y100.641 E5.36589
+G1 X107.253 Y101.410 E5.40321
+G1 X107.065 Y102.162 E5.44050
+G1 X106.837 Y102.802 E5.47318
+G1 X106.524 Y103.468 E5.50858
+G1 X106.124 Y104.134 E5.54593
+G1 X105.744 Y104.648 E5.57668
+G1 X105.224 Y105.224 E5.61400
+G1 X104.650 Y105.742 E5.65120
+G1 X104.022 Y106.198 E5.68853
+G1 X103.471 Y106.523 E5.71927
+G1 X102.768 Y106.851 E5.75660
+G1 X102.034 Y107.103 E5.79392
+G1 X101.412 Y107.252 E5.82467
+G1 X100.641 Y107.361 E5.86212
+G1 X100.000 Y107.389 E5.89300
+G1 X99.359 Y107.361 E5.92387
+G1 X98.590 Y107.253 E5.96119
+G1 X97.838 Y107.065 E5.99848
+G1 X97.198 Y106.837 E6.03116
+G1 X96.532 Y106.524 E6.06656
+G1 X95.866 Y106.124 E6.10392
+G1 X95.352 Y105.744 E6.13466
+G1 X94.776 Y105.224 E6.17199
+G1 X94.258 Y104.650 E6.20918
+G1 X93.802 Y104.023 E6.24646
+G1 X93.459 Y103.436 E6.27914
+G1 X93.150 Y102.768 E6.31454
+G1 X92.968 Y102.241 E6.34140
+G1 X92.584 Y102.309 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34991
+G1 X92.368 Y101.484 E6.38244
+G1 X92.255 Y100.677 E6.42167
+G1 X92.225 Y100.000 E6.45425
+G1 X92.255 Y99.323 E6.48682
+G1 X92.368 Y98.517 E6.52601
+G1 X92.565 Y97.726 E6.56518
+G1 X92.806 Y97.051 E6.59966
+G1 X93.135 Y96.350 E6.63690
+G1 X93.555 Y95.652 E6.67610
+G1 X93.957 Y95.108 E6.70863
+G1 X94.502 Y94.502 E6.74781
+G1 X95.108 Y93.957 E6.78699
+G1 X95.685 Y93.533 E6.82147
+G1 X96.350 Y93.135 E6.85871
+G1 X97.088 Y92.791 E6.89786
+G1 X97.858 Y92.526 E6.93705
+G1 X98.516 Y92.368 E6.96957
+G1 X99.323 Y92.255 E7.00879
+G1 X100.039 Y92.226 E7.04328
+G1 X100.812 Y92.268 E7.08051
+G1 X101.617 Y92.395 E7.11971
+G1 X102.272 Y92.565 E7.15224
+G1 X103.038 Y92.843 E7.19143
+G1 X103.770 Y93.201 E7.23061
+G1 X104.347 Y93.554 E7.26314
+G1 X104.998 Y94.045 E7.30238
+G1 X105.497 Y94.502 E7.33491
+G1 X106.042 Y95.107 E7.37409
+G1 X106.521 Y95.766 E7.41328
+G1 X106.864 Y96.349 E7.44581
+G1 X107.209 Y97.088 E7.48500
+G1 X107.474 Y97.858 E7.52418
+G1 X107.632 Y98.516 E7.55671
+G1 X107.745 Y99.323 E7.59595
+G1 X107.775 Y100.000 E7.62852
+G1 X107.745 Y100.677 E7.66110
+G1 X107.632 Y101.483 E7.70028
+G1 X107.435 Y102.274 E7.73946
+G1 X107.194 Y102.949 E7.77394
+G1 X106.865 Y103.650 E7.81118
+G1 X106.445 Y104.348 E7.85038
+G1 X106.043 Y104.892 E7.88290
+G1 X105.498 Y105.498 E7.92209
+G1 X104.893 Y106.042 E7.96123
+G1 X104.234 Y106.521 E8.00042
+G1 X103.651 Y106.864 E8.03295
+G1 X102.912 Y107.209 E8.07213
+G1 X102.142 Y107.474 E8.11132
+G1 X101.484 Y107.632 E8.14385
+G1 X100.677 Y107.745 E8.18309
+G1 X100.000 Y107.775 E8.21566
+G1 X99.323 Y107.745 E8.24824
+G1 X98.517 Y107.632 E8.28742
+G1 X97.726 Y107.435 E8.32660
+G1 X97.051 Y107.194 E8.36108
+G1 X96.350 Y106.865 E8.39831
+G1 X95.652 Y106.445 E8.43751
+G1 X95.108 Y106.043 E8.47004
+G1 X94.502 Y105.498 E8.50923
+G1 X93.958 Y104.893 E8.54837
+G1 X93.479 Y104.234 E8.58754
+G1 X93.117 Y103.615 E8.62202
+G1 X92.792 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68706
+G1 X92.697 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1815
+G1 X98.306 Y106.487 E9.02943
+G1 X98.719 Y106.589 E9.04989
+G1 X99.421 Y106.688 E9.08396
+G1 X100.000 Y106.713 E9.11186
+G1 X100.579 Y106.688 E9.13976
+G1 X101.286 Y106.589 E9.17409
+G1 X101.845 Y106.455 E9.20172
+G1 X102.515 Y106.224 E9.23578
+G1 X103.157 Y105.925 E9.26985
+G1 X103.652 Y105.633 E9.29748
+G1 X104.224 Y105.217 E9.33154
+G1 X104.747 Y104.747 E9.36534
+G1 X95.253 Y95.253 E10.01106
+G1 X95.778 Y94.781 E10.04504
+G1 X96.273 Y94.417 E10.07456
+G1 X96.847 Y94.074 E10.10675
+G1 X97.485 Y93.776 E10.14061
+G1 X98.155 Y93.545 E10.17468
+G1 X98.714 Y93.411 E10.20231
+G1 X99.419 Y93.312 E10.23655
+G1 X100.032 Y93.287 E10.26608
+G1 X100.700 Y93.324 E10.29826
+G1 X101.401 Y93.435 E10.33240
+G1 X101.690 Y93.509 E10.34672
+G1 X106.727 Y98.547 E10.68937
+G1 X106.779 Y101.178 F7800.000
+G1 F1815
+G1 X94.717 Y104.410 E11.29001
+G1 X93.221 Y98.822 F7800.000
+G1 F1815
+G1 X105.283 Y95.590 E11.89065
+G1 X104.624 Y105.090 F7800.000
+G1 F1815
+G1 X106.468 Y98.210 E12.23322
+G1 X106.224 Y97.485 E12.27001
+G1 X105.925 Y96.843 E12.30408
+G1 X105.633 Y96.349 E12.33170
+G1 X105.217 Y95.776 E12.36577
+G1 X104.743 Y95.249 E12.39983
+G1 X104.319 Y94.861 E12.42746
+G1 X103.749 Y94.431 E12.46180
+G1 X103.259 Y94.131 E12.48942
+G1 X102.623 Y93.821 E12.52349
+G1 X101.957 Y93.579 E12.55755
+G1 X101.736 Y93.521 E12.56855
+G1 X98.265 Y106.476 E13.21362
+G1 X98.034 Y106.419 E13.22507
+G1 X97.456 Y106.212 E13.25459
+G1 X96.850 Y105.928 E13.28678
+G1 X96.241 Y105.562 E13.32091
+G1 X95.780 Y105.221 E13.34854
+G1 X95.253 Y104.747 E13.38261
+G1 X94.783 Y104.224 E13.41640
+G1 X94.368 Y103.653 E13.45038
+G1 X94.058 Y103.123 E13.47990
+G1 X93.776 Y102.516 E13.51209
+G1 X93.545 Y101.845 E13.54622
+G1 X93.532 Y101.790 E13.54896
+G1 X95.376 Y94.910 E13.89153
+G1 E11.89153 F2400.00000
+G92 E0
+G1 X144.006 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X160.188 Y100.996 E2.77830
+G1 X160.188 Y114.004 E3.40391
+G1 X144.006 Y114.004 E4.18221
+G1 X144.006 Y101.056 E4.80494
+G1 X143.621 Y100.611 F7800.000
+G1 F1815
+G1 X160.574 Y100.611 E5.62033
+G1 X160.574 Y114.389 E6.28304
+G1 X143.621 Y114.389 E7.09843
+G1 X143.621 Y100.671 E7.75826
+G1 X143.235 Y100.225 F7800.000
+G1 F1800
+G1 X160.960 Y100.225 E8.61074
+G1 X160.960 Y114.775 E9.31055
+G1 X143.235 Y114.775 E10.16303
+G1 X143.235 Y100.285 E10.85995
+G1 X143.625 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1815
+G1 X144.296 Y113.294 E11.46653
+G1 X144.296 Y113.715 E11.48677
+G1 X150.171 Y113.715 E11.76936
+G1 X153.502 Y101.285 E12.38825
+G1 X159.490 Y101.285 E12.67627
+G1 X156.113 Y113.888 E13.30379
+G1 X160.073 Y108.287 F7800.000
+G1 F1815
+G1 X144.122 Y112.561 E14.09803
+G1 X144.122 Y107.966 F7800.000
+G1 F1815
+G1 X149.871 Y113.715 E14.48904
+G1 X158.051 Y113.715 E14.88249
+G1 X145.622 Y101.285 E15.72790
+G1 X153.802 Y101.285 E16.12134
+G1 X160.073 Y107.556 E16.54786
+G1 X160.073 Y102.299 F7800.000
+G1 F1815
+G1 X144.122 Y106.573 E17.34209
+G1 Z4.850 F7800.000
+G1 E15.34209 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1815
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1815
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1815
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1815
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1815
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.058 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X93.127 Y101.340 E2.03567
+G1 X93.024 Y100.606 E2.07134
+G1 X92.997 Y100.002 E2.10044
+G1 X93.028 Y99.353 E2.13166
+G1 X93.126 Y98.665 E2.16509
+G1 X93.304 Y97.950 E2.20054
+G1 X93.521 Y97.343 E2.23155
+G1 X93.817 Y96.714 E2.26498
+G1 X94.197 Y96.081 E2.30050
+G1 X94.555 Y95.596 E2.32946
+G1 X95.049 Y95.049 E2.36493
+G1 X95.595 Y94.556 E2.40031
+G1 X96.115 Y94.174 E2.43132
+G1 X96.711 Y93.818 E2.46476
+G1 X97.377 Y93.507 E2.50007
+G1 X98.074 Y93.267 E2.53553
+G1 X98.660 Y93.127 E2.56449
+G1 X99.392 Y93.024 E2.60009
+G1 X100.037 Y92.998 E2.63110
+G1 X100.731 Y93.036 E2.66453
+G1 X101.460 Y93.151 E2.70005
+G1 X102.043 Y93.302 E2.72902
+G1 X102.736 Y93.554 E2.76448
+G1 X103.399 Y93.877 E2.79994
+G1 X103.912 Y94.192 E2.82890
+G1 X104.505 Y94.638 E2.86458
+G1 X104.949 Y95.045 E2.89354
+G1 X105.444 Y95.595 E2.92914
+G1 X105.826 Y96.115 E2.96015
+G1 X106.182 Y96.711 E2.99358
+G1 X106.494 Y97.379 E3.02903
+G1 X106.707 Y97.988 E3.06003
+G1 X106.874 Y98.663 E3.09347
+G1 X106.976 Y99.394 E3.12899
+G1 X107.003 Y99.998 E3.15809
+G1 X106.972 Y100.647 E3.18930
+G1 X106.874 Y101.335 E3.22274
+G1 X106.696 Y102.050 E3.25818
+G1 X106.479 Y102.657 E3.28919
+G1 X106.183 Y103.286 E3.32263
+G1 X105.803 Y103.919 E3.35815
+G1 X105.445 Y104.404 E3.38711
+G1 X104.951 Y104.951 E3.42257
+G1 X104.405 Y105.444 E3.45796
+G1 X103.885 Y105.826 E3.48897
+G1 X103.289 Y106.182 E3.52240
+G1 X102.621 Y106.494 E3.55785
+G1 X102.012 Y106.707 E3.58886
+G1 X101.337 Y106.874 E3.62229
+G1 X100.606 Y106.976 E3.65781
+G1 X100.002 Y107.003 E3.68691
+G1 X99.353 Y106.972 E3.71813
+G1 X98.665 Y106.874 E3.75156
+G1 X97.950 Y106.696 E3.78701
+G1 X97.343 Y106.479 E3.81801
+G1 X96.714 Y106.183 E3.85145
+G1 X96.081 Y105.803 E3.88697
+G1 X95.596 Y105.445 E3.91593
+G1 X95.049 Y104.951 E3.95140
+G1 X94.556 Y104.405 E3.98678
+G1 X94.174 Y103.885 E4.01779
+G1 X93.818 Y103.289 E4.05123
+G1 X93.507 Y102.623 E4.08654
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1815
+G1 X92.748 Y101.412 E4.15072
+G1 X92.639 Y100.641 E4.18817
+G1 X92.611 Y100.001 E4.21900
+G1 X92.643 Y99.317 E4.25194
+G1 X92.747 Y98.591 E4.28721
+G1 X92.935 Y97.838 E4.32453
+G1 X93.164 Y97.196 E4.35734
+G1 X93.476 Y96.532 E4.39261
+G1 X93.876 Y95.866 E4.42997
+G1 X94.256 Y95.352 E4.46071
+G1 X94.776 Y94.776 E4.49804
+G1 X95.352 Y94.257 E4.53532
+G1 X95.901 Y93.853 E4.56813
+G1 X96.531 Y93.477 E4.60340
+G1 X97.232 Y93.149 E4.64063
+G1 X97.966 Y92.897 E4.67795
+G1 X98.588 Y92.748 E4.70870
+G1 X99.358 Y92.639 E4.74611
+G1 X100.039 Y92.612 E4.77892
+G1 X100.772 Y92.652 E4.81419
+G1 X101.539 Y92.773 E4.85155
+G1 X102.158 Y92.933 E4.88230
+G1 X102.887 Y93.199 E4.91962
+G1 X103.584 Y93.539 E4.95695
+G1 X104.129 Y93.873 E4.98769
+G1 X104.751 Y94.342 E5.02514
+G1 X105.223 Y94.774 E5.05589
+G1 X105.743 Y95.352 E5.09330
+G1 X106.147 Y95.901 E5.12611
+G1 X106.523 Y96.531 E5.16138
+G1 X106.851 Y97.234 E5.19869
+G1 X107.077 Y97.878 E5.23151
+G1 X107.253 Y98.589 E5.26677
+G1 X107.361 Y99.359 E5.30413
+G1 X107.389 Y99.999 E5.33496
+G1 X107.357 Y100.683 E5.36790
+G1 X107.253 Y101.409 E5.40317
+G1 X107.065 Y102.162 E5.44049
+G1 X106.836 Y102.804 E5.47330
+G1 X106.524 Y103.468 E5.50857
+G1 X106.124 Y104.134 E5.54593
+G1 X105.744 Y104.648 E5.57667
+G1 X105.224 Y105.224 E5.61400
+G1 X104.648 Y105.743 E5.65128
+G1 X104.099 Y106.147 E5.68409
+G1 X103.469 Y106.523 E5.71936
+G1 X102.766 Y106.851 E5.75667
+G1 X102.122 Y107.077 E5.78949
+G1 X101.411 Y107.253 E5.82475
+G1 X100.641 Y107.361 E5.86211
+G1 X100.001 Y107.389 E5.89294
+G1 X99.317 Y107.357 E5.92588
+G1 X98.591 Y107.253 E5.96115
+G1 X97.838 Y107.065 E5.99847
+G1 X97.196 Y106.836 E6.03128
+G1 X96.532 Y106.524 E6.06655
+G1 X95.866 Y106.124 E6.10391
+G1 X95.352 Y105.744 E6.13465
+G1 X94.776 Y105.224 E6.17198
+G1 X94.257 Y104.648 E6.20926
+G1 X93.853 Y104.099 E6.24207
+G1 X93.477 Y103.469 E6.27734
+G1 X93.149 Y102.768 E6.31457
+G1 X92.968 Y102.241 E6.34139
+G1 X92.584 Y102.309 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34990
+G1 X92.368 Y101.484 E6.38243
+G1 X92.255 Y100.677 E6.42166
+G1 X92.225 Y100.000 E6.45422
+G1 X92.259 Y99.280 E6.48888
+G1 X92.368 Y98.517 E6.52599
+G1 X92.565 Y97.726 E6.56517
+G1 X92.808 Y97.049 E6.59979
+G1 X93.135 Y96.350 E6.63689
+G1 X93.555 Y95.652 E6.67609
+G1 X93.957 Y95.108 E6.70862
+G1 X94.502 Y94.502 E6.74781
+G1 X95.108 Y93.958 E6.78698
+G1 X95.688 Y93.531 E6.82159
+G1 X96.350 Y93.135 E6.85870
+G1 X97.088 Y92.791 E6.89785
+G1 X97.858 Y92.526 E6.93704
+G1 X98.516 Y92.368 E6.96956
+G1 X99.323 Y92.255 E7.00878
+G1 X100.042 Y92.226 E7.04340
+G1 X100.812 Y92.268 E7.08050
+G1 X101.617 Y92.395 E7.11970
+G1 X102.272 Y92.565 E7.15223
+G1 X103.038 Y92.843 E7.19142
+G1 X103.770 Y93.201 E7.23061
+G1 X104.347 Y93.554 E7.26313
+G1 X104.998 Y94.045 E7.30237
+G1 X105.497 Y94.502 E7.33490
+G1 X106.042 Y95.108 E7.37412
+G1 X106.469 Y95.688 E7.40873
+G1 X106.865 Y96.350 E7.44583
+G1 X107.209 Y97.088 E7.48502
+G1 X107.447 Y97.767 E7.51963
+G1 X107.632 Y98.516 E7.55674
+G1 X107.745 Y99.323 E7.59594
+G1 X107.775 Y100.000 E7.62850
+G1 X107.741 Y100.720 E7.66316
+G1 X107.632 Y101.483 E7.70026
+G1 X107.435 Y102.274 E7.73945
+G1 X107.192 Y102.951 E7.77406
+G1 X106.865 Y103.650 E7.81116
+G1 X106.445 Y104.348 E7.85037
+G1 X106.043 Y104.892 E7.88289
+G1 X105.498 Y105.498 E7.92208
+G1 X104.892 Y106.042 E7.96125
+G1 X104.312 Y106.469 E7.99587
+G1 X103.650 Y106.865 E8.03297
+G1 X102.912 Y107.209 E8.07215
+G1 X102.233 Y107.447 E8.10677
+G1 X101.484 Y107.632 E8.14387
+G1 X100.677 Y107.745 E8.18307
+G1 X100.000 Y107.775 E8.21563
+G1 X99.280 Y107.741 E8.25030
+G1 X98.517 Y107.632 E8.28740
+G1 X97.726 Y107.435 E8.32658
+G1 X97.049 Y107.192 E8.36120
+G1 X96.350 Y106.865 E8.39830
+G1 X95.652 Y106.445 E8.43750
+G1 X95.108 Y106.043 E8.47003
+G1 X94.502 Y105.498 E8.50922
+G1 X93.958 Y104.892 E8.54839
+G1 X93.531 Y104.312 E8.58300
+G1 X93.135 Y103.650 E8.62011
+G1 X92.791 Y102.912 E8.65926
+G1 X92.603 Y102.366 E8.68705
+G1 X92.697 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1815
+G1 X98.306 Y106.487 E9.02942
+G1 X98.721 Y106.590 E9.04996
+G1 X99.380 Y106.684 E9.08202
+G1 X100.002 Y106.713 E9.11194
+G1 X100.579 Y106.688 E9.13974
+G1 X101.282 Y106.589 E9.17388
+G1 X101.930 Y106.430 E9.20594
+G1 X102.511 Y106.226 E9.23560
+G1 X103.153 Y105.926 E9.26964
+G1 X103.725 Y105.584 E9.30170
+G1 X104.222 Y105.219 E9.33135
+G1 X104.747 Y104.747 E9.36532
+G1 X95.253 Y95.253 E10.01105
+G1 X95.778 Y94.781 E10.04502
+G1 X96.275 Y94.416 E10.07467
+G1 X96.847 Y94.074 E10.10673
+G1 X97.485 Y93.776 E10.14060
+G1 X98.155 Y93.545 E10.17467
+G1 X98.714 Y93.411 E10.20229
+G1 X99.419 Y93.312 E10.23653
+G1 X100.035 Y93.287 E10.26619
+G1 X100.700 Y93.324 E10.29825
+G1 X101.401 Y93.435 E10.33239
+G1 X101.690 Y93.509 E10.34671
+G1 X106.725 Y98.545 E10.68924
+G1 X106.780 Y101.178 F7800.000
+G1 F1815
+G1 X94.717 Y104.410 E11.28991
+G1 X93.220 Y98.822 F7800.000
+G1 F1815
+G1 X105.283 Y95.590 E11.89057
+G1 X104.624 Y105.090 F7800.000
+G1 F1815
+G1 X106.466 Y98.218 E12.23277
+G1 X106.226 Y97.489 E12.26970
+G1 X105.926 Y96.847 E12.30374
+G1 X105.584 Y96.275 E12.33580
+G1 X105.219 Y95.778 E12.36545
+G1 X104.743 Y95.249 E12.39969
+G1 X104.319 Y94.861 E12.42732
+G1 X103.749 Y94.431 E12.46166
+G1 X103.259 Y94.131 E12.48928
+G1 X102.623 Y93.821 E12.52335
+G1 X101.957 Y93.579 E12.55741
+G1 X101.736 Y93.521 E12.56841
+G1 X98.265 Y106.476 E13.21348
+G1 X98.034 Y106.419 E13.22492
+G1 X97.453 Y106.211 E13.25458
+G1 X96.850 Y105.928 E13.28663
+G1 X96.241 Y105.562 E13.32077
+G1 X95.780 Y105.221 E13.34840
+G1 X95.253 Y104.747 E13.38247
+G1 X94.781 Y104.222 E13.41644
+G1 X94.416 Y103.725 E13.44609
+G1 X94.074 Y103.153 E13.47815
+G1 X93.776 Y102.515 E13.51202
+G1 X93.545 Y101.845 E13.54608
+G1 X93.532 Y101.790 E13.54882
+G1 X95.376 Y94.910 E13.89139
+G1 E11.89139 F2400.00000
+G92 E0
+G1 X144.212 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X160.394 Y100.996 E2.77830
+G1 X160.394 Y114.004 E3.40391
+G1 X144.212 Y114.004 E4.18221
+G1 X144.212 Y101.056 E4.80494
+G1 X143.826 Y100.611 F7800.000
+G1 F1815
+G1 X160.779 Y100.611 E5.62033
+G1 X160.779 Y114.389 E6.28304
+G1 X143.826 Y114.389 E7.09843
+G1 X143.826 Y100.671 E7.75826
+G1 X143.440 Y100.225 F7800.000
+G1 F1800
+G1 X161.165 Y100.225 E8.61074
+G1 X161.165 Y114.775 E9.31055
+G1 X143.440 Y114.775 E10.16303
+G1 X143.440 Y100.285 E10.85995
+G1 X143.830 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1815
+G1 X144.501 Y112.528 E11.42839
+G1 X144.501 Y113.715 E11.48547
+G1 X150.171 Y113.715 E11.75819
+G1 X153.502 Y101.285 E12.37708
+G1 X159.490 Y101.285 E12.66510
+G1 X156.113 Y113.888 E13.29262
+G1 X160.278 Y108.232 F7800.000
+G1 F1815
+G1 X144.327 Y112.506 E14.08686
+G1 X144.327 Y108.171 F7800.000
+G1 F1815
+G1 X149.871 Y113.715 E14.46391
+G1 X158.051 Y113.715 E14.85735
+G1 X145.622 Y101.285 E15.70277
+G1 X153.802 Y101.285 E16.09621
+G1 X160.278 Y107.761 E16.53669
+G1 X160.278 Y102.244 F7800.000
+G1 F1815
+G1 X144.327 Y106.518 E17.33092
+G1 Z5.150 F7800.000
+G1 E15.33092 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1815
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1815
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1815
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1815
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1815
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.304 Y102.049 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X93.126 Y101.336 E2.03535
+G1 X93.024 Y100.606 E2.07082
+G1 X92.997 Y100.000 E2.09999
+G1 X93.024 Y99.394 E2.12916
+G1 X93.127 Y98.660 E2.16483
+G1 X93.267 Y98.074 E2.19380
+G1 X93.507 Y97.377 E2.22926
+G1 X93.818 Y96.710 E2.26464
+G1 X94.149 Y96.153 E2.29578
+G1 X94.557 Y95.594 E2.32909
+G1 X95.049 Y95.049 E2.36440
+G1 X95.595 Y94.556 E2.39978
+G1 X96.117 Y94.173 E2.43092
+G1 X96.711 Y93.818 E2.46423
+G1 X97.377 Y93.507 E2.49954
+G1 X98.074 Y93.267 E2.53500
+G1 X98.660 Y93.127 E2.56397
+G1 X99.392 Y93.024 E2.59956
+G1 X100.039 Y92.998 E2.63070
+G1 X100.731 Y93.036 E2.66400
+G1 X101.459 Y93.151 E2.69945
+G1 X102.085 Y93.315 E2.73059
+G1 X102.735 Y93.554 E2.76389
+G1 X103.399 Y93.877 E2.79941
+G1 X103.915 Y94.194 E2.82851
+G1 X104.437 Y94.583 E2.85986
+G1 X104.951 Y95.048 E2.89316
+G1 X105.445 Y95.596 E2.92869
+G1 X105.803 Y96.081 E2.95765
+G1 X106.184 Y96.715 E2.99324
+G1 X106.461 Y97.300 E3.02438
+G1 X106.696 Y97.951 E3.05768
+G1 X106.874 Y98.664 E3.09300
+G1 X106.976 Y99.394 E3.12846
+G1 X107.003 Y100.000 E3.15763
+G1 X106.976 Y100.606 E3.18681
+G1 X106.873 Y101.340 E3.22248
+G1 X106.733 Y101.926 E3.25144
+G1 X106.493 Y102.623 E3.28691
+G1 X106.181 Y103.291 E3.32237
+G1 X105.875 Y103.810 E3.35133
+G1 X105.442 Y104.407 E3.38679
+G1 X104.951 Y104.951 E3.42205
+G1 X104.404 Y105.445 E3.45751
+G1 X103.919 Y105.803 E3.48647
+G1 X103.285 Y106.184 E3.52207
+G1 X102.700 Y106.461 E3.55320
+G1 X102.049 Y106.696 E3.58651
+G1 X101.336 Y106.874 E3.62182
+G1 X100.606 Y106.976 E3.65729
+G1 X100.000 Y107.003 E3.68646
+G1 X99.394 Y106.976 E3.71563
+G1 X98.660 Y106.873 E3.75130
+G1 X98.074 Y106.733 E3.78027
+G1 X97.377 Y106.493 E3.81573
+G1 X96.710 Y106.182 E3.85111
+G1 X96.153 Y105.851 E3.88225
+G1 X95.594 Y105.443 E3.91556
+G1 X95.047 Y104.950 E3.95100
+G1 X94.611 Y104.471 E3.98214
+G1 X94.195 Y103.917 E4.01544
+G1 X93.816 Y103.285 E4.05089
+G1 X93.539 Y102.700 E4.08203
+G1 X93.325 Y102.106 E4.11241
+G1 X92.941 Y102.180 F7800.000
+G1 F1815
+G1 X92.747 Y101.410 E4.15062
+G1 X92.639 Y100.641 E4.18795
+G1 X92.611 Y100.000 E4.21882
+G1 X92.639 Y99.359 E4.24970
+G1 X92.748 Y98.588 E4.28715
+G1 X92.897 Y97.966 E4.31790
+G1 X93.149 Y97.232 E4.35522
+G1 X93.477 Y96.530 E4.39250
+G1 X93.827 Y95.941 E4.42544
+G1 X94.257 Y95.351 E4.46058
+G1 X94.776 Y94.776 E4.49781
+G1 X95.351 Y94.257 E4.53509
+G1 X95.903 Y93.851 E4.56803
+G1 X96.531 Y93.477 E4.60317
+G1 X97.232 Y93.149 E4.64041
+G1 X97.966 Y92.897 E4.67773
+G1 X98.588 Y92.748 E4.70848
+G1 X99.358 Y92.639 E4.74588
+G1 X100.042 Y92.612 E4.77882
+G1 X100.772 Y92.652 E4.81396
+G1 X101.538 Y92.773 E4.85128
+G1 X102.200 Y92.947 E4.88422
+G1 X102.886 Y93.198 E4.91936
+G1 X103.584 Y93.539 E4.95672
+G1 X104.131 Y93.874 E4.98755
+G1 X104.682 Y94.285 E5.02062
+G1 X105.224 Y94.775 E5.05576
+G1 X105.744 Y95.352 E5.09312
+G1 X106.124 Y95.866 E5.12386
+G1 X106.525 Y96.533 E5.16127
+G1 X106.817 Y97.152 E5.19421
+G1 X107.066 Y97.839 E5.22935
+G1 X107.253 Y98.590 E5.26658
+G1 X107.361 Y99.359 E5.30391
+G1 X107.389 Y100.000 E5.33478
+G1 X107.361 Y100.641 E5.36566
+G1 X107.252 Y101.412 E5.40311
+G1 X107.103 Y102.034 E5.43386
+G1 X106.851 Y102.768 E5.47118
+G1 X106.523 Y103.471 E5.50851
+G1 X106.198 Y104.022 E5.53925
+G1 X105.742 Y104.650 E5.57658
+G1 X105.224 Y105.224 E5.61377
+G1 X104.648 Y105.744 E5.65110
+G1 X104.134 Y106.124 E5.68185
+G1 X103.467 Y106.525 E5.71925
+G1 X102.848 Y106.817 E5.75219
+G1 X102.161 Y107.066 E5.78733
+G1 X101.410 Y107.253 E5.82457
+G1 X100.641 Y107.361 E5.86189
+G1 X100.000 Y107.389 E5.89276
+G1 X99.359 Y107.361 E5.92364
+G1 X98.588 Y107.252 E5.96109
+G1 X97.966 Y107.103 E5.99184
+G1 X97.232 Y106.851 E6.02916
+G1 X96.530 Y106.523 E6.06644
+G1 X95.941 Y106.173 E6.09938
+G1 X95.351 Y105.743 E6.13452
+G1 X94.774 Y105.223 E6.17184
+G1 X94.313 Y104.717 E6.20478
+G1 X93.875 Y104.132 E6.23992
+G1 X93.475 Y103.467 E6.27723
+G1 X93.183 Y102.848 E6.31017
+G1 X92.962 Y102.237 E6.34144
+G1 X92.579 Y102.311 F7800.000
+G1 F1800
+G1 X92.368 Y101.483 E6.38252
+G1 X92.255 Y100.677 E6.42171
+G1 X92.225 Y100.000 E6.45428
+G1 X92.255 Y99.323 E6.48686
+G1 X92.368 Y98.516 E6.52609
+G1 X92.526 Y97.858 E6.55862
+G1 X92.791 Y97.088 E6.59781
+G1 X93.136 Y96.349 E6.63698
+G1 X93.504 Y95.728 E6.67173
+G1 X93.958 Y95.107 E6.70870
+G1 X94.502 Y94.502 E6.74785
+G1 X95.108 Y93.958 E6.78702
+G1 X95.690 Y93.530 E6.82177
+G1 X96.350 Y93.135 E6.85874
+G1 X97.088 Y92.791 E6.89789
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00883
+G1 X100.045 Y92.226 E7.04358
+G1 X100.812 Y92.268 E7.08054
+G1 X101.617 Y92.395 E7.11973
+G1 X102.316 Y92.578 E7.15448
+G1 X103.038 Y92.843 E7.19145
+G1 X103.770 Y93.201 E7.23065
+G1 X104.347 Y93.554 E7.26321
+G1 X104.927 Y93.986 E7.29800
+G1 X105.497 Y94.502 E7.33497
+G1 X106.043 Y95.108 E7.37417
+G1 X106.445 Y95.652 E7.40670
+G1 X106.865 Y96.351 E7.44592
+G1 X107.174 Y97.004 E7.48067
+G1 X107.435 Y97.727 E7.51764
+G1 X107.632 Y98.517 E7.55679
+G1 X107.745 Y99.323 E7.59598
+G1 X107.775 Y100.000 E7.62856
+G1 X107.745 Y100.677 E7.66113
+G1 X107.632 Y101.484 E7.70037
+G1 X107.474 Y102.142 E7.73289
+G1 X107.209 Y102.912 E7.77208
+G1 X106.864 Y103.651 E7.81127
+G1 X106.521 Y104.234 E7.84380
+G1 X106.042 Y104.893 E7.88298
+G1 X105.498 Y105.498 E7.92212
+G1 X104.892 Y106.043 E7.96131
+G1 X104.348 Y106.445 E7.99384
+G1 X103.649 Y106.865 E8.03306
+G1 X102.996 Y107.174 E8.06781
+G1 X102.273 Y107.435 E8.10478
+G1 X101.483 Y107.632 E8.14393
+G1 X100.677 Y107.745 E8.18312
+G1 X100.000 Y107.775 E8.21569
+G1 X99.323 Y107.745 E8.24827
+G1 X98.516 Y107.632 E8.28750
+G1 X97.858 Y107.474 E8.32003
+G1 X97.088 Y107.209 E8.35922
+G1 X96.349 Y106.864 E8.39839
+G1 X95.728 Y106.496 E8.43314
+G1 X95.107 Y106.042 E8.47011
+G1 X94.502 Y105.497 E8.50929
+G1 X94.016 Y104.963 E8.54404
+G1 X93.555 Y104.348 E8.58101
+G1 X93.135 Y103.649 E8.62020
+G1 X92.826 Y102.996 E8.65494
+G1 X92.599 Y102.368 E8.68709
+G1 X92.851 Y102.018 F7800.000
+G1 X93.275 Y101.455
+G1 F1815
+G1 X98.312 Y106.492 E9.02969
+G1 X98.714 Y106.589 E9.04955
+G1 X99.421 Y106.688 E9.08389
+G1 X100.000 Y106.713 E9.11179
+G1 X100.579 Y106.688 E9.13968
+G1 X101.281 Y106.589 E9.17375
+G1 X101.964 Y106.419 E9.20762
+G1 X102.589 Y106.194 E9.23955
+G1 X103.148 Y105.929 E9.26934
+G1 X103.759 Y105.562 E9.30357
+G1 X104.220 Y105.221 E9.33120
+G1 X104.747 Y104.747 E9.36526
+G1 X95.253 Y95.253 E10.01099
+G1 X95.778 Y94.781 E10.04495
+G1 X96.277 Y94.414 E10.07474
+G1 X96.847 Y94.074 E10.10667
+G1 X97.485 Y93.776 E10.14054
+G1 X98.155 Y93.545 E10.17461
+G1 X98.714 Y93.411 E10.20223
+G1 X99.418 Y93.312 E10.23647
+G1 X100.037 Y93.287 E10.26625
+G1 X100.700 Y93.324 E10.29818
+G1 X101.399 Y93.434 E10.33223
+G1 X101.691 Y93.511 E10.34675
+G1 X106.725 Y98.545 E10.68912
+G1 X106.779 Y101.178 F7800.000
+G1 F1815
+G1 X94.713 Y104.411 E11.28996
+G1 X93.221 Y98.822 F7800.000
+G1 F1815
+G1 X105.283 Y95.590 E11.89060
+G1 X104.624 Y105.090 F7800.000
+G1 F1815
+G1 X106.465 Y98.221 E12.23266
+G1 X106.419 Y98.036 E12.24182
+G1 X106.194 Y97.411 E12.27375
+G1 X105.929 Y96.852 E12.30354
+G1 X105.562 Y96.241 E12.33777
+G1 X105.221 Y95.780 E12.36540
+G1 X104.746 Y95.252 E12.39954
+G1 X104.253 Y94.807 E12.43147
+G1 X103.752 Y94.433 E12.46153
+G1 X103.259 Y94.131 E12.48932
+G1 X102.621 Y93.820 E12.52347
+G1 X101.998 Y93.591 E12.55540
+G1 X101.736 Y93.523 E12.56845
+G1 X98.264 Y106.481 E13.21367
+G1 X97.485 Y106.224 E13.25308
+G1 X96.845 Y105.926 E13.28705
+G1 X96.313 Y105.610 E13.31683
+G1 X95.777 Y105.218 E13.34876
+G1 X95.251 Y104.744 E13.38281
+G1 X94.834 Y104.286 E13.41259
+G1 X94.436 Y103.755 E13.44452
+G1 X94.071 Y103.148 E13.47856
+G1 X93.806 Y102.589 E13.50835
+G1 X93.581 Y101.964 E13.54028
+G1 X93.535 Y101.779 E13.54944
+G1 X95.376 Y94.910 E13.89150
+G1 E11.89150 F2400.00000
+G92 E0
+G1 X144.417 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1815
+G1 X160.599 Y100.996 E2.77830
+G1 X160.599 Y114.004 E3.40391
+G1 X144.417 Y114.004 E4.18221
+G1 X144.417 Y101.056 E4.80494
+G1 X144.031 Y100.611 F7800.000
+G1 F1815
+G1 X160.984 Y100.611 E5.62033
+G1 X160.984 Y114.389 E6.28304
+G1 X144.031 Y114.389 E7.09843
+G1 X144.031 Y100.671 E7.75826
+G1 X143.646 Y100.225 F7800.000
+G1 F1800
+G1 X161.370 Y100.225 E8.61074
+G1 X161.370 Y114.775 E9.31055
+G1 X143.646 Y114.775 E10.16303
+G1 X143.646 Y100.285 E10.85995
+G1 X144.035 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1815
+G1 X144.706 Y111.762 E11.39025
+G1 X144.706 Y113.715 E11.48417
+G1 X150.171 Y113.715 E11.74702
+G1 X153.502 Y101.285 E12.36591
+G1 X159.490 Y101.285 E12.65393
+G1 X156.113 Y113.888 E13.28145
+G1 X160.483 Y108.177 F7800.000
+G1 F1815
+G1 X144.533 Y112.451 E14.07569
+G1 X144.533 Y108.376 F7800.000
+G1 F1815
+G1 X149.871 Y113.715 E14.43878
+G1 X158.051 Y113.715 E14.83222
+G1 X145.622 Y101.285 E15.67764
+G1 X153.802 Y101.285 E16.07108
+G1 X160.483 Y107.967 E16.52552
+G1 X160.483 Y102.189 F7800.000
+G1 F1815
+G1 X144.533 Y106.463 E17.31975
+G1 Z5.450 F7800.000
+G1 E15.31975 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1813
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1813
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1813
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1813
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1813
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.308 Y102.056 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X93.126 Y101.337 E2.03563
+G1 X93.024 Y100.606 E2.07116
+G1 X92.997 Y100.000 E2.10034
+G1 X93.024 Y99.394 E2.12951
+G1 X93.126 Y98.664 E2.16497
+G1 X93.304 Y97.950 E2.20035
+G1 X93.523 Y97.338 E2.23162
+G1 X93.817 Y96.714 E2.26479
+G1 X94.196 Y96.082 E2.30024
+G1 X94.585 Y95.561 E2.33151
+G1 X95.048 Y95.049 E2.36468
+G1 X95.595 Y94.556 E2.40013
+G1 X96.119 Y94.171 E2.43139
+G1 X96.711 Y93.818 E2.46457
+G1 X97.377 Y93.507 E2.49989
+G1 X98.074 Y93.267 E2.53535
+G1 X98.660 Y93.127 E2.56431
+G1 X99.392 Y93.024 E2.59990
+G1 X100.042 Y92.998 E2.63117
+G1 X100.731 Y93.036 E2.66434
+G1 X101.458 Y93.151 E2.69979
+G1 X102.087 Y93.316 E2.73106
+G1 X102.735 Y93.554 E2.76423
+G1 X103.399 Y93.877 E2.79976
+G1 X103.914 Y94.194 E2.82885
+G1 X104.439 Y94.585 E2.86033
+G1 X104.951 Y95.048 E2.89350
+G1 X105.442 Y95.593 E2.92882
+G1 X105.874 Y96.188 E2.96420
+G1 X106.202 Y96.750 E2.99547
+G1 X106.492 Y97.376 E3.02864
+G1 X106.733 Y98.074 E3.06417
+G1 X106.873 Y98.660 E3.09314
+G1 X106.976 Y99.394 E3.12881
+G1 X107.003 Y100.000 E3.15798
+G1 X106.976 Y100.606 E3.18715
+G1 X106.874 Y101.336 E3.22262
+G1 X106.696 Y102.050 E3.25800
+G1 X106.477 Y102.662 E3.28926
+G1 X106.183 Y103.286 E3.32244
+G1 X105.803 Y103.919 E3.35797
+G1 X105.445 Y104.404 E3.38693
+G1 X104.951 Y104.951 E3.42239
+G1 X104.407 Y105.442 E3.45765
+G1 X103.810 Y105.875 E3.49311
+G1 X103.291 Y106.181 E3.52207
+G1 X102.621 Y106.494 E3.55766
+G1 X102.007 Y106.709 E3.58893
+G1 X101.337 Y106.874 E3.62210
+G1 X100.606 Y106.976 E3.65763
+G1 X100.000 Y107.003 E3.68680
+G1 X99.394 Y106.976 E3.71598
+G1 X98.664 Y106.874 E3.75144
+G1 X97.950 Y106.696 E3.78682
+G1 X97.338 Y106.477 E3.81809
+G1 X96.714 Y106.183 E3.85126
+G1 X96.081 Y105.803 E3.88679
+G1 X95.596 Y105.445 E3.91575
+G1 X95.049 Y104.951 E3.95122
+G1 X94.556 Y104.405 E3.98660
+G1 X94.171 Y103.881 E4.01786
+G1 X93.818 Y103.289 E4.05104
+G1 X93.506 Y102.621 E4.08648
+G1 X93.328 Y102.112 E4.11240
+G1 X92.945 Y102.183 F7800.000
+G1 F1813
+G1 X92.747 Y101.411 E4.15074
+G1 X92.639 Y100.641 E4.18811
+G1 X92.611 Y100.000 E4.21898
+G1 X92.639 Y99.359 E4.24986
+G1 X92.747 Y98.590 E4.28718
+G1 X92.935 Y97.838 E4.32445
+G1 X93.166 Y97.191 E4.35753
+G1 X93.476 Y96.532 E4.39254
+G1 X93.875 Y95.867 E4.42985
+G1 X94.286 Y95.316 E4.46293
+G1 X94.775 Y94.776 E4.49793
+G1 X95.351 Y94.257 E4.53525
+G1 X95.906 Y93.850 E4.56832
+G1 X96.531 Y93.477 E4.60333
+G1 X97.232 Y93.149 E4.64056
+G1 X97.966 Y92.897 E4.67789
+G1 X98.588 Y92.748 E4.70863
+G1 X99.358 Y92.639 E4.74604
+G1 X100.045 Y92.612 E4.77911
+G1 X100.771 Y92.652 E4.81412
+G1 X101.538 Y92.773 E4.85143
+G1 X102.203 Y92.948 E4.88451
+G1 X102.886 Y93.198 E4.91951
+G1 X103.584 Y93.539 E4.95688
+G1 X104.131 Y93.874 E4.98770
+G1 X104.684 Y94.286 E5.02090
+G1 X105.224 Y94.775 E5.05591
+G1 X105.742 Y95.350 E5.09315
+G1 X106.198 Y95.977 E5.13042
+G1 X106.544 Y96.571 E5.16350
+G1 X106.850 Y97.231 E5.19850
+G1 X107.103 Y97.966 E5.23587
+G1 X107.252 Y98.588 E5.26661
+G1 X107.361 Y99.359 E5.30407
+G1 X107.389 Y100.000 E5.33494
+G1 X107.361 Y100.641 E5.36581
+G1 X107.253 Y101.410 E5.40314
+G1 X107.065 Y102.162 E5.44041
+G1 X106.834 Y102.809 E5.47349
+G1 X106.524 Y103.468 E5.50849
+G1 X106.124 Y104.134 E5.54586
+G1 X105.744 Y104.648 E5.57661
+G1 X105.224 Y105.224 E5.61393
+G1 X104.650 Y105.742 E5.65113
+G1 X104.022 Y106.198 E5.68845
+G1 X103.471 Y106.523 E5.71920
+G1 X102.766 Y106.851 E5.75660
+G1 X102.117 Y107.079 E5.78968
+G1 X101.411 Y107.253 E5.82468
+G1 X100.641 Y107.361 E5.86205
+G1 X100.000 Y107.389 E5.89292
+G1 X99.359 Y107.361 E5.92380
+G1 X98.590 Y107.253 E5.96112
+G1 X97.838 Y107.065 E5.99839
+G1 X97.191 Y106.834 E6.03147
+G1 X96.532 Y106.524 E6.06648
+G1 X95.866 Y106.124 E6.10384
+G1 X95.352 Y105.744 E6.13459
+G1 X94.776 Y105.224 E6.17191
+G1 X94.257 Y104.649 E6.20919
+G1 X93.850 Y104.094 E6.24226
+G1 X93.477 Y103.469 E6.27727
+G1 X93.149 Y102.766 E6.31458
+G1 X92.964 Y102.240 E6.34142
+G1 X92.581 Y102.311 F7800.000
+G1 F1800
+G1 X92.368 Y101.484 E6.38247
+G1 X92.255 Y100.677 E6.42168
+G1 X92.225 Y100.000 E6.45425
+G1 X92.255 Y99.323 E6.48683
+G1 X92.368 Y98.517 E6.52601
+G1 X92.565 Y97.726 E6.56518
+G1 X92.810 Y97.044 E6.60007
+G1 X93.135 Y96.350 E6.63690
+G1 X93.555 Y95.652 E6.67609
+G1 X93.988 Y95.070 E6.71097
+G1 X94.502 Y94.503 E6.74780
+G1 X95.108 Y93.958 E6.78699
+G1 X95.692 Y93.528 E6.82187
+G1 X96.350 Y93.135 E6.85871
+G1 X97.088 Y92.791 E6.89786
+G1 X97.858 Y92.526 E6.93705
+G1 X98.516 Y92.368 E6.96958
+G1 X99.323 Y92.255 E7.00879
+G1 X100.048 Y92.226 E7.04368
+G1 X100.812 Y92.268 E7.08051
+G1 X101.617 Y92.395 E7.11970
+G1 X102.319 Y92.579 E7.15458
+G1 X103.038 Y92.843 E7.19142
+G1 X103.770 Y93.201 E7.23062
+G1 X104.347 Y93.554 E7.26318
+G1 X104.930 Y93.988 E7.29810
+G1 X105.497 Y94.502 E7.33494
+G1 X106.042 Y95.107 E7.37410
+G1 X106.521 Y95.766 E7.41327
+G1 X106.887 Y96.392 E7.44815
+G1 X107.208 Y97.087 E7.48498
+G1 X107.474 Y97.858 E7.52419
+G1 X107.632 Y98.516 E7.55671
+G1 X107.745 Y99.323 E7.59595
+G1 X107.775 Y100.000 E7.62852
+G1 X107.745 Y100.677 E7.66110
+G1 X107.632 Y101.483 E7.70029
+G1 X107.435 Y102.274 E7.73946
+G1 X107.190 Y102.956 E7.77434
+G1 X106.865 Y103.650 E7.81118
+G1 X106.445 Y104.348 E7.85038
+G1 X106.043 Y104.892 E7.88291
+G1 X105.498 Y105.498 E7.92209
+G1 X104.893 Y106.042 E7.96123
+G1 X104.234 Y106.521 E8.00042
+G1 X103.651 Y106.864 E8.03295
+G1 X102.912 Y107.209 E8.07217
+G1 X102.227 Y107.449 E8.10705
+G1 X101.484 Y107.632 E8.14389
+G1 X100.677 Y107.745 E8.18309
+G1 X100.000 Y107.775 E8.21566
+G1 X99.323 Y107.745 E8.24824
+G1 X98.517 Y107.632 E8.28743
+G1 X97.726 Y107.435 E8.32659
+G1 X97.044 Y107.190 E8.36148
+G1 X96.350 Y106.865 E8.39831
+G1 X95.652 Y106.445 E8.43752
+G1 X95.108 Y106.043 E8.47004
+G1 X94.502 Y105.498 E8.50923
+G1 X93.958 Y104.892 E8.54840
+G1 X93.528 Y104.308 E8.58328
+G1 X93.135 Y103.650 E8.62012
+G1 X92.791 Y102.912 E8.65930
+G1 X92.600 Y102.367 E8.68706
+G1 X92.853 Y102.018 F7800.000
+G1 X93.274 Y101.455
+G1 F1813
+G1 X98.306 Y106.487 E9.02932
+G1 X98.719 Y106.589 E9.04979
+G1 X99.421 Y106.688 E9.08385
+G1 X100.000 Y106.713 E9.11175
+G1 X100.579 Y106.688 E9.13965
+G1 X101.283 Y106.589 E9.17380
+G1 X101.925 Y106.431 E9.20560
+G1 X102.512 Y106.225 E9.23551
+G1 X103.157 Y105.925 E9.26974
+G1 X103.652 Y105.633 E9.29737
+G1 X104.224 Y105.217 E9.33143
+G1 X104.747 Y104.747 E9.36523
+G1 X95.253 Y95.253 E10.01095
+G1 X95.778 Y94.781 E10.04491
+G1 X96.279 Y94.413 E10.07482
+G1 X96.847 Y94.074 E10.10662
+G1 X97.485 Y93.776 E10.14050
+G1 X98.155 Y93.545 E10.17457
+G1 X98.714 Y93.411 E10.20220
+G1 X99.418 Y93.312 E10.23642
+G1 X100.040 Y93.287 E10.26634
+G1 X100.700 Y93.324 E10.29814
+G1 X101.399 Y93.434 E10.33218
+G1 X101.691 Y93.511 E10.34672
+G1 X106.727 Y98.547 E10.68925
+G1 X106.779 Y101.178 F7800.000
+G1 F1813
+G1 X94.717 Y104.410 E11.28988
+G1 X93.221 Y98.822 F7800.000
+G1 F1813
+G1 X105.283 Y95.590 E11.89052
+G1 X104.624 Y105.090 F7800.000
+G1 F1813
+G1 X106.468 Y98.210 E12.23309
+G1 X106.223 Y97.484 E12.26997
+G1 X105.946 Y96.884 E12.30177
+G1 X105.632 Y96.347 E12.33168
+G1 X105.217 Y95.775 E12.36564
+G1 X104.745 Y95.252 E12.39952
+G1 X104.255 Y94.808 E12.43132
+G1 X103.752 Y94.433 E12.46150
+G1 X103.259 Y94.131 E12.48930
+G1 X102.621 Y93.820 E12.52344
+G1 X102.001 Y93.592 E12.55525
+G1 X101.736 Y93.523 E12.56842
+G1 X98.265 Y106.476 E13.21342
+G1 X98.034 Y106.419 E13.22485
+G1 X97.449 Y106.209 E13.25476
+G1 X96.850 Y105.928 E13.28657
+G1 X96.241 Y105.562 E13.32072
+G1 X95.780 Y105.221 E13.34834
+G1 X95.253 Y104.747 E13.38241
+G1 X94.781 Y104.222 E13.41637
+G1 X94.413 Y103.721 E13.44628
+G1 X94.074 Y103.153 E13.47808
+G1 X93.775 Y102.512 E13.51212
+G1 X93.569 Y101.925 E13.54204
+G1 X93.534 Y101.783 E13.54907
+G1 X95.376 Y94.910 E13.89129
+G1 E11.89129 F2400.00000
+G92 E0
+G1 X144.622 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X160.804 Y100.996 E2.77830
+G1 X160.804 Y114.004 E3.40391
+G1 X144.622 Y114.004 E4.18221
+G1 X144.622 Y101.056 E4.80494
+G1 X144.237 Y100.611 F7800.000
+G1 F1813
+G1 X161.190 Y100.611 E5.62033
+G1 X161.190 Y114.389 E6.28304
+G1 X144.237 Y114.389 E7.09843
+G1 X144.237 Y100.671 E7.75826
+G1 X143.851 Y100.225 F7800.000
+G1 F1800
+G1 X161.575 Y100.225 E8.61074
+G1 X161.575 Y114.775 E9.31055
+G1 X143.851 Y114.775 E10.16303
+G1 X143.851 Y100.285 E10.85995
+G1 X144.240 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1813
+G1 X144.911 Y110.996 E11.35211
+G1 X144.911 Y113.715 E11.48287
+G1 X150.171 Y113.715 E11.73585
+G1 X153.502 Y101.285 E12.35474
+G1 X159.490 Y101.285 E12.64276
+G1 X156.113 Y113.888 E13.27028
+G1 X160.688 Y108.172 F7800.000
+G1 F1813
+G1 X153.802 Y101.285 E13.73868
+G1 X145.622 Y101.285 E14.13212
+G1 X158.051 Y113.715 E14.97754
+G1 X149.871 Y113.715 E15.37098
+G1 X144.738 Y108.582 E15.72011
+G1 X144.738 Y106.408 F7800.000
+G1 F1813
+G1 X160.688 Y102.134 E16.51435
+G1 X160.688 Y108.122 F7800.000
+G1 F1813
+G1 X144.738 Y112.396 E17.30858
+G1 Z5.750 F7800.000
+G1 E15.30858 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1813
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1813
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1813
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1813
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1813
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.058 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X93.127 Y101.340 E2.03567
+G1 X93.024 Y100.606 E2.07134
+G1 X92.997 Y100.002 E2.10043
+G1 X93.028 Y99.345 E2.13204
+G1 X93.126 Y98.665 E2.16508
+G1 X93.304 Y97.950 E2.20053
+G1 X93.524 Y97.336 E2.23193
+G1 X93.817 Y96.714 E2.26497
+G1 X94.197 Y96.081 E2.30050
+G1 X94.555 Y95.596 E2.32947
+G1 X95.049 Y95.049 E2.36493
+G1 X95.595 Y94.556 E2.40030
+G1 X96.121 Y94.170 E2.43170
+G1 X96.711 Y93.818 E2.46475
+G1 X97.377 Y93.507 E2.50007
+G1 X98.074 Y93.267 E2.53553
+G1 X98.660 Y93.127 E2.56450
+G1 X99.392 Y93.024 E2.60008
+G1 X100.045 Y92.998 E2.63148
+G1 X100.731 Y93.036 E2.66452
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72902
+G1 X102.736 Y93.554 E2.76448
+G1 X103.399 Y93.877 E2.79994
+G1 X103.914 Y94.193 E2.82903
+G1 X104.441 Y94.586 E2.86064
+G1 X104.950 Y95.047 E2.89368
+G1 X105.444 Y95.595 E2.92913
+G1 X105.830 Y96.121 E2.96053
+G1 X106.182 Y96.711 E2.99357
+G1 X106.493 Y97.377 E3.02889
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09332
+G1 X106.976 Y99.394 E3.12899
+G1 X107.003 Y99.998 E3.15808
+G1 X106.972 Y100.655 E3.18969
+G1 X106.874 Y101.335 E3.22273
+G1 X106.696 Y102.050 E3.25817
+G1 X106.476 Y102.664 E3.28957
+G1 X106.183 Y103.286 E3.32262
+G1 X105.804 Y103.918 E3.35806
+G1 X105.414 Y104.441 E3.38946
+G1 X104.953 Y104.950 E3.42251
+G1 X104.405 Y105.444 E3.45795
+G1 X103.879 Y105.830 E3.48935
+G1 X103.289 Y106.182 E3.52239
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59318
+G1 X101.340 Y106.873 E3.62214
+G1 X100.606 Y106.976 E3.65781
+G1 X100.002 Y107.003 E3.68690
+G1 X99.345 Y106.972 E3.71851
+G1 X98.665 Y106.874 E3.75155
+G1 X97.950 Y106.696 E3.78700
+G1 X97.336 Y106.476 E3.81840
+G1 X96.714 Y106.183 E3.85144
+G1 X96.081 Y105.803 E3.88697
+G1 X95.596 Y105.445 E3.91594
+G1 X95.049 Y104.951 E3.95140
+G1 X94.556 Y104.405 E3.98677
+G1 X94.170 Y103.879 E4.01817
+G1 X93.818 Y103.289 E4.05122
+G1 X93.507 Y102.623 E4.08654
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1813
+G1 X92.748 Y101.412 E4.15072
+G1 X92.639 Y100.641 E4.18818
+G1 X92.611 Y100.001 E4.21900
+G1 X92.644 Y99.309 E4.25233
+G1 X92.747 Y98.591 E4.28721
+G1 X92.935 Y97.838 E4.32452
+G1 X93.168 Y97.188 E4.35773
+G1 X93.476 Y96.532 E4.39260
+G1 X93.876 Y95.866 E4.42997
+G1 X94.256 Y95.352 E4.46072
+G1 X94.776 Y94.776 E4.49804
+G1 X95.351 Y94.257 E4.53531
+G1 X95.908 Y93.848 E4.56852
+G1 X96.530 Y93.477 E4.60339
+G1 X97.232 Y93.149 E4.64063
+G1 X97.966 Y92.897 E4.67796
+G1 X98.588 Y92.748 E4.70870
+G1 X99.358 Y92.639 E4.74610
+G1 X100.047 Y92.612 E4.77931
+G1 X100.771 Y92.652 E4.81418
+G1 X101.539 Y92.773 E4.85155
+G1 X102.158 Y92.933 E4.88230
+G1 X102.887 Y93.199 E4.91962
+G1 X103.584 Y93.539 E4.95695
+G1 X104.131 Y93.874 E4.98777
+G1 X104.686 Y94.288 E5.02110
+G1 X105.224 Y94.775 E5.05598
+G1 X105.743 Y95.351 E5.09329
+G1 X106.152 Y95.908 E5.12650
+G1 X106.523 Y96.530 E5.16137
+G1 X106.851 Y97.232 E5.19861
+G1 X107.103 Y97.966 E5.23594
+G1 X107.252 Y98.588 E5.26668
+G1 X107.361 Y99.359 E5.30414
+G1 X107.389 Y99.999 E5.33496
+G1 X107.356 Y100.691 E5.36829
+G1 X107.253 Y101.409 E5.40317
+G1 X107.065 Y102.162 E5.44048
+G1 X106.832 Y102.812 E5.47369
+G1 X106.524 Y103.468 E5.50856
+G1 X106.125 Y104.133 E5.54588
+G1 X105.712 Y104.686 E5.57908
+G1 X105.225 Y105.224 E5.61396
+G1 X104.649 Y105.743 E5.65127
+G1 X104.092 Y106.152 E5.68448
+G1 X103.470 Y106.523 E5.71935
+G1 X102.768 Y106.851 E5.75659
+G1 X102.034 Y107.103 E5.79392
+G1 X101.412 Y107.252 E5.82466
+G1 X100.641 Y107.361 E5.86212
+G1 X100.001 Y107.389 E5.89294
+G1 X99.309 Y107.356 E5.92627
+G1 X98.591 Y107.253 E5.96115
+G1 X97.838 Y107.065 E5.99846
+G1 X97.188 Y106.832 E6.03167
+G1 X96.532 Y106.524 E6.06654
+G1 X95.866 Y106.124 E6.10391
+G1 X95.352 Y105.744 E6.13466
+G1 X94.776 Y105.224 E6.17198
+G1 X94.257 Y104.649 E6.20925
+G1 X93.848 Y104.092 E6.24246
+G1 X93.477 Y103.470 E6.27733
+G1 X93.149 Y102.768 E6.31457
+G1 X92.968 Y102.241 E6.34139
+G1 X92.584 Y102.309 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34990
+G1 X92.368 Y101.484 E6.38243
+G1 X92.255 Y100.677 E6.42167
+G1 X92.225 Y100.000 E6.45422
+G1 X92.260 Y99.272 E6.48928
+G1 X92.368 Y98.517 E6.52599
+G1 X92.565 Y97.726 E6.56517
+G1 X92.811 Y97.041 E6.60019
+G1 X93.135 Y96.350 E6.63689
+G1 X93.555 Y95.652 E6.67609
+G1 X93.957 Y95.108 E6.70862
+G1 X94.502 Y94.502 E6.74781
+G1 X95.108 Y93.958 E6.78698
+G1 X95.694 Y93.527 E6.82199
+G1 X96.350 Y93.135 E6.85870
+G1 X97.088 Y92.791 E6.89785
+G1 X97.858 Y92.526 E6.93704
+G1 X98.516 Y92.368 E6.96957
+G1 X99.323 Y92.255 E7.00878
+G1 X100.050 Y92.226 E7.04380
+G1 X100.812 Y92.268 E7.08050
+G1 X101.617 Y92.395 E7.11970
+G1 X102.272 Y92.565 E7.15223
+G1 X103.038 Y92.843 E7.19142
+G1 X103.770 Y93.201 E7.23061
+G1 X104.347 Y93.554 E7.26316
+G1 X104.932 Y93.990 E7.29823
+G1 X105.497 Y94.502 E7.33493
+G1 X106.042 Y95.108 E7.37411
+G1 X106.473 Y95.694 E7.40913
+G1 X106.865 Y96.350 E7.44583
+G1 X107.209 Y97.088 E7.48499
+G1 X107.474 Y97.858 E7.52418
+G1 X107.632 Y98.516 E7.55670
+G1 X107.745 Y99.323 E7.59594
+G1 X107.775 Y100.000 E7.62849
+G1 X107.740 Y100.728 E7.66356
+G1 X107.632 Y101.483 E7.70026
+G1 X107.435 Y102.274 E7.73944
+G1 X107.189 Y102.959 E7.77446
+G1 X106.865 Y103.650 E7.81116
+G1 X106.445 Y104.348 E7.85035
+G1 X106.010 Y104.932 E7.88536
+G1 X105.498 Y105.497 E7.92207
+G1 X104.892 Y106.042 E7.96125
+G1 X104.306 Y106.473 E7.99627
+G1 X103.650 Y106.865 E8.03297
+G1 X102.912 Y107.209 E8.07213
+G1 X102.142 Y107.474 E8.11131
+G1 X101.484 Y107.632 E8.14384
+G1 X100.677 Y107.745 E8.18308
+G1 X100.000 Y107.775 E8.21563
+G1 X99.272 Y107.740 E8.25069
+G1 X98.517 Y107.632 E8.28740
+G1 X97.726 Y107.435 E8.32658
+G1 X97.041 Y107.189 E8.36160
+G1 X96.350 Y106.865 E8.39830
+G1 X95.652 Y106.445 E8.43750
+G1 X95.108 Y106.043 E8.47003
+G1 X94.502 Y105.498 E8.50922
+G1 X93.958 Y104.892 E8.54839
+G1 X93.527 Y104.306 E8.58340
+G1 X93.135 Y103.650 E8.62011
+G1 X92.791 Y102.912 E8.65926
+G1 X92.603 Y102.366 E8.68705
+G1 X92.697 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1813
+G1 X98.306 Y106.487 E9.02942
+G1 X98.721 Y106.590 E9.04997
+G1 X99.373 Y106.683 E9.08164
+G1 X100.002 Y106.713 E9.11196
+G1 X100.579 Y106.688 E9.13974
+G1 X101.286 Y106.589 E9.17408
+G1 X101.845 Y106.455 E9.20170
+G1 X102.515 Y106.224 E9.23577
+G1 X103.153 Y105.926 E9.26965
+G1 X103.719 Y105.589 E9.30133
+G1 X104.222 Y105.219 E9.33137
+G1 X104.747 Y104.747 E9.36532
+G1 X95.253 Y95.253 E10.01105
+G1 X95.778 Y94.781 E10.04500
+G1 X96.281 Y94.411 E10.07504
+G1 X96.847 Y94.074 E10.10671
+G1 X97.485 Y93.776 E10.14060
+G1 X98.155 Y93.545 E10.17466
+G1 X98.714 Y93.411 E10.20229
+G1 X99.418 Y93.312 E10.23651
+G1 X100.042 Y93.287 E10.26656
+G1 X100.700 Y93.324 E10.29823
+G1 X101.401 Y93.435 E10.33238
+G1 X101.690 Y93.509 E10.34671
+G1 X106.727 Y98.547 E10.68936
+G1 X106.780 Y101.178 F7800.000
+G1 F1813
+G1 X94.717 Y104.410 E11.29002
+G1 X93.220 Y98.822 F7800.000
+G1 F1813
+G1 X105.283 Y95.590 E11.89069
+G1 X104.624 Y105.090 F7800.000
+G1 F1813
+G1 X106.468 Y98.210 E12.23326
+G1 X106.224 Y97.485 E12.27005
+G1 X105.926 Y96.847 E12.30394
+G1 X105.589 Y96.281 E12.33561
+G1 X105.219 Y95.778 E12.36565
+G1 X104.745 Y95.252 E12.39970
+G1 X104.257 Y94.810 E12.43137
+G1 X103.752 Y94.433 E12.46168
+G1 X103.259 Y94.131 E12.48947
+G1 X102.623 Y93.821 E12.52353
+G1 X101.957 Y93.579 E12.55760
+G1 X101.736 Y93.521 E12.56860
+G1 X98.265 Y106.476 E13.21366
+G1 X98.034 Y106.419 E13.22508
+G1 X97.446 Y106.208 E13.25513
+G1 X96.850 Y105.928 E13.28680
+G1 X96.241 Y105.562 E13.32095
+G1 X95.780 Y105.221 E13.34858
+G1 X95.253 Y104.747 E13.38265
+G1 X94.781 Y104.222 E13.41660
+G1 X94.411 Y103.719 E13.44664
+G1 X94.074 Y103.153 E13.47832
+G1 X93.776 Y102.515 E13.51220
+G1 X93.545 Y101.845 E13.54626
+G1 X93.532 Y101.790 E13.54900
+G1 X95.376 Y94.910 E13.89157
+G1 E11.89157 F2400.00000
+G92 E0
+G1 X144.827 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1813
+G1 X161.009 Y100.996 E2.77830
+G1 X161.009 Y114.004 E3.40391
+G1 X144.827 Y114.004 E4.18221
+G1 X144.827 Y101.056 E4.80494
+G1 X144.442 Y100.611 F7800.000
+G1 F1813
+G1 X161.395 Y100.611 E5.62033
+G1 X161.395 Y114.389 E6.28304
+G1 X144.442 Y114.389 E7.09843
+G1 X144.442 Y100.671 E7.75826
+G1 X144.056 Y100.225 F7800.000
+G1 F1800
+G1 X161.781 Y100.225 E8.61074
+G1 X161.781 Y114.775 E9.31055
+G1 X144.056 Y114.775 E10.16303
+G1 X144.056 Y100.285 E10.85995
+G1 X144.446 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1813
+G1 X145.117 Y110.230 E11.31397
+G1 X145.117 Y113.715 E11.48157
+G1 X150.171 Y113.715 E11.72468
+G1 X153.502 Y101.285 E12.34357
+G1 X159.490 Y101.285 E12.63158
+G1 X156.113 Y113.888 E13.25911
+G1 X160.894 Y108.377 F7800.000
+G1 F1813
+G1 X153.802 Y101.285 E13.74147
+G1 X145.622 Y101.285 E14.13491
+G1 X158.051 Y113.715 E14.98033
+G1 X149.871 Y113.715 E15.37377
+G1 X144.943 Y108.787 E15.70894
+G1 X144.943 Y106.353 F7800.000
+G1 F1813
+G1 X160.894 Y102.079 E16.50318
+G1 X160.894 Y108.067 F7800.000
+G1 F1813
+G1 X144.943 Y112.341 E17.29741
+G1 Z6.050 F7800.000
+G1 E15.29741 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1812
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1812
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1812
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1812
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1812
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1812
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.304 Y102.050 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1812
+G1 X93.126 Y101.336 E2.03537
+G1 X93.024 Y100.606 E2.07084
+G1 X92.997 Y100.000 E2.10001
+G1 X93.024 Y99.394 E2.12918
+G1 X93.127 Y98.660 E2.16486
+G1 X93.267 Y98.074 E2.19382
+G1 X93.507 Y97.377 E2.22928
+G1 X93.818 Y96.710 E2.26465
+G1 X94.153 Y96.147 E2.29618
+G1 X94.557 Y95.594 E2.32910
+G1 X95.049 Y95.049 E2.36442
+G1 X95.595 Y94.556 E2.39979
+G1 X96.124 Y94.169 E2.43132
+G1 X96.711 Y93.818 E2.46424
+G1 X97.377 Y93.507 E2.49956
+G1 X98.074 Y93.267 E2.53502
+G1 X98.660 Y93.127 E2.56399
+G1 X99.392 Y93.024 E2.59957
+G1 X100.047 Y92.998 E2.63110
+G1 X100.730 Y93.036 E2.66401
+G1 X101.458 Y93.151 E2.69946
+G1 X102.092 Y93.318 E2.73098
+G1 X102.737 Y93.554 E2.76402
+G1 X103.329 Y93.840 E2.79562
+G1 X103.914 Y94.194 E2.82854
+G1 X104.505 Y94.638 E2.86407
+G1 X104.949 Y95.045 E2.89303
+G1 X105.445 Y95.596 E2.92871
+G1 X105.803 Y96.081 E2.95767
+G1 X106.184 Y96.715 E2.99325
+G1 X106.464 Y97.307 E3.02478
+G1 X106.696 Y97.951 E3.05769
+G1 X106.874 Y98.664 E3.09302
+G1 X106.976 Y99.394 E3.12848
+G1 X107.003 Y100.000 E3.15766
+G1 X106.976 Y100.606 E3.18683
+G1 X106.873 Y101.339 E3.22241
+G1 X106.718 Y101.975 E3.25394
+G1 X106.493 Y102.622 E3.28685
+G1 X106.181 Y103.291 E3.32239
+G1 X105.875 Y103.810 E3.35135
+G1 X105.442 Y104.407 E3.38682
+G1 X104.950 Y104.953 E3.42219
+G1 X104.465 Y105.394 E3.45371
+G1 X103.917 Y105.804 E3.48663
+G1 X103.285 Y106.184 E3.52207
+G1 X102.693 Y106.464 E3.55360
+G1 X102.049 Y106.696 E3.58652
+G1 X101.336 Y106.874 E3.62184
+G1 X100.606 Y106.976 E3.65731
+G1 X100.000 Y107.003 E3.68648
+G1 X99.394 Y106.976 E3.71565
+G1 X98.660 Y106.873 E3.75132
+G1 X98.074 Y106.733 E3.78029
+G1 X97.377 Y106.493 E3.81575
+G1 X96.710 Y106.182 E3.85112
+G1 X96.147 Y105.847 E3.88265
+G1 X95.594 Y105.443 E3.91556
+G1 X95.047 Y104.950 E3.95101
+G1 X94.606 Y104.465 E3.98254
+G1 X94.196 Y103.917 E4.01545
+G1 X93.816 Y103.285 E4.05090
+G1 X93.536 Y102.693 E4.08243
+G1 X93.325 Y102.106 E4.11241
+G1 X92.942 Y102.181 F7800.000
+G1 F1812
+G1 X92.747 Y101.410 E4.15063
+G1 X92.639 Y100.641 E4.18796
+G1 X92.611 Y100.000 E4.21883
+G1 X92.639 Y99.359 E4.24971
+G1 X92.748 Y98.588 E4.28716
+G1 X92.897 Y97.966 E4.31791
+G1 X93.149 Y97.232 E4.35523
+G1 X93.477 Y96.530 E4.39250
+G1 X93.831 Y95.934 E4.42584
+G1 X94.257 Y95.351 E4.46058
+G1 X94.776 Y94.776 E4.49782
+G1 X95.351 Y94.257 E4.53509
+G1 X95.910 Y93.847 E4.56843
+G1 X96.530 Y93.477 E4.60317
+G1 X97.232 Y93.149 E4.64042
+G1 X97.966 Y92.897 E4.67774
+G1 X98.588 Y92.748 E4.70849
+G1 X99.358 Y92.639 E4.74588
+G1 X100.050 Y92.612 E4.77922
+G1 X100.771 Y92.652 E4.81397
+G1 X101.538 Y92.773 E4.85128
+G1 X102.208 Y92.949 E4.88462
+G1 X102.888 Y93.199 E4.91943
+G1 X103.513 Y93.500 E4.95282
+G1 X104.131 Y93.874 E4.98756
+G1 X104.751 Y94.342 E5.02493
+G1 X105.223 Y94.774 E5.05568
+G1 X105.744 Y95.352 E5.09313
+G1 X106.124 Y95.866 E5.12387
+G1 X106.524 Y96.533 E5.16127
+G1 X106.820 Y97.159 E5.19461
+G1 X107.065 Y97.839 E5.22935
+G1 X107.253 Y98.590 E5.26659
+G1 X107.361 Y99.359 E5.30392
+G1 X107.389 Y100.000 E5.33479
+G1 X107.361 Y100.641 E5.36567
+G1 X107.253 Y101.411 E5.40307
+G1 X107.088 Y102.085 E5.43640
+G1 X106.851 Y102.767 E5.47115
+G1 X106.523 Y103.471 E5.50852
+G1 X106.198 Y104.022 E5.53926
+G1 X105.742 Y104.650 E5.57659
+G1 X105.223 Y105.226 E5.61386
+G1 X104.711 Y105.692 E5.64720
+G1 X104.132 Y106.125 E5.68194
+G1 X103.467 Y106.524 E5.71925
+G1 X102.841 Y106.820 E5.75259
+G1 X102.161 Y107.065 E5.78733
+G1 X101.410 Y107.253 E5.82457
+G1 X100.641 Y107.361 E5.86190
+G1 X100.000 Y107.389 E5.89277
+G1 X99.359 Y107.361 E5.92365
+G1 X98.588 Y107.252 E5.96110
+G1 X97.966 Y107.103 E5.99185
+G1 X97.232 Y106.851 E6.02917
+G1 X96.530 Y106.523 E6.06644
+G1 X95.934 Y106.169 E6.09978
+G1 X95.351 Y105.743 E6.13452
+G1 X94.774 Y105.223 E6.17184
+G1 X94.308 Y104.711 E6.20518
+G1 X93.875 Y104.132 E6.23992
+G1 X93.476 Y103.467 E6.27723
+G1 X93.180 Y102.841 E6.31057
+G1 X92.962 Y102.237 E6.34143
+G1 X92.579 Y102.311 F7800.000
+G1 F1800
+G1 X92.368 Y101.483 E6.38252
+G1 X92.255 Y100.677 E6.42171
+G1 X92.225 Y100.000 E6.45428
+G1 X92.255 Y99.323 E6.48686
+G1 X92.368 Y98.516 E6.52609
+G1 X92.526 Y97.858 E6.55862
+G1 X92.791 Y97.088 E6.59781
+G1 X93.136 Y96.350 E6.63697
+G1 X93.509 Y95.721 E6.67212
+G1 X93.958 Y95.107 E6.70869
+G1 X94.502 Y94.502 E6.74785
+G1 X95.108 Y93.958 E6.78702
+G1 X95.697 Y93.525 E6.82217
+G1 X96.350 Y93.136 E6.85874
+G1 X97.088 Y92.791 E6.89789
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00882
+G1 X100.053 Y92.226 E7.04397
+G1 X100.812 Y92.268 E7.08054
+G1 X101.617 Y92.395 E7.11973
+G1 X102.324 Y92.581 E7.15488
+G1 X103.038 Y92.843 E7.19147
+G1 X103.697 Y93.161 E7.22664
+G1 X104.347 Y93.554 E7.26321
+G1 X104.998 Y94.045 E7.30241
+G1 X105.497 Y94.502 E7.33494
+G1 X106.043 Y95.108 E7.37417
+G1 X106.445 Y95.652 E7.40670
+G1 X106.865 Y96.350 E7.44592
+G1 X107.177 Y97.011 E7.48107
+G1 X107.435 Y97.727 E7.51764
+G1 X107.632 Y98.517 E7.55679
+G1 X107.745 Y99.323 E7.59598
+G1 X107.775 Y100.000 E7.62856
+G1 X107.745 Y100.677 E7.66113
+G1 X107.632 Y101.484 E7.70034
+G1 X107.458 Y102.194 E7.73549
+G1 X107.209 Y102.912 E7.77206
+G1 X106.864 Y103.651 E7.81127
+G1 X106.521 Y104.234 E7.84380
+G1 X106.042 Y104.893 E7.88298
+G1 X105.497 Y105.498 E7.92215
+G1 X104.956 Y105.990 E7.95730
+G1 X104.348 Y106.445 E7.99387
+G1 X103.650 Y106.865 E8.03305
+G1 X102.989 Y107.177 E8.06820
+G1 X102.273 Y107.435 E8.10477
+G1 X101.483 Y107.632 E8.14393
+G1 X100.677 Y107.745 E8.18312
+G1 X100.000 Y107.775 E8.21569
+G1 X99.323 Y107.745 E8.24827
+G1 X98.516 Y107.632 E8.28750
+G1 X97.858 Y107.474 E8.32003
+G1 X97.088 Y107.209 E8.35922
+G1 X96.350 Y106.864 E8.39839
+G1 X95.721 Y106.491 E8.43353
+G1 X95.107 Y106.042 E8.47010
+G1 X94.502 Y105.497 E8.50929
+G1 X94.010 Y104.956 E8.54444
+G1 X93.555 Y104.348 E8.58101
+G1 X93.135 Y103.650 E8.62019
+G1 X92.823 Y102.989 E8.65534
+G1 X92.599 Y102.368 E8.68709
+G1 X92.851 Y102.019 F7800.000
+G1 X93.275 Y101.455
+G1 F1812
+G1 X98.312 Y106.492 E9.02969
+G1 X98.714 Y106.589 E9.04955
+G1 X99.421 Y106.688 E9.08388
+G1 X100.000 Y106.713 E9.11178
+G1 X100.579 Y106.688 E9.13968
+G1 X101.281 Y106.589 E9.17374
+G1 X101.965 Y106.419 E9.20763
+G1 X102.582 Y106.197 E9.23918
+G1 X103.149 Y105.929 E9.26935
+G1 X103.755 Y105.564 E9.30339
+G1 X104.280 Y105.171 E9.33494
+G1 X104.747 Y104.747 E9.36526
+G1 X95.253 Y95.253 E10.01098
+G1 X95.778 Y94.781 E10.04493
+G1 X96.284 Y94.410 E10.07510
+G1 X96.847 Y94.074 E10.10665
+G1 X97.485 Y93.776 E10.14053
+G1 X98.155 Y93.545 E10.17460
+G1 X98.714 Y93.411 E10.20223
+G1 X99.418 Y93.312 E10.23644
+G1 X100.045 Y93.287 E10.26662
+G1 X100.700 Y93.324 E10.29816
+G1 X101.399 Y93.434 E10.33220
+G1 X101.692 Y93.511 E10.34676
+G1 X106.725 Y98.545 E10.68912
+G1 X106.779 Y101.178 F7800.000
+G1 F1812
+G1 X94.713 Y104.411 E11.28993
+G1 X93.221 Y98.822 F7800.000
+G1 F1812
+G1 X105.283 Y95.590 E11.89057
+G1 X104.624 Y105.094 F7800.000
+G1 F1812
+G1 X106.465 Y98.221 E12.23280
+G1 X106.419 Y98.035 E12.24198
+G1 X106.197 Y97.418 E12.27352
+G1 X105.929 Y96.851 E12.30369
+G1 X105.562 Y96.241 E12.33791
+G1 X105.221 Y95.780 E12.36554
+G1 X104.743 Y95.249 E12.39987
+G1 X104.319 Y94.861 E12.42750
+G1 X103.752 Y94.434 E12.46166
+G1 X103.191 Y94.094 E12.49321
+G1 X102.624 Y93.821 E12.52347
+G1 X102.006 Y93.594 E12.55517
+G1 X101.736 Y93.523 E12.56859
+G1 X98.264 Y106.481 E13.21380
+G1 X97.485 Y106.224 E13.25321
+G1 X96.846 Y105.926 E13.28716
+G1 X96.306 Y105.605 E13.31733
+G1 X95.777 Y105.218 E13.34888
+G1 X95.251 Y104.745 E13.38292
+G1 X94.829 Y104.280 E13.41309
+G1 X94.436 Y103.755 E13.44463
+G1 X94.071 Y103.149 E13.47867
+G1 X93.803 Y102.582 E13.50885
+G1 X93.581 Y101.965 E13.54039
+G1 X93.535 Y101.779 E13.54956
+G1 X95.376 Y94.910 E13.89163
+G1 E11.89163 F2400.00000
+G92 E0
+G1 X145.033 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1812
+G1 X161.215 Y100.996 E2.77830
+G1 X161.215 Y114.004 E3.40391
+G1 X145.033 Y114.004 E4.18221
+G1 X145.033 Y101.056 E4.80494
+G1 X144.647 Y100.611 F7800.000
+G1 F1812
+G1 X161.600 Y100.611 E5.62033
+G1 X161.600 Y114.389 E6.28304
+G1 X144.647 Y114.389 E7.09843
+G1 X144.647 Y100.671 E7.75826
+G1 X144.261 Y100.225 F7800.000
+G1 F1800
+G1 X161.986 Y100.225 E8.61074
+G1 X161.986 Y114.775 E9.31055
+G1 X144.261 Y114.775 E10.16303
+G1 X144.261 Y100.285 E10.85995
+G1 X144.651 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1812
+G1 X145.322 Y109.464 E11.27583
+G1 X145.322 Y113.715 E11.48027
+G1 X150.171 Y113.715 E11.71351
+G1 X153.502 Y101.285 E12.33239
+G1 X159.490 Y101.285 E12.62041
+G1 X156.113 Y113.888 E13.24794
+G1 X161.099 Y108.582 F7800.000
+G1 F1812
+G1 X153.802 Y101.285 E13.74426
+G1 X145.622 Y101.285 E14.13770
+G1 X158.051 Y113.715 E14.98312
+G1 X149.871 Y113.715 E15.37656
+G1 X145.148 Y108.992 E15.69777
+G1 X145.148 Y106.298 F7800.000
+G1 F1812
+G1 X161.099 Y102.024 E16.49201
+G1 X161.099 Y108.012 F7800.000
+G1 F1812
+G1 X145.148 Y112.286 E17.28624
+G1 Z6.350 F7800.000
+G1 E15.28624 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1812
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1812
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1812
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1812
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1812
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1812
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.058 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1812
+G1 X93.126 Y101.338 E2.03579
+G1 X93.031 Y100.682 E2.06766
+G1 X92.997 Y99.997 E2.10065
+G1 X93.024 Y99.394 E2.12969
+G1 X93.126 Y98.664 E2.16516
+G1 X93.304 Y97.950 E2.20052
+G1 X93.526 Y97.331 E2.23218
+G1 X93.816 Y96.714 E2.26497
+G1 X94.196 Y96.082 E2.30041
+G1 X94.590 Y95.555 E2.33207
+G1 X95.047 Y95.050 E2.36485
+G1 X95.595 Y94.557 E2.40030
+G1 X96.126 Y94.167 E2.43196
+G1 X96.711 Y93.818 E2.46474
+G1 X97.377 Y93.507 E2.50007
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.392 Y93.024 E2.60007
+G1 X100.050 Y92.998 E2.63173
+G1 X100.730 Y93.036 E2.66452
+G1 X101.458 Y93.151 E2.69996
+G1 X102.095 Y93.318 E2.73162
+G1 X102.735 Y93.554 E2.76441
+G1 X103.399 Y93.877 E2.79995
+G1 X103.914 Y94.193 E2.82902
+G1 X104.445 Y94.590 E2.86089
+G1 X104.950 Y95.047 E2.89368
+G1 X105.443 Y95.595 E2.92912
+G1 X105.833 Y96.126 E2.96078
+G1 X106.182 Y96.711 E2.99357
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09332
+G1 X106.976 Y99.394 E3.12899
+G1 X107.003 Y100.000 E3.15817
+G1 X106.976 Y100.606 E3.18734
+G1 X106.874 Y101.336 E3.22280
+G1 X106.696 Y102.050 E3.25817
+G1 X106.474 Y102.669 E3.28983
+G1 X106.184 Y103.286 E3.32261
+G1 X105.804 Y103.918 E3.35806
+G1 X105.410 Y104.445 E3.38971
+G1 X104.953 Y104.950 E3.42250
+G1 X104.407 Y105.442 E3.45783
+G1 X103.810 Y105.875 E3.49329
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59318
+G1 X101.340 Y106.873 E3.62214
+G1 X100.606 Y106.976 E3.65782
+G1 X100.000 Y107.003 E3.68699
+G1 X99.394 Y106.976 E3.71616
+G1 X98.664 Y106.874 E3.75163
+G1 X97.950 Y106.696 E3.78699
+G1 X97.331 Y106.474 E3.81865
+G1 X96.714 Y106.184 E3.85144
+G1 X96.082 Y105.804 E3.88688
+G1 X95.555 Y105.410 E3.91854
+G1 X95.050 Y104.953 E3.95132
+G1 X94.558 Y104.407 E3.98665
+G1 X94.126 Y103.812 E4.02202
+G1 X93.794 Y103.243 E4.05368
+G1 X93.508 Y102.625 E4.08646
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1812
+G1 X92.747 Y101.411 E4.15080
+G1 X92.647 Y100.720 E4.18439
+G1 X92.611 Y99.998 E4.21913
+G1 X92.639 Y99.359 E4.24993
+G1 X92.747 Y98.590 E4.28725
+G1 X92.935 Y97.838 E4.32452
+G1 X93.170 Y97.183 E4.35799
+G1 X93.476 Y96.532 E4.39260
+G1 X93.875 Y95.867 E4.42991
+G1 X94.292 Y95.309 E4.46338
+G1 X94.775 Y94.776 E4.49800
+G1 X95.351 Y94.257 E4.53531
+G1 X95.912 Y93.845 E4.56878
+G1 X96.530 Y93.477 E4.60339
+G1 X97.232 Y93.149 E4.64063
+G1 X97.966 Y92.897 E4.67796
+G1 X98.588 Y92.748 E4.70871
+G1 X99.357 Y92.639 E4.74610
+G1 X100.053 Y92.612 E4.77957
+G1 X100.771 Y92.652 E4.81418
+G1 X101.538 Y92.773 E4.85150
+G1 X102.211 Y92.950 E4.88497
+G1 X102.886 Y93.198 E4.91958
+G1 X103.584 Y93.539 E4.95695
+G1 X104.131 Y93.874 E4.98777
+G1 X104.691 Y94.292 E5.02136
+G1 X105.224 Y94.775 E5.05597
+G1 X105.743 Y95.351 E5.09329
+G1 X106.155 Y95.912 E5.12676
+G1 X106.523 Y96.530 E5.16137
+G1 X106.851 Y97.232 E5.19861
+G1 X107.103 Y97.966 E5.23594
+G1 X107.252 Y98.588 E5.26669
+G1 X107.361 Y99.359 E5.30414
+G1 X107.389 Y100.000 E5.33501
+G1 X107.361 Y100.641 E5.36589
+G1 X107.253 Y101.410 E5.40321
+G1 X107.065 Y102.162 E5.44048
+G1 X106.830 Y102.817 E5.47395
+G1 X106.524 Y103.468 E5.50856
+G1 X106.125 Y104.133 E5.54587
+G1 X105.708 Y104.691 E5.57934
+G1 X105.225 Y105.224 E5.61395
+G1 X104.650 Y105.742 E5.65120
+G1 X104.022 Y106.198 E5.68852
+G1 X103.471 Y106.523 E5.71927
+G1 X102.768 Y106.851 E5.75659
+G1 X102.034 Y107.103 E5.79392
+G1 X101.412 Y107.252 E5.82467
+G1 X100.641 Y107.361 E5.86212
+G1 X100.000 Y107.389 E5.89299
+G1 X99.359 Y107.361 E5.92387
+G1 X98.590 Y107.253 E5.96119
+G1 X97.838 Y107.065 E5.99846
+G1 X97.183 Y106.830 E6.03193
+G1 X96.532 Y106.524 E6.06654
+G1 X95.867 Y106.125 E6.10385
+G1 X95.309 Y105.708 E6.13732
+G1 X94.776 Y105.225 E6.17194
+G1 X94.258 Y104.650 E6.20918
+G1 X93.803 Y104.023 E6.24645
+G1 X93.452 Y103.422 E6.27992
+G1 X93.150 Y102.769 E6.31453
+G1 X92.968 Y102.241 E6.34139
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34991
+G1 X92.368 Y101.484 E6.38246
+G1 X92.262 Y100.757 E6.41779
+G1 X92.225 Y99.999 E6.45427
+G1 X92.255 Y99.323 E6.48682
+G1 X92.368 Y98.517 E6.52600
+G1 X92.565 Y97.726 E6.56517
+G1 X92.813 Y97.036 E6.60045
+G1 X93.135 Y96.350 E6.63689
+G1 X93.555 Y95.652 E6.67607
+G1 X93.993 Y95.064 E6.71136
+G1 X94.502 Y94.503 E6.74779
+G1 X95.108 Y93.958 E6.78698
+G1 X95.699 Y93.524 E6.82226
+G1 X96.350 Y93.136 E6.85870
+G1 X97.088 Y92.791 E6.89785
+G1 X97.858 Y92.526 E6.93704
+G1 X98.516 Y92.368 E6.96957
+G1 X99.323 Y92.255 E7.00878
+G1 X100.056 Y92.226 E7.04406
+G1 X100.812 Y92.268 E7.08050
+G1 X101.617 Y92.395 E7.11969
+G1 X102.326 Y92.582 E7.15497
+G1 X103.037 Y92.843 E7.19140
+G1 X103.770 Y93.201 E7.23061
+G1 X104.347 Y93.554 E7.26316
+G1 X104.936 Y93.993 E7.29849
+G1 X105.497 Y94.502 E7.33493
+G1 X106.042 Y95.108 E7.37411
+G1 X106.476 Y95.699 E7.40939
+G1 X106.864 Y96.350 E7.44583
+G1 X107.209 Y97.088 E7.48499
+G1 X107.474 Y97.858 E7.52418
+G1 X107.632 Y98.516 E7.55671
+G1 X107.745 Y99.323 E7.59594
+G1 X107.775 Y100.000 E7.62852
+G1 X107.745 Y100.677 E7.66109
+G1 X107.632 Y101.483 E7.70028
+G1 X107.435 Y102.274 E7.73944
+G1 X107.187 Y102.964 E7.77473
+G1 X106.865 Y103.650 E7.81116
+G1 X106.445 Y104.348 E7.85035
+G1 X106.007 Y104.936 E7.88563
+G1 X105.498 Y105.497 E7.92207
+G1 X104.893 Y106.042 E7.96122
+G1 X104.234 Y106.521 E8.00041
+G1 X103.651 Y106.864 E8.03294
+G1 X102.912 Y107.209 E8.07213
+G1 X102.142 Y107.474 E8.11132
+G1 X101.484 Y107.632 E8.14384
+G1 X100.677 Y107.745 E8.18308
+G1 X100.000 Y107.775 E8.21565
+G1 X99.323 Y107.745 E8.24823
+G1 X98.517 Y107.632 E8.28742
+G1 X97.726 Y107.435 E8.32658
+G1 X97.036 Y107.187 E8.36186
+G1 X96.350 Y106.865 E8.39830
+G1 X95.652 Y106.445 E8.43748
+G1 X95.064 Y106.007 E8.47277
+G1 X94.503 Y105.498 E8.50920
+G1 X93.958 Y104.893 E8.54836
+G1 X93.479 Y104.234 E8.58753
+G1 X93.109 Y103.600 E8.62281
+G1 X92.792 Y102.913 E8.65925
+G1 X92.603 Y102.366 E8.68705
+G1 X92.698 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1812
+G1 X98.306 Y106.487 E9.02942
+G1 X98.719 Y106.589 E9.04988
+G1 X99.421 Y106.688 E9.08394
+G1 X100.000 Y106.713 E9.11184
+G1 X100.579 Y106.688 E9.13974
+G1 X101.286 Y106.589 E9.17408
+G1 X101.845 Y106.455 E9.20170
+G1 X102.515 Y106.224 E9.23577
+G1 X103.157 Y105.925 E9.26983
+G1 X103.652 Y105.633 E9.29746
+G1 X104.224 Y105.217 E9.33153
+G1 X104.747 Y104.747 E9.36532
+G1 X95.253 Y95.253 E10.01105
+G1 X95.778 Y94.781 E10.04499
+G1 X96.286 Y94.408 E10.07529
+G1 X96.847 Y94.074 E10.10670
+G1 X97.485 Y93.776 E10.14060
+G1 X98.155 Y93.545 E10.17466
+G1 X98.714 Y93.411 E10.20229
+G1 X99.418 Y93.312 E10.23650
+G1 X100.047 Y93.287 E10.26680
+G1 X100.700 Y93.324 E10.29822
+G1 X101.399 Y93.434 E10.33226
+G1 X101.692 Y93.511 E10.34683
+G1 X106.727 Y98.547 E10.68934
+G1 X106.779 Y101.178 F7800.000
+G1 F1812
+G1 X94.717 Y104.410 E11.28997
+G1 X93.221 Y98.822 F7800.000
+G1 F1812
+G1 X105.283 Y95.590 E11.89061
+G1 X104.624 Y105.090 F7800.000
+G1 F1812
+G1 X106.468 Y98.210 E12.23318
+G1 X106.224 Y97.485 E12.26997
+G1 X105.926 Y96.847 E12.30387
+G1 X105.592 Y96.286 E12.33529
+G1 X105.219 Y95.778 E12.36559
+G1 X104.745 Y95.252 E12.39963
+G1 X104.261 Y94.813 E12.43104
+G1 X103.752 Y94.433 E12.46161
+G1 X103.259 Y94.131 E12.48939
+G1 X102.621 Y93.820 E12.52355
+G1 X102.008 Y93.595 E12.55497
+G1 X101.736 Y93.523 E12.56852
+G1 X98.265 Y106.476 E13.21350
+G1 X98.034 Y106.419 E13.22492
+G1 X97.441 Y106.206 E13.25522
+G1 X96.850 Y105.928 E13.28663
+G1 X96.244 Y105.564 E13.32067
+G1 X95.739 Y105.187 E13.35097
+G1 X95.255 Y104.748 E13.38239
+G1 X94.783 Y104.224 E13.41628
+G1 X94.368 Y103.654 E13.45023
+G1 X94.051 Y103.110 E13.48053
+G1 X93.777 Y102.517 E13.51194
+G1 X93.545 Y101.845 E13.54611
+G1 X93.532 Y101.790 E13.54884
+G1 X95.376 Y94.910 E13.89142
+G1 E11.89142 F2400.00000
+G92 E0
+G1 X145.238 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1812
+G1 X161.420 Y100.996 E2.77830
+G1 X161.420 Y114.004 E3.40391
+G1 X145.238 Y114.004 E4.18221
+G1 X145.238 Y101.056 E4.80494
+G1 X144.852 Y100.611 F7800.000
+G1 F1812
+G1 X161.805 Y100.611 E5.62033
+G1 X161.805 Y114.389 E6.28304
+G1 X144.852 Y114.389 E7.09843
+G1 X144.852 Y100.671 E7.75826
+G1 X144.467 Y100.225 F7800.000
+G1 F1800
+G1 X162.191 Y100.225 E8.61074
+G1 X162.191 Y114.775 E9.31055
+G1 X144.467 Y114.775 E10.16303
+G1 X144.467 Y100.285 E10.85995
+G1 X144.856 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1812
+G1 X145.527 Y108.698 E11.23769
+G1 X145.527 Y113.715 E11.47897
+G1 X150.171 Y113.715 E11.70234
+G1 X153.502 Y101.285 E12.32122
+G1 X159.490 Y101.285 E12.60924
+G1 X156.113 Y113.888 E13.23677
+G1 X161.304 Y108.787 F7800.000
+G1 F1812
+G1 X153.802 Y101.285 E13.74705
+G1 X145.622 Y101.285 E14.14049
+G1 X158.051 Y113.715 E14.98590
+G1 X149.871 Y113.715 E15.37935
+G1 X145.354 Y109.197 E15.68660
+G1 X145.354 Y106.243 F7800.000
+G1 F1812
+G1 X161.304 Y101.969 E16.48083
+G1 X161.304 Y107.957 F7800.000
+G1 F1812
+G1 X145.354 Y112.231 E17.27507
+G1 Z6.650 F7800.000
+G1 E15.27507 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1811
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1811
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1811
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1811
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1811
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1811
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.304 Y102.050 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1811
+G1 X93.126 Y101.336 E2.03539
+G1 X93.024 Y100.606 E2.07085
+G1 X92.997 Y100.002 E2.09993
+G1 X93.029 Y99.338 E2.13192
+G1 X93.126 Y98.661 E2.16479
+G1 X93.267 Y98.074 E2.19384
+G1 X93.507 Y97.377 E2.22930
+G1 X93.818 Y96.711 E2.26466
+G1 X94.156 Y96.142 E2.29645
+G1 X94.557 Y95.595 E2.32910
+G1 X95.049 Y95.049 E2.36444
+G1 X95.595 Y94.557 E2.39980
+G1 X96.128 Y94.166 E2.43159
+G1 X96.711 Y93.818 E2.46424
+G1 X97.377 Y93.507 E2.49958
+G1 X98.074 Y93.267 E2.53504
+G1 X98.660 Y93.127 E2.56400
+G1 X99.392 Y93.024 E2.59958
+G1 X100.052 Y92.998 E2.63136
+G1 X100.730 Y93.036 E2.66402
+G1 X101.458 Y93.151 E2.69946
+G1 X102.097 Y93.319 E2.73125
+G1 X102.737 Y93.554 E2.76402
+G1 X103.334 Y93.842 E2.79589
+G1 X103.916 Y94.195 E2.82865
+G1 X104.447 Y94.591 E2.86052
+G1 X104.952 Y95.049 E2.89329
+G1 X105.398 Y95.539 E2.92516
+G1 X105.804 Y96.083 E2.95781
+G1 X106.184 Y96.715 E2.99326
+G1 X106.466 Y97.312 E3.02505
+G1 X106.696 Y97.951 E3.05770
+G1 X106.874 Y98.664 E3.09303
+G1 X106.976 Y99.394 E3.12850
+G1 X107.003 Y100.000 E3.15767
+G1 X106.976 Y100.606 E3.18684
+G1 X106.873 Y101.338 E3.22242
+G1 X106.716 Y101.980 E3.25420
+G1 X106.493 Y102.622 E3.28686
+G1 X106.182 Y103.289 E3.32230
+G1 X105.844 Y103.858 E3.35409
+G1 X105.443 Y104.405 E3.38675
+G1 X104.950 Y104.953 E3.42219
+G1 X104.461 Y105.398 E3.45398
+G1 X103.917 Y105.804 E3.48663
+G1 X103.285 Y106.184 E3.52208
+G1 X102.688 Y106.466 E3.55387
+G1 X102.049 Y106.696 E3.58652
+G1 X101.336 Y106.874 E3.62186
+G1 X100.606 Y106.976 E3.65732
+G1 X100.002 Y107.003 E3.68639
+G1 X99.338 Y106.971 E3.71839
+G1 X98.661 Y106.874 E3.75126
+G1 X98.074 Y106.733 E3.78030
+G1 X97.377 Y106.493 E3.81576
+G1 X96.711 Y106.182 E3.85113
+G1 X96.142 Y105.844 E3.88291
+G1 X95.595 Y105.443 E3.91557
+G1 X95.047 Y104.950 E3.95101
+G1 X94.602 Y104.461 E3.98280
+G1 X94.196 Y103.917 E4.01546
+G1 X93.816 Y103.285 E4.05090
+G1 X93.534 Y102.688 E4.08269
+G1 X93.325 Y102.107 E4.11240
+G1 X92.942 Y102.181 F7800.000
+G1 F1811
+G1 X92.747 Y101.410 E4.15064
+G1 X92.639 Y100.641 E4.18797
+G1 X92.611 Y100.001 E4.21878
+G1 X92.645 Y99.301 E4.25251
+G1 X92.747 Y98.589 E4.28712
+G1 X92.897 Y97.966 E4.31791
+G1 X93.149 Y97.232 E4.35524
+G1 X93.477 Y96.530 E4.39250
+G1 X93.834 Y95.930 E4.42610
+G1 X94.257 Y95.351 E4.46058
+G1 X94.776 Y94.776 E4.49783
+G1 X95.351 Y94.257 E4.53509
+G1 X95.915 Y93.844 E4.56870
+G1 X96.530 Y93.477 E4.60318
+G1 X97.232 Y93.149 E4.64042
+G1 X97.966 Y92.897 E4.67775
+G1 X98.588 Y92.748 E4.70849
+G1 X99.357 Y92.639 E4.74588
+G1 X100.056 Y92.612 E4.77949
+G1 X100.771 Y92.652 E4.81397
+G1 X101.538 Y92.773 E4.85128
+G1 X102.213 Y92.951 E4.88488
+G1 X102.887 Y93.199 E4.91943
+G1 X103.518 Y93.503 E4.95308
+G1 X104.132 Y93.875 E4.98763
+G1 X104.693 Y94.293 E5.02128
+G1 X105.225 Y94.776 E5.05583
+G1 X105.695 Y95.293 E5.08948
+G1 X106.125 Y95.867 E5.12396
+G1 X106.524 Y96.532 E5.16127
+G1 X106.823 Y97.164 E5.19487
+G1 X107.065 Y97.839 E5.22935
+G1 X107.253 Y98.590 E5.26660
+G1 X107.361 Y99.359 E5.30392
+G1 X107.389 Y100.000 E5.33480
+G1 X107.361 Y100.641 E5.36567
+G1 X107.253 Y101.411 E5.40306
+G1 X107.087 Y102.090 E5.43667
+G1 X106.851 Y102.767 E5.47115
+G1 X106.523 Y103.470 E5.50846
+G1 X106.166 Y104.070 E5.54206
+G1 X105.743 Y104.649 E5.57654
+G1 X105.224 Y105.226 E5.61386
+G1 X104.707 Y105.695 E5.64746
+G1 X104.133 Y106.125 E5.68194
+G1 X103.468 Y106.524 E5.71925
+G1 X102.836 Y106.823 E5.75285
+G1 X102.161 Y107.065 E5.78733
+G1 X101.410 Y107.253 E5.82458
+G1 X100.641 Y107.361 E5.86190
+G1 X100.001 Y107.389 E5.89272
+G1 X99.301 Y107.355 E5.92645
+G1 X98.589 Y107.253 E5.96105
+G1 X97.966 Y107.103 E5.99185
+G1 X97.232 Y106.851 E6.02918
+G1 X96.530 Y106.523 E6.06644
+G1 X95.930 Y106.166 E6.10004
+G1 X95.351 Y105.743 E6.13452
+G1 X94.774 Y105.224 E6.17183
+G1 X94.305 Y104.707 E6.20544
+G1 X93.875 Y104.133 E6.23992
+G1 X93.476 Y103.468 E6.27723
+G1 X93.177 Y102.836 E6.31083
+G1 X92.962 Y102.237 E6.34143
+G1 X92.579 Y102.311 F7800.000
+G1 F1800
+G1 X92.368 Y101.483 E6.38252
+G1 X92.255 Y100.677 E6.42170
+G1 X92.225 Y100.000 E6.45426
+G1 X92.260 Y99.264 E6.48972
+G1 X92.368 Y98.516 E6.52607
+G1 X92.526 Y97.858 E6.55862
+G1 X92.791 Y97.088 E6.59780
+G1 X93.136 Y96.350 E6.63697
+G1 X93.512 Y95.717 E6.67238
+G1 X93.958 Y95.108 E6.70869
+G1 X94.502 Y94.502 E6.74785
+G1 X95.108 Y93.958 E6.78701
+G1 X95.701 Y93.522 E6.82243
+G1 X96.350 Y93.136 E6.85873
+G1 X97.088 Y92.791 E6.89789
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00882
+G1 X100.059 Y92.226 E7.04423
+G1 X100.812 Y92.268 E7.08054
+G1 X101.617 Y92.395 E7.11972
+G1 X102.329 Y92.583 E7.15514
+G1 X103.038 Y92.843 E7.19146
+G1 X103.702 Y93.163 E7.22690
+G1 X104.348 Y93.555 E7.26323
+G1 X104.938 Y93.995 E7.29866
+G1 X105.498 Y94.503 E7.33499
+G1 X105.993 Y95.048 E7.37042
+G1 X106.445 Y95.652 E7.40673
+G1 X106.865 Y96.350 E7.44591
+G1 X107.179 Y97.016 E7.48132
+G1 X107.435 Y97.727 E7.51763
+G1 X107.632 Y98.517 E7.55679
+G1 X107.745 Y99.323 E7.59598
+G1 X107.775 Y100.000 E7.62855
+G1 X107.745 Y100.677 E7.66112
+G1 X107.632 Y101.484 E7.70034
+G1 X107.457 Y102.199 E7.73575
+G1 X107.209 Y102.912 E7.77206
+G1 X106.864 Y103.650 E7.81124
+G1 X106.488 Y104.283 E7.84666
+G1 X106.042 Y104.892 E7.88296
+G1 X105.497 Y105.498 E7.92214
+G1 X104.952 Y105.993 E7.95756
+G1 X104.348 Y106.445 E7.99386
+G1 X103.650 Y106.865 E8.03305
+G1 X102.984 Y107.179 E8.06846
+G1 X102.273 Y107.435 E8.10476
+G1 X101.483 Y107.632 E8.14392
+G1 X100.677 Y107.745 E8.18311
+G1 X100.000 Y107.775 E8.21566
+G1 X99.264 Y107.740 E8.25113
+G1 X98.516 Y107.632 E8.28748
+G1 X97.858 Y107.474 E8.32002
+G1 X97.088 Y107.209 E8.35921
+G1 X96.350 Y106.864 E8.39838
+G1 X95.717 Y106.488 E8.43379
+G1 X95.108 Y106.042 E8.47010
+G1 X94.502 Y105.497 E8.50928
+G1 X94.007 Y104.952 E8.54469
+G1 X93.555 Y104.348 E8.58100
+G1 X93.135 Y103.650 E8.62018
+G1 X92.821 Y102.984 E8.65560
+G1 X92.599 Y102.368 E8.68708
+G1 X92.851 Y102.019 F7800.000
+G1 X93.275 Y101.455
+G1 F1811
+G1 X98.312 Y106.492 E9.02968
+G1 X98.716 Y106.589 E9.04964
+G1 X99.365 Y106.683 E9.08120
+G1 X100.003 Y106.713 E9.11190
+G1 X100.579 Y106.688 E9.13967
+G1 X101.281 Y106.589 E9.17373
+G1 X101.965 Y106.419 E9.20763
+G1 X102.577 Y106.199 E9.23892
+G1 X103.149 Y105.929 E9.26935
+G1 X103.756 Y105.564 E9.30339
+G1 X104.276 Y105.174 E9.33468
+G1 X104.747 Y104.747 E9.36525
+G1 X95.253 Y95.253 E10.01097
+G1 X95.778 Y94.781 E10.04491
+G1 X96.288 Y94.407 E10.07534
+G1 X96.847 Y94.074 E10.10662
+G1 X97.485 Y93.776 E10.14052
+G1 X98.155 Y93.545 E10.17459
+G1 X98.714 Y93.411 E10.20222
+G1 X99.418 Y93.312 E10.23642
+G1 X100.050 Y93.287 E10.26685
+G1 X100.700 Y93.324 E10.29814
+G1 X101.399 Y93.434 E10.33218
+G1 X101.692 Y93.511 E10.34676
+G1 X106.725 Y98.545 E10.68910
+G1 X106.779 Y101.178 F7800.000
+G1 F1811
+G1 X94.713 Y104.411 E11.28991
+G1 X93.220 Y98.822 F7800.000
+G1 F1811
+G1 X105.287 Y95.589 E11.89074
+G1 X104.624 Y105.093 F7800.000
+G1 F1811
+G1 X106.465 Y98.221 E12.23297
+G1 X106.419 Y98.035 E12.24215
+G1 X106.199 Y97.423 E12.27344
+G1 X105.929 Y96.851 E12.30387
+G1 X105.564 Y96.244 E12.33791
+G1 X105.174 Y95.724 E12.36919
+G1 X104.747 Y95.254 E12.39973
+G1 X104.263 Y94.815 E12.43116
+G1 X103.755 Y94.435 E12.46169
+G1 X103.196 Y94.097 E12.49312
+G1 X102.624 Y93.821 E12.52365
+G1 X102.010 Y93.595 E12.55508
+G1 X101.736 Y93.523 E12.56875
+G1 X98.264 Y106.481 E13.21396
+G1 X97.485 Y106.224 E13.25337
+G1 X96.846 Y105.926 E13.28730
+G1 X96.302 Y105.602 E13.31773
+G1 X95.777 Y105.218 E13.34902
+G1 X95.251 Y104.745 E13.38306
+G1 X94.826 Y104.276 E13.41349
+G1 X94.436 Y103.756 E13.44478
+G1 X94.071 Y103.149 E13.47882
+G1 X93.801 Y102.577 E13.50925
+G1 X93.581 Y101.965 E13.54053
+G1 X93.535 Y101.779 E13.54972
+G1 X95.376 Y94.910 E13.89178
+G1 E11.89178 F2400.00000
+G92 E0
+G1 X145.443 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1811
+G1 X161.625 Y100.996 E2.77830
+G1 X161.625 Y114.004 E3.40391
+G1 X145.443 Y114.004 E4.18221
+G1 X145.443 Y101.056 E4.80494
+G1 X145.058 Y100.611 F7800.000
+G1 F1811
+G1 X162.011 Y100.611 E5.62033
+G1 X162.011 Y114.389 E6.28304
+G1 X145.058 Y114.389 E7.09843
+G1 X145.058 Y100.671 E7.75826
+G1 X144.672 Y100.225 F7800.000
+G1 F1800
+G1 X162.396 Y100.225 E8.61074
+G1 X162.396 Y114.775 E9.31055
+G1 X144.672 Y114.775 E10.16303
+G1 X144.672 Y100.285 E10.85995
+G1 X145.061 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1811
+G1 X145.732 Y107.932 E11.19955
+G1 X145.732 Y113.715 E11.47767
+G1 X150.171 Y113.715 E11.69117
+G1 X153.502 Y101.285 E12.31005
+G1 X159.490 Y101.285 E12.59807
+G1 X156.113 Y113.888 E13.22560
+G1 X161.509 Y108.993 F7800.000
+G1 F1811
+G1 X153.802 Y101.285 E13.74984
+G1 X145.732 Y101.285 E14.13797
+G1 X145.732 Y101.396 E14.14328
+G1 X158.051 Y113.715 E14.98118
+G1 X149.871 Y113.715 E15.37462
+G1 X145.559 Y109.403 E15.66792
+G1 X145.559 Y112.176 F7800.000
+G1 F1811
+G1 X161.509 Y107.902 E16.46215
+G1 X161.509 Y101.914 F7800.000
+G1 F1811
+G1 X145.559 Y106.188 E17.25638
+G1 Z6.950 F7800.000
+G1 E15.25638 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1810
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1810
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1810
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1810
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1810
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1810
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1810
+G1 X93.127 Y101.340 E2.03568
+G1 X93.024 Y100.606 E2.07135
+G1 X92.997 Y100.000 E2.10053
+G1 X93.024 Y99.394 E2.12970
+G1 X93.127 Y98.660 E2.16537
+G1 X93.267 Y98.074 E2.19434
+G1 X93.507 Y97.377 E2.22980
+G1 X93.818 Y96.711 E2.26516
+G1 X94.157 Y96.140 E2.29707
+G1 X94.557 Y95.595 E2.32960
+G1 X95.049 Y95.049 E2.36494
+G1 X95.595 Y94.557 E2.40030
+G1 X96.130 Y94.164 E2.43221
+G1 X96.711 Y93.818 E2.46474
+G1 X97.377 Y93.507 E2.50008
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.392 Y93.024 E2.60007
+G1 X100.055 Y92.998 E2.63199
+G1 X100.730 Y93.036 E2.66452
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.399 Y93.877 E2.79995
+G1 X103.914 Y94.193 E2.82902
+G1 X104.449 Y94.593 E2.86115
+G1 X104.950 Y95.047 E2.89368
+G1 X105.445 Y95.596 E2.92922
+G1 X105.803 Y96.081 E2.95819
+G1 X106.184 Y96.714 E2.99375
+G1 X106.467 Y97.315 E3.02567
+G1 X106.696 Y97.951 E3.05820
+G1 X106.874 Y98.664 E3.09354
+G1 X106.976 Y99.394 E3.12900
+G1 X107.003 Y100.000 E3.15817
+G1 X106.976 Y100.606 E3.18735
+G1 X106.873 Y101.338 E3.22291
+G1 X106.716 Y101.983 E3.25483
+G1 X106.493 Y102.622 E3.28736
+G1 X106.181 Y103.291 E3.32291
+G1 X105.875 Y103.810 E3.35187
+G1 X105.442 Y104.407 E3.38733
+G1 X104.951 Y104.951 E3.42258
+G1 X104.404 Y105.445 E3.45805
+G1 X103.919 Y105.803 E3.48701
+G1 X103.286 Y106.184 E3.52258
+G1 X102.685 Y106.467 E3.55450
+G1 X102.049 Y106.696 E3.58702
+G1 X101.336 Y106.874 E3.62236
+G1 X100.606 Y106.976 E3.65782
+G1 X100.000 Y107.003 E3.68700
+G1 X99.394 Y106.976 E3.71617
+G1 X98.662 Y106.873 E3.75174
+G1 X98.017 Y106.716 E3.78366
+G1 X97.378 Y106.493 E3.81618
+G1 X96.709 Y106.181 E3.85173
+G1 X96.190 Y105.875 E3.88069
+G1 X95.593 Y105.442 E3.91615
+G1 X95.049 Y104.951 E3.95141
+G1 X94.558 Y104.407 E3.98666
+G1 X94.126 Y103.812 E4.02202
+G1 X93.792 Y103.239 E4.05394
+G1 X93.508 Y102.625 E4.08646
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1810
+G1 X92.748 Y101.412 E4.15073
+G1 X92.639 Y100.641 E4.18819
+G1 X92.611 Y100.000 E4.21906
+G1 X92.639 Y99.359 E4.24993
+G1 X92.748 Y98.588 E4.28739
+G1 X92.897 Y97.966 E4.31813
+G1 X93.149 Y97.232 E4.35546
+G1 X93.477 Y96.530 E4.39272
+G1 X93.835 Y95.927 E4.42645
+G1 X94.257 Y95.351 E4.46080
+G1 X94.776 Y94.776 E4.49805
+G1 X95.351 Y94.257 E4.53531
+G1 X95.917 Y93.842 E4.56905
+G1 X96.530 Y93.477 E4.60339
+G1 X97.232 Y93.149 E4.64064
+G1 X97.966 Y92.897 E4.67797
+G1 X98.588 Y92.748 E4.70871
+G1 X99.357 Y92.639 E4.74610
+G1 X100.058 Y92.612 E4.77984
+G1 X100.771 Y92.652 E4.81418
+G1 X101.539 Y92.773 E4.85156
+G1 X102.158 Y92.933 E4.88231
+G1 X102.887 Y93.199 E4.91963
+G1 X103.584 Y93.539 E4.95696
+G1 X104.131 Y93.874 E4.98777
+G1 X104.695 Y94.295 E5.02163
+G1 X105.224 Y94.775 E5.05598
+G1 X105.744 Y95.352 E5.09336
+G1 X106.124 Y95.866 E5.12410
+G1 X106.524 Y96.532 E5.16149
+G1 X106.824 Y97.167 E5.19522
+G1 X107.065 Y97.839 E5.22957
+G1 X107.253 Y98.590 E5.26682
+G1 X107.361 Y99.359 E5.30415
+G1 X107.389 Y100.000 E5.33502
+G1 X107.361 Y100.641 E5.36590
+G1 X107.253 Y101.411 E5.40328
+G1 X107.086 Y102.092 E5.43702
+G1 X106.851 Y102.767 E5.47137
+G1 X106.523 Y103.471 E5.50874
+G1 X106.198 Y104.022 E5.53949
+G1 X105.742 Y104.650 E5.57681
+G1 X105.224 Y105.224 E5.61401
+G1 X104.648 Y105.744 E5.65134
+G1 X104.134 Y106.124 E5.68208
+G1 X103.468 Y106.524 E5.71947
+G1 X102.833 Y106.824 E5.75321
+G1 X102.161 Y107.065 E5.78755
+G1 X101.410 Y107.253 E5.82480
+G1 X100.641 Y107.361 E5.86213
+G1 X100.000 Y107.389 E5.89300
+G1 X99.359 Y107.361 E5.92388
+G1 X98.589 Y107.253 E5.96127
+G1 X97.908 Y107.086 E5.99500
+G1 X97.233 Y106.851 E6.02935
+G1 X96.529 Y106.523 E6.06672
+G1 X95.978 Y106.198 E6.09747
+G1 X95.350 Y105.742 E6.13480
+G1 X94.776 Y105.224 E6.17199
+G1 X94.258 Y104.650 E6.20919
+G1 X93.803 Y104.023 E6.24645
+G1 X93.449 Y103.417 E6.28018
+G1 X93.150 Y102.769 E6.31453
+G1 X92.968 Y102.241 E6.34139
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34991
+G1 X92.368 Y101.484 E6.38244
+G1 X92.255 Y100.677 E6.42168
+G1 X92.225 Y100.000 E6.45425
+G1 X92.255 Y99.323 E6.48683
+G1 X92.368 Y98.516 E6.52606
+G1 X92.526 Y97.858 E6.55859
+G1 X92.791 Y97.088 E6.59778
+G1 X93.136 Y96.350 E6.63694
+G1 X93.513 Y95.714 E6.67249
+G1 X93.958 Y95.108 E6.70866
+G1 X94.502 Y94.502 E6.74782
+G1 X95.108 Y93.958 E6.78698
+G1 X95.704 Y93.521 E6.82253
+G1 X96.350 Y93.136 E6.85870
+G1 X97.088 Y92.791 E6.89786
+G1 X97.858 Y92.526 E6.93705
+G1 X98.516 Y92.368 E6.96958
+G1 X99.323 Y92.255 E7.00879
+G1 X100.061 Y92.226 E7.04434
+G1 X100.812 Y92.268 E7.08051
+G1 X101.617 Y92.395 E7.11972
+G1 X102.272 Y92.565 E7.15224
+G1 X103.038 Y92.843 E7.19143
+G1 X103.770 Y93.201 E7.23062
+G1 X104.347 Y93.554 E7.26317
+G1 X104.940 Y93.997 E7.29877
+G1 X105.497 Y94.502 E7.33494
+G1 X106.043 Y95.108 E7.37415
+G1 X106.445 Y95.652 E7.40667
+G1 X106.865 Y96.350 E7.44588
+G1 X107.180 Y97.019 E7.48143
+G1 X107.435 Y97.727 E7.51760
+G1 X107.632 Y98.517 E7.55676
+G1 X107.745 Y99.323 E7.59595
+G1 X107.775 Y100.000 E7.62853
+G1 X107.745 Y100.677 E7.66110
+G1 X107.632 Y101.484 E7.70031
+G1 X107.456 Y102.202 E7.73586
+G1 X107.209 Y102.912 E7.77203
+G1 X106.864 Y103.651 E7.81124
+G1 X106.521 Y104.234 E7.84377
+G1 X106.042 Y104.893 E7.88295
+G1 X105.498 Y105.498 E7.92209
+G1 X104.892 Y106.043 E7.96128
+G1 X104.348 Y106.445 E7.99381
+G1 X103.650 Y106.865 E8.03302
+G1 X102.981 Y107.180 E8.06857
+G1 X102.273 Y107.435 E8.10474
+G1 X101.483 Y107.632 E8.14390
+G1 X100.677 Y107.745 E8.18309
+G1 X100.000 Y107.775 E8.21566
+G1 X99.323 Y107.745 E8.24824
+G1 X98.516 Y107.632 E8.28745
+G1 X97.798 Y107.456 E8.32300
+G1 X97.088 Y107.209 E8.35917
+G1 X96.349 Y106.864 E8.39838
+G1 X95.766 Y106.521 E8.43090
+G1 X95.107 Y106.042 E8.47009
+G1 X94.502 Y105.498 E8.50923
+G1 X93.958 Y104.893 E8.54837
+G1 X93.479 Y104.234 E8.58754
+G1 X93.107 Y103.596 E8.62309
+G1 X92.792 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68705
+G1 X92.698 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1810
+G1 X98.309 Y106.489 E9.02962
+G1 X98.716 Y106.589 E9.04978
+G1 X99.421 Y106.688 E9.08398
+G1 X100.000 Y106.713 E9.11188
+G1 X100.579 Y106.688 E9.13978
+G1 X101.281 Y106.589 E9.17384
+G1 X101.965 Y106.419 E9.20775
+G1 X102.574 Y106.200 E9.23891
+G1 X103.149 Y105.928 E9.26946
+G1 X103.759 Y105.562 E9.30366
+G1 X104.220 Y105.221 E9.33129
+G1 X104.747 Y104.747 E9.36536
+G1 X95.253 Y95.253 E10.01108
+G1 X95.778 Y94.781 E10.04501
+G1 X96.290 Y94.406 E10.07557
+G1 X96.846 Y94.074 E10.10673
+G1 X97.485 Y93.776 E10.14063
+G1 X98.155 Y93.545 E10.17470
+G1 X98.714 Y93.411 E10.20233
+G1 X99.418 Y93.312 E10.23653
+G1 X100.053 Y93.287 E10.26709
+G1 X100.699 Y93.324 E10.29824
+G1 X101.401 Y93.435 E10.33242
+G1 X101.690 Y93.509 E10.34674
+G1 X106.725 Y98.545 E10.68923
+G1 X106.779 Y101.178 F7800.000
+G1 F1810
+G1 X94.717 Y104.410 E11.28987
+G1 X93.221 Y98.822 F7800.000
+G1 F1810
+G1 X105.283 Y95.590 E11.89051
+G1 X104.624 Y105.090 F7800.000
+G1 F1810
+G1 X106.465 Y98.221 E12.23257
+G1 X106.419 Y98.035 E12.24176
+G1 X106.200 Y97.426 E12.27292
+G1 X105.928 Y96.851 E12.30348
+G1 X105.562 Y96.241 E12.33768
+G1 X105.221 Y95.780 E12.36531
+G1 X104.745 Y95.252 E12.39948
+G1 X104.265 Y94.816 E12.43064
+G1 X103.752 Y94.433 E12.46147
+G1 X103.259 Y94.131 E12.48923
+G1 X102.623 Y93.821 E12.52330
+G1 X101.957 Y93.579 E12.55736
+G1 X101.736 Y93.521 E12.56836
+G1 X98.264 Y106.478 E13.21354
+G1 X98.099 Y106.438 E13.22170
+G1 X97.487 Y106.225 E13.25286
+G1 X96.843 Y105.925 E13.28704
+G1 X96.349 Y105.633 E13.31466
+G1 X95.776 Y105.217 E13.34873
+G1 X95.253 Y104.747 E13.38252
+G1 X94.783 Y104.224 E13.41632
+G1 X94.369 Y103.654 E13.45025
+G1 X94.048 Y103.105 E13.48081
+G1 X93.777 Y102.517 E13.51197
+G1 X93.545 Y101.845 E13.54614
+G1 X93.532 Y101.790 E13.54888
+G1 X95.376 Y94.910 E13.89145
+G1 E11.89145 F2400.00000
+G92 E0
+G1 X145.648 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1810
+G1 X161.830 Y100.996 E2.77830
+G1 X161.830 Y114.004 E3.40391
+G1 X145.648 Y114.004 E4.18221
+G1 X145.648 Y101.056 E4.80494
+G1 X145.263 Y100.611 F7800.000
+G1 F1810
+G1 X162.216 Y100.611 E5.62033
+G1 X162.216 Y114.389 E6.28304
+G1 X145.263 Y114.389 E7.09843
+G1 X145.263 Y100.671 E7.75826
+G1 X144.877 Y100.225 F7800.000
+G1 F1800
+G1 X162.602 Y100.225 E8.61074
+G1 X162.602 Y114.775 E9.31055
+G1 X144.877 Y114.775 E10.16303
+G1 X144.877 Y100.285 E10.85995
+G1 X145.267 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1810
+G1 X145.938 Y107.166 E11.16141
+G1 X145.938 Y113.715 E11.47637
+G1 X150.171 Y113.715 E11.67999
+G1 X153.502 Y101.285 E12.29888
+G1 X159.490 Y101.285 E12.58690
+G1 X156.113 Y113.888 E13.21443
+G1 X161.715 Y109.198 F7800.000
+G1 F1810
+G1 X153.802 Y101.285 E13.75263
+G1 X145.938 Y101.285 E14.13089
+G1 X145.938 Y101.601 E14.14607
+G1 X158.051 Y113.715 E14.97001
+G1 X149.871 Y113.715 E15.36345
+G1 X145.764 Y109.608 E15.64279
+G1 X145.764 Y112.121 F7800.000
+G1 F1810
+G1 X161.715 Y107.847 E16.43702
+G1 X161.715 Y101.859 F7800.000
+G1 F1810
+G1 X145.764 Y106.133 E17.23125
+G1 Z7.250 F7800.000
+G1 E15.23125 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1808
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1808
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1808
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1808
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1808
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1808
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1808
+G1 X93.126 Y101.338 E2.03578
+G1 X93.030 Y100.675 E2.06804
+G1 X92.997 Y99.998 E2.10065
+G1 X93.024 Y99.394 E2.12970
+G1 X93.126 Y98.664 E2.16516
+G1 X93.304 Y97.951 E2.20051
+G1 X93.529 Y97.324 E2.23256
+G1 X93.816 Y96.714 E2.26496
+G1 X94.197 Y96.081 E2.30051
+G1 X94.555 Y95.596 E2.32947
+G1 X95.049 Y95.049 E2.36494
+G1 X95.595 Y94.557 E2.40029
+G1 X96.132 Y94.163 E2.43234
+G1 X96.711 Y93.818 E2.46473
+G1 X97.377 Y93.507 E2.50008
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.392 Y93.024 E2.60007
+G1 X100.058 Y92.998 E2.63212
+G1 X100.730 Y93.036 E2.66451
+G1 X101.458 Y93.151 E2.69995
+G1 X102.102 Y93.321 E2.73200
+G1 X102.734 Y93.553 E2.76440
+G1 X103.399 Y93.877 E2.79995
+G1 X103.912 Y94.192 E2.82891
+G1 X104.505 Y94.638 E2.86459
+G1 X104.949 Y95.045 E2.89355
+G1 X105.443 Y95.595 E2.92911
+G1 X105.837 Y96.132 E2.96116
+G1 X106.182 Y96.711 E2.99356
+G1 X106.493 Y97.379 E3.02900
+G1 X106.713 Y98.008 E3.06105
+G1 X106.874 Y98.664 E3.09355
+G1 X106.970 Y99.325 E3.12569
+G1 X107.003 Y100.002 E3.15829
+G1 X106.976 Y100.606 E3.18734
+G1 X106.874 Y101.336 E3.22281
+G1 X106.696 Y102.049 E3.25816
+G1 X106.471 Y102.676 E3.29021
+G1 X106.184 Y103.286 E3.32260
+G1 X105.803 Y103.919 E3.35816
+G1 X105.445 Y104.404 E3.38712
+G1 X104.951 Y104.951 E3.42258
+G1 X104.407 Y105.442 E3.45783
+G1 X103.810 Y105.875 E3.49330
+G1 X103.291 Y106.181 E3.52226
+G1 X102.621 Y106.493 E3.55782
+G1 X101.992 Y106.713 E3.58987
+G1 X101.336 Y106.874 E3.62237
+G1 X100.675 Y106.970 E3.65451
+G1 X99.998 Y107.003 E3.68711
+G1 X99.394 Y106.976 E3.71617
+G1 X98.664 Y106.874 E3.75163
+G1 X97.951 Y106.696 E3.78698
+G1 X97.324 Y106.471 E3.81903
+G1 X96.714 Y106.184 E3.85143
+G1 X96.081 Y105.803 E3.88698
+G1 X95.596 Y105.445 E3.91594
+G1 X95.049 Y104.951 E3.95141
+G1 X94.558 Y104.407 E3.98666
+G1 X94.126 Y103.812 E4.02201
+G1 X93.790 Y103.236 E4.05406
+G1 X93.508 Y102.625 E4.08646
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1808
+G1 X92.747 Y101.411 E4.15079
+G1 X92.646 Y100.712 E4.18479
+G1 X92.611 Y99.998 E4.21913
+G1 X92.639 Y99.359 E4.24993
+G1 X92.747 Y98.590 E4.28726
+G1 X92.935 Y97.839 E4.32451
+G1 X93.173 Y97.176 E4.35838
+G1 X93.476 Y96.532 E4.39260
+G1 X93.876 Y95.866 E4.42998
+G1 X94.256 Y95.352 E4.46072
+G1 X94.776 Y94.776 E4.49805
+G1 X95.351 Y94.257 E4.53531
+G1 X95.919 Y93.841 E4.56917
+G1 X96.530 Y93.477 E4.60339
+G1 X97.232 Y93.149 E4.64064
+G1 X97.966 Y92.897 E4.67796
+G1 X98.588 Y92.748 E4.70871
+G1 X99.357 Y92.639 E4.74610
+G1 X100.061 Y92.612 E4.77996
+G1 X100.771 Y92.652 E4.81418
+G1 X101.537 Y92.773 E4.85149
+G1 X102.218 Y92.952 E4.88536
+G1 X102.886 Y93.198 E4.91957
+G1 X103.584 Y93.539 E4.95695
+G1 X104.129 Y93.873 E4.98770
+G1 X104.751 Y94.342 E5.02515
+G1 X105.223 Y94.774 E5.05590
+G1 X105.743 Y95.351 E5.09329
+G1 X106.159 Y95.919 E5.12715
+G1 X106.523 Y96.530 E5.16137
+G1 X106.851 Y97.233 E5.19868
+G1 X107.083 Y97.898 E5.23255
+G1 X107.253 Y98.590 E5.26682
+G1 X107.354 Y99.288 E5.30074
+G1 X107.389 Y100.002 E5.33509
+G1 X107.361 Y100.641 E5.36589
+G1 X107.253 Y101.410 E5.40322
+G1 X107.065 Y102.161 E5.44047
+G1 X106.827 Y102.824 E5.47434
+G1 X106.524 Y103.468 E5.50856
+G1 X106.124 Y104.134 E5.54594
+G1 X105.744 Y104.648 E5.57668
+G1 X105.224 Y105.224 E5.61401
+G1 X104.650 Y105.742 E5.65120
+G1 X104.022 Y106.198 E5.68853
+G1 X103.471 Y106.523 E5.71927
+G1 X102.767 Y106.851 E5.75666
+G1 X102.102 Y107.083 E5.79053
+G1 X101.410 Y107.253 E5.82480
+G1 X100.712 Y107.354 E5.85872
+G1 X99.998 Y107.389 E5.89307
+G1 X99.359 Y107.361 E5.92387
+G1 X98.590 Y107.253 E5.96120
+G1 X97.839 Y107.065 E5.99845
+G1 X97.176 Y106.827 E6.03232
+G1 X96.532 Y106.524 E6.06654
+G1 X95.866 Y106.124 E6.10392
+G1 X95.352 Y105.744 E6.13466
+G1 X94.776 Y105.224 E6.17199
+G1 X94.258 Y104.650 E6.20918
+G1 X93.803 Y104.023 E6.24644
+G1 X93.448 Y103.415 E6.28031
+G1 X93.150 Y102.769 E6.31452
+G1 X92.968 Y102.241 E6.34139
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.142 E6.34991
+G1 X92.368 Y101.484 E6.38246
+G1 X92.262 Y100.749 E6.41819
+G1 X92.225 Y99.999 E6.45427
+G1 X92.255 Y99.323 E6.48682
+G1 X92.368 Y98.517 E6.52601
+G1 X92.565 Y97.726 E6.56517
+G1 X92.816 Y97.028 E6.60085
+G1 X93.135 Y96.350 E6.63689
+G1 X93.555 Y95.652 E6.67610
+G1 X93.957 Y95.108 E6.70863
+G1 X94.502 Y94.502 E6.74781
+G1 X95.108 Y93.958 E6.78698
+G1 X95.706 Y93.519 E6.82266
+G1 X96.350 Y93.136 E6.85870
+G1 X97.088 Y92.791 E6.89786
+G1 X97.858 Y92.526 E6.93705
+G1 X98.516 Y92.368 E6.96957
+G1 X99.323 Y92.255 E7.00878
+G1 X100.064 Y92.226 E7.04447
+G1 X100.812 Y92.268 E7.08050
+G1 X101.617 Y92.395 E7.11969
+G1 X102.334 Y92.584 E7.15537
+G1 X103.037 Y92.843 E7.19141
+G1 X103.770 Y93.201 E7.23061
+G1 X104.347 Y93.554 E7.26314
+G1 X104.998 Y94.045 E7.30238
+G1 X105.497 Y94.502 E7.33490
+G1 X106.042 Y95.108 E7.37411
+G1 X106.481 Y95.706 E7.40980
+G1 X106.864 Y96.350 E7.44583
+G1 X107.209 Y97.088 E7.48502
+G1 X107.453 Y97.788 E7.52070
+G1 X107.632 Y98.517 E7.55676
+G1 X107.738 Y99.251 E7.59246
+G1 X107.775 Y100.001 E7.62855
+G1 X107.745 Y100.677 E7.66109
+G1 X107.632 Y101.483 E7.70028
+G1 X107.435 Y102.274 E7.73944
+G1 X107.184 Y102.972 E7.77513
+G1 X106.865 Y103.650 E7.81116
+G1 X106.445 Y104.348 E7.85037
+G1 X106.043 Y104.892 E7.88290
+G1 X105.498 Y105.498 E7.92209
+G1 X104.893 Y106.042 E7.96123
+G1 X104.234 Y106.521 E8.00042
+G1 X103.651 Y106.864 E8.03294
+G1 X102.912 Y107.209 E8.07215
+G1 X102.212 Y107.453 E8.10784
+G1 X101.483 Y107.632 E8.14390
+G1 X100.749 Y107.738 E8.17960
+G1 X99.999 Y107.775 E8.21568
+G1 X99.323 Y107.745 E8.24823
+G1 X98.517 Y107.632 E8.28742
+G1 X97.726 Y107.435 E8.32658
+G1 X97.028 Y107.184 E8.36226
+G1 X96.350 Y106.865 E8.39830
+G1 X95.652 Y106.445 E8.43751
+G1 X95.108 Y106.043 E8.47004
+G1 X94.502 Y105.498 E8.50922
+G1 X93.958 Y104.893 E8.54837
+G1 X93.479 Y104.234 E8.58753
+G1 X93.106 Y103.593 E8.62321
+G1 X92.792 Y102.913 E8.65925
+G1 X92.603 Y102.366 E8.68705
+G1 X92.698 Y102.174 F7800.000
+G1 X93.273 Y101.453
+G1 F1808
+G1 X98.306 Y106.487 E9.02941
+G1 X98.719 Y106.589 E9.04988
+G1 X99.421 Y106.688 E9.08394
+G1 X99.997 Y106.713 E9.11169
+G1 X100.647 Y106.682 E9.14299
+G1 X101.281 Y106.590 E9.17379
+G1 X101.910 Y106.435 E9.20495
+G1 X102.512 Y106.225 E9.23564
+G1 X103.157 Y105.925 E9.26983
+G1 X103.652 Y105.633 E9.29746
+G1 X104.224 Y105.217 E9.33152
+G1 X104.747 Y104.747 E9.36532
+G1 X95.253 Y95.253 E10.01104
+G1 X95.778 Y94.781 E10.04497
+G1 X96.292 Y94.404 E10.07566
+G1 X96.846 Y94.074 E10.10669
+G1 X97.485 Y93.776 E10.14060
+G1 X98.155 Y93.545 E10.17466
+G1 X98.714 Y93.411 E10.20229
+G1 X99.418 Y93.312 E10.23648
+G1 X100.055 Y93.287 E10.26717
+G1 X100.699 Y93.324 E10.29820
+G1 X101.398 Y93.434 E10.33224
+G1 X101.692 Y93.512 E10.34684
+G1 X106.726 Y98.546 E10.68924
+G1 X106.779 Y101.178 F7800.000
+G1 F1808
+G1 X94.717 Y104.410 E11.28988
+G1 X93.221 Y98.822 F7800.000
+G1 F1808
+G1 X105.283 Y95.590 E11.89052
+G1 X104.624 Y105.090 F7800.000
+G1 F1808
+G1 X106.466 Y98.216 E12.23280
+G1 X106.225 Y97.488 E12.26970
+G1 X105.926 Y96.846 E12.30374
+G1 X105.596 Y96.292 E12.33477
+G1 X105.219 Y95.778 E12.36546
+G1 X104.743 Y95.249 E12.39966
+G1 X104.319 Y94.861 E12.42728
+G1 X103.749 Y94.431 E12.46162
+G1 X103.259 Y94.131 E12.48925
+G1 X102.621 Y93.820 E12.52343
+G1 X102.015 Y93.597 E12.55446
+G1 X101.735 Y93.523 E12.56838
+G1 X98.265 Y106.476 E13.21335
+G1 X98.035 Y106.419 E13.22475
+G1 X97.434 Y106.203 E13.25544
+G1 X96.851 Y105.928 E13.28647
+G1 X96.241 Y105.562 E13.32065
+G1 X95.780 Y105.221 E13.34827
+G1 X95.253 Y104.747 E13.38234
+G1 X94.783 Y104.224 E13.41613
+G1 X94.369 Y103.654 E13.45006
+G1 X94.047 Y103.103 E13.48075
+G1 X93.777 Y102.517 E13.51178
+G1 X93.545 Y101.845 E13.54596
+G1 X93.532 Y101.790 E13.54869
+G1 X95.376 Y94.910 E13.89127
+G1 E11.89127 F2400.00000
+G92 E0
+G1 X145.854 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1808
+G1 X162.036 Y100.996 E2.77830
+G1 X162.036 Y114.004 E3.40391
+G1 X145.854 Y114.004 E4.18221
+G1 X145.854 Y101.056 E4.80494
+G1 X145.468 Y100.611 F7800.000
+G1 F1808
+G1 X162.421 Y100.611 E5.62033
+G1 X162.421 Y114.389 E6.28304
+G1 X145.468 Y114.389 E7.09843
+G1 X145.468 Y100.671 E7.75826
+G1 X145.082 Y100.225 F7800.000
+G1 F1800
+G1 X162.807 Y100.225 E8.61074
+G1 X162.807 Y114.775 E9.31055
+G1 X145.082 Y114.775 E10.16303
+G1 X145.082 Y100.285 E10.85995
+G1 X145.472 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1808
+G1 X146.143 Y106.400 E11.12327
+G1 X146.143 Y113.715 E11.47507
+G1 X150.171 Y113.715 E11.66882
+G1 X153.502 Y101.285 E12.28771
+G1 X159.490 Y101.285 E12.57573
+G1 X156.113 Y113.888 E13.20326
+G1 X161.920 Y109.403 F7800.000
+G1 F1808
+G1 X153.802 Y101.285 E13.75542
+G1 X146.143 Y101.285 E14.12380
+G1 X146.143 Y101.806 E14.14886
+G1 X158.051 Y113.715 E14.95884
+G1 X149.871 Y113.715 E15.35228
+G1 X145.969 Y109.813 E15.61766
+G1 X145.969 Y112.066 F7800.000
+G1 F1808
+G1 X161.920 Y107.792 E16.41189
+G1 X161.920 Y101.804 F7800.000
+G1 F1808
+G1 X145.969 Y106.078 E17.20612
+G1 Z7.550 F7800.000
+G1 E15.20612 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1807
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1807
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1807
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1807
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1807
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1807
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.305 Y102.051 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1807
+G1 X93.126 Y101.336 E2.03541
+G1 X93.024 Y100.606 E2.07088
+G1 X92.997 Y100.000 E2.10005
+G1 X93.024 Y99.394 E2.12922
+G1 X93.127 Y98.660 E2.16489
+G1 X93.267 Y98.074 E2.19386
+G1 X93.507 Y97.377 E2.22932
+G1 X93.818 Y96.711 E2.26467
+G1 X94.160 Y96.136 E2.29685
+G1 X94.557 Y95.595 E2.32911
+G1 X95.049 Y95.049 E2.36446
+G1 X95.595 Y94.557 E2.39981
+G1 X96.134 Y94.161 E2.43199
+G1 X96.711 Y93.818 E2.46425
+G1 X97.377 Y93.507 E2.49960
+G1 X98.074 Y93.267 E2.53506
+G1 X98.660 Y93.127 E2.56403
+G1 X99.392 Y93.024 E2.59959
+G1 X100.060 Y92.998 E2.63177
+G1 X100.730 Y93.036 E2.66403
+G1 X101.460 Y93.151 E2.69959
+G1 X102.043 Y93.302 E2.72855
+G1 X102.736 Y93.554 E2.76401
+G1 X103.399 Y93.877 E2.79948
+G1 X103.914 Y94.193 E2.82854
+G1 X104.453 Y94.596 E2.86092
+G1 X104.950 Y95.047 E2.89319
+G1 X105.445 Y95.596 E2.92875
+G1 X105.803 Y96.081 E2.95771
+G1 X106.184 Y96.714 E2.99327
+G1 X106.469 Y97.320 E3.02545
+G1 X106.696 Y97.951 E3.05771
+G1 X106.874 Y98.664 E3.09306
+G1 X106.976 Y99.394 E3.12852
+G1 X107.003 Y100.000 E3.15770
+G1 X106.976 Y100.606 E3.18687
+G1 X106.873 Y101.340 E3.22254
+G1 X106.733 Y101.926 E3.25150
+G1 X106.493 Y102.623 E3.28697
+G1 X106.182 Y103.289 E3.32232
+G1 X105.840 Y103.864 E3.35450
+G1 X105.443 Y104.405 E3.38676
+G1 X104.951 Y104.951 E3.42211
+G1 X104.404 Y105.445 E3.45757
+G1 X103.919 Y105.803 E3.48653
+G1 X103.286 Y106.184 E3.52209
+G1 X102.680 Y106.469 E3.55427
+G1 X102.049 Y106.696 E3.58654
+G1 X101.336 Y106.874 E3.62188
+G1 X100.606 Y106.976 E3.65735
+G1 X100.000 Y107.003 E3.68652
+G1 X99.394 Y106.976 E3.71569
+G1 X98.660 Y106.873 E3.75136
+G1 X98.074 Y106.733 E3.78033
+G1 X97.377 Y106.493 E3.81579
+G1 X96.711 Y106.182 E3.85114
+G1 X96.136 Y105.840 E3.88332
+G1 X95.595 Y105.443 E3.91558
+G1 X95.047 Y104.950 E3.95103
+G1 X94.597 Y104.455 E3.98321
+G1 X94.196 Y103.917 E4.01547
+G1 X93.816 Y103.286 E4.05092
+G1 X93.531 Y102.680 E4.08309
+G1 X93.325 Y102.107 E4.11241
+G1 X92.942 Y102.181 F7800.000
+G1 F1807
+G1 X92.747 Y101.410 E4.15066
+G1 X92.639 Y100.641 E4.18798
+G1 X92.611 Y100.000 E4.21886
+G1 X92.639 Y99.359 E4.24973
+G1 X92.748 Y98.588 E4.28719
+G1 X92.897 Y97.966 E4.31793
+G1 X93.149 Y97.232 E4.35526
+G1 X93.477 Y96.530 E4.39251
+G1 X93.838 Y95.923 E4.42651
+G1 X94.257 Y95.351 E4.46059
+G1 X94.776 Y94.776 E4.49785
+G1 X95.351 Y94.257 E4.53510
+G1 X95.921 Y93.839 E4.56910
+G1 X96.530 Y93.477 E4.60319
+G1 X97.232 Y93.149 E4.64044
+G1 X97.966 Y92.897 E4.67777
+G1 X98.588 Y92.748 E4.70851
+G1 X99.357 Y92.639 E4.74590
+G1 X100.064 Y92.612 E4.77989
+G1 X100.771 Y92.652 E4.81398
+G1 X101.539 Y92.773 E4.85136
+G1 X102.158 Y92.933 E4.88211
+G1 X102.887 Y93.199 E4.91943
+G1 X103.584 Y93.539 E4.95676
+G1 X104.131 Y93.874 E4.98756
+G1 X104.699 Y94.298 E5.02169
+G1 X105.224 Y94.775 E5.05577
+G1 X105.744 Y95.352 E5.09315
+G1 X106.124 Y95.866 E5.12390
+G1 X106.524 Y96.532 E5.16128
+G1 X106.826 Y97.172 E5.19528
+G1 X107.065 Y97.839 E5.22937
+G1 X107.253 Y98.590 E5.26662
+G1 X107.361 Y99.359 E5.30394
+G1 X107.389 Y100.000 E5.33482
+G1 X107.361 Y100.641 E5.36569
+G1 X107.252 Y101.412 E5.40315
+G1 X107.103 Y102.034 E5.43389
+G1 X106.851 Y102.768 E5.47122
+G1 X106.523 Y103.470 E5.50847
+G1 X106.162 Y104.077 E5.54247
+G1 X105.743 Y104.649 E5.57655
+G1 X105.224 Y105.224 E5.61381
+G1 X104.648 Y105.744 E5.65113
+G1 X104.134 Y106.124 E5.68188
+G1 X103.468 Y106.524 E5.71926
+G1 X102.828 Y106.826 E5.75326
+G1 X102.161 Y107.065 E5.78735
+G1 X101.410 Y107.253 E5.82460
+G1 X100.641 Y107.361 E5.86193
+G1 X100.000 Y107.389 E5.89280
+G1 X99.359 Y107.361 E5.92367
+G1 X98.588 Y107.252 E5.96113
+G1 X97.966 Y107.103 E5.99187
+G1 X97.232 Y106.851 E6.02920
+G1 X96.530 Y106.523 E6.06645
+G1 X95.923 Y106.162 E6.10045
+G1 X95.351 Y105.743 E6.13454
+G1 X94.775 Y105.224 E6.17185
+G1 X94.300 Y104.700 E6.20585
+G1 X93.875 Y104.133 E6.23993
+G1 X93.476 Y103.468 E6.27724
+G1 X93.174 Y102.828 E6.31124
+G1 X92.962 Y102.237 E6.34144
+G1 X92.579 Y102.311 F7800.000
+G1 F1800
+G1 X92.368 Y101.483 E6.38253
+G1 X92.255 Y100.677 E6.42172
+G1 X92.225 Y100.000 E6.45429
+G1 X92.255 Y99.323 E6.48687
+G1 X92.368 Y98.516 E6.52610
+G1 X92.526 Y97.858 E6.55863
+G1 X92.791 Y97.088 E6.59782
+G1 X93.136 Y96.350 E6.63698
+G1 X93.516 Y95.710 E6.67279
+G1 X93.958 Y95.108 E6.70870
+G1 X94.502 Y94.502 E6.74786
+G1 X95.108 Y93.958 E6.78702
+G1 X95.708 Y93.518 E6.82284
+G1 X96.350 Y93.136 E6.85874
+G1 X97.088 Y92.791 E6.89790
+G1 X97.858 Y92.526 E6.93709
+G1 X98.516 Y92.368 E6.96962
+G1 X99.323 Y92.255 E7.00883
+G1 X100.067 Y92.226 E7.04464
+G1 X100.812 Y92.268 E7.08055
+G1 X101.617 Y92.395 E7.11976
+G1 X102.272 Y92.565 E7.15228
+G1 X103.038 Y92.843 E7.19147
+G1 X103.770 Y93.201 E7.23066
+G1 X104.347 Y93.554 E7.26321
+G1 X104.944 Y94.000 E7.29907
+G1 X105.497 Y94.502 E7.33498
+G1 X106.043 Y95.108 E7.37418
+G1 X106.445 Y95.652 E7.40671
+G1 X106.865 Y96.350 E7.44592
+G1 X107.182 Y97.024 E7.48174
+G1 X107.435 Y97.726 E7.51764
+G1 X107.632 Y98.517 E7.55680
+G1 X107.745 Y99.323 E7.59599
+G1 X107.775 Y100.000 E7.62857
+G1 X107.745 Y100.677 E7.66114
+G1 X107.632 Y101.484 E7.70038
+G1 X107.474 Y102.142 E7.73290
+G1 X107.209 Y102.912 E7.77209
+G1 X106.864 Y103.650 E7.81125
+G1 X106.484 Y104.290 E7.84707
+G1 X106.042 Y104.892 E7.88297
+G1 X105.498 Y105.498 E7.92213
+G1 X104.892 Y106.043 E7.96132
+G1 X104.348 Y106.445 E7.99385
+G1 X103.650 Y106.865 E8.03306
+G1 X102.976 Y107.182 E8.06887
+G1 X102.274 Y107.435 E8.10478
+G1 X101.483 Y107.632 E8.14394
+G1 X100.677 Y107.745 E8.18313
+G1 X100.000 Y107.775 E8.21570
+G1 X99.323 Y107.745 E8.24828
+G1 X98.516 Y107.632 E8.28751
+G1 X97.858 Y107.474 E8.32004
+G1 X97.088 Y107.209 E8.35923
+G1 X96.350 Y106.864 E8.39839
+G1 X95.710 Y106.484 E8.43421
+G1 X95.108 Y106.042 E8.47011
+G1 X94.502 Y105.497 E8.50929
+G1 X94.002 Y104.946 E8.54511
+G1 X93.555 Y104.348 E8.58101
+G1 X93.135 Y103.650 E8.62020
+G1 X92.818 Y102.976 E8.65601
+G1 X92.599 Y102.368 E8.68709
+G1 X92.851 Y102.019 F7800.000
+G1 X93.275 Y101.455
+G1 F1807
+G1 X98.312 Y106.492 E9.02969
+G1 X98.714 Y106.589 E9.04955
+G1 X99.421 Y106.688 E9.08389
+G1 X100.000 Y106.713 E9.11178
+G1 X100.579 Y106.688 E9.13968
+G1 X101.281 Y106.589 E9.17375
+G1 X101.965 Y106.419 E9.20766
+G1 X102.570 Y106.201 E9.23856
+G1 X103.149 Y105.928 E9.26938
+G1 X103.759 Y105.562 E9.30357
+G1 X104.220 Y105.221 E9.33120
+G1 X104.747 Y104.747 E9.36526
+G1 X95.253 Y95.253 E10.01099
+G1 X95.777 Y94.781 E10.04491
+G1 X96.294 Y94.403 E10.07572
+G1 X96.846 Y94.074 E10.10662
+G1 X97.485 Y93.776 E10.14054
+G1 X98.155 Y93.545 E10.17460
+G1 X98.714 Y93.411 E10.20223
+G1 X99.418 Y93.312 E10.23642
+G1 X100.058 Y93.287 E10.26724
+G1 X100.699 Y93.324 E10.29814
+G1 X101.401 Y93.435 E10.33232
+G1 X101.690 Y93.509 E10.34665
+G1 X106.725 Y98.545 E10.68914
+G1 X106.779 Y101.178 F7800.000
+G1 F1807
+G1 X94.714 Y104.411 E11.28992
+G1 X93.221 Y98.822 F7800.000
+G1 F1807
+G1 X105.283 Y95.590 E11.89056
+G1 X104.624 Y105.090 F7800.000
+G1 F1807
+G1 X106.465 Y98.221 E12.23263
+G1 X106.419 Y98.035 E12.24183
+G1 X106.201 Y97.430 E12.27273
+G1 X105.928 Y96.851 E12.30354
+G1 X105.562 Y96.241 E12.33773
+G1 X105.221 Y95.780 E12.36536
+G1 X104.745 Y95.251 E12.39955
+G1 X104.269 Y94.820 E12.43045
+G1 X103.751 Y94.433 E12.46153
+G1 X103.259 Y94.131 E12.48929
+G1 X102.623 Y93.821 E12.52335
+G1 X101.957 Y93.579 E12.55742
+G1 X101.736 Y93.521 E12.56841
+G1 X98.264 Y106.481 E13.21370
+G1 X97.485 Y106.224 E13.25311
+G1 X96.846 Y105.926 E13.28703
+G1 X96.296 Y105.598 E13.31784
+G1 X95.777 Y105.219 E13.34875
+G1 X95.251 Y104.745 E13.38279
+G1 X94.821 Y104.271 E13.41360
+G1 X94.436 Y103.756 E13.44450
+G1 X94.072 Y103.149 E13.47854
+G1 X93.799 Y102.570 E13.50936
+G1 X93.581 Y101.965 E13.54026
+G1 X93.535 Y101.779 E13.54946
+G1 X95.376 Y94.910 E13.89153
+G1 E11.89153 F2400.00000
+G92 E0
+G1 X146.059 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1807
+G1 X162.241 Y100.996 E2.77830
+G1 X162.241 Y114.004 E3.40391
+G1 X146.059 Y114.004 E4.18221
+G1 X146.059 Y101.056 E4.80494
+G1 X145.673 Y100.611 F7800.000
+G1 F1807
+G1 X162.626 Y100.611 E5.62033
+G1 X162.626 Y114.389 E6.28304
+G1 X145.673 Y114.389 E7.09843
+G1 X145.673 Y100.671 E7.75826
+G1 X145.288 Y100.225 F7800.000
+G1 F1800
+G1 X163.012 Y100.225 E8.61074
+G1 X163.012 Y114.775 E9.31055
+G1 X145.288 Y114.775 E10.16303
+G1 X145.288 Y100.285 E10.85995
+G1 X145.677 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F1807
+G1 X146.348 Y105.634 E11.08513
+G1 X146.348 Y113.715 E11.47377
+G1 X150.171 Y113.715 E11.65765
+G1 X153.502 Y101.285 E12.27654
+G1 X159.490 Y101.285 E12.56456
+G1 X156.113 Y113.888 E13.19208
+G1 X162.125 Y109.608 F7800.000
+G1 F1807
+G1 X153.802 Y101.285 E13.75821
+G1 X146.348 Y101.285 E14.11672
+G1 X146.348 Y102.012 E14.15165
+G1 X158.051 Y113.715 E14.94767
+G1 X149.871 Y113.715 E15.34111
+G1 X146.175 Y110.018 E15.59252
+G1 X146.175 Y112.011 F7800.000
+G1 F1807
+G1 X162.125 Y107.737 E16.38676
+G1 X162.125 Y101.749 F7800.000
+G1 F1807
+G1 X146.175 Y106.023 E17.18099
+G1 Z7.850 F7800.000
+G1 E15.18099 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1851
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1851
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1851
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1851
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1851
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1851
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1851
+G1 X93.115 Y101.274 E2.03891
+G1 X93.024 Y100.612 E2.07104
+G1 X92.999 Y99.873 E2.10661
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.544 E2.17103
+G1 X93.341 Y97.832 E2.20649
+G1 X93.552 Y97.268 E2.23546
+G1 X93.876 Y96.603 E2.27101
+G1 X94.230 Y96.032 E2.30332
+G1 X94.634 Y95.500 E2.33546
+G1 X95.137 Y94.961 E2.37090
+G1 X95.642 Y94.519 E2.40321
+G1 X96.186 Y94.127 E2.43544
+G1 X96.768 Y93.788 E2.46784
+G1 X97.375 Y93.508 E2.49998
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.392 Y93.024 E2.60006
+G1 X100.063 Y92.998 E2.63237
+G1 X100.730 Y93.036 E2.66450
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.397 Y93.876 E2.79983
+G1 X103.968 Y94.230 E2.83214
+G1 X104.500 Y94.634 E2.86428
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96427
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19322
+G1 X106.849 Y101.460 E3.22889
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32857
+G1 X105.735 Y104.018 E3.36391
+G1 X105.323 Y104.549 E3.39622
+G1 X104.866 Y105.036 E3.42836
+G1 X104.308 Y105.521 E3.46392
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.621 Y106.493 E3.55782
+G1 X101.987 Y106.714 E3.59013
+G1 X101.338 Y106.873 E3.62226
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69308
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75750
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92810
+G1 X94.964 Y104.866 E3.95716
+G1 X94.519 Y104.358 E3.98968
+G1 X94.127 Y103.814 E4.02191
+G1 X93.788 Y103.232 E4.05431
+G1 X93.508 Y102.625 E4.08645
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1851
+G1 X92.897 Y102.035 E4.11994
+G1 X92.735 Y101.345 E4.15407
+G1 X92.640 Y100.645 E4.18803
+G1 X92.612 Y99.868 E4.22541
+G1 X92.652 Y99.230 E4.25616
+G1 X92.773 Y98.464 E4.29348
+G1 X92.974 Y97.714 E4.33081
+G1 X93.198 Y97.115 E4.36155
+G1 X93.538 Y96.417 E4.39893
+G1 X93.912 Y95.814 E4.43306
+G1 X94.339 Y95.252 E4.46702
+G1 X94.868 Y94.684 E4.50433
+G1 X95.402 Y94.217 E4.53846
+G1 X95.976 Y93.803 E4.57247
+G1 X96.590 Y93.446 E4.60666
+G1 X97.231 Y93.150 E4.64061
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74612
+G1 X100.066 Y92.612 E4.78025
+G1 X100.771 Y92.652 E4.81420
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88234
+G1 X102.887 Y93.199 E4.91966
+G1 X103.583 Y93.538 E4.95691
+G1 X104.186 Y93.912 E4.99104
+G1 X104.748 Y94.339 E5.02500
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13045
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.232 E5.19865
+G1 X107.103 Y97.966 E5.23598
+G1 X107.252 Y98.588 E5.26672
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.539 E5.40957
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51484
+G1 X106.052 Y104.239 E5.55209
+G1 X105.617 Y104.800 E5.58622
+G1 X105.133 Y105.314 E5.62017
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71931
+G1 X102.767 Y106.851 E5.75669
+G1 X102.097 Y107.085 E5.79082
+G1 X101.411 Y107.253 E5.82477
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93010
+G1 X98.464 Y107.227 E5.96742
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03549
+G1 X96.418 Y106.462 E6.07282
+G1 X95.762 Y106.052 E6.11002
+G1 X95.151 Y105.575 E6.14734
+G1 X94.686 Y105.134 E6.17814
+G1 X94.217 Y104.598 E6.21240
+G1 X93.803 Y104.024 E6.24641
+G1 X93.446 Y103.410 E6.28060
+G1 X93.150 Y102.769 E6.31455
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34992
+G1 X92.355 Y101.415 E6.38586
+G1 X92.255 Y100.678 E6.42163
+G1 X92.226 Y99.863 E6.46084
+G1 X92.268 Y99.188 E6.49337
+G1 X92.395 Y98.384 E6.53256
+G1 X92.606 Y97.597 E6.57175
+G1 X92.843 Y96.963 E6.60428
+G1 X93.200 Y96.230 E6.64348
+G1 X93.594 Y95.595 E6.67943
+G1 X94.044 Y95.003 E6.71520
+G1 X94.600 Y94.407 E6.75439
+G1 X95.162 Y93.915 E6.79034
+G1 X95.766 Y93.480 E6.82613
+G1 X96.412 Y93.103 E6.86210
+G1 X97.087 Y92.792 E6.89787
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00881
+G1 X100.070 Y92.226 E7.04476
+G1 X100.812 Y92.268 E7.08053
+G1 X101.617 Y92.395 E7.11974
+G1 X102.272 Y92.565 E7.15227
+G1 X103.038 Y92.843 E7.19146
+G1 X103.770 Y93.200 E7.23062
+G1 X104.405 Y93.594 E7.26657
+G1 X104.997 Y94.044 E7.30234
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38069
+G1 X106.520 Y95.766 E7.41326
+G1 X106.864 Y96.349 E7.44584
+G1 X107.209 Y97.088 E7.48503
+G1 X107.474 Y97.858 E7.52422
+G1 X107.632 Y98.516 E7.55674
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.137 E7.63512
+G1 X107.732 Y100.812 E7.66765
+G1 X107.605 Y101.617 E7.70688
+G1 X107.435 Y102.272 E7.73941
+G1 X107.157 Y103.038 E7.77860
+G1 X106.800 Y103.769 E7.81774
+G1 X106.368 Y104.460 E7.85690
+G1 X105.911 Y105.050 E7.89285
+G1 X105.401 Y105.592 E7.92862
+G1 X104.786 Y106.127 E7.96783
+G1 X104.234 Y106.520 E8.00040
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07219
+G1 X102.206 Y107.455 E8.10814
+G1 X101.484 Y107.632 E8.14391
+G1 X100.678 Y107.745 E8.18307
+G1 X99.863 Y107.774 E8.22226
+G1 X99.188 Y107.732 E8.25478
+G1 X98.384 Y107.605 E8.29397
+G1 X97.597 Y107.394 E8.33316
+G1 X96.963 Y107.157 E8.36569
+G1 X96.231 Y106.800 E8.40488
+G1 X95.541 Y106.369 E8.44402
+G1 X94.899 Y105.867 E8.48320
+G1 X94.408 Y105.401 E8.51575
+G1 X93.915 Y104.838 E8.55175
+G1 X93.480 Y104.234 E8.58754
+G1 X93.103 Y103.588 E8.62351
+G1 X92.792 Y102.913 E8.65928
+G1 X92.603 Y102.366 E8.68708
+G1 X92.697 Y102.174 F7800.000
+G1 X93.276 Y101.456
+G1 F1851
+G1 X98.306 Y106.486 E9.02919
+G1 X98.604 Y106.566 E9.04405
+G1 X99.304 Y106.677 E9.07812
+G1 X99.877 Y106.712 E9.10574
+G1 X100.585 Y106.687 E9.13981
+G1 X101.283 Y106.589 E9.17373
+G1 X101.905 Y106.437 E9.20450
+G1 X102.512 Y106.225 E9.23545
+G1 X103.157 Y105.925 E9.26963
+G1 X103.656 Y105.630 E9.29753
+G1 X104.129 Y105.293 E9.32543
+G1 X104.744 Y104.744 E9.36511
+G1 X95.257 Y95.257 E10.01038
+G1 X95.823 Y94.745 E10.04705
+G1 X96.344 Y94.370 E10.07794
+G1 X96.902 Y94.045 E10.10902
+G1 X97.483 Y93.777 E10.13979
+G1 X98.155 Y93.545 E10.17398
+G1 X98.714 Y93.411 E10.20161
+G1 X99.417 Y93.312 E10.23579
+G1 X100.060 Y93.287 E10.26674
+G1 X100.699 Y93.324 E10.29751
+G1 X101.401 Y93.435 E10.33170
+G1 X101.690 Y93.509 E10.34602
+G1 X106.727 Y98.547 E10.68867
+G1 X106.776 Y101.178 F7800.000
+G1 F1851
+G1 X94.718 Y104.409 E11.28909
+G1 X93.224 Y98.822 F7800.000
+G1 F1851
+G1 X105.280 Y95.591 E11.88939
+G1 X104.624 Y105.093 F7800.000
+G1 F1851
+G1 X106.468 Y98.210 E12.23210
+G1 X106.455 Y98.155 E12.23484
+G1 X106.224 Y97.485 E12.26890
+G1 X105.925 Y96.843 E12.30297
+G1 X105.630 Y96.344 E12.33087
+G1 X105.293 Y95.871 E12.35876
+G1 X104.829 Y95.337 E12.39283
+G1 X104.313 Y94.856 E12.42675
+G1 X103.804 Y94.469 E12.45752
+G1 X103.257 Y94.130 E12.48847
+G1 X102.623 Y93.821 E12.52238
+G1 X101.957 Y93.579 E12.55645
+G1 X101.736 Y93.521 E12.56745
+G1 X98.265 Y106.475 E13.21246
+G1 X97.920 Y106.383 E13.22963
+G1 X97.382 Y106.182 E13.25725
+G1 X96.746 Y105.871 E13.29132
+G1 X96.150 Y105.499 E13.32511
+G1 X95.592 Y105.063 E13.35918
+G1 X95.173 Y104.666 E13.38693
+G1 X94.745 Y104.177 E13.41814
+G1 X94.370 Y103.656 E13.44903
+G1 X94.045 Y103.098 E13.48010
+G1 X93.777 Y102.517 E13.51088
+G1 X93.532 Y101.788 E13.54784
+G1 X95.377 Y94.905 E13.89058
+G1 E11.89058 F2400.00000
+G92 E0
+G1 X146.264 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1851
+G1 X162.446 Y100.996 E2.77830
+G1 X162.446 Y114.004 E3.40391
+G1 X146.264 Y114.004 E4.18221
+G1 X146.264 Y101.056 E4.80494
+G1 X145.878 Y100.611 F7800.000
+G1 F1851
+G1 X162.832 Y100.611 E5.62033
+G1 X162.832 Y114.389 E6.28304
+G1 X145.878 Y114.389 E7.09843
+G1 X145.878 Y100.671 E7.75826
+G1 X145.493 Y100.225 F7800.000
+G1 F1800
+G1 X163.217 Y100.225 E8.61074
+G1 X163.217 Y114.775 E9.31055
+G1 X145.493 Y114.775 E10.16303
+G1 X145.493 Y100.285 E10.85995
+G1 X145.882 Y100.316 F7800.000
+G1 X146.380 Y105.516
+G1 F1851
+G1 X147.513 Y101.285 E11.07060
+G1 X153.502 Y101.285 E11.35862
+G1 X150.171 Y113.715 E11.97750
+G1 X156.160 Y113.715 E12.26552
+G1 X159.490 Y101.285 E12.88441
+G1 X162.157 Y101.285 E13.01267
+G1 X162.157 Y113.681 E13.60887
+G1 X162.101 Y113.888 E13.61917
+G1 X162.330 Y107.682 F7800.000
+G1 F1851
+G1 X146.380 Y111.956 E14.41340
+G1 X150.044 Y113.888 F7800.000
+G1 F1851
+G1 X146.553 Y110.397 E14.65086
+G1 X146.553 Y102.217 E15.04430
+G1 X158.051 Y113.715 E15.82636
+G1 X162.157 Y113.715 E16.02383
+G1 X162.157 Y109.640 E16.21980
+G1 X153.802 Y101.285 E16.78808
+G1 X161.982 Y101.285 E17.18152
+G1 X162.330 Y101.633 E17.20519
+G1 X162.330 Y101.694 F7800.000
+G1 F1851
+G1 X146.380 Y105.968 E17.99942
+G1 Z8.150 F7800.000
+G1 E15.99942 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F2005
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F2005
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F2005
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F2005
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F2005
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F2005
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F2005
+G1 X93.114 Y101.272 E2.03903
+G1 X93.024 Y100.612 E2.07104
+G1 X92.999 Y99.873 E2.10660
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.542 E2.17112
+G1 X93.323 Y97.890 E2.20356
+G1 X93.553 Y97.266 E2.23556
+G1 X93.876 Y96.604 E2.27101
+G1 X94.232 Y96.030 E2.30345
+G1 X94.634 Y95.501 E2.33545
+G1 X95.139 Y94.960 E2.37102
+G1 X95.590 Y94.561 E2.39998
+G1 X96.188 Y94.126 E2.43553
+G1 X96.771 Y93.787 E2.46797
+G1 X97.375 Y93.508 E2.49998
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.392 Y93.024 E2.60005
+G1 X100.065 Y92.998 E2.63249
+G1 X100.730 Y93.036 E2.66450
+G1 X101.458 Y93.151 E2.69994
+G1 X102.110 Y93.323 E2.73238
+G1 X102.734 Y93.553 E2.76439
+G1 X103.395 Y93.876 E2.79974
+G1 X104.020 Y94.266 E2.83520
+G1 X104.498 Y94.633 E2.86417
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.872 Y96.184 E2.96414
+G1 X106.213 Y96.771 E2.99679
+G1 X106.492 Y97.375 E3.02880
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19322
+G1 X106.849 Y101.460 E3.22889
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32857
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42845
+G1 X104.308 Y105.521 E3.46392
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55773
+G1 X101.926 Y106.733 E3.59319
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69308
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75750
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92811
+G1 X94.963 Y104.865 E3.95728
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.814 E4.02191
+G1 X93.759 Y103.175 E4.05738
+G1 X93.509 Y102.627 E4.08634
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F2005
+G1 X92.897 Y102.035 E4.11994
+G1 X92.735 Y101.342 E4.15420
+G1 X92.640 Y100.645 E4.18802
+G1 X92.612 Y99.868 E4.22541
+G1 X92.652 Y99.230 E4.25616
+G1 X92.773 Y98.463 E4.29354
+G1 X92.955 Y97.774 E4.32780
+G1 X93.198 Y97.114 E4.36162
+G1 X93.538 Y96.417 E4.39893
+G1 X93.914 Y95.811 E4.43319
+G1 X94.339 Y95.252 E4.46701
+G1 X94.869 Y94.683 E4.50440
+G1 X95.348 Y94.260 E4.53515
+G1 X95.977 Y93.803 E4.57253
+G1 X96.592 Y93.444 E4.60679
+G1 X97.231 Y93.150 E4.64061
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74612
+G1 X100.069 Y92.612 E4.78038
+G1 X100.771 Y92.652 E4.81420
+G1 X101.537 Y92.773 E4.85152
+G1 X102.226 Y92.955 E4.88578
+G1 X102.886 Y93.198 E4.91960
+G1 X103.582 Y93.538 E4.95686
+G1 X104.240 Y93.949 E4.99418
+G1 X104.747 Y94.338 E5.02493
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09958
+G1 X106.196 Y95.975 E5.13038
+G1 X106.556 Y96.592 E5.16477
+G1 X106.850 Y97.231 E5.19859
+G1 X107.103 Y97.966 E5.23598
+G1 X107.252 Y98.588 E5.26672
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.539 E5.40957
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51484
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58291
+G1 X105.133 Y105.315 E5.62024
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71931
+G1 X102.768 Y106.851 E5.75663
+G1 X102.034 Y107.103 E5.79396
+G1 X101.412 Y107.252 E5.82470
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93010
+G1 X98.464 Y107.227 E5.96743
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03550
+G1 X96.418 Y106.462 E6.07282
+G1 X95.762 Y106.052 E6.11002
+G1 X95.151 Y105.575 E6.14734
+G1 X94.685 Y105.133 E6.17822
+G1 X94.260 Y104.652 E6.20909
+G1 X93.803 Y104.024 E6.24642
+G1 X93.415 Y103.352 E6.28374
+G1 X93.150 Y102.770 E6.31449
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34992
+G1 X92.355 Y101.412 E6.38600
+G1 X92.255 Y100.678 E6.42164
+G1 X92.226 Y99.863 E6.46085
+G1 X92.268 Y99.188 E6.49338
+G1 X92.395 Y98.383 E6.53258
+G1 X92.587 Y97.658 E6.56867
+G1 X92.843 Y96.963 E6.60430
+G1 X93.200 Y96.230 E6.64349
+G1 X93.595 Y95.593 E6.67957
+G1 X94.044 Y95.003 E6.71521
+G1 X94.600 Y94.407 E6.75442
+G1 X95.106 Y93.959 E6.78694
+G1 X95.766 Y93.479 E6.82615
+G1 X96.414 Y93.102 E6.86223
+G1 X97.087 Y92.792 E6.89787
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00882
+G1 X100.072 Y92.226 E7.04490
+G1 X100.812 Y92.268 E7.08054
+G1 X101.617 Y92.395 E7.11972
+G1 X102.342 Y92.587 E7.15580
+G1 X103.037 Y92.843 E7.19144
+G1 X103.769 Y93.200 E7.23060
+G1 X104.460 Y93.632 E7.26979
+G1 X104.997 Y94.044 E7.30232
+G1 X105.593 Y94.599 E7.34151
+G1 X106.127 Y95.214 E7.38069
+G1 X106.520 Y95.765 E7.41324
+G1 X106.898 Y96.414 E7.44937
+G1 X107.208 Y97.087 E7.48501
+G1 X107.474 Y97.858 E7.52422
+G1 X107.632 Y98.516 E7.55675
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.137 E7.63512
+G1 X107.732 Y100.812 E7.66765
+G1 X107.605 Y101.617 E7.70689
+G1 X107.435 Y102.272 E7.73941
+G1 X107.157 Y103.038 E7.77860
+G1 X106.800 Y103.769 E7.81774
+G1 X106.368 Y104.460 E7.85693
+G1 X105.956 Y104.997 E7.88946
+G1 X105.401 Y105.593 E7.92864
+G1 X104.786 Y106.127 E7.96783
+G1 X104.234 Y106.520 E8.00041
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07217
+G1 X102.142 Y107.474 E8.11136
+G1 X101.484 Y107.632 E8.14389
+G1 X100.678 Y107.745 E8.18307
+G1 X99.863 Y107.774 E8.22226
+G1 X99.188 Y107.732 E8.25479
+G1 X98.384 Y107.605 E8.29398
+G1 X97.597 Y107.394 E8.33316
+G1 X96.963 Y107.157 E8.36569
+G1 X96.231 Y106.800 E8.40488
+G1 X95.541 Y106.369 E8.44402
+G1 X94.899 Y105.867 E8.48321
+G1 X94.407 Y105.401 E8.51578
+G1 X93.959 Y104.894 E8.54836
+G1 X93.480 Y104.234 E8.58755
+G1 X93.072 Y103.529 E8.62673
+G1 X92.792 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68708
+G1 X92.698 Y102.174 F7800.000
+G1 X93.276 Y101.457
+G1 F2005
+G1 X98.306 Y106.486 E9.02919
+G1 X98.604 Y106.566 E9.04405
+G1 X99.304 Y106.677 E9.07812
+G1 X99.877 Y106.712 E9.10574
+G1 X100.585 Y106.687 E9.13981
+G1 X101.286 Y106.589 E9.17387
+G1 X101.845 Y106.455 E9.20150
+G1 X102.515 Y106.224 E9.23557
+G1 X103.157 Y105.925 E9.26963
+G1 X103.656 Y105.630 E9.29753
+G1 X104.129 Y105.293 E9.32543
+G1 X104.743 Y104.743 E9.36510
+G1 X95.257 Y95.257 E10.01034
+G1 X95.771 Y94.786 E10.04385
+G1 X96.346 Y94.369 E10.07803
+G1 X96.904 Y94.044 E10.10910
+G1 X97.483 Y93.777 E10.13975
+G1 X98.155 Y93.545 E10.17394
+G1 X98.714 Y93.411 E10.20157
+G1 X99.417 Y93.312 E10.23575
+G1 X100.063 Y93.287 E10.26682
+G1 X100.699 Y93.324 E10.29747
+G1 X101.398 Y93.434 E10.33151
+G1 X101.692 Y93.512 E10.34614
+G1 X106.727 Y98.547 E10.68861
+G1 X106.776 Y101.178 F7800.000
+G1 F2005
+G1 X94.715 Y104.410 E11.28917
+G1 X93.224 Y98.822 F7800.000
+G1 F2005
+G1 X105.280 Y95.591 E11.88948
+G1 X104.624 Y105.093 F7800.000
+G1 F2005
+G1 X106.468 Y98.210 E12.23218
+G1 X106.455 Y98.155 E12.23492
+G1 X106.223 Y97.483 E12.26912
+G1 X105.956 Y96.904 E12.29976
+G1 X105.628 Y96.341 E12.33111
+G1 X105.293 Y95.871 E12.35885
+G1 X104.829 Y95.337 E12.39291
+G1 X104.311 Y94.854 E12.42698
+G1 X103.855 Y94.504 E12.45461
+G1 X103.254 Y94.129 E12.48867
+G1 X102.620 Y93.820 E12.52260
+G1 X102.023 Y93.599 E12.55324
+G1 X101.735 Y93.523 E12.56753
+G1 X98.265 Y106.475 E13.21244
+G1 X97.920 Y106.383 E13.22961
+G1 X97.382 Y106.182 E13.25724
+G1 X96.746 Y105.871 E13.29130
+G1 X96.150 Y105.499 E13.32510
+G1 X95.592 Y105.063 E13.35916
+G1 X95.171 Y104.663 E13.38706
+G1 X94.786 Y104.229 E13.41496
+G1 X94.370 Y103.656 E13.44902
+G1 X94.016 Y103.043 E13.48309
+G1 X93.778 Y102.520 E13.51072
+G1 X93.532 Y101.788 E13.54783
+G1 X95.377 Y94.903 E13.89068
+G1 E11.89068 F2400.00000
+G92 E0
+G1 X146.469 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F2005
+G1 X162.651 Y100.996 E2.77830
+G1 X162.651 Y114.004 E3.40391
+G1 X146.469 Y114.004 E4.18221
+G1 X146.469 Y101.056 E4.80494
+G1 X146.084 Y100.611 F7800.000
+G1 F2005
+G1 X163.037 Y100.611 E5.62033
+G1 X163.037 Y114.389 E6.28304
+G1 X146.084 Y114.389 E7.09843
+G1 X146.084 Y100.671 E7.75826
+G1 X145.698 Y100.225 F7800.000
+G1 F1800
+G1 X163.423 Y100.225 E8.61074
+G1 X163.423 Y114.775 E9.31055
+G1 X145.698 Y114.775 E10.16303
+G1 X145.698 Y100.285 E10.85995
+G1 X146.088 Y100.316 F7800.000
+G1 X147.560 Y101.112
+G1 F2005
+G1 X146.759 Y104.102 E11.00885
+G1 X146.759 Y113.715 E11.47117
+G1 X150.171 Y113.715 E11.63531
+G1 X153.502 Y101.285 E12.25420
+G1 X159.490 Y101.285 E12.54222
+G1 X156.113 Y113.888 E13.16974
+G1 X161.868 Y113.888 F7800.000
+G1 F1200
+G1 X161.254 Y113.275 E13.21184
+G1 X161.254 Y112.724 E13.23855
+G1 X162.244 Y113.715 E13.30651
+G1 X162.362 Y113.715 E13.31222
+G1 X162.362 Y113.282 E13.33322
+G1 X161.254 Y112.174 E13.40925
+G1 X161.254 Y111.624 E13.43596
+G1 X162.362 Y112.732 E13.51199
+G1 X162.362 Y112.181 E13.53870
+G1 X161.254 Y111.074 E13.61473
+G1 X161.254 Y110.523 E13.64144
+G1 X162.362 Y111.631 E13.71747
+G1 X162.362 Y111.081 E13.74418
+G1 X161.254 Y109.973 E13.82021
+G1 X161.254 Y109.423 E13.84692
+G1 X162.362 Y110.530 E13.92296
+G1 X162.362 Y109.980 E13.94966
+G1 X161.254 Y108.872 E14.02570
+G1 X161.254 Y108.322 E14.05241
+G1 X162.362 Y109.430 E14.12844
+G1 X162.362 Y108.879 E14.15515
+G1 X161.254 Y107.772 E14.23118
+G1 X161.254 Y107.221 E14.25789
+G1 X162.362 Y108.329 E14.33392
+G1 X162.362 Y107.779 E14.36063
+G1 X161.254 Y106.671 E14.43666
+G1 X161.254 Y106.121 E14.46337
+G1 X162.362 Y107.228 E14.53940
+G1 X162.362 Y106.678 E14.56611
+G1 X161.254 Y105.570 E14.64214
+G1 X161.254 Y105.020 E14.66885
+G1 X162.362 Y106.128 E14.74488
+G1 X162.362 Y105.578 E14.77159
+G1 X161.254 Y104.470 E14.84762
+G1 X161.254 Y103.919 E14.87433
+G1 X162.362 Y105.027 E14.95037
+G1 X162.362 Y104.477 E14.97707
+G1 X161.254 Y103.369 E15.05311
+G1 X161.254 Y102.819 E15.07981
+G1 X162.362 Y103.927 E15.15585
+G1 X162.362 Y103.376 E15.18256
+G1 X161.254 Y102.269 E15.25859
+G1 X161.254 Y101.718 E15.28530
+G1 X162.362 Y102.826 E15.36133
+G1 X162.362 Y102.276 E15.38804
+G1 X161.372 Y101.285 E15.45600
+G1 X161.922 Y101.285 E15.48271
+G1 X162.536 Y101.899 E15.52482
+G1 X161.042 Y102.039 F7800.000
+G1 F2005
+G1 X146.585 Y105.913 E16.24469
+G1 X146.585 Y110.429 F7800.000
+G1 F2005
+G1 X149.871 Y113.715 E16.46819
+G1 X158.051 Y113.715 E16.86163
+G1 X146.759 Y102.422 E17.62973
+G1 X146.759 Y101.285 E17.68440
+G1 X153.802 Y101.285 E18.02317
+G1 X161.042 Y108.526 E18.51563
+G1 X161.042 Y108.027 F7800.000
+G1 F2005
+G1 X146.585 Y111.901 E19.23551
+G1 Z8.450 F7800.000
+G1 E17.23551 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1996
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1996
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1996
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1996
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1996
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1996
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1996
+G1 X93.114 Y101.269 E2.03916
+G1 X93.024 Y100.613 E2.07104
+G1 X92.999 Y99.873 E2.10660
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.542 E2.17112
+G1 X93.324 Y97.888 E2.20368
+G1 X93.553 Y97.266 E2.23556
+G1 X93.876 Y96.604 E2.27100
+G1 X94.233 Y96.028 E2.30357
+G1 X94.634 Y95.501 E2.33545
+G1 X95.137 Y94.962 E2.37089
+G1 X95.646 Y94.516 E2.40346
+G1 X96.186 Y94.127 E2.43542
+G1 X96.773 Y93.786 E2.46809
+G1 X97.375 Y93.508 E2.49997
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60005
+G1 X100.068 Y92.998 E2.63262
+G1 X100.730 Y93.036 E2.66449
+G1 X101.458 Y93.151 E2.69994
+G1 X102.112 Y93.324 E2.73251
+G1 X102.734 Y93.553 E2.76438
+G1 X103.396 Y93.876 E2.79982
+G1 X103.972 Y94.233 E2.83239
+G1 X104.499 Y94.634 E2.86427
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.872 Y96.184 E2.96414
+G1 X106.214 Y96.773 E2.99692
+G1 X106.492 Y97.375 E3.02879
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19321
+G1 X106.849 Y101.458 E3.22876
+G1 X106.676 Y102.112 E3.26133
+G1 X106.447 Y102.734 E3.29320
+G1 X106.124 Y103.395 E3.32856
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42845
+G1 X104.308 Y105.521 E3.46391
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59319
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69307
+G1 X99.272 Y106.965 E3.72204
+G1 X98.542 Y106.849 E3.75758
+G1 X97.888 Y106.676 E3.79015
+G1 X97.266 Y106.447 E3.82203
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92810
+G1 X94.964 Y104.866 E3.95715
+G1 X94.516 Y104.354 E3.98993
+G1 X94.127 Y103.814 E4.02189
+G1 X93.786 Y103.227 E4.05456
+G1 X93.508 Y102.625 E4.08644
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1996
+G1 X92.897 Y102.036 E4.11994
+G1 X92.734 Y101.339 E4.15433
+G1 X92.640 Y100.645 E4.18802
+G1 X92.612 Y99.868 E4.22541
+G1 X92.652 Y99.230 E4.25615
+G1 X92.773 Y98.463 E4.29353
+G1 X92.956 Y97.771 E4.32792
+G1 X93.198 Y97.114 E4.36161
+G1 X93.538 Y96.417 E4.39893
+G1 X93.915 Y95.809 E4.43332
+G1 X94.339 Y95.252 E4.46701
+G1 X94.868 Y94.684 E4.50432
+G1 X95.406 Y94.213 E4.53871
+G1 X95.976 Y93.803 E4.57245
+G1 X96.595 Y93.443 E4.60691
+G1 X97.231 Y93.150 E4.64060
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74611
+G1 X100.072 Y92.612 E4.78051
+G1 X100.771 Y92.652 E4.81420
+G1 X101.537 Y92.773 E4.85151
+G1 X102.229 Y92.956 E4.88590
+G1 X102.886 Y93.198 E4.91959
+G1 X103.583 Y93.538 E4.95690
+G1 X104.191 Y93.915 E4.99130
+G1 X104.748 Y94.339 E5.02499
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09957
+G1 X106.196 Y95.974 E5.13037
+G1 X106.557 Y96.595 E5.16489
+G1 X106.850 Y97.231 E5.19858
+G1 X107.103 Y97.966 E5.23597
+G1 X107.252 Y98.588 E5.26672
+G1 X107.360 Y99.356 E5.30404
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37211
+G1 X107.227 Y101.537 E5.40949
+G1 X107.044 Y102.229 E5.44388
+G1 X106.802 Y102.886 E5.47757
+G1 X106.462 Y103.582 E5.51483
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58290
+G1 X105.133 Y105.315 E5.62023
+G1 X104.547 Y105.824 E5.65755
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71930
+G1 X102.768 Y106.851 E5.75663
+G1 X102.034 Y107.103 E5.79395
+G1 X101.412 Y107.252 E5.82470
+G1 X100.644 Y107.360 E5.86202
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93009
+G1 X98.463 Y107.227 E5.96747
+G1 X97.771 Y107.044 E6.00186
+G1 X97.114 Y106.802 E6.03555
+G1 X96.418 Y106.462 E6.07281
+G1 X95.762 Y106.052 E6.11001
+G1 X95.151 Y105.575 E6.14734
+G1 X94.686 Y105.134 E6.17813
+G1 X94.213 Y104.594 E6.21265
+G1 X93.803 Y104.024 E6.24640
+G1 X93.443 Y103.405 E6.28085
+G1 X93.150 Y102.769 E6.31454
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34991
+G1 X92.354 Y101.410 E6.38612
+G1 X92.255 Y100.678 E6.42163
+G1 X92.226 Y99.863 E6.46084
+G1 X92.268 Y99.188 E6.49337
+G1 X92.395 Y98.383 E6.53257
+G1 X92.588 Y97.655 E6.56879
+G1 X92.843 Y96.963 E6.60429
+G1 X93.200 Y96.230 E6.64348
+G1 X93.597 Y95.590 E6.67969
+G1 X94.044 Y95.003 E6.71520
+G1 X94.600 Y94.407 E6.75438
+G1 X95.166 Y93.911 E6.79059
+G1 X95.765 Y93.480 E6.82612
+G1 X96.417 Y93.101 E6.86236
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93707
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00881
+G1 X100.075 Y92.226 E7.04502
+G1 X100.812 Y92.268 E7.08053
+G1 X101.617 Y92.395 E7.11971
+G1 X102.345 Y92.588 E7.15593
+G1 X103.037 Y92.843 E7.19143
+G1 X103.770 Y93.200 E7.23061
+G1 X104.410 Y93.597 E7.26683
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38068
+G1 X106.520 Y95.765 E7.41323
+G1 X106.899 Y96.417 E7.44949
+G1 X107.208 Y97.087 E7.48500
+G1 X107.474 Y97.858 E7.52421
+G1 X107.632 Y98.516 E7.55674
+G1 X107.745 Y99.322 E7.59592
+G1 X107.774 Y100.137 E7.63511
+G1 X107.732 Y100.812 E7.66764
+G1 X107.605 Y101.617 E7.70685
+G1 X107.412 Y102.345 E7.74306
+G1 X107.157 Y103.037 E7.77857
+G1 X106.800 Y103.769 E7.81773
+G1 X106.368 Y104.460 E7.85692
+G1 X105.956 Y104.997 E7.88945
+G1 X105.401 Y105.593 E7.92863
+G1 X104.786 Y106.127 E7.96782
+G1 X104.234 Y106.520 E8.00040
+G1 X103.651 Y106.864 E8.03297
+G1 X102.912 Y107.209 E8.07216
+G1 X102.142 Y107.474 E8.11135
+G1 X101.484 Y107.632 E8.14388
+G1 X100.678 Y107.745 E8.18306
+G1 X99.863 Y107.774 E8.22225
+G1 X99.188 Y107.732 E8.25478
+G1 X98.383 Y107.605 E8.29399
+G1 X97.655 Y107.412 E8.33020
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40487
+G1 X95.541 Y106.369 E8.44401
+G1 X94.899 Y105.867 E8.48320
+G1 X94.408 Y105.401 E8.51574
+G1 X93.911 Y104.834 E8.55201
+G1 X93.480 Y104.235 E8.58753
+G1 X93.101 Y103.583 E8.62377
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68707
+G1 X92.697 Y102.174 F7800.000
+G1 X93.276 Y101.457
+G1 F1996
+G1 X98.308 Y106.488 E9.02930
+G1 X98.602 Y106.566 E9.04394
+G1 X99.304 Y106.677 E9.07811
+G1 X99.877 Y106.712 E9.10574
+G1 X100.585 Y106.687 E9.13981
+G1 X101.286 Y106.589 E9.17387
+G1 X101.845 Y106.455 E9.20150
+G1 X102.515 Y106.224 E9.23556
+G1 X103.157 Y105.925 E9.26963
+G1 X103.656 Y105.630 E9.29753
+G1 X104.129 Y105.293 E9.32543
+G1 X104.743 Y104.743 E9.36510
+G1 X95.257 Y95.257 E10.01033
+G1 X95.827 Y94.742 E10.04726
+G1 X96.343 Y94.370 E10.07788
+G1 X96.906 Y94.043 E10.10922
+G1 X97.483 Y93.777 E10.13974
+G1 X98.155 Y93.545 E10.17394
+G1 X98.714 Y93.411 E10.20157
+G1 X99.417 Y93.312 E10.23574
+G1 X100.065 Y93.288 E10.26694
+G1 X100.699 Y93.324 E10.29746
+G1 X101.398 Y93.434 E10.33150
+G1 X101.692 Y93.512 E10.34614
+G1 X106.727 Y98.547 E10.68861
+G1 X106.776 Y101.178 F7800.000
+G1 F1996
+G1 X94.718 Y104.409 E11.28901
+G1 X93.224 Y98.822 F7800.000
+G1 F1996
+G1 X105.280 Y95.591 E11.88932
+G1 X104.624 Y105.093 F7800.000
+G1 F1996
+G1 X106.468 Y98.210 E12.23202
+G1 X106.455 Y98.155 E12.23476
+G1 X106.223 Y97.483 E12.26896
+G1 X105.957 Y96.906 E12.29948
+G1 X105.628 Y96.341 E12.33095
+G1 X105.293 Y95.871 E12.35869
+G1 X104.829 Y95.337 E12.39275
+G1 X104.313 Y94.856 E12.42668
+G1 X103.808 Y94.472 E12.45720
+G1 X103.256 Y94.130 E12.48840
+G1 X102.620 Y93.820 E12.52244
+G1 X102.025 Y93.600 E12.55296
+G1 X101.735 Y93.523 E12.56737
+G1 X98.265 Y106.477 E13.21235
+G1 X97.975 Y106.400 E13.22676
+G1 X97.380 Y106.180 E13.25728
+G1 X96.746 Y105.871 E13.29121
+G1 X96.150 Y105.499 E13.32500
+G1 X95.592 Y105.063 E13.35907
+G1 X95.173 Y104.666 E13.38680
+G1 X94.742 Y104.173 E13.41828
+G1 X94.370 Y103.657 E13.44890
+G1 X94.043 Y103.094 E13.48024
+G1 X93.777 Y102.517 E13.51075
+G1 X93.532 Y101.788 E13.54774
+G1 X95.377 Y94.905 E13.89046
+G1 E11.89046 F2400.00000
+G92 E0
+G1 X146.675 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1996
+G1 X162.292 Y100.996 E2.75116
+G1 X162.292 Y114.004 E3.37678
+G1 X146.675 Y114.004 E4.12794
+G1 X146.675 Y101.056 E4.75067
+G1 X146.289 Y100.611 F7800.000
+G1 F1996
+G1 X162.678 Y100.611 E5.53893
+G1 X162.678 Y114.389 E6.20164
+G1 X146.289 Y114.389 E6.98989
+G1 X146.289 Y100.671 E7.64972
+G1 X145.903 Y100.225 F7800.000
+G1 F1800
+G1 X163.064 Y100.225 E8.47507
+G1 X163.064 Y114.775 E9.17487
+G1 X145.903 Y114.775 E10.00022
+G1 X145.903 Y100.285 E10.69714
+G1 X146.292 Y100.318 F7800.000
+G1 X147.560 Y101.112
+G1 F1996
+G1 X146.964 Y103.336 E10.80790
+G1 X146.964 Y113.715 E11.30706
+G1 X150.171 Y113.715 E11.46133
+G1 X153.502 Y101.285 E12.08021
+G1 X159.490 Y101.285 E12.36823
+G1 X156.113 Y113.888 E12.99576
+G1 X161.385 Y113.888 F7800.000
+G1 F1200
+G1 X162.003 Y113.270 E13.03841
+G1 X162.003 Y112.717 E13.06542
+G1 X161.005 Y113.715 E13.13429
+G1 X160.816 Y113.715 E13.14354
+G1 X160.816 Y113.351 E13.16130
+G1 X162.003 Y112.163 E13.24325
+G1 X162.003 Y111.610 E13.27025
+G1 X160.816 Y112.797 E13.35220
+G1 X160.816 Y112.244 E13.37920
+G1 X162.003 Y111.057 E13.46115
+G1 X162.003 Y110.503 E13.48816
+G1 X160.816 Y111.690 E13.57010
+G1 X160.816 Y111.137 E13.59711
+G1 X162.003 Y109.950 E13.67906
+G1 X162.003 Y109.396 E13.70606
+G1 X160.816 Y110.584 E13.78801
+G1 X160.816 Y110.030 E13.81501
+G1 X162.003 Y108.843 E13.89696
+G1 X162.003 Y108.290 E13.92397
+G1 X160.816 Y109.477 E14.00591
+G1 X160.816 Y108.924 E14.03292
+G1 X162.003 Y107.736 E14.11487
+G1 X162.003 Y107.183 E14.14187
+G1 X160.816 Y108.370 E14.22382
+G1 X160.816 Y107.817 E14.25082
+G1 X162.003 Y106.630 E14.33277
+G1 X162.003 Y106.076 E14.35978
+G1 X160.816 Y107.264 E14.44172
+G1 X160.816 Y106.710 E14.46873
+G1 X162.003 Y105.523 E14.55068
+G1 X162.003 Y104.970 E14.57768
+G1 X160.816 Y106.157 E14.65963
+G1 X160.816 Y105.603 E14.68664
+G1 X162.003 Y104.416 E14.76858
+G1 X162.003 Y103.863 E14.79559
+G1 X160.816 Y105.050 E14.87753
+G1 X160.816 Y104.497 E14.90454
+G1 X162.003 Y103.309 E14.98649
+G1 X162.003 Y102.756 E15.01349
+G1 X160.816 Y103.943 E15.09544
+G1 X160.816 Y103.390 E15.12245
+G1 X162.003 Y102.203 E15.20439
+G1 X162.003 Y101.649 E15.23140
+G1 X160.816 Y102.837 E15.31334
+G1 X160.816 Y102.283 E15.34035
+G1 X161.814 Y101.285 E15.40922
+G1 X161.260 Y101.285 E15.43622
+G1 X160.642 Y101.903 E15.47887
+G1 X160.604 Y102.157 F7800.000
+G1 F1996
+G1 X146.790 Y105.858 E16.16669
+G1 X146.790 Y110.634 F7800.000
+G1 F1996
+G1 X149.871 Y113.715 E16.37622
+G1 X158.051 Y113.715 E16.76966
+G1 X146.964 Y102.627 E17.52380
+G1 X146.964 Y101.285 E17.58835
+G1 X153.802 Y101.285 E17.91725
+G1 X160.604 Y108.087 E18.37989
+G1 X160.604 Y108.145 F7800.000
+G1 F1996
+G1 X146.790 Y111.846 E19.06770
+G1 Z8.750 F7800.000
+G1 E17.06770 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1977
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1977
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1977
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1977
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1977
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1977
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1977
+G1 X93.113 Y101.267 E2.03929
+G1 X93.024 Y100.613 E2.07103
+G1 X92.999 Y99.876 E2.10648
+G1 X93.044 Y99.198 E2.13917
+G1 X93.150 Y98.546 E2.17092
+G1 X93.341 Y97.832 E2.20649
+G1 X93.552 Y97.268 E2.23546
+G1 X93.876 Y96.604 E2.27100
+G1 X94.235 Y96.026 E2.30370
+G1 X94.634 Y95.501 E2.33544
+G1 X95.139 Y94.960 E2.37102
+G1 X95.590 Y94.561 E2.39998
+G1 X96.188 Y94.126 E2.43552
+G1 X96.775 Y93.784 E2.46822
+G1 X97.375 Y93.508 E2.49997
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60005
+G1 X100.071 Y92.998 E2.63274
+G1 X100.730 Y93.036 E2.66449
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.396 Y93.876 E2.79982
+G1 X103.974 Y94.235 E2.83252
+G1 X104.499 Y94.634 E2.86427
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.871 Y96.182 E2.96406
+G1 X106.240 Y96.822 E2.99960
+G1 X106.519 Y97.443 E3.03230
+G1 X106.731 Y98.068 E3.06404
+G1 X106.896 Y98.786 E3.09949
+G1 X106.981 Y99.460 E3.13218
+G1 X107.002 Y100.122 E3.16401
+G1 X106.956 Y100.802 E3.19682
+G1 X106.849 Y101.458 E3.22877
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32856
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42845
+G1 X104.308 Y105.521 E3.46391
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59319
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.876 Y107.001 E3.69294
+G1 X99.198 Y106.956 E3.72564
+G1 X98.546 Y106.850 E3.75739
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92810
+G1 X94.963 Y104.865 E3.95728
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.814 E4.02191
+G1 X93.759 Y103.175 E4.05737
+G1 X93.509 Y102.627 E4.08634
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1977
+G1 X92.897 Y102.036 E4.11994
+G1 X92.734 Y101.337 E4.15446
+G1 X92.640 Y100.645 E4.18802
+G1 X92.613 Y99.870 E4.22533
+G1 X92.660 Y99.154 E4.25985
+G1 X92.773 Y98.465 E4.29341
+G1 X92.974 Y97.714 E4.33081
+G1 X93.198 Y97.115 E4.36155
+G1 X93.538 Y96.417 E4.39893
+G1 X93.917 Y95.807 E4.43345
+G1 X94.339 Y95.252 E4.46701
+G1 X94.869 Y94.683 E4.50440
+G1 X95.348 Y94.260 E4.53515
+G1 X95.977 Y93.803 E4.57252
+G1 X96.597 Y93.442 E4.60704
+G1 X97.231 Y93.150 E4.64060
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74611
+G1 X100.074 Y92.612 E4.78064
+G1 X100.771 Y92.652 E4.81420
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88233
+G1 X102.887 Y93.199 E4.91966
+G1 X103.583 Y93.538 E4.95691
+G1 X104.193 Y93.917 E4.99143
+G1 X104.748 Y94.339 E5.02499
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09958
+G1 X106.195 Y95.974 E5.13032
+G1 X106.584 Y96.647 E5.16770
+G1 X106.878 Y97.301 E5.20222
+G1 X107.102 Y97.962 E5.23578
+G1 X107.277 Y98.718 E5.27309
+G1 X107.366 Y99.430 E5.30762
+G1 X107.388 Y100.129 E5.34122
+G1 X107.340 Y100.846 E5.37581
+G1 X107.227 Y101.537 E5.40950
+G1 X107.067 Y102.158 E5.44031
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51484
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58291
+G1 X105.133 Y105.315 E5.62023
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71931
+G1 X102.768 Y106.851 E5.75663
+G1 X102.034 Y107.103 E5.79396
+G1 X101.412 Y107.252 E5.82470
+G1 X100.644 Y107.360 E5.86203
+G1 X99.870 Y107.387 E5.89927
+G1 X99.154 Y107.340 E5.93380
+G1 X98.465 Y107.227 E5.96735
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03549
+G1 X96.418 Y106.462 E6.07282
+G1 X95.762 Y106.052 E6.11001
+G1 X95.151 Y105.575 E6.14734
+G1 X94.685 Y105.133 E6.17821
+G1 X94.260 Y104.652 E6.20909
+G1 X93.803 Y104.024 E6.24641
+G1 X93.415 Y103.352 E6.28374
+G1 X93.150 Y102.770 E6.31448
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34991
+G1 X92.354 Y101.407 E6.38626
+G1 X92.255 Y100.678 E6.42163
+G1 X92.226 Y99.864 E6.46081
+G1 X92.277 Y99.110 E6.49716
+G1 X92.395 Y98.384 E6.53253
+G1 X92.606 Y97.597 E6.57175
+G1 X92.843 Y96.963 E6.60427
+G1 X93.200 Y96.230 E6.64348
+G1 X93.599 Y95.588 E6.67983
+G1 X94.044 Y95.003 E6.71520
+G1 X94.600 Y94.407 E6.75441
+G1 X95.106 Y93.959 E6.78694
+G1 X95.766 Y93.479 E6.82615
+G1 X96.419 Y93.099 E6.86249
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00881
+G1 X100.078 Y92.226 E7.04516
+G1 X100.812 Y92.268 E7.08053
+G1 X101.617 Y92.395 E7.11974
+G1 X102.272 Y92.565 E7.15227
+G1 X103.038 Y92.843 E7.19146
+G1 X103.770 Y93.200 E7.23062
+G1 X104.412 Y93.599 E7.26697
+G1 X104.997 Y94.044 E7.30234
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38069
+G1 X106.520 Y95.765 E7.41322
+G1 X106.927 Y96.471 E7.45242
+G1 X107.237 Y97.160 E7.48877
+G1 X107.473 Y97.856 E7.52414
+G1 X107.657 Y98.650 E7.56333
+G1 X107.751 Y99.400 E7.59967
+G1 X107.774 Y100.136 E7.63506
+G1 X107.723 Y100.890 E7.67144
+G1 X107.605 Y101.617 E7.70685
+G1 X107.435 Y102.272 E7.73941
+G1 X107.157 Y103.038 E7.77860
+G1 X106.800 Y103.769 E7.81774
+G1 X106.368 Y104.460 E7.85692
+G1 X105.956 Y104.997 E7.88945
+G1 X105.401 Y105.593 E7.92864
+G1 X104.786 Y106.127 E7.96783
+G1 X104.234 Y106.520 E8.00040
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07216
+G1 X102.142 Y107.474 E8.11135
+G1 X101.484 Y107.632 E8.14388
+G1 X100.678 Y107.745 E8.18307
+G1 X99.864 Y107.774 E8.22223
+G1 X99.110 Y107.723 E8.25857
+G1 X98.384 Y107.605 E8.29395
+G1 X97.597 Y107.394 E8.33316
+G1 X96.963 Y107.157 E8.36569
+G1 X96.231 Y106.800 E8.40487
+G1 X95.541 Y106.369 E8.44401
+G1 X94.899 Y105.867 E8.48320
+G1 X94.407 Y105.401 E8.51578
+G1 X93.959 Y104.894 E8.54835
+G1 X93.480 Y104.234 E8.58754
+G1 X93.072 Y103.529 E8.62673
+G1 X92.792 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68708
+G1 X92.698 Y102.174 F7800.000
+G1 X93.277 Y101.457
+G1 F1977
+G1 X98.306 Y106.486 E9.02917
+G1 X98.607 Y106.567 E9.04417
+G1 X99.231 Y106.669 E9.07456
+G1 X99.881 Y106.712 E9.10589
+G1 X100.585 Y106.687 E9.13979
+G1 X101.286 Y106.589 E9.17385
+G1 X101.845 Y106.455 E9.20148
+G1 X102.515 Y106.224 E9.23554
+G1 X103.157 Y105.925 E9.26961
+G1 X103.656 Y105.630 E9.29751
+G1 X104.129 Y105.293 E9.32540
+G1 X104.743 Y104.743 E9.36508
+G1 X95.257 Y95.257 E10.01031
+G1 X95.771 Y94.786 E10.04383
+G1 X96.346 Y94.369 E10.07800
+G1 X96.909 Y94.041 E10.10933
+G1 X97.483 Y93.777 E10.13971
+G1 X98.155 Y93.545 E10.17392
+G1 X98.714 Y93.411 E10.20155
+G1 X99.417 Y93.312 E10.23572
+G1 X100.068 Y93.288 E10.26705
+G1 X100.699 Y93.324 E10.29743
+G1 X101.401 Y93.435 E10.33164
+G1 X101.690 Y93.509 E10.34597
+G1 X106.721 Y98.541 E10.68821
+G1 X106.778 Y101.178 F7800.000
+G1 F1977
+G1 X94.715 Y104.410 E11.28885
+G1 X93.222 Y98.822 F7800.000
+G1 F1977
+G1 X105.280 Y95.591 E11.88923
+G1 X104.624 Y105.093 F7800.000
+G1 F1977
+G1 X106.467 Y98.213 E12.23182
+G1 X106.452 Y98.147 E12.23507
+G1 X106.249 Y97.549 E12.26546
+G1 X105.982 Y96.954 E12.29679
+G1 X105.627 Y96.339 E12.33095
+G1 X105.293 Y95.871 E12.35858
+G1 X104.829 Y95.337 E12.39265
+G1 X104.313 Y94.856 E12.42658
+G1 X103.810 Y94.473 E12.45697
+G1 X103.256 Y94.130 E12.48830
+G1 X102.623 Y93.821 E12.52220
+G1 X101.957 Y93.579 E12.55626
+G1 X101.736 Y93.521 E12.56726
+G1 X98.265 Y106.475 E13.21228
+G1 X97.920 Y106.383 E13.22944
+G1 X97.382 Y106.182 E13.25707
+G1 X96.746 Y105.871 E13.29114
+G1 X96.150 Y105.499 E13.32493
+G1 X95.592 Y105.063 E13.35900
+G1 X95.171 Y104.663 E13.38689
+G1 X94.786 Y104.229 E13.41479
+G1 X94.370 Y103.656 E13.44886
+G1 X94.016 Y103.043 E13.48292
+G1 X93.778 Y102.520 E13.51055
+G1 X93.532 Y101.788 E13.54767
+G1 X95.377 Y94.903 E13.89051
+G1 E11.89051 F2400.00000
+G92 E0
+G1 X146.880 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1977
+G1 X161.854 Y100.996 E2.72020
+G1 X161.854 Y114.004 E3.34582
+G1 X146.880 Y114.004 E4.06601
+G1 X146.880 Y101.056 E4.68875
+G1 X146.494 Y100.611 F7800.000
+G1 F1977
+G1 X162.239 Y100.611 E5.44604
+G1 X162.239 Y114.389 E6.10875
+G1 X146.494 Y114.389 E6.86604
+G1 X146.494 Y100.671 E7.52587
+G1 X146.109 Y100.225 F7800.000
+G1 F1800
+G1 X162.625 Y100.225 E8.32025
+G1 X162.625 Y114.775 E9.02006
+G1 X146.109 Y114.775 E9.81445
+G1 X146.109 Y100.285 E10.51137
+G1 X146.497 Y100.320 F7800.000
+G1 X147.560 Y101.112
+G1 F1977
+G1 X147.169 Y102.570 E10.58398
+G1 X147.169 Y113.715 E11.11998
+G1 X150.171 Y113.715 E11.26438
+G1 X153.502 Y101.285 E11.88327
+G1 X159.490 Y101.285 E12.17129
+G1 X156.113 Y113.888 E12.79881
+G1 X160.995 Y113.888 F7800.000
+G1 F1200
+G1 X160.377 Y113.270 E12.84146
+G1 X160.377 Y112.717 E12.86847
+G1 X161.375 Y113.715 E12.93733
+G1 X161.565 Y113.715 E12.94658
+G1 X161.565 Y113.351 E12.96434
+G1 X160.377 Y112.163 E13.04629
+G1 X160.377 Y111.610 E13.07329
+G1 X161.565 Y112.797 E13.15524
+G1 X161.565 Y112.244 E13.18225
+G1 X160.377 Y111.057 E13.26419
+G1 X160.377 Y110.503 E13.29120
+G1 X161.565 Y111.691 E13.37314
+G1 X161.565 Y111.137 E13.40015
+G1 X160.377 Y109.950 E13.48210
+G1 X160.377 Y109.397 E13.50910
+G1 X161.565 Y110.584 E13.59105
+G1 X161.565 Y110.030 E13.61806
+G1 X160.377 Y108.843 E13.70000
+G1 X160.377 Y108.290 E13.72701
+G1 X161.565 Y109.477 E13.80895
+G1 X161.565 Y108.924 E13.83596
+G1 X160.377 Y107.736 E13.91791
+G1 X160.377 Y107.183 E13.94491
+G1 X161.565 Y108.370 E14.02686
+G1 X161.565 Y107.817 E14.05387
+G1 X160.377 Y106.630 E14.13581
+G1 X160.377 Y106.076 E14.16282
+G1 X161.565 Y107.264 E14.24477
+G1 X161.565 Y106.710 E14.27177
+G1 X160.377 Y105.523 E14.35372
+G1 X160.377 Y104.970 E14.38072
+G1 X161.565 Y106.157 E14.46267
+G1 X161.565 Y105.604 E14.48968
+G1 X160.377 Y104.416 E14.57162
+G1 X160.377 Y103.863 E14.59863
+G1 X161.565 Y105.050 E14.68058
+G1 X161.565 Y104.497 E14.70758
+G1 X160.377 Y103.310 E14.78953
+G1 X160.377 Y102.756 E14.81653
+G1 X161.565 Y103.943 E14.89848
+G1 X161.565 Y103.390 E14.92549
+G1 X160.377 Y102.203 E15.00743
+G1 X160.377 Y101.649 E15.03444
+G1 X161.565 Y102.837 E15.11639
+G1 X161.565 Y102.283 E15.14339
+G1 X160.567 Y101.285 E15.21227
+G1 X161.120 Y101.285 E15.23927
+G1 X161.738 Y101.903 E15.28193
+G1 X160.165 Y102.274 F7800.000
+G1 F1977
+G1 X146.995 Y105.803 E15.93769
+G1 X146.995 Y110.839 F7800.000
+G1 F1977
+G1 X149.871 Y113.715 E16.13327
+G1 X158.051 Y113.715 E16.52671
+G1 X147.169 Y102.833 E17.26689
+G1 X147.169 Y101.285 E17.34130
+G1 X153.802 Y101.285 E17.66033
+G1 X160.165 Y107.649 E18.09314
+G1 X160.165 Y108.262 F7800.000
+G1 F1977
+G1 X146.995 Y111.791 E18.74891
+G1 Z9.050 F7800.000
+G1 E16.74891 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1957
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F1957
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X71.777 Y113.888
+G1 F1957
+G1 X73.715 Y106.656 E10.30400
+G1 X73.715 Y101.285 E10.56229
+G1 X69.165 Y101.285 E10.78110
+G1 X65.835 Y113.715 E11.39999
+G1 X61.285 Y113.715 E11.61880
+G1 X61.285 Y108.344 E11.87709
+G1 X63.223 Y101.112 E12.23721
+G1 X61.112 Y106.218 F7800.000
+G1 F1957
+G1 X73.888 Y102.794 E12.87338
+G1 X73.888 Y105.708 F7800.000
+G1 F1957
+G1 X69.466 Y101.285 E13.17419
+G1 X61.285 Y101.285 E13.56763
+G1 X73.715 Y113.715 E14.41304
+G1 X65.534 Y113.715 E14.80649
+G1 X61.112 Y109.292 E15.10729
+G1 X61.112 Y112.206 F7800.000
+G1 F1957
+G1 X73.888 Y108.782 E15.74346
+G1 E13.74346 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1957
+G1 X93.104 Y101.214 E2.04183
+G1 X93.018 Y100.537 E2.07466
+G1 X92.998 Y99.879 E2.10635
+G1 X93.044 Y99.195 E2.13930
+G1 X93.150 Y98.546 E2.17091
+G1 X93.341 Y97.835 E2.20636
+G1 X93.583 Y97.197 E2.23919
+G1 X93.874 Y96.607 E2.27080
+G1 X94.265 Y95.982 E2.30624
+G1 X94.683 Y95.443 E2.33907
+G1 X95.137 Y94.961 E2.37090
+G1 X95.590 Y94.561 E2.39998
+G1 X96.188 Y94.126 E2.43552
+G1 X96.778 Y93.783 E2.46834
+G1 X97.375 Y93.508 E2.49996
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60004
+G1 X100.073 Y92.998 E2.63287
+G1 X100.730 Y93.036 E2.66448
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72902
+G1 X102.736 Y93.554 E2.76449
+G1 X103.395 Y93.876 E2.79974
+G1 X104.020 Y94.266 E2.83520
+G1 X104.498 Y94.633 E2.86417
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.871 Y96.184 E2.96413
+G1 X106.217 Y96.778 E2.99717
+G1 X106.492 Y97.375 E3.02878
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09332
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.124 E3.16412
+G1 X106.956 Y100.805 E3.19694
+G1 X106.849 Y101.458 E3.22877
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32856
+G1 X105.734 Y104.020 E3.36402
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42845
+G1 X104.308 Y105.521 E3.46391
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59318
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.876 Y107.001 E3.69294
+G1 X99.195 Y106.956 E3.72577
+G1 X98.546 Y106.850 E3.75738
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82192
+G1 X96.605 Y106.124 E3.85739
+G1 X95.982 Y105.735 E3.89272
+G1 X95.443 Y105.317 E3.92554
+G1 X94.961 Y104.863 E3.95737
+G1 X94.561 Y104.410 E3.98645
+G1 X94.126 Y103.812 E4.02199
+G1 X93.783 Y103.222 E4.05482
+G1 X93.508 Y102.625 E4.08643
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1957
+G1 X92.898 Y102.037 E4.11988
+G1 X92.723 Y101.282 E4.15713
+G1 X92.633 Y100.567 E4.19178
+G1 X92.612 Y99.872 E4.22526
+G1 X92.661 Y99.151 E4.25998
+G1 X92.773 Y98.465 E4.29341
+G1 X92.973 Y97.716 E4.33072
+G1 X93.229 Y97.042 E4.36538
+G1 X93.537 Y96.419 E4.39880
+G1 X93.948 Y95.761 E4.43612
+G1 X94.390 Y95.192 E4.47077
+G1 X94.868 Y94.684 E4.50433
+G1 X95.348 Y94.260 E4.53514
+G1 X95.977 Y93.803 E4.57251
+G1 X96.600 Y93.441 E4.60717
+G1 X97.231 Y93.150 E4.64060
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74611
+G1 X100.077 Y92.612 E4.78076
+G1 X100.771 Y92.652 E4.81419
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88233
+G1 X102.887 Y93.199 E4.91966
+G1 X103.582 Y93.538 E4.95685
+G1 X104.240 Y93.949 E4.99418
+G1 X104.747 Y94.338 E5.02492
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09957
+G1 X106.196 Y95.974 E5.13037
+G1 X106.559 Y96.600 E5.16515
+G1 X106.850 Y97.231 E5.19858
+G1 X107.103 Y97.966 E5.23597
+G1 X107.252 Y98.588 E5.26672
+G1 X107.360 Y99.356 E5.30404
+G1 X107.387 Y100.130 E5.34129
+G1 X107.339 Y100.849 E5.37594
+G1 X107.227 Y101.537 E5.40950
+G1 X107.067 Y102.158 E5.44031
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51483
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58290
+G1 X105.133 Y105.315 E5.62023
+G1 X104.547 Y105.824 E5.65755
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71930
+G1 X102.768 Y106.851 E5.75663
+G1 X102.034 Y107.103 E5.79395
+G1 X101.412 Y107.252 E5.82470
+G1 X100.644 Y107.360 E5.86202
+G1 X99.870 Y107.387 E5.89927
+G1 X99.151 Y107.339 E5.93392
+G1 X98.465 Y107.227 E5.96735
+G1 X97.714 Y107.026 E6.00474
+G1 X97.115 Y106.802 E6.03549
+G1 X96.418 Y106.462 E6.07282
+G1 X95.761 Y106.052 E6.11006
+G1 X95.192 Y105.610 E6.14471
+G1 X94.684 Y105.132 E6.17827
+G1 X94.260 Y104.652 E6.20908
+G1 X93.803 Y104.023 E6.24646
+G1 X93.441 Y103.400 E6.28111
+G1 X93.150 Y102.769 E6.31454
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34989
+G1 X92.343 Y101.350 E6.38905
+G1 X92.249 Y100.597 E6.42553
+G1 X92.226 Y99.864 E6.46078
+G1 X92.277 Y99.107 E6.49729
+G1 X92.395 Y98.384 E6.53253
+G1 X92.606 Y97.597 E6.57171
+G1 X92.875 Y96.888 E6.60819
+G1 X93.200 Y96.231 E6.64343
+G1 X93.632 Y95.540 E6.68262
+G1 X94.097 Y94.941 E6.71910
+G1 X94.600 Y94.407 E6.75438
+G1 X95.106 Y93.959 E6.78694
+G1 X95.766 Y93.479 E6.82614
+G1 X96.422 Y93.098 E6.86262
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93707
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00881
+G1 X100.081 Y92.226 E7.04529
+G1 X100.812 Y92.268 E7.08053
+G1 X101.617 Y92.395 E7.11974
+G1 X102.272 Y92.565 E7.15227
+G1 X103.038 Y92.843 E7.19145
+G1 X103.769 Y93.200 E7.23060
+G1 X104.460 Y93.632 E7.26978
+G1 X104.997 Y94.044 E7.30231
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38069
+G1 X106.520 Y95.765 E7.41323
+G1 X106.902 Y96.422 E7.44976
+G1 X107.208 Y97.087 E7.48500
+G1 X107.474 Y97.858 E7.52421
+G1 X107.632 Y98.516 E7.55674
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.136 E7.63508
+G1 X107.723 Y100.893 E7.67157
+G1 X107.605 Y101.617 E7.70685
+G1 X107.435 Y102.272 E7.73940
+G1 X107.157 Y103.038 E7.77859
+G1 X106.800 Y103.769 E7.81773
+G1 X106.368 Y104.460 E7.85692
+G1 X105.956 Y104.997 E7.88945
+G1 X105.401 Y105.593 E7.92864
+G1 X104.786 Y106.127 E7.96782
+G1 X104.234 Y106.520 E8.00040
+G1 X103.651 Y106.864 E8.03297
+G1 X102.912 Y107.209 E8.07216
+G1 X102.142 Y107.474 E8.11135
+G1 X101.484 Y107.632 E8.14388
+G1 X100.678 Y107.745 E8.18307
+G1 X99.864 Y107.774 E8.22222
+G1 X99.107 Y107.723 E8.25870
+G1 X98.384 Y107.605 E8.29394
+G1 X97.597 Y107.394 E8.33316
+G1 X96.963 Y107.157 E8.36568
+G1 X96.231 Y106.800 E8.40487
+G1 X95.540 Y106.368 E8.44403
+G1 X94.941 Y105.903 E8.48051
+G1 X94.407 Y105.400 E8.51580
+G1 X93.959 Y104.894 E8.54835
+G1 X93.479 Y104.234 E8.58755
+G1 X93.098 Y103.578 E8.62404
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68707
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F1957
+G1 X98.306 Y106.486 E9.02901
+G1 X98.607 Y106.567 E9.04402
+G1 X99.228 Y106.668 E9.07428
+G1 X99.881 Y106.712 E9.10573
+G1 X100.585 Y106.687 E9.13963
+G1 X101.286 Y106.589 E9.17369
+G1 X101.845 Y106.455 E9.20132
+G1 X102.515 Y106.224 E9.23539
+G1 X103.157 Y105.925 E9.26945
+G1 X103.656 Y105.630 E9.29735
+G1 X104.129 Y105.293 E9.32525
+G1 X104.743 Y104.743 E9.36492
+G1 X95.256 Y95.256 E10.01020
+G1 X95.771 Y94.786 E10.04371
+G1 X96.346 Y94.369 E10.07788
+G1 X96.911 Y94.040 E10.10934
+G1 X97.482 Y93.777 E10.13959
+G1 X98.155 Y93.545 E10.17381
+G1 X98.714 Y93.411 E10.20143
+G1 X99.417 Y93.312 E10.23560
+G1 X100.071 Y93.288 E10.26706
+G1 X100.699 Y93.323 E10.29731
+G1 X101.401 Y93.435 E10.33153
+G1 X101.690 Y93.509 E10.34585
+G1 X106.727 Y98.547 E10.68850
+G1 X106.778 Y101.178 F7800.000
+G1 F1957
+G1 X94.715 Y104.410 E11.28914
+G1 X93.222 Y98.822 F7800.000
+G1 F1957
+G1 X105.280 Y95.591 E11.88952
+G1 X104.624 Y105.093 F7800.000
+G1 F1957
+G1 X106.468 Y98.210 E12.23223
+G1 X106.455 Y98.155 E12.23497
+G1 X106.223 Y97.482 E12.26918
+G1 X105.960 Y96.911 E12.29944
+G1 X105.628 Y96.341 E12.33117
+G1 X105.293 Y95.871 E12.35889
+G1 X104.829 Y95.337 E12.39296
+G1 X104.311 Y94.854 E12.42702
+G1 X103.855 Y94.504 E12.45465
+G1 X103.254 Y94.129 E12.48872
+G1 X102.623 Y93.821 E12.52251
+G1 X101.957 Y93.579 E12.55658
+G1 X101.736 Y93.521 E12.56757
+G1 X98.265 Y106.475 E13.21259
+G1 X97.920 Y106.383 E13.22976
+G1 X97.382 Y106.182 E13.25738
+G1 X96.746 Y105.871 E13.29145
+G1 X96.148 Y105.498 E13.32534
+G1 X95.631 Y105.097 E13.35680
+G1 X95.169 Y104.662 E13.38733
+G1 X94.786 Y104.229 E13.41510
+G1 X94.369 Y103.654 E13.44927
+G1 X94.040 Y103.089 E13.48073
+G1 X93.777 Y102.518 E13.51098
+G1 X93.533 Y101.787 E13.54801
+G1 X95.377 Y94.903 E13.89081
+G1 E11.89081 F2400.00000
+G92 E0
+G1 X147.085 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1957
+G1 X161.415 Y100.996 E2.68924
+G1 X161.415 Y114.004 E3.31485
+G1 X147.085 Y114.004 E4.00409
+G1 X147.085 Y101.056 E4.62682
+G1 X146.699 Y100.611 F7800.000
+G1 F1957
+G1 X161.801 Y100.611 E5.35315
+G1 X161.801 Y114.389 E6.01586
+G1 X146.699 Y114.389 E6.74219
+G1 X146.699 Y100.671 E7.40202
+G1 X146.314 Y100.225 F7800.000
+G1 F1800
+G1 X162.187 Y100.225 E8.16544
+G1 X162.187 Y114.775 E8.86525
+G1 X146.314 Y114.775 E9.62867
+G1 X146.314 Y100.285 E10.32559
+G1 X146.702 Y100.323 F7800.000
+G1 X147.560 Y101.112
+G1 F1957
+G1 X147.374 Y101.804 E10.36007
+G1 X147.374 Y113.715 E10.93291
+G1 X150.171 Y113.715 E11.06744
+G1 X153.502 Y101.285 E11.68632
+G1 X159.490 Y101.285 E11.97434
+G1 X156.113 Y113.888 E12.60187
+G1 X160.508 Y113.888 F7800.000
+G1 F1200
+G1 X161.126 Y113.270 E12.64453
+G1 X161.126 Y112.717 E12.67153
+G1 X160.128 Y113.715 E12.74040
+G1 X159.939 Y113.715 E12.74965
+G1 X159.939 Y113.351 E12.76741
+G1 X161.126 Y112.163 E12.84936
+G1 X161.126 Y111.610 E12.87636
+G1 X159.939 Y112.797 E12.95831
+G1 X159.939 Y112.244 E12.98532
+G1 X161.126 Y111.057 E13.06726
+G1 X161.126 Y110.503 E13.09427
+G1 X159.939 Y111.690 E13.17621
+G1 X159.939 Y111.137 E13.20322
+G1 X161.126 Y109.950 E13.28517
+G1 X161.126 Y109.396 E13.31217
+G1 X159.939 Y110.584 E13.39412
+G1 X159.939 Y110.030 E13.42113
+G1 X161.126 Y108.843 E13.50307
+G1 X161.126 Y108.290 E13.53008
+G1 X159.939 Y109.477 E13.61202
+G1 X159.939 Y108.924 E13.63903
+G1 X161.126 Y107.736 E13.72098
+G1 X161.126 Y107.183 E13.74798
+G1 X159.939 Y108.370 E13.82993
+G1 X159.939 Y107.817 E13.85694
+G1 X161.126 Y106.630 E13.93888
+G1 X161.126 Y106.076 E13.96589
+G1 X159.939 Y107.264 E14.04783
+G1 X159.939 Y106.710 E14.07484
+G1 X161.126 Y105.523 E14.15679
+G1 X161.126 Y104.970 E14.18379
+G1 X159.939 Y106.157 E14.26574
+G1 X159.939 Y105.603 E14.29275
+G1 X161.126 Y104.416 E14.37469
+G1 X161.126 Y103.863 E14.40170
+G1 X159.939 Y105.050 E14.48364
+G1 X159.939 Y104.497 E14.51065
+G1 X161.126 Y103.309 E14.59260
+G1 X161.126 Y102.756 E14.61960
+G1 X159.939 Y103.943 E14.70155
+G1 X159.939 Y103.390 E14.72856
+G1 X161.126 Y102.203 E14.81050
+G1 X161.126 Y101.649 E14.83751
+G1 X159.939 Y102.837 E14.91945
+G1 X159.939 Y102.283 E14.94646
+G1 X160.937 Y101.285 E15.01533
+G1 X160.383 Y101.285 E15.04233
+G1 X159.765 Y101.903 E15.08498
+G1 X159.727 Y102.392 F7800.000
+G1 F1957
+G1 X147.201 Y105.748 E15.70869
+G1 X147.201 Y111.045 F7800.000
+G1 F1957
+G1 X149.871 Y113.715 E15.89031
+G1 X158.051 Y113.715 E16.28375
+G1 X147.374 Y103.038 E17.00997
+G1 X147.374 Y101.285 E17.09425
+G1 X153.802 Y101.285 E17.40341
+G1 X159.727 Y107.210 E17.80639
+G1 X159.727 Y108.380 F7800.000
+G1 F1957
+G1 X147.201 Y111.736 E18.43010
+G1 Z9.350 F7800.000
+G1 E16.43010 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F2204
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F2204
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X73.885 Y102.031
+M106 S255
+G1 F3600
+G1 X73.171 Y101.318 E9.99742
+G1 X72.530 Y101.318 E10.03141
+G1 X73.682 Y102.470 E10.11783
+G1 X73.682 Y103.110 E10.15182
+G1 X71.890 Y101.318 E10.28632
+G1 X71.249 Y101.318 E10.32031
+G1 X73.682 Y103.751 E10.50287
+G1 X73.682 Y104.392 E10.53686
+G1 X70.608 Y101.318 E10.76749
+G1 X69.968 Y101.318 E10.80148
+G1 X73.682 Y105.032 E11.08018
+G1 X73.682 Y105.673 E11.11417
+G1 X69.327 Y101.318 E11.44095
+G1 X68.686 Y101.318 E11.47494
+G1 X73.682 Y106.314 E11.84978
+G1 X73.682 Y106.955 E11.88377
+G1 X68.045 Y101.318 E12.30668
+G1 X67.405 Y101.318 E12.34067
+G1 X73.682 Y107.595 E12.81166
+G1 X73.682 Y108.236 E12.84565
+G1 X66.764 Y101.318 E13.36470
+G1 X66.123 Y101.318 E13.39869
+G1 X73.682 Y108.877 E13.96581
+G1 X73.682 Y109.518 E13.99981
+G1 X65.482 Y101.318 E14.61500
+G1 X64.842 Y101.318 E14.64899
+G1 X73.682 Y110.158 E15.31225
+G1 X73.682 Y110.799 E15.34625
+G1 X64.201 Y101.318 E16.05758
+G1 X63.560 Y101.318 E16.09157
+G1 X73.682 Y111.440 E16.85098
+G1 X73.682 Y112.081 E16.88497
+G1 X62.919 Y101.318 E17.69244
+G1 X62.279 Y101.318 E17.72643
+G1 X73.682 Y112.721 E18.58198
+G1 X73.682 Y113.362 E18.61597
+G1 X61.638 Y101.318 E19.51959
+G1 X61.318 Y101.318 E19.53658
+G1 X61.318 Y101.638 E19.55358
+G1 X73.362 Y113.682 E20.45718
+G1 X72.721 Y113.682 E20.49117
+G1 X61.318 Y102.279 E21.34671
+G1 X61.318 Y102.920 E21.38070
+G1 X72.080 Y113.682 E22.18817
+G1 X71.440 Y113.682 E22.22216
+G1 X61.318 Y103.560 E22.98155
+G1 X61.318 Y104.201 E23.01554
+G1 X70.799 Y113.682 E23.72687
+G1 X70.158 Y113.682 E23.76086
+G1 X61.318 Y104.842 E24.42412
+G1 X61.318 Y105.482 E24.45811
+G1 X69.518 Y113.682 E25.07329
+G1 X68.877 Y113.682 E25.10728
+G1 X61.318 Y106.123 E25.67440
+G1 X61.318 Y106.764 E25.70839
+G1 X68.236 Y113.682 E26.22743
+G1 X67.595 Y113.682 E26.26142
+G1 X61.318 Y107.405 E26.73240
+G1 X61.318 Y108.045 E26.76639
+G1 X66.955 Y113.682 E27.18929
+G1 X66.314 Y113.682 E27.22328
+G1 X61.318 Y108.686 E27.59812
+G1 X61.318 Y109.327 E27.63211
+G1 X65.673 Y113.682 E27.95887
+G1 X65.032 Y113.682 E27.99286
+G1 X61.318 Y109.968 E28.27155
+G1 X61.318 Y110.608 E28.30554
+G1 X64.392 Y113.682 E28.53617
+G1 X63.751 Y113.682 E28.57016
+G1 X61.318 Y111.249 E28.75271
+G1 X61.318 Y111.890 E28.78670
+G1 X63.110 Y113.682 E28.92118
+G1 X62.469 Y113.682 E28.95517
+G1 X61.318 Y112.531 E29.04158
+G1 X61.318 Y113.171 E29.07557
+G1 X62.031 Y113.885 E29.12911
+M106 S252.45
+G1 E27.12911 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F2204
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.881 E2.10626
+G1 X93.044 Y99.193 E2.13942
+G1 X93.150 Y98.545 E2.17098
+G1 X93.326 Y97.880 E2.20406
+G1 X93.553 Y97.266 E2.23554
+G1 X93.876 Y96.604 E2.27099
+G1 X94.238 Y96.022 E2.30395
+G1 X94.634 Y95.501 E2.33543
+G1 X95.139 Y94.960 E2.37101
+G1 X95.590 Y94.561 E2.39998
+G1 X96.187 Y94.126 E2.43551
+G1 X96.780 Y93.782 E2.46847
+G1 X97.375 Y93.508 E2.49996
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60004
+G1 X100.076 Y92.998 E2.63299
+G1 X100.729 Y93.036 E2.66448
+G1 X101.457 Y93.151 E2.69992
+G1 X102.120 Y93.326 E2.73288
+G1 X102.734 Y93.553 E2.76437
+G1 X103.396 Y93.876 E2.79981
+G1 X103.978 Y94.238 E2.83277
+G1 X104.499 Y94.634 E2.86425
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96426
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.732 Y98.071 E3.06422
+G1 X106.888 Y98.739 E3.09718
+G1 X106.976 Y99.387 E3.12867
+G1 X107.001 Y100.124 E3.16411
+G1 X106.956 Y100.807 E3.19707
+G1 X106.850 Y101.455 E3.22863
+G1 X106.674 Y102.120 E3.26170
+G1 X106.447 Y102.734 E3.29319
+G1 X106.124 Y103.395 E3.32856
+G1 X105.735 Y104.018 E3.36389
+G1 X105.315 Y104.559 E3.39684
+G1 X104.866 Y105.035 E3.42833
+G1 X104.308 Y105.521 E3.46391
+G1 X103.814 Y105.873 E3.49308
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59318
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.876 Y107.001 E3.69293
+G1 X99.193 Y106.956 E3.72589
+G1 X98.545 Y106.850 E3.75745
+G1 X97.880 Y106.674 E3.79053
+G1 X97.266 Y106.447 E3.82201
+G1 X96.605 Y106.124 E3.85738
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92810
+G1 X94.963 Y104.865 E3.95727
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.814 E4.02191
+G1 X93.759 Y103.175 E4.05737
+G1 X93.509 Y102.627 E4.08633
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F2204
+G1 X92.898 Y102.037 E4.11988
+G1 X92.724 Y101.283 E4.15708
+G1 X92.629 Y100.513 E4.19440
+G1 X92.612 Y99.873 E4.22519
+G1 X92.661 Y99.148 E4.26011
+G1 X92.773 Y98.464 E4.29345
+G1 X92.958 Y97.764 E4.32831
+G1 X93.198 Y97.114 E4.36160
+G1 X93.538 Y96.417 E4.39892
+G1 X93.920 Y95.803 E4.43370
+G1 X94.339 Y95.252 E4.46700
+G1 X94.869 Y94.683 E4.50440
+G1 X95.348 Y94.260 E4.53514
+G1 X95.977 Y93.803 E4.57251
+G1 X96.602 Y93.439 E4.60730
+G1 X97.231 Y93.150 E4.64059
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74611
+G1 X100.080 Y92.612 E4.78089
+G1 X100.771 Y92.652 E4.81419
+G1 X101.537 Y92.773 E4.85150
+G1 X102.236 Y92.958 E4.88629
+G1 X102.886 Y93.198 E4.91958
+G1 X103.583 Y93.538 E4.95690
+G1 X104.197 Y93.920 E4.99168
+G1 X104.748 Y94.339 E5.02498
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09957
+G1 X106.197 Y95.976 E5.13045
+G1 X106.523 Y96.529 E5.16132
+G1 X106.851 Y97.232 E5.19865
+G1 X107.103 Y97.964 E5.23589
+G1 X107.267 Y98.669 E5.27067
+G1 X107.360 Y99.355 E5.30397
+G1 X107.387 Y100.130 E5.34128
+G1 X107.339 Y100.852 E5.37607
+G1 X107.227 Y101.536 E5.40941
+G1 X107.042 Y102.236 E5.44427
+G1 X106.802 Y102.886 E5.47756
+G1 X106.462 Y103.582 E5.51483
+G1 X106.052 Y104.239 E5.55207
+G1 X105.608 Y104.810 E5.58686
+G1 X105.134 Y105.314 E5.62015
+G1 X104.547 Y105.824 E5.65755
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71930
+G1 X102.768 Y106.851 E5.75663
+G1 X102.034 Y107.103 E5.79395
+G1 X101.412 Y107.252 E5.82470
+G1 X100.644 Y107.360 E5.86202
+G1 X99.870 Y107.387 E5.89926
+G1 X99.148 Y107.339 E5.93405
+G1 X98.464 Y107.227 E5.96739
+G1 X97.764 Y107.042 E6.00225
+G1 X97.114 Y106.802 E6.03554
+G1 X96.418 Y106.462 E6.07281
+G1 X95.762 Y106.052 E6.11001
+G1 X95.151 Y105.575 E6.14733
+G1 X94.685 Y105.133 E6.17821
+G1 X94.260 Y104.652 E6.20908
+G1 X93.803 Y104.024 E6.24641
+G1 X93.415 Y103.352 E6.28373
+G1 X93.150 Y102.770 E6.31448
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34989
+G1 X92.343 Y101.350 E6.38903
+G1 X92.244 Y100.541 E6.42822
+G1 X92.226 Y99.865 E6.46076
+G1 X92.277 Y99.104 E6.49742
+G1 X92.395 Y98.384 E6.53254
+G1 X92.590 Y97.647 E6.56918
+G1 X92.843 Y96.963 E6.60429
+G1 X93.200 Y96.230 E6.64347
+G1 X93.602 Y95.584 E6.68009
+G1 X94.044 Y95.003 E6.71519
+G1 X94.600 Y94.407 E6.75441
+G1 X95.106 Y93.959 E6.78693
+G1 X95.766 Y93.479 E6.82614
+G1 X96.424 Y93.097 E6.86275
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93707
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00880
+G1 X100.083 Y92.226 E7.04542
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11971
+G1 X102.353 Y92.590 E7.15632
+G1 X103.037 Y92.843 E7.19143
+G1 X103.770 Y93.200 E7.23061
+G1 X104.416 Y93.602 E7.26722
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38068
+G1 X106.520 Y95.766 E7.41326
+G1 X106.864 Y96.349 E7.44583
+G1 X107.209 Y97.088 E7.48502
+G1 X107.474 Y97.857 E7.52418
+G1 X107.647 Y98.599 E7.56079
+G1 X107.745 Y99.322 E7.59590
+G1 X107.774 Y100.136 E7.63508
+G1 X107.723 Y100.896 E7.67170
+G1 X107.605 Y101.616 E7.70682
+G1 X107.410 Y102.353 E7.74346
+G1 X107.157 Y103.037 E7.77856
+G1 X106.800 Y103.769 E7.81773
+G1 X106.368 Y104.460 E7.85689
+G1 X105.902 Y105.061 E7.89350
+G1 X105.401 Y105.592 E7.92861
+G1 X104.786 Y106.127 E7.96782
+G1 X104.234 Y106.520 E8.00039
+G1 X103.651 Y106.864 E8.03297
+G1 X102.912 Y107.209 E8.07216
+G1 X102.142 Y107.474 E8.11135
+G1 X101.484 Y107.632 E8.14387
+G1 X100.678 Y107.745 E8.18306
+G1 X99.864 Y107.774 E8.22222
+G1 X99.104 Y107.723 E8.25883
+G1 X98.384 Y107.605 E8.29395
+G1 X97.647 Y107.410 E8.33059
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40487
+G1 X95.541 Y106.369 E8.44401
+G1 X94.899 Y105.867 E8.48320
+G1 X94.407 Y105.401 E8.51577
+G1 X93.959 Y104.894 E8.54834
+G1 X93.480 Y104.234 E8.58753
+G1 X93.072 Y103.529 E8.62672
+G1 X92.792 Y102.913 E8.65925
+G1 X92.603 Y102.366 E8.68707
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F2204
+G1 X98.308 Y106.488 E9.02912
+G1 X98.606 Y106.567 E9.04394
+G1 X99.226 Y106.668 E9.07416
+G1 X99.881 Y106.712 E9.10575
+G1 X100.585 Y106.687 E9.13964
+G1 X101.286 Y106.589 E9.17370
+G1 X101.845 Y106.455 E9.20133
+G1 X102.515 Y106.224 E9.23540
+G1 X103.157 Y105.925 E9.26946
+G1 X103.656 Y105.630 E9.29736
+G1 X104.129 Y105.293 E9.32526
+G1 X104.744 Y104.744 E9.36494
+G1 X95.257 Y95.257 E10.01021
+G1 X95.771 Y94.786 E10.04373
+G1 X96.346 Y94.369 E10.07789
+G1 X96.913 Y94.039 E10.10947
+G1 X97.482 Y93.777 E10.13960
+G1 X98.155 Y93.545 E10.17382
+G1 X98.714 Y93.411 E10.20145
+G1 X99.417 Y93.312 E10.23561
+G1 X100.073 Y93.288 E10.26719
+G1 X100.699 Y93.323 E10.29732
+G1 X101.398 Y93.434 E10.33136
+G1 X101.692 Y93.512 E10.34604
+G1 X106.723 Y98.543 E10.68822
+G1 X106.778 Y101.178 F7800.000
+G1 F2204
+G1 X94.715 Y104.410 E11.28886
+G1 X93.222 Y98.822 F7800.000
+G1 F2204
+G1 X105.280 Y95.591 E11.88925
+G1 X104.624 Y105.093 F7800.000
+G1 F2204
+G1 X106.467 Y98.212 E12.23188
+G1 X106.453 Y98.152 E12.23486
+G1 X106.224 Y97.485 E12.26875
+G1 X105.925 Y96.843 E12.30281
+G1 X105.630 Y96.344 E12.33071
+G1 X105.293 Y95.871 E12.35861
+G1 X104.829 Y95.337 E12.39267
+G1 X104.313 Y94.856 E12.42662
+G1 X103.814 Y94.476 E12.45675
+G1 X103.256 Y94.130 E12.48834
+G1 X102.620 Y93.819 E12.52238
+G1 X102.032 Y93.602 E12.55251
+G1 X101.735 Y93.524 E12.56729
+G1 X98.265 Y106.476 E13.21225
+G1 X97.968 Y106.398 E13.22703
+G1 X97.380 Y106.181 E13.25716
+G1 X96.746 Y105.871 E13.29111
+G1 X96.150 Y105.499 E13.32491
+G1 X95.592 Y105.063 E13.35897
+G1 X95.171 Y104.663 E13.38687
+G1 X94.786 Y104.229 E13.41477
+G1 X94.370 Y103.656 E13.44883
+G1 X94.016 Y103.043 E13.48290
+G1 X93.778 Y102.520 E13.51053
+G1 X93.533 Y101.787 E13.54768
+G1 X95.377 Y94.903 E13.89048
+G1 E11.89048 F2400.00000
+G92 E0
+G1 X147.290 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F2204
+G1 X160.977 Y100.996 E2.65827
+G1 X160.977 Y114.004 E3.28389
+G1 X147.290 Y114.004 E3.94217
+G1 X147.290 Y101.056 E4.56490
+G1 X146.905 Y100.611 F7800.000
+G1 F2204
+G1 X161.362 Y100.611 E5.26027
+G1 X161.362 Y114.389 E5.92298
+G1 X146.905 Y114.389 E6.61835
+G1 X146.905 Y100.671 E7.27817
+G1 X146.519 Y100.225 F7800.000
+G1 F1800
+G1 X161.748 Y100.225 E8.01063
+G1 X161.748 Y114.775 E8.71044
+G1 X146.519 Y114.775 E9.44290
+G1 X146.519 Y100.285 E10.13982
+G1 X146.906 Y100.326 F7800.000
+G1 X147.406 Y105.693
+G1 F2204
+G1 X159.288 Y102.509 E10.73148
+G1 X160.861 Y101.903 F7800.000
+G1 F1200
+G1 X160.243 Y101.285 E10.77413
+G1 X159.690 Y101.285 E10.80114
+G1 X160.688 Y102.283 E10.87001
+G1 X160.688 Y102.837 E10.89702
+G1 X159.500 Y101.649 E10.97896
+G1 X159.500 Y102.203 E11.00597
+G1 X160.688 Y103.390 E11.08792
+G1 X160.688 Y103.943 E11.11492
+G1 X159.500 Y102.756 E11.19687
+G1 X159.500 Y103.310 E11.22388
+G1 X160.688 Y104.497 E11.30582
+G1 X160.688 Y105.050 E11.33283
+G1 X159.500 Y103.863 E11.41477
+G1 X159.500 Y104.416 E11.44178
+G1 X160.688 Y105.604 E11.52373
+G1 X160.688 Y106.157 E11.55073
+G1 X159.500 Y104.970 E11.63268
+G1 X159.500 Y105.523 E11.65969
+G1 X160.688 Y106.710 E11.74163
+G1 X160.688 Y107.264 E11.76864
+G1 X159.500 Y106.076 E11.85058
+G1 X159.500 Y106.630 E11.87759
+G1 X160.688 Y107.817 E11.95954
+G1 X160.688 Y108.370 E11.98654
+G1 X159.500 Y107.183 E12.06849
+G1 X159.500 Y107.736 E12.09550
+G1 X160.688 Y108.924 E12.17744
+G1 X160.688 Y109.477 E12.20445
+G1 X159.500 Y108.290 E12.28639
+G1 X159.500 Y108.843 E12.31340
+G1 X160.688 Y110.030 E12.39535
+G1 X160.688 Y110.584 E12.42235
+G1 X159.500 Y109.397 E12.50430
+G1 X159.500 Y109.950 E12.53131
+G1 X160.688 Y111.137 E12.61325
+G1 X160.688 Y111.691 E12.64026
+G1 X159.500 Y110.503 E12.72220
+G1 X159.500 Y111.057 E12.74921
+G1 X160.688 Y112.244 E12.83116
+G1 X160.688 Y112.797 E12.85816
+G1 X159.500 Y111.610 E12.94011
+G1 X159.500 Y112.163 E12.96712
+G1 X160.688 Y113.351 E13.04906
+G1 X160.688 Y113.715 E13.06682
+G1 X160.498 Y113.715 E13.07607
+G1 X159.500 Y112.717 E13.14493
+G1 X159.500 Y113.270 E13.17194
+G1 X160.118 Y113.888 E13.21459
+G1 X156.113 Y113.888 F7800.000
+G1 F2204
+G1 X159.115 Y102.686 E13.77238
+G1 X159.115 Y101.285 E13.83974
+G1 X153.502 Y101.285 E14.10971
+G1 X150.125 Y113.888 E14.73724
+G1 X147.406 Y111.681 F7800.000
+G1 F2204
+G1 X159.288 Y108.497 E15.32889
+G1 X159.288 Y106.772 F7800.000
+G1 F2204
+G1 X153.802 Y101.285 E15.70205
+G1 X147.579 Y101.285 E16.00134
+G1 X147.579 Y103.243 E16.09549
+G1 X158.051 Y113.715 E16.80775
+G1 X149.871 Y113.715 E17.20119
+G1 X147.406 Y111.250 E17.36885
+M106 S206.55
+G1 Z9.650 F7800.000
+G1 E15.36885 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F3600
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 X73.091 Y113.888
+G1 F1200
+G1 X73.715 Y113.264 E9.98722
+G1 X73.715 Y112.707 E10.01460
+G1 X72.707 Y113.715 E10.08461
+G1 X72.150 Y113.715 E10.11198
+G1 X73.715 Y112.150 E10.22071
+G1 X73.715 Y111.593 E10.24808
+G1 X71.593 Y113.715 E10.39552
+G1 X71.036 Y113.715 E10.42290
+G1 X73.715 Y111.036 E10.60906
+G1 X73.715 Y110.479 E10.63644
+G1 X70.479 Y113.715 E10.86132
+G1 X69.921 Y113.715 E10.88869
+G1 X73.715 Y109.921 E11.15229
+G1 X73.715 Y109.364 E11.17967
+G1 X69.364 Y113.715 E11.48198
+G1 X68.807 Y113.715 E11.50936
+G1 X73.715 Y108.807 E11.85039
+G1 X73.715 Y108.250 E11.87777
+G1 X68.250 Y113.715 E12.25752
+G1 X67.693 Y113.715 E12.28490
+G1 X73.715 Y107.693 E12.70337
+G1 X73.715 Y107.136 E12.73075
+G1 X67.136 Y113.715 E13.18794
+G1 X66.578 Y113.715 E13.21532
+G1 X73.715 Y106.578 E13.71122
+G1 X73.715 Y106.021 E13.73860
+G1 X66.021 Y113.715 E14.27323
+G1 X65.464 Y113.715 E14.30060
+G1 X73.715 Y105.464 E14.87395
+G1 X73.715 Y104.907 E14.90133
+G1 X64.907 Y113.715 E15.51339
+G1 X64.350 Y113.715 E15.54077
+G1 X73.715 Y104.350 E16.19155
+G1 X73.715 Y103.793 E16.21893
+G1 X63.793 Y113.715 E16.90842
+G1 X63.235 Y113.715 E16.93580
+G1 X73.715 Y103.235 E17.66402
+G1 X73.715 Y102.678 E17.69140
+G1 X62.678 Y113.715 E18.45833
+G1 X62.121 Y113.715 E18.48571
+G1 X73.715 Y102.121 E19.29137
+G1 X73.715 Y101.564 E19.31875
+G1 X61.564 Y113.715 E20.16312
+G1 X61.285 Y113.715 E20.17681
+G1 X61.285 Y113.436 E20.19050
+G1 X73.436 Y101.285 E21.03486
+G1 X72.879 Y101.285 E21.06224
+G1 X61.285 Y112.879 E21.86789
+G1 X61.285 Y112.322 E21.89527
+G1 X72.322 Y101.285 E22.66220
+G1 X71.764 Y101.285 E22.68958
+G1 X61.285 Y111.764 E23.41779
+G1 X61.285 Y111.207 E23.44517
+G1 X71.207 Y101.285 E24.13466
+G1 X70.650 Y101.285 E24.16204
+G1 X61.285 Y110.650 E24.81282
+G1 X61.285 Y110.093 E24.84019
+G1 X70.093 Y101.285 E25.45225
+G1 X69.536 Y101.285 E25.47963
+G1 X61.285 Y109.536 E26.05297
+G1 X61.285 Y108.979 E26.08034
+G1 X68.979 Y101.285 E26.61496
+G1 X68.421 Y101.285 E26.64234
+G1 X61.285 Y108.421 E27.13824
+G1 X61.285 Y107.864 E27.16562
+G1 X67.864 Y101.285 E27.62280
+G1 X67.307 Y101.285 E27.65018
+G1 X61.285 Y107.307 E28.06865
+G1 X61.285 Y106.750 E28.09603
+G1 X66.750 Y101.285 E28.47577
+G1 X66.193 Y101.285 E28.50315
+G1 X61.285 Y106.193 E28.84418
+G1 X61.285 Y105.636 E28.87155
+G1 X65.636 Y101.285 E29.17386
+G1 X65.079 Y101.285 E29.20124
+G1 X61.285 Y105.079 E29.46483
+G1 X61.285 Y104.521 E29.49221
+G1 X64.521 Y101.285 E29.71708
+G1 X63.964 Y101.285 E29.74446
+G1 X61.285 Y103.964 E29.93061
+G1 X61.285 Y103.407 E29.95799
+G1 X63.407 Y101.285 E30.10543
+G1 X62.850 Y101.285 E30.13280
+G1 X61.285 Y102.850 E30.24152
+G1 X61.285 Y102.293 E30.26890
+G1 X62.293 Y101.285 E30.33890
+G1 X61.736 Y101.285 E30.36628
+G1 X61.112 Y101.909 E30.40961
+G1 E28.40961 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.881 E2.10625
+G1 X93.045 Y99.190 E2.13955
+G1 X93.150 Y98.547 E2.17091
+G1 X93.341 Y97.835 E2.20635
+G1 X93.585 Y97.192 E2.23944
+G1 X93.874 Y96.607 E2.27079
+G1 X94.265 Y95.982 E2.30624
+G1 X94.687 Y95.439 E2.33933
+G1 X95.137 Y94.961 E2.37089
+G1 X95.590 Y94.561 E2.39998
+G1 X96.187 Y94.126 E2.43551
+G1 X96.782 Y93.781 E2.46860
+G1 X97.374 Y93.508 E2.49995
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60003
+G1 X100.079 Y92.998 E2.63312
+G1 X100.729 Y93.036 E2.66448
+G1 X101.457 Y93.151 E2.69992
+G1 X102.122 Y93.327 E2.73301
+G1 X102.734 Y93.553 E2.76436
+G1 X103.396 Y93.876 E2.79981
+G1 X103.981 Y94.239 E2.83290
+G1 X104.499 Y94.634 E2.86425
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.871 Y96.184 E2.96412
+G1 X106.219 Y96.782 E2.99742
+G1 X106.492 Y97.374 E3.02877
+G1 X106.732 Y98.071 E3.06422
+G1 X106.888 Y98.741 E3.09731
+G1 X106.976 Y99.387 E3.12866
+G1 X107.001 Y100.124 E3.16411
+G1 X106.955 Y100.810 E3.19719
+G1 X106.850 Y101.453 E3.22855
+G1 X106.659 Y102.165 E3.26399
+G1 X106.415 Y102.808 E3.29708
+G1 X106.126 Y103.393 E3.32844
+G1 X105.735 Y104.018 E3.36388
+G1 X105.313 Y104.561 E3.39697
+G1 X104.866 Y105.035 E3.42833
+G1 X104.308 Y105.521 E3.46391
+G1 X103.814 Y105.873 E3.49308
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.929 Y106.732 E3.59304
+G1 X101.259 Y106.888 E3.62613
+G1 X100.613 Y106.976 E3.65748
+G1 X99.876 Y107.001 E3.69293
+G1 X99.190 Y106.955 E3.72602
+G1 X98.547 Y106.850 E3.75737
+G1 X97.835 Y106.659 E3.79282
+G1 X97.192 Y106.415 E3.82590
+G1 X96.607 Y106.126 E3.85726
+G1 X95.982 Y105.735 E3.89270
+G1 X95.439 Y105.313 E3.92579
+G1 X94.961 Y104.863 E3.95736
+G1 X94.561 Y104.410 E3.98644
+G1 X94.126 Y103.813 E4.02197
+G1 X93.781 Y103.218 E4.05506
+G1 X93.508 Y102.626 E4.08642
+G1 X93.333 Y102.115 E4.11237
+G1 X92.948 Y102.184 F7800.000
+G1 F3600
+G1 X92.898 Y102.037 E4.11988
+G1 X92.724 Y101.283 E4.15708
+G1 X92.629 Y100.513 E4.19440
+G1 X92.612 Y99.873 E4.22519
+G1 X92.661 Y99.146 E4.26024
+G1 X92.773 Y98.465 E4.29340
+G1 X92.973 Y97.716 E4.33071
+G1 X93.232 Y97.037 E4.36563
+G1 X93.537 Y96.419 E4.39879
+G1 X93.948 Y95.761 E4.43611
+G1 X94.393 Y95.188 E4.47103
+G1 X94.868 Y94.684 E4.50432
+G1 X95.348 Y94.260 E4.53514
+G1 X95.977 Y93.803 E4.57251
+G1 X96.604 Y93.438 E4.60742
+G1 X97.231 Y93.150 E4.64059
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70873
+G1 X99.357 Y92.639 E4.74610
+G1 X100.082 Y92.612 E4.78102
+G1 X100.771 Y92.652 E4.81418
+G1 X101.537 Y92.773 E4.85150
+G1 X102.239 Y92.959 E4.88641
+G1 X102.886 Y93.198 E4.91958
+G1 X103.583 Y93.538 E4.95689
+G1 X104.200 Y93.921 E4.99181
+G1 X104.748 Y94.339 E5.02497
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09957
+G1 X106.196 Y95.974 E5.13036
+G1 X106.562 Y96.604 E5.16540
+G1 X106.850 Y97.231 E5.19857
+G1 X107.103 Y97.964 E5.23588
+G1 X107.268 Y98.671 E5.27080
+G1 X107.360 Y99.354 E5.30396
+G1 X107.387 Y100.130 E5.34128
+G1 X107.339 Y100.854 E5.37619
+G1 X107.227 Y101.535 E5.40936
+G1 X107.027 Y102.284 E5.44667
+G1 X106.768 Y102.963 E5.48159
+G1 X106.463 Y103.581 E5.51475
+G1 X106.052 Y104.239 E5.55207
+G1 X105.607 Y104.812 E5.58699
+G1 X105.134 Y105.314 E5.62015
+G1 X104.547 Y105.824 E5.65755
+G1 X104.024 Y106.197 E5.68842
+G1 X103.471 Y106.523 E5.71930
+G1 X102.768 Y106.851 E5.75662
+G1 X102.036 Y107.103 E5.79386
+G1 X101.329 Y107.268 E5.82878
+G1 X100.646 Y107.360 E5.86194
+G1 X99.870 Y107.387 E5.89926
+G1 X99.146 Y107.339 E5.93417
+G1 X98.465 Y107.227 E5.96734
+G1 X97.716 Y107.027 E6.00465
+G1 X97.037 Y106.768 E6.03957
+G1 X96.419 Y106.463 E6.07273
+G1 X95.761 Y106.052 E6.11005
+G1 X95.188 Y105.607 E6.14496
+G1 X94.684 Y105.132 E6.17826
+G1 X94.260 Y104.652 E6.20908
+G1 X93.803 Y104.023 E6.24644
+G1 X93.438 Y103.396 E6.28136
+G1 X93.150 Y102.769 E6.31453
+G1 X92.968 Y102.241 E6.34140
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34988
+G1 X92.343 Y101.350 E6.38902
+G1 X92.244 Y100.541 E6.42821
+G1 X92.226 Y99.865 E6.46076
+G1 X92.278 Y99.102 E6.49755
+G1 X92.395 Y98.384 E6.53252
+G1 X92.606 Y97.597 E6.57171
+G1 X92.878 Y96.883 E6.60845
+G1 X93.200 Y96.231 E6.64342
+G1 X93.632 Y95.540 E6.68261
+G1 X94.100 Y94.937 E6.71936
+G1 X94.599 Y94.407 E6.75437
+G1 X95.106 Y93.959 E6.78693
+G1 X95.766 Y93.479 E6.82613
+G1 X96.426 Y93.096 E6.86288
+G1 X97.087 Y92.792 E6.89785
+G1 X97.858 Y92.526 E6.93707
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00880
+G1 X100.086 Y92.226 E7.04555
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11970
+G1 X102.355 Y92.591 E7.15645
+G1 X103.037 Y92.843 E7.19142
+G1 X103.770 Y93.200 E7.23060
+G1 X104.419 Y93.603 E7.26735
+G1 X104.997 Y94.044 E7.30232
+G1 X105.593 Y94.599 E7.34149
+G1 X106.127 Y95.214 E7.38068
+G1 X106.520 Y95.765 E7.41322
+G1 X106.904 Y96.426 E7.45002
+G1 X107.208 Y97.087 E7.48499
+G1 X107.474 Y97.857 E7.52417
+G1 X107.648 Y98.601 E7.56092
+G1 X107.745 Y99.322 E7.59589
+G1 X107.774 Y100.136 E7.63508
+G1 X107.722 Y100.898 E7.67182
+G1 X107.605 Y101.616 E7.70679
+G1 X107.394 Y102.403 E7.74598
+G1 X107.122 Y103.117 E7.78273
+G1 X106.800 Y103.769 E7.81770
+G1 X106.368 Y104.460 E7.85688
+G1 X105.900 Y105.063 E7.89363
+G1 X105.401 Y105.592 E7.92860
+G1 X104.786 Y106.127 E7.96782
+G1 X104.234 Y106.520 E8.00039
+G1 X103.651 Y106.864 E8.03297
+G1 X102.912 Y107.209 E8.07215
+G1 X102.143 Y107.474 E8.11131
+G1 X101.399 Y107.648 E8.14806
+G1 X100.678 Y107.745 E8.18303
+G1 X99.864 Y107.774 E8.22221
+G1 X99.102 Y107.722 E8.25896
+G1 X98.384 Y107.605 E8.29393
+G1 X97.597 Y107.394 E8.33311
+G1 X96.883 Y107.122 E8.36986
+G1 X96.231 Y106.800 E8.40483
+G1 X95.540 Y106.368 E8.44402
+G1 X94.937 Y105.900 E8.48076
+G1 X94.407 Y105.401 E8.51578
+G1 X93.959 Y104.894 E8.54834
+G1 X93.479 Y104.234 E8.58754
+G1 X93.096 Y103.574 E8.62429
+G1 X92.792 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68706
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F4800
+G1 X98.306 Y106.486 E9.02900
+G1 X98.608 Y106.567 E9.04402
+G1 X99.223 Y106.668 E9.07402
+G1 X99.881 Y106.712 E9.10573
+G1 X100.588 Y106.687 E9.13978
+G1 X101.206 Y106.604 E9.16978
+G1 X101.849 Y106.453 E9.20149
+G1 X102.515 Y106.224 E9.23537
+G1 X103.157 Y105.925 E9.26944
+G1 X103.656 Y105.630 E9.29734
+G1 X104.129 Y105.293 E9.32524
+G1 X104.744 Y104.744 E9.36491
+G1 X95.256 Y95.256 E10.01024
+G1 X95.771 Y94.786 E10.04375
+G1 X96.345 Y94.369 E10.07791
+G1 X96.916 Y94.038 E10.10962
+G1 X97.482 Y93.777 E10.13962
+G1 X98.155 Y93.545 E10.17385
+G1 X98.714 Y93.411 E10.20147
+G1 X99.417 Y93.312 E10.23563
+G1 X100.076 Y93.288 E10.26734
+G1 X100.698 Y93.323 E10.29734
+G1 X101.397 Y93.434 E10.33138
+G1 X101.693 Y93.512 E10.34607
+G1 X106.723 Y98.543 E10.68824
+G1 X106.778 Y101.178 F7800.000
+G1 F4800
+G1 X94.715 Y104.410 E11.28888
+G1 X93.222 Y98.822 F7800.000
+G1 F4800
+G1 X105.280 Y95.591 E11.88927
+G1 X104.624 Y105.093 F7800.000
+G1 F4800
+G1 X106.467 Y98.212 E12.23191
+G1 X106.453 Y98.151 E12.23489
+G1 X106.223 Y97.482 E12.26893
+G1 X105.962 Y96.916 E12.29893
+G1 X105.628 Y96.341 E12.33092
+G1 X105.293 Y95.871 E12.35863
+G1 X104.829 Y95.337 E12.39270
+G1 X104.312 Y94.855 E12.42665
+G1 X103.816 Y94.478 E12.45665
+G1 X103.256 Y94.130 E12.48837
+G1 X102.620 Y93.819 E12.52241
+G1 X102.035 Y93.603 E12.55241
+G1 X101.735 Y93.524 E12.56731
+G1 X98.265 Y106.475 E13.21221
+G1 X97.924 Y106.384 E13.22920
+G1 X97.308 Y106.149 E13.26091
+G1 X96.748 Y105.873 E13.29091
+G1 X96.148 Y105.498 E13.32495
+G1 X95.627 Y105.093 E13.35667
+G1 X95.169 Y104.662 E13.38694
+G1 X94.786 Y104.229 E13.41473
+G1 X94.369 Y103.655 E13.44888
+G1 X94.038 Y103.084 E13.48060
+G1 X93.777 Y102.518 E13.51060
+G1 X93.533 Y101.787 E13.54764
+G1 X95.377 Y94.903 E13.89044
+G1 E11.89044 F2400.00000
+G92 E0
+G1 X147.496 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X160.538 Y100.996 E2.62731
+G1 X160.538 Y114.004 E3.25293
+G1 X147.496 Y114.004 E3.88024
+G1 X147.496 Y101.056 E4.50297
+G1 X147.110 Y100.611 F7800.000
+G1 F3600
+G1 X160.924 Y100.611 E5.16738
+G1 X160.924 Y114.389 E5.83009
+G1 X147.110 Y114.389 E6.49450
+G1 X147.110 Y100.671 E7.15432
+G1 X146.724 Y100.225 F7800.000
+G1 F1800
+G1 X161.310 Y100.225 E7.85582
+G1 X161.310 Y114.775 E8.55563
+G1 X146.724 Y114.775 E9.25713
+G1 X146.724 Y100.285 E9.95405
+G1 X147.111 Y100.328 F7800.000
+G1 X147.611 Y105.638
+G1 F4800
+G1 X158.850 Y102.627 E10.51365
+G1 X158.888 Y101.903 F7800.000
+G1 F1200
+G1 X159.506 Y101.285 E10.55630
+G1 X160.060 Y101.285 E10.58330
+G1 X159.062 Y102.283 E10.65217
+G1 X159.062 Y102.837 E10.67917
+G1 X160.249 Y101.649 E10.76112
+G1 X160.249 Y102.203 E10.78813
+G1 X159.062 Y103.390 E10.87007
+G1 X159.062 Y103.943 E10.89708
+G1 X160.249 Y102.756 E10.97903
+G1 X160.249 Y103.309 E11.00603
+G1 X159.062 Y104.497 E11.08798
+G1 X159.062 Y105.050 E11.11498
+G1 X160.249 Y103.863 E11.19693
+G1 X160.249 Y104.416 E11.22394
+G1 X159.062 Y105.603 E11.30588
+G1 X159.062 Y106.157 E11.33289
+G1 X160.249 Y104.970 E11.41484
+G1 X160.249 Y105.523 E11.44184
+G1 X159.062 Y106.710 E11.52379
+G1 X159.062 Y107.264 E11.55079
+G1 X160.249 Y106.076 E11.63274
+G1 X160.249 Y106.630 E11.65975
+G1 X159.062 Y107.817 E11.74169
+G1 X159.062 Y108.370 E11.76870
+G1 X160.249 Y107.183 E11.85065
+G1 X160.249 Y107.736 E11.87765
+G1 X159.062 Y108.924 E11.95960
+G1 X159.062 Y109.477 E11.98660
+G1 X160.249 Y108.290 E12.06855
+G1 X160.249 Y108.843 E12.09556
+G1 X159.062 Y110.030 E12.17750
+G1 X159.062 Y110.584 E12.20451
+G1 X160.249 Y109.396 E12.28646
+G1 X160.249 Y109.950 E12.31346
+G1 X159.062 Y111.137 E12.39541
+G1 X159.062 Y111.690 E12.42241
+G1 X160.249 Y110.503 E12.50436
+G1 X160.249 Y111.057 E12.53137
+G1 X159.062 Y112.244 E12.61331
+G1 X159.062 Y112.797 E12.64032
+G1 X160.249 Y111.610 E12.72227
+G1 X160.249 Y112.163 E12.74927
+G1 X159.062 Y113.351 E12.83122
+G1 X159.062 Y113.715 E12.84898
+G1 X159.251 Y113.715 E12.85822
+G1 X160.249 Y112.717 E12.92710
+G1 X160.249 Y113.270 E12.95410
+G1 X159.631 Y113.888 E12.99676
+G1 X156.113 Y113.888 F7800.000
+G1 F4800
+G1 X158.676 Y104.323 E13.47306
+G1 X158.676 Y101.285 E13.61913
+G1 X153.502 Y101.285 E13.86801
+G1 X150.125 Y113.888 E14.49554
+G1 X147.611 Y111.626 F7800.000
+G1 F4800
+G1 X158.850 Y108.615 E15.05514
+G1 X158.850 Y106.333 F7800.000
+G1 F4800
+G1 X153.802 Y101.285 E15.39847
+G1 X147.785 Y101.285 E15.68789
+G1 X147.785 Y103.448 E15.79191
+G1 X158.051 Y113.715 E16.49021
+G1 X149.871 Y113.715 E16.88365
+G1 X147.611 Y111.455 E17.03735
+M106 S145.35
+G1 Z9.950 F7800.000
+G1 E15.03735 F2400.00000
+G92 E0
+G1 X74.004 Y114.004 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X60.996 Y114.004 E2.62562
+G1 X60.996 Y100.996 E3.25123
+G1 X74.004 Y100.996 E3.87685
+G1 X74.004 Y113.944 E4.49958
+G1 X74.389 Y114.389 F7800.000
+G1 F3600
+G1 X60.611 Y114.389 E5.16230
+G1 X60.611 Y100.611 E5.82501
+G1 X74.389 Y100.611 E6.48772
+G1 X74.389 Y114.329 E7.14754
+G1 X74.775 Y114.775 F7800.000
+G1 F1800
+G1 X60.225 Y114.775 E7.84735
+G1 X60.225 Y100.225 E8.54715
+G1 X74.775 Y100.225 E9.24696
+G1 X74.775 Y114.715 E9.94388
+G1 X74.389 Y114.671 F7800.000
+G1 E7.94388 F2400.00000
+G92 E0
+G1 X73.891 Y101.801 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X73.350 Y101.260 E2.03262
+G1 X72.866 Y101.260 E2.05324
+G1 X73.740 Y102.134 E2.10592
+G1 X73.740 Y102.617 E2.12655
+G1 X72.383 Y101.260 E2.20839
+G1 X71.899 Y101.260 E2.22901
+G1 X73.740 Y103.101 E2.34002
+G1 X73.740 Y103.585 E2.36065
+G1 X71.415 Y101.260 E2.50082
+G1 X70.932 Y101.260 E2.52145
+G1 X73.740 Y104.068 E2.69079
+G1 X73.740 Y104.552 E2.71142
+G1 X70.448 Y101.260 E2.90993
+G1 X69.965 Y101.260 E2.93055
+G1 X73.740 Y105.035 E3.15823
+G1 X73.740 Y105.519 E3.17885
+G1 X69.481 Y101.260 E3.43569
+G1 X68.998 Y101.260 E3.45631
+G1 X73.740 Y106.002 E3.74232
+G1 X73.740 Y106.486 E3.76295
+G1 X68.514 Y101.260 E4.07812
+G1 X68.030 Y101.260 E4.09875
+G1 X73.740 Y106.970 E4.44309
+G1 X73.740 Y107.453 E4.46371
+G1 X67.547 Y101.260 E4.83722
+G1 X67.063 Y101.260 E4.85784
+G1 X73.740 Y107.937 E5.26052
+G1 X73.740 Y108.420 E5.28114
+G1 X66.580 Y101.260 E5.71298
+G1 X66.096 Y101.260 E5.73361
+G1 X73.740 Y108.904 E6.19461
+G1 X73.740 Y109.387 E6.21524
+G1 X65.613 Y101.260 E6.70541
+G1 X65.129 Y101.260 E6.72603
+G1 X73.740 Y109.871 E7.24537
+G1 X73.740 Y110.355 E7.26600
+G1 X64.645 Y101.260 E7.81450
+G1 X64.162 Y101.260 E7.83513
+G1 X73.740 Y110.838 E8.41280
+G1 X73.740 Y111.322 E8.43342
+G1 X63.678 Y101.260 E9.04026
+G1 X63.195 Y101.260 E9.06089
+G1 X73.740 Y111.805 E9.69689
+G1 X73.740 Y112.289 E9.71752
+G1 X62.711 Y101.260 E10.38269
+G1 X62.228 Y101.260 E10.40331
+G1 X73.740 Y112.772 E11.09765
+G1 X73.740 Y113.256 E11.11827
+G1 X61.744 Y101.260 E11.84178
+G1 X61.260 Y101.260 E11.86240
+G1 X73.740 Y113.740 E12.61507
+G1 X73.256 Y113.740 E12.63569
+G1 X61.260 Y101.744 E13.35919
+G1 X61.260 Y102.228 E13.37981
+G1 X72.772 Y113.740 E14.07415
+G1 X72.289 Y113.740 E14.09477
+G1 X61.260 Y102.711 E14.75994
+G1 X61.260 Y103.195 E14.78056
+G1 X71.805 Y113.740 E15.41656
+G1 X71.322 Y113.740 E15.43718
+G1 X61.260 Y103.678 E16.04402
+G1 X61.260 Y104.162 E16.06464
+G1 X70.838 Y113.740 E16.64231
+G1 X70.354 Y113.740 E16.66293
+G1 X61.260 Y104.646 E17.21143
+G1 X61.260 Y105.129 E17.23205
+G1 X69.871 Y113.740 E17.75139
+G1 X69.387 Y113.740 E17.77201
+G1 X61.260 Y105.613 E18.26218
+G1 X61.260 Y106.096 E18.28280
+G1 X68.904 Y113.740 E18.74381
+G1 X68.420 Y113.740 E18.76443
+G1 X61.260 Y106.580 E19.19626
+G1 X61.260 Y107.063 E19.21689
+G1 X67.937 Y113.740 E19.61956
+G1 X67.453 Y113.740 E19.64018
+G1 X61.260 Y107.547 E20.01368
+G1 X61.260 Y108.031 E20.03431
+G1 X66.969 Y113.740 E20.37864
+G1 X66.486 Y113.740 E20.39927
+G1 X61.260 Y108.514 E20.71444
+G1 X61.260 Y108.998 E20.73506
+G1 X66.002 Y113.740 E21.02106
+G1 X65.519 Y113.740 E21.04169
+G1 X61.260 Y109.481 E21.29852
+G1 X61.260 Y109.965 E21.31915
+G1 X65.035 Y113.740 E21.54682
+G1 X64.552 Y113.740 E21.56744
+G1 X61.260 Y110.448 E21.76595
+G1 X61.260 Y110.932 E21.78657
+G1 X64.068 Y113.740 E21.95591
+G1 X63.584 Y113.740 E21.97653
+G1 X61.260 Y111.416 E22.11670
+G1 X61.260 Y111.899 E22.13733
+G1 X63.101 Y113.740 E22.24833
+G1 X62.617 Y113.740 E22.26895
+G1 X61.260 Y112.383 E22.35079
+G1 X61.260 Y112.866 E22.37142
+G1 X62.134 Y113.740 E22.42409
+G1 X61.650 Y113.740 E22.44471
+G1 X61.109 Y113.199 E22.47733
+G1 E20.47733 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.881 E2.10625
+G1 X93.045 Y99.187 E2.13968
+G1 X93.150 Y98.547 E2.17090
+G1 X93.341 Y97.832 E2.20649
+G1 X93.552 Y97.268 E2.23546
+G1 X93.876 Y96.604 E2.27098
+G1 X94.241 Y96.017 E2.30420
+G1 X94.634 Y95.501 E2.33542
+G1 X95.137 Y94.962 E2.37087
+G1 X95.657 Y94.507 E2.40409
+G1 X96.185 Y94.128 E2.43538
+G1 X96.785 Y93.780 E2.46872
+G1 X97.374 Y93.508 E2.49995
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60003
+G1 X100.081 Y92.998 E2.63325
+G1 X100.729 Y93.036 E2.66447
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.395 Y93.876 E2.79974
+G1 X104.020 Y94.266 E2.83520
+G1 X104.498 Y94.633 E2.86417
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96426
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.378 E3.02896
+G1 X106.720 Y98.030 E3.06218
+G1 X106.873 Y98.661 E3.09341
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19321
+G1 X106.849 Y101.460 E3.22889
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32856
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42845
+G1 X104.308 Y105.521 E3.46391
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.622 Y106.493 E3.55779
+G1 X101.970 Y106.720 E3.59101
+G1 X101.339 Y106.873 E3.62223
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69307
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75750
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92810
+G1 X94.965 Y104.867 E3.95713
+G1 X94.507 Y104.343 E3.99056
+G1 X94.128 Y103.815 E4.02185
+G1 X93.780 Y103.215 E4.05519
+G1 X93.508 Y102.626 E4.08642
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F3600
+G1 X92.898 Y102.037 E4.11989
+G1 X92.724 Y101.283 E4.15708
+G1 X92.629 Y100.513 E4.19441
+G1 X92.612 Y99.873 E4.22519
+G1 X92.661 Y99.143 E4.26037
+G1 X92.772 Y98.465 E4.29340
+G1 X92.974 Y97.714 E4.33081
+G1 X93.198 Y97.115 E4.36155
+G1 X93.538 Y96.417 E4.39892
+G1 X93.923 Y95.798 E4.43396
+G1 X94.339 Y95.252 E4.46700
+G1 X94.868 Y94.685 E4.50431
+G1 X95.417 Y94.205 E4.53936
+G1 X95.975 Y93.804 E4.57243
+G1 X96.607 Y93.437 E4.60756
+G1 X97.231 Y93.150 E4.64059
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74610
+G1 X100.085 Y92.612 E4.78115
+G1 X100.771 Y92.652 E4.81418
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88233
+G1 X102.887 Y93.199 E4.91966
+G1 X103.582 Y93.538 E4.95686
+G1 X104.240 Y93.949 E4.99418
+G1 X104.747 Y94.338 E5.02493
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13045
+G1 X106.523 Y96.529 E5.16132
+G1 X106.851 Y97.233 E5.19869
+G1 X107.090 Y97.921 E5.23374
+G1 X107.253 Y98.589 E5.26677
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.539 E5.40957
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51484
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58291
+G1 X105.133 Y105.315 E5.62023
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71931
+G1 X102.767 Y106.851 E5.75667
+G1 X102.079 Y107.090 E5.79172
+G1 X101.411 Y107.253 E5.82475
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93010
+G1 X98.464 Y107.227 E5.96742
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03549
+G1 X96.418 Y106.462 E6.07282
+G1 X95.762 Y106.052 E6.11001
+G1 X95.151 Y105.575 E6.14734
+G1 X94.686 Y105.134 E6.17813
+G1 X94.205 Y104.583 E6.21330
+G1 X93.804 Y104.025 E6.24637
+G1 X93.437 Y103.393 E6.28150
+G1 X93.150 Y102.769 E6.31453
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34989
+G1 X92.343 Y101.350 E6.38903
+G1 X92.244 Y100.541 E6.42822
+G1 X92.226 Y99.865 E6.46076
+G1 X92.278 Y99.099 E6.49769
+G1 X92.395 Y98.384 E6.53253
+G1 X92.606 Y97.597 E6.57175
+G1 X92.843 Y96.963 E6.60428
+G1 X93.200 Y96.230 E6.64348
+G1 X93.605 Y95.579 E6.68036
+G1 X94.044 Y95.003 E6.71520
+G1 X94.599 Y94.407 E6.75438
+G1 X95.177 Y93.903 E6.79126
+G1 X95.765 Y93.480 E6.82611
+G1 X96.429 Y93.094 E6.86302
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00881
+G1 X100.089 Y92.226 E7.04569
+G1 X100.812 Y92.268 E7.08053
+G1 X101.617 Y92.395 E7.11974
+G1 X102.272 Y92.565 E7.15227
+G1 X103.038 Y92.843 E7.19146
+G1 X103.769 Y93.200 E7.23060
+G1 X104.460 Y93.632 E7.26979
+G1 X104.997 Y94.044 E7.30232
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38069
+G1 X106.520 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44584
+G1 X107.209 Y97.088 E7.48504
+G1 X107.460 Y97.812 E7.52192
+G1 X107.632 Y98.516 E7.55676
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.137 E7.63512
+G1 X107.732 Y100.812 E7.66765
+G1 X107.605 Y101.617 E7.70688
+G1 X107.435 Y102.272 E7.73941
+G1 X107.157 Y103.038 E7.77860
+G1 X106.800 Y103.769 E7.81774
+G1 X106.368 Y104.460 E7.85693
+G1 X105.956 Y104.997 E7.88945
+G1 X105.401 Y105.593 E7.92864
+G1 X104.786 Y106.127 E7.96783
+G1 X104.234 Y106.520 E8.00040
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07218
+G1 X102.188 Y107.460 E8.10906
+G1 X101.484 Y107.632 E8.14390
+G1 X100.678 Y107.745 E8.18307
+G1 X99.863 Y107.774 E8.22226
+G1 X99.188 Y107.732 E8.25479
+G1 X98.384 Y107.605 E8.29397
+G1 X97.597 Y107.394 E8.33316
+G1 X96.963 Y107.157 E8.36569
+G1 X96.231 Y106.800 E8.40488
+G1 X95.541 Y106.369 E8.44402
+G1 X94.899 Y105.867 E8.48321
+G1 X94.408 Y105.401 E8.51575
+G1 X93.903 Y104.823 E8.55268
+G1 X93.480 Y104.235 E8.58753
+G1 X93.094 Y103.571 E8.62444
+G1 X92.792 Y102.913 E8.65928
+G1 X92.603 Y102.366 E8.68708
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F4800
+G1 X98.306 Y106.486 E9.02902
+G1 X98.604 Y106.566 E9.04388
+G1 X99.304 Y106.677 E9.07794
+G1 X99.877 Y106.712 E9.10557
+G1 X100.585 Y106.687 E9.13963
+G1 X101.284 Y106.589 E9.17359
+G1 X101.888 Y106.442 E9.20346
+G1 X102.513 Y106.225 E9.23531
+G1 X103.157 Y105.925 E9.26946
+G1 X103.656 Y105.630 E9.29735
+G1 X104.129 Y105.293 E9.32525
+G1 X104.743 Y104.743 E9.36493
+G1 X95.257 Y95.257 E10.01016
+G1 X95.837 Y94.734 E10.04770
+G1 X96.342 Y94.371 E10.07765
+G1 X96.918 Y94.037 E10.10966
+G1 X97.482 Y93.777 E10.13953
+G1 X98.155 Y93.545 E10.17376
+G1 X98.714 Y93.411 E10.20139
+G1 X99.417 Y93.313 E10.23554
+G1 X100.078 Y93.288 E10.26738
+G1 X100.698 Y93.323 E10.29725
+G1 X101.401 Y93.435 E10.33149
+G1 X101.690 Y93.509 E10.34581
+G1 X106.726 Y98.546 E10.68840
+G1 X106.776 Y101.178 F7800.000
+G1 F4800
+G1 X94.719 Y104.409 E11.28878
+G1 X93.222 Y98.822 F7800.000
+G1 F4800
+G1 X105.280 Y95.591 E11.88917
+G1 X104.624 Y105.093 F7800.000
+G1 F4800
+G1 X106.467 Y98.214 E12.23168
+G1 X106.442 Y98.112 E12.23673
+G1 X106.225 Y97.487 E12.26857
+G1 X105.925 Y96.843 E12.30272
+G1 X105.630 Y96.344 E12.33062
+G1 X105.293 Y95.871 E12.35852
+G1 X104.829 Y95.337 E12.39258
+G1 X104.311 Y94.854 E12.42665
+G1 X103.855 Y94.504 E12.45428
+G1 X103.254 Y94.129 E12.48834
+G1 X102.623 Y93.821 E12.52214
+G1 X101.957 Y93.579 E12.55620
+G1 X101.736 Y93.521 E12.56720
+G1 X98.265 Y106.475 E13.21221
+G1 X97.920 Y106.383 E13.22938
+G1 X97.382 Y106.182 E13.25701
+G1 X96.746 Y105.871 E13.29107
+G1 X96.150 Y105.499 E13.32487
+G1 X95.592 Y105.063 E13.35893
+G1 X95.174 Y104.666 E13.38664
+G1 X94.734 Y104.163 E13.41876
+G1 X94.371 Y103.658 E13.44871
+G1 X94.037 Y103.082 E13.48072
+G1 X93.777 Y102.518 E13.51059
+G1 X93.533 Y101.787 E13.54764
+G1 X95.377 Y94.906 E13.89030
+G1 E11.89030 F2400.00000
+G92 E0
+G1 X147.701 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X160.100 Y100.996 E2.59635
+G1 X160.100 Y114.004 E3.22197
+G1 X147.701 Y114.004 E3.81832
+G1 X147.701 Y101.056 E4.44105
+G1 X147.315 Y100.611 F7800.000
+G1 F3600
+G1 X160.485 Y100.611 E5.07449
+G1 X160.485 Y114.389 E5.73720
+G1 X147.315 Y114.389 E6.37065
+G1 X147.315 Y100.671 E7.03047
+G1 X146.930 Y100.225 F7800.000
+G1 F1800
+G1 X160.871 Y100.225 E7.70101
+G1 X160.871 Y114.775 E8.40082
+G1 X146.930 Y114.775 E9.07135
+G1 X146.930 Y100.285 E9.76827
+G1 X147.315 Y100.331 F7800.000
+G1 X147.816 Y105.583
+G1 F4800
+G1 X158.411 Y102.744 E10.29582
+G1 X159.984 Y101.903 F7800.000
+G1 F1200
+G1 X159.366 Y101.285 E10.33848
+G1 X158.813 Y101.285 E10.36548
+G1 X159.811 Y102.283 E10.43436
+G1 X159.811 Y102.837 E10.46136
+G1 X158.623 Y101.649 E10.54331
+G1 X158.623 Y102.203 E10.57032
+G1 X159.811 Y103.390 E10.65226
+G1 X159.811 Y103.943 E10.67927
+G1 X158.623 Y102.756 E10.76121
+G1 X158.623 Y103.310 E10.78822
+G1 X159.811 Y104.497 E10.87017
+G1 X159.811 Y105.050 E10.89717
+G1 X158.623 Y103.863 E10.97912
+G1 X158.623 Y104.416 E11.00613
+G1 X159.811 Y105.604 E11.08807
+G1 X159.811 Y106.157 E11.11508
+G1 X158.623 Y104.970 E11.19702
+G1 X158.623 Y105.523 E11.22403
+G1 X159.811 Y106.710 E11.30598
+G1 X159.811 Y107.264 E11.33298
+G1 X158.623 Y106.076 E11.41493
+G1 X158.623 Y106.630 E11.44194
+G1 X159.811 Y107.817 E11.52388
+G1 X159.811 Y108.370 E11.55089
+G1 X158.623 Y107.183 E11.63283
+G1 X158.623 Y107.736 E11.65984
+G1 X159.811 Y108.924 E11.74179
+G1 X159.811 Y109.477 E11.76879
+G1 X158.623 Y108.290 E11.85074
+G1 X158.623 Y108.843 E11.87775
+G1 X159.811 Y110.030 E11.95969
+G1 X159.811 Y110.584 E11.98670
+G1 X158.623 Y109.397 E12.06864
+G1 X158.623 Y109.950 E12.09565
+G1 X159.811 Y111.137 E12.17760
+G1 X159.811 Y111.691 E12.20460
+G1 X158.623 Y110.503 E12.28655
+G1 X158.623 Y111.057 E12.31356
+G1 X159.811 Y112.244 E12.39550
+G1 X159.811 Y112.797 E12.42251
+G1 X158.623 Y111.610 E12.50446
+G1 X158.623 Y112.163 E12.53146
+G1 X159.811 Y113.351 E12.61341
+G1 X159.811 Y113.715 E12.63117
+G1 X159.621 Y113.715 E12.64041
+G1 X158.623 Y112.717 E12.70928
+G1 X158.623 Y113.270 E12.73629
+G1 X159.241 Y113.888 E12.77894
+G1 X156.113 Y113.888 F7800.000
+G1 F4800
+G1 X158.238 Y105.959 E13.17375
+G1 X158.238 Y101.285 E13.39853
+G1 X153.502 Y101.285 E13.62632
+G1 X150.125 Y113.888 E14.25385
+G1 X147.816 Y111.660 F7800.000
+G1 F4800
+G1 X149.871 Y113.715 E14.39358
+G1 X158.051 Y113.715 E14.78702
+G1 X147.990 Y103.654 E15.47136
+G1 X147.990 Y101.285 E15.58526
+G1 X153.802 Y101.285 E15.86480
+G1 X158.411 Y105.895 E16.17831
+G1 X158.411 Y108.732 F7800.000
+G1 F4800
+G1 X147.816 Y111.571 E16.70585
+M106 S252.45
+G1 Z10.250 F7800.000
+G1 E14.70585 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1139
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.878 E2.10639
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.543 E2.17109
+G1 X93.329 Y97.873 E2.20444
+G1 X93.553 Y97.266 E2.23553
+G1 X93.876 Y96.604 E2.27098
+G1 X94.242 Y96.015 E2.30433
+G1 X94.634 Y95.501 E2.33542
+G1 X95.137 Y94.962 E2.37087
+G1 X95.659 Y94.506 E2.40421
+G1 X96.185 Y94.128 E2.43537
+G1 X96.787 Y93.778 E2.46885
+G1 X97.374 Y93.508 E2.49994
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60002
+G1 X100.084 Y92.998 E2.63337
+G1 X100.729 Y93.036 E2.66447
+G1 X101.457 Y93.151 E2.69991
+G1 X102.127 Y93.329 E2.73326
+G1 X102.734 Y93.553 E2.76435
+G1 X103.396 Y93.876 E2.79980
+G1 X103.985 Y94.242 E2.83315
+G1 X104.499 Y94.634 E2.86424
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96426
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.378 E3.02896
+G1 X106.720 Y98.033 E3.06231
+G1 X106.873 Y98.661 E3.09340
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19321
+G1 X106.849 Y101.460 E3.22888
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32856
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42845
+G1 X104.308 Y105.521 E3.46391
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.622 Y106.493 E3.55778
+G1 X101.967 Y106.720 E3.59113
+G1 X101.339 Y106.873 E3.62223
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69307
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75750
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82193
+G1 X96.604 Y106.124 E3.85745
+G1 X96.015 Y105.758 E3.89080
+G1 X95.501 Y105.366 E3.92189
+G1 X94.960 Y104.861 E3.95748
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.814 E4.02191
+G1 X93.759 Y103.175 E4.05737
+G1 X93.509 Y102.627 E4.08634
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1139
+G1 X92.898 Y102.037 E4.11989
+G1 X92.724 Y101.283 E4.15708
+G1 X92.629 Y100.513 E4.19441
+G1 X92.612 Y99.871 E4.22528
+G1 X92.652 Y99.230 E4.25616
+G1 X92.773 Y98.463 E4.29352
+G1 X92.961 Y97.756 E4.32870
+G1 X93.198 Y97.115 E4.36160
+G1 X93.538 Y96.417 E4.39891
+G1 X93.924 Y95.796 E4.43409
+G1 X94.339 Y95.252 E4.46699
+G1 X94.868 Y94.685 E4.50431
+G1 X95.419 Y94.203 E4.53949
+G1 X95.975 Y93.804 E4.57243
+G1 X96.609 Y93.436 E4.60769
+G1 X97.231 Y93.150 E4.64059
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74610
+G1 X100.088 Y92.612 E4.78128
+G1 X100.771 Y92.652 E4.81418
+G1 X101.537 Y92.773 E4.85150
+G1 X102.244 Y92.961 E4.88668
+G1 X102.885 Y93.198 E4.91958
+G1 X103.583 Y93.538 E4.95689
+G1 X104.204 Y93.924 E4.99207
+G1 X104.748 Y94.339 E5.02497
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09957
+G1 X106.197 Y95.976 E5.13045
+G1 X106.523 Y96.529 E5.16132
+G1 X106.851 Y97.233 E5.19869
+G1 X107.091 Y97.924 E5.23387
+G1 X107.253 Y98.589 E5.26677
+G1 X107.360 Y99.356 E5.30404
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37211
+G1 X107.227 Y101.539 E5.40957
+G1 X107.067 Y102.158 E5.44031
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51484
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58291
+G1 X105.133 Y105.315 E5.62023
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71930
+G1 X102.767 Y106.851 E5.75667
+G1 X102.076 Y107.091 E5.79185
+G1 X101.411 Y107.253 E5.82475
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93010
+G1 X98.464 Y107.227 E5.96742
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03549
+G1 X96.417 Y106.462 E6.07285
+G1 X95.796 Y106.076 E6.10803
+G1 X95.252 Y105.661 E6.14093
+G1 X94.683 Y105.131 E6.17834
+G1 X94.260 Y104.652 E6.20909
+G1 X93.803 Y104.024 E6.24641
+G1 X93.415 Y103.352 E6.28374
+G1 X93.150 Y102.770 E6.31448
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1139
+G1 X92.526 Y102.143 E6.34989
+G1 X92.343 Y101.350 E6.38903
+G1 X92.244 Y100.541 E6.42822
+G1 X92.226 Y99.864 E6.46080
+G1 X92.268 Y99.188 E6.49337
+G1 X92.395 Y98.383 E6.53257
+G1 X92.593 Y97.639 E6.56959
+G1 X92.843 Y96.963 E6.60429
+G1 X93.200 Y96.231 E6.64348
+G1 X93.606 Y95.577 E6.68049
+G1 X94.044 Y95.003 E6.71519
+G1 X94.599 Y94.407 E6.75438
+G1 X95.179 Y93.901 E6.79139
+G1 X95.765 Y93.480 E6.82611
+G1 X96.431 Y93.093 E6.86315
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00881
+G1 X100.092 Y92.226 E7.04582
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11971
+G1 X102.361 Y92.593 E7.15672
+G1 X103.037 Y92.843 E7.19143
+G1 X103.769 Y93.200 E7.23061
+G1 X104.423 Y93.606 E7.26763
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38069
+G1 X106.520 Y95.766 E7.41326
+G1 X106.864 Y96.349 E7.44584
+G1 X107.209 Y97.088 E7.48504
+G1 X107.461 Y97.815 E7.52205
+G1 X107.632 Y98.516 E7.55676
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.137 E7.63512
+G1 X107.732 Y100.812 E7.66764
+G1 X107.605 Y101.617 E7.70688
+G1 X107.435 Y102.272 E7.73941
+G1 X107.157 Y103.038 E7.77860
+G1 X106.800 Y103.769 E7.81774
+G1 X106.368 Y104.460 E7.85692
+G1 X105.956 Y104.997 E7.88945
+G1 X105.401 Y105.593 E7.92864
+G1 X104.786 Y106.127 E7.96783
+G1 X104.234 Y106.520 E8.00040
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07218
+G1 X102.185 Y107.461 E8.10919
+G1 X101.484 Y107.632 E8.14390
+G1 X100.678 Y107.745 E8.18307
+G1 X99.863 Y107.774 E8.22226
+G1 X99.188 Y107.732 E8.25478
+G1 X98.384 Y107.605 E8.29397
+G1 X97.597 Y107.394 E8.33316
+G1 X96.963 Y107.157 E8.36569
+G1 X96.231 Y106.800 E8.40489
+G1 X95.577 Y106.394 E8.44190
+G1 X95.003 Y105.956 E8.47661
+G1 X94.407 Y105.400 E8.51582
+G1 X93.959 Y104.894 E8.54835
+G1 X93.480 Y104.234 E8.58754
+G1 X93.072 Y103.529 E8.62673
+G1 X92.792 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68708
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F1139
+G1 X98.306 Y106.486 E9.02902
+G1 X98.604 Y106.566 E9.04387
+G1 X99.304 Y106.677 E9.07794
+G1 X99.877 Y106.712 E9.10557
+G1 X100.585 Y106.687 E9.13963
+G1 X101.284 Y106.589 E9.17360
+G1 X101.885 Y106.443 E9.20334
+G1 X102.513 Y106.225 E9.23531
+G1 X103.157 Y105.925 E9.26945
+G1 X103.656 Y105.630 E9.29735
+G1 X104.129 Y105.293 E9.32525
+G1 X104.743 Y104.743 E9.36493
+G1 X95.257 Y95.257 E10.01016
+G1 X95.839 Y94.733 E10.04782
+G1 X96.342 Y94.371 E10.07764
+G1 X96.920 Y94.035 E10.10979
+G1 X97.482 Y93.777 E10.13953
+G1 X98.155 Y93.545 E10.17376
+G1 X98.714 Y93.411 E10.20139
+G1 X99.417 Y93.313 E10.23553
+G1 X100.081 Y93.288 E10.26751
+G1 X100.698 Y93.323 E10.29725
+G1 X101.397 Y93.434 E10.33129
+G1 X101.693 Y93.513 E10.34599
+G1 X106.726 Y98.546 E10.68837
+G1 X106.776 Y101.178 F7800.000
+G1 F1139
+G1 X94.715 Y104.410 E11.28893
+G1 X93.224 Y98.822 F7800.000
+G1 F1139
+G1 X105.280 Y95.591 E11.88923
+G1 X104.624 Y105.093 F7800.000
+G1 F1139
+G1 X106.467 Y98.214 E12.23175
+G1 X106.443 Y98.115 E12.23667
+G1 X106.225 Y97.487 E12.26864
+G1 X105.925 Y96.843 E12.30278
+G1 X105.630 Y96.344 E12.33068
+G1 X105.293 Y95.871 E12.35858
+G1 X104.829 Y95.337 E12.39265
+G1 X104.312 Y94.855 E12.42661
+G1 X103.821 Y94.480 E12.45635
+G1 X103.256 Y94.130 E12.48833
+G1 X102.620 Y93.819 E12.52237
+G1 X102.040 Y93.605 E12.55211
+G1 X101.735 Y93.524 E12.56726
+G1 X98.265 Y106.475 E13.21215
+G1 X97.920 Y106.383 E13.22932
+G1 X97.382 Y106.182 E13.25695
+G1 X96.744 Y105.870 E13.29109
+G1 X96.179 Y105.520 E13.32307
+G1 X95.688 Y105.145 E13.35281
+G1 X95.167 Y104.659 E13.38704
+G1 X94.786 Y104.229 E13.41467
+G1 X94.370 Y103.656 E13.44873
+G1 X94.016 Y103.043 E13.48280
+G1 X93.778 Y102.520 E13.51043
+G1 X93.533 Y101.787 E13.54758
+G1 X95.377 Y94.906 E13.89024
+G1 E11.89024 F2400.00000
+G92 E0
+G1 X147.906 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1139
+G1 X159.661 Y100.996 E2.56539
+G1 X159.661 Y114.004 E3.19101
+G1 X147.906 Y114.004 E3.75639
+G1 X147.906 Y101.056 E4.37912
+G1 X147.520 Y100.611 F7800.000
+G1 F1139
+G1 X160.047 Y100.611 E4.98161
+G1 X160.047 Y114.389 E5.64432
+G1 X147.520 Y114.389 E6.24680
+G1 X147.520 Y100.671 E6.90662
+G1 X147.135 Y100.225 F7800.000
+G1 F1139
+G1 X160.433 Y100.225 E7.54620
+G1 X160.433 Y114.775 E8.24601
+G1 X147.135 Y114.775 E8.88558
+G1 X147.135 Y100.285 E9.58250
+G1 X147.520 Y100.334 F7800.000
+G1 X148.022 Y105.528
+G1 F1139
+G1 X157.973 Y102.862 E10.07799
+G1 X158.011 Y101.903 F7800.000
+G1 F1139
+G1 X158.629 Y101.285 E10.12064
+G1 X159.183 Y101.285 E10.14765
+G1 X158.185 Y102.283 E10.21651
+G1 X158.185 Y102.837 E10.24352
+G1 X159.372 Y101.649 E10.32547
+G1 X159.372 Y102.203 E10.35247
+G1 X158.185 Y103.390 E10.43442
+G1 X158.185 Y103.943 E10.46143
+G1 X159.372 Y102.756 E10.54337
+G1 X159.372 Y103.309 E10.57038
+G1 X158.185 Y104.497 E10.65232
+G1 X158.185 Y105.050 E10.67933
+G1 X159.372 Y103.863 E10.76128
+G1 X159.372 Y104.416 E10.78828
+G1 X158.185 Y105.603 E10.87023
+G1 X158.185 Y106.157 E10.89724
+G1 X159.372 Y104.970 E10.97918
+G1 X159.372 Y105.523 E11.00619
+G1 X158.185 Y106.710 E11.08813
+G1 X158.185 Y107.264 E11.11514
+G1 X159.372 Y106.076 E11.19709
+G1 X159.372 Y106.630 E11.22409
+G1 X158.185 Y107.817 E11.30604
+G1 X158.185 Y108.370 E11.33305
+G1 X159.372 Y107.183 E11.41499
+G1 X159.372 Y107.736 E11.44200
+G1 X158.185 Y108.924 E11.52394
+G1 X158.185 Y109.477 E11.55095
+G1 X159.372 Y108.290 E11.63290
+G1 X159.372 Y108.843 E11.65990
+G1 X158.185 Y110.030 E11.74185
+G1 X158.185 Y110.584 E11.76886
+G1 X159.372 Y109.396 E11.85080
+G1 X159.372 Y109.950 E11.87781
+G1 X158.185 Y111.137 E11.95975
+G1 X158.185 Y111.690 E11.98676
+G1 X159.372 Y110.503 E12.06871
+G1 X159.372 Y111.057 E12.09571
+G1 X158.185 Y112.244 E12.17766
+G1 X158.185 Y112.797 E12.20467
+G1 X159.372 Y111.610 E12.28661
+G1 X159.372 Y112.163 E12.31362
+G1 X158.185 Y113.351 E12.39556
+G1 X158.185 Y113.715 E12.41333
+G1 X158.374 Y113.715 E12.42257
+G1 X159.372 Y112.717 E12.49144
+G1 X159.372 Y113.270 E12.51845
+G1 X158.754 Y113.888 E12.56111
+G1 X156.113 Y113.888 F7800.000
+G1 F1139
+G1 X157.799 Y107.596 E12.87443
+G1 X157.799 Y101.285 E13.17793
+G1 X153.502 Y101.285 E13.38462
+G1 X150.125 Y113.888 E14.01215
+G1 X148.022 Y111.865 F7800.000
+G1 F1139
+G1 X149.871 Y113.715 E14.13792
+G1 X157.799 Y113.715 E14.51925
+G1 X157.799 Y113.463 E14.53136
+G1 X148.195 Y103.859 E15.18461
+G1 X148.195 Y101.285 E15.30838
+G1 X153.802 Y101.285 E15.57805
+G1 X157.973 Y105.456 E15.86173
+G1 X157.973 Y108.850 F7800.000
+G1 F1139
+G1 X148.022 Y111.516 E16.35723
+G1 Z10.550 F7800.000
+G1 E14.35723 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1123
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.878 E2.10639
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.543 E2.17109
+G1 X93.329 Y97.870 E2.20456
+G1 X93.553 Y97.267 E2.23553
+G1 X93.876 Y96.604 E2.27097
+G1 X94.244 Y96.013 E2.30445
+G1 X94.634 Y95.501 E2.33542
+G1 X95.137 Y94.962 E2.37086
+G1 X95.661 Y94.504 E2.40434
+G1 X96.185 Y94.128 E2.43536
+G1 X96.789 Y93.777 E2.46897
+G1 X97.374 Y93.508 E2.49994
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60002
+G1 X100.086 Y92.998 E2.63350
+G1 X100.729 Y93.036 E2.66446
+G1 X101.457 Y93.151 E2.69991
+G1 X102.130 Y93.329 E2.73339
+G1 X102.733 Y93.553 E2.76435
+G1 X103.396 Y93.876 E2.79980
+G1 X103.987 Y94.244 E2.83327
+G1 X104.499 Y94.634 E2.86424
+G1 X105.038 Y95.137 E2.89968
+G1 X105.496 Y95.661 E2.93316
+G1 X105.874 Y96.187 E2.96434
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.378 E3.02895
+G1 X106.721 Y98.036 E3.06243
+G1 X106.873 Y98.661 E3.09340
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19321
+G1 X106.849 Y101.457 E3.22873
+G1 X106.671 Y102.130 E3.26221
+G1 X106.447 Y102.733 E3.29317
+G1 X106.124 Y103.395 E3.32856
+G1 X105.734 Y104.020 E3.36402
+G1 X105.367 Y104.498 E3.39299
+G1 X104.863 Y105.038 E3.42851
+G1 X104.339 Y105.496 E3.46198
+G1 X103.813 Y105.874 E3.49316
+G1 X103.291 Y106.181 E3.52226
+G1 X102.622 Y106.493 E3.55778
+G1 X101.964 Y106.721 E3.59126
+G1 X101.339 Y106.873 E3.62222
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69307
+G1 X99.272 Y106.965 E3.72204
+G1 X98.543 Y106.849 E3.75755
+G1 X97.870 Y106.671 E3.79103
+G1 X97.267 Y106.447 E3.82200
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92810
+G1 X94.963 Y104.865 E3.95727
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.813 E4.02197
+G1 X93.777 Y103.211 E4.05544
+G1 X93.508 Y102.626 E4.08641
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1123
+G1 X92.898 Y102.037 E4.11988
+G1 X92.724 Y101.283 E4.15708
+G1 X92.629 Y100.513 E4.19441
+G1 X92.612 Y99.871 E4.22528
+G1 X92.652 Y99.230 E4.25615
+G1 X92.773 Y98.463 E4.29351
+G1 X92.961 Y97.754 E4.32883
+G1 X93.198 Y97.115 E4.36159
+G1 X93.538 Y96.417 E4.39891
+G1 X93.926 Y95.794 E4.43422
+G1 X94.339 Y95.252 E4.46699
+G1 X94.868 Y94.685 E4.50430
+G1 X95.421 Y94.202 E4.53962
+G1 X95.975 Y93.804 E4.57242
+G1 X96.611 Y93.434 E4.60781
+G1 X97.231 Y93.150 E4.64058
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74610
+G1 X100.090 Y92.612 E4.78141
+G1 X100.771 Y92.652 E4.81418
+G1 X101.537 Y92.773 E4.85149
+G1 X102.246 Y92.961 E4.88680
+G1 X102.885 Y93.198 E4.91957
+G1 X103.583 Y93.538 E4.95689
+G1 X104.206 Y93.926 E4.99220
+G1 X104.748 Y94.339 E5.02497
+G1 X105.315 Y94.868 E5.06228
+G1 X105.798 Y95.421 E5.09759
+G1 X106.197 Y95.977 E5.13049
+G1 X106.523 Y96.529 E5.16132
+G1 X106.851 Y97.233 E5.19868
+G1 X107.092 Y97.926 E5.23399
+G1 X107.253 Y98.588 E5.26676
+G1 X107.360 Y99.356 E5.30404
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37211
+G1 X107.227 Y101.537 E5.40947
+G1 X107.039 Y102.246 E5.44478
+G1 X106.802 Y102.885 E5.47755
+G1 X106.462 Y103.582 E5.51483
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58290
+G1 X105.132 Y105.315 E5.62026
+G1 X104.579 Y105.798 E5.65558
+G1 X104.023 Y106.197 E5.68847
+G1 X103.471 Y106.523 E5.71930
+G1 X102.767 Y106.851 E5.75666
+G1 X102.074 Y107.092 E5.79197
+G1 X101.412 Y107.253 E5.82474
+G1 X100.644 Y107.360 E5.86202
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93009
+G1 X98.463 Y107.227 E5.96745
+G1 X97.754 Y107.039 E6.00276
+G1 X97.115 Y106.802 E6.03553
+G1 X96.418 Y106.462 E6.07281
+G1 X95.762 Y106.052 E6.11001
+G1 X95.151 Y105.575 E6.14733
+G1 X94.685 Y105.133 E6.17821
+G1 X94.260 Y104.652 E6.20908
+G1 X93.803 Y104.024 E6.24644
+G1 X93.434 Y103.389 E6.28175
+G1 X93.150 Y102.769 E6.31452
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1123
+G1 X92.526 Y102.143 E6.34989
+G1 X92.343 Y101.350 E6.38903
+G1 X92.244 Y100.541 E6.42822
+G1 X92.226 Y99.864 E6.46079
+G1 X92.268 Y99.188 E6.49337
+G1 X92.395 Y98.383 E6.53257
+G1 X92.593 Y97.637 E6.56972
+G1 X92.843 Y96.963 E6.60429
+G1 X93.200 Y96.231 E6.64347
+G1 X93.608 Y95.575 E6.68062
+G1 X94.044 Y95.003 E6.71519
+G1 X94.599 Y94.407 E6.75437
+G1 X95.181 Y93.899 E6.79152
+G1 X95.765 Y93.480 E6.82610
+G1 X96.434 Y93.092 E6.86328
+G1 X97.087 Y92.792 E6.89785
+G1 X97.858 Y92.526 E6.93707
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00880
+G1 X100.094 Y92.226 E7.04595
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11970
+G1 X102.363 Y92.593 E7.15685
+G1 X103.037 Y92.843 E7.19142
+G1 X103.769 Y93.200 E7.23061
+G1 X104.425 Y93.608 E7.26775
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34151
+G1 X106.101 Y95.181 E7.37866
+G1 X106.521 Y95.766 E7.41328
+G1 X106.864 Y96.349 E7.44583
+G1 X107.209 Y97.088 E7.48503
+G1 X107.462 Y97.817 E7.52218
+G1 X107.632 Y98.516 E7.55675
+G1 X107.745 Y99.322 E7.59592
+G1 X107.774 Y100.137 E7.63511
+G1 X107.732 Y100.812 E7.66764
+G1 X107.605 Y101.617 E7.70684
+G1 X107.407 Y102.363 E7.74399
+G1 X107.157 Y103.037 E7.77856
+G1 X106.800 Y103.769 E7.81773
+G1 X106.368 Y104.460 E7.85692
+G1 X105.956 Y104.997 E7.88945
+G1 X105.401 Y105.593 E7.92865
+G1 X104.819 Y106.101 E7.96579
+G1 X104.234 Y106.521 E8.00041
+G1 X103.651 Y106.864 E8.03297
+G1 X102.912 Y107.209 E8.07217
+G1 X102.183 Y107.462 E8.10932
+G1 X101.484 Y107.632 E8.14389
+G1 X100.678 Y107.745 E8.18306
+G1 X99.863 Y107.774 E8.22225
+G1 X99.188 Y107.732 E8.25478
+G1 X98.383 Y107.605 E8.29398
+G1 X97.637 Y107.407 E8.33113
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40487
+G1 X95.541 Y106.369 E8.44401
+G1 X94.899 Y105.867 E8.48320
+G1 X94.407 Y105.401 E8.51577
+G1 X93.959 Y104.894 E8.54835
+G1 X93.479 Y104.234 E8.58755
+G1 X93.092 Y103.566 E8.62469
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68707
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F1123
+G1 X98.307 Y106.487 E9.02909
+G1 X98.603 Y106.566 E9.04381
+G1 X99.304 Y106.677 E9.07794
+G1 X99.877 Y106.712 E9.10557
+G1 X100.585 Y106.687 E9.13964
+G1 X101.284 Y106.589 E9.17361
+G1 X101.883 Y106.443 E9.20322
+G1 X102.513 Y106.225 E9.23532
+G1 X103.157 Y105.925 E9.26946
+G1 X103.655 Y105.631 E9.29726
+G1 X104.159 Y105.269 E9.32715
+G1 X104.743 Y104.743 E9.36493
+G1 X95.257 Y95.257 E10.01017
+G1 X95.841 Y94.731 E10.04795
+G1 X96.342 Y94.371 E10.07764
+G1 X96.922 Y94.034 E10.10992
+G1 X97.482 Y93.777 E10.13953
+G1 X98.155 Y93.545 E10.17377
+G1 X98.714 Y93.411 E10.20140
+G1 X99.416 Y93.313 E10.23554
+G1 X100.083 Y93.288 E10.26764
+G1 X100.698 Y93.323 E10.29725
+G1 X101.397 Y93.434 E10.33129
+G1 X101.693 Y93.513 E10.34601
+G1 X106.726 Y98.546 E10.68838
+G1 X106.776 Y101.178 F7800.000
+G1 F1123
+G1 X94.715 Y104.410 E11.28894
+G1 X93.224 Y98.822 F7800.000
+G1 F1123
+G1 X105.281 Y95.591 E11.88931
+G1 X104.623 Y105.094 F7800.000
+G1 F1123
+G1 X106.467 Y98.214 E12.23190
+G1 X106.443 Y98.117 E12.23668
+G1 X106.225 Y97.487 E12.26878
+G1 X105.925 Y96.843 E12.30292
+G1 X105.631 Y96.345 E12.33072
+G1 X105.269 Y95.841 E12.36061
+G1 X104.830 Y95.338 E12.39271
+G1 X104.312 Y94.855 E12.42675
+G1 X103.823 Y94.482 E12.45636
+G1 X103.256 Y94.130 E12.48847
+G1 X102.620 Y93.819 E12.52251
+G1 X102.042 Y93.605 E12.55212
+G1 X101.735 Y93.524 E12.56740
+G1 X98.265 Y106.476 E13.21233
+G1 X97.958 Y106.395 E13.22761
+G1 X97.380 Y106.181 E13.25722
+G1 X96.746 Y105.871 E13.29119
+G1 X96.150 Y105.499 E13.32499
+G1 X95.592 Y105.063 E13.35905
+G1 X95.171 Y104.663 E13.38695
+G1 X94.786 Y104.229 E13.41485
+G1 X94.369 Y103.655 E13.44899
+G1 X94.034 Y103.078 E13.48109
+G1 X93.777 Y102.518 E13.51070
+G1 X93.533 Y101.787 E13.54776
+G1 X95.377 Y94.906 E13.89041
+G1 E11.89041 F2400.00000
+G92 E0
+G1 X148.111 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1123
+G1 X159.223 Y100.996 E2.53443
+G1 X159.223 Y114.004 E3.16004
+G1 X148.111 Y114.004 E3.69447
+G1 X148.111 Y101.056 E4.31720
+G1 X147.726 Y100.611 F7800.000
+G1 F1123
+G1 X159.608 Y100.611 E4.88872
+G1 X159.608 Y114.389 E5.55143
+G1 X147.726 Y114.389 E6.12295
+G1 X147.726 Y100.671 E6.78278
+G1 X147.340 Y100.225 F7800.000
+G1 F1123
+G1 X159.994 Y100.225 E7.39139
+G1 X159.994 Y114.775 E8.09119
+G1 X147.340 Y114.775 E8.69981
+G1 X147.340 Y100.285 E9.39673
+G1 X147.724 Y100.337 F7800.000
+G1 X148.227 Y105.473
+G1 F1123
+G1 X157.534 Y102.979 E9.86017
+G1 X159.107 Y101.903 F7800.000
+G1 F1123
+G1 X158.489 Y101.285 E9.90282
+G1 X157.936 Y101.285 E9.92983
+G1 X158.934 Y102.283 E9.99870
+G1 X158.934 Y102.837 E10.02571
+G1 X157.746 Y101.649 E10.10765
+G1 X157.746 Y102.203 E10.13466
+G1 X158.934 Y103.390 E10.21661
+G1 X158.934 Y103.943 E10.24361
+G1 X157.746 Y102.756 E10.32556
+G1 X157.746 Y103.310 E10.35257
+G1 X158.934 Y104.497 E10.43451
+G1 X158.934 Y105.050 E10.46152
+G1 X157.746 Y103.863 E10.54346
+G1 X157.746 Y104.416 E10.57047
+G1 X158.934 Y105.604 E10.65242
+G1 X158.934 Y106.157 E10.67942
+G1 X157.746 Y104.970 E10.76137
+G1 X157.746 Y105.523 E10.78838
+G1 X158.934 Y106.710 E10.87032
+G1 X158.934 Y107.264 E10.89733
+G1 X157.746 Y106.076 E10.97927
+G1 X157.746 Y106.630 E11.00628
+G1 X158.934 Y107.817 E11.08823
+G1 X158.934 Y108.370 E11.11523
+G1 X157.746 Y107.183 E11.19718
+G1 X157.746 Y107.736 E11.22419
+G1 X158.934 Y108.924 E11.30613
+G1 X158.934 Y109.477 E11.33314
+G1 X157.746 Y108.290 E11.41508
+G1 X157.746 Y108.843 E11.44209
+G1 X158.934 Y110.030 E11.52404
+G1 X158.934 Y110.584 E11.55104
+G1 X157.746 Y109.397 E11.63299
+G1 X157.746 Y109.950 E11.66000
+G1 X158.934 Y111.137 E11.74194
+G1 X158.934 Y111.691 E11.76895
+G1 X157.746 Y110.503 E11.85089
+G1 X157.746 Y111.057 E11.87790
+G1 X158.934 Y112.244 E11.95985
+G1 X158.934 Y112.797 E11.98685
+G1 X157.746 Y111.610 E12.06880
+G1 X157.746 Y112.163 E12.09581
+G1 X158.934 Y113.351 E12.17775
+G1 X158.934 Y113.715 E12.19551
+G1 X158.744 Y113.715 E12.20476
+G1 X157.746 Y112.717 E12.27362
+G1 X157.746 Y113.270 E12.30063
+G1 X158.364 Y113.888 E12.34328
+G1 X156.113 Y113.888 F7800.000
+G1 F1123
+G1 X157.361 Y109.232 E12.57511
+G1 X157.361 Y101.285 E12.95732
+G1 X153.502 Y101.285 E13.14293
+G1 X150.125 Y113.888 E13.77046
+G1 X148.227 Y112.071 F7800.000
+G1 F1123
+G1 X149.871 Y113.715 E13.88227
+G1 X157.361 Y113.715 E14.24251
+G1 X157.361 Y113.024 E14.27571
+G1 X148.400 Y104.064 E14.88517
+G1 X148.400 Y101.285 E15.01881
+G1 X153.802 Y101.285 E15.27861
+G1 X157.534 Y105.018 E15.53246
+G1 X157.534 Y108.967 F7800.000
+G1 F1123
+G1 X148.227 Y111.461 E15.99590
+G1 Z10.850 F7800.000
+G1 E13.99590 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1108
+G1 X93.110 Y101.249 E2.04017
+G1 X93.024 Y100.613 E2.07100
+G1 X92.999 Y99.873 E2.10660
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.543 E2.17108
+G1 X93.330 Y97.868 E2.20469
+G1 X93.553 Y97.267 E2.23552
+G1 X93.876 Y96.604 E2.27097
+G1 X94.245 Y96.011 E2.30458
+G1 X94.634 Y95.501 E2.33541
+G1 X95.136 Y94.962 E2.37086
+G1 X95.663 Y94.503 E2.40447
+G1 X96.185 Y94.128 E2.43535
+G1 X96.791 Y93.776 E2.46910
+G1 X97.374 Y93.508 E2.49994
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60002
+G1 X100.089 Y92.998 E2.63362
+G1 X100.729 Y93.036 E2.66446
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.396 Y93.876 E2.79979
+G1 X103.989 Y94.245 E2.83340
+G1 X104.499 Y94.634 E2.86423
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96426
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19321
+G1 X106.849 Y101.460 E3.22889
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32857
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42845
+G1 X104.308 Y105.521 E3.46392
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.622 Y106.493 E3.55778
+G1 X101.962 Y106.722 E3.59138
+G1 X101.339 Y106.873 E3.62222
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69308
+G1 X99.272 Y106.965 E3.72204
+G1 X98.543 Y106.849 E3.75755
+G1 X97.868 Y106.670 E3.79116
+G1 X97.267 Y106.447 E3.82199
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92810
+G1 X94.965 Y104.867 E3.95712
+G1 X94.503 Y104.337 E3.99094
+G1 X94.129 Y103.816 E4.02177
+G1 X93.759 Y103.175 E4.05737
+G1 X93.509 Y102.627 E4.08634
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1108
+G1 X92.897 Y102.036 E4.11992
+G1 X92.730 Y101.318 E4.15536
+G1 X92.640 Y100.646 E4.18800
+G1 X92.612 Y99.868 E4.22541
+G1 X92.652 Y99.230 E4.25616
+G1 X92.773 Y98.463 E4.29351
+G1 X92.962 Y97.751 E4.32896
+G1 X93.198 Y97.115 E4.36159
+G1 X93.538 Y96.417 E4.39891
+G1 X93.927 Y95.792 E4.43435
+G1 X94.339 Y95.252 E4.46699
+G1 X94.868 Y94.685 E4.50430
+G1 X95.423 Y94.200 E4.53975
+G1 X95.975 Y93.804 E4.57242
+G1 X96.614 Y93.433 E4.60795
+G1 X97.230 Y93.150 E4.64058
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74610
+G1 X100.093 Y92.612 E4.78154
+G1 X100.771 Y92.652 E4.81418
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88234
+G1 X102.887 Y93.199 E4.91966
+G1 X103.583 Y93.538 E4.95689
+G1 X104.208 Y93.927 E4.99233
+G1 X104.748 Y94.339 E5.02497
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13045
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.232 E5.19865
+G1 X107.103 Y97.966 E5.23598
+G1 X107.252 Y98.588 E5.26672
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.539 E5.40957
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51484
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58291
+G1 X105.133 Y105.315 E5.62023
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71931
+G1 X102.767 Y106.851 E5.75666
+G1 X102.071 Y107.092 E5.79211
+G1 X101.412 Y107.253 E5.82474
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93010
+G1 X98.463 Y107.227 E5.96746
+G1 X97.751 Y107.038 E6.00290
+G1 X97.115 Y106.802 E6.03554
+G1 X96.418 Y106.462 E6.07282
+G1 X95.762 Y106.052 E6.11002
+G1 X95.151 Y105.575 E6.14734
+G1 X94.686 Y105.134 E6.17812
+G1 X94.200 Y104.577 E6.21369
+G1 X93.804 Y104.026 E6.24633
+G1 X93.415 Y103.352 E6.28374
+G1 X93.150 Y102.770 E6.31448
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F1108
+G1 X92.526 Y102.143 E6.34991
+G1 X92.350 Y101.388 E6.38719
+G1 X92.255 Y100.678 E6.42163
+G1 X92.226 Y99.863 E6.46085
+G1 X92.268 Y99.188 E6.49337
+G1 X92.395 Y98.383 E6.53257
+G1 X92.594 Y97.634 E6.56985
+G1 X92.843 Y96.963 E6.60429
+G1 X93.200 Y96.231 E6.64348
+G1 X93.610 Y95.572 E6.68076
+G1 X94.044 Y95.003 E6.71519
+G1 X94.599 Y94.407 E6.75438
+G1 X95.183 Y93.897 E6.79166
+G1 X95.765 Y93.480 E6.82611
+G1 X96.436 Y93.090 E6.86342
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00881
+G1 X100.097 Y92.226 E7.04609
+G1 X100.812 Y92.268 E7.08053
+G1 X101.617 Y92.395 E7.11975
+G1 X102.272 Y92.565 E7.15227
+G1 X103.038 Y92.843 E7.19146
+G1 X103.769 Y93.200 E7.23061
+G1 X104.428 Y93.610 E7.26789
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38069
+G1 X106.520 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44584
+G1 X107.209 Y97.088 E7.48503
+G1 X107.474 Y97.858 E7.52422
+G1 X107.632 Y98.516 E7.55674
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.137 E7.63512
+G1 X107.732 Y100.812 E7.66765
+G1 X107.605 Y101.617 E7.70688
+G1 X107.435 Y102.272 E7.73941
+G1 X107.157 Y103.038 E7.77860
+G1 X106.800 Y103.769 E7.81774
+G1 X106.368 Y104.460 E7.85693
+G1 X105.956 Y104.997 E7.88945
+G1 X105.401 Y105.593 E7.92864
+G1 X104.786 Y106.127 E7.96783
+G1 X104.234 Y106.520 E8.00041
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07218
+G1 X102.180 Y107.463 E8.10946
+G1 X101.484 Y107.632 E8.14390
+G1 X100.678 Y107.745 E8.18307
+G1 X99.863 Y107.774 E8.22226
+G1 X99.188 Y107.732 E8.25479
+G1 X98.383 Y107.605 E8.29399
+G1 X97.634 Y107.406 E8.33127
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40488
+G1 X95.541 Y106.369 E8.44402
+G1 X94.899 Y105.867 E8.48321
+G1 X94.408 Y105.401 E8.51575
+G1 X93.897 Y104.817 E8.55307
+G1 X93.480 Y104.235 E8.58751
+G1 X93.072 Y103.529 E8.62673
+G1 X92.792 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68708
+G1 X92.698 Y102.175 F7800.000
+G1 X93.277 Y101.458
+G1 F1108
+G1 X98.307 Y106.487 E9.02920
+G1 X98.603 Y106.566 E9.04392
+G1 X99.304 Y106.677 E9.07805
+G1 X99.877 Y106.712 E9.10568
+G1 X100.585 Y106.687 E9.13975
+G1 X101.285 Y106.589 E9.17372
+G1 X101.880 Y106.444 E9.20321
+G1 X102.513 Y106.225 E9.23544
+G1 X103.157 Y105.925 E9.26957
+G1 X103.656 Y105.630 E9.29747
+G1 X104.129 Y105.293 E9.32537
+G1 X104.743 Y104.743 E9.36504
+G1 X95.257 Y95.257 E10.01028
+G1 X95.843 Y94.729 E10.04819
+G1 X96.342 Y94.371 E10.07774
+G1 X96.925 Y94.033 E10.11015
+G1 X97.482 Y93.777 E10.13963
+G1 X98.155 Y93.545 E10.17388
+G1 X98.714 Y93.411 E10.20151
+G1 X99.416 Y93.313 E10.23564
+G1 X100.086 Y93.288 E10.26787
+G1 X100.698 Y93.323 E10.29735
+G1 X101.401 Y93.435 E10.33160
+G1 X101.690 Y93.509 E10.34592
+G1 X106.727 Y98.547 E10.68857
+G1 X106.776 Y101.178 F7800.000
+G1 F1108
+G1 X94.719 Y104.409 E11.28894
+G1 X93.224 Y98.822 F7800.000
+G1 F1108
+G1 X105.280 Y95.591 E11.88924
+G1 X104.624 Y105.093 F7800.000
+G1 F1108
+G1 X106.468 Y98.210 E12.23195
+G1 X106.455 Y98.155 E12.23469
+G1 X106.224 Y97.485 E12.26875
+G1 X105.925 Y96.843 E12.30282
+G1 X105.630 Y96.344 E12.33072
+G1 X105.293 Y95.871 E12.35861
+G1 X104.829 Y95.337 E12.39268
+G1 X104.312 Y94.855 E12.42666
+G1 X103.825 Y94.483 E12.45614
+G1 X103.256 Y94.129 E12.48837
+G1 X102.623 Y93.821 E12.52223
+G1 X101.957 Y93.579 E12.55630
+G1 X101.736 Y93.521 E12.56730
+G1 X98.265 Y106.476 E13.21235
+G1 X97.955 Y106.394 E13.22775
+G1 X97.381 Y106.181 E13.25724
+G1 X96.746 Y105.871 E13.29121
+G1 X96.150 Y105.499 E13.32501
+G1 X95.592 Y105.063 E13.35907
+G1 X95.174 Y104.666 E13.38677
+G1 X94.729 Y104.157 E13.41927
+G1 X94.372 Y103.659 E13.44875
+G1 X94.016 Y103.043 E13.48300
+G1 X93.778 Y102.520 E13.51063
+G1 X93.533 Y101.788 E13.54776
+G1 X95.377 Y94.906 E13.89043
+G1 E11.89043 F2400.00000
+G92 E0
+G1 X148.317 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1108
+G1 X158.784 Y100.996 E2.50346
+G1 X158.784 Y114.004 E3.12908
+G1 X148.317 Y114.004 E3.63254
+G1 X148.317 Y101.056 E4.25528
+G1 X147.931 Y100.611 F7800.000
+G1 F1108
+G1 X159.170 Y100.611 E4.79583
+G1 X159.170 Y114.389 E5.45854
+G1 X147.931 Y114.389 E5.99910
+G1 X147.931 Y100.671 E6.65893
+G1 X147.545 Y100.225 F7800.000
+G1 F1108
+G1 X159.555 Y100.225 E7.23658
+G1 X159.555 Y114.775 E7.93638
+G1 X147.545 Y114.775 E8.51404
+G1 X147.545 Y100.285 E9.21095
+G1 X147.928 Y100.341 F7800.000
+G1 X148.432 Y105.418
+G1 F1108
+G1 X157.096 Y103.097 E9.64234
+G1 X157.134 Y101.903 F7800.000
+G1 F1108
+G1 X157.752 Y101.285 E9.68499
+G1 X158.306 Y101.285 E9.71199
+G1 X157.308 Y102.283 E9.78086
+G1 X157.308 Y102.837 E9.80787
+G1 X158.495 Y101.649 E9.88981
+G1 X158.495 Y102.203 E9.91682
+G1 X157.308 Y103.390 E9.99876
+G1 X157.308 Y103.943 E10.02577
+G1 X158.495 Y102.756 E10.10772
+G1 X158.495 Y103.309 E10.13472
+G1 X157.308 Y104.497 E10.21667
+G1 X157.308 Y105.050 E10.24367
+G1 X158.495 Y103.863 E10.32562
+G1 X158.495 Y104.416 E10.35263
+G1 X157.308 Y105.603 E10.43457
+G1 X157.308 Y106.157 E10.46158
+G1 X158.495 Y104.970 E10.54353
+G1 X158.495 Y105.523 E10.57053
+G1 X157.308 Y106.710 E10.65248
+G1 X157.308 Y107.264 E10.67948
+G1 X158.495 Y106.076 E10.76143
+G1 X158.495 Y106.630 E10.78844
+G1 X157.308 Y107.817 E10.87038
+G1 X157.308 Y108.370 E10.89739
+G1 X158.495 Y107.183 E10.97934
+G1 X158.495 Y107.736 E11.00634
+G1 X157.308 Y108.924 E11.08829
+G1 X157.308 Y109.477 E11.11529
+G1 X158.495 Y108.290 E11.19724
+G1 X158.495 Y108.843 E11.22425
+G1 X157.308 Y110.030 E11.30619
+G1 X157.308 Y110.584 E11.33320
+G1 X158.495 Y109.396 E11.41515
+G1 X158.495 Y109.950 E11.44215
+G1 X157.308 Y111.137 E11.52410
+G1 X157.308 Y111.690 E11.55110
+G1 X158.495 Y110.503 E11.63305
+G1 X158.495 Y111.057 E11.66006
+G1 X157.308 Y112.244 E11.74200
+G1 X157.308 Y112.797 E11.76901
+G1 X158.495 Y111.610 E11.85096
+G1 X158.495 Y112.163 E11.87796
+G1 X157.308 Y113.351 E11.95991
+G1 X157.308 Y113.715 E11.97767
+G1 X157.497 Y113.715 E11.98691
+G1 X158.495 Y112.717 E12.05579
+G1 X158.495 Y113.270 E12.08279
+G1 X157.877 Y113.888 E12.12545
+G1 X156.113 Y113.888 F7800.000
+G1 F1108
+G1 X156.922 Y110.869 E12.27580
+G1 X156.922 Y101.285 E12.73672
+G1 X153.502 Y101.285 E12.90123
+G1 X150.125 Y113.888 E13.52876
+G1 X148.432 Y112.276 F7800.000
+G1 F1108
+G1 X149.871 Y113.715 E13.62661
+G1 X156.922 Y113.715 E13.96576
+G1 X156.922 Y112.586 E14.02005
+G1 X148.606 Y104.269 E14.58573
+G1 X148.606 Y101.285 E14.72924
+G1 X153.802 Y101.285 E14.97917
+G1 X157.096 Y104.579 E15.20319
+G1 X157.096 Y109.085 F7800.000
+G1 F1108
+G1 X148.432 Y111.406 E15.63458
+G1 Z11.150 F7800.000
+G1 E13.63458 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1093
+G1 X93.109 Y101.246 E2.04029
+G1 X93.024 Y100.613 E2.07100
+G1 X92.999 Y99.877 E2.10644
+G1 X93.046 Y99.177 E2.14018
+G1 X93.150 Y98.547 E2.17088
+G1 X93.341 Y97.832 E2.20649
+G1 X93.552 Y97.268 E2.23546
+G1 X93.876 Y96.604 E2.27097
+G1 X94.247 Y96.009 E2.30470
+G1 X94.634 Y95.501 E2.33541
+G1 X95.136 Y94.962 E2.37085
+G1 X95.665 Y94.501 E2.40459
+G1 X96.184 Y94.128 E2.43534
+G1 X96.794 Y93.775 E2.46923
+G1 X97.374 Y93.508 E2.49993
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60001
+G1 X100.092 Y92.998 E2.63375
+G1 X100.729 Y93.035 E2.66445
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.396 Y93.876 E2.79979
+G1 X103.991 Y94.247 E2.83353
+G1 X104.499 Y94.634 E2.86423
+G1 X105.038 Y95.136 E2.89968
+G1 X105.499 Y95.665 E2.93341
+G1 X105.874 Y96.187 E2.96433
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.123 E3.16409
+G1 X106.954 Y100.823 E3.19783
+G1 X106.849 Y101.457 E3.22874
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32856
+G1 X105.735 Y104.017 E3.36387
+G1 X105.305 Y104.571 E3.39760
+G1 X104.866 Y105.036 E3.42836
+G1 X104.335 Y105.499 E3.46224
+G1 X103.813 Y105.874 E3.49315
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59319
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69307
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75750
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82193
+G1 X96.604 Y106.124 E3.85744
+G1 X96.009 Y105.753 E3.89117
+G1 X95.501 Y105.366 E3.92188
+G1 X94.962 Y104.864 E3.95732
+G1 X94.501 Y104.335 E3.99106
+G1 X94.128 Y103.816 E4.02181
+G1 X93.775 Y103.206 E4.05570
+G1 X93.508 Y102.626 E4.08640
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1093
+G1 X92.897 Y102.036 E4.11992
+G1 X92.730 Y101.316 E4.15549
+G1 X92.640 Y100.646 E4.18799
+G1 X92.613 Y99.870 E4.22531
+G1 X92.663 Y99.132 E4.26089
+G1 X92.772 Y98.466 E4.29339
+G1 X92.974 Y97.714 E4.33080
+G1 X93.198 Y97.115 E4.36155
+G1 X93.538 Y96.417 E4.39891
+G1 X93.929 Y95.789 E4.43448
+G1 X94.339 Y95.252 E4.46698
+G1 X94.868 Y94.685 E4.50430
+G1 X95.425 Y94.198 E4.53988
+G1 X95.975 Y93.804 E4.57241
+G1 X96.616 Y93.432 E4.60807
+G1 X97.230 Y93.150 E4.64058
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74609
+G1 X100.096 Y92.612 E4.78167
+G1 X100.770 Y92.652 E4.81417
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88233
+G1 X102.887 Y93.199 E4.91966
+G1 X103.583 Y93.538 E4.95689
+G1 X104.211 Y93.929 E4.99246
+G1 X104.748 Y94.339 E5.02496
+G1 X105.315 Y94.868 E5.06228
+G1 X105.802 Y95.425 E5.09786
+G1 X106.197 Y95.976 E5.13049
+G1 X106.523 Y96.529 E5.16132
+G1 X106.851 Y97.232 E5.19865
+G1 X107.103 Y97.966 E5.23597
+G1 X107.252 Y98.588 E5.26672
+G1 X107.360 Y99.356 E5.30404
+G1 X107.387 Y100.130 E5.34127
+G1 X107.337 Y100.868 E5.37685
+G1 X107.227 Y101.537 E5.40948
+G1 X107.067 Y102.158 E5.44031
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51484
+G1 X106.052 Y104.238 E5.55206
+G1 X105.598 Y104.822 E5.58764
+G1 X105.133 Y105.314 E5.62017
+G1 X104.575 Y105.802 E5.65584
+G1 X104.024 Y106.197 E5.68847
+G1 X103.471 Y106.523 E5.71930
+G1 X102.768 Y106.851 E5.75663
+G1 X102.034 Y107.103 E5.79395
+G1 X101.412 Y107.252 E5.82470
+G1 X100.644 Y107.360 E5.86202
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93010
+G1 X98.464 Y107.227 E5.96742
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03549
+G1 X96.417 Y106.462 E6.07285
+G1 X95.789 Y106.071 E6.10842
+G1 X95.252 Y105.661 E6.14093
+G1 X94.685 Y105.132 E6.17824
+G1 X94.198 Y104.575 E6.21382
+G1 X93.804 Y104.025 E6.24635
+G1 X93.432 Y103.384 E6.28202
+G1 X93.150 Y102.770 E6.31452
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1093
+G1 X92.526 Y102.143 E6.34990
+G1 X92.350 Y101.385 E6.38732
+G1 X92.255 Y100.678 E6.42162
+G1 X92.226 Y99.864 E6.46081
+G1 X92.279 Y99.088 E6.49822
+G1 X92.395 Y98.384 E6.53252
+G1 X92.606 Y97.597 E6.57175
+G1 X92.843 Y96.963 E6.60427
+G1 X93.200 Y96.231 E6.64347
+G1 X93.611 Y95.570 E6.68088
+G1 X94.044 Y95.003 E6.71519
+G1 X94.599 Y94.407 E6.75437
+G1 X95.185 Y93.896 E6.79179
+G1 X95.765 Y93.480 E6.82610
+G1 X96.439 Y93.089 E6.86355
+G1 X97.087 Y92.792 E6.89785
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00880
+G1 X100.100 Y92.226 E7.04622
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11974
+G1 X102.272 Y92.565 E7.15227
+G1 X103.038 Y92.843 E7.19146
+G1 X103.769 Y93.200 E7.23061
+G1 X104.430 Y93.611 E7.26802
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34151
+G1 X106.104 Y95.185 E7.37892
+G1 X106.521 Y95.766 E7.41328
+G1 X106.864 Y96.349 E7.44584
+G1 X107.209 Y97.088 E7.48503
+G1 X107.474 Y97.858 E7.52421
+G1 X107.632 Y98.516 E7.55674
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.136 E7.63508
+G1 X107.721 Y100.912 E7.67249
+G1 X107.605 Y101.617 E7.70685
+G1 X107.435 Y102.272 E7.73941
+G1 X107.157 Y103.038 E7.77859
+G1 X106.800 Y103.769 E7.81773
+G1 X106.369 Y104.460 E7.85689
+G1 X105.891 Y105.074 E7.89430
+G1 X105.401 Y105.592 E7.92862
+G1 X104.815 Y106.104 E7.96606
+G1 X104.234 Y106.521 E8.00041
+G1 X103.651 Y106.864 E8.03297
+G1 X102.912 Y107.209 E8.07216
+G1 X102.142 Y107.474 E8.11135
+G1 X101.484 Y107.632 E8.14388
+G1 X100.678 Y107.745 E8.18307
+G1 X99.863 Y107.774 E8.22225
+G1 X99.188 Y107.732 E8.25478
+G1 X98.384 Y107.605 E8.29397
+G1 X97.597 Y107.394 E8.33316
+G1 X96.963 Y107.157 E8.36568
+G1 X96.231 Y106.800 E8.40488
+G1 X95.570 Y106.389 E8.44230
+G1 X95.003 Y105.956 E8.47660
+G1 X94.407 Y105.401 E8.51579
+G1 X93.896 Y104.815 E8.55320
+G1 X93.480 Y104.235 E8.58752
+G1 X93.089 Y103.561 E8.62496
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68707
+G1 X92.697 Y102.174 F7800.000
+G1 X93.277 Y101.458
+G1 F1093
+G1 X98.306 Y106.486 E9.02911
+G1 X98.604 Y106.566 E9.04396
+G1 X99.304 Y106.677 E9.07803
+G1 X99.877 Y106.712 E9.10566
+G1 X100.585 Y106.687 E9.13972
+G1 X101.286 Y106.589 E9.17379
+G1 X101.845 Y106.455 E9.20142
+G1 X102.515 Y106.224 E9.23548
+G1 X103.157 Y105.925 E9.26955
+G1 X103.655 Y105.631 E9.29736
+G1 X104.155 Y105.272 E9.32699
+G1 X104.744 Y104.744 E9.36502
+G1 X95.257 Y95.257 E10.01031
+G1 X95.845 Y94.728 E10.04834
+G1 X96.342 Y94.371 E10.07776
+G1 X96.927 Y94.032 E10.11030
+G1 X97.482 Y93.777 E10.13966
+G1 X98.155 Y93.545 E10.17391
+G1 X98.714 Y93.411 E10.20154
+G1 X99.416 Y93.313 E10.23567
+G1 X100.089 Y93.288 E10.26802
+G1 X100.698 Y93.323 E10.29738
+G1 X101.401 Y93.435 E10.33163
+G1 X101.690 Y93.509 E10.34596
+G1 X106.727 Y98.547 E10.68861
+G1 X106.778 Y101.178 F7800.000
+G1 F1093
+G1 X94.719 Y104.409 E11.28907
+G1 X93.222 Y98.822 F7800.000
+G1 F1093
+G1 X105.281 Y95.591 E11.88953
+G1 X104.623 Y105.094 F7800.000
+G1 F1093
+G1 X106.468 Y98.210 E12.23229
+G1 X106.224 Y97.485 E12.26908
+G1 X105.925 Y96.843 E12.30314
+G1 X105.631 Y96.345 E12.33096
+G1 X105.272 Y95.845 E12.36058
+G1 X104.830 Y95.338 E12.39294
+G1 X104.312 Y94.855 E12.42698
+G1 X103.827 Y94.485 E12.45634
+G1 X103.256 Y94.129 E12.48870
+G1 X102.623 Y93.821 E12.52255
+G1 X101.957 Y93.579 E12.55662
+G1 X101.736 Y93.521 E12.56762
+G1 X98.265 Y106.475 E13.21263
+G1 X97.920 Y106.383 E13.22980
+G1 X97.382 Y106.182 E13.25743
+G1 X96.744 Y105.871 E13.29155
+G1 X96.173 Y105.515 E13.32391
+G1 X95.688 Y105.145 E13.35327
+G1 X95.170 Y104.662 E13.38731
+G1 X94.728 Y104.155 E13.41967
+G1 X94.371 Y103.658 E13.44909
+G1 X94.032 Y103.073 E13.48163
+G1 X93.777 Y102.518 E13.51099
+G1 X93.547 Y101.849 E13.54503
+G1 X93.533 Y101.788 E13.54805
+G1 X95.377 Y94.906 E13.89072
+G1 E11.89072 F2400.00000
+G92 E0
+G1 X148.522 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1093
+G1 X158.346 Y100.996 E2.47250
+G1 X158.346 Y114.004 E3.09812
+G1 X148.522 Y114.004 E3.57062
+G1 X148.522 Y101.056 E4.19335
+G1 X148.136 Y100.611 F7800.000
+G1 F1093
+G1 X158.731 Y100.611 E4.70295
+G1 X158.731 Y114.389 E5.36566
+G1 X148.136 Y114.389 E5.87525
+G1 X148.136 Y100.671 E6.53508
+G1 X147.751 Y100.225 F7800.000
+G1 F1093
+G1 X159.117 Y100.225 E7.08177
+G1 X159.117 Y114.775 E7.78157
+G1 X147.751 Y114.775 E8.32826
+G1 X147.751 Y100.285 E9.02518
+G1 X148.132 Y100.344 F7800.000
+G1 X148.637 Y105.363
+G1 F1093
+G1 X156.657 Y103.214 E9.42451
+G1 X156.657 Y104.141 F7800.000
+G1 F1093
+G1 X153.802 Y101.285 E9.61871
+G1 X148.811 Y101.285 E9.85877
+G1 X148.811 Y104.475 E10.01215
+G1 X156.484 Y112.147 E10.53404
+G1 X156.484 Y113.715 E10.60942
+G1 X149.871 Y113.715 E10.92748
+G1 X148.637 Y112.481 E11.01137
+G1 X148.637 Y111.351 F7800.000
+G1 F1093
+G1 X156.657 Y109.202 E11.41070
+G1 X156.113 Y113.888 F7800.000
+G1 F1093
+G1 X156.484 Y112.505 E11.47956
+G1 X156.484 Y101.285 E12.01919
+G1 X153.502 Y101.285 E12.16262
+G1 X150.125 Y113.888 E12.79014
+G1 X157.487 Y113.888 F7800.000
+G1 F1093
+G1 X156.869 Y113.270 E12.83279
+G1 X156.869 Y112.717 E12.85980
+G1 X157.867 Y113.715 E12.92866
+G1 X158.057 Y113.715 E12.93791
+G1 X158.057 Y113.351 E12.95567
+G1 X156.869 Y112.163 E13.03762
+G1 X156.869 Y111.610 E13.06462
+G1 X158.057 Y112.797 E13.14657
+G1 X158.057 Y112.244 E13.17358
+G1 X156.869 Y111.057 E13.25552
+G1 X156.869 Y110.503 E13.28253
+G1 X158.057 Y111.691 E13.36447
+G1 X158.057 Y111.137 E13.39148
+G1 X156.869 Y109.950 E13.47343
+G1 X156.869 Y109.397 E13.50043
+G1 X158.057 Y110.584 E13.58238
+G1 X158.057 Y110.030 E13.60939
+G1 X156.869 Y108.843 E13.69133
+G1 X156.869 Y108.290 E13.71834
+G1 X158.057 Y109.477 E13.80028
+G1 X158.057 Y108.924 E13.82729
+G1 X156.869 Y107.736 E13.90924
+G1 X156.869 Y107.183 E13.93624
+G1 X158.057 Y108.370 E14.01819
+G1 X158.057 Y107.817 E14.04520
+G1 X156.869 Y106.630 E14.12714
+G1 X156.869 Y106.076 E14.15415
+G1 X158.057 Y107.264 E14.23609
+G1 X158.057 Y106.710 E14.26310
+G1 X156.869 Y105.523 E14.34505
+G1 X156.869 Y104.970 E14.37205
+G1 X158.057 Y106.157 E14.45400
+G1 X158.057 Y105.604 E14.48101
+G1 X156.869 Y104.416 E14.56295
+G1 X156.869 Y103.863 E14.58996
+G1 X158.057 Y105.050 E14.67191
+G1 X158.057 Y104.497 E14.69891
+G1 X156.869 Y103.310 E14.78086
+G1 X156.869 Y102.756 E14.80786
+G1 X158.057 Y103.943 E14.88981
+G1 X158.057 Y103.390 E14.91682
+G1 X156.869 Y102.203 E14.99876
+G1 X156.869 Y101.649 E15.02577
+G1 X158.057 Y102.837 E15.10772
+G1 X158.057 Y102.283 E15.13472
+G1 X157.059 Y101.285 E15.20359
+G1 X157.612 Y101.285 E15.23060
+G1 X158.230 Y101.903 E15.27326
+G1 Z11.450 F7800.000
+G1 E13.27326 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1047
+G1 X93.109 Y101.243 E2.04042
+G1 X93.024 Y100.613 E2.07099
+G1 X92.999 Y99.877 E2.10644
+G1 X93.046 Y99.174 E2.14031
+G1 X93.150 Y98.547 E2.17088
+G1 X93.341 Y97.835 E2.20633
+G1 X93.592 Y97.177 E2.24019
+G1 X93.874 Y96.608 E2.27077
+G1 X94.264 Y95.984 E2.30617
+G1 X94.718 Y95.403 E2.34163
+G1 X95.133 Y94.965 E2.37064
+G1 X95.667 Y94.499 E2.40472
+G1 X96.184 Y94.128 E2.43534
+G1 X96.796 Y93.774 E2.46935
+G1 X97.374 Y93.509 E2.49993
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60001
+G1 X100.094 Y92.998 E2.63388
+G1 X100.729 Y93.035 E2.66445
+G1 X101.457 Y93.151 E2.69990
+G1 X102.137 Y93.332 E2.73376
+G1 X102.733 Y93.553 E2.76434
+G1 X103.396 Y93.876 E2.79979
+G1 X103.994 Y94.248 E2.83365
+G1 X104.499 Y94.634 E2.86423
+G1 X105.038 Y95.136 E2.89967
+G1 X105.501 Y95.667 E2.93354
+G1 X105.874 Y96.187 E2.96432
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.123 E3.16409
+G1 X106.954 Y100.826 E3.19795
+G1 X106.850 Y101.454 E3.22857
+G1 X106.668 Y102.137 E3.26259
+G1 X106.447 Y102.733 E3.29316
+G1 X106.124 Y103.395 E3.32856
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.038 E3.42850
+G1 X104.333 Y105.501 E3.46236
+G1 X103.813 Y105.874 E3.49315
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59319
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.877 Y107.001 E3.69291
+G1 X99.174 Y106.954 E3.72678
+G1 X98.546 Y106.850 E3.75739
+G1 X97.863 Y106.668 E3.79141
+G1 X97.267 Y106.447 E3.82198
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92810
+G1 X94.965 Y104.867 E3.95711
+G1 X94.499 Y104.333 E3.99119
+G1 X94.129 Y103.816 E4.02176
+G1 X93.759 Y103.175 E4.05737
+G1 X93.509 Y102.627 E4.08634
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1047
+G1 X92.897 Y102.036 E4.11991
+G1 X92.729 Y101.313 E4.15562
+G1 X92.640 Y100.646 E4.18799
+G1 X92.613 Y99.870 E4.22531
+G1 X92.663 Y99.130 E4.26101
+G1 X92.772 Y98.466 E4.29339
+G1 X92.973 Y97.716 E4.33070
+G1 X93.238 Y97.023 E4.36641
+G1 X93.537 Y96.420 E4.39878
+G1 X93.948 Y95.762 E4.43607
+G1 X94.425 Y95.151 E4.47340
+G1 X94.866 Y94.686 E4.50417
+G1 X95.427 Y94.197 E4.54000
+G1 X95.975 Y93.804 E4.57240
+G1 X96.619 Y93.431 E4.60820
+G1 X97.230 Y93.150 E4.64058
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74609
+G1 X100.099 Y92.612 E4.78180
+G1 X100.770 Y92.652 E4.81417
+G1 X101.537 Y92.773 E4.85149
+G1 X102.254 Y92.964 E4.88719
+G1 X102.885 Y93.198 E4.91957
+G1 X103.583 Y93.538 E4.95688
+G1 X104.213 Y93.930 E4.99259
+G1 X104.748 Y94.339 E5.02496
+G1 X105.315 Y94.868 E5.06228
+G1 X105.803 Y95.427 E5.09798
+G1 X106.197 Y95.976 E5.13048
+G1 X106.523 Y96.529 E5.16132
+G1 X106.851 Y97.232 E5.19865
+G1 X107.103 Y97.966 E5.23597
+G1 X107.252 Y98.588 E5.26672
+G1 X107.360 Y99.356 E5.30404
+G1 X107.387 Y100.130 E5.34127
+G1 X107.337 Y100.870 E5.37697
+G1 X107.227 Y101.535 E5.40937
+G1 X107.036 Y102.254 E5.44517
+G1 X106.802 Y102.885 E5.47755
+G1 X106.462 Y103.582 E5.51483
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58291
+G1 X105.132 Y105.315 E5.62026
+G1 X104.573 Y105.803 E5.65596
+G1 X104.024 Y106.197 E5.68847
+G1 X103.471 Y106.523 E5.71930
+G1 X102.768 Y106.851 E5.75663
+G1 X102.034 Y107.103 E5.79395
+G1 X101.412 Y107.252 E5.82470
+G1 X100.644 Y107.360 E5.86202
+G1 X99.870 Y107.387 E5.89925
+G1 X99.130 Y107.337 E5.93495
+G1 X98.465 Y107.227 E5.96736
+G1 X97.746 Y107.036 E6.00315
+G1 X97.115 Y106.802 E6.03553
+G1 X96.418 Y106.462 E6.07282
+G1 X95.762 Y106.052 E6.11001
+G1 X95.151 Y105.575 E6.14734
+G1 X94.686 Y105.134 E6.17811
+G1 X94.197 Y104.573 E6.21394
+G1 X93.804 Y104.026 E6.24632
+G1 X93.415 Y103.352 E6.28373
+G1 X93.150 Y102.770 E6.31448
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1047
+G1 X92.526 Y102.143 E6.34990
+G1 X92.349 Y101.382 E6.38745
+G1 X92.255 Y100.678 E6.42162
+G1 X92.226 Y99.864 E6.46080
+G1 X92.279 Y99.085 E6.49835
+G1 X92.395 Y98.384 E6.53252
+G1 X92.606 Y97.597 E6.57171
+G1 X92.884 Y96.868 E6.60925
+G1 X93.200 Y96.231 E6.64343
+G1 X93.631 Y95.541 E6.68260
+G1 X94.133 Y94.899 E6.72179
+G1 X94.599 Y94.408 E6.75433
+G1 X95.188 Y93.894 E6.79192
+G1 X95.765 Y93.480 E6.82610
+G1 X96.441 Y93.088 E6.86368
+G1 X97.087 Y92.792 E6.89785
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00880
+G1 X100.103 Y92.226 E7.04635
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11970
+G1 X102.371 Y92.596 E7.15725
+G1 X103.037 Y92.843 E7.19142
+G1 X103.769 Y93.200 E7.23061
+G1 X104.432 Y93.613 E7.26815
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34151
+G1 X106.106 Y95.188 E7.37906
+G1 X106.521 Y95.766 E7.41328
+G1 X106.864 Y96.349 E7.44584
+G1 X107.209 Y97.088 E7.48502
+G1 X107.474 Y97.858 E7.52421
+G1 X107.632 Y98.516 E7.55674
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.136 E7.63508
+G1 X107.721 Y100.915 E7.67263
+G1 X107.605 Y101.616 E7.70681
+G1 X107.404 Y102.371 E7.74439
+G1 X107.157 Y103.037 E7.77856
+G1 X106.800 Y103.769 E7.81773
+G1 X106.368 Y104.460 E7.85692
+G1 X105.956 Y104.997 E7.88945
+G1 X105.401 Y105.593 E7.92865
+G1 X104.812 Y106.106 E7.96619
+G1 X104.234 Y106.521 E8.00041
+G1 X103.651 Y106.864 E8.03297
+G1 X102.912 Y107.209 E8.07216
+G1 X102.142 Y107.474 E8.11135
+G1 X101.484 Y107.632 E8.14388
+G1 X100.678 Y107.745 E8.18307
+G1 X99.864 Y107.774 E8.22222
+G1 X99.085 Y107.721 E8.25976
+G1 X98.384 Y107.605 E8.29394
+G1 X97.629 Y107.404 E8.33152
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40487
+G1 X95.541 Y106.369 E8.44401
+G1 X94.899 Y105.867 E8.48320
+G1 X94.408 Y105.401 E8.51574
+G1 X93.894 Y104.812 E8.55333
+G1 X93.480 Y104.235 E8.58750
+G1 X93.072 Y103.529 E8.62672
+G1 X92.792 Y102.913 E8.65925
+G1 X92.603 Y102.366 E8.68707
+G1 X92.697 Y102.175 F7800.000
+G1 X93.278 Y101.458
+G1 F1047
+G1 X98.307 Y106.487 E9.02917
+G1 X98.607 Y106.567 E9.04410
+G1 X99.208 Y106.666 E9.07338
+G1 X99.882 Y106.712 E9.10587
+G1 X100.585 Y106.687 E9.13972
+G1 X101.286 Y106.589 E9.17379
+G1 X101.845 Y106.455 E9.20142
+G1 X102.515 Y106.224 E9.23548
+G1 X103.157 Y105.925 E9.26955
+G1 X103.655 Y105.631 E9.29737
+G1 X104.153 Y105.274 E9.32686
+G1 X104.743 Y104.743 E9.36502
+G1 X95.256 Y95.256 E10.01033
+G1 X95.847 Y94.726 E10.04849
+G1 X96.341 Y94.371 E10.07777
+G1 X96.929 Y94.031 E10.11045
+G1 X97.482 Y93.777 E10.13968
+G1 X98.155 Y93.545 E10.17394
+G1 X98.714 Y93.411 E10.20156
+G1 X99.416 Y93.313 E10.23569
+G1 X100.091 Y93.288 E10.26817
+G1 X100.698 Y93.323 E10.29740
+G1 X101.397 Y93.434 E10.33144
+G1 X101.693 Y93.513 E10.34619
+G1 X106.727 Y98.547 E10.68860
+G1 X106.778 Y101.178 F7800.000
+G1 F1047
+G1 X94.719 Y104.409 E11.28906
+G1 X93.222 Y98.822 F7800.000
+G1 F1047
+G1 X105.281 Y95.591 E11.88952
+G1 X104.623 Y105.094 F7800.000
+G1 F1047
+G1 X106.468 Y98.210 E12.23227
+G1 X106.455 Y98.155 E12.23501
+G1 X106.224 Y97.485 E12.26907
+G1 X105.925 Y96.843 E12.30314
+G1 X105.631 Y96.345 E12.33096
+G1 X105.274 Y95.847 E12.36045
+G1 X104.830 Y95.338 E12.39294
+G1 X104.312 Y94.855 E12.42699
+G1 X103.829 Y94.486 E12.45621
+G1 X103.256 Y94.129 E12.48870
+G1 X102.619 Y93.819 E12.52274
+G1 X102.050 Y93.608 E12.55197
+G1 X101.735 Y93.524 E12.56762
+G1 X98.265 Y106.476 E13.21253
+G1 X97.950 Y106.392 E13.22818
+G1 X97.381 Y106.181 E13.25740
+G1 X96.746 Y105.871 E13.29139
+G1 X96.150 Y105.499 E13.32519
+G1 X95.592 Y105.063 E13.35925
+G1 X95.174 Y104.667 E13.38694
+G1 X94.726 Y104.153 E13.41969
+G1 X94.372 Y103.660 E13.44892
+G1 X94.016 Y103.043 E13.48318
+G1 X93.778 Y102.520 E13.51080
+G1 X93.533 Y101.788 E13.54794
+G1 X95.377 Y94.906 E13.89060
+G1 E11.89060 F2400.00000
+G92 E0
+G1 X148.727 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1047
+G1 X157.907 Y100.996 E2.44154
+G1 X157.907 Y114.004 E3.06716
+G1 X148.727 Y114.004 E3.50870
+G1 X148.727 Y101.056 E4.13143
+G1 X148.341 Y100.611 F7800.000
+G1 F1047
+G1 X158.293 Y100.611 E4.61006
+G1 X158.293 Y114.389 E5.27277
+G1 X148.341 Y114.389 E5.75140
+G1 X148.341 Y100.671 E6.41123
+G1 X147.956 Y100.225 F7800.000
+G1 F1047
+G1 X158.678 Y100.225 E6.92696
+G1 X158.678 Y114.775 E7.62676
+G1 X147.956 Y114.775 E8.14249
+G1 X147.956 Y100.285 E8.83941
+G1 X148.336 Y100.348 F7800.000
+G1 X148.843 Y105.308
+G1 F1047
+G1 X156.219 Y103.332 E9.20668
+G1 X156.219 Y103.702 F7800.000
+G1 F1047
+G1 X153.802 Y101.285 E9.37106
+G1 X149.016 Y101.285 E9.60124
+G1 X149.016 Y104.680 E9.76450
+G1 X156.045 Y111.709 E10.24260
+G1 X156.045 Y113.715 E10.33907
+G1 X149.871 Y113.715 E10.63604
+G1 X148.843 Y112.686 E10.70597
+G1 X148.843 Y111.296 F7800.000
+G1 F1047
+G1 X156.219 Y109.320 E11.07324
+G1 X157.000 Y113.888 F7800.000
+G1 F1047
+G1 X157.618 Y113.270 E11.11590
+G1 X157.618 Y112.717 E11.14291
+G1 X156.620 Y113.715 E11.21178
+G1 X156.431 Y113.715 E11.22102
+G1 X156.431 Y113.351 E11.23879
+G1 X157.618 Y112.163 E11.32073
+G1 X157.618 Y111.610 E11.34774
+G1 X156.431 Y112.797 E11.42969
+G1 X156.431 Y112.244 E11.45669
+G1 X157.618 Y111.057 E11.53864
+G1 X157.618 Y110.503 E11.56564
+G1 X156.431 Y111.690 E11.64759
+G1 X156.431 Y111.137 E11.67460
+G1 X157.618 Y109.950 E11.75654
+G1 X157.618 Y109.396 E11.78355
+G1 X156.431 Y110.584 E11.86550
+G1 X156.431 Y110.030 E11.89250
+G1 X157.618 Y108.843 E11.97445
+G1 X157.618 Y108.290 E12.00145
+G1 X156.431 Y109.477 E12.08340
+G1 X156.431 Y108.924 E12.11041
+G1 X157.618 Y107.736 E12.19235
+G1 X157.618 Y107.183 E12.21936
+G1 X156.431 Y108.370 E12.30131
+G1 X156.431 Y107.817 E12.32831
+G1 X157.618 Y106.630 E12.41026
+G1 X157.618 Y106.076 E12.43727
+G1 X156.431 Y107.264 E12.51921
+G1 X156.431 Y106.710 E12.54622
+G1 X157.618 Y105.523 E12.62816
+G1 X157.618 Y104.970 E12.65517
+G1 X156.431 Y106.157 E12.73712
+G1 X156.431 Y105.603 E12.76412
+G1 X157.618 Y104.416 E12.84607
+G1 X157.618 Y103.863 E12.87308
+G1 X156.431 Y105.050 E12.95502
+G1 X156.431 Y104.497 E12.98203
+G1 X157.618 Y103.309 E13.06397
+G1 X157.618 Y102.756 E13.09098
+G1 X156.431 Y103.943 E13.17293
+G1 X156.431 Y103.390 E13.19993
+G1 X157.618 Y102.203 E13.28188
+G1 X157.618 Y101.649 E13.30889
+G1 X156.431 Y102.837 E13.39083
+G1 X156.431 Y102.283 E13.41784
+G1 X157.429 Y101.285 E13.48670
+G1 X156.875 Y101.285 E13.51371
+G1 X156.257 Y101.903 E13.55636
+G1 X153.548 Y101.112 F7800.000
+G1 F1047
+G1 X150.125 Y113.888 E14.19253
+G1 Z11.750 F7800.000
+G1 E12.19253 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1031
+G1 X93.104 Y101.215 E2.04180
+G1 X93.016 Y100.514 E2.07580
+G1 X92.998 Y99.880 E2.10628
+G1 X93.047 Y99.172 E2.14043
+G1 X93.150 Y98.546 E2.17091
+G1 X93.333 Y97.860 E2.20507
+G1 X93.553 Y97.267 E2.23551
+G1 X93.876 Y96.604 E2.27096
+G1 X94.249 Y96.004 E2.30495
+G1 X94.634 Y95.501 E2.33540
+G1 X95.136 Y94.962 E2.37085
+G1 X95.669 Y94.498 E2.40484
+G1 X96.184 Y94.128 E2.43533
+G1 X96.798 Y93.772 E2.46948
+G1 X97.374 Y93.509 E2.49992
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.391 Y93.024 E2.60000
+G1 X100.097 Y92.998 E2.63400
+G1 X100.729 Y93.035 E2.66444
+G1 X101.457 Y93.151 E2.69989
+G1 X102.140 Y93.333 E2.73389
+G1 X102.733 Y93.553 E2.76433
+G1 X103.396 Y93.876 E2.79978
+G1 X103.996 Y94.249 E2.83378
+G1 X104.499 Y94.634 E2.86422
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.871 Y96.183 E2.96409
+G1 X106.228 Y96.798 E2.99830
+G1 X106.491 Y97.374 E3.02874
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09332
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.123 E3.16408
+G1 X106.953 Y100.828 E3.19808
+G1 X106.850 Y101.454 E3.22856
+G1 X106.667 Y102.140 E3.26271
+G1 X106.447 Y102.733 E3.29315
+G1 X106.124 Y103.395 E3.32856
+G1 X105.736 Y104.017 E3.36386
+G1 X105.301 Y104.575 E3.39785
+G1 X104.867 Y105.035 E3.42830
+G1 X104.308 Y105.521 E3.46391
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.926 Y106.733 E3.59318
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.877 Y107.001 E3.69290
+G1 X99.172 Y106.953 E3.72690
+G1 X98.546 Y106.850 E3.75738
+G1 X97.860 Y106.667 E3.79154
+G1 X97.267 Y106.447 E3.82198
+G1 X96.605 Y106.124 E3.85739
+G1 X95.983 Y105.736 E3.89268
+G1 X95.425 Y105.301 E3.92668
+G1 X94.964 Y104.866 E3.95716
+G1 X94.498 Y104.331 E3.99131
+G1 X94.128 Y103.816 E4.02180
+G1 X93.772 Y103.202 E4.05595
+G1 X93.509 Y102.626 E4.08639
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1031
+G1 X92.898 Y102.037 E4.11988
+G1 X92.724 Y101.282 E4.15711
+G1 X92.632 Y100.543 E4.19294
+G1 X92.612 Y99.873 E4.22521
+G1 X92.663 Y99.127 E4.26114
+G1 X92.772 Y98.465 E4.29341
+G1 X92.965 Y97.743 E4.32934
+G1 X93.198 Y97.115 E4.36158
+G1 X93.538 Y96.417 E4.39890
+G1 X93.932 Y95.785 E4.43474
+G1 X94.339 Y95.252 E4.46698
+G1 X94.868 Y94.685 E4.50429
+G1 X95.429 Y94.195 E4.54013
+G1 X95.975 Y93.804 E4.57240
+G1 X96.621 Y93.429 E4.60833
+G1 X97.230 Y93.150 E4.64057
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.639 E4.74609
+G1 X100.101 Y92.612 E4.78192
+G1 X100.770 Y92.652 E4.81417
+G1 X101.537 Y92.773 E4.85148
+G1 X102.257 Y92.965 E4.88732
+G1 X102.885 Y93.198 E4.91956
+G1 X103.583 Y93.538 E4.95688
+G1 X104.215 Y93.932 E4.99272
+G1 X104.748 Y94.339 E5.02496
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09957
+G1 X106.196 Y95.974 E5.13034
+G1 X106.571 Y96.621 E5.16631
+G1 X106.850 Y97.230 E5.19855
+G1 X107.103 Y97.966 E5.23597
+G1 X107.252 Y98.588 E5.26672
+G1 X107.360 Y99.356 E5.30404
+G1 X107.387 Y100.129 E5.34126
+G1 X107.337 Y100.873 E5.37710
+G1 X107.228 Y101.535 E5.40937
+G1 X107.035 Y102.257 E5.44530
+G1 X106.802 Y102.885 E5.47754
+G1 X106.462 Y103.582 E5.51483
+G1 X106.052 Y104.238 E5.55205
+G1 X105.594 Y104.826 E5.58789
+G1 X105.134 Y105.314 E5.62013
+G1 X104.547 Y105.824 E5.65755
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71930
+G1 X102.768 Y106.851 E5.75663
+G1 X102.034 Y107.103 E5.79395
+G1 X101.412 Y107.252 E5.82470
+G1 X100.644 Y107.360 E5.86202
+G1 X99.871 Y107.387 E5.89924
+G1 X99.127 Y107.337 E5.93508
+G1 X98.465 Y107.228 E5.96735
+G1 X97.743 Y107.035 E6.00328
+G1 X97.115 Y106.802 E6.03552
+G1 X96.418 Y106.462 E6.07281
+G1 X95.762 Y106.052 E6.11003
+G1 X95.174 Y105.594 E6.14587
+G1 X94.686 Y105.134 E6.17814
+G1 X94.195 Y104.571 E6.21407
+G1 X93.804 Y104.025 E6.24634
+G1 X93.429 Y103.379 E6.28227
+G1 X93.150 Y102.770 E6.31451
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1031
+G1 X92.526 Y102.143 E6.34989
+G1 X92.343 Y101.350 E6.38904
+G1 X92.247 Y100.572 E6.42672
+G1 X92.226 Y99.865 E6.46077
+G1 X92.280 Y99.083 E6.49848
+G1 X92.395 Y98.384 E6.53253
+G1 X92.597 Y97.626 E6.57024
+G1 X92.843 Y96.963 E6.60428
+G1 X93.200 Y96.231 E6.64347
+G1 X93.614 Y95.565 E6.68115
+G1 X94.044 Y95.003 E6.71518
+G1 X94.599 Y94.407 E6.75437
+G1 X95.190 Y93.892 E6.79205
+G1 X95.765 Y93.480 E6.82610
+G1 X96.444 Y93.087 E6.86381
+G1 X97.087 Y92.792 E6.89785
+G1 X97.858 Y92.526 E6.93707
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00880
+G1 X100.105 Y92.226 E7.04648
+G1 X100.812 Y92.268 E7.08051
+G1 X101.617 Y92.395 E7.11970
+G1 X102.374 Y92.597 E7.15738
+G1 X103.037 Y92.843 E7.19142
+G1 X103.769 Y93.200 E7.23060
+G1 X104.435 Y93.614 E7.26828
+G1 X104.997 Y94.044 E7.30232
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38068
+G1 X106.520 Y95.765 E7.41322
+G1 X106.913 Y96.444 E7.45095
+G1 X107.208 Y97.087 E7.48499
+G1 X107.474 Y97.858 E7.52421
+G1 X107.632 Y98.516 E7.55674
+G1 X107.745 Y99.322 E7.59592
+G1 X107.774 Y100.136 E7.63507
+G1 X107.720 Y100.917 E7.67275
+G1 X107.605 Y101.616 E7.70680
+G1 X107.403 Y102.374 E7.74452
+G1 X107.157 Y103.037 E7.77855
+G1 X106.800 Y103.769 E7.81773
+G1 X106.369 Y104.460 E7.85688
+G1 X105.887 Y105.078 E7.89456
+G1 X105.401 Y105.592 E7.92860
+G1 X104.786 Y106.127 E7.96782
+G1 X104.234 Y106.520 E8.00040
+G1 X103.651 Y106.864 E8.03297
+G1 X102.912 Y107.209 E8.07216
+G1 X102.142 Y107.474 E8.11135
+G1 X101.484 Y107.632 E8.14387
+G1 X100.678 Y107.745 E8.18306
+G1 X99.864 Y107.774 E8.22221
+G1 X99.083 Y107.720 E8.25989
+G1 X98.384 Y107.605 E8.29394
+G1 X97.626 Y107.403 E8.33165
+G1 X96.963 Y107.157 E8.36569
+G1 X96.231 Y106.800 E8.40487
+G1 X95.540 Y106.369 E8.44402
+G1 X94.922 Y105.887 E8.48170
+G1 X94.408 Y105.401 E8.51575
+G1 X93.892 Y104.810 E8.55346
+G1 X93.480 Y104.235 E8.58751
+G1 X93.087 Y103.556 E8.62522
+G1 X92.792 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68707
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F1031
+G1 X98.307 Y106.487 E9.02907
+G1 X98.607 Y106.567 E9.04402
+G1 X99.205 Y106.666 E9.07317
+G1 X99.882 Y106.712 E9.10578
+G1 X100.585 Y106.687 E9.13963
+G1 X101.286 Y106.589 E9.17370
+G1 X101.845 Y106.455 E9.20133
+G1 X102.515 Y106.224 E9.23539
+G1 X103.157 Y105.925 E9.26946
+G1 X103.656 Y105.630 E9.29735
+G1 X104.129 Y105.293 E9.32525
+G1 X104.744 Y104.744 E9.36493
+G1 X95.257 Y95.257 E10.01022
+G1 X95.849 Y94.725 E10.04850
+G1 X96.341 Y94.372 E10.07765
+G1 X96.932 Y94.029 E10.11046
+G1 X97.481 Y93.777 E10.13956
+G1 X98.155 Y93.545 E10.17382
+G1 X98.714 Y93.411 E10.20145
+G1 X99.416 Y93.313 E10.23557
+G1 X100.094 Y93.288 E10.26818
+G1 X100.698 Y93.323 E10.29728
+G1 X101.397 Y93.434 E10.33133
+G1 X101.693 Y93.513 E10.34608
+G1 X106.727 Y98.547 E10.68848
+G1 X106.778 Y101.178 F7800.000
+G1 F1031
+G1 X94.719 Y104.409 E11.28894
+G1 X93.222 Y98.822 F7800.000
+G1 F1031
+G1 X105.280 Y95.591 E11.88935
+G1 X104.624 Y105.093 F7800.000
+G1 F1031
+G1 X106.468 Y98.210 E12.23206
+G1 X106.455 Y98.155 E12.23480
+G1 X106.223 Y97.481 E12.26906
+G1 X105.971 Y96.932 E12.29816
+G1 X105.628 Y96.340 E12.33104
+G1 X105.293 Y95.871 E12.35872
+G1 X104.829 Y95.337 E12.39279
+G1 X104.312 Y94.855 E12.42678
+G1 X103.831 Y94.488 E12.45588
+G1 X103.255 Y94.129 E12.48849
+G1 X102.619 Y93.819 E12.52254
+G1 X102.052 Y93.608 E12.55164
+G1 X101.735 Y93.524 E12.56741
+G1 X98.265 Y106.476 E13.21231
+G1 X97.948 Y106.392 E13.22808
+G1 X97.381 Y106.181 E13.25718
+G1 X96.746 Y105.871 E13.29117
+G1 X96.149 Y105.498 E13.32502
+G1 X95.614 Y105.082 E13.35764
+G1 X95.173 Y104.665 E13.38678
+G1 X94.725 Y104.151 E13.41960
+G1 X94.372 Y103.659 E13.44875
+G1 X94.029 Y103.068 E13.48156
+G1 X93.777 Y102.519 E13.51066
+G1 X93.533 Y101.787 E13.54774
+G1 X95.377 Y94.906 E13.89038
+G1 E11.89038 F2400.00000
+G92 E0
+G1 X148.932 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1031
+G1 X157.469 Y100.996 E2.41058
+G1 X157.469 Y114.004 E3.03619
+G1 X148.932 Y114.004 E3.44677
+G1 X148.932 Y101.056 E4.06950
+G1 X148.547 Y100.611 F7800.000
+G1 F1031
+G1 X157.854 Y100.611 E4.51717
+G1 X157.854 Y114.389 E5.17989
+G1 X148.547 Y114.389 E5.62756
+G1 X148.547 Y100.671 E6.28738
+G1 X148.161 Y100.225 F7800.000
+G1 F1031
+G1 X158.240 Y100.225 E6.77215
+G1 X158.240 Y114.775 E7.47195
+G1 X148.161 Y114.775 E7.95672
+G1 X148.161 Y100.285 E8.65364
+G1 X148.540 Y100.351 F7800.000
+G1 X149.048 Y105.253
+G1 F1031
+G1 X155.780 Y103.449 E8.98886
+G1 X155.780 Y103.263 F7800.000
+G1 F1031
+G1 X153.802 Y101.285 E9.12340
+G1 X149.221 Y101.285 E9.34372
+G1 X149.221 Y104.885 E9.51684
+G1 X155.607 Y111.270 E9.95116
+G1 X155.607 Y113.715 E10.06872
+G1 X149.871 Y113.715 E10.34460
+G1 X149.048 Y112.892 E10.40057
+G1 X150.125 Y113.888 F7800.000
+G1 F1031
+G1 X153.548 Y101.112 E11.03674
+G1 X157.353 Y101.903 F7800.000
+G1 F1031
+G1 X156.735 Y101.285 E11.07939
+G1 X156.182 Y101.285 E11.10640
+G1 X157.180 Y102.283 E11.17527
+G1 X157.180 Y102.837 E11.20228
+G1 X155.992 Y101.649 E11.28422
+G1 X155.992 Y102.203 E11.31123
+G1 X157.180 Y103.390 E11.39318
+G1 X157.180 Y103.943 E11.42018
+G1 X155.992 Y102.756 E11.50213
+G1 X155.992 Y103.310 E11.52913
+G1 X157.180 Y104.497 E11.61108
+G1 X157.180 Y105.050 E11.63809
+G1 X155.992 Y103.863 E11.72003
+G1 X155.992 Y104.416 E11.74704
+G1 X157.180 Y105.604 E11.82899
+G1 X157.180 Y106.157 E11.85599
+G1 X155.992 Y104.970 E11.93794
+G1 X155.992 Y105.523 E11.96494
+G1 X157.180 Y106.710 E12.04689
+G1 X157.180 Y107.264 E12.07390
+G1 X155.992 Y106.076 E12.15584
+G1 X155.992 Y106.630 E12.18285
+G1 X157.180 Y107.817 E12.26480
+G1 X157.180 Y108.370 E12.29180
+G1 X155.992 Y107.183 E12.37375
+G1 X155.992 Y107.736 E12.40075
+G1 X157.180 Y108.924 E12.48270
+G1 X157.180 Y109.477 E12.50971
+G1 X155.992 Y108.290 E12.59165
+G1 X155.992 Y108.843 E12.61866
+G1 X157.180 Y110.030 E12.70061
+G1 X157.180 Y110.584 E12.72761
+G1 X155.992 Y109.397 E12.80956
+G1 X155.992 Y109.950 E12.83657
+G1 X157.180 Y111.137 E12.91851
+G1 X157.180 Y111.691 E12.94552
+G1 X155.992 Y110.503 E13.02746
+G1 X155.992 Y111.057 E13.05447
+G1 X157.180 Y112.244 E13.13642
+G1 X157.180 Y112.797 E13.16342
+G1 X155.992 Y111.610 E13.24537
+G1 X155.992 Y112.163 E13.27238
+G1 X157.180 Y113.351 E13.35432
+G1 X157.180 Y113.715 E13.37208
+G1 X156.990 Y113.715 E13.38133
+G1 X155.992 Y112.717 E13.45019
+G1 X155.992 Y113.270 E13.47720
+G1 X156.610 Y113.888 E13.51985
+G1 X155.780 Y109.437 F7800.000
+G1 F1031
+G1 X149.048 Y111.241 E13.85507
+G1 Z12.050 F7800.000
+G1 E11.85507 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1016
+G1 X93.104 Y101.215 E2.04180
+G1 X93.016 Y100.511 E2.07592
+G1 X92.998 Y99.880 E2.10627
+G1 X93.047 Y99.169 E2.14056
+G1 X93.150 Y98.547 E2.17087
+G1 X93.341 Y97.835 E2.20632
+G1 X93.594 Y97.173 E2.24044
+G1 X93.874 Y96.608 E2.27076
+G1 X94.264 Y95.984 E2.30617
+G1 X94.718 Y95.403 E2.34163
+G1 X95.133 Y94.965 E2.37063
+G1 X95.671 Y94.496 E2.40497
+G1 X96.184 Y94.129 E2.43532
+G1 X96.801 Y93.771 E2.46960
+G1 X97.374 Y93.509 E2.49992
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.60000
+G1 X100.100 Y92.998 E2.63413
+G1 X100.729 Y93.035 E2.66444
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.396 Y93.876 E2.79978
+G1 X103.998 Y94.251 E2.83390
+G1 X104.499 Y94.634 E2.86422
+G1 X105.038 Y95.136 E2.89967
+G1 X105.504 Y95.671 E2.93379
+G1 X105.874 Y96.187 E2.96431
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.731 Y98.071 E3.06419
+G1 X106.892 Y98.762 E3.09832
+G1 X106.976 Y99.386 E3.12863
+G1 X107.001 Y100.123 E3.16408
+G1 X106.953 Y100.831 E3.19820
+G1 X106.850 Y101.457 E3.22873
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32856
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.038 E3.42849
+G1 X104.329 Y105.504 E3.46261
+G1 X103.813 Y105.874 E3.49314
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55772
+G1 X101.929 Y106.731 E3.59301
+G1 X101.238 Y106.892 E3.62714
+G1 X100.614 Y106.976 E3.65745
+G1 X99.877 Y107.001 E3.69290
+G1 X99.169 Y106.953 E3.72703
+G1 X98.547 Y106.850 E3.75734
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82193
+G1 X96.604 Y106.124 E3.85742
+G1 X96.002 Y105.749 E3.89155
+G1 X95.501 Y105.366 E3.92186
+G1 X94.962 Y104.864 E3.95731
+G1 X94.496 Y104.329 E3.99144
+G1 X94.129 Y103.817 E4.02175
+G1 X93.759 Y103.175 E4.05737
+G1 X93.509 Y102.627 E4.08634
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1016
+G1 X92.898 Y102.037 E4.11989
+G1 X92.724 Y101.283 E4.15710
+G1 X92.631 Y100.540 E4.19307
+G1 X92.612 Y99.873 E4.22521
+G1 X92.664 Y99.124 E4.26127
+G1 X92.772 Y98.466 E4.29338
+G1 X92.973 Y97.716 E4.33070
+G1 X93.240 Y97.018 E4.36667
+G1 X93.537 Y96.420 E4.39878
+G1 X93.948 Y95.762 E4.43607
+G1 X94.425 Y95.151 E4.47340
+G1 X94.866 Y94.687 E4.50417
+G1 X95.431 Y94.193 E4.54026
+G1 X95.975 Y93.804 E4.57239
+G1 X96.623 Y93.428 E4.60846
+G1 X97.230 Y93.150 E4.64057
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.357 Y92.640 E4.74609
+G1 X100.104 Y92.612 E4.78206
+G1 X100.770 Y92.652 E4.81417
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88233
+G1 X102.887 Y93.199 E4.91966
+G1 X103.582 Y93.538 E4.95688
+G1 X104.217 Y93.933 E4.99285
+G1 X104.748 Y94.339 E5.02496
+G1 X105.315 Y94.868 E5.06227
+G1 X105.807 Y95.431 E5.09824
+G1 X106.197 Y95.976 E5.13048
+G1 X106.523 Y96.529 E5.16132
+G1 X106.851 Y97.232 E5.19865
+G1 X107.102 Y97.964 E5.23587
+G1 X107.272 Y98.692 E5.27184
+G1 X107.360 Y99.354 E5.30395
+G1 X107.387 Y100.129 E5.34126
+G1 X107.336 Y100.876 E5.37723
+G1 X107.227 Y101.537 E5.40947
+G1 X107.067 Y102.158 E5.44031
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51484
+G1 X106.051 Y104.240 E5.55216
+G1 X105.662 Y104.747 E5.58291
+G1 X105.132 Y105.315 E5.62025
+G1 X104.569 Y105.807 E5.65622
+G1 X104.024 Y106.197 E5.68846
+G1 X103.471 Y106.523 E5.71930
+G1 X102.768 Y106.851 E5.75663
+G1 X102.036 Y107.102 E5.79385
+G1 X101.308 Y107.272 E5.82982
+G1 X100.646 Y107.360 E5.86193
+G1 X99.871 Y107.387 E5.89924
+G1 X99.124 Y107.336 E5.93521
+G1 X98.466 Y107.228 E5.96732
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03549
+G1 X96.418 Y106.462 E6.07284
+G1 X95.783 Y106.067 E6.10881
+G1 X95.252 Y105.661 E6.14092
+G1 X94.685 Y105.132 E6.17823
+G1 X94.193 Y104.569 E6.21420
+G1 X93.804 Y104.026 E6.24631
+G1 X93.415 Y103.352 E6.28374
+G1 X93.150 Y102.770 E6.31448
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F1016
+G1 X92.526 Y102.143 E6.34989
+G1 X92.343 Y101.350 E6.38904
+G1 X92.246 Y100.570 E6.42685
+G1 X92.226 Y99.865 E6.46077
+G1 X92.280 Y99.080 E6.49862
+G1 X92.395 Y98.384 E6.53252
+G1 X92.606 Y97.597 E6.57171
+G1 X92.886 Y96.863 E6.60952
+G1 X93.200 Y96.231 E6.64342
+G1 X93.631 Y95.541 E6.68260
+G1 X94.133 Y94.899 E6.72179
+G1 X94.599 Y94.408 E6.75433
+G1 X95.192 Y93.891 E6.79219
+G1 X95.765 Y93.480 E6.82610
+G1 X96.446 Y93.085 E6.86395
+G1 X97.087 Y92.792 E6.89785
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96960
+G1 X99.323 Y92.255 E7.00880
+G1 X100.108 Y92.226 E7.04661
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11974
+G1 X102.272 Y92.565 E7.15227
+G1 X103.038 Y92.843 E7.19146
+G1 X103.769 Y93.200 E7.23061
+G1 X104.437 Y93.616 E7.26842
+G1 X104.997 Y94.044 E7.30232
+G1 X105.593 Y94.599 E7.34151
+G1 X106.109 Y95.192 E7.37932
+G1 X106.521 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44584
+G1 X107.209 Y97.088 E7.48503
+G1 X107.474 Y97.857 E7.52418
+G1 X107.652 Y98.623 E7.56199
+G1 X107.745 Y99.322 E7.59589
+G1 X107.774 Y100.136 E7.63508
+G1 X107.720 Y100.920 E7.67289
+G1 X107.605 Y101.617 E7.70684
+G1 X107.435 Y102.272 E7.73941
+G1 X107.157 Y103.038 E7.77859
+G1 X106.800 Y103.769 E7.81774
+G1 X106.368 Y104.460 E7.85692
+G1 X105.956 Y104.997 E7.88945
+G1 X105.401 Y105.593 E7.92865
+G1 X104.808 Y106.109 E7.96646
+G1 X104.234 Y106.521 E8.00041
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07216
+G1 X102.143 Y107.474 E8.11131
+G1 X101.377 Y107.652 E8.14913
+G1 X100.678 Y107.745 E8.18303
+G1 X99.864 Y107.774 E8.22222
+G1 X99.080 Y107.720 E8.26003
+G1 X98.384 Y107.605 E8.29393
+G1 X97.597 Y107.394 E8.33316
+G1 X96.963 Y107.157 E8.36569
+G1 X96.231 Y106.800 E8.40488
+G1 X95.563 Y106.384 E8.44269
+G1 X95.003 Y105.956 E8.47660
+G1 X94.407 Y105.401 E8.51578
+G1 X93.891 Y104.808 E8.55360
+G1 X93.480 Y104.235 E8.58750
+G1 X93.072 Y103.529 E8.62673
+G1 X92.792 Y102.913 E8.65925
+G1 X92.603 Y102.366 E8.68708
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F1016
+G1 X98.306 Y106.486 E9.02901
+G1 X98.608 Y106.567 E9.04408
+G1 X99.203 Y106.665 E9.07304
+G1 X99.882 Y106.712 E9.10579
+G1 X100.589 Y106.687 E9.13984
+G1 X101.186 Y106.607 E9.16880
+G1 X101.849 Y106.453 E9.20154
+G1 X102.515 Y106.224 E9.23539
+G1 X103.157 Y105.925 E9.26945
+G1 X103.655 Y105.631 E9.29729
+G1 X104.149 Y105.277 E9.32652
+G1 X104.743 Y104.743 E9.36493
+G1 X95.256 Y95.256 E10.01023
+G1 X95.851 Y94.723 E10.04864
+G1 X96.341 Y94.372 E10.07766
+G1 X96.934 Y94.028 E10.11060
+G1 X97.481 Y93.777 E10.13957
+G1 X98.155 Y93.545 E10.17384
+G1 X98.714 Y93.411 E10.20147
+G1 X99.416 Y93.313 E10.23558
+G1 X100.096 Y93.288 E10.26832
+G1 X100.697 Y93.323 E10.29729
+G1 X101.401 Y93.435 E10.33156
+G1 X101.690 Y93.509 E10.34589
+G1 X106.722 Y98.542 E10.68820
+G1 X106.778 Y101.178 F7800.000
+G1 F1016
+G1 X94.719 Y104.409 E11.28866
+G1 X93.222 Y98.822 F7800.000
+G1 F1016
+G1 X105.281 Y95.591 E11.88912
+G1 X104.623 Y105.094 F7800.000
+G1 F1016
+G1 X106.467 Y98.212 E12.23177
+G1 X106.224 Y97.485 E12.26864
+G1 X105.925 Y96.843 E12.30270
+G1 X105.631 Y96.345 E12.33054
+G1 X105.277 Y95.851 E12.35977
+G1 X104.830 Y95.338 E12.39252
+G1 X104.312 Y94.855 E12.42657
+G1 X103.833 Y94.489 E12.45553
+G1 X103.255 Y94.129 E12.48827
+G1 X102.623 Y93.821 E12.52212
+G1 X101.957 Y93.579 E12.55618
+G1 X101.736 Y93.521 E12.56718
+G1 X98.265 Y106.475 E13.21219
+G1 X97.920 Y106.383 E13.22936
+G1 X97.382 Y106.182 E13.25699
+G1 X96.745 Y105.871 E13.29110
+G1 X96.167 Y105.511 E13.32385
+G1 X95.688 Y105.145 E13.35281
+G1 X95.170 Y104.662 E13.38686
+G1 X94.723 Y104.149 E13.41960
+G1 X94.372 Y103.660 E13.44857
+G1 X94.016 Y103.043 E13.48284
+G1 X93.778 Y102.520 E13.51047
+G1 X93.547 Y101.850 E13.54453
+G1 X93.533 Y101.787 E13.54764
+G1 X95.377 Y94.906 E13.89027
+G1 E11.89027 F2400.00000
+G92 E0
+G1 X149.137 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1016
+G1 X157.030 Y100.996 E2.37961
+G1 X157.030 Y114.004 E3.00523
+G1 X149.137 Y114.004 E3.38485
+G1 X149.137 Y101.056 E4.00758
+G1 X148.752 Y100.611 F7800.000
+G1 F1016
+G1 X157.416 Y100.611 E4.42429
+G1 X157.416 Y114.389 E5.08700
+G1 X148.752 Y114.389 E5.50371
+G1 X148.752 Y100.671 E6.16353
+G1 X148.366 Y100.225 F7800.000
+G1 F1016
+G1 X157.801 Y100.225 E6.61734
+G1 X157.801 Y114.775 E7.31714
+G1 X148.366 Y114.775 E7.77094
+G1 X148.366 Y100.285 E8.46786
+G1 X148.744 Y100.355 F7800.000
+G1 X149.253 Y105.198
+G1 F1016
+G1 X155.342 Y103.567 E8.77103
+G1 X155.342 Y102.825 F7800.000
+G1 F1016
+G1 X153.802 Y101.285 E8.87575
+G1 X149.427 Y101.285 E9.08619
+G1 X149.427 Y105.090 E9.26919
+G1 X155.168 Y110.832 E9.65971
+G1 X155.168 Y113.715 E9.79837
+G1 X149.871 Y113.715 E10.05315
+G1 X149.253 Y113.097 E10.09517
+G1 X150.125 Y113.888 F7800.000
+G1 F1016
+G1 X153.548 Y101.112 E10.73133
+G1 X155.380 Y101.903 F7800.000
+G1 F1016
+G1 X155.998 Y101.285 E10.77398
+G1 X156.552 Y101.285 E10.80099
+G1 X155.554 Y102.283 E10.86985
+G1 X155.554 Y102.837 E10.89686
+G1 X156.741 Y101.649 E10.97881
+G1 X156.741 Y102.203 E11.00581
+G1 X155.554 Y103.390 E11.08776
+G1 X155.554 Y103.943 E11.11476
+G1 X156.741 Y102.756 E11.19671
+G1 X156.741 Y103.309 E11.22372
+G1 X155.554 Y104.497 E11.30566
+G1 X155.554 Y105.050 E11.33267
+G1 X156.741 Y103.863 E11.41462
+G1 X156.741 Y104.416 E11.44162
+G1 X155.554 Y105.603 E11.52357
+G1 X155.554 Y106.157 E11.55057
+G1 X156.741 Y104.970 E11.63252
+G1 X156.741 Y105.523 E11.65953
+G1 X155.554 Y106.710 E11.74147
+G1 X155.554 Y107.264 E11.76848
+G1 X156.741 Y106.076 E11.85043
+G1 X156.741 Y106.630 E11.87743
+G1 X155.554 Y107.817 E11.95938
+G1 X155.554 Y108.370 E11.98638
+G1 X156.741 Y107.183 E12.06833
+G1 X156.741 Y107.736 E12.09534
+G1 X155.554 Y108.924 E12.17728
+G1 X155.554 Y109.477 E12.20429
+G1 X156.741 Y108.290 E12.28624
+G1 X156.741 Y108.843 E12.31324
+G1 X155.554 Y110.030 E12.39519
+G1 X155.554 Y110.584 E12.42219
+G1 X156.741 Y109.396 E12.50414
+G1 X156.741 Y109.950 E12.53115
+G1 X155.554 Y111.137 E12.61309
+G1 X155.554 Y111.690 E12.64010
+G1 X156.741 Y110.503 E12.72205
+G1 X156.741 Y111.057 E12.74905
+G1 X155.554 Y112.244 E12.83100
+G1 X155.554 Y112.797 E12.85800
+G1 X156.741 Y111.610 E12.93995
+G1 X156.741 Y112.163 E12.96696
+G1 X155.554 Y113.351 E13.04890
+G1 X155.554 Y113.715 E13.06667
+G1 X155.743 Y113.715 E13.07591
+G1 X156.741 Y112.717 E13.14478
+G1 X156.741 Y113.270 E13.17179
+G1 X156.123 Y113.888 E13.21444
+G1 X155.342 Y109.555 F7800.000
+G1 F1016
+G1 X149.253 Y111.186 E13.51761
+G1 Z12.350 F7800.000
+G1 E11.51761 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1012
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.881 E2.10622
+G1 X93.047 Y99.167 E2.14068
+G1 X93.150 Y98.547 E2.17090
+G1 X93.334 Y97.855 E2.20532
+G1 X93.553 Y97.267 E2.23550
+G1 X93.876 Y96.605 E2.27095
+G1 X94.252 Y96.000 E2.30521
+G1 X94.634 Y95.501 E2.33539
+G1 X95.139 Y94.960 E2.37102
+G1 X95.590 Y94.561 E2.39998
+G1 X96.187 Y94.127 E2.43547
+G1 X96.803 Y93.770 E2.46973
+G1 X97.374 Y93.509 E2.49991
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.60000
+G1 X100.102 Y92.998 E2.63425
+G1 X100.729 Y93.035 E2.66444
+G1 X101.457 Y93.151 E2.69989
+G1 X102.145 Y93.334 E2.73414
+G1 X102.733 Y93.553 E2.76432
+G1 X103.395 Y93.876 E2.79977
+G1 X104.000 Y94.252 E2.83403
+G1 X104.499 Y94.634 E2.86421
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96426
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02893
+G1 X106.726 Y98.051 E3.06319
+G1 X106.873 Y98.660 E3.09337
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19321
+G1 X106.849 Y101.460 E3.22889
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32856
+G1 X105.736 Y104.017 E3.36385
+G1 X105.298 Y104.579 E3.39811
+G1 X104.867 Y105.035 E3.42829
+G1 X104.308 Y105.521 E3.46391
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55776
+G1 X101.949 Y106.726 E3.59201
+G1 X101.340 Y106.873 E3.62220
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69307
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75750
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85739
+G1 X95.983 Y105.736 E3.89268
+G1 X95.421 Y105.298 E3.92693
+G1 X94.962 Y104.864 E3.95732
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.813 E4.02195
+G1 X93.770 Y103.197 E4.05620
+G1 X93.509 Y102.626 E4.08638
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1012
+G1 X92.898 Y102.037 E4.11989
+G1 X92.724 Y101.283 E4.15708
+G1 X92.629 Y100.513 E4.19441
+G1 X92.612 Y99.873 E4.22517
+G1 X92.664 Y99.122 E4.26140
+G1 X92.772 Y98.465 E4.29340
+G1 X92.966 Y97.738 E4.32960
+G1 X93.198 Y97.115 E4.36158
+G1 X93.538 Y96.418 E4.39890
+G1 X93.935 Y95.780 E4.43500
+G1 X94.339 Y95.252 E4.46698
+G1 X94.869 Y94.683 E4.50440
+G1 X95.348 Y94.260 E4.53515
+G1 X95.976 Y93.803 E4.57249
+G1 X96.626 Y93.427 E4.60859
+G1 X97.230 Y93.150 E4.64057
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70874
+G1 X99.356 Y92.640 E4.74609
+G1 X100.107 Y92.612 E4.78219
+G1 X100.770 Y92.652 E4.81416
+G1 X101.537 Y92.773 E4.85148
+G1 X102.262 Y92.966 E4.88758
+G1 X102.885 Y93.198 E4.91956
+G1 X103.582 Y93.538 E4.95688
+G1 X104.220 Y93.935 E4.99298
+G1 X104.748 Y94.339 E5.02496
+G1 X105.315 Y94.867 E5.06225
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13045
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.233 E5.19867
+G1 X107.096 Y97.942 E5.23477
+G1 X107.253 Y98.588 E5.26675
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.539 E5.40957
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47764
+G1 X106.462 Y103.582 E5.51484
+G1 X106.052 Y104.238 E5.55206
+G1 X105.591 Y104.830 E5.58816
+G1 X105.134 Y105.314 E5.62013
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68843
+G1 X103.471 Y106.523 E5.71931
+G1 X102.767 Y106.851 E5.75665
+G1 X102.058 Y107.096 E5.79275
+G1 X101.412 Y107.253 E5.82473
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93010
+G1 X98.464 Y107.227 E5.96742
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03549
+G1 X96.418 Y106.462 E6.07282
+G1 X95.762 Y106.052 E6.11004
+G1 X95.170 Y105.591 E6.14614
+G1 X94.685 Y105.132 E6.17824
+G1 X94.260 Y104.652 E6.20909
+G1 X93.803 Y104.024 E6.24643
+G1 X93.427 Y103.374 E6.28254
+G1 X93.150 Y102.770 E6.31451
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F1012
+G1 X92.526 Y102.143 E6.34990
+G1 X92.343 Y101.350 E6.38904
+G1 X92.244 Y100.541 E6.42822
+G1 X92.226 Y99.865 E6.46076
+G1 X92.280 Y99.077 E6.49875
+G1 X92.395 Y98.384 E6.53253
+G1 X92.598 Y97.621 E6.57051
+G1 X92.843 Y96.963 E6.60429
+G1 X93.200 Y96.231 E6.64347
+G1 X93.617 Y95.561 E6.68142
+G1 X94.044 Y95.003 E6.71519
+G1 X94.600 Y94.407 E6.75441
+G1 X95.106 Y93.959 E6.78694
+G1 X95.766 Y93.480 E6.82614
+G1 X96.448 Y93.084 E6.86408
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00880
+G1 X100.111 Y92.226 E7.04675
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11971
+G1 X102.379 Y92.598 E7.15765
+G1 X103.037 Y92.843 E7.19142
+G1 X103.769 Y93.200 E7.23061
+G1 X104.439 Y93.617 E7.26856
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34150
+G1 X106.127 Y95.214 E7.38069
+G1 X106.520 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44584
+G1 X107.209 Y97.088 E7.48504
+G1 X107.467 Y97.833 E7.52298
+G1 X107.632 Y98.516 E7.55676
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.137 E7.63512
+G1 X107.732 Y100.812 E7.66765
+G1 X107.605 Y101.617 E7.70688
+G1 X107.435 Y102.272 E7.73941
+G1 X107.157 Y103.038 E7.77860
+G1 X106.800 Y103.769 E7.81774
+G1 X106.369 Y104.460 E7.85689
+G1 X105.884 Y105.082 E7.89483
+G1 X105.401 Y105.592 E7.92861
+G1 X104.786 Y106.127 E7.96783
+G1 X104.234 Y106.520 E8.00041
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07218
+G1 X102.167 Y107.467 E8.11012
+G1 X101.484 Y107.632 E8.14389
+G1 X100.678 Y107.745 E8.18307
+G1 X99.863 Y107.774 E8.22226
+G1 X99.188 Y107.732 E8.25479
+G1 X98.384 Y107.605 E8.29397
+G1 X97.597 Y107.394 E8.33316
+G1 X96.963 Y107.157 E8.36569
+G1 X96.231 Y106.800 E8.40488
+G1 X95.540 Y106.369 E8.44403
+G1 X94.918 Y105.884 E8.48197
+G1 X94.407 Y105.401 E8.51579
+G1 X93.959 Y104.894 E8.54836
+G1 X93.480 Y104.234 E8.58755
+G1 X93.084 Y103.552 E8.62550
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68708
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F1012
+G1 X98.306 Y106.486 E9.02902
+G1 X98.604 Y106.566 E9.04388
+G1 X99.304 Y106.677 E9.07794
+G1 X99.877 Y106.712 E9.10557
+G1 X100.585 Y106.687 E9.13963
+G1 X101.285 Y106.589 E9.17364
+G1 X101.868 Y106.448 E9.20248
+G1 X102.514 Y106.224 E9.23535
+G1 X103.157 Y105.925 E9.26946
+G1 X103.656 Y105.630 E9.29736
+G1 X104.129 Y105.293 E9.32525
+G1 X104.744 Y104.744 E9.36493
+G1 X95.257 Y95.257 E10.01023
+G1 X95.771 Y94.786 E10.04374
+G1 X96.345 Y94.370 E10.07785
+G1 X96.936 Y94.027 E10.11072
+G1 X97.481 Y93.777 E10.13956
+G1 X98.155 Y93.545 E10.17383
+G1 X98.714 Y93.411 E10.20146
+G1 X99.416 Y93.313 E10.23557
+G1 X100.099 Y93.288 E10.26844
+G1 X100.697 Y93.323 E10.29728
+G1 X101.397 Y93.434 E10.33133
+G1 X101.693 Y93.513 E10.34610
+G1 X106.727 Y98.546 E10.68846
+G1 X106.776 Y101.178 F7800.000
+G1 F1012
+G1 X94.715 Y104.410 E11.28902
+G1 X93.222 Y98.822 F7800.000
+G1 F1012
+G1 X105.280 Y95.591 E11.88943
+G1 X104.624 Y105.093 F7800.000
+G1 F1012
+G1 X106.467 Y98.213 E12.23203
+G1 X106.448 Y98.132 E12.23602
+G1 X106.224 Y97.486 E12.26889
+G1 X105.925 Y96.843 E12.30300
+G1 X105.630 Y96.344 E12.33089
+G1 X105.293 Y95.871 E12.35879
+G1 X104.829 Y95.337 E12.39286
+G1 X104.312 Y94.855 E12.42686
+G1 X103.835 Y94.491 E12.45570
+G1 X103.255 Y94.129 E12.48857
+G1 X102.619 Y93.819 E12.52262
+G1 X102.057 Y93.610 E12.55146
+G1 X101.735 Y93.524 E12.56747
+G1 X98.265 Y106.475 E13.21234
+G1 X97.920 Y106.383 E13.22951
+G1 X97.382 Y106.182 E13.25714
+G1 X96.746 Y105.871 E13.29120
+G1 X96.149 Y105.498 E13.32504
+G1 X95.610 Y105.078 E13.35791
+G1 X95.170 Y104.663 E13.38702
+G1 X94.786 Y104.229 E13.41486
+G1 X94.370 Y103.655 E13.44897
+G1 X94.027 Y103.064 E13.48184
+G1 X93.777 Y102.519 E13.51067
+G1 X93.533 Y101.787 E13.54777
+G1 X95.377 Y94.903 E13.89057
+G1 E11.89057 F2400.00000
+G92 E0
+G1 X149.343 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X156.592 Y100.996 E2.34865
+G1 X156.592 Y114.004 E2.97427
+G1 X149.343 Y114.004 E3.32292
+G1 X149.343 Y101.056 E3.94565
+G1 X148.957 Y100.611 F7800.000
+G1 F1012
+G1 X156.977 Y100.611 E4.33140
+G1 X156.977 Y114.389 E4.99411
+G1 X148.957 Y114.389 E5.37986
+G1 X148.957 Y100.671 E6.03968
+G1 X148.571 Y100.225 F7800.000
+G1 F1012
+G1 X157.363 Y100.225 E6.46252
+G1 X157.363 Y114.775 E7.16233
+G1 X148.571 Y114.775 E7.58517
+G1 X148.571 Y100.285 E8.28209
+G1 X148.948 Y100.359 F7800.000
+G1 X149.458 Y105.143
+G1 F1012
+G1 X154.903 Y103.684 E8.55320
+G1 X154.903 Y102.386 F7800.000
+G1 F1012
+G1 X153.802 Y101.285 E8.62809
+G1 X149.632 Y101.285 E8.82866
+G1 X149.632 Y105.295 E9.02153
+G1 X154.730 Y110.393 E9.36827
+G1 X154.730 Y113.715 E9.52802
+G1 X149.871 Y113.715 E9.76171
+G1 X149.458 Y113.302 E9.78976
+G1 X150.125 Y113.888 F7800.000
+G1 F1012
+G1 X153.548 Y101.112 E10.42593
+G1 X156.476 Y101.903 F7800.000
+G1 F1012
+G1 X155.858 Y101.285 E10.46859
+G1 X155.305 Y101.285 E10.49559
+G1 X156.303 Y102.283 E10.56447
+G1 X156.303 Y102.837 E10.59147
+G1 X155.115 Y101.649 E10.67342
+G1 X155.115 Y102.203 E10.70043
+G1 X156.303 Y103.390 E10.78237
+G1 X156.303 Y103.943 E10.80938
+G1 X155.115 Y102.756 E10.89132
+G1 X155.115 Y103.310 E10.91833
+G1 X156.303 Y104.497 E11.00028
+G1 X156.303 Y105.050 E11.02728
+G1 X155.115 Y103.863 E11.10923
+G1 X155.115 Y104.416 E11.13624
+G1 X156.303 Y105.604 E11.21818
+G1 X156.303 Y106.157 E11.24519
+G1 X155.115 Y104.970 E11.32713
+G1 X155.115 Y105.523 E11.35414
+G1 X156.303 Y106.710 E11.43609
+G1 X156.303 Y107.264 E11.46309
+G1 X155.115 Y106.076 E11.54504
+G1 X155.115 Y106.630 E11.57205
+G1 X156.303 Y107.817 E11.65399
+G1 X156.303 Y108.370 E11.68100
+G1 X155.115 Y107.183 E11.76294
+G1 X155.115 Y107.736 E11.78995
+G1 X156.303 Y108.924 E11.87190
+G1 X156.303 Y109.477 E11.89890
+G1 X155.115 Y108.290 E11.98085
+G1 X155.115 Y108.843 E12.00786
+G1 X156.303 Y110.030 E12.08980
+G1 X156.303 Y110.584 E12.11681
+G1 X155.115 Y109.397 E12.19875
+G1 X155.115 Y109.950 E12.22576
+G1 X156.303 Y111.137 E12.30771
+G1 X156.303 Y111.691 E12.33471
+G1 X155.115 Y110.503 E12.41666
+G1 X155.115 Y111.057 E12.44367
+G1 X156.303 Y112.244 E12.52561
+G1 X156.303 Y112.797 E12.55262
+G1 X155.115 Y111.610 E12.63456
+G1 X155.115 Y112.163 E12.66157
+G1 X156.303 Y113.351 E12.74352
+G1 X156.303 Y113.715 E12.76127
+G1 X156.113 Y113.715 E12.77052
+G1 X155.115 Y112.717 E12.83939
+G1 X155.115 Y113.270 E12.86640
+G1 X155.733 Y113.888 E12.90904
+G1 X154.903 Y109.672 F7800.000
+G1 F1012
+G1 X149.458 Y111.131 E13.18016
+G1 Z12.650 F7800.000
+G1 E11.18016 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F996
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.878 E2.10639
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.544 E2.17106
+G1 X93.335 Y97.853 E2.20544
+G1 X93.553 Y97.267 E2.23550
+G1 X93.876 Y96.605 E2.27095
+G1 X94.254 Y95.998 E2.30533
+G1 X94.633 Y95.502 E2.33538
+G1 X95.136 Y94.962 E2.37084
+G1 X95.675 Y94.493 E2.40522
+G1 X96.184 Y94.129 E2.43530
+G1 X96.805 Y93.769 E2.46986
+G1 X97.374 Y93.509 E2.49991
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.59999
+G1 X100.105 Y92.998 E2.63438
+G1 X100.728 Y93.035 E2.66443
+G1 X101.456 Y93.151 E2.69988
+G1 X102.147 Y93.335 E2.73427
+G1 X102.733 Y93.553 E2.76432
+G1 X103.395 Y93.876 E2.79977
+G1 X104.002 Y94.254 E2.83416
+G1 X104.498 Y94.633 E2.86421
+G1 X105.038 Y95.136 E2.89966
+G1 X105.507 Y95.675 E2.93404
+G1 X105.873 Y96.187 E2.96430
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02893
+G1 X106.726 Y98.053 E3.06331
+G1 X106.873 Y98.660 E3.09337
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19321
+G1 X106.849 Y101.456 E3.22871
+G1 X106.665 Y102.147 E3.26309
+G1 X106.447 Y102.733 E3.29314
+G1 X106.124 Y103.395 E3.32859
+G1 X105.746 Y104.002 E3.36298
+G1 X105.367 Y104.498 E3.39303
+G1 X104.864 Y105.038 E3.42848
+G1 X104.325 Y105.507 E3.46287
+G1 X103.813 Y105.873 E3.49313
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55775
+G1 X101.947 Y106.726 E3.59214
+G1 X101.340 Y106.873 E3.62219
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69307
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75753
+G1 X97.853 Y106.665 E3.79191
+G1 X97.267 Y106.447 E3.82197
+G1 X96.605 Y106.124 E3.85742
+G1 X95.998 Y105.746 E3.89180
+G1 X95.502 Y105.367 E3.92185
+G1 X94.962 Y104.864 E3.95731
+G1 X94.493 Y104.325 E3.99169
+G1 X94.129 Y103.816 E4.02177
+G1 X93.769 Y103.195 E4.05633
+G1 X93.509 Y102.626 E4.08638
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F996
+G1 X92.898 Y102.037 E4.11989
+G1 X92.724 Y101.283 E4.15708
+G1 X92.629 Y100.513 E4.19441
+G1 X92.612 Y99.871 E4.22528
+G1 X92.652 Y99.230 E4.25616
+G1 X92.773 Y98.463 E4.29350
+G1 X92.967 Y97.736 E4.32973
+G1 X93.198 Y97.115 E4.36158
+G1 X93.538 Y96.418 E4.39889
+G1 X93.936 Y95.778 E4.43513
+G1 X94.339 Y95.252 E4.46697
+G1 X94.868 Y94.685 E4.50429
+G1 X95.436 Y94.190 E4.54052
+G1 X95.974 Y93.804 E4.57238
+G1 X96.628 Y93.426 E4.60872
+G1 X97.230 Y93.150 E4.64057
+G1 X97.966 Y92.897 E4.67799
+G1 X98.588 Y92.748 E4.70874
+G1 X99.356 Y92.640 E4.74608
+G1 X100.109 Y92.612 E4.78232
+G1 X100.770 Y92.652 E4.81416
+G1 X101.537 Y92.773 E4.85148
+G1 X102.264 Y92.967 E4.88771
+G1 X102.885 Y93.198 E4.91956
+G1 X103.582 Y93.538 E4.95687
+G1 X104.222 Y93.936 E4.99311
+G1 X104.748 Y94.339 E5.02495
+G1 X105.315 Y94.868 E5.06227
+G1 X105.810 Y95.436 E5.09850
+G1 X106.197 Y95.976 E5.13048
+G1 X106.523 Y96.529 E5.16132
+G1 X106.851 Y97.233 E5.19867
+G1 X107.097 Y97.945 E5.23490
+G1 X107.252 Y98.588 E5.26674
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.537 E5.40946
+G1 X107.033 Y102.264 E5.44569
+G1 X106.802 Y102.885 E5.47754
+G1 X106.462 Y103.582 E5.51485
+G1 X106.064 Y104.222 E5.55109
+G1 X105.661 Y104.748 E5.58293
+G1 X105.132 Y105.315 E5.62025
+G1 X104.564 Y105.810 E5.65648
+G1 X104.024 Y106.197 E5.68846
+G1 X103.471 Y106.523 E5.71930
+G1 X102.767 Y106.851 E5.75665
+G1 X102.055 Y107.097 E5.79288
+G1 X101.412 Y107.252 E5.82473
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89935
+G1 X99.230 Y107.348 E5.93010
+G1 X98.463 Y107.227 E5.96744
+G1 X97.736 Y107.033 E6.00367
+G1 X97.115 Y106.802 E6.03552
+G1 X96.418 Y106.462 E6.07284
+G1 X95.778 Y106.064 E6.10907
+G1 X95.252 Y105.661 E6.14091
+G1 X94.685 Y105.132 E6.17823
+G1 X94.190 Y104.564 E6.21446
+G1 X93.804 Y104.026 E6.24633
+G1 X93.426 Y103.372 E6.28266
+G1 X93.150 Y102.770 E6.31451
+G1 X92.968 Y102.241 E6.34141
+G1 X92.584 Y102.310 F7800.000
+G1 F996
+G1 X92.526 Y102.143 E6.34989
+G1 X92.343 Y101.350 E6.38903
+G1 X92.244 Y100.541 E6.42822
+G1 X92.226 Y99.864 E6.46080
+G1 X92.268 Y99.188 E6.49337
+G1 X92.395 Y98.383 E6.53257
+G1 X92.599 Y97.618 E6.57064
+G1 X92.843 Y96.963 E6.60428
+G1 X93.200 Y96.231 E6.64347
+G1 X93.619 Y95.559 E6.68155
+G1 X94.044 Y95.003 E6.71519
+G1 X94.599 Y94.407 E6.75437
+G1 X95.196 Y93.887 E6.79245
+G1 X95.765 Y93.480 E6.82610
+G1 X96.451 Y93.083 E6.86421
+G1 X97.087 Y92.792 E6.89785
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00880
+G1 X100.114 Y92.226 E7.04688
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11970
+G1 X102.382 Y92.599 E7.15778
+G1 X103.037 Y92.843 E7.19142
+G1 X103.769 Y93.200 E7.23061
+G1 X104.441 Y93.619 E7.26868
+G1 X104.997 Y94.044 E7.30232
+G1 X105.593 Y94.599 E7.34151
+G1 X106.113 Y95.196 E7.37959
+G1 X106.521 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44584
+G1 X107.209 Y97.088 E7.48503
+G1 X107.467 Y97.836 E7.52311
+G1 X107.632 Y98.516 E7.55675
+G1 X107.745 Y99.322 E7.59593
+G1 X107.774 Y100.137 E7.63512
+G1 X107.732 Y100.812 E7.66765
+G1 X107.605 Y101.617 E7.70684
+G1 X107.401 Y102.382 E7.74492
+G1 X107.157 Y103.037 E7.77856
+G1 X106.800 Y103.769 E7.81774
+G1 X106.381 Y104.441 E7.85582
+G1 X105.956 Y104.997 E7.88946
+G1 X105.401 Y105.593 E7.92865
+G1 X104.804 Y106.113 E7.96673
+G1 X104.234 Y106.521 E8.00041
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07217
+G1 X102.164 Y107.467 E8.11025
+G1 X101.484 Y107.632 E8.14389
+G1 X100.678 Y107.745 E8.18307
+G1 X99.863 Y107.774 E8.22226
+G1 X99.188 Y107.732 E8.25478
+G1 X98.383 Y107.605 E8.29398
+G1 X97.618 Y107.401 E8.33206
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40488
+G1 X95.559 Y106.381 E8.44296
+G1 X95.003 Y105.956 E8.47660
+G1 X94.407 Y105.401 E8.51578
+G1 X93.887 Y104.804 E8.55386
+G1 X93.480 Y104.235 E8.58751
+G1 X93.083 Y103.549 E8.62563
+G1 X92.792 Y102.913 E8.65926
+G1 X92.603 Y102.366 E8.68708
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F996
+G1 X98.307 Y106.487 E9.02906
+G1 X98.604 Y106.566 E9.04384
+G1 X99.304 Y106.677 E9.07794
+G1 X99.877 Y106.712 E9.10557
+G1 X100.585 Y106.687 E9.13964
+G1 X101.285 Y106.589 E9.17365
+G1 X101.865 Y106.449 E9.20236
+G1 X102.514 Y106.224 E9.23536
+G1 X103.157 Y105.925 E9.26946
+G1 X103.655 Y105.631 E9.29731
+G1 X104.145 Y105.280 E9.32628
+G1 X104.743 Y104.743 E9.36493
+G1 X95.257 Y95.257 E10.01017
+G1 X95.855 Y94.720 E10.04882
+G1 X96.341 Y94.372 E10.07756
+G1 X96.938 Y94.026 E10.11078
+G1 X97.481 Y93.777 E10.13949
+G1 X98.155 Y93.545 E10.17377
+G1 X98.714 Y93.411 E10.20140
+G1 X99.416 Y93.313 E10.23550
+G1 X100.101 Y93.288 E10.26850
+G1 X100.697 Y93.323 E10.29721
+G1 X101.396 Y93.434 E10.33126
+G1 X101.693 Y93.513 E10.34604
+G1 X106.727 Y98.546 E10.68840
+G1 X106.776 Y101.178 F7800.000
+G1 F996
+G1 X94.720 Y104.409 E11.28874
+G1 X93.224 Y98.822 F7800.000
+G1 F996
+G1 X105.280 Y95.591 E11.88908
+G1 X104.624 Y105.094 F7800.000
+G1 F996
+G1 X106.467 Y98.212 E12.23171
+G1 X106.224 Y97.486 E12.26855
+G1 X105.925 Y96.843 E12.30265
+G1 X105.631 Y96.345 E12.33050
+G1 X105.280 Y95.855 E12.35948
+G1 X104.829 Y95.337 E12.39247
+G1 X104.312 Y94.855 E12.42653
+G1 X103.837 Y94.492 E12.45523
+G1 X103.255 Y94.129 E12.48823
+G1 X102.619 Y93.819 E12.52228
+G1 X102.059 Y93.611 E12.55099
+G1 X101.735 Y93.524 E12.56713
+G1 X98.265 Y106.476 E13.21202
+G1 X97.941 Y106.389 E13.22816
+G1 X97.381 Y106.181 E13.25687
+G1 X96.745 Y105.871 E13.29092
+G1 X96.163 Y105.508 E13.32392
+G1 X95.688 Y105.145 E13.35263
+G1 X95.171 Y104.663 E13.38668
+G1 X94.720 Y104.145 E13.41968
+G1 X94.372 Y103.659 E13.44842
+G1 X94.026 Y103.062 E13.48164
+G1 X93.777 Y102.519 E13.51035
+G1 X93.547 Y101.850 E13.54436
+G1 X93.533 Y101.787 E13.54746
+G1 X95.376 Y94.906 E13.89009
+G1 E11.89009 F2400.00000
+G92 E0
+G1 X149.548 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X156.153 Y100.996 E2.31769
+G1 X156.153 Y114.004 E2.94331
+G1 X149.548 Y114.004 E3.26100
+G1 X149.548 Y101.056 E3.88373
+G1 X149.162 Y100.611 F7800.000
+G1 F996
+G1 X156.539 Y100.611 E4.23851
+G1 X156.539 Y114.389 E4.90123
+G1 X149.162 Y114.389 E5.25601
+G1 X149.162 Y100.671 E5.91584
+G1 X148.777 Y100.225 F7800.000
+G1 F996
+G1 X156.924 Y100.225 E6.30771
+G1 X156.924 Y114.775 E7.00752
+G1 X148.777 Y114.775 E7.39940
+G1 X148.777 Y100.285 E8.09632
+G1 X149.152 Y100.363 F7800.000
+G1 X153.548 Y101.112
+G1 F996
+G1 X150.125 Y113.888 E8.73248
+G1 X149.664 Y113.507 F7800.000
+G1 F996
+G1 X149.871 Y113.715 E8.74657
+G1 X154.291 Y113.715 E8.95918
+G1 X154.291 Y109.955 E9.14002
+G1 X149.837 Y105.501 E9.44297
+G1 X149.837 Y101.285 E9.64571
+G1 X153.802 Y101.285 E9.83641
+G1 X154.465 Y101.948 E9.88147
+G1 X154.503 Y101.903 F7800.000
+G1 F996
+G1 X155.121 Y101.285 E9.92412
+G1 X155.674 Y101.285 E9.95113
+G1 X154.677 Y102.283 E10.01999
+G1 X154.677 Y102.837 E10.04700
+G1 X155.864 Y101.649 E10.12894
+G1 X155.864 Y102.203 E10.15595
+G1 X154.677 Y103.390 E10.23790
+G1 X154.677 Y103.943 E10.26490
+G1 X155.864 Y102.756 E10.34685
+G1 X155.864 Y103.309 E10.37386
+G1 X154.677 Y104.497 E10.45580
+G1 X154.677 Y105.050 E10.48281
+G1 X155.864 Y103.863 E10.56475
+G1 X155.864 Y104.416 E10.59176
+G1 X154.677 Y105.603 E10.67371
+G1 X154.677 Y106.157 E10.70071
+G1 X155.864 Y104.970 E10.78266
+G1 X155.864 Y105.523 E10.80967
+G1 X154.677 Y106.710 E10.89161
+G1 X154.677 Y107.264 E10.91862
+G1 X155.864 Y106.076 E11.00056
+G1 X155.864 Y106.630 E11.02757
+G1 X154.677 Y107.817 E11.10952
+G1 X154.677 Y108.370 E11.13652
+G1 X155.864 Y107.183 E11.21847
+G1 X155.864 Y107.736 E11.24548
+G1 X154.677 Y108.924 E11.32742
+G1 X154.677 Y109.477 E11.35443
+G1 X155.864 Y108.290 E11.43638
+G1 X155.864 Y108.843 E11.46338
+G1 X154.677 Y110.030 E11.54533
+G1 X154.677 Y110.584 E11.57233
+G1 X155.864 Y109.396 E11.65428
+G1 X155.864 Y109.950 E11.68129
+G1 X154.677 Y111.137 E11.76323
+G1 X154.677 Y111.690 E11.79024
+G1 X155.864 Y110.503 E11.87219
+G1 X155.864 Y111.057 E11.89919
+G1 X154.677 Y112.244 E11.98114
+G1 X154.677 Y112.797 E12.00814
+G1 X155.864 Y111.610 E12.09009
+G1 X155.864 Y112.163 E12.11710
+G1 X154.677 Y113.351 E12.19904
+G1 X154.677 Y113.715 E12.21681
+G1 X154.866 Y113.715 E12.22605
+G1 X155.864 Y112.717 E12.29492
+G1 X155.864 Y113.270 E12.32193
+G1 X155.246 Y113.888 E12.36459
+G1 X154.465 Y109.790 F7800.000
+G1 F996
+G1 X149.664 Y111.076 E12.60364
+G1 X149.664 Y105.088 F7800.000
+G1 F996
+G1 X154.465 Y103.802 E12.84270
+G1 Z12.950 F7800.000
+G1 E10.84270 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F963
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.878 E2.10639
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.544 E2.17103
+G1 X93.341 Y97.832 E2.20649
+G1 X93.552 Y97.268 E2.23546
+G1 X93.876 Y96.605 E2.27094
+G1 X94.255 Y95.996 E2.30546
+G1 X94.633 Y95.502 E2.33538
+G1 X95.139 Y94.960 E2.37102
+G1 X95.590 Y94.561 E2.39998
+G1 X96.187 Y94.127 E2.43547
+G1 X96.808 Y93.767 E2.46998
+G1 X97.373 Y93.509 E2.49990
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.59999
+G1 X100.107 Y92.998 E2.63451
+G1 X100.728 Y93.035 E2.66443
+G1 X101.456 Y93.151 E2.69988
+G1 X102.150 Y93.336 E2.73439
+G1 X102.733 Y93.553 E2.76432
+G1 X103.395 Y93.876 E2.79974
+G1 X104.020 Y94.266 E2.83520
+G1 X104.498 Y94.633 E2.86417
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96427
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02893
+G1 X106.727 Y98.056 E3.06344
+G1 X106.873 Y98.660 E3.09336
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19322
+G1 X106.849 Y101.456 E3.22870
+G1 X106.664 Y102.150 E3.26322
+G1 X106.447 Y102.733 E3.29314
+G1 X106.124 Y103.395 E3.32857
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42845
+G1 X104.308 Y105.521 E3.46392
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55775
+G1 X101.944 Y106.727 E3.59227
+G1 X101.340 Y106.873 E3.62219
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69308
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75750
+G1 X97.832 Y106.659 E3.79296
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85742
+G1 X95.996 Y105.745 E3.89193
+G1 X95.502 Y105.367 E3.92185
+G1 X94.960 Y104.861 E3.95749
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.813 E4.02194
+G1 X93.767 Y103.192 E4.05645
+G1 X93.509 Y102.627 E4.08638
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F963
+G1 X92.898 Y102.037 E4.11989
+G1 X92.724 Y101.283 E4.15709
+G1 X92.629 Y100.513 E4.19441
+G1 X92.612 Y99.871 E4.22528
+G1 X92.652 Y99.230 E4.25616
+G1 X92.773 Y98.464 E4.29348
+G1 X92.974 Y97.714 E4.33081
+G1 X93.198 Y97.115 E4.36155
+G1 X93.538 Y96.418 E4.39890
+G1 X93.938 Y95.776 E4.43526
+G1 X94.339 Y95.252 E4.46697
+G1 X94.869 Y94.683 E4.50440
+G1 X95.348 Y94.260 E4.53515
+G1 X95.976 Y93.803 E4.57249
+G1 X96.631 Y93.425 E4.60885
+G1 X97.230 Y93.150 E4.64057
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70874
+G1 X99.356 Y92.640 E4.74609
+G1 X100.112 Y92.612 E4.78245
+G1 X100.770 Y92.652 E4.81416
+G1 X101.536 Y92.773 E4.85148
+G1 X102.267 Y92.968 E4.88784
+G1 X102.885 Y93.198 E4.91956
+G1 X103.582 Y93.538 E4.95686
+G1 X104.240 Y93.949 E4.99419
+G1 X104.747 Y94.338 E5.02493
+G1 X105.315 Y94.867 E5.06226
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13046
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.233 E5.19867
+G1 X107.098 Y97.947 E5.23503
+G1 X107.252 Y98.588 E5.26675
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.536 E5.40946
+G1 X107.032 Y102.267 E5.44582
+G1 X106.802 Y102.885 E5.47754
+G1 X106.462 Y103.582 E5.51484
+G1 X106.051 Y104.240 E5.55217
+G1 X105.662 Y104.747 E5.58291
+G1 X105.133 Y105.315 E5.62024
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68844
+G1 X103.471 Y106.523 E5.71931
+G1 X102.767 Y106.851 E5.75665
+G1 X102.053 Y107.098 E5.79301
+G1 X101.412 Y107.252 E5.82473
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89936
+G1 X99.230 Y107.348 E5.93010
+G1 X98.464 Y107.227 E5.96743
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03550
+G1 X96.418 Y106.462 E6.07284
+G1 X95.776 Y106.062 E6.10920
+G1 X95.252 Y105.661 E6.14092
+G1 X94.683 Y105.131 E6.17835
+G1 X94.260 Y104.652 E6.20909
+G1 X93.803 Y104.024 E6.24643
+G1 X93.425 Y103.369 E6.28280
+G1 X93.150 Y102.770 E6.31451
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F963
+G1 X92.526 Y102.143 E6.34990
+G1 X92.343 Y101.350 E6.38904
+G1 X92.244 Y100.541 E6.42823
+G1 X92.226 Y99.864 E6.46080
+G1 X92.268 Y99.188 E6.49338
+G1 X92.395 Y98.384 E6.53257
+G1 X92.606 Y97.597 E6.57175
+G1 X92.843 Y96.963 E6.60428
+G1 X93.200 Y96.231 E6.64347
+G1 X93.620 Y95.556 E6.68169
+G1 X94.044 Y95.003 E6.71519
+G1 X94.600 Y94.407 E6.75442
+G1 X95.106 Y93.959 E6.78695
+G1 X95.766 Y93.480 E6.82614
+G1 X96.453 Y93.082 E6.86435
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.323 Y92.255 E7.00881
+G1 X100.116 Y92.226 E7.04702
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11971
+G1 X102.384 Y92.600 E7.15792
+G1 X103.037 Y92.843 E7.19143
+G1 X103.769 Y93.200 E7.23061
+G1 X104.460 Y93.632 E7.26979
+G1 X104.997 Y94.044 E7.30232
+G1 X105.593 Y94.599 E7.34151
+G1 X106.127 Y95.214 E7.38070
+G1 X106.520 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44585
+G1 X107.209 Y97.088 E7.48504
+G1 X107.468 Y97.839 E7.52325
+G1 X107.632 Y98.516 E7.55676
+G1 X107.745 Y99.322 E7.59594
+G1 X107.774 Y100.137 E7.63513
+G1 X107.732 Y100.812 E7.66765
+G1 X107.605 Y101.617 E7.70685
+G1 X107.400 Y102.384 E7.74506
+G1 X107.157 Y103.037 E7.77856
+G1 X106.800 Y103.769 E7.81774
+G1 X106.368 Y104.460 E7.85693
+G1 X105.956 Y104.997 E7.88946
+G1 X105.401 Y105.593 E7.92865
+G1 X104.786 Y106.127 E7.96784
+G1 X104.234 Y106.520 E8.00041
+G1 X103.651 Y106.864 E8.03299
+G1 X102.912 Y107.209 E8.07218
+G1 X102.161 Y107.468 E8.11039
+G1 X101.484 Y107.632 E8.14390
+G1 X100.678 Y107.745 E8.18308
+G1 X99.863 Y107.774 E8.22226
+G1 X99.188 Y107.732 E8.25479
+G1 X98.384 Y107.605 E8.29398
+G1 X97.597 Y107.394 E8.33317
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40489
+G1 X95.556 Y106.380 E8.44310
+G1 X95.003 Y105.956 E8.47661
+G1 X94.407 Y105.400 E8.51583
+G1 X93.959 Y104.894 E8.54836
+G1 X93.480 Y104.234 E8.58756
+G1 X93.082 Y103.547 E8.62577
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68709
+G1 X92.697 Y102.175 F7800.000
+G1 X93.279 Y101.459
+G1 F963
+G1 X98.306 Y106.486 E9.02902
+G1 X98.604 Y106.566 E9.04388
+G1 X99.304 Y106.677 E9.07795
+G1 X99.877 Y106.712 E9.10558
+G1 X100.585 Y106.687 E9.13964
+G1 X101.285 Y106.589 E9.17366
+G1 X101.863 Y106.449 E9.20224
+G1 X102.514 Y106.224 E9.23536
+G1 X103.157 Y105.925 E9.26946
+G1 X103.656 Y105.630 E9.29736
+G1 X104.129 Y105.293 E9.32526
+G1 X104.743 Y104.743 E9.36494
+G1 X95.257 Y95.257 E10.01017
+G1 X95.771 Y94.786 E10.04368
+G1 X96.345 Y94.370 E10.07778
+G1 X96.941 Y94.025 E10.11091
+G1 X97.481 Y93.778 E10.13949
+G1 X98.155 Y93.545 E10.17378
+G1 X98.714 Y93.411 E10.20140
+G1 X99.416 Y93.313 E10.23550
+G1 X100.104 Y93.288 E10.26863
+G1 X100.697 Y93.323 E10.29721
+G1 X101.396 Y93.434 E10.33126
+G1 X101.693 Y93.513 E10.34605
+G1 X106.727 Y98.547 E10.68841
+G1 X106.776 Y101.178 F7800.000
+G1 F963
+G1 X94.715 Y104.410 E11.28897
+G1 X93.224 Y98.822 F7800.000
+G1 F963
+G1 X105.280 Y95.591 E11.88927
+G1 X104.624 Y105.093 F7800.000
+G1 F963
+G1 X106.467 Y98.212 E12.23189
+G1 X106.449 Y98.137 E12.23561
+G1 X106.224 Y97.486 E12.26874
+G1 X105.925 Y96.843 E12.30283
+G1 X105.630 Y96.344 E12.33073
+G1 X105.293 Y95.871 E12.35863
+G1 X104.829 Y95.337 E12.39270
+G1 X104.311 Y94.854 E12.42676
+G1 X103.855 Y94.504 E12.45439
+G1 X103.254 Y94.129 E12.48845
+G1 X102.619 Y93.819 E12.52247
+G1 X102.062 Y93.612 E12.55105
+G1 X101.735 Y93.524 E12.56731
+G1 X98.265 Y106.475 E13.21218
+G1 X97.920 Y106.383 E13.22934
+G1 X97.382 Y106.182 E13.25697
+G1 X96.745 Y105.871 E13.29107
+G1 X96.160 Y105.506 E13.32420
+G1 X95.689 Y105.145 E13.35277
+G1 X95.167 Y104.659 E13.38706
+G1 X94.786 Y104.229 E13.41469
+G1 X94.370 Y103.655 E13.44879
+G1 X94.025 Y103.059 E13.48192
+G1 X93.778 Y102.519 E13.51050
+G1 X93.533 Y101.787 E13.54760
+G1 X95.377 Y94.903 E13.89040
+G1 E11.89040 F2400.00000
+G92 E0
+G1 X149.753 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X155.715 Y100.996 E2.28673
+G1 X155.715 Y114.004 E2.91235
+G1 X149.753 Y114.004 E3.19907
+G1 X149.753 Y101.056 E3.82181
+G1 X149.368 Y100.611 F7800.000
+G1 F963
+G1 X156.100 Y100.611 E4.14563
+G1 X156.100 Y114.389 E4.80834
+G1 X149.368 Y114.389 E5.13216
+G1 X149.368 Y100.671 E5.79199
+G1 X148.982 Y100.225 F7800.000
+G1 F963
+G1 X156.486 Y100.225 E6.15290
+G1 X156.486 Y114.775 E6.85271
+G1 X148.982 Y114.775 E7.21362
+G1 X148.982 Y100.285 E7.91054
+G1 X149.356 Y100.368 F7800.000
+G1 X153.548 Y101.112
+G1 F963
+G1 X150.125 Y113.888 E8.54671
+G1 X149.869 Y111.021 F7800.000
+G1 F963
+G1 X154.026 Y109.907 E8.75371
+G1 X154.026 Y109.690 F7800.000
+G1 F963
+G1 X150.042 Y105.706 E9.02468
+G1 X150.042 Y101.285 E9.23729
+G1 X153.802 Y101.285 E9.41812
+G1 X154.026 Y101.509 E9.43336
+G1 X155.599 Y101.903 F7800.000
+G1 F963
+G1 X154.981 Y101.285 E9.47602
+G1 X154.428 Y101.285 E9.50302
+G1 X155.426 Y102.283 E9.57190
+G1 X155.426 Y102.837 E9.59890
+G1 X154.238 Y101.649 E9.68085
+G1 X154.238 Y102.203 E9.70785
+G1 X155.426 Y103.390 E9.78980
+G1 X155.426 Y103.943 E9.81681
+G1 X154.238 Y102.756 E9.89875
+G1 X154.238 Y103.310 E9.92576
+G1 X155.426 Y104.497 E10.00771
+G1 X155.426 Y105.050 E10.03471
+G1 X154.238 Y103.863 E10.11666
+G1 X154.238 Y104.416 E10.14367
+G1 X155.426 Y105.604 E10.22561
+G1 X155.426 Y106.157 E10.25262
+G1 X154.238 Y104.970 E10.33456
+G1 X154.238 Y105.523 E10.36157
+G1 X155.426 Y106.710 E10.44352
+G1 X155.426 Y107.264 E10.47052
+G1 X154.238 Y106.076 E10.55247
+G1 X154.238 Y106.630 E10.57948
+G1 X155.426 Y107.817 E10.66142
+G1 X155.426 Y108.370 E10.68843
+G1 X154.238 Y107.183 E10.77037
+G1 X154.238 Y107.736 E10.79738
+G1 X155.426 Y108.924 E10.87933
+G1 X155.426 Y109.477 E10.90633
+G1 X154.238 Y108.290 E10.98828
+G1 X154.238 Y108.843 E11.01529
+G1 X155.426 Y110.030 E11.09723
+G1 X155.426 Y110.584 E11.12424
+G1 X154.238 Y109.397 E11.20618
+G1 X154.238 Y109.950 E11.23319
+G1 X155.426 Y111.137 E11.31514
+G1 X155.426 Y111.691 E11.34214
+G1 X154.238 Y110.503 E11.42409
+G1 X154.238 Y111.057 E11.45110
+G1 X155.426 Y112.244 E11.53304
+G1 X155.426 Y112.797 E11.56005
+G1 X154.238 Y111.610 E11.64199
+G1 X154.238 Y112.163 E11.66900
+G1 X155.426 Y113.351 E11.75095
+G1 X155.426 Y113.715 E11.76870
+G1 X155.236 Y113.715 E11.77795
+G1 X154.238 Y112.717 E11.84682
+G1 X154.238 Y113.270 E11.87383
+G1 X154.856 Y113.888 E11.91647
+G1 X154.026 Y103.919 F7800.000
+G1 F963
+G1 X149.869 Y105.033 E12.12348
+G1 Z13.250 F7800.000
+G1 E10.12348 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F897
+G1 X93.106 Y101.228 E2.04117
+G1 X93.024 Y100.614 E2.07096
+G1 X92.999 Y99.873 E2.10660
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.544 E2.17103
+G1 X93.341 Y97.832 E2.20649
+G1 X93.552 Y97.268 E2.23546
+G1 X93.876 Y96.605 E2.27094
+G1 X94.257 Y95.994 E2.30558
+G1 X94.633 Y95.502 E2.33538
+G1 X95.136 Y94.963 E2.37083
+G1 X95.679 Y94.489 E2.40547
+G1 X96.183 Y94.129 E2.43529
+G1 X96.810 Y93.766 E2.47011
+G1 X97.373 Y93.509 E2.49990
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.59999
+G1 X100.110 Y92.998 E2.63463
+G1 X100.728 Y93.035 E2.66442
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.395 Y93.876 E2.79977
+G1 X104.006 Y94.257 E2.83441
+G1 X104.498 Y94.633 E2.86420
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96427
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19322
+G1 X106.849 Y101.460 E3.22889
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32857
+G1 X105.736 Y104.017 E3.36384
+G1 X105.293 Y104.585 E3.39849
+G1 X104.867 Y105.035 E3.42828
+G1 X104.308 Y105.521 E3.46392
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55775
+G1 X101.942 Y106.728 E3.59239
+G1 X101.340 Y106.873 E3.62218
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69308
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75750
+G1 X97.832 Y106.659 E3.79297
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85739
+G1 X95.983 Y105.736 E3.89267
+G1 X95.415 Y105.293 E3.92731
+G1 X94.965 Y104.867 E3.95712
+G1 X94.489 Y104.321 E3.99195
+G1 X94.129 Y103.817 E4.02176
+G1 X93.766 Y103.190 E4.05658
+G1 X93.509 Y102.627 E4.08637
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F897
+G1 X92.898 Y102.036 E4.11990
+G1 X92.726 Y101.297 E4.15640
+G1 X92.640 Y100.646 E4.18798
+G1 X92.612 Y99.868 E4.22541
+G1 X92.652 Y99.230 E4.25616
+G1 X92.773 Y98.464 E4.29348
+G1 X92.974 Y97.714 E4.33081
+G1 X93.198 Y97.115 E4.36155
+G1 X93.538 Y96.418 E4.39889
+G1 X93.939 Y95.774 E4.43539
+G1 X94.338 Y95.252 E4.46697
+G1 X94.868 Y94.685 E4.50429
+G1 X95.440 Y94.187 E4.54078
+G1 X95.974 Y93.804 E4.57238
+G1 X96.633 Y93.423 E4.60898
+G1 X97.230 Y93.150 E4.64056
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70874
+G1 X99.356 Y92.640 E4.74608
+G1 X100.115 Y92.612 E4.78258
+G1 X100.770 Y92.652 E4.81416
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88234
+G1 X102.887 Y93.199 E4.91966
+G1 X103.582 Y93.538 E4.95687
+G1 X104.226 Y93.939 E4.99337
+G1 X104.748 Y94.338 E5.02495
+G1 X105.315 Y94.867 E5.06226
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13046
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.232 E5.19865
+G1 X107.103 Y97.966 E5.23598
+G1 X107.252 Y98.588 E5.26673
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34138
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.539 E5.40957
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47765
+G1 X106.462 Y103.582 E5.51484
+G1 X106.052 Y104.238 E5.55205
+G1 X105.586 Y104.836 E5.58855
+G1 X105.134 Y105.313 E5.62013
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68844
+G1 X103.471 Y106.523 E5.71931
+G1 X102.768 Y106.851 E5.75665
+G1 X102.050 Y107.098 E5.79314
+G1 X101.412 Y107.252 E5.82473
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89936
+G1 X99.230 Y107.348 E5.93010
+G1 X98.464 Y107.227 E5.96743
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03550
+G1 X96.418 Y106.462 E6.07282
+G1 X95.762 Y106.052 E6.11003
+G1 X95.164 Y105.586 E6.14653
+G1 X94.686 Y105.134 E6.17812
+G1 X94.187 Y104.560 E6.21473
+G1 X93.804 Y104.026 E6.24632
+G1 X93.423 Y103.367 E6.28293
+G1 X93.150 Y102.770 E6.31451
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F897
+G1 X92.526 Y102.143 E6.34990
+G1 X92.346 Y101.366 E6.38825
+G1 X92.255 Y100.678 E6.42162
+G1 X92.226 Y99.863 E6.46085
+G1 X92.268 Y99.188 E6.49338
+G1 X92.395 Y98.384 E6.53257
+G1 X92.606 Y97.597 E6.57175
+G1 X92.843 Y96.963 E6.60428
+G1 X93.200 Y96.231 E6.64347
+G1 X93.622 Y95.554 E6.68182
+G1 X94.044 Y95.003 E6.71519
+G1 X94.599 Y94.407 E6.75438
+G1 X95.201 Y93.884 E6.79272
+G1 X95.765 Y93.480 E6.82610
+G1 X96.456 Y93.080 E6.86448
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.322 Y92.255 E7.00881
+G1 X100.119 Y92.226 E7.04715
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11975
+G1 X102.272 Y92.565 E7.15228
+G1 X103.038 Y92.843 E7.19147
+G1 X103.769 Y93.200 E7.23061
+G1 X104.446 Y93.622 E7.26896
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34151
+G1 X106.127 Y95.214 E7.38070
+G1 X106.520 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44585
+G1 X107.209 Y97.088 E7.48504
+G1 X107.474 Y97.858 E7.52422
+G1 X107.632 Y98.516 E7.55675
+G1 X107.745 Y99.322 E7.59594
+G1 X107.774 Y100.137 E7.63513
+G1 X107.732 Y100.812 E7.66765
+G1 X107.605 Y101.617 E7.70689
+G1 X107.435 Y102.272 E7.73942
+G1 X107.157 Y103.038 E7.77860
+G1 X106.800 Y103.769 E7.81775
+G1 X106.369 Y104.459 E7.85689
+G1 X105.878 Y105.088 E7.89524
+G1 X105.401 Y105.592 E7.92861
+G1 X104.786 Y106.127 E7.96784
+G1 X104.234 Y106.520 E8.00041
+G1 X103.651 Y106.864 E8.03299
+G1 X102.912 Y107.209 E8.07218
+G1 X102.159 Y107.469 E8.11052
+G1 X101.484 Y107.632 E8.14390
+G1 X100.678 Y107.745 E8.18308
+G1 X99.863 Y107.774 E8.22227
+G1 X99.188 Y107.732 E8.25479
+G1 X98.384 Y107.605 E8.29398
+G1 X97.597 Y107.394 E8.33317
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40488
+G1 X95.541 Y106.369 E8.44403
+G1 X94.912 Y105.878 E8.48237
+G1 X94.408 Y105.401 E8.51575
+G1 X93.884 Y104.799 E8.55414
+G1 X93.480 Y104.235 E8.58751
+G1 X93.080 Y103.544 E8.62590
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68709
+G1 X92.697 Y102.175 F7800.000
+G1 X93.278 Y101.458
+G1 F897
+G1 X98.306 Y106.486 E9.02907
+G1 X98.604 Y106.566 E9.04393
+G1 X99.304 Y106.677 E9.07799
+G1 X99.877 Y106.712 E9.10562
+G1 X100.585 Y106.687 E9.13968
+G1 X101.286 Y106.589 E9.17371
+G1 X101.861 Y106.450 E9.20216
+G1 X102.514 Y106.224 E9.23541
+G1 X103.157 Y105.925 E9.26951
+G1 X103.656 Y105.630 E9.29740
+G1 X104.129 Y105.293 E9.32530
+G1 X104.744 Y104.744 E9.36498
+G1 X95.257 Y95.257 E10.01028
+G1 X95.859 Y94.717 E10.04918
+G1 X96.340 Y94.372 E10.07765
+G1 X96.943 Y94.024 E10.11114
+G1 X97.481 Y93.778 E10.13959
+G1 X98.155 Y93.545 E10.17388
+G1 X98.714 Y93.411 E10.20151
+G1 X99.416 Y93.313 E10.23561
+G1 X100.107 Y93.288 E10.26886
+G1 X100.697 Y93.323 E10.29731
+G1 X101.401 Y93.435 E10.33160
+G1 X101.690 Y93.509 E10.34593
+G1 X106.727 Y98.547 E10.68858
+G1 X106.776 Y101.178 F7800.000
+G1 F897
+G1 X94.720 Y104.409 E11.28891
+G1 X93.224 Y98.822 F7800.000
+G1 F897
+G1 X105.280 Y95.591 E11.88921
+G1 X104.624 Y105.093 F7800.000
+G1 F897
+G1 X106.468 Y98.210 E12.23192
+G1 X106.455 Y98.155 E12.23466
+G1 X106.224 Y97.485 E12.26872
+G1 X105.925 Y96.843 E12.30279
+G1 X105.630 Y96.344 E12.33068
+G1 X105.293 Y95.871 E12.35858
+G1 X104.829 Y95.337 E12.39265
+G1 X104.311 Y94.854 E12.42667
+G1 X103.842 Y94.495 E12.45512
+G1 X103.255 Y94.129 E12.48838
+G1 X102.623 Y93.821 E12.52220
+G1 X101.957 Y93.579 E12.55627
+G1 X101.736 Y93.521 E12.56726
+G1 X98.265 Y106.475 E13.21228
+G1 X97.920 Y106.383 E13.22945
+G1 X97.382 Y106.182 E13.25707
+G1 X96.746 Y105.871 E13.29114
+G1 X96.149 Y105.498 E13.32496
+G1 X95.604 Y105.073 E13.35822
+G1 X95.174 Y104.666 E13.38669
+G1 X94.717 Y104.141 E13.42018
+G1 X94.372 Y103.660 E13.44866
+G1 X94.024 Y103.057 E13.48214
+G1 X93.778 Y102.519 E13.51059
+G1 X93.533 Y101.788 E13.54769
+G1 X95.376 Y94.907 E13.89033
+G1 E11.89033 F2400.00000
+G92 E0
+G1 X149.958 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F897
+G1 X155.276 Y100.996 E2.25577
+G1 X155.276 Y114.004 E2.88138
+G1 X149.958 Y114.004 E3.13715
+G1 X149.958 Y101.056 E3.75988
+G1 X149.573 Y100.611 F7800.000
+G1 F897
+G1 X155.662 Y100.611 E4.05274
+G1 X155.662 Y114.389 E4.71545
+G1 X149.573 Y114.389 E5.00831
+G1 X149.573 Y100.671 E5.66814
+G1 X149.187 Y100.225 F7800.000
+G1 F897
+G1 X156.047 Y100.225 E5.99809
+G1 X156.047 Y114.775 E6.69790
+G1 X149.187 Y114.775 E7.02785
+G1 X149.187 Y100.285 E7.72477
+G1 X149.559 Y100.372 F7800.000
+G1 X150.077 Y102.040
+M106 S255
+G1 F3600
+G1 X150.799 Y101.318 E7.78001
+G1 X151.446 Y101.318 E7.81498
+G1 X150.280 Y102.483 E7.90418
+G1 X150.280 Y103.130 E7.93915
+G1 X152.092 Y101.318 E8.07780
+G1 X152.738 Y101.318 E8.11277
+G1 X150.280 Y103.776 E8.30088
+G1 X150.280 Y104.423 E8.33585
+G1 X153.385 Y101.318 E8.57341
+G1 X153.820 Y101.318 E8.59698
+G1 X153.820 Y101.528 E8.60837
+G1 X150.280 Y105.069 E8.87927
+G1 X150.280 Y105.715 E8.91424
+G1 X153.820 Y102.175 E9.18513
+G1 X153.820 Y102.821 E9.22010
+G1 X150.280 Y106.362 E9.49099
+G1 X150.280 Y107.008 E9.52596
+G1 X153.820 Y103.467 E9.79685
+G1 X153.820 Y104.114 E9.83182
+G1 X150.280 Y107.654 E10.10271
+G1 X150.280 Y108.301 E10.13768
+G1 X153.820 Y104.760 E10.40858
+G1 X153.820 Y105.406 E10.44354
+G1 X150.280 Y108.947 E10.71444
+G1 X150.280 Y109.593 E10.74941
+G1 X153.820 Y106.053 E11.02030
+G1 X153.820 Y106.699 E11.05527
+G1 X150.280 Y110.240 E11.32616
+G1 X150.280 Y110.886 E11.36113
+G1 X153.820 Y107.346 E11.63202
+G1 X153.820 Y107.992 E11.66699
+G1 X150.280 Y111.532 E11.93788
+G1 X150.280 Y112.179 E11.97285
+G1 X153.820 Y108.638 E12.24375
+G1 X153.820 Y109.285 E12.27871
+G1 X150.280 Y112.825 E12.54961
+G1 X150.280 Y113.472 E12.58458
+G1 X153.820 Y109.931 E12.85547
+G1 X153.820 Y110.577 E12.89044
+G1 X150.715 Y113.682 E13.12801
+G1 X151.362 Y113.682 E13.16298
+G1 X153.820 Y111.224 E13.35109
+G1 X153.820 Y111.870 E13.38606
+G1 X152.008 Y113.682 E13.52472
+G1 X152.654 Y113.682 E13.55969
+G1 X153.820 Y112.516 E13.64890
+G1 X153.820 Y113.163 E13.68387
+G1 X153.098 Y113.885 E13.73912
+M106 S252.45
+G1 X154.362 Y113.888 F7800.000
+G1 F897
+G1 X154.987 Y113.263 E13.78261
+G1 X154.987 Y112.705 E13.81006
+G1 X154.238 Y113.454 E13.86217
+G1 X154.238 Y112.896 E13.88963
+G1 X154.987 Y112.147 E13.94173
+G1 X154.987 Y111.589 E13.96919
+G1 X154.238 Y112.338 E14.02130
+G1 X154.238 Y111.780 E14.04876
+G1 X154.987 Y111.031 E14.10086
+G1 X154.987 Y110.473 E14.12832
+G1 X154.238 Y111.222 E14.18043
+G1 X154.238 Y110.664 E14.20789
+G1 X154.987 Y109.915 E14.25999
+G1 X154.987 Y109.357 E14.28745
+G1 X154.238 Y110.106 E14.33956
+G1 X154.238 Y109.548 E14.36702
+G1 X154.987 Y108.799 E14.41912
+G1 X154.987 Y108.241 E14.44658
+G1 X154.238 Y108.990 E14.49869
+G1 X154.238 Y108.432 E14.52614
+G1 X154.987 Y107.684 E14.57825
+G1 X154.987 Y107.126 E14.60571
+G1 X154.238 Y107.874 E14.65782
+G1 X154.238 Y107.316 E14.68527
+G1 X154.987 Y106.568 E14.73738
+G1 X154.987 Y106.010 E14.76484
+G1 X154.238 Y106.758 E14.81695
+G1 X154.238 Y106.200 E14.84440
+G1 X154.987 Y105.452 E14.89651
+G1 X154.987 Y104.894 E14.92397
+G1 X154.238 Y105.642 E14.97608
+G1 X154.238 Y105.085 E15.00353
+G1 X154.987 Y104.336 E15.05564
+G1 X154.987 Y103.778 E15.08310
+G1 X154.238 Y104.527 E15.13521
+G1 X154.238 Y103.969 E15.16266
+G1 X154.987 Y103.220 E15.21477
+G1 X154.987 Y102.662 E15.24223
+G1 X154.238 Y103.411 E15.29433
+G1 X154.238 Y102.853 E15.32179
+G1 X154.987 Y102.104 E15.37390
+G1 X154.987 Y101.546 E15.40136
+G1 X154.238 Y102.295 E15.45346
+G1 X154.238 Y101.737 E15.48092
+G1 X154.863 Y101.112 E15.52440
+G1 Z13.550 F7800.000
+G1 E13.52440 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1093
+G1 X93.106 Y101.225 E2.04130
+G1 X93.024 Y100.614 E2.07096
+G1 X92.999 Y99.873 E2.10660
+G1 X93.035 Y99.272 E2.13557
+G1 X93.151 Y98.544 E2.17105
+G1 X93.337 Y97.845 E2.20582
+G1 X93.553 Y97.267 E2.23548
+G1 X93.876 Y96.605 E2.27094
+G1 X94.258 Y95.991 E2.30571
+G1 X94.633 Y95.502 E2.33537
+G1 X95.136 Y94.963 E2.37083
+G1 X95.681 Y94.488 E2.40560
+G1 X96.183 Y94.129 E2.43528
+G1 X96.812 Y93.765 E2.47023
+G1 X97.373 Y93.509 E2.49989
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.59998
+G1 X100.113 Y92.998 E2.63476
+G1 X100.728 Y93.035 E2.66442
+G1 X101.456 Y93.151 E2.69987
+G1 X102.155 Y93.337 E2.73465
+G1 X102.733 Y93.553 E2.76431
+G1 X103.395 Y93.876 E2.79976
+G1 X104.009 Y94.258 E2.83453
+G1 X104.498 Y94.633 E2.86419
+G1 X105.037 Y95.136 E2.89965
+G1 X105.512 Y95.681 E2.93442
+G1 X105.873 Y96.186 E2.96429
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19322
+G1 X106.849 Y101.456 E3.22870
+G1 X106.663 Y102.155 E3.26347
+G1 X106.447 Y102.733 E3.29313
+G1 X106.124 Y103.395 E3.32859
+G1 X105.742 Y104.009 E3.36336
+G1 X105.367 Y104.498 E3.39302
+G1 X104.864 Y105.037 E3.42847
+G1 X104.319 Y105.512 E3.46325
+G1 X103.814 Y105.873 E3.49312
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55773
+G1 X101.926 Y106.733 E3.59319
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.873 Y107.001 E3.69308
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75752
+G1 X97.845 Y106.663 E3.79229
+G1 X97.267 Y106.447 E3.82195
+G1 X96.605 Y106.124 E3.85741
+G1 X95.991 Y105.742 E3.89218
+G1 X95.502 Y105.367 E3.92184
+G1 X94.963 Y104.864 E3.95730
+G1 X94.488 Y104.319 E3.99207
+G1 X94.129 Y103.817 E4.02175
+G1 X93.765 Y103.188 E4.05671
+G1 X93.509 Y102.627 E4.08637
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1093
+G1 X92.898 Y102.036 E4.11990
+G1 X92.726 Y101.294 E4.15653
+G1 X92.640 Y100.646 E4.18797
+G1 X92.612 Y99.868 E4.22541
+G1 X92.652 Y99.230 E4.25616
+G1 X92.773 Y98.464 E4.29349
+G1 X92.969 Y97.728 E4.33012
+G1 X93.198 Y97.115 E4.36157
+G1 X93.538 Y96.418 E4.39889
+G1 X93.941 Y95.772 E4.43552
+G1 X94.338 Y95.252 E4.46697
+G1 X94.868 Y94.685 E4.50429
+G1 X95.442 Y94.185 E4.54091
+G1 X95.974 Y93.804 E4.57237
+G1 X96.635 Y93.422 E4.60911
+G1 X97.230 Y93.150 E4.64056
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70874
+G1 X99.356 Y92.640 E4.74608
+G1 X100.117 Y92.612 E4.78271
+G1 X100.770 Y92.652 E4.81415
+G1 X101.536 Y92.773 E4.85148
+G1 X102.272 Y92.969 E4.88810
+G1 X102.885 Y93.198 E4.91955
+G1 X103.582 Y93.538 E4.95687
+G1 X104.228 Y93.941 E4.99350
+G1 X104.748 Y94.338 E5.02495
+G1 X105.315 Y94.868 E5.06227
+G1 X105.815 Y95.442 E5.09889
+G1 X106.197 Y95.976 E5.13047
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.232 E5.19865
+G1 X107.103 Y97.966 E5.23598
+G1 X107.252 Y98.588 E5.26672
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34137
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.536 E5.40946
+G1 X107.031 Y102.272 E5.44608
+G1 X106.802 Y102.885 E5.47753
+G1 X106.462 Y103.582 E5.51485
+G1 X106.059 Y104.228 E5.55148
+G1 X105.662 Y104.748 E5.58293
+G1 X105.132 Y105.315 E5.62025
+G1 X104.558 Y105.815 E5.65687
+G1 X104.024 Y106.197 E5.68845
+G1 X103.471 Y106.523 E5.71931
+G1 X102.768 Y106.851 E5.75663
+G1 X102.034 Y107.103 E5.79396
+G1 X101.412 Y107.252 E5.82471
+G1 X100.644 Y107.360 E5.86203
+G1 X99.868 Y107.388 E5.89936
+G1 X99.230 Y107.348 E5.93010
+G1 X98.464 Y107.227 E5.96744
+G1 X97.728 Y107.031 E6.00406
+G1 X97.115 Y106.802 E6.03551
+G1 X96.418 Y106.462 E6.07283
+G1 X95.772 Y106.059 E6.10946
+G1 X95.252 Y105.662 E6.14091
+G1 X94.685 Y105.132 E6.17823
+G1 X94.185 Y104.558 E6.21485
+G1 X93.804 Y104.026 E6.24632
+G1 X93.422 Y103.365 E6.28305
+G1 X93.150 Y102.770 E6.31450
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F1093
+G1 X92.526 Y102.143 E6.34990
+G1 X92.346 Y101.364 E6.38838
+G1 X92.255 Y100.678 E6.42162
+G1 X92.226 Y99.863 E6.46085
+G1 X92.268 Y99.188 E6.49338
+G1 X92.395 Y98.383 E6.53257
+G1 X92.602 Y97.611 E6.57105
+G1 X92.843 Y96.963 E6.60429
+G1 X93.200 Y96.231 E6.64347
+G1 X93.624 Y95.552 E6.68195
+G1 X94.044 Y95.003 E6.71519
+G1 X94.599 Y94.407 E6.75437
+G1 X95.203 Y93.882 E6.79285
+G1 X95.765 Y93.480 E6.82610
+G1 X96.458 Y93.079 E6.86462
+G1 X97.087 Y92.792 E6.89785
+G1 X97.858 Y92.526 E6.93708
+G1 X98.516 Y92.368 E6.96961
+G1 X99.322 Y92.255 E7.00880
+G1 X100.122 Y92.226 E7.04728
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11971
+G1 X102.389 Y92.602 E7.15818
+G1 X103.037 Y92.843 E7.19142
+G1 X103.769 Y93.200 E7.23061
+G1 X104.448 Y93.624 E7.26909
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34151
+G1 X106.118 Y95.203 E7.37999
+G1 X106.521 Y95.766 E7.41328
+G1 X106.864 Y96.349 E7.44585
+G1 X107.209 Y97.088 E7.48503
+G1 X107.474 Y97.858 E7.52422
+G1 X107.632 Y98.516 E7.55675
+G1 X107.745 Y99.322 E7.59594
+G1 X107.774 Y100.137 E7.63512
+G1 X107.732 Y100.812 E7.66765
+G1 X107.605 Y101.617 E7.70684
+G1 X107.398 Y102.389 E7.74532
+G1 X107.157 Y103.037 E7.77856
+G1 X106.800 Y103.769 E7.81775
+G1 X106.376 Y104.448 E7.85623
+G1 X105.956 Y104.997 E7.88946
+G1 X105.401 Y105.593 E7.92865
+G1 X104.797 Y106.118 E7.96713
+G1 X104.234 Y106.521 E8.00041
+G1 X103.651 Y106.864 E8.03298
+G1 X102.912 Y107.209 E8.07217
+G1 X102.142 Y107.474 E8.11136
+G1 X101.484 Y107.632 E8.14389
+G1 X100.678 Y107.745 E8.18307
+G1 X99.863 Y107.774 E8.22226
+G1 X99.188 Y107.732 E8.25479
+G1 X98.383 Y107.605 E8.29398
+G1 X97.611 Y107.398 E8.33246
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40489
+G1 X95.552 Y106.376 E8.44336
+G1 X95.003 Y105.956 E8.47660
+G1 X94.407 Y105.401 E8.51579
+G1 X93.882 Y104.797 E8.55427
+G1 X93.480 Y104.235 E8.58751
+G1 X93.079 Y103.542 E8.62603
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68708
+G1 X92.697 Y102.175 F7800.000
+G1 X93.278 Y101.459
+G1 F1093
+G1 X98.306 Y106.487 E9.02909
+G1 X98.604 Y106.566 E9.04390
+G1 X99.304 Y106.677 E9.07799
+G1 X99.877 Y106.712 E9.10561
+G1 X100.585 Y106.687 E9.13968
+G1 X101.286 Y106.589 E9.17374
+G1 X101.845 Y106.455 E9.20137
+G1 X102.515 Y106.224 E9.23544
+G1 X103.157 Y105.925 E9.26950
+G1 X103.656 Y105.631 E9.29737
+G1 X104.139 Y105.285 E9.32595
+G1 X104.743 Y104.743 E9.36497
+G1 X95.257 Y95.257 E10.01021
+G1 X95.861 Y94.715 E10.04923
+G1 X96.340 Y94.372 E10.07757
+G1 X96.945 Y94.022 E10.11119
+G1 X97.481 Y93.778 E10.13951
+G1 X98.155 Y93.545 E10.17381
+G1 X98.714 Y93.411 E10.20144
+G1 X99.415 Y93.313 E10.23553
+G1 X100.109 Y93.288 E10.26891
+G1 X100.697 Y93.323 E10.29723
+G1 X101.396 Y93.434 E10.33129
+G1 X101.694 Y93.513 E10.34610
+G1 X106.727 Y98.547 E10.68847
+G1 X106.776 Y101.178 F7800.000
+G1 F1093
+G1 X94.720 Y104.409 E11.28879
+G1 X93.224 Y98.822 F7800.000
+G1 F1093
+G1 X105.280 Y95.591 E11.88912
+G1 X104.624 Y105.093 F7800.000
+G1 F1093
+G1 X106.468 Y98.210 E12.23184
+G1 X106.224 Y97.485 E12.26864
+G1 X105.925 Y96.843 E12.30270
+G1 X105.631 Y96.344 E12.33056
+G1 X105.285 Y95.861 E12.35915
+G1 X104.829 Y95.337 E12.39254
+G1 X104.311 Y94.854 E12.42659
+G1 X103.844 Y94.496 E12.45491
+G1 X103.255 Y94.129 E12.48829
+G1 X102.618 Y93.819 E12.52235
+G1 X102.067 Y93.613 E12.55067
+G1 X101.735 Y93.525 E12.56718
+G1 X98.265 Y106.475 E13.21205
+G1 X97.933 Y106.387 E13.22856
+G1 X97.382 Y106.181 E13.25688
+G1 X96.745 Y105.871 E13.29094
+G1 X96.156 Y105.504 E13.32432
+G1 X95.689 Y105.146 E13.35264
+G1 X95.171 Y104.663 E13.38669
+G1 X94.715 Y104.139 E13.42008
+G1 X94.372 Y103.660 E13.44842
+G1 X94.022 Y103.055 E13.48204
+G1 X93.778 Y102.519 E13.51036
+G1 X93.547 Y101.850 E13.54441
+G1 X93.533 Y101.788 E13.54748
+G1 X95.376 Y94.907 E13.89011
+G1 E11.89011 F2400.00000
+G92 E0
+G1 X150.164 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X154.838 Y100.996 E2.22480
+G1 X154.838 Y114.004 E2.85042
+G1 X150.164 Y114.004 E3.07523
+G1 X150.164 Y101.056 E3.69796
+G1 X149.778 Y100.611 F7800.000
+G1 F900
+G1 X155.223 Y100.611 E3.95985
+G1 X155.223 Y114.389 E4.62257
+G1 X149.778 Y114.389 E4.88446
+G1 X149.778 Y100.671 E5.54429
+G1 X149.392 Y100.225 F7800.000
+G1 F1093
+G1 X155.609 Y100.225 E5.84328
+G1 X155.609 Y114.775 E6.54309
+G1 X149.392 Y114.775 E6.84208
+G1 X149.392 Y100.285 E7.53900
+G1 X149.763 Y100.377 F7800.000
+G1 X154.722 Y101.910
+G1 F1093
+G1 X154.097 Y101.285 E7.58248
+G1 X153.539 Y101.285 E7.60994
+G1 X154.548 Y102.295 E7.68017
+G1 X154.548 Y102.853 E7.70762
+G1 X152.981 Y101.285 E7.81668
+G1 X152.423 Y101.285 E7.84414
+G1 X154.548 Y103.411 E7.99202
+G1 X154.548 Y103.969 E8.01948
+G1 X151.865 Y101.285 E8.20619
+G1 X151.307 Y101.285 E8.23364
+G1 X154.548 Y104.526 E8.45918
+G1 X154.548 Y105.084 E8.48664
+G1 X150.750 Y101.285 E8.75100
+G1 X150.453 Y101.285 E8.76560
+G1 X150.453 Y101.547 E8.77845
+G1 X154.548 Y105.642 E9.06346
+G1 X154.548 Y106.200 E9.09092
+G1 X150.453 Y102.105 E9.37592
+G1 X150.453 Y102.663 E9.40338
+G1 X154.548 Y106.758 E9.68839
+G1 X154.548 Y107.316 E9.71584
+G1 X150.453 Y103.221 E10.00085
+G1 X150.453 Y103.778 E10.02830
+G1 X154.548 Y107.874 E10.31331
+G1 X154.548 Y108.432 E10.34076
+G1 X150.453 Y104.336 E10.62577
+G1 X150.453 Y104.894 E10.65323
+G1 X154.548 Y108.990 E10.93823
+G1 X154.548 Y109.548 E10.96569
+G1 X150.453 Y105.452 E11.25070
+G1 X150.453 Y106.010 E11.27815
+G1 X154.548 Y110.106 E11.56316
+G1 X154.548 Y110.664 E11.59061
+G1 X150.453 Y106.568 E11.87562
+G1 X150.453 Y107.126 E11.90307
+G1 X154.548 Y111.222 E12.18808
+G1 X154.548 Y111.780 E12.21554
+G1 X150.453 Y107.684 E12.50054
+G1 X150.453 Y108.242 E12.52800
+G1 X154.548 Y112.338 E12.81301
+G1 X154.548 Y112.895 E12.84046
+G1 X150.453 Y108.800 E13.12547
+G1 X150.453 Y109.358 E13.15292
+G1 X154.548 Y113.453 E13.43793
+G1 X154.548 Y113.715 E13.45078
+G1 X154.252 Y113.715 E13.46538
+G1 X150.453 Y109.916 E13.72974
+G1 X150.453 Y110.474 E13.75719
+G1 X153.694 Y113.715 E13.98272
+G1 X153.136 Y113.715 E14.01018
+G1 X150.453 Y111.032 E14.19688
+G1 X150.453 Y111.590 E14.22434
+G1 X152.578 Y113.715 E14.37222
+G1 X152.020 Y113.715 E14.39967
+G1 X150.453 Y112.147 E14.50872
+G1 X150.453 Y112.705 E14.53618
+G1 X151.462 Y113.715 E14.60640
+G1 X150.904 Y113.715 E14.63386
+G1 X150.279 Y113.090 E14.67733
+G1 Z13.850 F7800.000
+G1 E12.67733 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F1045
+G1 X93.105 Y101.223 E2.04142
+G1 X93.024 Y100.614 E2.07095
+G1 X92.999 Y99.877 E2.10641
+G1 X93.049 Y99.154 E2.14131
+G1 X93.150 Y98.548 E2.17084
+G1 X93.340 Y97.836 E2.20630
+G1 X93.600 Y97.158 E2.24120
+G1 X93.873 Y96.608 E2.27073
+G1 X94.264 Y95.983 E2.30619
+G1 X94.711 Y95.411 E2.34109
+G1 X95.136 Y94.962 E2.37083
+G1 X95.590 Y94.561 E2.39998
+G1 X96.186 Y94.127 E2.43546
+G1 X96.815 Y93.764 E2.47036
+G1 X97.373 Y93.509 E2.49989
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.59998
+G1 X100.115 Y92.998 E2.63488
+G1 X100.728 Y93.035 E2.66441
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.395 Y93.876 E2.79974
+G1 X104.017 Y94.264 E2.83501
+G1 X104.589 Y94.711 E2.86991
+G1 X105.035 Y95.133 E2.89944
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96427
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.123 E3.16406
+G1 X106.951 Y100.846 E3.19896
+G1 X106.850 Y101.456 E3.22870
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32857
+G1 X105.736 Y104.017 E3.36383
+G1 X105.289 Y104.589 E3.39874
+G1 X104.867 Y105.035 E3.42827
+G1 X104.308 Y105.521 E3.46392
+G1 X103.817 Y105.871 E3.49290
+G1 X103.185 Y106.236 E3.52801
+G1 X102.627 Y106.491 E3.55754
+G1 X101.926 Y106.733 E3.59319
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.877 Y107.001 E3.69288
+G1 X99.154 Y106.951 E3.72778
+G1 X98.548 Y106.850 E3.75733
+G1 X97.843 Y106.662 E3.79242
+G1 X97.267 Y106.447 E3.82195
+G1 X96.605 Y106.124 E3.85741
+G1 X95.989 Y105.740 E3.89231
+G1 X95.502 Y105.367 E3.92184
+G1 X94.960 Y104.861 E3.95749
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.814 E4.02193
+G1 X93.764 Y103.185 E4.05683
+G1 X93.509 Y102.627 E4.08636
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F1045
+G1 X92.898 Y102.036 E4.11990
+G1 X92.725 Y101.292 E4.15666
+G1 X92.640 Y100.646 E4.18797
+G1 X92.613 Y99.871 E4.22529
+G1 X92.665 Y99.108 E4.26205
+G1 X92.772 Y98.466 E4.29337
+G1 X92.973 Y97.717 E4.33069
+G1 X93.247 Y97.003 E4.36745
+G1 X93.537 Y96.420 E4.39876
+G1 X93.948 Y95.762 E4.43609
+G1 X94.418 Y95.159 E4.47284
+G1 X94.868 Y94.685 E4.50429
+G1 X95.348 Y94.260 E4.53515
+G1 X95.976 Y93.803 E4.57248
+G1 X96.638 Y93.421 E4.60924
+G1 X97.230 Y93.150 E4.64056
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70874
+G1 X99.356 Y92.640 E4.74608
+G1 X100.120 Y92.612 E4.78284
+G1 X100.770 Y92.652 E4.81415
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88234
+G1 X102.887 Y93.199 E4.91966
+G1 X103.582 Y93.538 E4.95686
+G1 X104.238 Y93.948 E4.99407
+G1 X104.841 Y94.418 E5.03082
+G1 X105.313 Y94.866 E5.06214
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13046
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.232 E5.19865
+G1 X107.103 Y97.966 E5.23598
+G1 X107.252 Y98.588 E5.26673
+G1 X107.360 Y99.356 E5.30405
+G1 X107.387 Y100.129 E5.34126
+G1 X107.335 Y100.892 E5.37801
+G1 X107.227 Y101.536 E5.40946
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47765
+G1 X106.462 Y103.582 E5.51484
+G1 X106.052 Y104.238 E5.55205
+G1 X105.582 Y104.841 E5.58880
+G1 X105.134 Y105.313 E5.62012
+G1 X104.547 Y105.824 E5.65756
+G1 X104.026 Y106.195 E5.68832
+G1 X103.362 Y106.579 E5.72520
+G1 X102.770 Y106.850 E5.75652
+G1 X102.034 Y107.103 E5.79396
+G1 X101.412 Y107.252 E5.82471
+G1 X100.644 Y107.360 E5.86203
+G1 X99.871 Y107.387 E5.89924
+G1 X99.108 Y107.335 E5.93599
+G1 X98.466 Y107.228 E5.96732
+G1 X97.725 Y107.030 E6.00419
+G1 X97.115 Y106.802 E6.03551
+G1 X96.418 Y106.462 E6.07283
+G1 X95.769 Y106.058 E6.10959
+G1 X95.252 Y105.662 E6.14091
+G1 X94.683 Y105.131 E6.17835
+G1 X94.260 Y104.652 E6.20909
+G1 X93.803 Y104.024 E6.24643
+G1 X93.421 Y103.362 E6.28318
+G1 X93.150 Y102.770 E6.31450
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F1045
+G1 X92.526 Y102.143 E6.34990
+G1 X92.345 Y101.361 E6.38851
+G1 X92.255 Y100.678 E6.42162
+G1 X92.226 Y99.864 E6.46081
+G1 X92.282 Y99.063 E6.49942
+G1 X92.395 Y98.384 E6.53252
+G1 X92.606 Y97.597 E6.57171
+G1 X92.893 Y96.848 E6.61032
+G1 X93.200 Y96.232 E6.64343
+G1 X93.631 Y95.541 E6.68261
+G1 X94.125 Y94.908 E6.72122
+G1 X94.599 Y94.407 E6.75438
+G1 X95.106 Y93.959 E6.78695
+G1 X95.766 Y93.480 E6.82614
+G1 X96.461 Y93.078 E6.86475
+G1 X97.087 Y92.792 E6.89785
+G1 X97.858 Y92.526 E6.93709
+G1 X98.516 Y92.368 E6.96961
+G1 X99.322 Y92.255 E7.00880
+G1 X100.125 Y92.226 E7.04742
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11975
+G1 X102.272 Y92.565 E7.15228
+G1 X103.038 Y92.843 E7.19147
+G1 X103.769 Y93.200 E7.23061
+G1 X104.459 Y93.631 E7.26975
+G1 X105.092 Y94.125 E7.30836
+G1 X105.592 Y94.599 E7.34147
+G1 X106.127 Y95.214 E7.38070
+G1 X106.520 Y95.766 E7.41327
+G1 X106.864 Y96.349 E7.44585
+G1 X107.209 Y97.088 E7.48504
+G1 X107.474 Y97.858 E7.52422
+G1 X107.632 Y98.516 E7.55675
+G1 X107.745 Y99.322 E7.59594
+G1 X107.774 Y100.136 E7.63508
+G1 X107.718 Y100.937 E7.67369
+G1 X107.605 Y101.617 E7.70685
+G1 X107.435 Y102.272 E7.73942
+G1 X107.157 Y103.038 E7.77860
+G1 X106.800 Y103.769 E7.81775
+G1 X106.369 Y104.459 E7.85689
+G1 X105.875 Y105.092 E7.89550
+G1 X105.401 Y105.592 E7.92861
+G1 X104.786 Y106.127 E7.96784
+G1 X104.235 Y106.520 E8.00037
+G1 X103.539 Y106.922 E8.03903
+G1 X102.913 Y107.208 E8.07213
+G1 X102.142 Y107.474 E8.11136
+G1 X101.484 Y107.632 E8.14389
+G1 X100.678 Y107.745 E8.18308
+G1 X99.864 Y107.774 E8.22222
+G1 X99.063 Y107.718 E8.26083
+G1 X98.384 Y107.605 E8.29394
+G1 X97.608 Y107.398 E8.33260
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40489
+G1 X95.550 Y106.375 E8.44350
+G1 X95.003 Y105.956 E8.47660
+G1 X94.407 Y105.400 E8.51583
+G1 X93.959 Y104.894 E8.54836
+G1 X93.480 Y104.234 E8.58755
+G1 X93.078 Y103.539 E8.62616
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68709
+G1 X92.697 Y102.175 F7800.000
+G1 X93.278 Y101.459
+G1 F1045
+G1 X98.306 Y106.486 E9.02908
+G1 X98.609 Y106.567 E9.04414
+G1 X99.187 Y106.664 E9.07235
+G1 X99.882 Y106.712 E9.10586
+G1 X100.585 Y106.687 E9.13967
+G1 X101.286 Y106.589 E9.17374
+G1 X101.845 Y106.455 E9.20137
+G1 X102.519 Y106.222 E9.23567
+G1 X103.053 Y105.979 E9.26386
+G1 X103.661 Y105.627 E9.29764
+G1 X104.129 Y105.293 E9.32529
+G1 X104.744 Y104.744 E9.36497
+G1 X95.256 Y95.256 E10.01034
+G1 X95.771 Y94.786 E10.04386
+G1 X96.344 Y94.370 E10.07794
+G1 X96.947 Y94.021 E10.11145
+G1 X97.481 Y93.778 E10.13964
+G1 X98.155 Y93.545 E10.17395
+G1 X98.714 Y93.411 E10.20158
+G1 X99.415 Y93.313 E10.23566
+G1 X100.112 Y93.288 E10.26918
+G1 X100.697 Y93.323 E10.29736
+G1 X101.401 Y93.435 E10.33167
+G1 X101.690 Y93.509 E10.34600
+G1 X106.727 Y98.547 E10.68865
+G1 X106.779 Y101.178 F7800.000
+G1 F1045
+G1 X94.715 Y104.410 E11.28934
+G1 X93.221 Y98.822 F7800.000
+G1 F1045
+G1 X105.280 Y95.591 E11.88977
+G1 X104.624 Y105.093 F7800.000
+G1 F1045
+G1 X106.468 Y98.210 E12.23247
+G1 X106.455 Y98.155 E12.23521
+G1 X106.224 Y97.485 E12.26928
+G1 X105.925 Y96.843 E12.30334
+G1 X105.630 Y96.344 E12.33124
+G1 X105.293 Y95.871 E12.35914
+G1 X104.825 Y95.333 E12.39345
+G1 X104.400 Y94.930 E12.42163
+G1 X103.851 Y94.501 E12.45515
+G1 X103.254 Y94.129 E12.48896
+G1 X102.623 Y93.821 E12.52276
+G1 X101.957 Y93.579 E12.55682
+G1 X101.736 Y93.521 E12.56782
+G1 X98.265 Y106.475 E13.21285
+G1 X97.931 Y106.386 E13.22948
+G1 X97.382 Y106.181 E13.25767
+G1 X96.745 Y105.871 E13.29173
+G1 X96.154 Y105.502 E13.32524
+G1 X95.689 Y105.146 E13.35343
+G1 X95.167 Y104.659 E13.38773
+G1 X94.786 Y104.229 E13.41536
+G1 X94.370 Y103.656 E13.44945
+G1 X94.021 Y103.053 E13.48296
+G1 X93.778 Y102.519 E13.51115
+G1 X93.533 Y101.788 E13.54827
+G1 X95.377 Y94.903 E13.89107
+G1 E11.89107 F2400.00000
+G92 E0
+G1 X150.369 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X154.399 Y100.996 E2.19384
+G1 X154.399 Y114.004 E2.81946
+G1 X150.369 Y114.004 E3.01330
+G1 X150.369 Y101.056 E3.63603
+G1 X149.983 Y100.611 F7800.000
+G1 F900
+G1 X154.785 Y100.611 E3.86697
+G1 X154.785 Y114.389 E4.52968
+G1 X149.983 Y114.389 E4.76062
+G1 X149.983 Y100.671 E5.42044
+G1 X149.598 Y100.225 F7800.000
+G1 F900
+G1 X155.170 Y100.225 E5.68847
+G1 X155.170 Y114.775 E6.38828
+G1 X149.598 Y114.775 E6.65631
+G1 X149.598 Y100.285 E7.35322
+G1 X149.966 Y100.381 F7800.000
+G1 X150.485 Y101.906
+G1 F1045
+G1 X151.105 Y101.285 E7.39618
+G1 X151.660 Y101.285 E7.42336
+G1 X150.658 Y102.287 E7.49273
+G1 X150.658 Y102.843 E7.51990
+G1 X152.215 Y101.285 E7.62770
+G1 X152.770 Y101.285 E7.65487
+G1 X150.658 Y103.398 E7.80110
+G1 X150.658 Y103.953 E7.82828
+G1 X153.325 Y101.285 E8.01294
+G1 X153.880 Y101.285 E8.04011
+G1 X150.658 Y104.508 E8.26320
+G1 X150.658 Y105.063 E8.29037
+G1 X154.110 Y101.611 E8.52935
+G1 X154.110 Y102.166 E8.55652
+G1 X150.658 Y105.618 E8.79550
+G1 X150.658 Y106.173 E8.82267
+G1 X154.110 Y102.721 E9.06165
+G1 X154.110 Y103.276 E9.08882
+G1 X150.658 Y106.728 E9.32780
+G1 X150.658 Y107.283 E9.35498
+G1 X154.110 Y103.831 E9.59395
+G1 X154.110 Y104.386 E9.62113
+G1 X150.658 Y107.838 E9.86011
+G1 X150.658 Y108.393 E9.88728
+G1 X154.110 Y104.941 E10.12626
+G1 X154.110 Y105.496 E10.15343
+G1 X150.658 Y108.948 E10.39241
+G1 X150.658 Y109.503 E10.41958
+G1 X154.110 Y106.052 E10.65856
+G1 X154.110 Y106.607 E10.68574
+G1 X150.658 Y110.058 E10.92471
+G1 X150.658 Y110.614 E10.95189
+G1 X154.110 Y107.162 E11.19087
+G1 X154.110 Y107.717 E11.21804
+G1 X150.658 Y111.169 E11.45702
+G1 X150.658 Y111.724 E11.48419
+G1 X154.110 Y108.272 E11.72317
+G1 X154.110 Y108.827 E11.75034
+G1 X150.658 Y112.279 E11.98932
+G1 X150.658 Y112.834 E12.01649
+G1 X154.110 Y109.382 E12.25547
+G1 X154.110 Y109.937 E12.28265
+G1 X150.658 Y113.389 E12.52162
+G1 X150.658 Y113.715 E12.53757
+G1 X150.888 Y113.715 E12.54880
+G1 X154.110 Y110.492 E12.77189
+G1 X154.110 Y111.047 E12.79906
+G1 X151.443 Y113.715 E12.98373
+G1 X151.998 Y113.715 E13.01090
+G1 X154.110 Y111.602 E13.15714
+G1 X154.110 Y112.157 E13.18431
+G1 X152.553 Y113.715 E13.29212
+G1 X153.108 Y113.715 E13.31929
+G1 X154.110 Y112.712 E13.38867
+G1 X154.110 Y113.268 E13.41585
+G1 X153.489 Y113.888 E13.45881
+G1 Z14.150 F7800.000
+G1 E11.45881 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F978
+G1 X93.105 Y101.220 E2.04155
+G1 X93.024 Y100.614 E2.07095
+G1 X92.999 Y99.878 E2.10641
+G1 X93.049 Y99.151 E2.14144
+G1 X93.150 Y98.548 E2.17084
+G1 X93.341 Y97.832 E2.20649
+G1 X93.552 Y97.268 E2.23546
+G1 X93.876 Y96.605 E2.27093
+G1 X94.261 Y95.987 E2.30596
+G1 X94.633 Y95.502 E2.33536
+G1 X95.136 Y94.963 E2.37082
+G1 X95.685 Y94.485 E2.40585
+G1 X96.183 Y94.129 E2.43526
+G1 X96.817 Y93.763 E2.47049
+G1 X97.373 Y93.509 E2.49988
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.59998
+G1 X100.118 Y92.998 E2.63501
+G1 X100.728 Y93.035 E2.66441
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.395 Y93.876 E2.79975
+G1 X104.013 Y94.261 E2.83479
+G1 X104.498 Y94.633 E2.86419
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96427
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.122 E3.16405
+G1 X106.951 Y100.849 E3.19909
+G1 X106.850 Y101.456 E3.22870
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32857
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42846
+G1 X104.308 Y105.521 E3.46392
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55773
+G1 X101.926 Y106.733 E3.59319
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.878 Y107.001 E3.69288
+G1 X99.151 Y106.951 E3.72791
+G1 X98.548 Y106.850 E3.75731
+G1 X97.832 Y106.659 E3.79297
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89264
+G1 X95.403 Y105.282 E3.92811
+G1 X94.966 Y104.867 E3.95708
+G1 X94.485 Y104.315 E3.99232
+G1 X94.129 Y103.817 E4.02173
+G1 X93.763 Y103.183 E4.05696
+G1 X93.509 Y102.627 E4.08636
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F978
+G1 X92.898 Y102.036 E4.11990
+G1 X92.725 Y101.289 E4.15679
+G1 X92.640 Y100.646 E4.18797
+G1 X92.613 Y99.871 E4.22529
+G1 X92.666 Y99.106 E4.26218
+G1 X92.772 Y98.466 E4.29337
+G1 X92.974 Y97.714 E4.33081
+G1 X93.198 Y97.115 E4.36156
+G1 X93.538 Y96.418 E4.39889
+G1 X93.944 Y95.767 E4.43578
+G1 X94.338 Y95.253 E4.46696
+G1 X94.868 Y94.685 E4.50428
+G1 X95.446 Y94.182 E4.54117
+G1 X95.974 Y93.805 E4.57236
+G1 X96.640 Y93.420 E4.60937
+G1 X97.230 Y93.150 E4.64056
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70875
+G1 X99.356 Y92.640 E4.74608
+G1 X100.123 Y92.612 E4.78297
+G1 X100.770 Y92.652 E4.81415
+G1 X101.539 Y92.773 E4.85159
+G1 X102.158 Y92.933 E4.88234
+G1 X102.887 Y93.199 E4.91967
+G1 X103.582 Y93.538 E4.95687
+G1 X104.233 Y93.944 E4.99376
+G1 X104.747 Y94.338 E5.02494
+G1 X105.315 Y94.867 E5.06226
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13046
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.232 E5.19866
+G1 X107.103 Y97.966 E5.23598
+G1 X107.252 Y98.588 E5.26673
+G1 X107.360 Y99.356 E5.30405
+G1 X107.387 Y100.129 E5.34126
+G1 X107.334 Y100.894 E5.37814
+G1 X107.227 Y101.536 E5.40946
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47765
+G1 X106.462 Y103.582 E5.51484
+G1 X106.051 Y104.240 E5.55217
+G1 X105.662 Y104.747 E5.58291
+G1 X105.133 Y105.315 E5.62024
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68844
+G1 X103.471 Y106.523 E5.71931
+G1 X102.768 Y106.851 E5.75664
+G1 X102.034 Y107.103 E5.79396
+G1 X101.412 Y107.252 E5.82471
+G1 X100.644 Y107.360 E5.86203
+G1 X99.871 Y107.387 E5.89924
+G1 X99.106 Y107.334 E5.93613
+G1 X98.466 Y107.228 E5.96731
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03550
+G1 X96.418 Y106.462 E6.07283
+G1 X95.762 Y106.052 E6.11002
+G1 X95.151 Y105.575 E6.14735
+G1 X94.687 Y105.134 E6.17810
+G1 X94.182 Y104.554 E6.21512
+G1 X93.805 Y104.026 E6.24631
+G1 X93.420 Y103.360 E6.28332
+G1 X93.150 Y102.770 E6.31450
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F978
+G1 X92.526 Y102.143 E6.34990
+G1 X92.345 Y101.358 E6.38865
+G1 X92.255 Y100.679 E6.42162
+G1 X92.226 Y99.864 E6.46081
+G1 X92.282 Y99.061 E6.49955
+G1 X92.395 Y98.384 E6.53252
+G1 X92.606 Y97.597 E6.57176
+G1 X92.843 Y96.963 E6.60428
+G1 X93.200 Y96.231 E6.64347
+G1 X93.627 Y95.547 E6.68222
+G1 X94.044 Y95.003 E6.71519
+G1 X94.599 Y94.407 E6.75438
+G1 X95.207 Y93.879 E6.79312
+G1 X95.765 Y93.480 E6.82610
+G1 X96.463 Y93.076 E6.86488
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93709
+G1 X98.516 Y92.368 E6.96962
+G1 X99.322 Y92.255 E7.00881
+G1 X100.127 Y92.226 E7.04755
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11975
+G1 X102.272 Y92.565 E7.15228
+G1 X103.038 Y92.843 E7.19147
+G1 X103.769 Y93.200 E7.23061
+G1 X104.453 Y93.627 E7.26936
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34151
+G1 X106.127 Y95.214 E7.38070
+G1 X106.520 Y95.766 E7.41328
+G1 X106.864 Y96.349 E7.44585
+G1 X107.209 Y97.088 E7.48504
+G1 X107.474 Y97.858 E7.52423
+G1 X107.632 Y98.516 E7.55675
+G1 X107.745 Y99.322 E7.59594
+G1 X107.774 Y100.136 E7.63508
+G1 X107.718 Y100.939 E7.67383
+G1 X107.605 Y101.617 E7.70685
+G1 X107.435 Y102.272 E7.73942
+G1 X107.157 Y103.038 E7.77861
+G1 X106.800 Y103.769 E7.81775
+G1 X106.368 Y104.460 E7.85694
+G1 X105.956 Y104.997 E7.88946
+G1 X105.401 Y105.593 E7.92865
+G1 X104.786 Y106.127 E7.96784
+G1 X104.234 Y106.520 E8.00041
+G1 X103.651 Y106.864 E8.03299
+G1 X102.912 Y107.209 E8.07218
+G1 X102.142 Y107.474 E8.11136
+G1 X101.484 Y107.632 E8.14389
+G1 X100.678 Y107.745 E8.18308
+G1 X99.864 Y107.774 E8.22222
+G1 X99.061 Y107.718 E8.26097
+G1 X98.384 Y107.605 E8.29394
+G1 X97.597 Y107.394 E8.33317
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40489
+G1 X95.541 Y106.369 E8.44403
+G1 X94.899 Y105.867 E8.48322
+G1 X94.408 Y105.401 E8.51575
+G1 X93.879 Y104.793 E8.55454
+G1 X93.480 Y104.235 E8.58751
+G1 X93.076 Y103.537 E8.62630
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68709
+G1 X92.697 Y102.175 F7800.000
+G1 X93.278 Y101.459
+G1 F978
+G1 X98.306 Y106.486 E9.02905
+G1 X98.609 Y106.567 E9.04416
+G1 X99.185 Y106.663 E9.07222
+G1 X99.883 Y106.712 E9.10586
+G1 X100.585 Y106.687 E9.13967
+G1 X101.286 Y106.589 E9.17373
+G1 X101.845 Y106.455 E9.20136
+G1 X102.515 Y106.224 E9.23542
+G1 X103.157 Y105.925 E9.26949
+G1 X103.656 Y105.630 E9.29739
+G1 X104.129 Y105.293 E9.32529
+G1 X104.743 Y104.743 E9.36496
+G1 X95.257 Y95.257 E10.01020
+G1 X95.865 Y94.712 E10.04946
+G1 X96.340 Y94.373 E10.07754
+G1 X96.950 Y94.020 E10.11143
+G1 X97.480 Y93.778 E10.13948
+G1 X98.155 Y93.545 E10.17380
+G1 X98.714 Y93.411 E10.20143
+G1 X99.415 Y93.313 E10.23551
+G1 X100.114 Y93.288 E10.26915
+G1 X100.697 Y93.323 E10.29721
+G1 X101.401 Y93.435 E10.33152
+G1 X101.690 Y93.509 E10.34584
+G1 X106.727 Y98.547 E10.68849
+G1 X106.779 Y101.178 F7800.000
+G1 F978
+G1 X94.720 Y104.409 E11.28894
+G1 X93.221 Y98.822 F7800.000
+G1 F978
+G1 X105.280 Y95.591 E11.88938
+G1 X104.624 Y105.093 F7800.000
+G1 F978
+G1 X106.468 Y98.210 E12.23208
+G1 X106.455 Y98.155 E12.23482
+G1 X106.224 Y97.485 E12.26889
+G1 X105.925 Y96.843 E12.30295
+G1 X105.630 Y96.344 E12.33085
+G1 X105.293 Y95.871 E12.35875
+G1 X104.829 Y95.337 E12.39281
+G1 X104.311 Y94.854 E12.42686
+G1 X103.848 Y94.499 E12.45492
+G1 X103.255 Y94.129 E12.48856
+G1 X102.623 Y93.821 E12.52237
+G1 X101.957 Y93.579 E12.55643
+G1 X101.736 Y93.521 E12.56743
+G1 X98.265 Y106.475 E13.21244
+G1 X97.920 Y106.383 E13.22961
+G1 X97.382 Y106.182 E13.25724
+G1 X96.746 Y105.871 E13.29130
+G1 X96.150 Y105.499 E13.32510
+G1 X95.592 Y105.063 E13.35916
+G1 X95.175 Y104.667 E13.38681
+G1 X94.712 Y104.135 E13.42072
+G1 X94.373 Y103.660 E13.44879
+G1 X94.020 Y103.050 E13.48268
+G1 X93.778 Y102.520 E13.51074
+G1 X93.533 Y101.788 E13.54787
+G1 X95.376 Y94.907 E13.89048
+G1 E11.89048 F2400.00000
+G92 E0
+G1 X150.574 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X153.961 Y100.996 E2.16288
+G1 X153.961 Y114.004 E2.78850
+G1 X150.574 Y114.004 E2.95138
+G1 X150.574 Y101.056 E3.57411
+G1 X150.189 Y100.611 F7800.000
+G1 F900
+G1 X154.346 Y100.611 E3.77408
+G1 X154.346 Y114.389 E4.43679
+G1 X150.189 Y114.389 E4.63677
+G1 X150.189 Y100.671 E5.29659
+G1 X149.803 Y100.225 F7800.000
+G1 F900
+G1 X154.732 Y100.225 E5.53366
+G1 X154.732 Y114.775 E6.23346
+G1 X149.803 Y114.775 E6.47053
+G1 X149.803 Y100.285 E7.16745
+G1 X150.169 Y100.386 F7800.000
+G1 X153.845 Y101.901
+G1 F978
+G1 X153.229 Y101.285 E7.20986
+G1 X152.677 Y101.285 E7.23674
+G1 X153.671 Y102.280 E7.30521
+G1 X153.671 Y102.832 E7.33208
+G1 X152.125 Y101.285 E7.43856
+G1 X151.573 Y101.285 E7.46543
+G1 X153.671 Y103.384 E7.60992
+G1 X153.671 Y103.936 E7.63679
+G1 X151.021 Y101.285 E7.81928
+G1 X150.863 Y101.285 E7.82696
+G1 X150.863 Y101.680 E7.84616
+G1 X153.671 Y104.488 E8.03950
+G1 X153.671 Y105.040 E8.06637
+G1 X150.863 Y102.232 E8.25971
+G1 X150.863 Y102.784 E8.28659
+G1 X153.671 Y105.592 E8.47993
+G1 X153.671 Y106.144 E8.50680
+G1 X150.863 Y103.336 E8.70014
+G1 X150.863 Y103.888 E8.72702
+G1 X153.671 Y106.696 E8.92036
+G1 X153.671 Y107.248 E8.94723
+G1 X150.863 Y104.440 E9.14057
+G1 X150.863 Y104.992 E9.16744
+G1 X153.671 Y107.800 E9.36078
+G1 X153.671 Y108.352 E9.38766
+G1 X150.863 Y105.544 E9.58100
+G1 X150.863 Y106.096 E9.60787
+G1 X153.671 Y108.904 E9.80121
+G1 X153.671 Y109.456 E9.82809
+G1 X150.863 Y106.648 E10.02143
+G1 X150.863 Y107.200 E10.04830
+G1 X153.671 Y110.008 E10.24164
+G1 X153.671 Y110.560 E10.26852
+G1 X150.863 Y107.752 E10.46186
+G1 X150.863 Y108.304 E10.48873
+G1 X153.671 Y111.112 E10.68207
+G1 X153.671 Y111.664 E10.70895
+G1 X150.863 Y108.856 E10.90229
+G1 X150.863 Y109.408 E10.92916
+G1 X153.671 Y112.216 E11.12250
+G1 X153.671 Y112.768 E11.14938
+G1 X150.863 Y109.960 E11.34272
+G1 X150.863 Y110.512 E11.36959
+G1 X153.671 Y113.320 E11.56293
+G1 X153.671 Y113.715 E11.58213
+G1 X153.514 Y113.715 E11.58980
+G1 X150.863 Y111.064 E11.77229
+G1 X150.863 Y111.616 E11.79916
+G1 X152.962 Y113.715 E11.94364
+G1 X152.410 Y113.715 E11.97051
+G1 X150.863 Y112.168 E12.07698
+G1 X150.863 Y112.720 E12.10386
+G1 X151.858 Y113.715 E12.17232
+G1 X151.306 Y113.715 E12.19920
+G1 X150.690 Y113.099 E12.24160
+G1 Z14.450 F7800.000
+G1 E10.24160 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F833
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.882 E2.10619
+G1 X93.049 Y99.148 E2.14156
+G1 X93.150 Y98.548 E2.17083
+G1 X93.340 Y97.836 E2.20629
+G1 X93.602 Y97.153 E2.24145
+G1 X93.873 Y96.609 E2.27072
+G1 X94.264 Y95.984 E2.30617
+G1 X94.718 Y95.403 E2.34163
+G1 X95.135 Y94.963 E2.37081
+G1 X95.590 Y94.561 E2.39998
+G1 X96.186 Y94.127 E2.43545
+G1 X96.819 Y93.761 E2.47061
+G1 X97.373 Y93.509 E2.49988
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.59997
+G1 X100.120 Y92.998 E2.63513
+G1 X100.728 Y93.035 E2.66440
+G1 X101.456 Y93.151 E2.69986
+G1 X102.162 Y93.340 E2.73502
+G1 X102.732 Y93.552 E2.76429
+G1 X103.395 Y93.876 E2.79975
+G1 X104.015 Y94.263 E2.83491
+G1 X104.498 Y94.633 E2.86418
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96427
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.733 Y98.074 E3.06436
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.122 E3.16405
+G1 X106.951 Y100.852 E3.19921
+G1 X106.850 Y101.456 E3.22869
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29331
+G1 X106.124 Y103.395 E3.32858
+G1 X105.737 Y104.015 E3.36374
+G1 X105.367 Y104.498 E3.39300
+G1 X104.864 Y105.037 E3.42846
+G1 X104.308 Y105.521 E3.46392
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52226
+G1 X102.623 Y106.493 E3.55773
+G1 X101.926 Y106.733 E3.59319
+G1 X101.340 Y106.873 E3.62215
+G1 X100.610 Y106.976 E3.65761
+G1 X99.878 Y107.001 E3.69288
+G1 X99.148 Y106.951 E3.72804
+G1 X98.548 Y106.850 E3.75731
+G1 X97.832 Y106.659 E3.79297
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85740
+G1 X95.985 Y105.737 E3.89256
+G1 X95.502 Y105.367 E3.92183
+G1 X94.960 Y104.861 E3.95749
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.814 E4.02192
+G1 X93.761 Y103.181 E4.05708
+G1 X93.509 Y102.627 E4.08635
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F833
+G1 X92.898 Y102.037 E4.11989
+G1 X92.724 Y101.283 E4.15709
+G1 X92.629 Y100.513 E4.19441
+G1 X92.612 Y99.874 E4.22516
+G1 X92.666 Y99.103 E4.26231
+G1 X92.772 Y98.466 E4.29336
+G1 X92.973 Y97.717 E4.33069
+G1 X93.249 Y96.998 E4.36771
+G1 X93.536 Y96.420 E4.39876
+G1 X93.948 Y95.762 E4.43608
+G1 X94.425 Y95.151 E4.47340
+G1 X94.867 Y94.685 E4.50428
+G1 X95.348 Y94.260 E4.53515
+G1 X95.976 Y93.803 E4.57248
+G1 X96.642 Y93.418 E4.60950
+G1 X97.230 Y93.150 E4.64055
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70875
+G1 X99.356 Y92.640 E4.74608
+G1 X100.125 Y92.612 E4.78310
+G1 X100.770 Y92.652 E4.81415
+G1 X101.536 Y92.773 E4.85147
+G1 X102.280 Y92.972 E4.88849
+G1 X102.885 Y93.198 E4.91954
+G1 X103.582 Y93.538 E4.95687
+G1 X104.235 Y93.946 E4.99389
+G1 X104.747 Y94.338 E5.02494
+G1 X105.315 Y94.867 E5.06226
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13046
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.232 E5.19866
+G1 X107.103 Y97.966 E5.23598
+G1 X107.252 Y98.588 E5.26673
+G1 X107.360 Y99.356 E5.30405
+G1 X107.387 Y100.129 E5.34125
+G1 X107.334 Y100.897 E5.37827
+G1 X107.227 Y101.536 E5.40946
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47765
+G1 X106.462 Y103.582 E5.51485
+G1 X106.054 Y104.235 E5.55187
+G1 X105.662 Y104.747 E5.58292
+G1 X105.133 Y105.315 E5.62024
+G1 X104.547 Y105.824 E5.65756
+G1 X104.024 Y106.197 E5.68844
+G1 X103.471 Y106.523 E5.71931
+G1 X102.768 Y106.851 E5.75664
+G1 X102.034 Y107.103 E5.79396
+G1 X101.412 Y107.252 E5.82471
+G1 X100.644 Y107.360 E5.86203
+G1 X99.871 Y107.387 E5.89924
+G1 X99.103 Y107.334 E5.93625
+G1 X98.466 Y107.228 E5.96731
+G1 X97.714 Y107.026 E6.00475
+G1 X97.115 Y106.802 E6.03550
+G1 X96.418 Y106.462 E6.07283
+G1 X95.765 Y106.054 E6.10985
+G1 X95.253 Y105.662 E6.14090
+G1 X94.683 Y105.131 E6.17835
+G1 X94.260 Y104.652 E6.20910
+G1 X93.803 Y104.024 E6.24643
+G1 X93.418 Y103.358 E6.28344
+G1 X93.150 Y102.770 E6.31450
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F833
+G1 X92.526 Y102.143 E6.34990
+G1 X92.343 Y101.350 E6.38904
+G1 X92.244 Y100.541 E6.42823
+G1 X92.226 Y99.865 E6.46076
+G1 X92.283 Y99.058 E6.49969
+G1 X92.395 Y98.384 E6.53252
+G1 X92.606 Y97.597 E6.57171
+G1 X92.895 Y96.843 E6.61059
+G1 X93.200 Y96.232 E6.64343
+G1 X93.631 Y95.541 E6.68261
+G1 X94.133 Y94.899 E6.72180
+G1 X94.599 Y94.407 E6.75438
+G1 X95.106 Y93.959 E6.78695
+G1 X95.766 Y93.480 E6.82614
+G1 X96.466 Y93.075 E6.86502
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93709
+G1 X98.516 Y92.368 E6.96962
+G1 X99.322 Y92.255 E7.00881
+G1 X100.130 Y92.226 E7.04768
+G1 X100.812 Y92.268 E7.08052
+G1 X101.616 Y92.395 E7.11971
+G1 X102.397 Y92.604 E7.15859
+G1 X103.037 Y92.843 E7.19143
+G1 X103.769 Y93.200 E7.23061
+G1 X104.455 Y93.628 E7.26949
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34151
+G1 X106.127 Y95.214 E7.38070
+G1 X106.520 Y95.766 E7.41328
+G1 X106.864 Y96.349 E7.44585
+G1 X107.209 Y97.088 E7.48504
+G1 X107.474 Y97.858 E7.52423
+G1 X107.632 Y98.516 E7.55675
+G1 X107.745 Y99.322 E7.59594
+G1 X107.774 Y100.136 E7.63509
+G1 X107.717 Y100.942 E7.67396
+G1 X107.605 Y101.617 E7.70685
+G1 X107.435 Y102.272 E7.73942
+G1 X107.157 Y103.038 E7.77861
+G1 X106.800 Y103.769 E7.81775
+G1 X106.372 Y104.455 E7.85663
+G1 X105.956 Y104.997 E7.88947
+G1 X105.401 Y105.593 E7.92865
+G1 X104.786 Y106.127 E7.96784
+G1 X104.234 Y106.520 E8.00042
+G1 X103.651 Y106.864 E8.03299
+G1 X102.912 Y107.209 E8.07218
+G1 X102.142 Y107.474 E8.11137
+G1 X101.484 Y107.632 E8.14389
+G1 X100.678 Y107.745 E8.18308
+G1 X99.864 Y107.774 E8.22222
+G1 X99.058 Y107.717 E8.26110
+G1 X98.384 Y107.605 E8.29394
+G1 X97.597 Y107.394 E8.33317
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40489
+G1 X95.545 Y106.372 E8.44377
+G1 X95.003 Y105.956 E8.47661
+G1 X94.407 Y105.400 E8.51584
+G1 X93.959 Y104.894 E8.54837
+G1 X93.480 Y104.234 E8.58756
+G1 X93.075 Y103.534 E8.62643
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68709
+G1 X92.697 Y102.175 F7800.000
+G1 X94.116 Y96.444
+M106 S255
+G1 F3600
+G1 X95.412 Y95.148 E8.78785
+G1 X95.840 Y94.776 E8.81901
+G1 X96.362 Y94.397 E8.85447
+G1 X96.966 Y94.048 E8.89281
+G1 X97.330 Y93.882 E8.91481
+G1 X93.878 Y97.334 E9.18317
+G1 X93.646 Y97.935 E9.21861
+G1 X93.544 Y98.319 E9.24043
+G1 X98.325 Y93.538 E9.61215
+G1 X98.720 Y93.443 E9.63447
+G1 X99.128 Y93.386 E9.65714
+G1 X93.377 Y99.136 E10.10423
+G1 X93.323 Y99.841 E10.14310
+G1 X99.834 Y93.330 E10.64932
+G1 X100.115 Y93.320 E10.66475
+G1 X100.474 Y93.342 E10.68450
+G1 X93.341 Y100.474 E11.23903
+G1 X93.408 Y101.058 E11.27134
+G1 X101.054 Y93.412 E11.86577
+G1 X101.389 Y93.465 E11.88442
+G1 X101.597 Y93.521 E11.89622
+G1 X93.522 Y101.596 E12.52403
+G1 X93.578 Y101.841 E12.53788
+G1 X93.668 Y102.101 E12.55297
+G1 X102.103 Y93.666 E13.20878
+G1 X102.580 Y93.839 E13.23670
+G1 X93.840 Y102.579 E13.91619
+G1 X94.044 Y103.026 E13.94320
+G1 X103.020 Y94.050 E14.64104
+G1 X103.239 Y94.157 E14.65444
+G1 X103.439 Y94.282 E14.66741
+G1 X94.282 Y103.439 E15.37936
+G1 X94.539 Y103.834 E15.40522
+G1 X103.839 Y94.533 E16.12830
+G1 X104.208 Y94.816 E16.15383
+G1 X94.817 Y104.207 E16.88397
+G1 X95.120 Y104.555 E16.90933
+G1 X104.552 Y95.123 E17.64266
+G1 X104.806 Y95.359 E17.66174
+G1 X104.880 Y95.445 E17.66800
+G1 X95.448 Y104.877 E18.40132
+G1 X95.795 Y105.181 E18.42668
+G1 X105.183 Y95.793 E19.15655
+G1 X105.463 Y96.164 E19.18210
+G1 X96.161 Y105.467 E19.90532
+G1 X96.561 Y105.718 E19.93128
+G1 X105.720 Y96.559 E20.64336
+G1 X105.952 Y96.978 E20.66969
+G1 X96.980 Y105.950 E21.36723
+G1 X97.419 Y106.161 E21.39405
+G1 X106.159 Y97.422 E22.07352
+G1 X106.332 Y97.899 E22.10145
+G1 X97.893 Y106.338 E22.75758
+G1 X98.403 Y106.479 E22.78668
+G1 X106.481 Y98.402 E23.41467
+G1 X106.557 Y98.720 E23.43264
+G1 X106.589 Y98.945 E23.44514
+G1 X98.943 Y106.590 E24.03958
+G1 X99.188 Y106.631 E24.05321
+G1 X99.529 Y106.655 E24.07205
+G1 X106.659 Y99.525 E24.62635
+G1 X106.677 Y100.159 E24.66117
+G1 X100.166 Y106.670 E25.16739
+G1 X100.582 Y106.655 E25.19030
+G1 X100.872 Y106.614 E25.20638
+G1 X106.623 Y100.864 E25.65349
+G1 X106.535 Y101.390 E25.68279
+G1 X106.461 Y101.677 E25.69909
+G1 X101.675 Y106.462 E26.07117
+G1 X101.836 Y106.424 E26.08026
+G1 X102.503 Y106.194 E26.11902
+G1 X102.674 Y106.114 E26.12944
+G1 X106.122 Y102.666 E26.39752
+G1 X105.843 Y103.239 E26.43255
+G1 X105.471 Y103.834 E26.47114
+G1 X105.121 Y104.290 E26.50273
+G1 X104.737 Y104.702 E26.53370
+G1 X103.547 Y105.892 E26.62624
+M106 S252.45
+G1 E24.62624 F2400.00000
+G92 E0
+G1 X150.779 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F833
+G1 X153.522 Y100.996 E2.13192
+G1 X153.522 Y114.004 E2.75753
+G1 X150.779 Y114.004 E2.88945
+G1 X150.779 Y101.056 E3.51218
+G1 X150.394 Y100.611 F7800.000
+G1 F833
+G1 X153.908 Y100.611 E3.68120
+G1 X153.908 Y114.389 E4.34391
+G1 X150.394 Y114.389 E4.51292
+G1 X150.394 Y100.671 E5.17274
+G1 X150.008 Y100.225 F7800.000
+G1 F833
+G1 X154.293 Y100.225 E5.37885
+G1 X154.293 Y114.775 E6.07865
+G1 X150.008 Y114.775 E6.28476
+G1 X150.008 Y100.285 E6.98168
+G1 X150.372 Y100.391 F7800.000
+G1 X150.895 Y101.896
+G1 F833
+G1 X151.506 Y101.285 E7.02350
+G1 X152.055 Y101.285 E7.05005
+G1 X151.069 Y102.272 E7.11755
+G1 X151.069 Y102.820 E7.14411
+G1 X152.604 Y101.285 E7.24916
+G1 X153.152 Y101.285 E7.27572
+G1 X151.069 Y103.369 E7.41833
+G1 X151.069 Y103.918 E7.44488
+G1 X153.233 Y101.753 E7.59302
+G1 X153.233 Y102.302 E7.61957
+G1 X151.069 Y104.467 E7.76770
+G1 X151.069 Y105.015 E7.79426
+G1 X153.233 Y102.851 E7.94239
+G1 X153.233 Y103.400 E7.96895
+G1 X151.069 Y105.564 E8.11708
+G1 X151.069 Y106.113 E8.14364
+G1 X153.233 Y103.948 E8.29177
+G1 X153.233 Y104.497 E8.31833
+G1 X151.069 Y106.662 E8.46646
+G1 X151.069 Y107.210 E8.49302
+G1 X153.233 Y105.046 E8.64115
+G1 X153.233 Y105.595 E8.66771
+G1 X151.069 Y107.759 E8.81584
+G1 X151.069 Y108.308 E8.84240
+G1 X153.233 Y106.143 E8.99053
+G1 X153.233 Y106.692 E9.01709
+G1 X151.069 Y108.857 E9.16522
+G1 X151.069 Y109.405 E9.19178
+G1 X153.233 Y107.241 E9.33991
+G1 X153.233 Y107.790 E9.36647
+G1 X151.069 Y109.954 E9.51460
+G1 X151.069 Y110.503 E9.54115
+G1 X153.233 Y108.338 E9.68929
+G1 X153.233 Y108.887 E9.71584
+G1 X151.069 Y111.051 E9.86398
+G1 X151.069 Y111.600 E9.89053
+G1 X153.233 Y109.436 E10.03867
+G1 X153.233 Y109.985 E10.06522
+G1 X151.069 Y112.149 E10.21336
+G1 X151.069 Y112.698 E10.23991
+G1 X153.233 Y110.533 E10.38804
+G1 X153.233 Y111.082 E10.41460
+G1 X151.069 Y113.246 E10.56273
+G1 X151.069 Y113.715 E10.58539
+G1 X151.149 Y113.715 E10.58929
+G1 X153.233 Y111.631 E10.73191
+G1 X153.233 Y112.180 E10.75846
+G1 X151.698 Y113.715 E10.86352
+G1 X152.247 Y113.715 E10.89008
+G1 X153.233 Y112.728 E10.95758
+G1 X153.233 Y113.277 E10.98414
+G1 X152.622 Y113.888 E11.02596
+M106 S237.15
+G1 Z14.750 F7800.000
+G1 E9.02596 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.484 E2.07722
+G1 X92.998 Y99.882 E2.10619
+G1 X93.050 Y99.146 E2.14169
+G1 X93.150 Y98.548 E2.17083
+G1 X93.340 Y97.835 E2.20632
+G1 X93.552 Y97.268 E2.23546
+G1 X93.876 Y96.605 E2.27092
+G1 X94.264 Y95.983 E2.30621
+G1 X94.633 Y95.502 E2.33535
+G1 X95.139 Y94.960 E2.37102
+G1 X95.590 Y94.561 E2.39998
+G1 X96.186 Y94.127 E2.43545
+G1 X96.822 Y93.760 E2.47074
+G1 X97.373 Y93.509 E2.49988
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.59997
+G1 X100.123 Y92.998 E2.63526
+G1 X100.728 Y93.035 E2.66440
+G1 X101.456 Y93.151 E2.69986
+G1 X102.165 Y93.340 E2.73515
+G1 X102.732 Y93.552 E2.76429
+G1 X103.395 Y93.876 E2.79974
+G1 X104.020 Y94.266 E2.83521
+G1 X104.498 Y94.633 E2.86417
+G1 X105.037 Y95.136 E2.89963
+G1 X105.521 Y95.692 E2.93509
+G1 X105.873 Y96.186 E2.96427
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02891
+G1 X106.732 Y98.071 E3.06420
+G1 X106.873 Y98.660 E3.09334
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19322
+G1 X106.849 Y101.456 E3.22868
+G1 X106.660 Y102.165 E3.26397
+G1 X106.448 Y102.732 E3.29311
+G1 X106.124 Y103.395 E3.32857
+G1 X105.734 Y104.020 E3.36403
+G1 X105.367 Y104.498 E3.39299
+G1 X104.864 Y105.037 E3.42846
+G1 X104.308 Y105.521 E3.46392
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52227
+G1 X102.623 Y106.493 E3.55773
+G1 X101.929 Y106.732 E3.59302
+G1 X101.340 Y106.873 E3.62216
+G1 X100.610 Y106.976 E3.65762
+G1 X99.873 Y107.001 E3.69308
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75751
+G1 X97.835 Y106.660 E3.79280
+G1 X97.268 Y106.448 E3.82194
+G1 X96.605 Y106.124 E3.85740
+G1 X95.983 Y105.736 E3.89269
+G1 X95.502 Y105.367 E3.92183
+G1 X94.960 Y104.861 E3.95749
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.814 E4.02192
+G1 X93.760 Y103.178 E4.05721
+G1 X93.509 Y102.627 E4.08635
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F3600
+G1 X92.898 Y102.037 E4.11989
+G1 X92.724 Y101.283 E4.15709
+G1 X92.629 Y100.513 E4.19441
+G1 X92.612 Y99.874 E4.22516
+G1 X92.666 Y99.100 E4.26244
+G1 X92.772 Y98.466 E4.29336
+G1 X92.973 Y97.718 E4.33064
+G1 X93.198 Y97.115 E4.36156
+G1 X93.538 Y96.418 E4.39888
+G1 X93.947 Y95.763 E4.43603
+G1 X94.338 Y95.253 E4.46696
+G1 X94.869 Y94.683 E4.50441
+G1 X95.348 Y94.260 E4.53515
+G1 X95.976 Y93.803 E4.57248
+G1 X96.645 Y93.417 E4.60963
+G1 X97.230 Y93.150 E4.64055
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70875
+G1 X99.356 Y92.640 E4.74607
+G1 X100.128 Y92.612 E4.78323
+G1 X100.770 Y92.652 E4.81415
+G1 X101.536 Y92.773 E4.85147
+G1 X102.282 Y92.973 E4.88862
+G1 X102.885 Y93.198 E4.91954
+G1 X103.582 Y93.538 E4.95686
+G1 X104.240 Y93.949 E4.99419
+G1 X104.747 Y94.338 E5.02493
+G1 X105.315 Y94.867 E5.06226
+G1 X105.824 Y95.453 E5.09958
+G1 X106.197 Y95.976 E5.13046
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.232 E5.19866
+G1 X107.102 Y97.963 E5.23581
+G1 X107.252 Y98.588 E5.26673
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34138
+G1 X107.348 Y100.770 E5.37212
+G1 X107.227 Y101.536 E5.40945
+G1 X107.027 Y102.282 E5.44660
+G1 X106.802 Y102.885 E5.47752
+G1 X106.462 Y103.582 E5.51485
+G1 X106.051 Y104.240 E5.55217
+G1 X105.662 Y104.747 E5.58292
+G1 X105.133 Y105.315 E5.62024
+G1 X104.547 Y105.824 E5.65757
+G1 X104.024 Y106.197 E5.68844
+G1 X103.471 Y106.523 E5.71931
+G1 X102.768 Y106.851 E5.75664
+G1 X102.037 Y107.102 E5.79379
+G1 X101.412 Y107.252 E5.82471
+G1 X100.644 Y107.360 E5.86204
+G1 X99.868 Y107.388 E5.89936
+G1 X99.230 Y107.348 E5.93011
+G1 X98.464 Y107.227 E5.96743
+G1 X97.718 Y107.027 E6.00458
+G1 X97.115 Y106.802 E6.03551
+G1 X96.418 Y106.462 E6.07283
+G1 X95.763 Y106.053 E6.10998
+G1 X95.253 Y105.662 E6.14090
+G1 X94.683 Y105.131 E6.17835
+G1 X94.260 Y104.652 E6.20910
+G1 X93.803 Y104.024 E6.24642
+G1 X93.417 Y103.355 E6.28358
+G1 X93.150 Y102.770 E6.31450
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34990
+G1 X92.343 Y101.350 E6.38904
+G1 X92.244 Y100.541 E6.42823
+G1 X92.226 Y99.865 E6.46076
+G1 X92.283 Y99.055 E6.49982
+G1 X92.395 Y98.384 E6.53253
+G1 X92.605 Y97.600 E6.57158
+G1 X92.843 Y96.963 E6.60429
+G1 X93.200 Y96.231 E6.64347
+G1 X93.630 Y95.543 E6.68249
+G1 X94.044 Y95.003 E6.71519
+G1 X94.600 Y94.407 E6.75442
+G1 X95.106 Y93.959 E6.78695
+G1 X95.766 Y93.480 E6.82614
+G1 X96.468 Y93.074 E6.86515
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93709
+G1 X98.516 Y92.368 E6.96962
+G1 X99.322 Y92.255 E7.00881
+G1 X100.133 Y92.226 E7.04782
+G1 X100.812 Y92.268 E7.08052
+G1 X101.616 Y92.395 E7.11971
+G1 X102.400 Y92.605 E7.15872
+G1 X103.037 Y92.843 E7.19143
+G1 X103.769 Y93.200 E7.23061
+G1 X104.460 Y93.632 E7.26980
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34152
+G1 X106.127 Y95.214 E7.38070
+G1 X106.520 Y95.766 E7.41328
+G1 X106.864 Y96.349 E7.44585
+G1 X107.209 Y97.088 E7.48504
+G1 X107.473 Y97.854 E7.52405
+G1 X107.632 Y98.516 E7.55676
+G1 X107.745 Y99.322 E7.59594
+G1 X107.774 Y100.137 E7.63513
+G1 X107.732 Y100.812 E7.66766
+G1 X107.605 Y101.616 E7.70685
+G1 X107.395 Y102.400 E7.74586
+G1 X107.157 Y103.037 E7.77856
+G1 X106.800 Y103.769 E7.81775
+G1 X106.368 Y104.460 E7.85694
+G1 X105.956 Y104.997 E7.88947
+G1 X105.401 Y105.593 E7.92865
+G1 X104.786 Y106.127 E7.96784
+G1 X104.234 Y106.520 E8.00042
+G1 X103.651 Y106.864 E8.03299
+G1 X102.912 Y107.209 E8.07218
+G1 X102.146 Y107.473 E8.11119
+G1 X101.484 Y107.632 E8.14390
+G1 X100.678 Y107.745 E8.18308
+G1 X99.863 Y107.774 E8.22227
+G1 X99.188 Y107.732 E8.25480
+G1 X98.384 Y107.605 E8.29399
+G1 X97.600 Y107.395 E8.33300
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40489
+G1 X95.543 Y106.370 E8.44390
+G1 X95.003 Y105.956 E8.47661
+G1 X94.407 Y105.400 E8.51584
+G1 X93.959 Y104.894 E8.54837
+G1 X93.480 Y104.234 E8.58756
+G1 X93.074 Y103.532 E8.62657
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68709
+G1 X92.697 Y102.175 F7800.000
+G1 X93.596 Y102.524
+G1 F1200
+G1 X97.131 Y106.059 E8.93314
+G1 X97.382 Y106.182 E8.94689
+G1 X98.047 Y106.417 E8.98158
+G1 X93.582 Y101.953 E9.29227
+G1 X93.400 Y101.212 E9.32981
+G1 X98.782 Y106.594 E9.70439
+G1 X99.430 Y106.685 E9.73661
+G1 X93.316 Y100.570 E10.16215
+G1 X93.290 Y99.987 E10.19091
+G1 X100.011 Y106.707 E10.65865
+G1 X100.550 Y106.688 E10.68520
+G1 X93.318 Y99.456 E11.18854
+G1 X93.375 Y98.955 E11.21337
+G1 X101.043 Y106.623 E11.74703
+G1 X101.512 Y106.534 E11.77054
+G1 X93.465 Y98.487 E12.33059
+G1 X93.583 Y98.047 E12.35302
+G1 X101.953 Y106.417 E12.93556
+G1 X102.368 Y106.274 E12.95716
+G1 X93.725 Y97.631 E13.55869
+G1 X93.889 Y97.237 E13.57970
+G1 X102.761 Y106.109 E14.19715
+G1 X103.142 Y105.932 E14.21782
+G1 X94.072 Y96.862 E14.84903
+G1 X94.277 Y96.509 E14.86912
+G1 X103.494 Y105.726 E15.51061
+G1 X103.831 Y105.505 E15.53045
+G1 X94.491 Y96.165 E16.18049
+G1 X94.732 Y95.848 E16.20009
+G1 X104.155 Y105.271 E16.85588
+G1 X104.453 Y105.011 E16.87534
+G1 X94.988 Y95.546 E17.53411
+G1 X95.257 Y95.257 E17.55354
+G1 X104.743 Y104.743 E18.21375
+G1 X105.012 Y104.454 E18.23318
+G1 X95.545 Y94.987 E18.89209
+G1 X95.847 Y94.731 E18.91158
+G1 X105.268 Y104.152 E19.56725
+G1 X105.509 Y103.835 E19.58685
+G1 X96.170 Y94.496 E20.23677
+G1 X96.508 Y94.276 E20.25660
+G1 X105.723 Y103.491 E20.89798
+G1 X105.928 Y103.138 E20.91807
+G1 X96.861 Y94.071 E21.54909
+G1 X97.237 Y93.889 E21.56963
+G1 X106.111 Y102.763 E22.18725
+G1 X106.182 Y102.618 E22.19519
+G1 X106.275 Y102.369 E22.20828
+G1 X97.631 Y93.726 E22.80982
+G1 X98.047 Y93.583 E22.83142
+G1 X106.417 Y101.953 E23.41397
+G1 X106.535 Y101.513 E23.43639
+G1 X98.487 Y93.466 E23.99646
+G1 X98.957 Y93.377 E24.01997
+G1 X106.622 Y101.042 E24.55344
+G1 X106.686 Y100.548 E24.57796
+G1 X99.449 Y93.312 E25.08161
+G1 X99.988 Y93.293 E25.10816
+G1 X106.708 Y100.012 E25.57583
+G1 X106.688 Y99.434 E25.60430
+G1 X100.569 Y93.315 E26.03014
+G1 X101.217 Y93.406 E26.06235
+G1 X106.599 Y98.787 E26.43689
+G1 X106.418 Y98.048 E26.47434
+G1 X101.953 Y93.583 E26.78510
+G1 X102.618 Y93.818 E26.81982
+G1 X102.868 Y93.941 E26.83353
+G1 X106.405 Y97.477 E27.07964
+G1 X105.835 Y96.349 F7800.000
+G1 F1200
+G1 X103.669 Y94.183 E27.23035
+G1 X94.170 Y103.656 F7800.000
+G1 F1200
+G1 X96.330 Y105.816 E27.38071
+G1 E25.38071 F2400.00000
+G92 E0
+G1 X150.985 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X153.084 Y100.996 E2.10096
+G1 X153.084 Y114.004 E2.72657
+G1 X150.985 Y114.004 E2.82753
+G1 X150.985 Y101.056 E3.45026
+G1 X150.599 Y100.611 F7800.000
+G1 F900
+G1 X153.469 Y100.611 E3.58831
+G1 X153.469 Y114.389 E4.25102
+G1 X150.599 Y114.389 E4.38907
+G1 X150.599 Y100.671 E5.04889
+G1 X150.213 Y100.225 F7800.000
+G1 F900
+G1 X153.855 Y100.225 E5.22404
+G1 X153.855 Y114.775 E5.92384
+G1 X150.213 Y114.775 E6.09899
+G1 X150.213 Y100.285 E6.79591
+G1 X150.575 Y100.396 F7800.000
+G1 X152.968 Y101.923
+G1 F1200
+G1 X152.331 Y101.285 E6.84091
+G1 X151.765 Y101.285 E6.86918
+G1 X152.794 Y102.315 E6.94191
+G1 X152.794 Y102.882 E6.97018
+G1 X151.274 Y101.361 E7.07757
+G1 X151.274 Y101.927 E7.10584
+G1 X152.794 Y103.448 E7.21322
+G1 X152.794 Y104.014 E7.24150
+G1 X151.274 Y102.493 E7.34888
+G1 X151.274 Y103.060 E7.37715
+G1 X152.794 Y104.580 E7.48453
+G1 X152.794 Y105.146 E7.51281
+G1 X151.274 Y103.626 E7.62019
+G1 X151.274 Y104.192 E7.64846
+G1 X152.794 Y105.713 E7.75585
+G1 X152.794 Y106.279 E7.78412
+G1 X151.274 Y104.758 E7.89150
+G1 X151.274 Y105.324 E7.91977
+G1 X152.794 Y106.845 E8.02716
+G1 X152.794 Y107.411 E8.05543
+G1 X151.274 Y105.890 E8.16281
+G1 X151.274 Y106.457 E8.19109
+G1 X152.794 Y107.977 E8.29847
+G1 X152.794 Y108.543 E8.32674
+G1 X151.274 Y107.023 E8.43413
+G1 X151.274 Y107.589 E8.46240
+G1 X152.794 Y109.110 E8.56978
+G1 X152.794 Y109.676 E8.59805
+G1 X151.274 Y108.155 E8.70544
+G1 X151.274 Y108.721 E8.73371
+G1 X152.794 Y110.242 E8.84109
+G1 X152.794 Y110.808 E8.86937
+G1 X151.274 Y109.288 E8.97675
+G1 X151.274 Y109.854 E9.00502
+G1 X152.794 Y111.374 E9.11240
+G1 X152.794 Y111.941 E9.14068
+G1 X151.274 Y110.420 E9.24806
+G1 X151.274 Y110.986 E9.27633
+G1 X152.794 Y112.507 E9.38372
+G1 X152.794 Y113.073 E9.41199
+G1 X151.274 Y111.552 E9.51937
+G1 X151.274 Y112.119 E9.54764
+G1 X152.794 Y113.639 E9.65503
+G1 X152.794 Y113.715 E9.65879
+G1 X152.304 Y113.715 E9.68330
+G1 X151.274 Y112.685 E9.75602
+G1 X151.274 Y113.251 E9.78430
+G1 X151.911 Y113.888 E9.82929
+M106 S186.15
+G1 Z15.050 F7800.000
+G1 E7.82929 F2400.00000
+G92 E0
+G1 X93.313 Y102.059 F7800.000
+G1 E2.00000 F2400.00000
+G1 F3600
+G1 X93.104 Y101.216 E2.04176
+G1 X93.014 Y100.485 E2.07718
+G1 X92.998 Y99.882 E2.10619
+G1 X93.050 Y99.143 E2.14181
+G1 X93.150 Y98.548 E2.17082
+G1 X93.341 Y97.833 E2.20645
+G1 X93.552 Y97.268 E2.23546
+G1 X93.876 Y96.605 E2.27092
+G1 X94.266 Y95.981 E2.30634
+G1 X94.633 Y95.502 E2.33535
+G1 X95.136 Y94.963 E2.37081
+G1 X95.692 Y94.480 E2.40623
+G1 X96.182 Y94.129 E2.43523
+G1 X96.825 Y93.759 E2.47090
+G1 X97.373 Y93.509 E2.49987
+G1 X98.074 Y93.267 E2.53554
+G1 X98.660 Y93.127 E2.56450
+G1 X99.390 Y93.024 E2.59997
+G1 X100.126 Y92.999 E2.63539
+G1 X100.728 Y93.035 E2.66439
+G1 X101.460 Y93.151 E2.70006
+G1 X102.043 Y93.302 E2.72903
+G1 X102.736 Y93.554 E2.76449
+G1 X103.395 Y93.876 E2.79974
+G1 X104.019 Y94.266 E2.83516
+G1 X104.498 Y94.633 E2.86417
+G1 X105.037 Y95.136 E2.89963
+G1 X105.520 Y95.692 E2.93505
+G1 X105.873 Y96.186 E2.96427
+G1 X106.181 Y96.709 E2.99344
+G1 X106.493 Y97.377 E3.02890
+G1 X106.732 Y98.073 E3.06432
+G1 X106.873 Y98.660 E3.09333
+G1 X106.976 Y99.390 E3.12879
+G1 X107.001 Y100.127 E3.16425
+G1 X106.965 Y100.728 E3.19322
+G1 X106.849 Y101.460 E3.22889
+G1 X106.698 Y102.043 E3.25785
+G1 X106.446 Y102.736 E3.29332
+G1 X106.124 Y103.395 E3.32857
+G1 X105.736 Y104.016 E3.36382
+G1 X105.283 Y104.597 E3.39924
+G1 X104.868 Y105.034 E3.42825
+G1 X104.308 Y105.520 E3.46388
+G1 X103.814 Y105.873 E3.49309
+G1 X103.291 Y106.181 E3.52227
+G1 X102.623 Y106.493 E3.55773
+G1 X101.927 Y106.732 E3.59315
+G1 X101.340 Y106.873 E3.62216
+G1 X100.610 Y106.976 E3.65762
+G1 X99.873 Y107.001 E3.69308
+G1 X99.272 Y106.965 E3.72204
+G1 X98.544 Y106.849 E3.75751
+G1 X97.833 Y106.659 E3.79292
+G1 X97.268 Y106.448 E3.82193
+G1 X96.605 Y106.124 E3.85739
+G1 X95.984 Y105.736 E3.89265
+G1 X95.403 Y105.283 E3.92807
+G1 X94.963 Y104.865 E3.95728
+G1 X94.561 Y104.410 E3.98645
+G1 X94.127 Y103.814 E4.02192
+G1 X93.759 Y103.175 E4.05738
+G1 X93.509 Y102.627 E4.08634
+G1 X93.333 Y102.115 E4.11238
+G1 X92.948 Y102.184 F7800.000
+G1 F3600
+G1 X92.898 Y102.037 E4.11989
+G1 X92.724 Y101.283 E4.15709
+G1 X92.629 Y100.514 E4.19437
+G1 X92.612 Y99.874 E4.22516
+G1 X92.667 Y99.098 E4.26257
+G1 X92.772 Y98.466 E4.29336
+G1 X92.974 Y97.715 E4.33077
+G1 X93.198 Y97.115 E4.36156
+G1 X93.538 Y96.418 E4.39888
+G1 X93.949 Y95.761 E4.43616
+G1 X94.338 Y95.253 E4.46695
+G1 X94.867 Y94.685 E4.50428
+G1 X95.452 Y94.177 E4.54156
+G1 X95.974 Y93.805 E4.57235
+G1 X96.648 Y93.415 E4.60980
+G1 X97.230 Y93.150 E4.64055
+G1 X97.966 Y92.897 E4.67800
+G1 X98.588 Y92.748 E4.70875
+G1 X99.356 Y92.640 E4.74607
+G1 X100.131 Y92.612 E4.78335
+G1 X100.770 Y92.652 E4.81414
+G1 X101.539 Y92.773 E4.85160
+G1 X102.158 Y92.933 E4.88234
+G1 X102.887 Y93.199 E4.91967
+G1 X103.582 Y93.538 E4.95686
+G1 X104.239 Y93.949 E4.99415
+G1 X104.747 Y94.338 E5.02494
+G1 X105.315 Y94.867 E5.06226
+G1 X105.823 Y95.452 E5.09954
+G1 X106.197 Y95.976 E5.13046
+G1 X106.523 Y96.529 E5.16133
+G1 X106.851 Y97.232 E5.19866
+G1 X107.103 Y97.965 E5.23594
+G1 X107.252 Y98.588 E5.26673
+G1 X107.360 Y99.356 E5.30405
+G1 X107.388 Y100.132 E5.34138
+G1 X107.348 Y100.770 E5.37213
+G1 X107.227 Y101.539 E5.40958
+G1 X107.067 Y102.158 E5.44032
+G1 X106.801 Y102.887 E5.47765
+G1 X106.462 Y103.582 E5.51485
+G1 X106.052 Y104.238 E5.55204
+G1 X105.575 Y104.849 E5.58932
+G1 X105.135 Y105.313 E5.62012
+G1 X104.548 Y105.823 E5.65752
+G1 X104.024 Y106.197 E5.68844
+G1 X103.471 Y106.523 E5.71932
+G1 X102.768 Y106.851 E5.75664
+G1 X102.035 Y107.103 E5.79392
+G1 X101.412 Y107.252 E5.82471
+G1 X100.644 Y107.360 E5.86204
+G1 X99.868 Y107.388 E5.89936
+G1 X99.230 Y107.348 E5.93011
+G1 X98.464 Y107.227 E5.96743
+G1 X97.715 Y107.026 E6.00471
+G1 X97.115 Y106.802 E6.03550
+G1 X96.418 Y106.462 E6.07283
+G1 X95.762 Y106.052 E6.11003
+G1 X95.151 Y105.575 E6.14731
+G1 X94.685 Y105.133 E6.17822
+G1 X94.260 Y104.652 E6.20910
+G1 X93.803 Y104.024 E6.24642
+G1 X93.415 Y103.352 E6.28375
+G1 X93.150 Y102.770 E6.31449
+G1 X92.968 Y102.241 E6.34142
+G1 X92.584 Y102.310 F7800.000
+G1 F1800
+G1 X92.526 Y102.143 E6.34990
+G1 X92.343 Y101.350 E6.38905
+G1 X92.244 Y100.542 E6.42819
+G1 X92.226 Y99.865 E6.46076
+G1 X92.283 Y99.052 E6.49995
+G1 X92.395 Y98.384 E6.53252
+G1 X92.606 Y97.597 E6.57171
+G1 X92.843 Y96.963 E6.60429
+G1 X93.200 Y96.231 E6.64347
+G1 X93.631 Y95.541 E6.68262
+G1 X94.044 Y95.003 E6.71519
+G1 X94.599 Y94.407 E6.75438
+G1 X95.213 Y93.873 E6.79352
+G1 X95.765 Y93.480 E6.82609
+G1 X96.471 Y93.072 E6.86533
+G1 X97.087 Y92.792 E6.89786
+G1 X97.858 Y92.526 E6.93709
+G1 X98.516 Y92.368 E6.96962
+G1 X99.322 Y92.255 E7.00881
+G1 X100.136 Y92.226 E7.04795
+G1 X100.812 Y92.268 E7.08052
+G1 X101.617 Y92.395 E7.11976
+G1 X102.272 Y92.565 E7.15228
+G1 X103.038 Y92.843 E7.19147
+G1 X103.769 Y93.200 E7.23061
+G1 X104.459 Y93.631 E7.26976
+G1 X104.997 Y94.044 E7.30233
+G1 X105.593 Y94.599 E7.34152
+G1 X106.127 Y95.213 E7.38066
+G1 X106.520 Y95.766 E7.41328
+G1 X106.864 Y96.349 E7.44585
+G1 X107.209 Y97.088 E7.48504
+G1 X107.474 Y97.857 E7.52419
+G1 X107.632 Y98.516 E7.55676
+G1 X107.745 Y99.322 E7.59595
+G1 X107.774 Y100.137 E7.63513
+G1 X107.732 Y100.812 E7.66766
+G1 X107.605 Y101.617 E7.70690
+G1 X107.435 Y102.272 E7.73942
+G1 X107.157 Y103.038 E7.77861
+G1 X106.800 Y103.769 E7.81775
+G1 X106.369 Y104.459 E7.85689
+G1 X105.868 Y105.101 E7.89604
+G1 X105.401 Y105.592 E7.92861
+G1 X104.787 Y106.127 E7.96780
+G1 X104.234 Y106.520 E8.00042
+G1 X103.651 Y106.864 E8.03299
+G1 X102.912 Y107.209 E8.07218
+G1 X102.143 Y107.474 E8.11133
+G1 X101.484 Y107.632 E8.14390
+G1 X100.678 Y107.745 E8.18308
+G1 X99.863 Y107.774 E8.22227
+G1 X99.188 Y107.732 E8.25480
+G1 X98.384 Y107.605 E8.29399
+G1 X97.597 Y107.394 E8.33313
+G1 X96.963 Y107.157 E8.36570
+G1 X96.231 Y106.800 E8.40489
+G1 X95.541 Y106.369 E8.44403
+G1 X94.899 Y105.868 E8.48318
+G1 X94.407 Y105.401 E8.51580
+G1 X93.959 Y104.894 E8.54837
+G1 X93.480 Y104.234 E8.58756
+G1 X93.072 Y103.529 E8.62675
+G1 X92.792 Y102.913 E8.65927
+G1 X92.603 Y102.366 E8.68709
+G1 X92.697 Y102.175 F7800.000
+G1 E6.68709 F2400.00000
+G92 E0
+G1 X94.244 Y96.230 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X96.255 Y94.218 E2.11950
+G1 X97.269 Y93.681 F7800.000
+G1 F900
+G1 X94.003 Y96.947 E2.31355
+G1 X93.795 Y97.372 E2.33344
+G1 X93.641 Y97.785 E2.35194
+G1 X97.777 Y93.649 E2.59765
+G1 X98.148 Y93.521 E2.61414
+G1 X98.454 Y93.448 E2.62738
+G1 X93.448 Y98.454 E2.92482
+G1 X93.334 Y99.044 E2.95007
+G1 X99.038 Y93.340 E3.28895
+G1 X99.573 Y93.282 E3.31154
+G1 X93.285 Y99.570 E3.68511
+G1 X93.267 Y100.064 E3.70587
+G1 X100.066 Y93.265 E4.10982
+G1 X100.520 Y93.287 E4.12891
+G1 X93.285 Y100.523 E4.55879
+G1 X93.337 Y100.947 E4.57674
+G1 X100.947 Y93.337 E5.02884
+G1 X101.358 Y93.403 E5.04633
+G1 X93.407 Y101.353 E5.51872
+G1 X93.496 Y101.740 E5.53540
+G1 X101.740 Y93.497 E6.02519
+G1 X102.107 Y93.606 E6.04127
+G1 X93.608 Y102.105 E6.54618
+G1 X93.730 Y102.459 E6.56192
+G1 X102.456 Y93.733 E7.08033
+G1 X102.791 Y93.875 E7.09560
+G1 X93.874 Y102.792 E7.62537
+G1 X94.028 Y103.114 E7.64037
+G1 X103.111 Y94.031 E8.18000
+G1 X103.417 Y94.201 E8.19472
+G1 X94.203 Y103.416 E8.74219
+G1 X94.381 Y103.714 E8.75678
+G1 X103.710 Y94.384 E9.31106
+G1 X103.993 Y94.578 E9.32545
+G1 X94.582 Y103.990 E9.88459
+G1 X94.784 Y104.264 E9.89891
+G1 X104.262 Y94.785 E10.46205
+G1 X104.514 Y95.009 E10.47623
+G1 X95.007 Y104.516 E11.04106
+G1 X95.238 Y104.762 E11.05522
+G1 X104.761 Y95.239 E11.62098
+G1 X104.991 Y95.485 E11.63514
+G1 X95.483 Y104.994 E12.20005
+G1 X95.741 Y105.212 E12.21426
+G1 X105.213 Y95.740 E12.77697
+G1 X105.421 Y96.008 E12.79123
+G1 X96.009 Y105.420 E13.35046
+G1 X96.290 Y105.616 E13.36483
+G1 X105.620 Y96.286 E13.91915
+G1 X105.800 Y96.582 E13.93372
+G1 X96.583 Y105.799 E14.48131
+G1 X96.889 Y105.969 E14.49603
+G1 X105.972 Y96.886 E15.03567
+G1 X106.124 Y97.211 E15.05073
+G1 X97.209 Y106.125 E15.58035
+G1 X97.543 Y106.268 E15.59558
+G1 X106.270 Y97.541 E16.11408
+G1 X106.392 Y97.896 E16.12983
+G1 X97.889 Y106.398 E16.63497
+G1 X98.263 Y106.501 E16.65125
+G1 X106.505 Y98.259 E17.14093
+G1 X106.597 Y98.643 E17.15753
+G1 X98.643 Y106.597 E17.63015
+G1 X99.054 Y106.663 E17.64764
+G1 X106.662 Y99.055 E18.09965
+G1 X106.714 Y99.478 E18.11759
+G1 X99.480 Y106.713 E18.54741
+G1 X99.934 Y106.735 E18.56651
+G1 X106.731 Y99.938 E18.97031
+G1 X106.718 Y100.427 E18.99084
+G1 X100.428 Y106.718 E19.36459
+G1 X100.962 Y106.659 E19.38718
+G1 X106.660 Y100.962 E19.72571
+G1 X106.554 Y101.544 E19.75058
+G1 X101.546 Y106.552 E20.04813
+G1 X101.853 Y106.478 E20.06138
+G1 X102.224 Y106.351 E20.07787
+G1 X106.351 Y102.223 E20.32309
+G1 X106.202 Y102.633 E20.34140
+G1 X105.997 Y103.054 E20.36110
+G1 X102.736 Y106.315 E20.55485
+G1 X103.744 Y105.783 F7800.000
+G1 F900
+G1 X105.756 Y103.772 E20.67434
+G1 E18.67434 F2400.00000
+G92 E0
+G1 X151.190 Y100.996 F7800.000
+G1 E2.00000 F2400.00000
+G1 F900
+G1 X152.645 Y100.996 E2.06999
+G1 X152.645 Y114.004 E2.69561
+G1 X151.190 Y114.004 E2.76560
+G1 X151.190 Y101.056 E3.38834
+G1 X150.804 Y100.611 F7800.000
+G1 F900
+G1 X153.031 Y100.611 E3.49542
+G1 X153.031 Y114.389 E4.15813
+G1 X150.804 Y114.389 E4.26522
+G1 X150.804 Y100.671 E4.92505
+G1 X150.419 Y100.225 F7800.000
+G1 F900
+G1 X153.416 Y100.225 E5.06923
+G1 X153.416 Y114.775 E5.76903
+G1 X150.419 Y114.775 E5.91321
+G1 X150.419 Y100.285 E6.61013
+G1 X150.778 Y100.401 F7800.000
+G1 X152.112 Y101.112
+G1 F1200
+G1 X151.479 Y101.744 E6.65455
+G1 X151.479 Y102.307 E6.68252
+G1 X152.356 Y101.431 E6.74410
+G1 X152.356 Y101.994 E6.77206
+G1 X151.479 Y102.871 E6.83365
+G1 X151.479 Y103.434 E6.86161
+G1 X152.356 Y102.557 E6.92319
+G1 X152.356 Y103.120 E6.95116
+G1 X151.479 Y103.997 E7.01274
+G1 X151.479 Y104.560 E7.04070
+G1 X152.356 Y103.683 E7.10229
+G1 X152.356 Y104.246 E7.13025
+G1 X151.479 Y105.123 E7.19184
+G1 X151.479 Y105.686 E7.21980
+G1 X152.356 Y104.809 E7.28138
+G1 X152.356 Y105.372 E7.30935
+G1 X151.479 Y106.249 E7.37093
+G1 X151.479 Y106.812 E7.39889
+G1 X152.356 Y105.935 E7.46048
+G1 X152.356 Y106.498 E7.48844
+G1 X151.479 Y107.375 E7.55002
+G1 X151.479 Y107.938 E7.57799
+G1 X152.356 Y107.062 E7.63957
+G1 X152.356 Y107.625 E7.66753
+G1 X151.479 Y108.501 E7.72912
+G1 X151.479 Y109.065 E7.75708
+G1 X152.356 Y108.188 E7.81867
+G1 X152.356 Y108.751 E7.84663
+G1 X151.479 Y109.628 E7.90821
+G1 X151.479 Y110.191 E7.93618
+G1 X152.356 Y109.314 E7.99776
+G1 X152.356 Y109.877 E8.02572
+G1 X151.479 Y110.754 E8.08731
+G1 X151.479 Y111.317 E8.11527
+G1 X152.356 Y110.440 E8.17685
+G1 X152.356 Y111.003 E8.20482
+G1 X151.479 Y111.880 E8.26640
+G1 X151.479 Y112.443 E8.29436
+G1 X152.356 Y111.566 E8.35595
+G1 X152.356 Y112.129 E8.38391
+G1 X151.479 Y113.006 E8.44550
+G1 X151.479 Y113.569 E8.47346
+G1 X152.356 Y112.692 E8.53504
+G1 X152.356 Y113.255 E8.56301
+G1 X151.723 Y113.888 E8.60744
+M106 S255
+G1 Z15.350 F7800.000
+G1 X151.395 Y100.996
+G1 F600
+G1 X152.207 Y100.996 E8.64647
+G1 X152.207 Y114.004 E9.27208
+G1 X151.395 Y114.004 E9.31111
+G1 X151.395 Y101.056 E9.93385
+G1 X151.009 Y100.611 F7800.000
+G1 F600
+G1 X152.592 Y100.611 E10.00997
+G1 X152.592 Y114.389 E10.67268
+G1 X151.009 Y114.389 E10.74881
+G1 X151.009 Y100.671 E11.40863
+G1 X150.624 Y100.225 F7800.000
+G1 F600
+G1 X152.978 Y100.225 E11.52185
+G1 X152.978 Y114.775 E12.22166
+G1 X150.624 Y114.775 E12.33488
+G1 X150.624 Y100.285 E13.03179
+G1 X150.980 Y100.406 F7800.000
+G1 X151.801 Y101.189
+G1 F600
+G1 X151.801 Y113.811 E13.70227
+G1 Z15.650 F7800.000
+G1 X151.215 Y100.611
+G1 F600
+G1 X152.154 Y100.611 E13.74743
+G1 X152.154 Y114.389 E14.41014
+G1 X151.215 Y114.389 E14.45530
+G1 X151.215 Y100.671 E15.11513
+G1 X150.829 Y100.225 F7800.000
+G1 F600
+G1 X152.539 Y100.225 E15.19738
+G1 X152.539 Y114.775 E15.89719
+G1 X150.829 Y114.775 E15.97945
+G1 X150.829 Y100.285 E16.67637
+G1 X151.183 Y100.411 F7800.000
+G1 X151.684 Y100.803
+G1 F600
+G1 X151.684 Y114.197 E17.60077
+G1 Z15.950 F7800.000
+G1 X151.420 Y100.611
+G1 F600
+G1 X151.715 Y100.611 E17.61497
+G1 X151.715 Y114.389 E18.27768
+G1 X151.420 Y114.389 E18.29188
+G1 X151.420 Y100.671 E18.95171
+G1 X151.034 Y100.225 F7800.000
+G1 F600
+G1 X152.101 Y100.225 E19.00300
+G1 X152.101 Y114.775 E19.70281
+G1 X151.034 Y114.775 E19.75410
+G1 X151.034 Y100.285 E20.45102
+G1 X151.386 Y100.416 F7800.000
+G1 Z16.250 F7800.000
+G1 X151.240 Y100.225
+G1 F600
+G1 X151.662 Y100.225 E20.47135
+G1 X151.662 Y114.775 E21.17116
+G1 X151.240 Y114.775 E21.19149
+G1 X151.240 Y100.285 E21.88841
+G1 X151.588 Y100.422 F7800.000
+G1 Z16.550 F7800.000
+G1 E19.88841 F2400.00000
+G92 E0
+G1 X151.334 Y115.000 F7800.000
+G1 E2.00000 F2400.00000
+G1 F600
+G1 X151.334 Y100.000 E2.42841
+G1 E0.42841 F2400.00000
+G92 E0
+M107
+; Filament-specific end gcode 
+;END gcode for filament
+M104 S0 ; turn off temperature
+G28 X0  ; home X axis
+M84     ; disable motors
+; filament used [mm] = 2031.0
+; filament used [cm3] = 4.9
+; total filament used [g] = 0.0
+; total filament cost = 0.0
+; estimated printing time (normal mode) = 29m 32s
+
+; avoid_crossing_perimeters = 0
+; bed_shape = 0x0,200x0,200x200,0x200
+; bed_temperature = 0
+; before_layer_gcode = 
+; between_objects_gcode = 
+; bridge_acceleration = 0
+; bridge_fan_speed = 100
+; brim_width = 0
+; colorprint_heights = 
+; complete_objects = 0
+; cooling = 1
+; cooling_tube_length = 5
+; cooling_tube_retraction = 91.5
+; default_acceleration = 0
+; deretract_speed = 0
+; disable_fan_first_layers = 3
+; duplicate_distance = 6
+; end_filament_gcode = "; Filament-specific end gcode \n;END gcode for filament\n"
+; end_gcode = M104 S0 ; turn off temperature\nG28 X0  ; home X axis\nM84     ; disable motors\n
+; extra_loading_move = -2
+; extruder_clearance_height = 20
+; extruder_clearance_radius = 20
+; extruder_colour = ""
+; extruder_offset = 0x0
+; extrusion_axis = E
+; extrusion_multiplier = 1
+; fan_always_on = 0
+; fan_below_layer_time = 60
+; filament_colour = #29B2B2
+; filament_cooling_final_speed = 3.4
+; filament_cooling_initial_speed = 2.2
+; filament_cooling_moves = 4
+; filament_cost = 0
+; filament_density = 0
+; filament_diameter = 1.75
+; filament_load_time = 0
+; filament_loading_speed = 28
+; filament_loading_speed_start = 3
+; filament_max_volumetric_speed = 0
+; filament_minimal_purge_on_wipe_tower = 15
+; filament_notes = ""
+; filament_ramming_parameters = "120 100 6.6 6.8 7.2 7.6 7.9 8.2 8.7 9.4 9.9 10.0| 0.05 6.6 0.45 6.8 0.95 7.8 1.45 8.3 1.95 9.7 2.45 10 2.95 7.6 3.45 7.6 3.95 7.6 4.45 7.6 4.95 7.6"
+; filament_soluble = 0
+; filament_toolchange_delay = 0
+; filament_type = PLA
+; filament_unload_time = 0
+; filament_unloading_speed = 90
+; filament_unloading_speed_start = 100
+; first_layer_acceleration = 0
+; first_layer_bed_temperature = 0
+; first_layer_extrusion_width = 200%
+; first_layer_speed = 30
+; first_layer_temperature = 200
+; gcode_comments = 0
+; gcode_flavor = reprap
+; gcode_label_objects = 0
+; high_current_on_filament_swap = 0
+; infill_acceleration = 0
+; infill_first = 0
+; layer_gcode = 
+; machine_max_acceleration_e = 10000,5000
+; machine_max_acceleration_extruding = 1500,1250
+; machine_max_acceleration_retracting = 1500,1250
+; machine_max_acceleration_x = 9000,1000
+; machine_max_acceleration_y = 9000,1000
+; machine_max_acceleration_z = 500,200
+; machine_max_feedrate_e = 120,120
+; machine_max_feedrate_x = 500,200
+; machine_max_feedrate_y = 500,200
+; machine_max_feedrate_z = 12,12
+; machine_max_jerk_e = 2.5,2.5
+; machine_max_jerk_x = 10,10
+; machine_max_jerk_y = 10,10
+; machine_max_jerk_z = 0.2,0.4
+; machine_min_extruding_rate = 0,0
+; machine_min_travel_rate = 0,0
+; max_fan_speed = 100
+; max_layer_height = 0
+; max_print_height = 200
+; max_print_speed = 80
+; max_volumetric_speed = 0
+; min_fan_speed = 35
+; min_layer_height = 0.07
+; min_print_speed = 10
+; min_skirt_length = 0
+; notes = 
+; nozzle_diameter = 0.4
+; only_retract_when_crossing_perimeters = 1
+; ooze_prevention = 0
+; output_filename_format = [input_filename_base].gcode
+; parking_pos_retraction = 92
+; perimeter_acceleration = 0
+; post_process = 
+; printer_model = 
+; printer_notes = 
+; remaining_times = 0
+; resolution = 0
+; retract_before_travel = 2
+; retract_before_wipe = 0%
+; retract_layer_change = 0
+; retract_length = 2
+; retract_length_toolchange = 10
+; retract_lift = 0
+; retract_lift_above = 0
+; retract_lift_below = 0
+; retract_restart_extra = 0
+; retract_restart_extra_toolchange = 0
+; retract_speed = 40
+; silent_mode = 1
+; single_extruder_multi_material = 0
+; single_extruder_multi_material_priming = 1
+; skirt_distance = 6
+; skirt_height = 1
+; skirts = 1
+; slowdown_below_layer_time = 30
+; spiral_vase = 0
+; standby_temperature_delta = -5
+; start_filament_gcode = "; Filament gcode\n"
+; start_gcode = G28 ; home all axes\nG1 Z5 F5000 ; lift nozzle\n
+; temperature = 200
+; threads = 1
+; toolchange_gcode = 
+; travel_speed = 130
+; use_firmware_retraction = 0
+; use_relative_e_distances = 0
+; use_volumetric_e = 0
+; variable_layer_height = 1
+; wipe = 0
+; wipe_tower = 0
+; wipe_tower_bridging = 10
+; wipe_tower_rotation_angle = 0
+; wipe_tower_width = 60
+; wipe_tower_x = 180
+; wipe_tower_y = 140
+; wiping_volumes_extruders = 70,70,70,70,70,70,70,70,70,70
+; wiping_volumes_matrix = 0,140,140,140,140,140,0,140,140,140,140,140,0,140,140,140,140,140,0,140,140,140,140,140,0
+; z_offset = 0
+; clip_multipart_objects = 0
+; dont_support_bridges = 1
+; elefant_foot_compensation = 0
+; extrusion_width = 0
+; first_layer_height = 0.35
+; infill_only_where_needed = 0
+; interface_shells = 0
+; layer_height = 0.3
+; raft_layers = 0
+; seam_position = aligned
+; slice_closing_radius = 0.049
+; support_material = 1
+; support_material_angle = 0
+; support_material_auto = 1
+; support_material_buildplate_only = 0
+; support_material_contact_distance = 0.2
+; support_material_enforce_layers = 0
+; support_material_extruder = 1
+; support_material_extrusion_width = 0
+; support_material_interface_contact_loops = 0
+; support_material_interface_extruder = 1
+; support_material_interface_layers = 3
+; support_material_interface_spacing = 0
+; support_material_interface_speed = 100%
+; support_material_pattern = rectilinear
+; support_material_spacing = 2.5
+; support_material_speed = 60
+; support_material_synchronize_layers = 0
+; support_material_threshold = 0
+; support_material_with_sheath = 1
+; support_material_xy_spacing = 50%
+; wipe_into_objects = 0
+; xy_size_compensation = 0
+; bottom_fill_pattern = rectilinear
+; bottom_solid_layers = 3
+; bridge_angle = 0
+; bridge_flow_ratio = 1
+; bridge_speed = 60
+; ensure_vertical_shell_thickness = 0
+; external_perimeter_extrusion_width = 0
+; external_perimeter_speed = 50%
+; external_perimeters_first = 0
+; extra_perimeters = 1
+; fill_angle = 45
+; fill_density = 20%
+; fill_pattern = stars
+; gap_fill_speed = 20
+; infill_every_layers = 1
+; infill_extruder = 1
+; infill_extrusion_width = 0
+; infill_overlap = 25%
+; infill_speed = 80
+; overhangs = 1
+; perimeter_extruder = 1
+; perimeter_extrusion_width = 0
+; perimeter_speed = 60
+; perimeters = 3
+; small_perimeter_speed = 15
+; solid_infill_below_area = 70
+; solid_infill_every_layers = 0
+; solid_infill_extruder = 1
+; solid_infill_extrusion_width = 0
+; solid_infill_speed = 20
+; thin_walls = 1
+; top_fill_pattern = rectilinear
+; top_infill_extrusion_width = 0
+; top_solid_infill_speed = 15
+; top_solid_layers = 3
+; wipe_into_infill = 0
+; print_settings_id = 
+; filament_settings_id = ""
+; printer_settings_id = 
+; printer_model = 
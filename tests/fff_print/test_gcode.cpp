@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <tbb/task_scheduler_init.h>
+
+#include <libslic3r/GCode/PreviewData.hpp>
+#include <libslic3r/Model.hpp>
+#include <libslic3r/Print.hpp>
+
+using namespace Slic3r;
+
+// Exports the G-code of the print, without the line with the time stamp.
+static std::string export_gcode(Print &print, GCodePreviewData *preview_data = nullptr)
+{
+    const std::string path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("test_gcode-%%%%-%%%%.gcode")).string();
+    print.export_gcode(path, preview_data);
+    std::ifstream     file(path);
+    std::stringstream out;
+    for (std::string line; std::getline(file, line);)
+        if (line.find("; generated by ") != 0)
+            out << line << "\n";
+    file.close();
+    boost::filesystem::remove(path);
+    return out.str();
+}
+
+TEST(GCode, ExportDoesNotDependOnThreadCount)
+{
+    // Objects of different heights with support, seams to place and layers, which are cooled down.
+    Model model;
+    for (size_t i = 0; i < 3; ++ i) {
+        ModelObject *object = model.add_object();
+        object->name = "object";
+        TriangleMesh mesh = (i == 1) ? make_cylinder(8., 15.) : make_cube(15., 15., 10. + 5. * double(i));
+        if (i == 2)
+            // Overhang to be supported.
+            mesh.rotate_y(0.6f);
+        object->add_volume(mesh);
+        object->add_instance()->set_offset(Vec3d(60. + 40. * double(i), 100., 0.));
+    }
+    DynamicPrintConfig config;
+    config.apply(FullPrintConfig());
+    config.set_deserialize("support_material", "1");
+    config.set_deserialize("seam_position", "aligned");
+    config.set_deserialize("skirts", "1");
+    config.set_deserialize("slowdown_below_layer_time", "30");
+    config.set_deserialize("fan_below_layer_time", "60");
+
+    Print print;
+    print.set_status_silent();
+    print.apply(model, config);
+    print.process();
+    std::string gcode = export_gcode(print);
+    ASSERT_FALSE(gcode.empty());
+
+    // The G-code exported by the serial export, before the layers were processed in a pipeline,
+    // without the line with the time stamp.
+    std::stringstream reference;
+    {
+        std::ifstream file(TEST_DATA_DIR "/export_reference.gcode");
+        ASSERT_TRUE(file.good());
+        reference << file.rdbuf();
+    }
+    EXPECT_TRUE(gcode == reference.str());
+    {
+        tbb::task_scheduler_init scheduler(1);
+        EXPECT_EQ(export_gcode(print), gcode);
+    }
+    {
+        tbb::task_scheduler_init scheduler(4);
+        EXPECT_EQ(export_gcode(print), gcode);
+    }
+}
+
+TEST(GCode, PreviewDataIsFilledLayerByLayer)
+{
+    // Two objects printed one after the other, so that the export returns to the lower layers.
+    Model model;
+    for (size_t i = 0; i < 2; ++ i) {
+        ModelObject *object = model.add_object();
+        object->name = "object";
+        object->add_volume(make_cube(15., 15., 5.));
+        object->add_instance()->set_offset(Vec3d(60. + 60. * double(i), 100., 0.));
+    }
+    DynamicPrintConfig config;
+    config.apply(FullPrintConfig());
+    config.set_deserialize("complete_objects", "1");
+    config.set_deserialize("retract_layer_change", "1");
+
+    Print print;
+    print.apply(model, config);
+    size_t reloads = 0;
+    print.set_status_callback([&reloads](const PrintBase::SlicingStatus &status) {
+        if (status.flags & PrintBase::SlicingStatus::RELOAD_GCODE_PREVIEW)
+            ++ reloads;
+    });
+    print.process();
+    GCodePreviewData preview_data;
+    ASSERT_FALSE(export_gcode(print, &preview_data).empty());
+
+    // A single sorted layer per print z, the layers of the second object merged into the layers of the first one.
+    const GCodePreviewData::Extrusion::LayersList &layers = preview_data.extrusion.layers;
+    const size_t num_layers = print.objects().front()->layers().size();
+    ASSERT_EQ(layers.size(), num_layers);
+    for (size_t i = 1; i < layers.size(); ++ i)
+        EXPECT_LT(layers[i - 1].z, layers[i].z);
+    for (const GCodePreviewData::Extrusion::Layer &layer : layers) {
+        ASSERT_FALSE(layer.empty());
+        EXPECT_EQ(layer.first_vertices.size(), layer.paths_count());
+        EXPECT_EQ(layer.xs.size(), layer.ys.size());
+        for (size_t path_id = 0; path_id < layer.paths_count(); ++ path_id)
+            EXPECT_TRUE(layer.polyline(path_id).is_valid());
+    }
+    // Both objects are printed at each layer.
+    BoundingBox bbox_first_layer = get_extents(layers.front().polyline(0));
+    for (size_t path_id = 1; path_id < layers.front().paths_count(); ++ path_id)
+        bbox_first_layer.merge(get_extents(layers.front().polyline(path_id)));
+    EXPECT_GT(unscale<double>(bbox_first_layer.size().x()), 60.);
+    EXPECT_FALSE(preview_data.travel.layers.empty());
+    EXPECT_FALSE(preview_data.retraction.layers.empty());
+    EXPECT_FALSE(preview_data.unretraction.layers.empty());
+    EXPECT_GT(preview_data.ranges.height.max, 0.f);
+
+    // The range query returns the layers between the z values.
+    auto range = preview_data.extrusion.layers_in_range(layers[2].z, layers[4].z);
+    ASSERT_EQ(range.second - range.first, 3);
+    EXPECT_EQ(range.first->z, layers[2].z);
+    range = preview_data.extrusion.layers_in_range(layers.back().z + 1.f, FLT_MAX);
+    EXPECT_EQ(range.first, range.second);
+    auto travel_range = preview_data.travel.layers_in_range(0.f, layers.front().z);
+    ASSERT_NE(travel_range.first, travel_range.second);
+    EXPECT_LE((travel_range.second - 1)->z, layers.front().z);
+    // All the layers have their z in unscaled mm, the positions are scaled.
+    for (const GCodePreviewData::Retraction::Layer &layer : preview_data.retraction.layers)
+        for (size_t position_id = 0; position_id < layer.positions_count(); ++ position_id)
+            EXPECT_EQ(float(unscale<double>(layer.position(position_id)(2))), layer.z);
+    for (const GCodePreviewData::Travel::Layer &layer : preview_data.travel.layers)
+        EXPECT_EQ(float(unscale<double>(*std::min_element(layer.zs.begin(), layer.zs.end()))), layer.z);
+
+    // The preview was reloaded as the count of the added layers doubled, not at each layer.
+    EXPECT_GE(reloads, 2);
+    EXPECT_LT(reloads, num_layers / 2);
+}
@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include <libslic3r/Model.hpp>
+#include <libslic3r/Print.hpp>
+
+using namespace Slic3r;
+
+TEST(Print, ProgressOfConcurrentObjectsDoesNotGoBack)
+{
+    Model model;
+    for (size_t i = 0; i < 4; ++ i) {
+        ModelObject *object = model.add_object();
+        object->name = "cube";
+        object->add_volume(make_cube(10., 10., 5. + 5. * double(i)));
+        object->add_instance()->set_offset(Vec3d(50. + 20. * double(i), 100., 0.));
+    }
+    DynamicPrintConfig config;
+    config.apply(FullPrintConfig());
+    config.set_deserialize("support_material", "1");
+
+    std::mutex       mutex;
+    std::vector<int> percents;
+    Print            print;
+    print.set_status_callback([&mutex, &percents](const PrintBase::SlicingStatus &status) {
+        std::lock_guard<std::mutex> lock(mutex);
+        percents.emplace_back(status.percent);
+    });
+    print.apply(model, config);
+    print.process();
+
+    ASSERT_FALSE(percents.empty());
+    for (size_t i = 1; i < percents.size(); ++ i)
+        EXPECT_LE(percents[i - 1], percents[i]);
+    EXPECT_EQ(std::count(percents.begin(), percents.end(), 85), 1);
+}
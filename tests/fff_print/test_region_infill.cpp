@@ -0,0 +1,301 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <libslic3r/ExtrusionEntityCollection.hpp>
+#include <libslic3r/Layer.hpp>
+#include <libslic3r/Model.hpp>
+#include <libslic3r/Print.hpp>
+
+using namespace Slic3r;
+
+// Two stacked 20mm cubes with their own regions. The upper one has its fill angle changed,
+// so that its region differs from the region of the lower one.
+static Model make_model()
+{
+    Model        model;
+    ModelObject *object = model.add_object();
+    object->name = "stacked_cubes";
+    object->add_volume(make_cube(20., 20., 20.));
+    TriangleMesh upper = make_cube(20., 20., 20.);
+    upper.translate(0.f, 0.f, 20.f);
+    object->add_volume(upper)->config.set_deserialize("fill_angle", "30");
+    object->add_instance()->set_offset(Vec3d(100., 100., 0.));
+    return model;
+}
+
+// A 20mm cube with a 10mm modifier cube in its middle. The modifier has its fill angle changed, so that its region differs
+// from the region of the cube, while the two regions share the layers in the middle of the cube and their perimeters there.
+static Model make_model_with_modifier()
+{
+    Model        model;
+    ModelObject *object = model.add_object();
+    object->name = "cube_with_modifier";
+    object->add_volume(make_cube(20., 20., 20.));
+    TriangleMesh modifier = make_cube(10., 10., 10.);
+    modifier.translate(5.f, 5.f, 5.f);
+    ModelVolume *volume = object->add_volume(modifier);
+    volume->set_type(ModelVolumeType::PARAMETER_MODIFIER);
+    volume->config.set_deserialize("fill_angle", "30");
+    object->add_instance()->set_offset(Vec3d(100., 100., 0.));
+    return model;
+}
+
+static DynamicPrintConfig make_config()
+{
+    DynamicPrintConfig config;
+    config.apply(FullPrintConfig());
+    config.set_deserialize("nozzle_diameter", "0.5");
+    config.set_deserialize("fill_density", "20%");
+    return config;
+}
+
+static void process(Print &print, const Model &model, const DynamicPrintConfig &config)
+{
+    print.set_status_silent();
+    print.apply(model, config);
+    print.process();
+}
+
+// The fills of a region at all the layers, each layer terminated by an empty polyline.
+static Polylines region_fills(const Print &print, size_t region_id)
+{
+    Polylines out;
+    const PrintObject &object = *print.objects().front();
+    for (size_t layer_id = 0; layer_id < object.layer_count(); ++ layer_id) {
+        object.get_layer(int(layer_id))->get_region(int(region_id))->fills.collect_polylines(out);
+        out.emplace_back();
+    }
+    return out;
+}
+
+// The perimeters of a region at all the layers, each layer terminated by an empty polyline.
+static Polylines region_perimeters(const Print &print, size_t region_id)
+{
+    Polylines out;
+    const PrintObject &object = *print.objects().front();
+    for (size_t layer_id = 0; layer_id < object.layer_count(); ++ layer_id) {
+        object.get_layer(int(layer_id))->get_region(int(region_id))->perimeters.collect_polylines(out);
+        out.emplace_back();
+    }
+    return out;
+}
+
+static bool same_polylines(const Polylines &a, const Polylines &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++ i)
+        if (a[i].points != b[i].points)
+            return false;
+    return true;
+}
+
+// Appends an empty collection to the fills (or perimeters) of a region at all layers. The marker is kept unless they are generated again.
+static void mark_region(Print &print, size_t region_id, ExtrusionEntityCollection LayerRegion::*extrusions = &LayerRegion::fills)
+{
+    PrintObject &object = *print.get_object(0);
+    for (size_t layer_id = 0; layer_id < object.layer_count(); ++ layer_id)
+        (object.get_layer(int(layer_id))->get_region(int(region_id))->*extrusions).append(ExtrusionEntityCollection());
+}
+
+static bool layer_region_marked(const LayerRegion &layerm, ExtrusionEntityCollection LayerRegion::*extrusions)
+{
+    const ExtrusionEntitiesPtr &entities = (layerm.*extrusions).entities;
+    return ! entities.empty() && entities.back()->is_collection() && static_cast<const ExtrusionEntityCollection*>(entities.back())->empty();
+}
+
+// For each layer, is the marker of mark_region() still there?
+static std::vector<bool> marked_layers(const Print &print, size_t region_id, ExtrusionEntityCollection LayerRegion::*extrusions = &LayerRegion::fills)
+{
+    std::vector<bool>  out;
+    const PrintObject &object = *print.objects().front();
+    for (size_t layer_id = 0; layer_id < object.layer_count(); ++ layer_id)
+        out.push_back(layer_region_marked(*object.get_layer(int(layer_id))->get_region(int(region_id)), extrusions));
+    return out;
+}
+
+static bool region_marked(const Print &print, size_t region_id, ExtrusionEntityCollection LayerRegion::*extrusions = &LayerRegion::fills)
+{
+    std::vector<bool> marked = marked_layers(print, region_id, extrusions);
+    return std::find(marked.begin(), marked.end(), false) == marked.end();
+}
+
+// Removes the markers, which are still there.
+static void unmark_region(Print &print, size_t region_id, ExtrusionEntityCollection LayerRegion::*extrusions = &LayerRegion::fills)
+{
+    PrintObject &object = *print.get_object(0);
+    for (size_t layer_id = 0; layer_id < object.layer_count(); ++ layer_id) {
+        LayerRegion &layerm = *object.get_layer(int(layer_id))->get_region(int(region_id));
+        if (layer_region_marked(layerm, extrusions))
+            (layerm.*extrusions).remove((layerm.*extrusions).entities.size() - 1);
+    }
+}
+
+// For each layer, does the region have any slices there?
+static std::vector<bool> region_layers(const Print &print, size_t region_id)
+{
+    std::vector<bool>  out;
+    const PrintObject &object = *print.objects().front();
+    for (size_t layer_id = 0; layer_id < object.layer_count(); ++ layer_id)
+        out.push_back(! object.get_layer(int(layer_id))->get_region(int(region_id))->slices.empty());
+    return out;
+}
+
+// Changes an option of the modifier region, which shares the layers of the cube region. The perimeters of both regions
+// are generated again at the shared layers and kept at the other layers, then the perimeters and the fills
+// are compared with those of a fresh print.
+static void test_modifier_perimeters_change(const char *opt_key, const char *value_before, const char *value_after)
+{
+    Model              model  = make_model_with_modifier();
+    DynamicPrintConfig config = make_config();
+    model.objects.front()->volumes[1]->config.set_deserialize(opt_key, value_before);
+    Print              print;
+    process(print, model, config);
+    ASSERT_EQ(print.regions().size(), 2u);
+    const std::vector<bool> shared = region_layers(print, 1);
+    ASSERT_NE(std::find(shared.begin(), shared.end(), true),  shared.end());
+    ASSERT_NE(std::find(shared.begin(), shared.end(), false), shared.end());
+
+    mark_region(print, 0, &LayerRegion::perimeters);
+    mark_region(print, 1, &LayerRegion::perimeters);
+    model.objects.front()->volumes[1]->config.set_deserialize(opt_key, value_after);
+    process(print, model, config);
+    ASSERT_EQ(print.regions().size(), 2u);
+    ASSERT_EQ(region_layers(print, 1), shared);
+
+    // The perimeters of the layers without the modifier are kept, the perimeters of both regions of the shared layers
+    // are generated again, as the regions have been or are now grouped.
+    std::vector<bool> kept = shared;
+    kept.flip();
+    ASSERT_EQ(marked_layers(print, 0, &LayerRegion::perimeters), kept);
+    ASSERT_EQ(marked_layers(print, 1, &LayerRegion::perimeters), kept);
+    unmark_region(print, 0, &LayerRegion::perimeters);
+    unmark_region(print, 1, &LayerRegion::perimeters);
+
+    Print fresh;
+    process(fresh, model, config);
+    ASSERT_TRUE(same_polylines(region_perimeters(print, 0), region_perimeters(fresh, 0)));
+    ASSERT_TRUE(same_polylines(region_perimeters(print, 1), region_perimeters(fresh, 1)));
+    ASSERT_TRUE(same_polylines(region_fills(print, 0), region_fills(fresh, 0)));
+    ASSERT_TRUE(same_polylines(region_fills(print, 1), region_fills(fresh, 1)));
+}
+
+TEST(RegionInfill, ChangeOfRegionInfillOnlyFillsThatRegion)
+{
+    Model              model  = make_model();
+    DynamicPrintConfig config = make_config();
+    Print              print;
+    process(print, model, config);
+    ASSERT_EQ(print.regions().size(), 2u);
+    const Polylines lower_before = region_fills(print, 0);
+    const Polylines upper_before = region_fills(print, 1);
+    ASSERT_FALSE(same_polylines(lower_before, upper_before));
+
+    mark_region(print, 0);
+    mark_region(print, 1);
+    model.objects.front()->volumes[1]->config.set_deserialize("fill_pattern", "honeycomb");
+    model.objects.front()->volumes[1]->config.set_deserialize("top_fill_pattern", "concentric");
+    process(print, model, config);
+
+    // Only the fills of the changed region were generated again.
+    ASSERT_TRUE(region_marked(print, 0));
+    ASSERT_FALSE(region_marked(print, 1));
+    unmark_region(print, 0);
+    ASSERT_TRUE(same_polylines(region_fills(print, 0), lower_before));
+    ASSERT_FALSE(same_polylines(region_fills(print, 1), upper_before));
+
+    // The result is the same as if the print was processed from scratch.
+    Print fresh;
+    process(fresh, model, config);
+    ASSERT_TRUE(same_polylines(region_fills(print, 0), region_fills(fresh, 0)));
+    ASSERT_TRUE(same_polylines(region_fills(print, 1), region_fills(fresh, 1)));
+}
+
+TEST(RegionInfill, ChangeOfRegionSolidInfillFillsAllRegions)
+{
+    Model              model  = make_model();
+    DynamicPrintConfig config = make_config();
+    Print              print;
+    process(print, model, config);
+    mark_region(print, 0);
+    mark_region(print, 1);
+    // The surfaces of a region are prepared for the infill together with the surfaces of the neighbor layers,
+    // the infill of the whole object is generated again.
+    model.objects.front()->volumes[1]->config.set_deserialize("solid_infill_every_layers", "5");
+    process(print, model, config);
+    ASSERT_FALSE(region_marked(print, 0));
+    ASSERT_FALSE(region_marked(print, 1));
+
+    Print fresh;
+    process(fresh, model, config);
+    ASSERT_TRUE(same_polylines(region_fills(print, 0), region_fills(fresh, 0)));
+    ASSERT_TRUE(same_polylines(region_fills(print, 1), region_fills(fresh, 1)));
+}
+
+TEST(RegionInfill, ChangeOfRegionFillDensityFillsThatRegion)
+{
+    Model              model  = make_model();
+    DynamicPrintConfig config = make_config();
+    Print              print;
+    process(print, model, config);
+    mark_region(print, 0);
+    mark_region(print, 1);
+    // The fill density changes the perimeters and the fills of the upper region. The surfaces of the lower region
+    // are prepared again, but they do not change, neither do its fills.
+    model.objects.front()->volumes[1]->config.set_deserialize("fill_density", "40%");
+    process(print, model, config);
+    ASSERT_TRUE(region_marked(print, 0));
+    ASSERT_FALSE(region_marked(print, 1));
+    unmark_region(print, 0);
+
+    Print fresh;
+    process(fresh, model, config);
+    ASSERT_TRUE(same_polylines(region_fills(print, 0), region_fills(fresh, 0)));
+    ASSERT_TRUE(same_polylines(region_fills(print, 1), region_fills(fresh, 1)));
+}
+
+TEST(RegionInfill, ChangeOfRegionPerimetersKeepsOtherRegions)
+{
+    Model              model  = make_model();
+    DynamicPrintConfig config = make_config();
+    Print              print;
+    process(print, model, config);
+    // The regions are compatible, still the upper region owns the perimeters of the upper layers, where the lower region is empty.
+    const PrintObject &object = *print.objects().front();
+    for (size_t layer_id = 0; layer_id < object.layer_count(); ++ layer_id) {
+        const Layer *layer = object.get_layer(int(layer_id));
+        ASSERT_EQ(layer->get_region(0)->perimeters.empty(), layer->get_region(0)->slices.empty());
+        ASSERT_EQ(layer->get_region(1)->perimeters.empty(), layer->get_region(1)->slices.empty());
+    }
+    mark_region(print, 0, &LayerRegion::perimeters);
+    mark_region(print, 0);
+    mark_region(print, 1, &LayerRegion::perimeters);
+    // The regions do not share any layer, the perimeters and the fills of the lower region are kept.
+    model.objects.front()->volumes[1]->config.set_deserialize("perimeters", "4");
+    process(print, model, config);
+    ASSERT_TRUE(region_marked(print, 0, &LayerRegion::perimeters));
+    ASSERT_TRUE(region_marked(print, 0));
+    ASSERT_FALSE(region_marked(print, 1, &LayerRegion::perimeters));
+    unmark_region(print, 0, &LayerRegion::perimeters);
+    unmark_region(print, 0);
+
+    Print fresh;
+    process(fresh, model, config);
+    ASSERT_TRUE(same_polylines(region_perimeters(print, 0), region_perimeters(fresh, 0)));
+    ASSERT_TRUE(same_polylines(region_perimeters(print, 1), region_perimeters(fresh, 1)));
+    ASSERT_TRUE(same_polylines(region_fills(print, 0), region_fills(fresh, 0)));
+    ASSERT_TRUE(same_polylines(region_fills(print, 1), region_fills(fresh, 1)));
+}
+
+TEST(RegionInfill, ChangeOfModifierPerimetersSplitsSharedPerimeters)
+{
+    // The modifier region shares the perimeters of the cube region before the change, not after it.
+    ASSERT_NO_FATAL_FAILURE(test_modifier_perimeters_change("perimeters", "3", "4"));
+}
+
+TEST(RegionInfill, ChangeOfModifierPerimetersJoinsPerimeters)
+{
+    // The modifier region gets its own perimeters before the change, it shares the perimeters of the cube region after it.
+    ASSERT_NO_FATAL_FAILURE(test_modifier_perimeters_change("perimeters", "4", "3"));
+}
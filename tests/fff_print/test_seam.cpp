@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include <libslic3r/GCode.hpp>
+
+using namespace Slic3r;
+
+static float bspline_kernel(float x)
+{
+    x = std::abs(x);
+    if (x < 1.f)
+        return 1.f - (3.f / 2.f) * x * x + (3.f / 4.f) * x * x * x;
+    if (x < 2.f) {
+        x -= 1.f;
+        return (1.f / 4.f) - (3.f / 4.f) * x + (3.f / 4.f) * x * x - (1.f / 4.f) * x * x * x;
+    }
+    return 0.f;
+}
+
+// The seam placement of GCode::extrude_loop() before the loops were scored ahead of the export:
+// The projection of last_pos is inserted first, then all the vertices are scored in a single pass.
+static Point place_seam_single_pass(Polygon polygon, bool was_clockwise, const Point &last_pos, float last_pos_weight, coordf_t nozzle_dmr)
+{
+    const coord_t nozzle_r = coord_t(scale_(0.5 * nozzle_dmr) + 0.5);
+    Points::iterator it = project_point_to_polygon_and_insert(polygon, last_pos, 0.1 * nozzle_r);
+    size_t last_pos_proj_idx = it - polygon.points.begin();
+    std::vector<float> lengths   = polygon_parameter_by_length(polygon);
+    std::vector<float> penalties = polygon_angles_at_vertices(polygon, lengths, float(nozzle_r));
+    const float penaltyConvexVertex = 1.f;
+    const float penaltyFlatSurface  = 5.f;
+    for (size_t i = 0; i < polygon.points.size(); ++ i) {
+        float ccwAngle = was_clockwise ? - penalties[i] : penalties[i];
+        float penalty = 0;
+        if (ccwAngle < - float(0.6 * PI))
+            penalty = 0.f;
+        else if (ccwAngle > float(0.6 * PI))
+            penalty = penaltyConvexVertex;
+        else if (ccwAngle < 0.f)
+            penalty = penaltyFlatSurface * bspline_kernel(ccwAngle * float(PI * 2. / 3.));
+        else
+            penalty = penaltyConvexVertex + (penaltyFlatSurface - penaltyConvexVertex) * bspline_kernel(ccwAngle * float(PI * 2. / 3.));
+        float dist_to_last_pos_proj = (i < last_pos_proj_idx) ?
+            std::min(lengths[last_pos_proj_idx] - lengths[i], lengths.back() - lengths[last_pos_proj_idx] + lengths[i]) :
+            std::min(lengths[i] - lengths[last_pos_proj_idx], lengths.back() - lengths[i] + lengths[last_pos_proj_idx]);
+        float dist_max = 0.1f * lengths.back();
+        penalty -= last_pos_weight * bspline_kernel(dist_to_last_pos_proj / dist_max);
+        penalties[i] = std::max(0.f, penalty);
+    }
+    size_t idx_min = std::min_element(penalties.begin(), penalties.end()) - penalties.begin();
+    float penalty_aligned  = penalties[last_pos_proj_idx];
+    float penalty_min      = penalties[idx_min];
+    float penalty_max      = std::max(penalty_min, penalty_aligned);
+    float penalty_diff_rel = (penalty_max == 0.f) ? 0.f : std::abs(penalty_min - penalty_aligned) / penalty_max;
+    if (penalty_diff_rel < 0.05)
+        idx_min = last_pos_proj_idx;
+    return polygon.points[idx_min];
+}
+
+// A wavy curve segmented finely compared to its size, counter clockwise. The segments are about as long
+// as the arms of the angles at the vertices, so that the arms of the neighbour vertices of an inserted point end at the point.
+// The arms of the smallest loop are shortened to a quarter of its length.
+static Polygon wavy_loop(double radius, double amplitude, int waves, size_t num_points)
+{
+    Polygon out;
+    for (size_t i = 0; i < num_points; ++ i) {
+        double phi = 2. * PI * double(i) / double(num_points);
+        double r   = radius + amplitude * std::sin(waves * phi) + 0.3 * amplitude * std::sin(3 * waves * phi + 1.);
+        out.points.emplace_back(Point::new_scale(r * std::cos(phi), r * std::sin(phi)));
+    }
+    return out;
+}
+
+// Scoring the loop ahead of the placement and placing the seam at the projection of last_pos
+// chooses the same seams as the single pass over the loop with the inserted projection.
+TEST(Seam, PlacementMatchesSinglePass)
+{
+    const coordf_t nozzle_dmr = 0.4;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> t(0.1, 0.9), offset(-1., 1.), angle(0., 2. * PI), distance(0., 15.);
+    size_t num_tests = 0, num_inserted = 0;
+    for (const Polygon &loop : { wavy_loop(10., 2., 7, 250), wavy_loop(10., 0.5, 12, 400), wavy_loop(1.5, 0.3, 3, 60), wavy_loop(0.12, 0.02, 3, 12) })
+        for (bool was_clockwise : { false, true })
+            for (float last_pos_weight : { 1.f, 5.f }) {
+                ExtrusionLoopSeam seam = score_seam(loop, was_clockwise, nozzle_dmr, nullptr);
+                ASSERT_EQ(seam.visibility.size(), loop.points.size());
+                std::uniform_int_distribution<size_t> edge(0, loop.points.size() - 1);
+                for (size_t i = 0; i < 500; ++ i) {
+                    Vec2d last_pos_d;
+                    if (i % 5 == 0) {
+                        // Anywhere around the loop.
+                        double phi = angle(rng), d = distance(rng) * unscale<double>(loop.bounding_box().size().x()) / 20.;
+                        last_pos_d = scale_(d) * Vec2d(std::cos(phi), std::sin(phi));
+                    } else {
+                        // Close to an edge of the loop, like the seam of the layer below.
+                        Line   line = loop.lines()[edge(rng)];
+                        Vec2d  dir  = (line.b - line.a).cast<double>();
+                        last_pos_d  = line.a.cast<double>() + t(rng) * dir + scale_(0.05 * offset(rng)) * Vec2d(- dir.y(), dir.x()).normalized();
+                    }
+                    Point   last_pos = last_pos_d.cast<coord_t>();
+                    Polygon inserted = loop;
+                    project_point_to_polygon_and_insert(inserted, last_pos, 0.1 * scale_(0.5 * nozzle_dmr));
+                    num_inserted += inserted.points.size() > loop.points.size();
+                    EXPECT_EQ(place_seam(loop, seam, last_pos, last_pos_weight, nozzle_dmr, nullptr), place_seam_single_pass(loop, was_clockwise, last_pos, last_pos_weight, nozzle_dmr));
+                    ++ num_tests;
+                }
+            }
+    // Most of the projections were inserted into the loops.
+    EXPECT_GT(num_inserted, num_tests / 2);
+}
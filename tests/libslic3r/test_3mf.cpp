@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+#include <boost/filesystem.hpp>
+
+#include <libslic3r/Format/3mf.hpp>
+#include <libslic3r/Model.hpp>
+#include <libslic3r/PrintConfig.hpp>
+#include <libslic3r/miniz_extension.hpp>
+
+using namespace Slic3r;
+
+// Coordinates, which are hard to be written and read back exactly.
+static std::vector<float> coordinates_to_round_trip()
+{
+    const float max = std::numeric_limits<float>::max();
+    std::vector<float> values = {
+        // Around the switch between the fixed point and the exponential notation.
+        1e-4f, std::nextafter(1e-4f, 0.f), std::nextafter(1e-4f, 1.f), 9.99999e-5f, 1.00001e-4f, 1e-5f,
+        1e9f, std::nextafter(1e9f, 0.f), std::nextafter(1e9f, max), 999999936.f, 3e10f, 1.2345678e11f,
+        // Subnormals.
+        std::numeric_limits<float>::denorm_min(), 2.f * std::numeric_limits<float>::denorm_min(), 1e-40f,
+        std::nextafter(std::numeric_limits<float>::min(), 0.f), std::numeric_limits<float>::min(),
+        // The shortest representations of these need max_digits10 significant digits.
+        std::nextafter(1.f, 2.f), std::nextafter(0.1f, 1.f), std::nextafter(100.f, 0.f), 0.1f + 0.2f, 16777215.f, 8388607.5f,
+    };
+    // Random values of all magnitudes written in the fixed point notation and some above.
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> mantissa(1.f, 10.f);
+    for (int e10 = -6; e10 <= 11; ++ e10)
+        for (size_t i = 0; i < 50; ++ i)
+            values.emplace_back(float(double(mantissa(rng)) * std::pow(10., e10)));
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+}
+
+// A tetrahedron with three edges of length v along the axes from zero for each of the values and its mirror image,
+// so that the mesh is closed and its bounding box is centered at zero, thus the importer does not move the mesh.
+// One more tetrahedron has its zero coordinates negative.
+static TriangleMesh make_mesh(const std::vector<float> &values)
+{
+    Pointf3s             points;
+    std::vector<Vec3crd> facets;
+    auto add_tetrahedron = [&points, &facets](double v, double zero) {
+        int o = int(points.size());
+        points.emplace_back(zero, zero, zero);
+        points.emplace_back(v, zero, zero);
+        points.emplace_back(zero, v, zero);
+        points.emplace_back(zero, zero, v);
+        facets.emplace_back(o, o + 2, o + 1);
+        facets.emplace_back(o, o + 1, o + 3);
+        facets.emplace_back(o, o + 3, o + 2);
+        facets.emplace_back(o + 1, o + 2, o + 3);
+    };
+    for (float v : values) {
+        add_tetrahedron(v, 0.);
+        add_tetrahedron(- v, 0.);
+    }
+    add_tetrahedron(1., -0.);
+    TriangleMesh mesh(points, facets);
+    mesh.repair();
+    return mesh;
+}
+
+static std::vector<Vec3f> sorted_vertices(const TriangleMesh &mesh)
+{
+    std::vector<Vec3f> vertices;
+    for (uint32_t i = 0; i < mesh.stl.stats.number_of_facets; ++ i)
+        for (const stl_vertex &v : mesh.stl.facet_start[i].vertex)
+            vertices.emplace_back(v);
+    auto lower = [](const Vec3f &a, const Vec3f &b) { return a(0) < b(0) || (a(0) == b(0) && (a(1) < b(1) || (a(1) == b(1) && a(2) < b(2)))); };
+    std::sort(vertices.begin(), vertices.end(), lower);
+    vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+    return vertices;
+}
+
+TEST(Format3mf, StoreAndLoadExactCoordinates)
+{
+    const std::vector<float> values = coordinates_to_round_trip();
+    Model        model;
+    ModelObject *object = model.add_object();
+    object->name = "coordinates";
+    object->add_volume(make_mesh(values));
+    object->add_instance();
+
+    const std::string path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("test_3mf-%%%%-%%%%.3mf")).string();
+    DynamicPrintConfig config;
+    ASSERT_TRUE(store_3mf(path.c_str(), &model, &config));
+    Model              loaded;
+    DynamicPrintConfig loaded_config;
+    bool               ok = load_3mf(path.c_str(), &loaded_config, &loaded);
+    boost::filesystem::remove(path);
+    ASSERT_TRUE(ok);
+
+    ASSERT_TRUE(loaded.objects.size() == 1 && loaded.objects.front()->volumes.size() == 1);
+    const ModelVolume &volume = *loaded.objects.front()->volumes.front();
+    ASSERT_TRUE(volume.get_offset() == Vec3d::Zero());
+    // Bitwise identical coordinates, only the negative zero may be read back as a positive one, as the exporter transforms the vertices.
+    std::vector<Vec3f> expected = sorted_vertices(object->volumes.front()->mesh());
+    std::vector<Vec3f> read     = sorted_vertices(volume.mesh());
+    ASSERT_EQ(read.size(), expected.size());
+    for (size_t i = 0; i < read.size(); ++ i)
+        for (int axis = 0; axis < 3; ++ axis)
+            ASSERT_TRUE(read[i](axis) == expected[i](axis) &&
+                (read[i](axis) == 0.f || std::memcmp(&read[i](axis), &expected[i](axis), sizeof(float)) == 0));
+}
+
+TEST(Format3mf, ZipFileWriterAddsFileByParts)
+{
+    std::string text;
+    for (size_t i = 0; i < 100000; ++ i)
+        text += "<vertex x=\"" + std::to_string(i) + "\"/>\n";
+
+    const std::string path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("test_3mf-%%%%-%%%%.zip")).string();
+    mz_zip_archive archive;
+    mz_zip_zero_struct(&archive);
+    ASSERT_TRUE(open_zip_writer(&archive, path));
+    {
+        // Not finished, therefore not recorded.
+        ZipFileWriter discarded(&archive, "discarded.txt");
+        EXPECT_TRUE(discarded.add(text));
+    }
+    const char *names[] = { "stored.txt", "deflated.txt", "stored_spilled.txt", "deflated_spilled.txt" };
+    for (size_t i = 0; i < 4; ++ i) {
+        mz_uint level = (i % 2 == 0) ? 0 : MZ_DEFAULT_LEVEL;
+        // The spilled files exceed the memory limit many times over, therefore they are copied from a temporary file.
+        ZipFileWriter file(&archive, names[i], level, i < 2 ? 16 * 1024 * 1024 : 4096);
+        for (size_t begin = 0; begin < text.size(); begin += 10007)
+            EXPECT_TRUE(file.add(text.data() + begin, std::min<size_t>(10007, text.size() - begin)));
+        EXPECT_TRUE(file.finish());
+    }
+    EXPECT_TRUE(mz_zip_writer_finalize_archive(&archive));
+    close_zip_writer(&archive);
+
+    mz_zip_zero_struct(&archive);
+    ASSERT_TRUE(open_zip_reader(&archive, path));
+    EXPECT_EQ(mz_zip_reader_get_num_files(&archive), 4u);
+    for (const char *name : names) {
+        size_t size = 0;
+        void  *data = mz_zip_reader_extract_file_to_heap(&archive, name, &size, 0);
+        ASSERT_TRUE(data != nullptr);
+        EXPECT_TRUE(std::string((const char*)data, size) == text);
+        mz_free(data);
+    }
+    close_zip_reader(&archive);
+    boost::filesystem::remove(path);
+}
+
+// A spilled file much larger than the memory limit and than the blocks, by which it is copied into the archive,
+// followed by another file, so that the offsets recorded after the copy are verified as well.
+TEST(Format3mf, ZipFileWriterSpillsLargeFile)
+{
+    std::mt19937 rng(0);
+    std::string  text;
+    while (text.size() < 16 * 1024 * 1024)
+        text += "<vertex x=\"" + std::to_string(rng() % 100000) + "\" y=\"" + std::to_string(rng() % 100000) + "\"/>\n";
+    const std::string small = "<model/>\n";
+
+    const std::string path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("test_3mf-%%%%-%%%%.zip")).string();
+    mz_zip_archive archive;
+    mz_zip_zero_struct(&archive);
+    ASSERT_TRUE(open_zip_writer(&archive, path));
+    const char *names[] = { "stored_spilled.txt", "deflated_spilled.txt" };
+    for (size_t i = 0; i < 2; ++ i) {
+        ZipFileWriter file(&archive, names[i], i == 0 ? 0 : MZ_DEFAULT_LEVEL, 1024 * 1024);
+        for (size_t begin = 0; begin < text.size(); begin += 1000003)
+            EXPECT_TRUE(file.add(text.data() + begin, std::min<size_t>(1000003, text.size() - begin)));
+        EXPECT_TRUE(file.finish());
+    }
+    {
+        ZipFileWriter file(&archive, "small.txt");
+        EXPECT_TRUE(file.add(small));
+        EXPECT_TRUE(file.finish());
+    }
+    EXPECT_TRUE(mz_zip_writer_finalize_archive(&archive));
+    close_zip_writer(&archive);
+
+    mz_zip_zero_struct(&archive);
+    ASSERT_TRUE(open_zip_reader(&archive, path));
+    EXPECT_EQ(mz_zip_reader_get_num_files(&archive), 3u);
+    // Checks the local headers against the central directory and the CRCs of the inflated files.
+    EXPECT_TRUE(mz_zip_validate_archive(&archive, 0));
+    for (size_t i = 0; i < 3; ++ i) {
+        const char *name = i < 2 ? names[i] : "small.txt";
+        int         file_index = mz_zip_reader_locate_file(&archive, name, nullptr, 0);
+        ASSERT_GE(file_index, 0);
+        mz_zip_archive_file_stat stat;
+        ASSERT_TRUE(mz_zip_reader_file_stat(&archive, mz_uint(file_index), &stat));
+        EXPECT_EQ(stat.m_method, i == 0 ? 0 : MZ_DEFLATED);
+        if (i < 2)
+            // Many times the memory limit.
+            EXPECT_GT(stat.m_comp_size, 2u * 1024 * 1024);
+        size_t size = 0;
+        void  *data = mz_zip_reader_extract_to_heap(&archive, mz_uint(file_index), &size, 0);
+        ASSERT_TRUE(data != nullptr);
+        EXPECT_TRUE(std::string((const char*)data, size) == (i < 2 ? text : small));
+        mz_free(data);
+    }
+    close_zip_reader(&archive);
+    boost::filesystem::remove(path);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <libslic3r/ClipperUtils.hpp>
+#include <libslic3r/ExPolygon.hpp>
+
+using namespace Slic3r;
+
+static Polygon square(double x, double y, double size)
+{
+    return Polygon({ Point::new_scale(x, y), Point::new_scale(x + size, y), Point::new_scale(x + size, y + size), Point::new_scale(x, y + size) });
+}
+
+static Polygon reversed(Polygon polygon)
+{
+    polygon.reverse();
+    return polygon;
+}
+
+// Inputs of the fused operations: Contours with holes (clockwise polygons), overlapping contours,
+// self-intersecting polygons and holes sticking out of their contours.
+static std::vector<Polygons> test_inputs()
+{
+    std::vector<Polygons> out;
+    // A square with a square hole, and an island inside the hole.
+    out.push_back({ square(0., 0., 10.), reversed(square(3., 3., 4.)), square(4.5, 4.5, 1.) });
+    // Overlapping squares, one of them with a hole crossing the other square.
+    out.push_back({ square(0., 0., 10.), square(6., 2., 10.), reversed(square(8., 4., 4.)) });
+    // A bow tie.
+    out.push_back({ Polygon({ Point::new_scale(0., 0.), Point::new_scale(10., 10.), Point::new_scale(10., 0.), Point::new_scale(0., 10.) }) });
+    // A pentagram, its center is wound twice.
+    {
+        Polygon star;
+        for (int i = 0; i < 5; ++ i) {
+            double phi = 2. * PI * (2 * i) / 5.;
+            star.points.emplace_back(Point::new_scale(10. * std::cos(phi), 10. * std::sin(phi)));
+        }
+        out.push_back({ star });
+        // The same with a clockwise star hole punched into a square.
+        out.push_back({ square(-12., -12., 24.), reversed(star) });
+    }
+    // A hole sticking out of its contour and a self-touching polygon.
+    out.push_back({ square(0., 0., 10.), reversed(square(8., 3., 4.)),
+                    Polygon({ Point::new_scale(20., 0.), Point::new_scale(30., 0.), Point::new_scale(25., 5.), Point::new_scale(30., 10.), Point::new_scale(20., 10.), Point::new_scale(25., 5.) }) });
+    return out;
+}
+
+static bool equal(const Polygons &a, const Polygons &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++ i)
+        if (a[i].points != b[i].points)
+            return false;
+    return true;
+}
+
+static bool equal(const ExPolygons &a, const ExPolygons &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++ i)
+        if (a[i].contour.points != b[i].contour.points || ! equal(a[i].holes, b[i].holes))
+            return false;
+    return true;
+}
+
+TEST(ClipperUtils, UnionOffsetMatchesComposition)
+{
+    const std::vector<Polygons> inputs = test_inputs();
+    for (size_t i = 0; i < inputs.size(); ++ i)
+        for (float delta : { - scale_(1.), - scale_(0.3), scale_(0.3), scale_(2.) }) {
+            Polygons polygons = union_offset(inputs[i], delta);
+            EXPECT_TRUE(equal(polygons, offset(union_ex(inputs[i]), delta))) << "input " << i << ", delta " << delta;
+            ExPolygons expolygons = union_offset_ex(inputs[i], delta);
+            EXPECT_TRUE(equal(expolygons, offset_ex(union_ex(inputs[i]), delta))) << "input " << i << ", delta " << delta;
+            for (ClipperLib::JoinType join : { ClipperLib::jtRound, ClipperLib::jtSquare }) {
+                EXPECT_TRUE(equal(union_offset(inputs[i], delta, join), offset(union_ex(inputs[i]), delta, join)));
+                EXPECT_TRUE(equal(union_offset_ex(inputs[i], delta, join), offset_ex(union_ex(inputs[i]), delta, join)));
+            }
+        }
+    // The offsets of the inputs with holes are not empty.
+    EXPECT_FALSE(union_offset_ex(inputs[0], - scale_(0.3)).empty());
+    EXPECT_FALSE(union_offset_ex(inputs[0], - scale_(0.3)).front().holes.empty());
+}
+
+TEST(ClipperUtils, Offset2ExMatchesComposition)
+{
+    const std::vector<Polygons> inputs = test_inputs();
+    for (size_t i = 0; i < inputs.size(); ++ i) {
+        const ExPolygons expolygons = union_ex(inputs[i]);
+        ASSERT_FALSE(expolygons.empty());
+        for (std::pair<float, float> deltas : { std::make_pair(- scale_(0.6), scale_(0.6)), std::make_pair(scale_(1.), - scale_(1.)),
+                                                 std::make_pair(- scale_(0.2), scale_(0.5)), std::make_pair(- scale_(3.), scale_(3.)) })
+            for (ClipperLib::JoinType join : { ClipperLib::jtMiter, ClipperLib::jtRound, ClipperLib::jtSquare }) {
+                // The sequence of operations offset2_ex(ExPolygons) used to perform.
+                Polygons polys;
+                for (const ExPolygon &expoly : expolygons)
+                    append(polys, offset(offset_ex(expoly, deltas.first, join), deltas.second, join));
+                EXPECT_TRUE(equal(offset2_ex(expolygons, deltas.first, deltas.second, join), union_ex(polys)))
+                    << "input " << i << ", deltas " << deltas.first << " " << deltas.second;
+            }
+    }
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <libslic3r/PrintConfig.hpp>
+
+using namespace Slic3r;
+
+// The definitions indexed by id shall point into the options of the ConfigDef itself.
+static bool by_id_consistent(const ConfigDef &def)
+{
+    if (def.by_id().size() != def.options.size())
+        return false;
+    for (const auto &kvp : def.options)
+        if (def.by_id()[kvp.second.id] != &kvp.second || kvp.second.opt_key != kvp.first)
+            return false;
+    return true;
+}
+
+// ConfigBase::diff() by looking up the options by their keys, as it was done before the options were addressed by ids.
+static t_config_option_keys diff_by_keys(const ConfigBase &lhs, const ConfigBase &rhs)
+{
+    t_config_option_keys diff;
+    for (const t_config_option_key &opt_key : lhs.keys()) {
+        const ConfigOption *lhs_opt = lhs.option(opt_key);
+        const ConfigOption *rhs_opt = rhs.option(opt_key);
+        if (lhs_opt != nullptr && rhs_opt != nullptr && *lhs_opt != *rhs_opt)
+            diff.emplace_back(opt_key);
+    }
+    return diff;
+}
+
+TEST(ConfigDef, Ids)
+{
+    ASSERT_TRUE(by_id_consistent(print_config_def));
+    ASSERT_TRUE(by_id_consistent(cli_misc_config_def));
+}
+
+TEST(ConfigDef, CopyAndMoveKeepIds)
+{
+    ConfigDef copy(print_config_def);
+    ASSERT_TRUE(by_id_consistent(copy));
+    for (const auto &kvp : print_config_def.options)
+        ASSERT_EQ(copy.get(kvp.first)->id, kvp.second.id);
+
+    ConfigDef assigned;
+    assigned = copy;
+    ASSERT_TRUE(by_id_consistent(assigned));
+
+    ConfigDef moved(std::move(copy));
+    ASSERT_TRUE(by_id_consistent(moved));
+    ASSERT_TRUE(copy.options.empty() && copy.by_id().empty());
+    for (const auto &kvp : print_config_def.options)
+        ASSERT_EQ(moved.get(kvp.first)->id, kvp.second.id);
+
+    assigned = std::move(moved);
+    ASSERT_TRUE(by_id_consistent(assigned));
+    ASSERT_TRUE(moved.options.empty() && moved.by_id().empty());
+}
+
+TEST(ConfigDef, StaticConfigDiffMatchesDiffByKeys)
+{
+    PrintConfig        config;
+    DynamicPrintConfig other;
+    other.apply(FullPrintConfig());
+    ASSERT_TRUE(config.diff(other).empty());
+    ASSERT_TRUE(diff_by_keys(config, other).empty());
+
+    // Options of PrintConfig, an option of another static config and an option missing in PrintConfig.
+    other.set_deserialize("bed_temperature", "80,80");
+    other.set_deserialize("gcode_flavor", "marlin");
+    other.set_deserialize("start_gcode", "G28");
+    other.set_deserialize("nozzle_diameter", "0.6,0.6");
+    other.set_deserialize("z_offset", "0.1");
+    other.set_deserialize("perimeters", "5");
+    other.set_deserialize("fill_density", "42%");
+    t_config_option_keys diff = config.diff(other);
+    ASSERT_EQ(diff, diff_by_keys(config, other));
+    ASSERT_EQ(diff, t_config_option_keys({ "bed_temperature", "gcode_flavor", "nozzle_diameter", "start_gcode", "z_offset" }));
+
+    // The options missing in the other config are ignored.
+    DynamicPrintConfig partial;
+    partial.set_deserialize("z_offset", "0.1");
+    partial.set_deserialize("perimeters", "5");
+    ASSERT_EQ(config.diff(partial), diff_by_keys(config, partial));
+    ASSERT_EQ(config.diff(partial), t_config_option_keys({ "z_offset" }));
+
+    // The same for the applied options.
+    config.apply_only(other, config.diff_ids(other));
+    ASSERT_TRUE(config.diff(other).empty());
+    ASSERT_TRUE(diff_by_keys(config, other).empty());
+}
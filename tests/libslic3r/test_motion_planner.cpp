@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include <libslic3r/ExPolygon.hpp>
+#include <libslic3r/MotionPlanner.hpp>
+
+using namespace Slic3r;
+
+// A polygon around a center with a random radius at each of the vertices, counter clockwise.
+static Polygon random_polygon(std::mt19937 &rng, const Vec2d &center, double r_min, double r_max, size_t num_points)
+{
+    std::uniform_real_distribution<double> radius(r_min, r_max);
+    Polygon out;
+    for (size_t i = 0; i < num_points; ++ i) {
+        double phi = 2. * PI * double(i) / double(num_points);
+        double r   = radius(rng);
+        out.points.emplace_back(Point::new_scale(center.x() + r * std::cos(phi), center.y() + r * std::sin(phi)));
+    }
+    return out;
+}
+
+// Islands with holes, star shaped, so that their edges are of very different lengths and the rows of the grid
+// are crossed by many edges. The last island has axis aligned edges and collinear vertices.
+static ExPolygons test_islands()
+{
+    std::mt19937 rng(0);
+    ExPolygons   out;
+    for (size_t i = 0; i < 8; ++ i) {
+        ExPolygon island;
+        island.contour = random_polygon(rng, Vec2d(0., 0.), 20., 40., 10 + 40 * i);
+        for (size_t j = 0; j < i; ++ j) {
+            double phi = 2. * PI * double(j) / double(i);
+            Polygon hole = random_polygon(rng, Vec2d(10. * std::cos(phi), 10. * std::sin(phi)), 1., 4., 5 + 7 * j);
+            hole.reverse();
+            island.holes.emplace_back(std::move(hole));
+        }
+        out.emplace_back(std::move(island));
+    }
+    ExPolygon island;
+    island.contour.points = { Point::new_scale(0., 0.), Point::new_scale(10., 0.), Point::new_scale(20., 0.), Point::new_scale(20., 20.), Point::new_scale(0., 20.), Point::new_scale(0., 10.) };
+    island.holes.emplace_back(Polygon({ Point::new_scale(5., 5.), Point::new_scale(5., 15.), Point::new_scale(15., 15.), Point::new_scale(15., 5.) }));
+    out.emplace_back(std::move(island));
+    return out;
+}
+
+// MotionPlannerIslandIndex::contains_b() answers the same as ExPolygon::contains_b(), which tests all the edges of the island.
+TEST(MotionPlanner, IslandIndexMatchesContainsB)
+{
+    std::mt19937 rng(1);
+    for (const ExPolygon &island : test_islands()) {
+        MotionPlannerIslandIndex index;
+        index.create(island);
+        ASSERT_FALSE(index.empty());
+        BoundingBox bbox = get_extents(island);
+        bbox.offset(scale_(1.));
+
+        Points points;
+        // Points spread over the bounding box of the island and beyond.
+        std::uniform_int_distribution<coord_t> x(bbox.min(0), bbox.max(0)), y(bbox.min(1), bbox.max(1));
+        for (size_t i = 0; i < 20000; ++ i)
+            points.emplace_back(x(rng), y(rng));
+        // Points on the edges, at their end points and close to them on either side, at the distance of the boundary tolerance.
+        std::uniform_real_distribution<double> t(0., 1.);
+        std::uniform_int_distribution<int>     d(- 3 * int(SCALED_EPSILON), 3 * int(SCALED_EPSILON));
+        for (const Polygon &polygon : to_polygons(island))
+            for (const Line &line : polygon.lines()) {
+                points.emplace_back(line.a);
+                points.emplace_back(line.a + Point(d(rng), d(rng)));
+                points.emplace_back(line.a(0), line.b(1));
+                for (size_t i = 0; i < 4; ++ i) {
+                    Point pt = line.a + ((line.b - line.a).cast<double>() * t(rng)).cast<coord_t>();
+                    points.emplace_back(pt);
+                    points.emplace_back(pt + Point(d(rng), d(rng)));
+                    points.emplace_back(pt(0), pt(1) + d(rng));
+                }
+            }
+
+        size_t num_inside = 0, num_outside = 0;
+        for (const Point &pt : points) {
+            bool inside = island.contains_b(pt);
+            EXPECT_EQ(index.contains_b(pt), inside) << "point " << pt(0) << ", " << pt(1);
+            ++ (inside ? num_inside : num_outside);
+        }
+        EXPECT_GT(num_inside, points.size() / 10);
+        EXPECT_GT(num_outside, points.size() / 10);
+    }
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include <libslic3r/Profiler.hpp>
+
+using namespace Slic3r;
+
+TEST(Profiler, ChromeTraceEscapesZoneNames)
+{
+    Profiler::clear();
+    Profiler::enable();
+    {
+        SLIC3R_PROFILE_ZONE("zone \"quoted\" back\\slash\nnew line\ttab\x01");
+    }
+    Profiler::enable(false);
+
+    const std::string path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("test_profiler-%%%%-%%%%.json")).string();
+    ASSERT_TRUE(Profiler::write_chrome_trace(path));
+    std::stringstream trace;
+    {
+        std::ifstream file(path);
+        trace << file.rdbuf();
+    }
+    boost::filesystem::remove(path);
+    Profiler::clear();
+
+    std::string json = trace.str();
+    EXPECT_NE(json.find("\"name\":\"zone \\\"quoted\\\" back\\\\slash\\nnew line\\ttab\\u0001\""), std::string::npos);
+    // Only the line breaks between the events are left unescaped.
+    for (char c : json)
+        EXPECT_TRUE((unsigned char)c >= 0x20 || c == '\n');
+}
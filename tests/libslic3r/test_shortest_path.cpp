@@ -0,0 +1,286 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+
+#include <libslic3r/ExtrusionEntity.hpp>
+#include <libslic3r/ExtrusionEntityCollection.hpp>
+#include <libslic3r/PolylineCollection.hpp>
+
+using namespace Slic3r;
+
+// The chaining of ExtrusionEntityCollection::chained_path_from() by the linear search, before ShortestPath was introduced.
+static void chained_path_from_linear(const ExtrusionEntityCollection &src, Point start_near, ExtrusionEntityCollection &retval, bool no_reverse, std::vector<size_t> &orig_indices)
+{
+    std::map<ExtrusionEntity*, size_t> indices_map;
+    ExtrusionEntitiesPtr my_paths;
+    for (ExtrusionEntitiesPtr::const_iterator it = src.entities.begin(); it != src.entities.end(); ++it) {
+        ExtrusionEntity* entity = (*it)->clone();
+        my_paths.push_back(entity);
+        indices_map[entity] = it - src.entities.begin();
+    }
+    Points endpoints;
+    for (ExtrusionEntitiesPtr::iterator it = my_paths.begin(); it != my_paths.end(); ++it) {
+        endpoints.push_back((*it)->first_point());
+        if (no_reverse || !(*it)->can_reverse()) {
+            endpoints.push_back((*it)->first_point());
+        } else {
+            endpoints.push_back((*it)->last_point());
+        }
+    }
+    while (!my_paths.empty()) {
+        int start_index = start_near.nearest_point_index(endpoints);
+        int path_index = start_index/2;
+        ExtrusionEntity* entity = my_paths.at(path_index);
+        if (start_index % 2 && !no_reverse && entity->can_reverse()) {
+            entity->reverse();
+        }
+        retval.entities.push_back(my_paths.at(path_index));
+        orig_indices.push_back(indices_map[entity]);
+        my_paths.erase(my_paths.begin() + path_index);
+        endpoints.erase(endpoints.begin() + 2*path_index, endpoints.begin() + 2*path_index + 2);
+        start_near = retval.entities.back()->last_point();
+    }
+}
+
+// The chaining of PolylineCollection::chained_path_from() by the linear search, before ShortestPath was introduced.
+static Polylines polylines_chained_path_from_linear(const Polylines &src, Point start_near, bool no_reverse)
+{
+    struct Chaining { Point first; Point last; size_t idx; };
+    std::vector<Chaining> endpoints;
+    for (size_t i = 0; i < src.size(); ++ i)
+        endpoints.push_back({ src[i].first_point(), no_reverse ? Point() : src[i].last_point(), i });
+    Polylines retval;
+    while (! endpoints.empty()) {
+        double dmin = std::numeric_limits<double>::max();
+        int    idx  = 0;
+        for (std::vector<Chaining>::const_iterator it = endpoints.begin(); it != endpoints.end(); ++it) {
+            double d = sqr(double(start_near(0) - it->first(0)));
+            if (d <= dmin) {
+                d += sqr(double(start_near(1) - it->first(1)));
+                if (d < dmin) {
+                    idx = (it - endpoints.begin()) * 2;
+                    dmin = d;
+                    if (dmin < EPSILON)
+                        break;
+                }
+            }
+            if (! no_reverse) {
+                d = sqr(double(start_near(0) - it->last(0)));
+                if (d <= dmin) {
+                    d += sqr(double(start_near(1) - it->last(1)));
+                    if (d < dmin) {
+                        idx = (it - endpoints.begin()) * 2 + 1;
+                        dmin = d;
+                        if (dmin < EPSILON)
+                            break;
+                    }
+                }
+            }
+        }
+        retval.push_back(src[endpoints[idx/2].idx]);
+        if (idx & 1)
+            retval.back().reverse();
+        endpoints.erase(endpoints.begin() + idx/2);
+        start_near = retval.back().last_point();
+    }
+    return retval;
+}
+
+// Random points on a coarse grid, so that there are many coincident end points and many ties of the distances.
+struct RandomPoints
+{
+    std::mt19937                           rng;
+    std::uniform_int_distribution<coord_t> coord { 0, 12 };
+
+    RandomPoints(unsigned int seed) : rng(seed) {}
+    Point   point() { return Point(coord(rng), coord(rng)); }
+    size_t  count(size_t min, size_t max) { return std::uniform_int_distribution<size_t>(min, max)(rng); }
+
+    Polyline polyline()
+    {
+        Polyline polyline;
+        for (size_t i = this->count(2, 4); i > 0; -- i)
+            polyline.points.emplace_back(this->point());
+        return polyline;
+    }
+    ExtrusionPath path()
+    {
+        ExtrusionPath path(erInternalInfill);
+        path.polyline = this->polyline();
+        return path;
+    }
+    ExtrusionLoop loop()
+    {
+        ExtrusionPath path = this->path();
+        path.polyline.points.push_back(path.polyline.points.front());
+        return ExtrusionLoop(std::move(path));
+    }
+    // Mixture of open paths, loops, sortable collections and non-sortable collections (as the concentric infill).
+    ExtrusionEntityCollection collection(size_t num_entities, bool nested = true)
+    {
+        ExtrusionEntityCollection out;
+        for (size_t i = 0; i < num_entities; ++ i) {
+            size_t type = this->count(0, nested ? 3 : 1);
+            if (type == 0)
+                out.append(this->path());
+            else if (type == 1)
+                out.append(this->loop());
+            else {
+                ExtrusionEntityCollection child = this->collection(this->count(1, 3), false);
+                child.no_sort = type == 3;
+                out.append(child);
+            }
+        }
+        return out;
+    }
+};
+
+static bool same_polylines(const Polylines &a, const Polylines &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++ i)
+        if (a[i].points != b[i].points)
+            return false;
+    return true;
+}
+
+static bool same_entities(const ExtrusionEntitiesPtr &a, const ExtrusionEntitiesPtr &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++ i)
+        if (! same_polylines(a[i]->as_polylines(), b[i]->as_polylines()))
+            return false;
+    return true;
+}
+
+TEST(ShortestPath, ChainedPathFromMatchesLinearSearch)
+{
+    RandomPoints random(1);
+    for (size_t test = 0; test < 2000; ++ test) {
+        ExtrusionEntityCollection src        = random.collection(random.count(1, 40));
+        Point                     start_near = random.point();
+        bool                      no_reverse = test % 4 == 3;
+        ExtrusionEntityCollection chained, chained_linear;
+        std::vector<size_t>       indices, indices_linear;
+        src.chained_path_from(start_near, &chained, no_reverse, erMixed, &indices);
+        chained_path_from_linear(src, start_near, chained_linear, no_reverse, indices_linear);
+        ASSERT_EQ(indices, indices_linear);
+        ASSERT_TRUE(same_entities(chained.entities, chained_linear.entities));
+    }
+}
+
+TEST(ShortestPath, ChainedPathContinuesFromEndOfNonReversibleEntity)
+{
+    // A non-reversible path from (0, 0) to (100, 0). The next entity shall be the one closest to (100, 0).
+    ExtrusionEntityCollection src;
+    ExtrusionEntityCollection concentric;
+    concentric.no_sort = true;
+    ExtrusionPath path(erInternalInfill);
+    path.polyline.points = { Point(0, 0), Point(100, 0) };
+    concentric.append(path);
+    src.append(concentric);
+    path.polyline.points = { Point(10, 10), Point(20, 10) };
+    src.append(path);
+    path.polyline.points = { Point(90, 10), Point(80, 10) };
+    src.append(path);
+    ExtrusionEntityCollection chained;
+    std::vector<size_t>       indices;
+    src.chained_path_from(Point(0, 0), &chained, false, erMixed, &indices);
+    ASSERT_EQ(indices, std::vector<size_t>({ 0, 2, 1 }));
+    ASSERT_TRUE(chained.entities[2]->first_point() == Point(20, 10));
+}
+
+// The order of the infill extrusions of GCode::extrude_infill() by the linear search: the region infills are chained,
+// then the items of each collection are chained from the end of the previous extrusion. No sort collections (as the concentric infill)
+// are extruded as they are.
+static Polylines extrude_infill_order_linear(const ExtrusionEntityCollection &infills, Point last_pos)
+{
+    Polylines                 out;
+    ExtrusionEntityCollection chained;
+    std::vector<size_t>       indices;
+    chained_path_from_linear(infills, last_pos, chained, false, indices);
+    for (const ExtrusionEntity *fill : chained.entities) {
+        ExtrusionEntityCollection fills;
+        if (! fill->is_collection())
+            fills.append(*fill);
+        else if (static_cast<const ExtrusionEntityCollection*>(fill)->no_sort)
+            fills = *static_cast<const ExtrusionEntityCollection*>(fill);
+        else
+            chained_path_from_linear(*static_cast<const ExtrusionEntityCollection*>(fill), last_pos, fills, false, indices);
+        for (const ExtrusionEntity *ee : fills.entities) {
+            out.emplace_back(ee->as_polyline());
+            last_pos = ee->last_point();
+        }
+    }
+    return out;
+}
+
+// The same order by ExtrusionEntityCollection::chained_order_from(), as GCode::extrude_infill() does it.
+static Polylines extrude_infill_order(const ExtrusionEntityCollection &infills, Point last_pos)
+{
+    Polylines out;
+    auto extrude = [&out, &last_pos](const ExtrusionEntity &fill, bool reversed) {
+        std::unique_ptr<ExtrusionEntity> ee(fill.clone());
+        if (reversed)
+            ee->reverse();
+        out.emplace_back(ee->as_polyline());
+        last_pos = ee->last_point();
+    };
+    for (const std::pair<size_t, bool> &o : infills.chained_order_from(last_pos, false)) {
+        const ExtrusionEntity *fill = infills.entities[o.first];
+        if (fill->is_collection()) {
+            ExtrusionEntityCollection fills(*static_cast<const ExtrusionEntityCollection*>(fill));
+            if (o.second)
+                fills.reverse();
+            for (const std::pair<size_t, bool> &o2 : fills.chained_order_from(last_pos, false))
+                extrude(*fills.entities[o2.first], o2.second);
+        } else
+            extrude(*fill, o.second);
+    }
+    return out;
+}
+
+TEST(ShortestPath, ExtrudeInfillOrderMatchesLinearSearch)
+{
+    RandomPoints random(4);
+    for (size_t test = 0; test < 2000; ++ test) {
+        ExtrusionEntityCollection infills = random.collection(random.count(1, 20));
+        Point                     start   = random.point();
+        ASSERT_TRUE(same_polylines(extrude_infill_order(infills, start), extrude_infill_order_linear(infills, start)));
+    }
+}
+
+TEST(ShortestPath, ChainExtrusionPathsMatchesLinearSearch)
+{
+    RandomPoints random(2);
+    for (size_t test = 0; test < 2000; ++ test) {
+        ExtrusionPaths paths;
+        for (size_t i = random.count(1, 40); i > 0; -- i)
+            paths.emplace_back(random.path());
+        bool                      no_reverse = test % 4 == 3;
+        ExtrusionEntityCollection src(paths), chained_linear;
+        std::vector<size_t>       indices_linear;
+        chained_path_from_linear(src, paths.front().first_point(), chained_linear, no_reverse, indices_linear);
+        chain_extrusion_paths(paths, no_reverse);
+        ExtrusionEntityCollection chained(paths);
+        ASSERT_TRUE(same_entities(chained.entities, chained_linear.entities));
+    }
+}
+
+TEST(ShortestPath, PolylinesChainedPathMatchesLinearSearch)
+{
+    RandomPoints random(3);
+    for (size_t test = 0; test < 2000; ++ test) {
+        Polylines src;
+        for (size_t i = random.count(1, 40); i > 0; -- i)
+            src.emplace_back(random.polyline());
+        Point start_near = random.point();
+        bool  no_reverse = test % 4 == 3;
+        ASSERT_TRUE(same_polylines(PolylineCollection::chained_path_from(src, start_near, no_reverse), polylines_chained_path_from_linear(src, start_near, no_reverse)));
+    }
+}
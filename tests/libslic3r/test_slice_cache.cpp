@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <ctime>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/cstdio.hpp>
+
+#include <libslic3r/SliceCache.hpp>
+#include <libslic3r/TriangleMesh.hpp>
+
+using namespace Slic3r;
+
+// Layers of squares with a square hole, some of them at negative coordinates.
+static std::vector<ExPolygons> make_layers(size_t num_layers)
+{
+    std::vector<ExPolygons> layers(num_layers);
+    for (size_t i = 0; i < num_layers; ++ i) {
+        coord_t   d = coord_t(i) * 1000 - 3000000;
+        ExPolygon expoly;
+        expoly.contour.points = { Point(d, d), Point(d + 2000000, d), Point(d + 2000000, d + 2000000), Point(d, d + 2000000) };
+        expoly.holes.emplace_back(Polygon({ Point(d + 500000, d + 500000), Point(d + 500000, d + 1500000), Point(d + 1500000, d + 1500000), Point(d + 1500000, d + 500000) }));
+        layers[i].emplace_back(std::move(expoly));
+        if (i % 3 == 0)
+            // Some layers are empty, some contain more islands.
+            layers[i].clear();
+        else if (i % 3 == 1) {
+            ExPolygon island;
+            island.contour.points = { Point(-d, -d), Point(-d + 10, -d), Point(-d, -d + 10) };
+            layers[i].emplace_back(std::move(island));
+        }
+    }
+    return layers;
+}
+
+static bool equal_layers(const std::vector<ExPolygons> &a, const std::vector<ExPolygons> &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++ i) {
+        if (a[i].size() != b[i].size())
+            return false;
+        for (size_t j = 0; j < a[i].size(); ++ j) {
+            const ExPolygon &ea = a[i][j];
+            const ExPolygon &eb = b[i][j];
+            if (ea.contour.points != eb.contour.points || ea.holes.size() != eb.holes.size())
+                return false;
+            for (size_t k = 0; k < ea.holes.size(); ++ k)
+                if (ea.holes[k].points != eb.holes[k].points)
+                    return false;
+        }
+    }
+    return true;
+}
+
+static SliceCache::Key make_test_key(float z, size_t num_layers = 100)
+{
+    std::vector<float> zs;
+    for (size_t i = 0; i < num_layers; ++ i)
+        zs.emplace_back(z + 0.2f * float(i));
+    return SliceCache::make_key(make_cube(10., 10., 10.), zs, 0.049f);
+}
+
+struct TempDirectory
+{
+    TempDirectory() : path(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("slice_cache_test-%%%%-%%%%")) {}
+    ~TempDirectory() { boost::system::error_code ec; boost::filesystem::remove_all(path, ec); }
+    boost::filesystem::path path;
+};
+
+static void read_file(const std::string &path, std::string &data)
+{
+    data.clear();
+    FILE *file = boost::nowide::fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    char buf[4096];
+    for (size_t len; (len = fread(buf, 1, sizeof(buf), file)) > 0;)
+        data.append(buf, len);
+    fclose(file);
+}
+
+static void write_file(const std::string &path, const std::string &data)
+{
+    FILE *file = boost::nowide::fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(fwrite(data.data(), 1, data.size(), file), data.size());
+    fclose(file);
+}
+
+TEST(SliceCache, Key)
+{
+    ASSERT_TRUE(make_test_key(0.1f) == make_test_key(0.1f));
+    ASSERT_FALSE(make_test_key(0.1f) == make_test_key(0.2f));
+    ASSERT_FALSE(SliceCache::make_key(make_cube(10., 10., 10.), { 0.1f }, 0.049f) == SliceCache::make_key(make_cube(10., 10., 10.), { 0.1f }, 0.05f));
+    ASSERT_FALSE(SliceCache::make_key(make_cube(10., 10., 10.), { 0.1f }, 0.049f) == SliceCache::make_key(make_cube(10., 10., 11.), { 0.1f }, 0.049f));
+    SliceCache::Key key = make_test_key(0.1f, 3);
+    ASSERT_EQ(key.num_layers, 3u);
+    ASSERT_EQ(key.num_facets, 12u);
+}
+
+TEST(SliceCache, DisabledByDefault)
+{
+    SliceCache cache;
+    ASSERT_FALSE(cache.enabled());
+    std::vector<ExPolygons> layers = make_layers(10);
+    cache.put(make_test_key(0.1f), layers);
+    ASSERT_EQ(cache.memsize(), 0u);
+    ASSERT_FALSE(cache.get(make_test_key(0.1f), layers));
+}
+
+TEST(SliceCache, DiskRoundTrip)
+{
+    TempDirectory dir;
+    SliceCache    cache;
+    cache.set_directory(dir.path.string());
+    ASSERT_TRUE(cache.enabled());
+
+    std::vector<ExPolygons> layers = make_layers(100);
+    SliceCache::Key         key    = make_test_key(0.1f);
+    cache.put(key, layers);
+    // The in-memory cache is disabled, the layers are decoded from the file.
+    ASSERT_EQ(cache.memsize(), 0u);
+    ASSERT_TRUE(boost::filesystem::exists(dir.path / (key.to_string() + ".slices")));
+    std::vector<ExPolygons> loaded;
+    ASSERT_TRUE(cache.get(key, loaded));
+    ASSERT_TRUE(equal_layers(loaded, layers));
+    ASSERT_FALSE(cache.get(make_test_key(0.2f), loaded));
+
+    // Empty list of layers.
+    cache.put(make_test_key(0.3f, 0), std::vector<ExPolygons>());
+    ASSERT_TRUE(cache.get(make_test_key(0.3f, 0), loaded));
+    ASSERT_TRUE(loaded.empty());
+
+    // The layers not matching the number of the slicing heights are not stored.
+    cache.put(make_test_key(0.4f, 99), layers);
+    ASSERT_FALSE(boost::filesystem::exists(dir.path / (make_test_key(0.4f, 99).to_string() + ".slices")));
+    ASSERT_FALSE(cache.get(make_test_key(0.4f, 99), loaded));
+}
+
+TEST(SliceCache, CorruptedFile)
+{
+    TempDirectory dir;
+    SliceCache    cache;
+    cache.set_directory(dir.path.string());
+
+    std::vector<ExPolygons> layers = make_layers(100);
+    SliceCache::Key         key    = make_test_key(0.1f);
+    std::string             path   = (dir.path / (key.to_string() + ".slices")).string();
+    cache.put(key, layers);
+    std::string             data;
+    read_file(path, data);
+    ASSERT_FALSE(data.empty());
+    std::vector<ExPolygons> loaded;
+
+    // Truncated file. The corrupted files are deleted.
+    for (size_t len : { size_t(0), size_t(4), size_t(8), data.size() / 2, data.size() - 1 }) {
+        write_file(path, data.substr(0, len));
+        ASSERT_FALSE(cache.get(key, loaded));
+        ASSERT_TRUE(loaded.empty());
+        ASSERT_FALSE(boost::filesystem::exists(path));
+    }
+    // Trailing garbage.
+    write_file(path, data + "x");
+    ASSERT_FALSE(cache.get(key, loaded));
+    // Wrong magic, for example a file of a former version of the encoding.
+    std::string wrong_magic = data;
+    wrong_magic[7] ^= 1;
+    write_file(path, wrong_magic);
+    ASSERT_FALSE(cache.get(key, loaded));
+    // Huge counts must not allocate the memory before the data are validated.
+    std::string huge_count = data.substr(0, 8) + std::string(9, char(0xff)) + char(0x01);
+    write_file(path, huge_count);
+    ASSERT_FALSE(cache.get(key, loaded));
+    // A valid file with a header not matching the key, as if the digests collided.
+    SliceCache::Key other = make_test_key(0.2f, 99);
+    other.lo = key.lo;
+    other.hi = key.hi;
+    write_file(path, data);
+    ASSERT_FALSE(cache.get(other, loaded));
+    ASSERT_FALSE(boost::filesystem::exists(path));
+
+    // The valid file is read again.
+    write_file(path, data);
+    ASSERT_TRUE(cache.get(key, loaded));
+    ASSERT_TRUE(equal_layers(loaded, layers));
+}
+
+TEST(SliceCache, LRUEviction)
+{
+    SliceCache cache;
+    cache.set_memory_limit(size_t(1) << 30);
+    std::vector<ExPolygons> layers = make_layers(100);
+    SliceCache::Key         a      = make_test_key(0.1f);
+    SliceCache::Key         b      = make_test_key(0.2f);
+    SliceCache::Key         c      = make_test_key(0.3f);
+    cache.put(a, layers);
+    size_t entry_memsize = cache.memsize();
+    ASSERT_GT(entry_memsize, 0u);
+
+    // Room for two entries.
+    cache.set_memory_limit(2 * entry_memsize + entry_memsize / 2);
+    cache.put(b, layers);
+    ASSERT_EQ(cache.memsize(), 2 * entry_memsize);
+    // Touch a, so that b becomes the least recently used entry.
+    std::vector<ExPolygons> loaded;
+    ASSERT_TRUE(cache.get(a, loaded));
+    ASSERT_TRUE(equal_layers(loaded, layers));
+    cache.put(c, layers);
+    ASSERT_EQ(cache.memsize(), 2 * entry_memsize);
+    ASSERT_TRUE(cache.get(a, loaded));
+    ASSERT_TRUE(cache.get(c, loaded));
+    ASSERT_FALSE(cache.get(b, loaded));
+
+    // Lowering the limit evicts the least recently used entry, that is a.
+    cache.set_memory_limit(entry_memsize);
+    ASSERT_EQ(cache.memsize(), entry_memsize);
+    ASSERT_TRUE(cache.get(c, loaded));
+    ASSERT_FALSE(cache.get(a, loaded));
+
+    cache.clear();
+    ASSERT_EQ(cache.memsize(), 0u);
+    ASSERT_FALSE(cache.get(c, loaded));
+}
+
+TEST(SliceCache, DiskLimit)
+{
+    TempDirectory dir;
+    SliceCache    cache;
+    cache.set_directory(dir.path.string());
+
+    std::vector<ExPolygons> layers = make_layers(100);
+    SliceCache::Key         a      = make_test_key(0.1f);
+    SliceCache::Key         b      = make_test_key(0.2f);
+    SliceCache::Key         c      = make_test_key(0.3f);
+    std::string             path_a = (dir.path / (a.to_string() + ".slices")).string();
+    std::string             path_b = (dir.path / (b.to_string() + ".slices")).string();
+    std::string             path_c = (dir.path / (c.to_string() + ".slices")).string();
+    cache.put(a, layers);
+    size_t file_size = size_t(boost::filesystem::file_size(path_a));
+
+    // Room for two files.
+    cache.set_disk_limit(2 * file_size + file_size / 2);
+    cache.put(b, layers);
+    // Make a the least recently used file, the file times have a resolution of a second.
+    boost::filesystem::last_write_time(path_a, std::time(nullptr) - 20);
+    boost::filesystem::last_write_time(path_b, std::time(nullptr) - 10);
+    cache.put(c, layers);
+    ASSERT_FALSE(boost::filesystem::exists(path_a));
+    ASSERT_TRUE(boost::filesystem::exists(path_b));
+    ASSERT_TRUE(boost::filesystem::exists(path_c));
+
+    // Reading b marks it as recently used, thus c is deleted next.
+    boost::filesystem::last_write_time(path_b, std::time(nullptr) - 20);
+    boost::filesystem::last_write_time(path_c, std::time(nullptr) - 10);
+    std::vector<ExPolygons> loaded;
+    ASSERT_TRUE(cache.get(b, loaded));
+    cache.put(a, layers);
+    ASSERT_TRUE(boost::filesystem::exists(path_a));
+    ASSERT_TRUE(boost::filesystem::exists(path_b));
+    ASSERT_FALSE(boost::filesystem::exists(path_c));
+}
@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+
+#include <boost/filesystem.hpp>
+
+#include <miniz.h>
+
+#include <libslic3r/ExPolygon.hpp>
+#include <libslic3r/PrintConfig.hpp>
+#include <libslic3r/miniz_extension.hpp>
+#include <libslic3r/SLA/SLARaster.hpp>
+#include <libslic3r/SLA/SLARasterWriter.hpp>
+
+using namespace Slic3r;
+
+static uint32_t png_u32(const uint8_t *p)
+{
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+// Decodes an 8bit gray, non-interlaced PNG into its pixels, row by row.
+static bool decode_gray_png(sla::RawBytes &png, unsigned &width, unsigned &height, std::vector<uint8_t> &pixels)
+{
+    const uint8_t *data = png.data();
+    const size_t   size = png.size();
+    static const uint8_t signature[] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a };
+    if (size < 8 || memcmp(data, signature, 8) != 0)
+        return false;
+    std::vector<uint8_t> idat;
+    for (size_t pos = 8; pos + 12 <= size;) {
+        uint32_t len = png_u32(data + pos);
+        const uint8_t *type = data + pos + 4;
+        const uint8_t *body = data + pos + 8;
+        if (pos + 12 + len > size || mz_crc32(MZ_CRC32_INIT, type, len + 4) != png_u32(body + len))
+            return false;
+        if (memcmp(type, "IHDR", 4) == 0) {
+            width  = png_u32(body);
+            height = png_u32(body + 4);
+            // Bit depth 8, gray, no interlace.
+            if (len != 13 || body[8] != 8 || body[9] != 0 || body[12] != 0)
+                return false;
+        } else if (memcmp(type, "IDAT", 4) == 0)
+            idat.insert(idat.end(), body, body + len);
+        else if (memcmp(type, "IEND", 4) == 0)
+            break;
+        pos += 12 + len;
+    }
+
+    size_t filtered_len = 0;
+    void  *filtered_ptr = tinfl_decompress_mem_to_heap(idat.data(), idat.size(), &filtered_len, TINFL_FLAG_PARSE_ZLIB_HEADER);
+    if (filtered_ptr == nullptr)
+        return false;
+    std::vector<uint8_t> filtered((const uint8_t*)filtered_ptr, (const uint8_t*)filtered_ptr + filtered_len);
+    mz_free(filtered_ptr);
+    if (filtered.size() != size_t(width + 1) * height)
+        return false;
+
+    // Undo the filters of the rows.
+    pixels.assign(size_t(width) * height, 0);
+    for (unsigned y = 0; y < height; ++ y) {
+        const uint8_t *in    = filtered.data() + size_t(width + 1) * y;
+        uint8_t       *out   = pixels.data() + size_t(width) * y;
+        const uint8_t *prev  = y > 0 ? out - width : nullptr;
+        for (unsigned x = 0; x < width; ++ x) {
+            int a = x > 0 ? out[x - 1] : 0;
+            int b = prev ? prev[x] : 0;
+            int c = (x > 0 && prev) ? prev[x - 1] : 0;
+            int pred = 0;
+            switch (in[0]) {
+            case 0: pred = 0; break;
+            case 1: pred = a; break;
+            case 2: pred = b; break;
+            case 3: pred = (a + b) / 2; break;
+            case 4: {
+                int p = a + b - c, pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+                pred = (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+                break;
+            }
+            default: return false;
+            }
+            out[x] = uint8_t(in[x + 1] + pred);
+        }
+    }
+    return true;
+}
+
+// Rings, overlapping squares and a sliver thinner than a pixel, in scaled coordinates of a 60x30mm display.
+static ExPolygons layer_polygons()
+{
+    ExPolygons out;
+    for (int i = 0; i < 6; ++ i) {
+        ExPolygon ring;
+        double    cx = 8. + 9. * i, cy = 15.;
+        for (int k = 0; k < 90; ++ k) {
+            double phi = 2. * PI * k / 90.;
+            ring.contour.points.emplace_back(Point::new_scale(cx + 4. * std::cos(phi), cy + 4. * std::sin(phi)));
+        }
+        Polygon hole;
+        for (int k = 89; k >= 0; -- k) {
+            double phi = 2. * PI * k / 90.;
+            hole.points.emplace_back(Point::new_scale(cx + 2.5 * std::cos(phi), cy + 1.5 * std::sin(phi)));
+        }
+        ring.holes.emplace_back(std::move(hole));
+        out.emplace_back(std::move(ring));
+    }
+    for (int i = 0; i < 2; ++ i) {
+        ExPolygon square;
+        double    d = 2. + 1.33 * i;
+        square.contour.points = { Point::new_scale(d, d), Point::new_scale(d + 3.7, d), Point::new_scale(d + 3.7, d + 3.7), Point::new_scale(d, d + 3.7) };
+        out.emplace_back(std::move(square));
+    }
+    ExPolygon sliver;
+    sliver.contour.points = { Point::new_scale(20., 26.), Point::new_scale(50., 26.02), Point::new_scale(50., 26.05) };
+    out.emplace_back(std::move(sliver));
+    return out;
+}
+
+// The PNG written by the full frame raster and the PNG expanded from the runs of the RLE raster decode to the same pixels.
+TEST(SLARaster, RLEMatchesPixelRaster)
+{
+    const sla::Raster::Resolution res(600, 300);
+    const sla::Raster::PixelDim   pd(60. / 600., 30. / 300.);
+    const ExPolygons              polygons = layer_polygons();
+
+    for (double gamma : { 1., 2.2 })
+        for (bool mirror_x : { false, true }) {
+            std::array<bool, 2> mirror = { mirror_x, true };
+            sla::Raster pixel_raster, rle_raster;
+            pixel_raster.reset(res, pd, mirror, gamma);
+            rle_raster.reset(res, pd, mirror, sla::Raster::Format::RLE, gamma);
+            for (const ExPolygon &expoly : polygons) {
+                pixel_raster.draw(expoly);
+                rle_raster.draw(expoly);
+            }
+
+            sla::RawBytes        png_pixel = pixel_raster.save(sla::Raster::Format::PNG);
+            sla::RawBytes        png_rle   = rle_raster.save(sla::Raster::Format::PNG);
+            unsigned             w_pixel = 0, h_pixel = 0, w_rle = 0, h_rle = 0;
+            std::vector<uint8_t> pixels_pixel, pixels_rle;
+            ASSERT_TRUE(decode_gray_png(png_pixel, w_pixel, h_pixel, pixels_pixel));
+            ASSERT_TRUE(decode_gray_png(png_rle, w_rle, h_rle, pixels_rle));
+            EXPECT_EQ(w_pixel, res.width_px);
+            EXPECT_EQ(h_pixel, res.height_px);
+            EXPECT_EQ(w_rle, w_pixel);
+            EXPECT_EQ(h_rle, h_pixel);
+            EXPECT_TRUE(pixels_rle == pixels_pixel);
+
+            // Both lit and anti-aliased pixels.
+            size_t num_lit = 0, num_gray = 0;
+            for (uint8_t px : pixels_pixel) {
+                num_lit  += px == 255;
+                num_gray += px > 0 && px < 255;
+            }
+            EXPECT_GT(num_lit, 1000u);
+            EXPECT_GT(num_gray, 100u);
+        }
+}
+
+// Extracts the layer images of an archive written by SLARasterWriter and counts their lit pixels.
+static void read_layers(const std::string &path, const std::string &project, size_t num_layers, std::vector<size_t> &lit_pixels)
+{
+    mz_zip_archive archive;
+    mz_zip_zero_struct(&archive);
+    ASSERT_TRUE(open_zip_reader(&archive, path));
+    // config.ini and the layers.
+    EXPECT_EQ(mz_zip_reader_get_num_files(&archive), num_layers + 1);
+    EXPECT_GE(mz_zip_reader_locate_file(&archive, "config.ini", nullptr, 0), 0);
+    lit_pixels.clear();
+    for (size_t i = 0; i < num_layers; ++ i) {
+        char name[64];
+        sprintf(name, "%s%.5d.png", project.c_str(), int(i));
+        size_t size = 0;
+        void  *data = mz_zip_reader_extract_file_to_heap(&archive, name, &size, 0);
+        ASSERT_TRUE(data != nullptr) << name;
+        sla::RawBytes png(std::vector<uint8_t>((const uint8_t*)data, (const uint8_t*)data + size));
+        mz_free(data);
+        unsigned w = 0, h = 0;
+        std::vector<uint8_t> pixels;
+        ASSERT_TRUE(decode_gray_png(png, w, h, pixels));
+        lit_pixels.emplace_back(std::count(pixels.begin(), pixels.end(), uint8_t(255)));
+    }
+    close_zip_reader(&archive);
+}
+
+// Each layer is a square growing with the layer index. The second export copies the images of the first one.
+TEST(SLARasterWriter, ExportLayers)
+{
+    SLAPrinterConfig printer_config;
+    printer_config.display_width.value    = 60.;
+    printer_config.display_height.value   = 30.;
+    printer_config.display_pixels_x.value = 600;
+    printer_config.display_pixels_y.value = 300;
+    SLAMaterialConfig material_config;
+    sla::SLARasterWriter writer(printer_config, material_config, 0.05);
+
+    const unsigned num_layers = 20;
+    size_t         num_drawn  = 0;
+    std::vector<unsigned> status;
+    auto draw_layer = [&writer, &num_drawn](sla::Raster &raster, unsigned id) {
+        // Squares of 2mm to 21mm, 20 to 210 pixels.
+        double    d = 2. + id;
+        ExPolygon square;
+        square.contour.points = { Point::new_scale(1., 1.), Point::new_scale(1. + d, 1.), Point::new_scale(1. + d, 1. + d), Point::new_scale(1., 1. + d) };
+        writer.draw_polygon(square, raster);
+        ++ num_drawn;
+    };
+
+    const boost::filesystem::path dir = boost::filesystem::temp_directory_path();
+    const std::string path1 = (dir / boost::filesystem::unique_path("test_sla_raster-%%%%-%%%%.sl1")).string();
+    const std::string path2 = (dir / boost::filesystem::unique_path("test_sla_raster-%%%%-%%%%.sl1")).string();
+
+    writer.save(path1, "first", num_layers, draw_layer, [&status](unsigned st) { status.emplace_back(st); });
+    EXPECT_EQ(num_drawn, size_t(num_layers));
+    ASSERT_FALSE(status.empty());
+    EXPECT_EQ(status.back(), 100u);
+    std::vector<size_t> lit1;
+    read_layers(path1, "first", num_layers, lit1);
+    ASSERT_EQ(lit1.size(), size_t(num_layers));
+    for (unsigned i = 0; i < num_layers; ++ i) {
+        // The square is aligned with the pixels.
+        size_t side = 20 + 10 * i;
+        EXPECT_NEAR(double(lit1[i]), double(side * side), 2. * side) << "layer " << i;
+    }
+
+    // The layers are neither rasterized again nor is the progress reported again.
+    status.clear();
+    writer.save(path2, "second", num_layers, draw_layer, [&status](unsigned st) { status.emplace_back(st); });
+    EXPECT_EQ(num_drawn, size_t(num_layers));
+    EXPECT_TRUE(status.empty());
+    std::vector<size_t> lit2;
+    read_layers(path2, "second", num_layers, lit2);
+    EXPECT_TRUE(lit2 == lit1);
+
+    boost::filesystem::remove(path1);
+    boost::filesystem::remove(path2);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <libslic3r/TriangleMesh.hpp>
+#include <libslic3r/SLA/SLACommon.hpp>
+#include <libslic3r/SLA/SLARayBVH.hpp>
+
+#include <igl/AABB.h>
+
+using namespace Slic3r;
+
+// Packets of rays starting on a small circle and sharing a direction, like
+// those of the collision tests of the support tree.
+static void ray_packets(const BoundingBoxf3 &bb, size_t num_packets,
+                        std::vector<Vec3d> &sources, std::vector<Vec3d> &dirs)
+{
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> ux(bb.min(0), bb.max(0)), uy(bb.min(1), bb.max(1)), uz(bb.min(2), bb.max(2));
+    std::normal_distribution<double> normal;
+    for (size_t i = 0; i < num_packets; ++ i) {
+        Vec3d c(ux(rng), uy(rng), uz(rng));
+        Vec3d d = Vec3d(normal(rng), normal(rng), normal(rng)).normalized();
+        // Some packets along the axes, parallel to the faces of the cube.
+        if (i % 4 == 0)
+            d = Vec3d::Zero(), d(i % 3) = (i % 8 == 0) ? 1. : -1.;
+        Vec3d a = d.cross(std::abs(d(0)) < 0.9 ? Vec3d(1., 0., 0.) : Vec3d(0., 1., 0.)).normalized();
+        Vec3d b = d.cross(a);
+        for (size_t k = 0; k < sla::RayBVH::RaysInPacket; ++ k) {
+            double phi = 2. * PI * double(k) / double(sla::RayBVH::RaysInPacket);
+            sources.emplace_back(c + 0.5 * (std::cos(phi) * a + std::sin(phi) * b));
+            dirs.emplace_back(d);
+        }
+    }
+}
+
+// Both the packet traversal and the traversal of single rays report the hits
+// of igl::AABB, whichever of them RayBVH::intersect() uses in this build.
+TEST(SLARayBVH, HitsMatchIglAABB)
+{
+    TriangleMesh mesh = make_sphere(20., PI / 90.);
+    TriangleMesh cube = make_cube(30., 10., 10.);
+    cube.translate(-5.f, -5.f, -5.f);
+    mesh.merge(cube);
+    mesh.repair();
+    sla::EigenMesh3D emesh(mesh);
+
+    igl::AABB<Eigen::MatrixXd, 3> aabb;
+    aabb.init(emesh.V(), emesh.F());
+    sla::RayBVH bvh(emesh.V(), emesh.F());
+
+    std::vector<Vec3d> sources, dirs;
+    ray_packets(mesh.bounding_box(), 2000, sources, dirs);
+    const size_t num_rays = sources.size();
+
+    std::vector<sla::RayBVH::Hit> hits_single(num_rays), hits_packet(num_rays), hits_batch(num_rays);
+    for (size_t i = 0; i < num_rays; ++ i)
+        hits_single[i] = bvh.intersect(sources[i], dirs[i]);
+    for (size_t i = 0; i < num_rays; i += sla::RayBVH::RaysInPacket)
+        bvh.intersect_packet(sla::RayBVH::RaysInPacket, sources.data() + i, dirs.data() + i, hits_packet.data() + i);
+    // A partial packet.
+    bvh.intersect_packet(3, sources.data(), dirs.data(), hits_packet.data());
+    bvh.intersect(num_rays, sources.data(), dirs.data(), hits_batch.data());
+
+    size_t num_hits = 0;
+    for (size_t i = 0; i < num_rays; ++ i) {
+        igl::Hit hit;
+        hit.t = std::numeric_limits<float>::infinity();
+        bool igl_hit = aabb.intersect_ray(emesh.V(), emesh.F(), sources[i].transpose(), dirs[i].transpose(), hit);
+        if (igl_hit) {
+            ++ num_hits;
+            // igl stores the hit distance as a float.
+            EXPECT_NEAR(hits_single[i].t, double(hit.t), 1e-5 * std::max(1., double(hit.t)));
+        } else
+            EXPECT_TRUE(std::isinf(hits_single[i].t));
+        EXPECT_EQ(hits_packet[i].t, hits_single[i].t);
+        EXPECT_EQ(hits_packet[i].face, hits_single[i].face);
+        EXPECT_EQ(hits_batch[i].t, hits_single[i].t);
+    }
+    EXPECT_GT(num_hits, num_rays / 4);
+}
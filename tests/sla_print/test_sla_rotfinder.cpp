@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <tbb/task_scheduler_init.h>
+
+#include <libslic3r/Model.hpp>
+#include <libslic3r/SLA/SLARotfinder.hpp>
+#include <libslic3r/TriangleMesh.hpp>
+
+using namespace Slic3r;
+
+// A cylinder tilted around two axes, so that the optimizer has something to do.
+static void add_tilted_cylinder(Model &model)
+{
+    TriangleMesh mesh = make_cylinder(5., 20., 2. * PI / 36.);
+    mesh.rotate_x(0.3f);
+    mesh.rotate_y(-0.7f);
+    mesh.repair();
+    ModelObject *object = model.add_object();
+    object->add_volume(mesh);
+    object->add_instance();
+}
+
+TEST(SLARotfinder, FindBestRotationIsDeterministic)
+{
+    Model model;
+    add_tilted_cylinder(model);
+    const ModelObject &object = *model.objects.front();
+
+    std::array<double, 3> rotation = sla::find_best_rotation(object, 0.05f);
+    for (double r : rotation)
+        ASSERT_TRUE(r >= - PI / 2. && r <= PI / 2.);
+
+    // The same mesh is rotated the same way again, with a status callback and by a single thread.
+    unsigned last_status = 0;
+    ASSERT_TRUE(sla::find_best_rotation(object, 0.05f, [&last_status](unsigned st) { last_status = st; }) == rotation);
+    ASSERT_GT(last_status, 0u);
+    {
+        tbb::task_scheduler_init scheduler(1);
+        ASSERT_EQ(sla::find_best_rotation(object, 0.05f), rotation);
+    }
+    ASSERT_EQ(sla::find_best_rotation(object, 0.05f), rotation);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <libslic3r/SLA/SLASupportTree.hpp>
+#include <libslic3r/TriangleMesh.hpp>
+
+using namespace Slic3r;
+
+// Support points in a grid on the bottom face of a 20mm cube.
+static std::vector<sla::SupportPoint> cube_bottom_points()
+{
+    std::vector<sla::SupportPoint> pts;
+    for (float x : { 4.f, 10.f, 16.f })
+        for (float y : { 4.f, 10.f, 16.f })
+            pts.emplace_back(x, y, 0.f, 0.4f, false);
+    return pts;
+}
+
+// Generate the supports for the edited points with and without the previous tree, the results must not differ.
+// The head placements of the unchanged points are to be taken over from the previous tree.
+static void check_regenerated(const std::vector<sla::SupportPoint> &edited, const sla::EigenMesh3D &emesh,
+                              const sla::SLASupportTree &previous, size_t num_unchanged)
+{
+    sla::SupportConfig  cfg;
+    sla::SLASupportTree regenerated(edited, emesh, cfg, {}, previous);
+    sla::SLASupportTree fresh(edited, emesh, cfg);
+
+    EXPECT_EQ(regenerated.reused_placements(), num_unchanged);
+    EXPECT_EQ(fresh.reused_placements(), size_t(0));
+
+    ASSERT_FALSE(fresh.head_junctions().empty());
+    ASSERT_FALSE(fresh.pillar_endpoints().empty());
+    ASSERT_TRUE(regenerated.head_junctions() == fresh.head_junctions());
+    ASSERT_TRUE(regenerated.pillar_endpoints() == fresh.pillar_endpoints());
+
+    const TriangleMesh &mesh_regenerated = regenerated.merged_mesh();
+    const TriangleMesh &mesh_fresh       = fresh.merged_mesh();
+    ASSERT_FALSE(mesh_fresh.empty());
+    ASSERT_TRUE(mesh_regenerated.its.vertices == mesh_fresh.its.vertices);
+    ASSERT_TRUE(mesh_regenerated.its.indices == mesh_fresh.its.indices);
+}
+
+TEST(SLASupportTree, RegenerateWithPreviousTree)
+{
+    TriangleMesh mesh = make_cube(20., 20., 20.);
+    mesh.repair();
+    sla::EigenMesh3D emesh(mesh);
+
+    std::vector<sla::SupportPoint> pts = cube_bottom_points();
+    sla::SLASupportTree base(pts, emesh);
+
+    // Move one support point.
+    std::vector<sla::SupportPoint> moved = pts;
+    moved[4].pos(0) += 1.f;
+    check_regenerated(moved, emesh, base, pts.size() - 1);
+
+    // Add one support point.
+    std::vector<sla::SupportPoint> added = pts;
+    added.emplace_back(7.f, 7.f, 0.f, 0.4f, false);
+    check_regenerated(added, emesh, base, pts.size());
+
+    // Remove one support point.
+    std::vector<sla::SupportPoint> removed = pts;
+    removed.erase(removed.begin() + 4);
+    check_regenerated(removed, emesh, base, pts.size() - 1);
+}